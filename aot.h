@@ -0,0 +1,110 @@
+#ifndef AOT_H
+#define AOT_H
+
+#include "dom6502.h"
+#include "opcodes.h"
+
+/*  Ahead-of-time translated ROM (STATIC_ROM).
+
+    rom1541.h is generated by rom2c from 1541rom.bin: one function per basic
+    block reachable from the vectors, with every operand and next pc folded
+    into constants, so running the ROM costs no decode at all. The functions
+    work on the registers in the cpu context. rom_run() chains them while the budget
+    lasts; run_blocks() calls it whenever pc has a translated block and falls
+    back to its own blocks for everything else (RAM routines, computed jumps
+    to code the walk did not find, BRK).
+
+    The translation is only used while ram[] holds the image it was generated
+    from (c->rom_intact). blocks_flush() compares them and keeps the ROM pages marked as
+    code, so the first write there goes through blocks_write() and turns the
+    translation off until the next flush. Once the ROM is mapped read-only
+    (cpu_map_rom()) no write gets there. Traced runs go through the
+    instrumented engine instead (cpu_instrument()).  */
+
+typedef uint32_t (*rom_block)(cpu *c);
+
+static inline void blocks_write(cpu *c, uint16_t addr);
+
+#define AC c->ac
+#define XR c->xr
+#define YR c->yr
+#define SP c->sp
+#define SR c->sr
+#define PC c->pc
+#define RD(addr) bus_read(&c->bus, addr, c->clock + cycles)
+#define WR(addr, v) { \
+        uint16_t wa = (addr); \
+        if (__builtin_expect(bus_write(&c->bus, wa, v, c->clock + cycles), 0)) blocks_write(c, wa); \
+    }
+#define RD_RAM(addr) c->ram[addr]
+#define WR_RAM(addr, v) { \
+        uint16_t wa = (addr); \
+        c->ram[wa] = (v); \
+        if (__builtin_expect(c->blocks->code_pages[wa >> 8] != 0, 0)) blocks_write(c, wa); \
+    }
+#define OPB() ((uint8_t)s_operand)
+#define OPW() (s_operand)
+#define CYC cycles
+#define FN c->lazy_n
+#define FZ c->lazy_z
+
+// One translated instruction, `next` is the address of the following one; IMP and ACC leave the operand unread
+#define S(op, mode, operand, next, cyc) { \
+        __attribute__((unused)) const uint16_t s_operand = operand; \
+        EA_##mode \
+        PC = next; \
+        OP_##op(LD_##mode, ST_##mode) \
+        cycles += cyc; \
+    }
+
+#include "rom1541.h"
+
+static inline void rom_flush(cpu *c) {
+    // Called by blocks_flush(), after code_pages has been cleared
+    c->rom_intact = memcmp(c->ram + ROM_START, rom_image, ROM_SIZE) == 0;
+    if (c->rom_intact) {
+        for (int p = ROM_START >> 8; p <= 0xFF; p++) {
+            if (c->blocks->code_pages[p]++ == 0)
+                bus_watch(&c->bus, p, true);
+        }
+    }
+}
+
+static inline rom_block rom_at(cpu *c, uint16_t addr) {
+    return (c->rom_intact && addr >= ROM_START) ? rom_code[addr - ROM_START] : NULL;
+}
+
+static inline uint64_t rom_run(cpu *c, uint64_t budget) {
+    // Runs translated blocks from pc until the budget is spent or pc leaves them, c->clock follows
+    uint64_t cycles = 0;
+    rom_block f;
+    PUT_SR(SR);
+    while ((f = rom_at(c, PC)) != NULL) {
+        uint32_t k = f(c);
+        cycles += k;
+        c->clock += k;
+        if ((cycles >= budget) | PENDING(c))
+            break;
+    }
+    SR = GET_SR();
+    return cycles;
+}
+
+#undef AC
+#undef XR
+#undef YR
+#undef SP
+#undef SR
+#undef PC
+#undef RD
+#undef WR
+#undef RD_RAM
+#undef WR_RAM
+#undef OPB
+#undef OPW
+#undef CYC
+#undef FN
+#undef FZ
+#undef S
+
+#endif
@@ -0,0 +1,584 @@
+#ifndef BLOCKS_H
+#define BLOCKS_H
+
+#include "dom6502.h"
+#include "opcodes.h"
+
+/*  Pre-decoded basic block cache.
+
+    A block is a straight-line run of instructions ending with a branch, JMP,
+    JSR, RTS, RTI, BRK or an undocumented opcode, decoded once into an array
+    of micro-ops: the address of the opcode body inside run_blocks() plus the
+    operand already assembled, so executing it reads no opcode or operand
+    bytes from ram[]. The base cycles of the whole block are summed at decode
+    time; only page crossing penalties are added while it runs.
+
+    Absolute and absolute indexed operands are looked up in the page table
+    at decode time too: when they can only land in memory the uop points at
+    a second body of the opcode that reads ram[] directly, as zero page
+    operands are. The page table only changes with cpu_map_*(), which
+    flushes the cache.
+
+    Pages holding decoded code are watched on the bus (bus_watch()), so
+    every write there goes through blocks_write(), which drops the blocks
+    containing the written byte. A block overwritten
+    while it runs has its remaining micro-ops redirected to an exit, so self
+    modifying code sees the new bytes on the next instruction.
+
+    With IDLE_SKIP, blocks that loop on themselves without writing memory
+    (idle_loop()) are watched: once a pass leaves the registers as they
+    were, the loop can only be left by an interrupt, so the cycle counter
+    jumps to the end of the budget. The JIT leaves these blocks to the
+    interpreter.
+
+    The cache belongs to one cpu (c->blocks); only the labels of run_blocks()
+    are shared by all of them.  */
+
+#define BLOCK_UOPS  32      // longest run decoded into one block
+#define BLOCK_BYTES (BLOCK_UOPS * 3)
+#define BLOCK_COUNT 4096    // when all are in use the whole cache is flushed
+
+typedef struct uop {
+    void *label;        // opcode body in run_blocks()
+    uint16_t operand;   // second and third instruction bytes
+    uint8_t opcode;
+    uint8_t cycles;     // base cycles, needed when a block is left half way
+    uint16_t at;        // base cycles of the uops before it, for the time of its bus accesses
+} uop;
+
+typedef struct block {
+    #if ENGINE == ENGINE_JIT
+    void *native;       // translated code, first so that generated code finds it at offset 0
+    uint32_t hits;
+    #endif
+    uint16_t start;
+    uint32_t end;       // first address after the block
+    uint16_t cycles;    // sum of the base cycles
+    uint8_t count;
+    bool idle;          // a loop on itself that never writes, see IDLE_SKIP
+    struct block *next_free;
+    uop uops[BLOCK_UOPS + 1];   // the extra one leaves the block
+} block;
+
+typedef struct block_cache {
+    block *free;
+    block *at[65536];
+    uint16_t code_pages[256];   // live blocks overlapping each page
+    #if FUSION_STATS
+    uint64_t *fired;            // fused uops run by this cpu, by FUSE_*
+    #endif
+    block pool[BLOCK_COUNT];
+} block_cache;
+
+// Where the uops of an overwritten block are sent: uop_exit in run_blocks(),
+// stored by every call, which may run on several threads
+static _Atomic(void *) block_exit = NULL;
+
+#if STATIC_ROM
+#include "aot.h"
+#endif
+
+static inline int block_last_page(block *b) {
+    // An instruction at the top of memory has its operand past $FFFF
+    return b->end > 0xFFFF ? 0xFF : (b->end - 1) >> 8;
+}
+
+static inline void blocks_flush(cpu *c) {
+    block_cache *k = c->blocks;
+    memset(k->at, 0, sizeof(k->at));
+    memset(k->code_pages, 0, sizeof(k->code_pages));
+    for (int p = 0; p < 256; p++)
+        bus_watch(&c->bus, p, false);
+    k->free = NULL;
+    for (int i = BLOCK_COUNT - 1; i >= 0; i--) {
+        k->pool[i].next_free = k->free;
+        k->free = &k->pool[i];
+    }
+    #if STATIC_ROM
+    rom_flush(c);
+    #endif
+}
+
+static inline void block_drop(cpu *c, block *b) {
+    block_cache *k = c->blocks;
+    void *exit = atomic_load_explicit(&block_exit, memory_order_relaxed);
+    for (int i = 0; i <= b->count; i++)
+        b->uops[i].label = exit;
+    #if ENGINE == ENGINE_JIT
+    b->native = NULL;
+    #endif
+    k->at[b->start] = NULL;
+    for (int p = b->start >> 8; p <= block_last_page(b); p++) {
+        if (--k->code_pages[p] == 0)
+            bus_watch(&c->bus, p, false);
+    }
+    b->next_free = k->free;
+    k->free = b;
+}
+
+static inline void blocks_write(cpu *c, uint16_t addr) {
+    #if STATIC_ROM
+    if (addr >= ROM_START)
+        c->rom_intact = false;
+    #endif
+    // Only blocks starting up to BLOCK_BYTES before addr can contain it
+    int first = addr >= BLOCK_BYTES ? addr - BLOCK_BYTES + 1 : 0;
+    for (int a = first; a <= addr; a++) {
+        block *b = c->blocks->at[a];
+        if (b && addr < b->end)
+            block_drop(c, b);
+    }
+}
+
+static inline bool block_ends(uint8_t opcode) {
+    instruction i = instructions[opcode];
+    return i.mode == REL || i.mode == _ND ||
+        opcode == 0x00 || opcode == 0x20 || opcode == 0x40 ||
+        opcode == 0x4C || opcode == 0x60 || opcode == 0x6C;
+}
+
+static inline block *block_decode(cpu *c, uint16_t pc, void *const *labels, void *const *direct, void *end) {
+    const uint8_t *ram = c->ram;
+    block_cache *k = c->blocks;
+    if (k->free == NULL)
+        blocks_flush(c);
+    block *b = k->free;
+    k->free = b->next_free;
+
+    b->start = pc;
+    b->cycles = 0;
+    b->count = 0;
+    #if ENGINE == ENGINE_JIT
+    b->native = NULL;
+    b->hits = 0;
+    #endif
+    while (true) {
+        uint8_t opcode = ram[pc];
+        instruction i = instructions[opcode];
+        uop *u = &b->uops[b->count++];
+        u->opcode = opcode;
+        u->cycles = i.cycles;
+        u->at = b->cycles;
+        u->operand = (i.bytes == 3) ? (ram[(uint16_t)(pc + 2)] << 8) | ram[(uint16_t)(pc + 1)] :
+                     (i.bytes == 2) ? ram[(uint16_t)(pc + 1)] : 0;
+        // Indexing reaches at most the page after the base
+        bool memory = c->bus.rd[u->operand >> 8] != NULL && c->bus.rd[(uint16_t)(u->operand + 0xFF) >> 8] != NULL;
+        u->label = (direct[opcode] != NULL && memory) ? direct[opcode] : labels[opcode];
+        b->cycles += i.cycles;
+
+        uint32_t next = pc + (i.bytes ? i.bytes : 1);
+        if (block_ends(opcode) || b->count == BLOCK_UOPS || next > 0xFFFF) {
+            b->end = next;
+            break;
+        }
+        pc = next;
+    }
+    b->uops[b->count].label = end;
+    b->idle = IDLE_SKIP && idle_loop(ram, &c->bus, b->start);
+
+    k->at[b->start] = b;
+    for (int p = b->start >> 8; p <= block_last_page(b); p++) {
+        if (k->code_pages[p]++ == 0)
+            bus_watch(&c->bus, p, true);
+    }
+    return b;
+}
+
+#if FUSION
+/*  Superinstructions: instruction sequences the 1541 ROM runs all the time,
+    each executed by one fused body in run_blocks() instead of one dispatch
+    per instruction. F2 and F3 take a name and then opcode, operation, mode
+    and bytes for each step, as in OPCODES. Longer sequences come first
+    because block_fuse() takes the first one that matches.
+
+    A fused uop only replaces the label of the first uop of its sequence.
+    The other uops keep their operands and cycles, so the block cycles, the
+    instruction count and the accounting in uop_exit do not change.  */
+#define FUSIONS(F2, F3) \
+    F3(lda_cmp_bne,  0xA5, lda, ZP_, 2, 0xC9, cmp, IMM, 2, 0xD0, bne, REL, 2) \
+    F3(lda_cmp_beq,  0xA5, lda, ZP_, 2, 0xC9, cmp, IMM, 2, 0xF0, beq, REL, 2) \
+    F3(ldax_cmp_bne, 0xBD, lda, ABX, 3, 0xC9, cmp, IMM, 2, 0xD0, bne, REL, 2) \
+    F3(ldax_cmp_beq, 0xBD, lda, ABX, 3, 0xC9, cmp, IMM, 2, 0xF0, beq, REL, 2) \
+    F3(iny_cpy_bne,  0xC8, iny, IMP, 1, 0xC0, cpy, IMM, 2, 0xD0, bne, REL, 2) \
+    F3(inx_cpx_bne,  0xE8, inx, IMP, 1, 0xE0, cpx, IMM, 2, 0xD0, bne, REL, 2) \
+    F3(lda_and_sta,  0xAD, lda, AB_, 3, 0x29, and, IMM, 2, 0x8D, sta, AB_, 3) \
+    F2(dex_bne,      0xCA, dex, IMP, 1, 0xD0, bne, REL, 2) \
+    F2(dex_bpl,      0xCA, dex, IMP, 1, 0x10, bpl, REL, 2) \
+    F2(dey_bne,      0x88, dey, IMP, 1, 0xD0, bne, REL, 2) \
+    F2(dey_bpl,      0x88, dey, IMP, 1, 0x10, bpl, REL, 2) \
+    F2(dec_bpl,      0xC6, dec, ZP_, 2, 0x10, bpl, REL, 2) \
+    F2(lda_beq,      0xA5, lda, ZP_, 2, 0xF0, beq, REL, 2) \
+    F2(lda_bne,      0xA5, lda, ZP_, 2, 0xD0, bne, REL, 2) \
+    F2(lday_bpl,     0xB9, lda, ABY, 3, 0x10, bpl, REL, 2) \
+    F2(cmp_beq,      0xC9, cmp, IMM, 2, 0xF0, beq, REL, 2) \
+    F2(cmp_bne,      0xC9, cmp, IMM, 2, 0xD0, bne, REL, 2) \
+    F2(and_beq,      0x29, and, IMM, 2, 0xF0, beq, REL, 2) \
+    F2(and_bne,      0x29, and, IMM, 2, 0xD0, bne, REL, 2) \
+    F2(bit_bpl,      0x2C, bit, AB_, 3, 0x10, bpl, REL, 2) \
+    F2(bit_bmi,      0x2C, bit, AB_, 3, 0x30, bmi, REL, 2) \
+    F2(lda_sta,      0xA9, lda, IMM, 2, 0x85, sta, ZP_, 2)
+
+#define F_ID2(name, c1, o1, m1, b1, c2, o2, m2, b2) FUSE_##name,
+#define F_ID3(name, c1, o1, m1, b1, c2, o2, m2, b2, c3, o3, m3, b3) FUSE_##name,
+#define F_PATTERN2(name, c1, o1, m1, b1, c2, o2, m2, b2) {#name, 2, {c1, c2}},
+#define F_PATTERN3(name, c1, o1, m1, b1, c2, o2, m2, b2, c3, o3, m3, b3) {#name, 3, {c1, c2, c3}},
+
+enum { FUSIONS(F_ID2, F_ID3) FUSION_COUNT };
+
+typedef struct fusion {
+    const char *name;
+    uint8_t length;
+    uint8_t opcodes[3];
+} fusion;
+
+static const fusion fusions[FUSION_COUNT] = { FUSIONS(F_PATTERN2, F_PATTERN3) };
+
+static inline void block_fuse(block *b, void *const *fused) {
+    // Points the first uop of every known sequence in b at its fused body
+    for (int i = 0; i < b->count; i++) {
+        for (int f = 0; f < FUSION_COUNT; f++) {
+            const fusion *s = &fusions[f];
+            if (i + s->length > b->count)
+                continue;
+            int k = 0;
+            while (k < s->length && b->uops[i + k].opcode == s->opcodes[k])
+                k++;
+            if (k == s->length) {
+                b->uops[i].label = fused[f];
+                i += s->length - 1;
+                break;
+            }
+        }
+    }
+}
+
+#if FUSION_STATS
+static inline void fusion_report(const cpu *c) {
+    // Fused uops c ran so far, and the dispatches they saved out of its instructions
+    const uint64_t *fired = c->blocks->fired;
+    uint64_t executed = c->executed;
+    uint64_t saved = 0;
+    printf("fusion          fired      dispatches saved\n");
+    for (int f = 0; f < FUSION_COUNT; f++) {
+        if (fired[f] == 0)
+            continue;
+        printf("%-12s %12llu %12llu\n", fusions[f].name,
+            (unsigned long long)fired[f],
+            (unsigned long long)(fired[f] * (fusions[f].length - 1)));
+        saved += fired[f] * (fusions[f].length - 1);
+    }
+    printf("%llu of %llu dispatches saved (%.1f%%)\n",
+        (unsigned long long)saved, (unsigned long long)executed,
+        executed ? 100.0 * saved / executed : 0.0);
+}
+#endif
+
+#undef F_ID2
+#undef F_ID3
+#undef F_PATTERN2
+#undef F_PATTERN3
+#endif
+
+#if ENGINE == ENGINE_JIT
+#include "jit.h"
+#endif
+
+static inline bool blocks_create(cpu *c) {
+    c->blocks = malloc(sizeof(block_cache));
+    if (c->blocks == NULL)
+        return false;
+    #if FUSION_STATS
+    c->blocks->fired = calloc(FUSION_COUNT, sizeof(uint64_t));
+    if (c->blocks->fired == NULL) {
+        free(c->blocks);
+        return false;
+    }
+    #endif
+    blocks_flush(c);
+    #if ENGINE == ENGINE_JIT
+    jit_create(c);
+    #endif
+    return true;
+}
+
+static inline void blocks_destroy(cpu *c) {
+    #if ENGINE == ENGINE_JIT
+    jit_destroy(c);
+    #endif
+    #if FUSION_STATS
+    free(c->blocks->fired);
+    #endif
+    free(c->blocks);
+    c->blocks = NULL;
+}
+
+#define AC l_ac
+#define XR l_xr
+#define YR l_yr
+#define SP l_sp
+#define SR l_sr
+#define PC l_pc
+#define RD(addr) bus_read(&c->bus, addr, start + cycles + at)
+#define WR(addr, v) { \
+        uint16_t wa = (addr); \
+        if (__builtin_expect(bus_write(&c->bus, wa, v, start + cycles + at), 0)) blocks_write(c, wa); \
+    }
+#define RD_RAM(addr) ram[addr]
+#define WR_RAM(addr, v) { \
+        uint16_t wa = (addr); \
+        ram[wa] = (v); \
+        if (__builtin_expect(code_pages[wa >> 8] != 0, 0)) blocks_write(c, wa); \
+    }
+#define OPB() ((uint8_t)u->operand)
+#define OPW() (u->operand)
+#define CYC cycles
+#define HALT() stop = true
+#define FN l_fn
+#define FZ l_fz
+
+#define B_LABEL(code, op, mode, bytes, cyc) [code] = &&uop_##code,
+
+// ea, ld and st are the pasted EA_, LD_ and ST_ macros of the mode, so that
+// they survive being passed along: mode names are macros themselves
+#define B_STEP(op, mode, ea, ld, st, bytes) { \
+        __attribute__((unused)) const uint16_t at = u->at; \
+        ea \
+        PC += bytes; \
+        OP_##op(ld, st) \
+        u++; \
+    }
+
+#define B_BODY(code, op, mode, bytes, cyc) \
+    uop_##code: \
+        B_STEP(op, mode, EA_##mode, LD_##mode, ST_##mode, bytes) \
+        goto *u->label;
+
+// B_ABS_<mode>(x, y) is x for the absolute modes and y for the others
+#define B_ABS_AB_(x, y) x
+#define B_ABS_ABX(x, y) x
+#define B_ABS_ABY(x, y) x
+#define B_ABS_IMP(x, y) y
+#define B_ABS_ACC(x, y) y
+#define B_ABS_IMM(x, y) y
+#define B_ABS_REL(x, y) y
+#define B_ABS_ZP_(x, y) y
+#define B_ABS_ZPX(x, y) y
+#define B_ABS_ZPY(x, y) y
+#define B_ABS_IN_(x, y) y
+#define B_ABS_INX(x, y) y
+#define B_ABS_INY(x, y) y
+
+#define B_DIRECT_LABEL(code, op, mode, bytes, cyc) [code] = B_ABS_##mode(&&direct_##code, NULL),
+
+// The operand read from ram[]; writes still go through the bus
+#define B_DIRECT(code, op, mode, bytes, cyc) \
+    B_ABS_##mode( \
+        direct_##code: \
+            B_STEP(op, mode, EA_##mode, RD_RAM(ea), ST_##mode, bytes) \
+            goto *u->label;, \
+    )
+
+#if FUSION_STATS
+#define B_FIRED(name) c->blocks->fired[FUSE_##name]++;
+#else
+#define B_FIRED(name)
+#endif
+
+// A step that dropped the running block leaves before the next one
+#define B_CHECK if (__builtin_expect(u->label == &&uop_exit, 0)) goto uop_exit;
+
+#define B_FUSED_LABEL2(name, c1, o1, m1, b1, c2, o2, m2, b2) [FUSE_##name] = &&fuse_##name,
+#define B_FUSED_LABEL3(name, c1, o1, m1, b1, c2, o2, m2, b2, c3, o3, m3, b3) [FUSE_##name] = &&fuse_##name,
+
+#define B_FUSED2(name, c1, o1, m1, b1, c2, o2, m2, b2) \
+    fuse_##name: \
+        B_FIRED(name) \
+        B_STEP(o1, m1, EA_##m1, LD_##m1, ST_##m1, b1) B_CHECK \
+        B_STEP(o2, m2, EA_##m2, LD_##m2, ST_##m2, b2) \
+        goto *u->label;
+
+#define B_FUSED3(name, c1, o1, m1, b1, c2, o2, m2, b2, c3, o3, m3, b3) \
+    fuse_##name: \
+        B_FIRED(name) \
+        B_STEP(o1, m1, EA_##m1, LD_##m1, ST_##m1, b1) B_CHECK \
+        B_STEP(o2, m2, EA_##m2, LD_##m2, ST_##m2, b2) B_CHECK \
+        B_STEP(o3, m3, EA_##m3, LD_##m3, ST_##m3, b3) \
+        goto *u->label;
+
+static inline uint64_t run_blocks(cpu *c, uint64_t budget) {
+    // Same contract as run_table(), with the budget checked once per block
+    static void *const labels[256] = {
+        [0 ... 0xFF] = &&uop_nul,
+        OPCODES(B_LABEL)
+    };
+    static void *const direct[256] = { OPCODES(B_DIRECT_LABEL) };
+    #if FUSION
+    static void *const fused[FUSION_COUNT] = { FUSIONS(B_FUSED_LABEL2, B_FUSED_LABEL3) };
+    #endif
+    atomic_store_explicit(&block_exit, &&uop_exit, memory_order_relaxed);
+
+    uint8_t *const ram = c->ram;
+    block **const block_at = c->blocks->at;
+    const uint16_t *const code_pages = c->blocks->code_pages;
+    uint8_t l_ac = c->ac, l_xr = c->xr, l_yr = c->yr, l_sp = c->sp, l_sr;
+    #if LAZY_FLAGS
+    uint8_t l_fn, l_fz;
+    #endif
+    uint16_t l_pc = c->pc;
+    // c->clock is only brought up to date for the ROM translation and native code
+    const uint64_t start = c->clock;
+    uint64_t cycles = 0;
+    uint64_t n = 0;
+    bool stop = false;
+    block *b;
+    uop *u;
+    #if IDLE_SKIP
+    block *idle_b = NULL;   // last idle block that branched back to itself
+    uint64_t idle_n = 0, idle_cycles = 0, idle_regs = 0;
+    #endif
+    PUT_SR(c->sr);
+
+enter:
+    #if STATIC_ROM
+    if (rom_at(c, PC) != NULL) {
+        SAMPLE_AT(c, SAMPLE_ROM, PC);
+        c->ac = AC; c->xr = XR; c->yr = YR; c->sp = SP; c->sr = GET_SR(); c->pc = PC;
+        c->clock = start + cycles;
+        cycles += rom_run(c, budget - cycles);
+        AC = c->ac; XR = c->xr; YR = c->yr; SP = c->sp; PUT_SR(c->sr);
+        PC = c->pc;
+        if (__builtin_expect(((cycles >= budget) | PENDING(c)) != 0, 0))
+            goto slow;
+        goto enter;
+    }
+    #endif
+    b = block_at[PC];
+    if (__builtin_expect(b == NULL, 0)) {
+        b = block_decode(c, PC, labels, direct, &&uop_end);
+        #if FUSION
+        block_fuse(b, fused);
+        #endif
+    }
+    #if ENGINE == ENGINE_JIT
+    if (b->native != NULL || (++b->hits == JIT_THRESHOLD && !b->idle && jit_compile(c, b))) {
+        SAMPLE_AT(c, SAMPLE_NATIVE, PC);
+        jit_state st = {AC, XR, YR, SP, GET_SR(), PC, budget - cycles, 0};
+        c->clock = start + cycles;
+        cycles += c->jit->enter(&st, b->native);
+        n += st.count;
+        AC = st.ac; XR = st.xr; YR = st.yr; SP = st.sp; PUT_SR(st.sr);
+        PC = st.pc;
+        if (__builtin_expect(((cycles >= budget) | PENDING(c)) != 0, 0))
+            goto slow;
+        goto enter;
+    }
+    #endif
+    SAMPLE_AT(c, SAMPLE_BLOCK, PC);
+    u = b->uops;
+    goto *u->label;
+
+    OPCODES(B_BODY)
+    OPCODES(B_DIRECT)
+
+    #if FUSION
+    FUSIONS(B_FUSED2, B_FUSED3)
+    #endif
+
+uop_nul:
+    {
+        PC += 1;
+        u++;
+        goto *u->label;
+    }
+
+uop_end:
+    cycles += b->cycles;
+    n += b->count;
+    #if IDLE_SKIP
+    if (__builtin_expect(b->idle, 0) && PC == b->start) {
+        /*  Two passes in a row that leave the registers unchanged: nothing
+            but an interrupt or the end of the budget can end the loop, so
+            jump straight to the first block end at or past the budget, as
+            if every pass had run.  */
+        uint64_t regs = AC | (XR << 8) | (YR << 16) | ((uint64_t)SP << 24) | ((uint64_t)GET_SR() << 32);
+        if (idle_b == b && n - idle_n == b->count && regs == idle_regs && PENDING(c) == 0 && cycles < budget) {
+            uint64_t pass = cycles - idle_cycles;
+            uint64_t skip = (budget - cycles + pass - 1) / pass;
+            cycles += skip * pass;
+            n += skip * b->count;
+        }
+        idle_b = b;
+        idle_n = n;
+        idle_cycles = cycles;
+        idle_regs = regs;
+    }
+    #endif
+    if (__builtin_expect(((cycles >= budget) | stop | PENDING(c)) != 0, 0))
+        goto slow;
+    goto enter;
+
+uop_exit:
+    // The running block was overwritten: account for the part that ran
+    for (uop *p = b->uops; p < u; p++)
+        cycles += p->cycles;
+    n += u - b->uops;
+
+slow:
+    {
+        const uint16_t at = 0;  // cycles covers the whole block by now
+        uint32_t pending = PENDING(c);
+        TAKE_INTERRUPT(pending)
+        if (!stop && cycles < budget && !(pending & PEND_EXIT))
+            goto enter;
+    }
+
+    c->halted = stop;
+    c->ac = l_ac; c->xr = l_xr; c->yr = l_yr; c->sp = l_sp; c->sr = GET_SR();
+    c->pc = l_pc;
+    c->executed += n;
+    c->clock = start + cycles;
+    return cycles;
+}
+
+#undef AC
+#undef XR
+#undef YR
+#undef SP
+#undef SR
+#undef PC
+#undef RD
+#undef WR
+#undef RD_RAM
+#undef WR_RAM
+#undef OPB
+#undef OPW
+#undef CYC
+#undef HALT
+#undef FN
+#undef FZ
+#undef B_LABEL
+#undef B_STEP
+#undef B_BODY
+#undef B_ABS_AB_
+#undef B_ABS_ABX
+#undef B_ABS_ABY
+#undef B_ABS_IMP
+#undef B_ABS_ACC
+#undef B_ABS_IMM
+#undef B_ABS_REL
+#undef B_ABS_ZP_
+#undef B_ABS_ZPX
+#undef B_ABS_ZPY
+#undef B_ABS_IN_
+#undef B_ABS_INX
+#undef B_ABS_INY
+#undef B_DIRECT_LABEL
+#undef B_DIRECT
+#undef B_FIRED
+#undef B_CHECK
+#undef B_FUSED_LABEL2
+#undef B_FUSED_LABEL3
+#undef B_FUSED2
+#undef B_FUSED3
+
+#endif
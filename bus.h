@@ -0,0 +1,121 @@
+#ifndef BUS_H
+#define BUS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/*  Memory bus: a page table with one read and one write entry for each of
+    the 256 pages.
+
+    An entry is either a host pointer, indexed with the full 16-bit address
+    (rd[addr >> 8][addr]), or NULL for a page that needs more than a plain
+    access. A RAM access is one table load, one test that is always
+    predicted right and the access itself.
+
+    Reads that find NULL go to the device handlers of the page. Writes that
+    find NULL go to bus_write_slow(), which tells two cases apart with the
+    mapped entry (mem_wr): a device page (or ROM, a device without a write
+    handler, so the write is dropped), or memory the engine watches with
+    bus_watch(). The block engines watch the pages holding decoded code,
+    so the same test that guards the devices also catches self modifying
+    code.
+
+    The pointers all point at the ram[] of the cpu that owns the bus. The
+    engines rely on it: they fetch instructions and decode blocks from ram[]
+    directly, and zero page and stack accesses (RD_RAM and WR_RAM in
+    opcodes.h) skip the table. That is why pages 0 and 1 can only be RAM.
+    A device page keeps its bytes in ram[] too, as a shadow that nothing
+    reads; running code from it is not supported.
+
+    Device handlers get the emulated time of the access, in cycles of the
+    cpu clock (c->clock), so that a device can work out its state when it
+    is asked rather than follow every cycle. Every engine passes the same
+    time: the cycle the instruction started at, plus the page crossing
+    cycle when its operand took one. The block engines work it out from
+    the block start and the base cycles of the instructions before it in
+    the block (uop.at, jit_op.at). An interrupt passes the cycle it
+    started at.  */
+
+typedef uint8_t (*bus_reader)(void *ctx, uint16_t addr, uint64_t now);
+typedef void (*bus_writer)(void *ctx, uint16_t addr, uint8_t v, uint64_t now);
+
+typedef struct bus_device {
+    bus_reader read;        // NULL reads $FF
+    bus_writer write;       // NULL drops the write
+    void *ctx;
+} bus_device;
+
+typedef struct bus {
+    uint8_t *rd[256];       // host memory of each page for reads, NULL for the device
+    uint8_t *wr[256];       // same for writes, also NULL while the page is watched
+    uint8_t *mem_wr[256];   // host memory mapped for writes, whether watched or not
+    bus_device io[256];
+    uint16_t read_devices;  // pages whose reads go to a device
+} bus;
+
+static inline void bus_init(bus *b, uint8_t *ram) {
+    // Every page RAM
+    for (int p = 0; p < 256; p++) {
+        b->rd[p] = b->wr[p] = b->mem_wr[p] = ram;
+        b->io[p] = (bus_device){NULL, NULL, NULL};
+    }
+    b->read_devices = 0;
+}
+
+static inline bool bus_map(bus *b, uint8_t first, uint8_t last, uint8_t *rd, uint8_t *wr, bus_device io) {
+    // Pages first to last get these entries, false (and no change) if that would touch pages 0 and 1
+    if (first > last || (first < 2 && (rd == NULL || wr == NULL)))
+        return false;
+    for (int p = first; p <= last; p++) {
+        b->read_devices += (rd == NULL) - (b->rd[p] == NULL);
+        b->rd[p] = rd;
+        b->wr[p] = b->mem_wr[p] = wr;
+        b->io[p] = io;
+    }
+    return true;
+}
+
+static inline void bus_watch(bus *b, uint8_t page, bool watch) {
+    // Sends the writes to a memory page through bus_write_slow(), or stops doing so
+    b->wr[page] = watch ? NULL : b->mem_wr[page];
+}
+
+__attribute__((noinline))
+static uint8_t bus_read_io(const bus *b, uint16_t addr, uint64_t now) {
+    const bus_device *d = &b->io[addr >> 8];
+    return d->read != NULL ? d->read(d->ctx, addr, now) : 0xFF;
+}
+
+__attribute__((noinline))
+static bool bus_write_slow(const bus *b, uint16_t addr, uint8_t v, uint64_t now) {
+    // True when the byte went to a watched page, whose watcher has to know
+    uint8_t *p = b->mem_wr[addr >> 8];
+    if (p != NULL) {
+        p[addr] = v;
+        return true;
+    }
+    const bus_device *d = &b->io[addr >> 8];
+    if (d->write != NULL)
+        d->write(d->ctx, addr, v, now);
+    return false;
+}
+
+static inline uint8_t bus_read(const bus *b, uint16_t addr, uint64_t now) {
+    uint8_t *p = b->rd[addr >> 8];
+    if (__builtin_expect(p != NULL, 1))
+        return p[addr];
+    return bus_read_io(b, addr, now);
+}
+
+static inline bool bus_write(const bus *b, uint16_t addr, uint8_t v, uint64_t now) {
+    // Same result as bus_write_slow()
+    uint8_t *p = b->wr[addr >> 8];
+    if (__builtin_expect(p != NULL, 1)) {
+        p[addr] = v;
+        return false;
+    }
+    return bus_write_slow(b, addr, v, now);
+}
+
+#endif
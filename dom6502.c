@@ -1,45 +1,321 @@
+#define _GNU_SOURCE
 #include <stdio.h>
 #include <stdlib.h>
 #include <sched.h>
+#include <signal.h>
+#include <unistd.h>
 #include "dom6502.h"
+#include "farm.h"
+#include "via.h"
+#if SAMPLING
+#include "sample.h"
+#endif
+
+#ifndef BENCHMARK
+#define BENCHMARK 0   // if set, run this many cycles unpaced and report the speed
+#endif
+#define FARM_BENCH_CYCLES 20000000  // cycles of each ROM boot in the -f benchmark
 
 uint16_t start_program = 0xC000;
+volatile sig_atomic_t stop_requested = 0;
+bool warp = false;      // -w, or -c 0
+cpu *running = NULL;
+
+void request_stop(int sig) {
+    // cpu_stop() is a lock-free or, so the run in progress ends right away
+    stop_requested = 1;
+    if (running != NULL)
+        cpu_stop(running);
+}
+
+/*  The drive around the cpu: VIA 1 (serial bus) at $1800-$1BFF and VIA 2
+    (disk controller) at $1C00-$1FFF, both on IRQ. Nothing is connected to
+    the ports yet, their pins read as an idle bus and an empty drive.  */
+
+typedef struct drive {
+    cpu *c;
+    via via1, via2;
+} drive;
+
+void drive_irq(void *ctx, bool active) {
+    // Wired-OR of the two IRQ outputs
+    drive *d = ctx;
+    cpu_irq(d->c, d->via1.irq_out || d->via2.irq_out);
+}
+
+void drive_init(drive *d, cpu *c) {
+    d->c = c;
+    via_init(&d->via1, drive_irq, d, &c->events);
+    via_init(&d->via2, drive_irq, d, &c->events);
+    d->via1.pb = 0x00;      // lines released, no ATN, device 8
+    d->via2.pb = 0x90;      // no SYNC, not write protected
+    cpu_map_io(c, 0x18, 0x1B, via_bus_read, via_bus_write, &d->via1);
+    cpu_map_io(c, 0x1C, 0x1F, via_bus_read, via_bus_write, &d->via2);
+}
+
+void farm_bench(const uint8_t *rom, size_t size, int jobs, int threads) {
+    /*  Boots the ROM `jobs` times on 1, 2, ... `threads` workers and reports
+        the aggregate speed and the scaling efficiency against one worker.  */
+    farm_job *batch = calloc(jobs, sizeof(farm_job));
+    double base = 0;
+    timebase_init();
+    printf("threads  seconds  M instructions/s  speedup  efficiency  steals\n");
+    for (int t = 1; t <= threads; t++) {
+        for (int i = 0; i < jobs; i++)
+            batch[i] = (farm_job){.image = rom, .size = size, .addr = start_program, .start = -1, .max_cycles = FARM_BENCH_CYCLES};
+        farm *f = farm_create(t);
+        if (f == NULL) {
+            fprintf(stderr, "farm: no worker thread could be started\n");
+            break;
+        }
+        uint64_t start = get_nanosec();
+        bool ran = farm_run(f, batch, jobs);
+        double seconds = (get_nanosec() - start) / 1e9;
+        uint64_t steals = 0;
+        int unpinned = 0;
+        for (int i = 0; i < f->threads; i++) {
+            steals += f->workers[i].steals;
+            unpinned += !f->workers[i].pinned;
+        }
+        farm_destroy(f);
+        if (!ran)
+            fprintf(stderr, "farm: some jobs could not get a cpu\n");
+        if (unpinned > 0)
+            fprintf(stderr, "farm: %d of %d workers could not be pinned to a core\n", unpinned, t);
+
+        uint64_t instructions = 0;
+        for (int i = 0; i < jobs; i++)
+            instructions += batch[i].executed;
+        double speed = instructions / seconds / 1e6;
+        if (t == 1)
+            base = speed;
+        printf("%7d  %7.3f  %16.2f  %7.2f  %9.1f%%  %6llu\n",
+            t, seconds, speed, speed / base, 100 * speed / base / t, (unsigned long long)steals);
+    }
+    free(batch);
+}
+
+void count_report(cpu *c) {
+    // Opcodes by executions, most run first
+    int order[256];
+    uint64_t total = 0;
+    for (int i = 0; i < 256; i++) {
+        order[i] = i;
+        total += c->instr.counts[i];
+    }
+    for (int i = 1; i < 256; i++)
+        for (int k = i; k > 0 && c->instr.counts[order[k]] > c->instr.counts[order[k - 1]]; k--) {
+            int swap = order[k];
+            order[k] = order[k - 1];
+            order[k - 1] = swap;
+        }
+    for (int i = 0; i < 256 && c->instr.counts[order[i]] > 0; i++) {
+        fprintf(
+            stderr, "%02X %s %12llu %5.1f%%\n", order[i], instructions[order[i]].name,
+            (unsigned long long)c->instr.counts[order[i]], 100.0 * c->instr.counts[order[i]] / total
+        );
+    }
+}
+
+int main(int argc, char **argv) {
+    /*  -c MHz   emulated clock, e.g. 0.985248 for PAL, 0 runs in warp mode
+        -w       warp mode: no pacing, throughput reported on exit
+        -r s     in warp mode, also report every s seconds
+        -f jobs  farm benchmark: boot the ROM `jobs` times in parallel
+        -t n     farm benchmark on up to n threads, default one per core
+        -T file  binary instruction trace to file, see trace2txt.c
+        -n       count the executions of each opcode, printed on exit
+        -p file  exact profile: report on exit, folded call stacks to file
+        -s hz    sampling profile at hz samples per CPU second, report on
+                 exit; needs a build with SAMPLING=1  */
+    double report = 0;
+    int farm_jobs = 0, farm_threads = sysconf(_SC_NPROCESSORS_ONLN);
+    const char *trace_path = NULL;
+    bool count_opcodes = false;
+    const char *profile_path = NULL;
+    int sample_hz = 0;
+    int opt;
+    while ((opt = getopt(argc, argv, "c:wr:f:t:T:np:s:")) != -1) {
+        if (opt == 'c') {
+            double mhz = strtod(optarg, NULL);
+            pace_set_clock(mhz * 1e6);
+            warp = warp || mhz <= 0;
+        }
+        else if (opt == 'w') {
+            warp = true;
+        }
+        else if (opt == 'r') {
+            report = strtod(optarg, NULL);
+        }
+        else if (opt == 'f') {
+            farm_jobs = atoi(optarg);
+        }
+        else if (opt == 't') {
+            farm_threads = atoi(optarg);
+        }
+        else if (opt == 'T') {
+            trace_path = optarg;
+        }
+        else if (opt == 'n') {
+            count_opcodes = true;
+        }
+        else if (opt == 'p') {
+            profile_path = optarg;
+        }
+        else if (opt == 's') {
+            sample_hz = atoi(optarg);
+        }
+        else {
+            fprintf(stderr, "usage: %s [-c MHz] [-w] [-r seconds] [-f jobs [-t threads]] [-T trace] [-n] [-p stacks] [-s hz]\n", argv[0]);
+            return 1;
+        }
+    }
+    signal(SIGINT, request_stop);
+    signal(SIGTERM, request_stop);
+
+    if (!warp && farm_jobs == 0) {
+        // Only the paced loop needs to be woken up on time
+        struct sched_param _sched_param;
+        _sched_param.sched_priority = 99;
+        sched_setscheduler(0, SCHED_FIFO, &_sched_param);
+    }
 
-int main() {
-    struct sched_param _sched_param;
-    _sched_param.sched_priority = 99;
-    sched_setscheduler(0, SCHED_FIFO, &_sched_param);
+    cpu *c = cpu_create();
+    if (c == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    if (sample_hz > 0) {
+        #if SAMPLING
+        if (!sample_start(sample_hz)) {
+            perror("sampling");
+            return 1;
+        }
+        #else
+        fprintf(stderr, "-s needs a build with SAMPLING=1\n");
+        return 1;
+        #endif
+    }
 
     FILE* fptr = fopen("1541rom.bin", "rb");
     fseek(fptr, 0L, SEEK_END);
     int filesize = ftell(fptr);
     rewind(fptr);
 
-    fread(ram + start_program, filesize, 1, fptr);
+    uint8_t *rom = malloc(filesize);
+    fread(rom, filesize, 1, fptr);
     fclose(fptr);
+    if (farm_jobs > 0) {
+        farm_bench(rom, filesize, farm_jobs, farm_threads);
+        #if SAMPLING
+        if (sample_hz > 0) {
+            sample_stop();
+            sample_report(stderr, NULL, "1541_disassembly.asm", 20);
+        }
+        #endif
+        free(rom);
+        cpu_destroy(c);
+        return 0;
+    }
+    cpu_load(c, start_program, rom, filesize);
+    cpu_map_rom(c, start_program >> 8, 0xFF);
+    free(rom);
+    drive d;
+    drive_init(&d, c);
+    cpu_reset(c);
+    running = c;
+    uint32_t instr = atomic_load(&c->instr.flags);
+    if ((instr & INSTR_TRACE) && !isatty(STDOUT_FILENO)) {
+        // The text trace into a file or pipe: a line at a time is too slow
+        static char out[1 << 20];
+        setvbuf(stdout, out, _IOFBF, sizeof(out));
+    }
+    trace *t = NULL;
+    if (trace_path != NULL) {
+        t = trace_open(trace_path);
+        if (t == NULL) {
+            perror(trace_path);
+            return 1;
+        }
+        cpu_trace(c, t);
+        instr |= INSTR_TRACE;
+    }
+    if (count_opcodes)
+        instr |= INSTR_COUNT;
+    profile *prof = NULL;
+    if (profile_path != NULL) {
+        prof = profile_create(c->pc);
+        if (prof == NULL) {
+            fprintf(stderr, "out of memory\n");
+            return 1;
+        }
+        profile_labels(prof, "1541_disassembly.asm");
+        cpu_profile(c, prof);
+        instr |= INSTR_PROFILE;
+    }
+    cpu_instrument(c, instr);
 
-    pc = (ram[0xFFFD] << 8) | ram[0xFFFC];
-
-    uint8_t *b;
-    do {
-        suseconds_t a = get_microsec();
-        
-        b = ram + pc;
-        instruction i = instructions[*b];
-        void (*func)() = i.operation;
-        func(i.bytes, &i.cycles, i.mode);
-
-        microsleep((i.cycles / SPEED) - (get_microsec() - a));
+    #if BENCHMARK
+    timebase_init();
+    uint64_t start = get_nanosec();
+    uint64_t cycles = cpu_run_cycles(c, BENCHMARK);
+    double seconds = (get_nanosec() - start) / 1e9;
+    printf(
+        "%llu instructions, %llu cycles in %.3f s: %.2f M instructions/s\n",
+        (unsigned long long)c->executed, (unsigned long long)cycles,
+        seconds, c->executed / seconds / 1e6
+    );
+    #else
+    if (warp) {
+        meter m;
+        uint64_t cycles = 0;
+        meter_start(&m, report * 1e9, cycles, c->executed);
+        do {
+            cycles += cpu_run_cycles(c, WARP_QUANTUM);
+            meter_tick(&m, cycles, c->executed);
+        } while (!c->halted && !stop_requested);
+        meter_end(&m, cycles, c->executed);
+    }
+    else {
+        pacer p;
+        pace_start(&p);
+        do {
+            pace(&p, cpu_run_cycles(c, PACE_QUANTUM));
+        } while (!c->halted && !stop_requested);
+    }
+    #endif
 
-        if (irq && ((sr & S_INT_DIS) == 0)) {
-            irq = false;
-            ram[0x0100 + sp--] = pc >> 8;
-            ram[0x0100 + sp--] = pc & 0x00FF;
-            ram[0x0100 + sp--] = sr;
-            pc = (ram[0xFFFF] << 8) | ram[0xFFFE];
+    #if FUSION_STATS
+    fusion_report(c);
+    #endif
+    int trace_error;
+    uint64_t stalls = trace_close(t, &trace_error);
+    if (stalls > 0)
+        fprintf(stderr, "trace: the writer fell behind %llu times\n", (unsigned long long)stalls);
+    if (trace_error != 0)
+        fprintf(stderr, "trace: %s, %s is cut short\n", strerror(trace_error), trace_path);
+    if (count_opcodes)
+        count_report(c);
+    if (prof != NULL) {
+        profile_report(prof, stderr, 30);
+        FILE *stacks = fopen(profile_path, "w");
+        if (stacks != NULL) {
+            profile_folded(prof, stacks);
+            fclose(stacks);
+        }
+        else {
+            perror(profile_path);
         }
-    } while (*b != 0);
+        profile_destroy(prof);
+    }
+    #if SAMPLING
+    if (sample_hz > 0) {
+        sample_stop();
+        sample_report(stderr, c, "1541_disassembly.asm", 20);
+    }
+    #endif
 
+    cpu_destroy(c);
     return 0;
 }
 
@@ -1,27 +1,163 @@
 #ifndef DOM6502_H
 #define DOM6502_H
 
-#define DEBUG 1
-#define SPEED 1   // Mhz
+#ifndef DEBUG
+#define DEBUG 1             // trace every instruction from power on, see cpu_instrument()
+#endif
+#ifndef CLOCK_HZ
+#define CLOCK_HZ 1000000    // emulated clock rate at startup, see pace_set_clock()
+#endif
+
+#define ENGINE_TABLE    0   // instructions[] function pointer dispatch
+#define ENGINE_THREADED 1   // computed goto interpreter, registers in locals (threaded.h)
+#define ENGINE_BLOCKS   2   // pre-decoded basic block cache (blocks.h)
+#define ENGINE_JIT      3   // block cache plus x86-64 translation of hot blocks (jit.h)
+#ifndef ENGINE
+#define ENGINE ENGINE_TABLE
+#endif
+
+#ifndef LAZY_FLAGS
+#define LAZY_FLAGS 0        // compute N and Z only when the status register is read
+#endif
+#ifndef ALU_TABLES
+#define ALU_TABLES 0        // ADC/SBC through precomputed result tables
+#endif
+#ifndef STATIC_ROM
+#define STATIC_ROM 0        // run the ROM from its ahead-of-time translation (aot.h, rom2c.c)
+#endif
+#if STATIC_ROM && ENGINE != ENGINE_BLOCKS && ENGINE != ENGINE_JIT
+#error "STATIC_ROM needs ENGINE_BLOCKS or ENGINE_JIT"
+#endif
+#ifndef FUSION
+#define FUSION 0            // run common instruction sequences as one micro-op (blocks.h)
+#endif
+#ifndef FUSION_STATS
+#define FUSION_STATS 0      // count the fused micro-ops run, see fusion_report()
+#endif
+#if FUSION && ENGINE != ENGINE_BLOCKS && ENGINE != ENGINE_JIT
+#error "FUSION needs ENGINE_BLOCKS or ENGINE_JIT"
+#endif
+#ifndef IDLE_SKIP
+#define IDLE_SKIP 0         // fast-forward loops that wait without side effects (blocks.h)
+#endif
+#if IDLE_SKIP && ENGINE != ENGINE_BLOCKS && ENGINE != ENGINE_JIT
+#error "IDLE_SKIP needs ENGINE_BLOCKS or ENGINE_JIT"
+#endif
+#ifndef SAMPLING
+#define SAMPLING 0          // the engines publish what they run for the sampling profiler (sample.h)
+#endif
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdlib.h>
 #include <string.h>
+#include <stdatomic.h>
 #include "timing.h"
-#if DEBUG
+#include "bus.h"
+#include "events.h"
+#include "trace.h"
+#include "profile.h"
+#include <stdio.h>
 #include <ctype.h>
-#endif
-
-bool irq = false;
 
-uint8_t ram[65536];
-
-uint16_t pc = 0;
-uint8_t sp = 0xFF;
-uint8_t ac;
-uint8_t xr;
-uint8_t yr;
-uint8_t sr = 0x32;
+/*  Everything one emulated 6502 owns lives in a cpu context, so a process
+    can run as many of them as it likes: every handler, addressing routine
+    and engine gets the context as its first argument (one register), and
+    the engines that keep the registers in locals also keep a pointer to
+    ram[] in one. See cpu_create() and the functions after it for the
+    library API. Memory is reached through the page table in c->bus, see
+    bus.h and cpu_map_ram(); devices keep time with the events in
+    c->events, see events.h and cpu_run_cycles().  */
+
+/*  Instrumentation switched on and off at run time, see cpu_instrument():
+    what the instrumented engine does besides running the program.  */
+#define INSTR_TRACE 0x01    // every instruction to the trace, as text or to cpu_trace()
+#define INSTR_COUNT 0x02    // executions of each opcode in counts[]
+#define INSTR_HOOKS 0x04    // every memory access of the program to the hook
+#define INSTR_PROFILE 0x08  // every instruction and interrupt to cpu_profile()
+
+typedef struct instrument {
+    _Atomic uint32_t flags;     // INSTR_*, 0 runs the plain engine
+    bool ran;                   // the instrumented engine ran since the plain one last did
+    uint64_t counts[256];
+    void (*hook)(void *ctx, uint16_t addr, uint8_t v, bool write);
+    void *hook_ctx;
+} instrument;
+
+typedef struct cpu {
+    uint16_t pc;
+    uint8_t sp;
+    uint8_t ac;
+    uint8_t xr;
+    uint8_t yr;
+    uint8_t sr;
+    #if LAZY_FLAGS
+    uint8_t lazy_n;     // N comes from bit 7
+    uint8_t lazy_z;     // Z is set when zero
+    #endif
+    _Atomic uint32_t pending;   // PEND_* conditions, tested by the engines as one word
+    bool halted;        // set by BRK, which ends the emulation
+    uint64_t executed;  // instructions executed so far
+    uint64_t clock;     // cycles run so far, the time devices and events see
+    events events;
+    #if ENGINE == ENGINE_BLOCKS || ENGINE == ENGINE_JIT
+    struct block_cache *blocks;
+    #endif
+    #if ENGINE == ENGINE_JIT
+    struct jit *jit;
+    #endif
+    #if STATIC_ROM
+    bool rom_intact;    // ram[] holds rom_image
+    #endif
+    instrument instr;
+    trace *trace;       // where INSTR_TRACE writes binary records, NULL prints text
+    profile *profile;   // what INSTR_PROFILE adds up, NULL for nothing
+    #if SAMPLING
+    _Atomic uint32_t where;     // handler << 16 | pc, see SAMPLE_AT()
+    #endif
+    bus bus;            // what each page of the address space is
+    uint8_t ram[65536];
+} cpu;
+
+/*  Asynchronous conditions, all in c->pending so that the engines test one
+    word per instruction or per block and only look closer when it is not
+    zero. Any thread (or a signal handler) may raise them with cpu_irq(),
+    cpu_nmi() and cpu_stop(): they are lock-free atomic ors and ands, and
+    the engines see them at their next check. Breakpoints (BRK, halted) and
+    budgets are the engine's own and stay plain compares.  */
+#define PEND_IRQ   0x01     // IRQ line held, a level: taken whenever I is clear
+#define PEND_NMI   0x02     // NMI edge, cleared when taken
+#define PEND_YIELD 0x04     // an event is due before the slice ends (events.h)
+#define PEND_STOP  0x08     // cpu_run_cycles() returns at the next check
+#define PEND_SWITCH 0x10    // instrumentation turned on or off: the engine is picked again
+#define PEND_EXIT (PEND_YIELD | PEND_STOP | PEND_SWITCH)    // the bits that end an engine run
+
+#define PENDING(c) atomic_load_explicit(&(c)->pending, memory_order_relaxed)
+
+/*  With SAMPLING the engines keep c->where up to date: the host code
+    running and the 6502 address it runs for, in one word that the SIGPROF
+    handler of sample.h reads. The threaded interpreter stores the pc of
+    each instruction and the handler takes the opcode from memory; the
+    table engines keep pc in c->pc anyway and only say so once. The block
+    engines store the pc of each block they enter. cpu_run_cycles() points
+    sample_cpu at the cpu it runs. Without SAMPLING the stores compile to
+    nothing.  */
+#define SAMPLE_OPCODE 0         // the handler of the opcode at pc, 0-0xFF once sampled
+#define SAMPLE_CPU_PC 0xFFFF    // the same at c->pc rather than in the word
+#define SAMPLE_BLOCK  0x100     // block interpreter (blocks.h), pc of the block
+#define SAMPLE_NATIVE 0x101     // translated code (jit.h), pc of the last block entered
+#define SAMPLE_ROM    0x102     // static ROM translation (aot.h), which keeps pc in c->pc
+#define SAMPLE_EVENTS 0x103     // events firing between two slices
+#define SAMPLE_OUTSIDE 0x104    // the thread was not in cpu_run_cycles()
+#define SAMPLE_HANDLERS 0x105   // handler values, 0-0xFF being the opcodes
+
+#if SAMPLING
+#define SAMPLE_AT(c, handler, pc) \
+    atomic_store_explicit(&(c)->where, ((uint32_t)(handler) << 16) | (uint16_t)(pc), memory_order_relaxed)
+static _Thread_local struct cpu *sample_cpu;   // NULL outside cpu_run_cycles()
+#else
+#define SAMPLE_AT(c, handler, pc)
+#endif
 
 #define S_CARRY    0x01
 #define S_ZERO     0x02
@@ -45,1602 +181,594 @@ uint8_t sr = 0x32;
 #define INX 12  // (Indirect, X) -> Zero Page Indexed Indirect addressing
 #define INY 13  // (Indirect), Y -> Indirect Indexed addressing
 
+// Every handler executes one instruction at pc and returns the cycles it took
+typedef uint8_t (*handler)(cpu *c);
+
 typedef struct instruction {
-    void *operation;
+    handler operation;
     uint8_t bytes;
     uint8_t cycles;
     uint8_t mode;
+    const char *name;
 } instruction;
 
-#if DEBUG
-void print_asm(const char *function_name, uint8_t mode, uint8_t bytes) {
-    char function_name_upper[4] = {0};
-    for (int i = 0; i < 3; i++) {
-        function_name_upper[i] = toupper(function_name[i]);
-    }    
-
-    printf("%04X ", pc);
-    if (bytes == 1) {
-        printf("%02X        ", ram[pc]);
-    }
-    else if (bytes == 2) {
-        printf("%02X %02X     ", ram[pc], ram[pc + 1]);
-    }
-    else if (bytes == 3) {
-        printf("%02X %02X %02X  ", ram[pc], ram[pc + 1], ram[pc + 2]);
-    }
-
-    printf("%s ", function_name_upper);
-
-    if (mode == IMM) {
-        printf("#$%02X      ", ram[pc + 1]);
+#include "opcodes.h"
+
+/*  One specialized handler per (operation, addressing mode) pair, e.g.
+    lda_IMM() or sta_ABX(), generated from OPCODES. The addressing mode is
+    resolved at compile time and the page crossing penalty is added to the
+    returned cycles.  */
+
+#define AC c->ac
+#define XR c->xr
+#define YR c->yr
+#define SP c->sp
+#define SR c->sr
+#define PC c->pc
+#define RD(addr) bus_read(&c->bus, addr, c->clock + cycles)
+#define WR(addr, v) bus_write(&c->bus, addr, v, c->clock + cycles)
+#define RD_RAM(addr) c->ram[addr]
+#define WR_RAM(addr, v) c->ram[addr] = (v)
+#define OPB() c->ram[PC + 1]
+#define OPW() ((c->ram[PC + 2] << 8) | c->ram[PC + 1])
+#define CYC cycles
+#define HALT() c->halted = true
+#define FN c->lazy_n
+#define FZ c->lazy_z
+
+#define H_BODY(code, op, mode, bytes, cyc) \
+    static inline uint8_t op##_##mode(cpu *c) { \
+        uint8_t cycles = 0; \
+        EA_##mode \
+        PC += bytes; \
+        OP_##op(LD_##mode, ST_##mode) \
+        return cycles + cyc; \
     }
-    else if (mode == ZP_) {
-        printf("$%02X       ", ram[pc + 1]);
-    }
-    else if (mode == ZPX) {
-        printf("$%02X,X     ", ram[pc + 1]);
-    }
-    else if (mode == ZPY) {
-        printf("$%02X,Y     ", ram[pc + 1]);
-    }
-    else if (mode == AB_) {
-        printf("$%04X     ", (ram[pc + 2] << 8) | (ram[pc + 1]));
-    }
-    else if (mode == ABX) {
-        printf("$%04X,X   ", (ram[pc + 2] << 8) | (ram[pc + 1]));
-    }
-    else if (mode == ABY) {
-        printf("$%04X,Y   ", (ram[pc + 2] << 8) | (ram[pc + 1]));
-    }
-    else if (mode == REL) {
-        printf("$%04X     ", pc + bytes + (int8_t)ram[pc + 1]);
-    }
-    else if (mode == INX) {
-        printf("($%02X,X)   ", ram[pc + 1]);
-    }
-    else if (mode == INY) {
-        printf("($%02X),Y   ", ram[pc + 1]);
-    }
-    else {
-        printf("          ");
-    }
-
-    printf(
-        "|%02X %02X %02X %02X %02X|%d%d%d%d%d%d|\n", 
-        ac, xr, yr, sp, sr,
-        ((sr & S_NEGATIVE) >> 7),
-        ((sr & S_OVERFLOW) >> 6),
-        ((sr & S_DECIMAL) >> 3),
-        ((sr & S_INT_DIS) >> 2),
-        ((sr & S_ZERO) >> 1),
-        (sr & S_CARRY)
-    );
-}
-#endif
-
-void handle_addressing(uint8_t mode, uint8_t **operand, uint8_t *cycles) {
-    if (mode == ACC) {
-        *operand = &ac;
-    }
-    else if (mode == IMM) {
-        /*  Immediate addressing:
-            the operand is contained in the second byte of the instruction.  */
-        *operand = &ram[pc + 1];
-    }
-    else if (mode == ZP_) {
-        /*  Zero Page addressing:
-            allows shorter code by only fetching the second byte of the instruction
-            and assuming a zero high address byte.  */
-        *operand = &ram[ram[pc + 1]];
-    }
-    else if (mode == ZPX) {
-        /*  Zero Page Indexed addressing, X:
-            the effective address is calculated by adding the second byte to
-            the content of the X register. The content of second byte reference
-            a location in page zero.  */
-        *operand = &ram[ram[pc + 1] + xr];
-    }
-    else if (mode == ZPY) {
-        /*  Zero Page Indexed addressing, Y:
-            the effective address is calculated by adding the second byte to
-            the contents of the Y register. The content of second byte reference
-            a location in page zero.  */
-        *operand = &ram[ram[pc + 1] + yr];
-    }
-    else if (mode == AB_) {
-        /*  Absolute addressing:
-            the second byte of the instruction specifies the eight low-order bits
-            of the effective address, while the third byte specifies the eight
-            high-order bits.  */
-        *operand = &ram[(ram[pc + 2] << 8) | (ram[pc + 1])];
-    }
-    else if (mode == ABX) {
-        /*  Absolute Indexed addressing, X:
-            the effective address is formed by adding the contents of X to the
-            address contained in the second and third bytes of the instruction.  */
-        uint16_t abs = (ram[pc + 2] << 8) | (ram[pc + 1]);
-        uint16_t abs_i = abs + xr;
-        if ((abs_i >> 8) != (abs >> 8)) (*cycles)++;
-        *operand = &ram[abs_i];
-    }
-    else if (mode == ABY) {
-        /*  Absolute Indexed addressing, Y:
-            the effective address is formed by adding the contents of X to the
-            address contained in the second and third bytes of the instruction.  */
-        uint16_t abs = (ram[pc + 2] << 8) | (ram[pc + 1]);
-        uint16_t abs_i = abs + yr;
-        if ((abs_i >> 8) != (abs >> 8)) (*cycles)++;
-        *operand = &ram[abs_i];
-    }
-    else if (mode == INX) {
-        /*  Zero Page Indexed Indirect addressing (Indirect X):
-            the second byte of the instruction is added to the contents of the X
-            register; the carry is discarded. The result of this addition points to
-            a memory location on page zero whose contents is the low-order eight bits
-            of the effective address. The next location in page zero contains the eight
-            high-order bits of the effective address. Both memory location must be in
-            page zero.  */
-        uint8_t p = ram[pc + 1] + xr;
-        *operand = &ram[(ram[p + 1] << 8) | ram[p]];
-    }
-    else if (mode == INY) {
-        /*  Indirect Indexed addressing (Indirect Y):
-            the second byte of the instruction points to a memory location in page zero.
-            The contents of this memory location are added to the contents of Y, the
-            result being the low-order eight bits of the effective address.
-            The carry from this location is added to the contents of the next page zero
-            memory location, the result being the high order eight bits of the effective
-            address.  */
-        uint8_t z = ram[pc + 1];
-        uint16_t abs = (ram[z + 1] << 8) | ram[z];
-        uint16_t abs_i = abs + yr;
-        if ((abs_i >> 8) != (abs >> 8)) (*cycles)++;
-        *operand = &ram[abs_i];
-    }
-}
-
-void handle_relative(uint8_t *cycles) {
-    /*  Relative addressing:
-        the second byte of the instruction becomes the operand which is an "Offset"
-        added to the contents of the lower eight bits of the program counter when
-        the counter is set at the next instruction. The range of the offset is
-        -128 to +127 bytes from the next instruction.  */
-    (*cycles)++;
-    uint16_t _pc = pc + (int8_t)(ram[pc - 1]);
-    if ((pc >> 8) != (_pc >> 8)) (*cycles)++;
-    pc = _pc;
-}
 
-void nul(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-    pc += 1;
+OPCODES(H_BODY)
 
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
+static inline uint8_t nul(cpu *c) {
+    // Undocumented opcodes are skipped as one byte, zero cycle instructions
+    PC += 1;
+    return 0;
 }
 
-void adc(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Add with Carry
-	// Modes: IMM, ZP_, ZPX, AB_, ABX, ABY, INX, INY
-	// INY: 6 cycles if page crossed
+#define H_ENTRY(code, op, mode, bytes, cyc) [code] = {op##_##mode, bytes, cyc, mode, #op},
 
-    uint8_t *operand = NULL;
-    handle_addressing(mode, &operand, cycles);
+static instruction instructions[256] = {
+    [0 ... 0xFF] = {nul, 0, 0, _ND, "nul"},
+    OPCODES(H_ENTRY)
+};
 
-    uint8_t ac_orig = ac;
-    uint8_t carry_orig = (sr & S_CARRY);
-    uint16_t binary_operation = ac + *operand + carry_orig;
+/*  Text trace, one line per instruction with the registers after it:
 
-    if (sr & S_DECIMAL) {
-        // It works with undocumented behaviours: http://www.6502.org/tutorials/decimal_mode.html
-        // TODO: check program in Appendix B
+        addr instr     disass        |AC XR YR SP SR|nvdizc|
+        EAA2 A2 FF     LDX #$FF      |00 FF 00 FF B4|100100|
 
-        {
-            if (((uint8_t)binary_operation) == 0)
-                sr |= S_ZERO;
-            else sr &= ~S_ZERO;
+    Put together from precomputed pieces rather than printf: every opcode
+    has its bytes column and disassembly as a template built once from
+    instructions[], and asm_format() copies it and writes only the hex
+    digits that change, from a table, as it does the flags column.  */
 
-            uint8_t t = (ac & 0x0F) + (*operand & 0x0F) + carry_orig;
-            if (t >= 0x0A)
-                t = ((t + 0x06) & 0x0F) + 0x10;
-            uint16_t _ac = (ac & 0xF0) + (*operand & 0xF0) + t;
+#define ASM_LINE_MAX 64     // longest line asm_format() writes, newline included
 
-            if (_ac >= 0xA0)
-                _ac += 0x60;
-            ac = (uint8_t)_ac;
+typedef struct asm_template {
+    char text[32];          // bytes column and disassembly, with room for the digits
+    uint8_t length;
+    uint8_t bytes;
+    uint8_t mode;
+    uint8_t operand_at;     // where the operand digits go in text, 0 for none
+} asm_template;
+
+static asm_template asm_templates[256];
+static char asm_hex[256][2];
+static char asm_flags[256][6];     // nvdizc of a status byte
+static pthread_once_t asm_once = PTHREAD_ONCE_INIT;
+
+static inline void asm_init(void) {
+    static const char *const bytes_column[4] = {"", "..        ", ".. ..     ", ".. .. ..  "};
+    static const char *const operand_column[14] = {
+        [_ND] = "          ", [ACC] = "          ", [IMP] = "          ",
+        [IMM] = "#$..      ", [ZP_] = "$..       ", [ZPX] = "$..,X     ",
+        [ZPY] = "$..,Y     ", [AB_] = "$....     ", [ABX] = "$....,X   ",
+        [ABY] = "$....,Y   ", [REL] = "$....     ", [IN_] = "          ",
+        [INX] = "($..,X)   ", [INY] = "($..),Y   "
+    };
+    for (int i = 0; i < 256; i++) {
+        asm_hex[i][0] = "0123456789ABCDEF"[i >> 4];
+        asm_hex[i][1] = "0123456789ABCDEF"[i & 0x0F];
+        for (int k = 0; k < 6; k++)
+            asm_flags[i][k] = '0' + ((i >> "\7\6\3\2\1\0"[k]) & 1);
+
+        instruction in = instructions[i];
+        asm_template *t = &asm_templates[i];
+        int n = sprintf(t->text, "%s%c%c%c ", bytes_column[in.bytes],
+            toupper(in.name[0]), toupper(in.name[1]), toupper(in.name[2]));
+        const char *operand = operand_column[in.mode];
+        t->operand_at = strchr(operand, '.') != NULL ? n + (strchr(operand, '.') - operand) : 0;
+        t->length = n + sprintf(t->text + n, "%s", operand);
+        t->bytes = in.bytes;
+        t->mode = in.mode;
+    }
+}
 
-            if (_ac >= 0x100)
-                sr |= S_CARRY;
-            else sr &= ~S_CARRY;   
+static inline void asm_hex2(char *p, uint8_t v) {
+    memcpy(p, asm_hex[v], 2);
+}
+
+static inline size_t asm_format(char *out, const trace_record *r) {
+    // Writes the line of r into out, ASM_LINE_MAX bytes at most; returns its length
+    pthread_once(&asm_once, asm_init);
+    const asm_template *t = &asm_templates[r->opcode];
+    const uint8_t *op = r->operand;
+    char *p = out;
+    asm_hex2(p, r->pc >> 8);
+    asm_hex2(p + 2, r->pc);
+    p[4] = ' ';
+    p += 5;
+    memcpy(p, t->text, sizeof(t->text));
+    if (t->bytes >= 1)
+        asm_hex2(p, r->opcode);
+    if (t->bytes >= 2)
+        asm_hex2(p + 3, op[0]);
+    if (t->bytes >= 3)
+        asm_hex2(p + 6, op[1]);
+    if (t->operand_at != 0) {
+        char *o = p + t->operand_at;
+        if (t->mode == AB_ || t->mode == ABX || t->mode == ABY) {
+            asm_hex2(o, op[1]);
+            asm_hex2(o + 2, op[0]);
         }
-        {
-            uint8_t _ac = ac_orig;
-            int8_t t = (_ac & 0x0F) + (*operand & 0x0F) + carry_orig;
-            if (t >= 0x0A)
-                t = ((t + 0x06) & 0x0F) + 0x10;
-            _ac = (_ac & 0xF0) + (*operand & 0xF0) + t;
-
-            if (_ac & 0x80)
-                sr |= S_NEGATIVE;
-            else sr &= ~S_NEGATIVE;
-
-            if ((_ac < -128) | (_ac > 127))
-                sr |= S_OVERFLOW;
-            else sr &= ~S_OVERFLOW;
+        else if (t->mode == REL) {
+            int target = r->pc + t->bytes + (int8_t)op[0];
+            if (target >= 0 && target <= 0xFFFF) {
+                asm_hex2(o, target >> 8);
+                asm_hex2(o + 2, target);
+            }
+            else {
+                // Past either end: as printf("%04X") shows it, the line gets longer
+                p += sprintf(o - 1, "$%04X     ", target) - 10;
+            }
+        }
+        else {
+            asm_hex2(o, op[0]);
         }
     }
-    else {
-        ac = (uint8_t)binary_operation;
-
-        /*  positive + positive = negative OR 
-            negative + negative = positive  */
-        bool overflow = (
-            (ac_orig >> 7) &&
-            (*operand >> 7) &&
-            ((ac >> 7) == 0)
-        ) ||
-        (
-            ((ac_orig >> 7) == 0) &&
-            ((*operand >> 7) == 0) &&
-            (ac >> 7)
-        );
-
-        if (overflow)
-            sr |= S_OVERFLOW;
-        else sr &= ~S_OVERFLOW;
-
-        if (ac >> 7)
-            sr |= S_NEGATIVE;
-        else sr &= ~S_NEGATIVE;
-
-        if (ac == 0)
-            sr |= S_ZERO;
-        else sr &= ~S_ZERO;
-
-        if (binary_operation > 0xFF)
-            sr |= S_CARRY;
-        else sr &= ~S_CARRY;
+    p += t->length;
+    p[0] = '|';
+    asm_hex2(p + 1, r->ac);
+    p[3] = ' ';
+    asm_hex2(p + 4, r->xr);
+    p[6] = ' ';
+    asm_hex2(p + 7, r->yr);
+    p[9] = ' ';
+    asm_hex2(p + 10, r->sp);
+    p[12] = ' ';
+    asm_hex2(p + 13, r->sr);
+    p[15] = '|';
+    memcpy(p + 16, asm_flags[r->sr], 6);
+    p[22] = '|';
+    p[23] = '\n';
+    return p + 24 - out;
+}
+
+static inline void print_record(FILE *f, const trace_record *r) {
+    char line[ASM_LINE_MAX];
+    fwrite(line, 1, asm_format(line, r), f);
+}
+
+static inline void print_asm(cpu *c, uint16_t pc) {
+    // The instruction at pc as text on stdout, with the registers in c
+    const uint8_t *ram = c->ram;
+    trace_record r = {
+        0, pc, 0, ram[pc], {ram[(uint16_t)(pc + 1)], ram[(uint16_t)(pc + 2)]},
+        c->ac, c->xr, c->yr, c->sp, c->sr
+    };
+    print_record(stdout, &r);
+}
+
+static inline void trace_instruction(cpu *c, uint16_t pc, uint16_t ea, uint64_t now) {
+    // The instrumented handlers report each instruction here, with the registers already in c
+    if (c->trace == NULL) {
+        print_asm(c, pc);
+        return;
     }
+    const uint8_t *ram = c->ram;
+    trace_record r = {
+        now, pc, ea, ram[pc], {ram[(uint16_t)(pc + 1)], ram[(uint16_t)(pc + 2)]},
+        c->ac, c->xr, c->yr, c->sp, c->sr
+    };
+    trace_put(c->trace, &r);
+}
+
+/*  The operations an idle loop may run besides its branch: they read
+    memory at most, change nothing but registers and flags, and go on to
+    the next instruction. Shifts qualify on the accumulator only.  */
+enum {
+    IDLE_adc = 0, IDLE_and = 1, IDLE_asl = 0, IDLE_bcc = 0, IDLE_bcs = 0, IDLE_beq = 0, IDLE_bit = 1,
+    IDLE_bmi = 0, IDLE_bne = 0, IDLE_bpl = 0, IDLE_brk = 0, IDLE_bvc = 0, IDLE_bvs = 0, IDLE_clc = 1,
+    IDLE_cld = 1, IDLE_cli = 0, IDLE_clv = 1, IDLE_cmp = 1, IDLE_cpx = 1, IDLE_cpy = 1, IDLE_dec = 0,
+    IDLE_dex = 0, IDLE_dey = 0, IDLE_eor = 1, IDLE_inc = 0, IDLE_inx = 0, IDLE_iny = 0, IDLE_jmp = 0,
+    IDLE_jsr = 0, IDLE_lda = 1, IDLE_ldx = 1, IDLE_ldy = 1, IDLE_lsr = 0, IDLE_nop = 1, IDLE_ora = 1,
+    IDLE_pha = 0, IDLE_php = 0, IDLE_pla = 0, IDLE_plp = 0, IDLE_rol = 0, IDLE_ror = 0, IDLE_rti = 0,
+    IDLE_rts = 0, IDLE_sbc = 0, IDLE_sec = 1, IDLE_sed = 1, IDLE_sei = 0, IDLE_sta = 0, IDLE_stx = 0,
+    IDLE_sty = 0, IDLE_tax = 1, IDLE_tay = 1, IDLE_tsx = 1, IDLE_txa = 1, IDLE_txs = 0, IDLE_tya = 1
+};
 
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-    
-	pc += bytes;
-}
-
-void and(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Bitwise AND
-	// Modes: IMM, ZP_, ZPX, AB_, ABX, ABY, INX, INY
-	// INY: 6 cycles if page crossed
-
-    uint8_t *operand = NULL;
-    handle_addressing(mode, &operand, cycles);
-
-    ac &= *operand;
-
-    if (ac == 0)
-        sr |= S_ZERO;
-    else sr &= ~S_ZERO;
-
-    if (ac >> 7)
-        sr |= S_NEGATIVE;
-    else sr &= ~S_NEGATIVE;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void asl(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Arithmetic Shift Left
-	// Modes: ACC, ZP_, ZPX, AB_, ABX
-        
-    uint8_t *operand = NULL;
-    handle_addressing(mode, &operand, cycles);
-
-    if (*operand >> 7)
-        sr |= S_CARRY;
-    else sr &= ~S_CARRY;
-
-    *operand = *operand << 1;
-
-    if (*operand >> 7)
-        sr |= S_NEGATIVE;
-    else sr &= ~S_NEGATIVE;
-
-    if (*operand == 0)
-        sr |= S_ZERO;
-    else sr &= ~S_ZERO;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-    
-	pc += bytes;
-}
-
-void bcc(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Branch if Carry Clear
-	// Modes: REL
-	// REL: 3 cycles if branch taken, 4 cycles if page crossed
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-    if ((sr & S_CARRY) == 0)
-        handle_relative(cycles);
-}
-
-void bcs(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Branch if Carry Set
-	// Modes: REL
-	// REL: 3 cycles if branch taken, 4 cycles if page crossed
-	
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-    pc += bytes;
-    if (sr & S_CARRY)
-        handle_relative(cycles);
-}
-
-void beq(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Branch if Equal
-	// Modes: REL
-	// REL: 3 cycles if branch taken, 4 cycles if page crossed
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-    if (sr & S_ZERO)
-        handle_relative(cycles);
-}
-
-void bit(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Bit Test
-	// Modes: ZP_, AB_
-	
-    uint8_t *operand = NULL;
-    handle_addressing(mode, &operand, cycles);
-
-    uint8_t _ac = ac;
-    _ac &= *operand;
-
-    if (_ac == 0)
-        sr |= S_ZERO;
-    else sr &= ~S_ZERO;
-
-    if (_ac & 0x40)
-        sr |= S_OVERFLOW;
-    else sr &= ~S_OVERFLOW;
-
-    if (_ac >> 7)
-        sr |= S_NEGATIVE;
-    else sr &= ~S_NEGATIVE;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void bmi(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Branch if Minus
-	// Modes: REL
-	// REL: 3 cycles if branch taken, 4 cycles if page crossed
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-    if (sr & S_NEGATIVE)
-        handle_relative(cycles);
-}
-
-void bne(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Branch if Not Equal
-	// Modes: REL
-	// REL: 3 cycles if branch taken, 4 cycles if page crossed
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-    if ((sr & S_ZERO) == 0)
-        handle_relative(cycles);
-}
-
-void bpl(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Branch if Plus
-	// Modes: REL
-	// REL: 3 cycles if branch taken, 4 cycles if page crossed
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-    if ((sr & S_NEGATIVE) == 0)
-        handle_relative(cycles);
-}
-
-void brk(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Break (software IRQ)
-	// Modes: IMP
-
-	#if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void bvc(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Branch if Overflow Clear
-	// Modes: REL
-	// REL: 3 cycles if branch taken, 4 cycles if page crossed
-	
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-    pc += bytes;
-    if ((sr & S_OVERFLOW) == 0)
-        handle_relative(cycles);
-}
-
-void bvs(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Branch if Overflow Set
-	// Modes: REL
-	// REL: 3 cycles if branch taken, 4 cycles if page crossed
-	
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-    pc += bytes;
-    if (sr & S_OVERFLOW)
-        handle_relative(cycles);
-}
-
-void clc(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Clear Carry
-	// Modes: IMP
-
-    sr &= ~S_CARRY;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void cld(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Clear Decimal Mode
-	// Modes: IMP
-
-    sr &= ~S_DECIMAL;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void cli(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Clear Interrupt Disable
-	// Modes: IMP
-
-    sr &= ~S_INT_DIS;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void clv(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Clear Overflow
-	// Modes: IMP
-
-    sr &= ~S_OVERFLOW;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void cmp(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Compare A
-	// Modes: IMM, ZP_, ZPX, AB_, ABX, ABY, INX, INY
-	// INY: 6 cycles if page crossed
-
-    uint8_t *operand = NULL;
-    handle_addressing(mode, &operand, cycles);
-
-    uint8_t operation = ac - *operand;
-
-    if (operation == 0)
-        sr |= S_ZERO;
-    else sr &= ~S_ZERO;
-
-    if (operation >> 7)
-        sr |= S_NEGATIVE;
-    else sr &= ~S_NEGATIVE;
-
-    if (*operand <= ac)
-        sr |= S_CARRY;
-    else sr &= ~S_CARRY;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void cpx(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Compare X
-	// Modes: IMM, ZP_, AB_
-	
-    uint8_t *operand = NULL;
-    handle_addressing(mode, &operand, cycles);
-
-    int8_t operation = xr - *operand;
-
-    if (operation == 0)
-        sr |= S_ZERO;
-    else sr &= ~S_ZERO;
-
-    if (operation >> 7)
-        sr |= S_NEGATIVE;
-    else sr &= ~S_NEGATIVE;
-
-    if (operation >= 0)
-        sr |= S_CARRY;
-    else sr &= ~S_CARRY;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void cpy(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Compare Y
-	// Modes: IMM, ZP_, AB_
-	
-    uint8_t *operand = NULL;
-    handle_addressing(mode, &operand, cycles);
-
-    int8_t operation = yr - *operand;
-
-    if (operation == 0)
-        sr |= S_ZERO;
-    else sr &= ~S_ZERO;
-
-    if (operation >> 7)
-        sr |= S_NEGATIVE;
-    else sr &= ~S_NEGATIVE;
-
-    if (operation >= 0)
-        sr |= S_CARRY;
-    else sr &= ~S_CARRY;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void dec(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Decrement Memory
-	// Modes: ZP_, ZPX, AB_, ABX
-
-    uint8_t *operand = NULL;
-    handle_addressing(mode, &operand, cycles);
-    
-    (*operand)--;
-
-    if (*operand >> 7)
-        sr |= S_NEGATIVE;
-    else sr &= ~S_NEGATIVE;
-
-    if (*operand == 0)
-        sr |= S_ZERO;
-    else sr &= ~S_ZERO;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void dex(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Decrement X
-	// Modes: IMP
-
-    xr--;
-
-    if (xr >> 7)
-        sr |= S_NEGATIVE;
-    else sr &= ~S_NEGATIVE;
-
-    if (xr == 0)
-        sr |= S_ZERO;
-    else sr &= ~S_ZERO;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void dey(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Decrement Y
-	// Modes: IMP
-
-    yr--;
-
-    if (yr >> 7)
-        sr |= S_NEGATIVE;
-    else sr &= ~S_NEGATIVE;
-
-    if (yr == 0)
-        sr |= S_ZERO;
-    else sr &= ~S_ZERO;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-    
-	pc += bytes;
-}
-
-void eor(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Bitwise Exclusive OR
-	// Modes: IMM, ZP_, ZPX, AB_, ABX, ABY, INX, INY
-	// INY: 6 cycles if page crossed
-
-    uint8_t *operand = NULL;
-    handle_addressing(mode, &operand, cycles);
-
-    ac ^= *operand;
-
-    if (ac >> 7)
-        sr |= S_NEGATIVE;
-    else sr &= ~S_NEGATIVE;
-
-    if (ac == 0)
-        sr |= S_ZERO;
-    else sr &= ~S_ZERO;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void inc(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Increment Memory
-	// Modes: ZP_, ZPX, AB_, ABX
-	
-    uint8_t *operand = NULL;
-    handle_addressing(mode, &operand, cycles);
-    
-    (*operand)++;
-
-    if (*operand >> 7)
-        sr |= S_NEGATIVE;
-    else sr &= ~S_NEGATIVE;
-
-    if (*operand == 0)
-        sr |= S_ZERO;
-    else sr &= ~S_ZERO;
-    
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void inx(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Increment X
-	// Modes: IMP
-    
-    xr++;
-
-    if (xr >> 7)
-        sr |= S_NEGATIVE;
-    else sr &= ~S_NEGATIVE;
-
-    if (xr == 0)
-        sr |= S_ZERO;
-    else sr &= ~S_ZERO;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void iny(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Increment Y
-	// Modes: IMP
-
-    yr++;
-
-    if (yr >> 7)
-        sr |= S_NEGATIVE;
-    else sr &= ~S_NEGATIVE;
-
-    if (yr == 0)
-        sr |= S_ZERO;
-    else sr &= ~S_ZERO;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void jmp(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Jump
-	// Modes: AB_, IN_
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-    if (mode == IN_) {
-        /*  Absolute Indirect addressing:
-            the second byte of the instruction contains the low-order eight bits of a
-            memory location. The high-order eight bits of that memory location is
-            contained in the third byte of the instruction.
-            The contents of the fully specified memory location is the low-order byte
-            of the effective address. The next memory location contains the high-order
-            eight bytes of the effective address which is loaded into the 16 bit
-            program counter.  */
-        uint16_t p = (ram[pc + 2] << 8) | (ram[pc + 1]);
-        pc = ((ram[p + 1] << 8) | ram[p]);
+#define IDLE_ENTRY(code, op, mode, bytes, cyc) [code] = IDLE_##op || mode == ACC,
+
+static const bool idle_step[256] = { OPCODES(IDLE_ENTRY) };
+
+static inline bool idle_loop(const uint8_t *ram, const bus *b, uint16_t addr) {
+    /*  True when the code at addr is a short straight-line run that never
+        writes memory, ending with a conditional branch back to addr, like
+        BIT $1800 / BPL or LDA $1C00 / AND #$10 / BEQ. Once one pass leaves
+        the registers unchanged such a loop cannot get out by itself.
+        With a bus, loops that may read a device page are not idle: the
+        device can change what they see. Indirect operands could point
+        anywhere and are ruled out whenever a device is mapped.  */
+    uint32_t pc = addr;
+    for (int k = 0; k < 8; k++) {
+        instruction i = instructions[ram[pc]];
+        if (i.mode == REL)
+            return (uint16_t)(pc + 2 + (int8_t)ram[(uint16_t)(pc + 1)]) == addr;
+        if (!idle_step[ram[pc]])
+            return false;
+        if (b != NULL && b->read_devices != 0) {
+            uint16_t operand = (ram[(uint16_t)(pc + 2)] << 8) | ram[(uint16_t)(pc + 1)];
+            if (i.mode == INX || i.mode == INY)
+                return false;
+            // Indexed operands stay within 255 bytes of the base
+            if ((i.mode == AB_ || i.mode == ABX || i.mode == ABY) &&
+                (b->rd[operand >> 8] == NULL || (i.mode != AB_ && b->rd[(uint16_t)(operand + 0xFF) >> 8] == NULL)))
+                return false;
+        }
+        pc += i.bytes;
+        if (pc > 0xFFFF)
+            return false;
     }
-    else pc = (ram[pc + 2] << 8) | (ram[pc + 1]);
-}
-
-void jsr(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Jump to Subroutine
-	// Modes: AB_
-
-    uint16_t _pc = pc + 2;
-    ram[0x0100 + sp--] = (_pc & 0xFF00) >> 8;
-    ram[0x0100 + sp--] = _pc & 0x00FF;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-    pc = (ram[pc + 2] << 8) | ram[pc + 1];
-}
-
-void lda(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Load A
-	// Modes: IMM, ZP_, ZPX, AB_, ABX, ABY, INX, INY
-	// INY: 6 cycles if page crossed
-
-    uint8_t *operand = NULL;
-    handle_addressing(mode, &operand, cycles);
-    
-    ac = *operand;
-
-    if (ac >> 7)
-        sr |= S_NEGATIVE;
-    else sr &= ~S_NEGATIVE;
-
-    if (ac == 0)
-        sr |= S_ZERO;
-    else sr &= ~S_ZERO;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void ldx(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Load X
-	// Modes: IMM, ZP_, ZPY, AB_, ABY
-	// ABY: 5 cycles if page crossed
-
-    uint8_t *operand = NULL;
-    handle_addressing(mode, &operand, cycles);
-    
-    xr = *operand;
-
-    if (xr >> 7)
-        sr |= S_NEGATIVE;
-    else sr &= ~S_NEGATIVE;
-
-    if (xr == 0)
-        sr |= S_ZERO;
-    else sr &= ~S_ZERO;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void ldy(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Load Y
-	// Modes: IMM, ZP_, ZPX, AB_, ABX
-	// ABX: 5 cycles if page crossed
-
-    uint8_t *operand = NULL;
-    handle_addressing(mode, &operand, cycles);
-    
-    yr = *operand;
-
-    if (yr >> 7)
-        sr |= S_NEGATIVE;
-    else sr &= ~S_NEGATIVE;
-
-    if (yr == 0)
-        sr |= S_ZERO;
-    else sr &= ~S_ZERO;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void lsr(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Logical Shift Right
-	// Modes: ACC, ZP_, ZPX, AB_, ABX
-
-    uint8_t *operand = NULL;
-    handle_addressing(mode, &operand, cycles);
-
-    uint8_t carry = *operand & 1;
-    *operand = (*operand) >> 1;
-
-    sr &= ~S_NEGATIVE;
-
-    if (*operand == 0)
-        sr |= S_ZERO;
-    else sr &= ~S_ZERO;
-
-    if (carry)
-        sr |= S_CARRY;
-    else sr &= ~S_CARRY;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void nop(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// No Operation
-	// Modes: IMP
-
-	#if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void ora(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Bitwise OR
-	// Modes: IMM, ZP_, ZPX, AB_, ABX, ABY, INX, INY
-	// INY: 6 cycles if page crossed
-	
-    uint8_t *operand = NULL;
-    handle_addressing(mode, &operand, cycles);
-
-    ac |= *operand;
-
-    if (ac >> 7)
-        sr |= S_NEGATIVE;
-    else sr &= ~S_NEGATIVE;
-
-    if (ac == 0)
-        sr |= S_ZERO;
-    else sr &= ~S_ZERO;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void pha(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Push A
-	// Modes: IMP
-
-	#if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-    ram[0x0100 + sp--] = ac;
-	pc += bytes;
-}
-
-void php(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Push Processor Status
-	// Modes: IMP
-	
-    ram[0x0100 + sp--] = sr;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void pla(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Pull A
-	// Modes: IMP
-
-    sp++;
-    ac = ram[0x0100 + sp];
-
-    if (ac >> 7)
-        sr |= S_NEGATIVE;
-    else sr &= ~S_NEGATIVE;
-
-    if (ac == 0)
-        sr |= S_ZERO;
-    else sr &= ~S_ZERO;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void plp(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Pull Processor Status
-	// Modes: IMP
-
-    sp++;
-    sr = ram[0x0100 + sp];
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void rol(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Rotate Left
-	// Modes: ACC, ZP_, ZPX, AB_, ABX
-
-    uint8_t *operand = NULL;
-    handle_addressing(mode, &operand, cycles);
-
-    uint8_t out_carry = (*operand) >> 7;
-    uint8_t in_carry = sr & S_CARRY;
-    *operand = ((*operand) << 1) | in_carry;
-
-    if (out_carry)
-        sr |= S_CARRY;
-    else sr &= ~S_CARRY;
-
-    if ((*operand) >> 7)
-        sr |= S_NEGATIVE;
-    else sr &= ~S_NEGATIVE;
-
-    if (*operand == 0)
-        sr |= S_ZERO;
-    else sr &= ~S_ZERO;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void ror(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Rotate Right
-	// Modes: ACC, ZP_, ZPX, AB_, ABX
-	
-    uint8_t *operand = NULL;
-    handle_addressing(mode, &operand, cycles);
-
-    uint8_t out_carry = (*operand) & 1;
-    uint8_t in_carry = sr & S_CARRY;
-    *operand = ((*operand) >> 1) | (in_carry << 7);
-
-    if (out_carry)
-        sr |= S_CARRY;
-    else sr &= ~S_CARRY;
-
-    if (in_carry)
-        sr |= S_NEGATIVE;
-    else sr &= ~S_NEGATIVE;
-
-    if (*operand == 0)
-        sr |= S_ZERO;
-    else sr &= ~S_ZERO;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
+    return false;
+}
+
+static inline uint8_t interrupt(cpu *c, uint32_t pending) {
+    // Takes the NMI or IRQ in `pending`, if any, returns the cycles it took
+    uint8_t cycles = 0;
+    TAKE_INTERRUPT(pending)
+    return cycles;
+}
+
+static inline uint64_t run_table(cpu *c, uint64_t budget) {
+    // Runs until BRK or until at least `budget` cycles elapsed, returns the cycles spent
+    uint64_t start = c->clock;
+    PUT_SR(SR);
+    SAMPLE_AT(c, SAMPLE_CPU_PC, 0);
+    do {
+        c->clock += instructions[c->ram[PC]].operation(c);
+        c->executed++;
+
+        uint32_t pending = PENDING(c);
+        if (__builtin_expect(pending != 0, 0)) {
+            c->clock += interrupt(c, pending);
+            if (pending & PEND_EXIT)
+                break;
+        }
+    } while (c->clock - start < budget && !c->halted);
+    SR = GET_SR();
+    return c->clock - start;
 }
 
-void rti(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Return from Interrupt
-	// Modes: IMP
-
-	#if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
+/*  Instrumented handlers: the same operations once more, with the memory
+    accesses going past the hook and each instruction to the trace when the
+    flags ask for it. Only run_instrumented() calls them, so the handlers
+    above and the other engines carry no instrumentation at all.  */
 
-    sr = ram[0x0100 + sp++] & 0xCF;
-    pc = (ram[0x0100 + sp + 2] << 8) | ram[0x0100 + sp + 1];
-    sp += 2;
+static inline uint8_t instr_read(cpu *c, uint16_t addr, uint8_t v) {
+    if ((atomic_load_explicit(&c->instr.flags, memory_order_relaxed) & INSTR_HOOKS) && c->instr.hook != NULL)
+        c->instr.hook(c->instr.hook_ctx, addr, v, false);
+    return v;
 }
 
-void rts(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Return from Subroutine
-	// Modes: IMP
-
-    sp += 2;
-
-	#if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc = ((ram[0x0100 + sp] << 8) | ram[0x0100 + sp - 1]) + 1;
-    
+static inline void instr_write(cpu *c, uint16_t addr, uint8_t v) {
+    if ((atomic_load_explicit(&c->instr.flags, memory_order_relaxed) & INSTR_HOOKS) && c->instr.hook != NULL)
+        c->instr.hook(c->instr.hook_ctx, addr, v, true);
 }
 
-void sbc(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Subtract with Carry
-	// Modes: IMM, ZP_, ZPX, AB_, ABX, ABY, INX, INY
-	// INY: 6 cycles if page crossed
-
-    uint8_t *operand = NULL;
-    handle_addressing(mode, &operand, cycles);
-    int8_t operand_i = (int8_t)*operand;
-
-    uint8_t carry_orig = (sr & S_CARRY);
-    int16_t binary_operation = (int8_t)ac - operand_i - !carry_orig;
-
-    uint8_t ac_bin = (uint8_t)binary_operation;
-
-    if (ac_bin < 0x80)
-        sr |= S_CARRY;
-    else sr &= ~S_CARRY;
-
-    if (binary_operation < -128 || binary_operation > 127)
-        sr |= S_OVERFLOW;
-    else sr &= ~S_OVERFLOW;
-
-    if (ac_bin >> 7)
-        sr |= S_NEGATIVE;
-    else sr &= ~S_NEGATIVE;
-
-    if (ac_bin == 0)
-        sr |= S_ZERO;
-    else sr &= ~S_ZERO;
-
-    if (sr & S_DECIMAL) {
-        int8_t t = (ac & 0x0F) - (operand_i & 0x0F) - !carry_orig;
-        if (t < 0)
-            t = ((t - 0x06) & 0x0F) - 0x10;
-        int16_t _ac = (ac & 0xF0) - (operand_i & 0xF0) + t;
-        if (_ac < 0)
-            _ac -= 0x60;
-        ac = (int8_t)_ac;
+#undef RD
+#undef WR
+#undef RD_RAM
+#undef WR_RAM
+#define RD(addr) instr_read(c, addr, bus_read(&c->bus, addr, c->clock + cycles))
+#define WR(addr, v) { \
+        uint16_t wa = (addr); \
+        uint8_t wv = (v); \
+        bus_write(&c->bus, wa, wv, c->clock + cycles); \
+        instr_write(c, wa, wv); \
     }
-    else {
-        ac = ac_bin;        
+#define RD_RAM(addr) instr_read(c, addr, c->ram[addr])
+#define WR_RAM(addr, v) { \
+        uint16_t wa = (addr); \
+        uint8_t wv = (v); \
+        c->ram[wa] = wv; \
+        instr_write(c, wa, wv); \
     }
 
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void sec(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Set Carry
-	// Modes: IMP
-
-    sr |= S_CARRY;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void sed(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Set Decimal Mode
-	// Modes: IMP
-
-    sr |= S_DECIMAL;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void sei(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Set Interrupt Disable
-	// Modes: IMP
-
-    sr |= S_INT_DIS;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-    
-	pc += bytes;
-}
-
-void sta(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Store A
-	// Modes: ZP_, ZPX, AB_, ABX, ABY, INX, INY
-
-	#if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-    uint8_t *operand = NULL;
-    handle_addressing(mode, &operand, cycles);
-
-    *operand = ac;
-	pc += bytes;
-}
-
-void stx(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Store X
-	// Modes: ZP_, ZPY, AB_
-
-	#if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-	
-    uint8_t *operand = NULL;
-    handle_addressing(mode, &operand, cycles);
-
-    *operand = xr;
-	pc += bytes;
-}
-
-void sty(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Store Y
-	// Modes: ZP_, ZPX, AB_
-
-	#if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-    uint8_t *operand = NULL;
-    handle_addressing(mode, &operand, cycles);
-	
-    *operand = yr;
-	pc += bytes;
-}
-
-void tax(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Transfer A to X
-	// Modes: IMP
-
-    xr = ac;
-
-    if (xr >> 7)
-        sr |= S_NEGATIVE;
-    else sr &= ~S_NEGATIVE;
-
-    if (xr == 0)
-        sr |= S_ZERO;
-    else sr &= ~S_ZERO;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void tay(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Transfer A to Y
-	// Modes: IMP
-	
-    yr = ac;
-    
-    if (yr >> 7)
-        sr |= S_NEGATIVE;
-    else sr &= ~S_NEGATIVE;
-
-    if (yr == 0)
-        sr |= S_ZERO;
-    else sr &= ~S_ZERO;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
-}
-
-void tsx(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Transfer Stack Pointer to X
-	// Modes: IMP
-
-    xr = sp;
-    
-    if (xr >> 7)
-        sr |= S_NEGATIVE;
-    else sr &= ~S_NEGATIVE;
+#define I_TRACE(ea) \
+    if (atomic_load_explicit(&c->instr.flags, memory_order_relaxed) & INSTR_TRACE) { \
+        SR = GET_SR(); \
+        trace_instruction(c, opc, ea, c->clock); \
+    }
 
-    if (xr == 0)
-        sr |= S_ZERO;
-    else sr &= ~S_ZERO;
+#define I_BODY(code, op, mode, bytes, cyc) \
+    static inline uint8_t op##_##mode##_i(cpu *c) { \
+        uint8_t cycles = 0; \
+        uint16_t opc = PC; \
+        EA_##mode \
+        PC += bytes; \
+        OP_##op(LD_##mode, ST_##mode) \
+        I_TRACE(TRACE_EA_##mode) \
+        return cycles + cyc; \
+    }
 
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
+OPCODES(I_BODY)
 
-	pc += bytes;
+static inline uint8_t nul_i(cpu *c) {
+    uint16_t opc = PC;
+    PC += 1;
+    I_TRACE(0)
+    return 0;
 }
 
-void txa(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Transfer X to A
-	// Modes: IMP
-	
-    ac = xr;
+#define I_ENTRY(code, op, mode, bytes, cyc) [code] = op##_##mode##_i,
 
-    if (ac >> 7)
-        sr |= S_NEGATIVE;
-    else sr &= ~S_NEGATIVE;
-
-    if (ac == 0)
-        sr |= S_ZERO;
-    else sr &= ~S_ZERO;
+static handler instrumented[256] = {
+    [0 ... 0xFF] = nul_i,
+    OPCODES(I_ENTRY)
+};
 
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
+static inline uint64_t run_instrumented(cpu *c, uint64_t budget) {
+    // run_table() on the instrumented handlers, whatever ENGINE is
+    uint64_t start = c->clock;
+    PUT_SR(SR);
+    SAMPLE_AT(c, SAMPLE_CPU_PC, 0);
+    do {
+        uint16_t pc = PC;
+        uint8_t opcode = c->ram[pc];
+        uint32_t flags = atomic_load_explicit(&c->instr.flags, memory_order_relaxed);
+        if (flags & INSTR_COUNT)
+            c->instr.counts[opcode]++;
+        // Counting and profiling look at whole instructions, the plain handlers do for them
+        uint8_t cycles = flags & (INSTR_TRACE | INSTR_HOOKS) ? instrumented[opcode](c) : instructions[opcode].operation(c);
+        c->clock += cycles;
+        c->executed++;
+        bool profiling = (flags & INSTR_PROFILE) && c->profile != NULL;
+        if (profiling)
+            profile_step(c->profile, pc, opcode, cycles, PC, SP);
+
+        uint32_t pending = PENDING(c);
+        if (__builtin_expect(pending != 0, 0)) {
+            cycles = interrupt(c, pending);
+            c->clock += cycles;
+            if (profiling && cycles > 0)
+                profile_interrupt(c->profile, PC, cycles, SP);
+            if (pending & PEND_EXIT)
+                break;
+        }
+    } while (c->clock - start < budget && !c->halted);
+    SR = GET_SR();
+    return c->clock - start;
+}
+
+#undef AC
+#undef XR
+#undef YR
+#undef SP
+#undef SR
+#undef PC
+#undef RD
+#undef WR
+#undef RD_RAM
+#undef WR_RAM
+#undef OPB
+#undef OPW
+#undef CYC
+#undef HALT
+#undef FN
+#undef FZ
+#undef H_BODY
+#undef H_ENTRY
+#undef IDLE_ENTRY
+#undef I_TRACE
+#undef I_BODY
+#undef I_ENTRY
+
+#if ENGINE == ENGINE_THREADED
+#include "threaded.h"
+#elif ENGINE == ENGINE_BLOCKS || ENGINE == ENGINE_JIT
+#include "blocks.h"
+#endif
 
-	pc += bytes;
+static inline void code_changed(cpu *c) {
+    // To be called after the host writes to ram[] behind the emulated CPU's back
+    #if ENGINE == ENGINE_BLOCKS || ENGINE == ENGINE_JIT
+    blocks_flush(c);
+    #endif
+}
+
+static inline void cpu_reset(cpu *c) {
+    // Registers to their power on values, pc from the RESET vector
+    c->ac = c->xr = c->yr = 0;
+    c->sp = 0xFF;
+    c->sr = 0x32;
+    atomic_store(&c->pending, 0);
+    c->halted = false;
+    c->pc = (c->ram[0xFFFD] << 8) | c->ram[0xFFFC];
+}
+
+static inline cpu *cpu_create() {
+    // A powered on CPU with empty memory, NULL when out of memory
+    cpu *c = calloc(1, sizeof(cpu));
+    if (c == NULL)
+        return NULL;
+    bus_init(&c->bus, c->ram);
+    events_init(&c->events, &c->pending, PEND_YIELD);
+    #if DEBUG
+    atomic_store(&c->instr.flags, INSTR_TRACE);
+    #endif
+    #if ENGINE == ENGINE_BLOCKS || ENGINE == ENGINE_JIT
+    if (!blocks_create(c)) {
+        free(c);
+        return NULL;
+    }
+    #endif
+    cpu_reset(c);
+    return c;
 }
 
-void txs(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Transfer X to Stack Pointer
-	// Modes: IMP
-
-    sp = xr;
-
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
+static inline void cpu_load(cpu *c, uint16_t addr, const void *data, size_t size) {
+    // Copies a program or ROM image into memory, wrapping at $FFFF
+    const uint8_t *bytes = data;
+    for (size_t i = 0; i < size; i++)
+        c->ram[(uint16_t)(addr + i)] = bytes[i];
+    code_changed(c);
 }
 
-void tya(uint8_t bytes, uint8_t *cycles, uint8_t mode) {
-	// Transfer Y to A
-	// Modes: IMP
-	
-    ac = yr;
-
-    if (ac >> 7)
-        sr |= S_NEGATIVE;
-    else sr &= ~S_NEGATIVE;
-
-    if (ac == 0)
-        sr |= S_ZERO;
-    else sr &= ~S_ZERO;
+/*  Memory map, in pages of 256 bytes from first to last: RAM (the default
+    everywhere), ROM (reads from ram[], writes dropped; load the image with
+    cpu_load()) or a device, whose handlers see every access to its pages.
+    Pages 0 and 1 can only be RAM, these return false for anything else.
+    The map is part of the decoded and translated code, which is flushed.  */
 
-    #if DEBUG
-	print_asm(__func__, mode, bytes);
-	#endif
-
-	pc += bytes;
+static inline bool cpu_map_ram(cpu *c, uint8_t first, uint8_t last) {
+    bool ok = bus_map(&c->bus, first, last, c->ram, c->ram, (bus_device){NULL, NULL, NULL});
+    code_changed(c);
+    return ok;
+}
+
+static inline bool cpu_map_rom(cpu *c, uint8_t first, uint8_t last) {
+    bool ok = bus_map(&c->bus, first, last, c->ram, NULL, (bus_device){NULL, NULL, NULL});
+    code_changed(c);
+    return ok;
+}
+
+static inline bool cpu_map_io(cpu *c, uint8_t first, uint8_t last, bus_reader read, bus_writer write, void *ctx) {
+    bool ok = bus_map(&c->bus, first, last, NULL, NULL, (bus_device){read, write, ctx});
+    code_changed(c);
+    return ok;
+}
+
+/*  Instrumentation is switched at run time: cpu_run_cycles() runs the
+    plain engine while c->instr.flags is 0 and run_instrumented(), the
+    table engine on handlers that also trace, count, profile and call the
+    hook, otherwise. cpu_instrument() is safe from any thread, from a
+    device and from the hook itself; the engine changes at the next
+    instruction boundary it checks c->pending at, after the instruction or
+    the block.  */
+
+static inline void cpu_instrument(cpu *c, uint32_t flags) {
+    // INSTR_* to turn on, 0 for the plain engine
+    atomic_store_explicit(&c->instr.flags, flags, memory_order_release);
+    atomic_fetch_or_explicit(&c->pending, PEND_SWITCH, memory_order_relaxed);
+}
+
+static inline void cpu_hook(cpu *c, void (*hook)(void *ctx, uint16_t addr, uint8_t v, bool write), void *ctx) {
+    // What INSTR_HOOKS calls for each read and write of the program, set before turning it on
+    c->instr.hook = hook;
+    c->instr.hook_ctx = ctx;
+}
+
+static inline void cpu_trace(cpu *c, trace *t) {
+    // Where INSTR_TRACE goes: binary records to t (trace.h), or text on stdout with NULL
+    c->trace = t;
+}
+
+static inline void cpu_profile(cpu *c, profile *p) {
+    // Where INSTR_PROFILE adds up (profile.h), set before turning it on
+    c->profile = p;
+}
+
+/*  The lines into the cpu. Safe to call from any thread and from signal
+    handlers while another thread runs it; the engine sees the change at
+    its next check, within a block.  */
+
+static inline void cpu_irq(cpu *c, bool active) {
+    // Holds the IRQ line low (active) or releases it
+    if (active)
+        atomic_fetch_or_explicit(&c->pending, PEND_IRQ, memory_order_relaxed);
+    else
+        atomic_fetch_and_explicit(&c->pending, ~PEND_IRQ, memory_order_relaxed);
+}
+
+static inline void cpu_nmi(cpu *c) {
+    // A falling edge on NMI: taken once, whatever I says
+    atomic_fetch_or_explicit(&c->pending, PEND_NMI, memory_order_relaxed);
+}
+
+static inline void cpu_stop(cpu *c) {
+    // Ends the cpu_run_cycles() call in progress, or the next one, early
+    atomic_fetch_or_explicit(&c->pending, PEND_STOP, memory_order_relaxed);
+}
+
+static inline uint64_t cpu_run_engine(cpu *c, uint64_t budget) {
+    #if ENGINE == ENGINE_THREADED
+    return run_threaded(c, budget);
+    #elif ENGINE == ENGINE_BLOCKS || ENGINE == ENGINE_JIT
+    return run_blocks(c, budget);
+    #else
+    return run_table(c, budget);
+    #endif
+}
+
+static inline uint64_t cpu_run_cycles(cpu *c, uint64_t budget) {
+    /*  Runs until BRK or until at least `budget` cycles elapsed, returns the
+        cycles spent; c->clock advances as much. The engine runs in slices
+        that end at the next event, the events due are fired in between. An
+        engine overshoots the end of a slice by up to a block, so an event
+        fires that late at most. cpu_stop() ends it early. A budget of 0 runs
+        nothing.  */
+    if (budget == 0)
+        return 0;
+    uint64_t start = c->clock;
+    #if SAMPLING
+    sample_cpu = c;
+    #endif
+    do {
+        SAMPLE_AT(c, SAMPLE_EVENTS, c->pc);
+        events_fire(&c->events, c->clock);
+        uint64_t end = start + budget;
+        if (events_next(&c->events) < end)
+            end = events_next(&c->events);
+        c->events.until = end;
+        if (atomic_load_explicit(&c->instr.flags, memory_order_acquire) != 0) {
+            run_instrumented(c, end - c->clock);
+            c->instr.ran = true;
+        }
+        else {
+            if (c->instr.ran) {
+                // Its writes did not keep the decoded code up to date
+                code_changed(c);
+                c->instr.ran = false;
+            }
+            cpu_run_engine(c, end - c->clock);
+        }
+        atomic_fetch_and_explicit(&c->pending, ~(PEND_YIELD | PEND_SWITCH), memory_order_relaxed);
+    } while (c->clock - start < budget && !c->halted && !(PENDING(c) & PEND_STOP));
+    atomic_fetch_and_explicit(&c->pending, ~PEND_STOP, memory_order_relaxed);
+    c->events.until = 0;
+    SAMPLE_AT(c, SAMPLE_EVENTS, c->pc);
+    events_fire(&c->events, c->clock);
+    #if SAMPLING
+    sample_cpu = NULL;
+    #endif
+    return c->clock - start;
+}
+
+static inline void cpu_destroy(cpu *c) {
+    if (c == NULL)
+        return;
+    #if ENGINE == ENGINE_BLOCKS || ENGINE == ENGINE_JIT
+    blocks_destroy(c);
+    #endif
+    free(c);
 }
 
-instruction instructions[] = {
-    {brk, 1, 7, IMP},   // 0x00
-    {ora, 2, 6, INX},   // 0x01
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {ora, 2, 3, ZP_},   // 0x05
-    {asl, 2, 5, ZP_},   // 0x06
-    {nul, 0, 0, _ND},
-    {php, 1, 3, IMP},   // 0x08
-    {ora, 2, 2, IMM},   // 0x09
-    {asl, 1, 2, ACC},   // 0x0A
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {ora, 3, 4, AB_},   // 0x0D
-    {asl, 3, 6, AB_},   // 0x0E
-    {nul, 0, 0, _ND},
-    {bpl, 2, 2, REL},   // 0x10
-    {ora, 2, 5, INY},   // 0x11
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {ora, 2, 4, ZPX},   // 0x15
-    {asl, 2, 6, ZPX},   // 0x16
-    {nul, 0, 0, _ND},
-    {clc, 1, 2, IMP},   // 0x18
-    {ora, 3, 4, ABY},   // 0x19
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {ora, 3, 4, ABX},   // 0x1D
-    {asl, 3, 7, ABX},   // 0x1E
-    {nul, 0, 0, _ND},
-    {jsr, 3, 6, AB_},   // 0x20
-    {and, 2, 6, INX},   // 0x21
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {bit, 2, 3, ZP_},   // 0x24
-    {and, 2, 3, ZP_},   // 0x25
-    {rol, 2, 5, ZP_},   // 0x26
-    {nul, 0, 0, _ND},
-    {plp, 1, 4, IMP},   // 0x28
-    {and, 2, 2, IMM},   // 0x29
-    {rol, 1, 2, ACC},   // 0x2A
-    {nul, 0, 0, _ND},
-    {bit, 3, 4, AB_},   // 0x2C
-    {and, 3, 4, AB_},   // 0x2D
-    {rol, 3, 6, AB_},   // 0x2E
-    {nul, 0, 0, _ND},
-    {bmi, 2, 2, REL},   // 0x30
-    {and, 2, 5, INY},   // 0x31
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {and, 2, 4, ZPX},   // 0x35
-    {rol, 2, 6, ZPX},   // 0x36
-    {nul, 0, 0, _ND},
-    {sec, 1, 2, IMP},   // 0x38
-    {and, 3, 4, ABY},   // 0x39
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {and, 3, 4, ABX},   // 0x3D
-    {rol, 3, 7, ABX},   // 0x3E
-    {nul, 0, 0, _ND},
-    {rti, 1, 6, IMP},   // 0x40
-    {eor, 2, 6, INX},   // 0x41
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {eor, 2, 3, ZP_},   // 0x45
-    {lsr, 2, 5, ZP_},   // 0x46
-    {nul, 0, 0, _ND},
-    {pha, 1, 3, IMP},   // 0x48
-    {eor, 2, 2, IMM},   // 0x49
-    {lsr, 1, 2, ACC},   // 0x4A
-    {nul, 0, 0, _ND},
-    {jmp, 3, 3, AB_},   // 0x4C
-    {eor, 3, 4, AB_},   // 0x4D
-    {lsr, 3, 6, AB_},   // 0x4E
-    {nul, 0, 0, _ND},
-    {bvc, 2, 2, REL},   // 0x50
-    {eor, 2, 5, INY},   // 0x51
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {eor, 2, 4, ZPX},   // 0x55
-    {lsr, 2, 6, ZPX},   // 0x56
-    {nul, 0, 0, _ND},
-    {cli, 1, 2, IMP},   // 0x58
-    {eor, 3, 4, ABY},   // 0x59
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {eor, 3, 4, ABX},   // 0x5D
-    {lsr, 3, 7, ABX},   // 0x5E
-    {nul, 0, 0, _ND},
-    {rts, 1, 6, IMP},   // 0x60
-    {adc, 2, 6, INX},   // 0x61
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {adc, 2, 3, ZP_},   // 0x65
-    {ror, 2, 5, ZP_},   // 0x66
-    {nul, 0, 0, _ND},
-    {pla, 1, 4, IMP},   // 0x68
-    {adc, 2, 2, IMM},   // 0x69
-    {ror, 1, 2, ACC},   // 0x6A
-    {nul, 0, 0, _ND},
-    {jmp, 3, 5, IN_},   // 0x6C
-    {adc, 3, 4, AB_},   // 0x6D
-    {ror, 3, 6, AB_},   // 0x6E
-    {nul, 0, 0, _ND},
-    {bvs, 2, 2, REL},   // 0x70
-    {adc, 2, 5, INY},   // 0x71
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {adc, 2, 4, ZPX},   // 0x75
-    {ror, 2, 6, ZPX},   // 0x76
-    {nul, 0, 0, _ND},
-    {sei, 1, 2, IMP},   // 0x78
-    {adc, 3, 4, ABY},   // 0x79
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {adc, 3, 4, ABX},   // 0x7D
-    {ror, 3, 7, ABX},   // 0x7E
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {sta, 2, 6, INX},   // 0x81
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {sty, 2, 3, ZP_},   // 0x84
-    {sta, 2, 3, ZP_},   // 0x85
-    {stx, 2, 3, ZP_},   // 0x86
-    {nul, 0, 0, _ND},
-    {dey, 1, 2, IMP},   // 0x88
-    {nul, 0, 0, _ND},
-    {txa, 1, 2, IMP},   // 0x8A
-    {nul, 0, 0, _ND},
-    {sty, 3, 4, AB_},   // 0x8C
-    {sta, 3, 4, AB_},   // 0x8D
-    {stx, 3, 4, AB_},   // 0x8E
-    {nul, 0, 0, _ND},
-    {bcc, 2, 2, REL},   // 0x90
-    {sta, 2, 6, INY},   // 0x91
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {sty, 2, 4, ZPX},   // 0x94
-    {sta, 2, 4, ZPX},   // 0x95
-    {stx, 2, 4, ZPY},   // 0x96
-    {nul, 0, 0, _ND},
-    {tya, 1, 2, IMP},   // 0x98
-    {sta, 3, 5, ABY},   // 0x99
-    {txs, 1, 2, IMP},   // 0x9A
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {sta, 3, 5, ABX},   // 0x9D
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {ldy, 2, 2, IMM},   // 0xA0
-    {lda, 2, 6, INX},   // 0xA1
-    {ldx, 2, 2, IMM},   // 0xA2
-    {nul, 0, 0, _ND},
-    {ldy, 2, 3, ZP_},   // 0xA4
-    {lda, 2, 3, ZP_},   // 0xA5
-    {ldx, 2, 3, ZP_},   // 0xA6
-    {nul, 0, 0, _ND},
-    {tay, 1, 2, IMP},   // 0xA8
-    {lda, 2, 2, IMM},   // 0xA9
-    {tax, 1, 2, IMP},   // 0xAA
-    {nul, 0, 0, _ND},
-    {ldy, 3, 4, AB_},   // 0xAC
-    {lda, 3, 4, AB_},   // 0xAD
-    {ldx, 3, 4, AB_},   // 0xAE
-    {nul, 0, 0, _ND},
-    {bcs, 2, 2, REL},   // 0xB0
-    {lda, 2, 5, INY},   // 0xB1
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {ldy, 2, 4, ZPX},   // 0xB4
-    {lda, 2, 4, ZPX},   // 0xB5
-    {ldx, 2, 4, ZPY},   // 0xB6
-    {nul, 0, 0, _ND},
-    {clv, 1, 2, IMP},   // 0xB8
-    {lda, 3, 4, ABY},   // 0xB9
-    {tsx, 1, 2, IMP},   // 0xBA
-    {nul, 0, 0, _ND},
-    {ldy, 3, 4, ABX},   // 0xBC
-    {lda, 3, 4, ABX},   // 0xBD
-    {ldx, 3, 4, ABY},   // 0xBE
-    {nul, 0, 0, _ND},
-    {cpy, 2, 2, IMM},   // 0xC0
-    {cmp, 2, 6, INX},   // 0xC1
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {cpy, 2, 3, ZP_},   // 0xC4
-    {cmp, 2, 3, ZP_},   // 0xC5
-    {dec, 2, 5, ZP_},   // 0xC6
-    {nul, 0, 0, _ND},
-    {iny, 1, 2, IMP},   // 0xC8
-    {cmp, 2, 2, IMM},   // 0xC9
-    {dex, 1, 2, IMP},   // 0xCA
-    {nul, 0, 0, _ND},
-    {cpy, 3, 4, AB_},   // 0xCC
-    {cmp, 3, 4, AB_},   // 0xCD
-    {dec, 3, 6, AB_},   // 0xCE
-    {nul, 0, 0, _ND},
-    {bne, 2, 2, REL},   // 0xD0
-    {cmp, 2, 5, INY},   // 0xD1
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {cmp, 2, 4, ZPX},   // 0xD5
-    {dec, 2, 6, ZPX},   // 0xD6
-    {nul, 0, 0, _ND},
-    {cld, 1, 2, IMP},   // 0xD8
-    {cmp, 3, 4, ABY},   // 0xD9
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {cmp, 3, 4, ABX},   // 0xDD
-    {dec, 3, 7, ABX},   // 0xDE
-    {nul, 0, 0, _ND},
-    {cpx, 2, 2, IMM},   // 0xE0
-    {sbc, 2, 6, INX},   // 0xE1
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {cpx, 2, 3, ZP_},   // 0xE4
-    {sbc, 2, 3, ZP_},   // 0xE5
-    {inc, 2, 5, ZP_},   // 0xE6
-    {nul, 0, 0, _ND},
-    {inx, 1, 2, IMP},   // 0xE8
-    {sbc, 2, 2, IMM},   // 0xE9
-    {nop, 1, 2, IMP},   // 0xEA
-    {nul, 0, 0, _ND},
-    {cpx, 3, 4, AB_},   // 0xEC
-    {sbc, 3, 4, AB_},   // 0xED
-    {inc, 3, 6, AB_},   // 0xEE
-    {nul, 0, 0, _ND},
-    {beq, 2, 2, REL},   // 0xF0
-    {sbc, 2, 5, INY},   // 0xF1
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {sbc, 2, 4, ZPX},   // 0xF5
-    {inc, 2, 6, ZPX},   // 0xF6
-    {nul, 0, 0, _ND},
-    {sed, 1, 2, IMP},   // 0xF8
-    {sbc, 3, 4, ABY},   // 0xF9
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {nul, 0, 0, _ND},
-    {sbc, 3, 4, ABX},   // 0xFD
-    {inc, 3, 7, ABX}    // 0xFE
-};
-
 #endif
\ No newline at end of file
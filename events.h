@@ -0,0 +1,125 @@
+#ifndef EVENTS_H
+#define EVENTS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+/*  Device event scheduler: a binary min-heap of events keyed on the cycle
+    they are due, in the clock of the cpu that owns the queue (c->clock).
+
+    cpu_run_cycles() runs the engine in slices that end at the first event,
+    fires every event that is due and goes on, so the engines never look at
+    devices and pay nothing while no event is due. A device that schedules
+    an event inside the slice being run (a timer started by a register
+    write) makes events_schedule() raise its bit in the cpu's pending word,
+    and the engine ends the slice at its next check of that word.
+
+    An event is owned by its device and only linked into the queue, which
+    keeps its heap position in `slot`; moving or cancelling one is O(log n).
+    Events due at the same cycle fire in no particular order.  */
+
+#ifndef EVENTS_MAX
+#define EVENTS_MAX 64           // events a queue can hold at once
+#endif
+#define EVENT_NEVER UINT64_MAX
+
+typedef struct event {
+    uint64_t when;
+    void (*fire)(void *ctx, uint64_t when);
+    void *ctx;
+    int slot;                   // heap index, -1 when not scheduled
+} event;
+
+typedef struct events {
+    event *heap[EVENTS_MAX];
+    int count;
+    uint64_t until;             // end of the slice being run, 0 between runs
+    _Atomic uint32_t *pending;  // gets `yield` when an event falls before `until`
+    uint32_t yield;
+} events;
+
+static inline void event_init(event *e, void (*fire)(void *ctx, uint64_t when), void *ctx) {
+    *e = (event){EVENT_NEVER, fire, ctx, -1};
+}
+
+static inline void events_init(events *q, _Atomic uint32_t *pending, uint32_t yield) {
+    q->count = 0;
+    q->until = 0;
+    q->pending = pending;
+    q->yield = yield;
+}
+
+static inline void events_place(events *q, event *e, int i) {
+    q->heap[i] = e;
+    e->slot = i;
+}
+
+static inline void events_sift(events *q, int i) {
+    // Moves heap[i] up or down to where its `when` belongs
+    event *e = q->heap[i];
+    while (i > 0 && q->heap[(i - 1) / 2]->when > e->when) {
+        events_place(q, q->heap[(i - 1) / 2], i);
+        i = (i - 1) / 2;
+    }
+    while (true) {
+        int child = 2 * i + 1;
+        if (child >= q->count)
+            break;
+        if (child + 1 < q->count && q->heap[child + 1]->when < q->heap[child]->when)
+            child++;
+        if (q->heap[child]->when >= e->when)
+            break;
+        events_place(q, q->heap[child], i);
+        i = child;
+    }
+    events_place(q, e, i);
+}
+
+static inline void events_cancel(events *q, event *e) {
+    if (e->slot < 0)
+        return;
+    int i = e->slot;
+    e->slot = -1;
+    e->when = EVENT_NEVER;
+    event *last = q->heap[--q->count];
+    if (last != e) {
+        events_place(q, last, i);
+        events_sift(q, i);
+    }
+}
+
+static inline bool events_schedule(events *q, event *e, uint64_t when) {
+    // Schedules e at `when` or moves it there, EVENT_NEVER cancels; false when the queue is full
+    if (when == EVENT_NEVER) {
+        events_cancel(q, e);
+        return true;
+    }
+    if (e->slot < 0) {
+        if (q->count == EVENTS_MAX)
+            return false;
+        e->slot = q->count++;
+        q->heap[e->slot] = e;
+    }
+    e->when = when;
+    events_sift(q, e->slot);
+    if (when < q->until && q->pending != NULL)
+        atomic_fetch_or_explicit(q->pending, q->yield, memory_order_relaxed);
+    return true;
+}
+
+static inline uint64_t events_next(const events *q) {
+    return q->count > 0 ? q->heap[0]->when : EVENT_NEVER;
+}
+
+static inline void events_fire(events *q, uint64_t now) {
+    // Fires the events due by `now` in order; a handler may schedule again, also its own event
+    while (q->count > 0 && q->heap[0]->when <= now) {
+        event *e = q->heap[0];
+        uint64_t when = e->when;
+        events_cancel(q, e);
+        e->fire(e->ctx, when);
+    }
+}
+
+#endif
@@ -0,0 +1,328 @@
+#ifndef FARM_H
+#define FARM_H
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#include "dom6502.h"
+#if SAMPLING
+#include "sample.h"
+#endif
+
+/*  Instance farm: runs a batch of independent jobs, each one a program on
+    its own cpu, on a pool of worker threads pinned to cores.
+
+    A worker keeps up to FARM_ACTIVE jobs running and steps them round robin
+    in slices of FARM_SLICE cycles, so a long run only takes its share of
+    the worker and the short ones around it keep finishing. Jobs not started
+    yet sit in per-worker deques: the owner takes them from the bottom, an
+    idle worker steals half of the remaining ones from the top of another
+    deque. Started jobs never move, their cpu (memory, block cache, JIT
+    code) stays on the core that warmed it up.
+
+    Each deque is a range of job indices packed in one 64-bit word, and both
+    ends move by compare-and-swap. Nothing is pushed while a batch runs, so
+    the ranges only shrink and every job index is handed out exactly once.
+
+    The cpus are created once per worker slot and reused from job to job:
+    memory is cleared, the image loaded and the caches flushed in between.
+
+    Pinning uses pthread_setaffinity_np(), so _GNU_SOURCE has to be defined
+    before the first system header. With SAMPLING the workers join the
+    sampling profiler when it is on (sample.h).  */
+
+#ifndef _GNU_SOURCE
+#error "farm.h needs _GNU_SOURCE"
+#endif
+
+#ifndef FARM_ACTIVE
+#define FARM_ACTIVE 4           // jobs a worker interleaves
+#endif
+#ifndef FARM_SLICE
+#define FARM_SLICE 1000000      // cycles a job runs before the next one's turn
+#endif
+#define FARM_MAX_THREADS 256
+
+typedef struct farm_job {
+    // Filled in by the caller
+    const void *image;          // copied to `addr`, the rest of memory is zero
+    size_t size;
+    uint16_t addr;
+    int32_t start;              // first pc, -1 for the RESET vector
+    uint64_t max_cycles;        // the job ends here when it does not reach BRK
+    void (*done)(cpu *c, struct farm_job *j);   // optional, sees the final state
+    void *user;
+
+    // Results
+    uint64_t cycles;
+    uint64_t executed;
+    bool halted;                // ended with BRK rather than max_cycles
+    uint8_t ac, xr, yr, sp, sr;
+    uint16_t pc;
+    int worker;                 // which worker ran it
+    bool stolen;                // taken from another worker's deque
+} farm_job;
+
+typedef struct farm_worker {
+    struct farm *f;
+    int id;
+    pthread_t thread;
+    _Alignas(64) _Atomic uint64_t range;   // top << 32 | bottom, empty when equal
+    cpu *slot[FARM_ACTIVE];
+    farm_job *job[FARM_ACTIVE];
+    bool failed;                // a cpu could not be created
+    bool pinned;                // runs on one core, see farm_worker_main()
+    uint64_t steals;            // successful steals in the last batch
+} farm_worker;
+
+typedef struct farm {
+    int threads;
+    farm_worker *workers;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;        // a batch was posted, or the farm shuts down
+    pthread_cond_t idle;        // a worker finished its part of the batch
+    uint64_t generation;        // bumped by every farm_run()
+    int busy;                   // workers still in the current batch
+    bool quit;
+    farm_job *jobs;
+} farm;
+
+#define FARM_RANGE(top, bottom) (((uint64_t)(top) << 32) | (uint32_t)(bottom))
+#define FARM_TOP(r) ((uint32_t)((r) >> 32))
+#define FARM_BOTTOM(r) ((uint32_t)(r))
+
+static inline int farm_pop(farm_worker *w) {
+    // Owner end: the last job of the range, -1 when empty
+    uint64_t r = atomic_load_explicit(&w->range, memory_order_relaxed);
+    while (FARM_TOP(r) < FARM_BOTTOM(r)) {
+        if (atomic_compare_exchange_weak(&w->range, &r, FARM_RANGE(FARM_TOP(r), FARM_BOTTOM(r) - 1)))
+            return FARM_BOTTOM(r) - 1;
+    }
+    return -1;
+}
+
+static inline int farm_steal(farm_worker *w) {
+    // Takes half of the first non-empty deque after w's own, keeps one job and queues the rest
+    farm *f = w->f;
+    for (int k = 1; k < f->threads; k++) {
+        farm_worker *v = &f->workers[(w->id + k) % f->threads];
+        uint64_t r = atomic_load_explicit(&v->range, memory_order_relaxed);
+        while (FARM_TOP(r) < FARM_BOTTOM(r)) {
+            uint32_t top = FARM_TOP(r), n = (FARM_BOTTOM(r) - top + 1) / 2;
+            if (atomic_compare_exchange_weak(&v->range, &r, FARM_RANGE(top + n, FARM_BOTTOM(r)))) {
+                // w's own range is empty, thieves that saw it so have given up on it
+                atomic_store(&w->range, FARM_RANGE(top + 1, top + n));
+                w->steals++;
+                return top;
+            }
+        }
+    }
+    return -1;
+}
+
+static inline bool farm_start(farm_worker *w, int s, int index) {
+    // Sets slot s up for job `index`
+    farm_job *j = &w->f->jobs[index];
+    if (w->slot[s] == NULL && (w->slot[s] = cpu_create()) == NULL)
+        return false;
+    cpu *c = w->slot[s];
+    memset(c->ram, 0, sizeof(c->ram));
+    cpu_load(c, j->addr, j->image, j->size);
+    cpu_reset(c);
+    cpu_instrument(c, 0);   // cpu_create() traces under DEBUG, a job runs plain
+    if (j->start >= 0)
+        c->pc = j->start;
+    c->executed = 0;
+    j->cycles = 0;
+    j->worker = w->id;
+    w->job[s] = j;
+    return true;
+}
+
+static inline void farm_finish(farm_worker *w, int s) {
+    cpu *c = w->slot[s];
+    farm_job *j = w->job[s];
+    j->executed = c->executed;
+    j->halted = c->halted;
+    j->ac = c->ac; j->xr = c->xr; j->yr = c->yr; j->sp = c->sp; j->sr = c->sr;
+    j->pc = c->pc;
+    if (j->done != NULL)
+        j->done(c, j);
+    w->job[s] = NULL;
+}
+
+static inline void farm_batch(farm_worker *w) {
+    int active = 0;
+    bool more = true;       // the deques may still hold jobs
+    w->steals = 0;
+    do {
+        for (int s = 0; s < FARM_ACTIVE && more; s++) {
+            if (w->job[s] != NULL)
+                continue;
+            bool stolen = false;
+            int index = farm_pop(w);
+            if (index < 0) {
+                index = farm_steal(w);
+                stolen = true;
+            }
+            if (index < 0) {
+                more = false;
+            }
+            else if (!farm_start(w, s, index)) {
+                // Out of memory: report the job as not run
+                w->failed = true;
+                w->f->jobs[index].worker = -1;
+            }
+            else {
+                w->f->jobs[index].stolen = stolen;
+                active++;
+            }
+        }
+        for (int s = 0; s < FARM_ACTIVE; s++) {
+            farm_job *j = w->job[s];
+            if (j == NULL)
+                continue;
+            uint64_t left = j->max_cycles - j->cycles;
+            j->cycles += cpu_run_cycles(w->slot[s], left < FARM_SLICE ? left : FARM_SLICE);
+            if (w->slot[s]->halted || j->cycles >= j->max_cycles) {
+                farm_finish(w, s);
+                active--;
+            }
+        }
+    } while (active > 0 || more);
+}
+
+static inline void *farm_worker_main(void *arg) {
+    farm_worker *w = arg;
+    farm *f = w->f;
+    uint64_t seen = 0;
+
+    // Worker n on the n-th core the process may run on, which under a
+    // cpuset or taskset need not be core n; unpinned if that fails
+    cpu_set_t allowed, set;
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0 && CPU_COUNT(&allowed) > 0) {
+        int n = w->id % CPU_COUNT(&allowed);
+        for (int k = 0; k < CPU_SETSIZE; k++) {
+            if (CPU_ISSET(k, &allowed) && n-- == 0) {
+                CPU_ZERO(&set);
+                CPU_SET(k, &set);
+                w->pinned = pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+                break;
+            }
+        }
+    }
+    #if SAMPLING
+    sample_thread();
+    #endif
+
+    pthread_mutex_lock(&f->lock);
+    while (true) {
+        while (f->generation == seen && !f->quit)
+            pthread_cond_wait(&f->wake, &f->lock);
+        if (f->quit)
+            break;
+        seen = f->generation;
+        pthread_mutex_unlock(&f->lock);
+
+        farm_batch(w);
+
+        pthread_mutex_lock(&f->lock);
+        if (--f->busy == 0)
+            pthread_cond_signal(&f->idle);
+    }
+    pthread_mutex_unlock(&f->lock);
+
+    #if SAMPLING
+    sample_thread_end();
+    #endif
+    for (int s = 0; s < FARM_ACTIVE; s++)
+        cpu_destroy(w->slot[s]);
+    return NULL;
+}
+
+static inline void farm_destroy(farm *f);
+
+static inline farm *farm_create(int threads) {
+    // A pool of up to `threads` workers, 0 for one per online core; NULL when not even one started
+    if (threads <= 0)
+        threads = sysconf(_SC_NPROCESSORS_ONLN);
+    if (threads > FARM_MAX_THREADS)
+        threads = FARM_MAX_THREADS;
+    farm *f = calloc(1, sizeof(farm));
+    if (f == NULL)
+        return NULL;
+    f->workers = aligned_alloc(64, sizeof(farm_worker) * threads);
+    if (f->workers == NULL) {
+        free(f);
+        return NULL;
+    }
+    memset(f->workers, 0, sizeof(farm_worker) * threads);
+    pthread_mutex_init(&f->lock, NULL);
+    pthread_cond_init(&f->wake, NULL);
+    pthread_cond_init(&f->idle, NULL);
+    for (int i = 0; i < threads; i++) {
+        farm_worker *w = &f->workers[i];
+        w->f = f;
+        w->id = i;
+        if (pthread_create(&w->thread, NULL, farm_worker_main, w) != 0)
+            break;
+        f->threads++;
+    }
+    if (f->threads == 0) {
+        farm_destroy(f);
+        return NULL;
+    }
+    return f;
+}
+
+static inline bool farm_run(farm *f, farm_job *jobs, int count) {
+    /*  Runs every job and fills in its results, returns once all are done.
+        False when some job could not get a cpu; those have worker -1.  */
+    f->jobs = jobs;
+    for (int i = 0; i < count; i++) {
+        jobs[i].worker = -1;
+        jobs[i].stolen = false;
+    }
+    // Contiguous shares, so that the first steals take big ranges
+    for (int i = 0; i < f->threads; i++) {
+        farm_worker *w = &f->workers[i];
+        w->failed = false;
+        atomic_store(&w->range, FARM_RANGE((int64_t)count * i / f->threads, (int64_t)count * (i + 1) / f->threads));
+    }
+
+    pthread_mutex_lock(&f->lock);
+    f->busy = f->threads;
+    f->generation++;
+    pthread_cond_broadcast(&f->wake);
+    while (f->busy > 0)
+        pthread_cond_wait(&f->idle, &f->lock);
+    pthread_mutex_unlock(&f->lock);
+
+    bool ok = true;
+    for (int i = 0; i < f->threads; i++)
+        ok = ok && !f->workers[i].failed;
+    return ok;
+}
+
+static inline void farm_destroy(farm *f) {
+    if (f == NULL)
+        return;
+    pthread_mutex_lock(&f->lock);
+    f->quit = true;
+    pthread_cond_broadcast(&f->wake);
+    pthread_mutex_unlock(&f->lock);
+    for (int i = 0; i < f->threads; i++)
+        pthread_join(f->workers[i].thread, NULL);
+    pthread_mutex_destroy(&f->lock);
+    pthread_cond_destroy(&f->wake);
+    pthread_cond_destroy(&f->idle);
+    free(f->workers);
+    free(f);
+}
+
+#undef FARM_RANGE
+#undef FARM_TOP
+#undef FARM_BOTTOM
+
+#endif
@@ -0,0 +1,918 @@
+#ifndef JIT_H
+#define JIT_H
+
+#include <stddef.h>
+#include <sys/mman.h>
+#include "dom6502.h"
+#include "opcodes.h"
+
+/*  x86-64 translation of hot blocks (ENGINE_JIT).
+
+    run_blocks() counts how many times each block is entered; the block that
+    reaches JIT_THRESHOLD is translated into native code in an mmap'd
+    executable buffer. Inside native code the 6502 registers live in host
+    registers, N and Z are kept lazily as in LAZY_FLAGS, and every block exit
+    goes through a dispatcher that jumps straight into the next block when
+    it is translated too, as long as the cycle budget lasts and nothing is
+    pending (c->pending). Everything else (untranslated blocks, BRK, interrupts) is left
+    to the interpreter.
+
+    Memory writes keep the blocks_write() protocol: a write that drops the
+    running block leaves native code right after the instruction, as the
+    interpreter does. Traced runs go through the instrumented engine
+    instead (cpu_instrument()).
+
+    Reads go to ram[] directly whenever the bus allows it: a constant
+    address is looked up in the page table at translation time, the
+    indexed and indirect modes test the page at run time, and only when a
+    device is mapped at all. Zero page and stack are always RAM. Writes
+    test the write table, as the interpreter does. Remapping flushes the
+    translations along with the blocks.
+
+    Each cpu has its own code buffer (c->jit), since the stubs and the
+    translated code embed the addresses of its ram[], pending word and block
+    cache.
+    The emitters write through jit_ptr, which jit_compile() points at the
+    buffer of the cpu being translated; it is thread local so that cpus can
+    be translated on several threads at once.  */
+
+#ifndef JIT_THRESHOLD
+#define JIT_THRESHOLD 16    // block entries before translation
+#endif
+#define JIT_CODE_SIZE (16 << 20)
+#define JIT_BLOCK_MAX 8192  // worst case code for one block
+
+typedef struct jit_state {
+    uint8_t ac, xr, yr, sp, sr;
+    uint16_t pc;
+    uint64_t budget;    // leave once this many cycles are spent
+    uint64_t count;     // instructions executed
+} jit_state;
+
+typedef uint64_t (*jit_entry)(jit_state *st, void *native);
+
+// Host registers
+#define R_AX  0
+#define R_CX  1
+#define R_DX  2
+#define R_BX  3
+#define R_SP  4
+#define R_BP  5
+#define R_SI  6
+#define R_DI  7
+#define R_8   8
+#define R_9   9
+#define R_10  10
+#define R_11  11
+#define R_12  12
+#define R_13  13
+#define R_14  14
+#define R_15  15
+
+// 6502 state while native code runs
+#define J_A   R_BX
+#define J_X   R_BP
+#define J_Y   R_12
+#define J_S   R_13
+#define J_P   R_14  // status, N and Z bits stale
+#define J_N   R_8   // N in bit 7
+#define J_Z   R_9   // zero when Z is set
+#define J_CYC R_10  // cycles spent
+#define J_CNT R_11  // instructions executed
+#define J_RAM R_15
+
+#define CC_B  0x2
+#define CC_AE 0x3
+#define CC_E  0x4
+#define CC_NE 0x5
+
+typedef struct jit {
+    uint8_t *code;
+    uint8_t *ptr;           // next free byte
+    uint8_t *blocks;        // first byte after the stubs
+    jit_entry enter;
+    uint8_t *dispatch;      // esi = next pc
+} jit;
+
+// The cpu being translated and its buffer, see jit_compile()
+static _Thread_local cpu *jit_cpu;
+static _Thread_local uint8_t *jit_ptr;
+static _Thread_local uint8_t *jit_dispatch;
+
+static inline void emit8(uint8_t v) {
+    *jit_ptr++ = v;
+}
+
+static inline void emit32(uint32_t v) {
+    memcpy(jit_ptr, &v, 4);
+    jit_ptr += 4;
+}
+
+static inline void emit64(uint64_t v) {
+    memcpy(jit_ptr, &v, 8);
+    jit_ptr += 8;
+}
+
+static inline void emit_rex(int w, int reg, int index, int base) {
+    // Always emitted, so that byte registers 4-7 are spl..dil and not ah..bh
+    emit8(0x40 | (w << 3) | ((reg >> 3) << 2) | ((index >> 3) << 1) | (base >> 3));
+}
+
+static inline void emit_op(int op) {
+    // op holds up to two opcode bytes, 0x0Fxx for the two byte forms
+    if (op > 0xFF)
+        emit8(op >> 8);
+    emit8(op);
+}
+
+static inline void x_rr(int w, int op, int reg, int rm) {
+    // op reg, rm (reg may be an opcode extension)
+    emit_rex(w, reg, 0, rm);
+    emit_op(op);
+    emit8(0xC0 | ((reg & 7) << 3) | (rm & 7));
+}
+
+static inline void x_rm(int w, int op, int reg, int base, int index, int scale, int32_t disp) {
+    // op reg, [base + index * scale + disp], index < 0 for none
+    emit_rex(w, reg, index < 0 ? 0 : index, base);
+    emit_op(op);
+    if (index < 0 && (base & 7) != R_SP) {
+        emit8(0x80 | ((reg & 7) << 3) | (base & 7));
+    }
+    else {
+        emit8(0x80 | ((reg & 7) << 3) | 4);
+        emit8((scale << 6) | ((index < 0 ? R_SP : index) & 7) << 3 | (base & 7));
+    }
+    emit32(disp);
+}
+
+#define x_mov8(dst, src)       x_rr(0, 0x88, src, dst)
+#define x_op8(op, dst, src)    x_rr(0, op, src, dst)         // 0x00 add, 0x08 or, 0x20 and, 0x28 sub, 0x30 xor
+#define x_movzx(dst, src)      x_rr(0, 0x0FB6, dst, src)
+#define x_mov32(dst, src)      x_rr(0, 0x89, src, dst)
+#define x_mov64(dst, src)      x_rr(1, 0x89, src, dst)
+#define x_or32(dst, src)       x_rr(0, 0x09, src, dst)
+#define x_add64(dst, src)      x_rr(1, 0x01, src, dst)
+#define x_load8(dst, b, i, d)  x_rm(0, 0x0FB6, dst, b, i, 0, d)
+#define x_load16(dst, b, i, d) x_rm(0, 0x0FB7, dst, b, i, 0, d)
+#define x_store8(src, b, i, d) x_rm(0, 0x88, src, b, i, 0, d)
+
+static inline void x_imm8(int ext, int r, uint8_t imm) {
+    // 0x80 group on a byte register: 0 add, 1 or, 4 and, 5 sub, 7 cmp
+    x_rr(0, 0x80, ext, r);
+    emit8(imm);
+}
+
+static inline void x_imm32(int w, int ext, int r, uint32_t imm) {
+    x_rr(w, 0x81, ext, r);
+    emit32(imm);
+}
+
+static inline void x_movi8(int r, uint8_t imm) {
+    emit_rex(0, 0, 0, r);
+    emit8(0xB0 + (r & 7));
+    emit8(imm);
+}
+
+static inline void x_movi32(int r, uint32_t imm) {
+    emit_rex(0, 0, 0, r);
+    emit8(0xB8 + (r & 7));
+    emit32(imm);
+}
+
+static inline void x_movi64(int r, uint64_t imm) {
+    emit_rex(1, 0, 0, r);
+    emit8(0xB8 + (r & 7));
+    emit64(imm);
+}
+
+static inline void x_test8(int r, uint8_t imm) {
+    x_rr(0, 0xF6, 0, r);
+    emit8(imm);
+}
+
+static inline void x_shift(int size, int ext, int r, uint8_t n) {
+    // 2 rcl, 3 rcr, 4 shl, 5 shr on an 8, 32 or 64 bit register
+    int op = size == 8 ? 0xC0 : 0xC1;
+    x_rr(size == 64, n == 1 ? op + 0x10 : op, ext, r);
+    if (n != 1)
+        emit8(n);
+}
+
+static inline void x_setcc(int cc, int r) {
+    x_rr(0, 0x0F90 | cc, 0, r);
+}
+
+static inline void x_push(int r) {
+    emit_rex(0, 0, 0, r);
+    emit8(0x50 + (r & 7));
+}
+
+static inline void x_pop(int r) {
+    emit_rex(0, 0, 0, r);
+    emit8(0x58 + (r & 7));
+}
+
+static inline uint8_t *x_jcc(int cc) {
+    // Returns the rel32 field, see x_patch()
+    emit8(0x0F);
+    emit8(0x80 | cc);
+    emit32(0);
+    return jit_ptr - 4;
+}
+
+static inline uint8_t *x_jmp() {
+    emit8(0xE9);
+    emit32(0);
+    return jit_ptr - 4;
+}
+
+static inline void x_patch(uint8_t *rel, uint8_t *target) {
+    int32_t d = target - (rel + 4);
+    memcpy(rel, &d, 4);
+}
+
+static inline void x_call(void *f) {
+    // Caller saved 6502 state is kept across the call, rsp stays 16 byte aligned
+    x_push(J_N); x_push(J_Z); x_push(J_CYC); x_push(J_CNT);
+    x_movi64(R_AX, (uint64_t)f);
+    x_rr(0, 0xFF, 2, R_AX);
+    x_pop(J_CNT); x_pop(J_CYC); x_pop(J_Z); x_pop(J_N);
+}
+
+static inline void j_set_nz(int r) {
+    x_mov8(J_N, r);
+    x_mov8(J_Z, r);
+}
+
+static inline void j_get_sr(int dst, int tmp) {
+    // dst = GET_SR()
+    x_movzx(dst, J_P);
+    x_imm32(0, 4, dst, (uint8_t)~(S_NEGATIVE | S_ZERO));
+    x_movzx(tmp, J_N);
+    x_imm32(0, 4, tmp, S_NEGATIVE);
+    x_or32(dst, tmp);
+    x_op8(0x84, J_Z, J_Z);
+    x_setcc(CC_E, tmp);
+    x_movzx(tmp, tmp);
+    x_shift(32, 4, tmp, 1);
+    x_or32(dst, tmp);
+}
+
+static inline void j_put_sr(int r) {
+    // PUT_SR() from a byte register
+    x_mov8(J_P, r);
+    x_mov8(J_N, r);
+    x_mov8(J_Z, r);
+    x_rr(0, 0xF6, 2, J_Z);
+    x_imm8(4, J_Z, S_ZERO);
+}
+
+static inline void j_set_carry(int cc) {
+    // SET_FLAG(S_CARRY, cc) from the host flags
+    x_setcc(cc, R_DX);
+    x_imm8(4, J_P, (uint8_t)~S_CARRY);
+    x_op8(0x08, J_P, R_DX);
+}
+
+static inline void j_exit(uint16_t pc, uint32_t cycles, uint32_t count) {
+    x_movi32(R_SI, pc);
+    x_imm32(1, 0, J_CYC, cycles);
+    x_imm32(1, 0, J_CNT, count);
+    x_patch(x_jmp(), jit_dispatch);
+}
+
+static inline void j_exit_ax(uint32_t cycles, uint32_t count) {
+    // Same as j_exit() with the next pc in eax
+    x_mov32(R_SI, R_AX);
+    x_imm32(1, 0, J_CYC, cycles);
+    x_imm32(1, 0, J_CNT, count);
+    x_patch(x_jmp(), jit_dispatch);
+}
+
+/*  Translation of one instruction. An operand is either a constant address
+    (`ea` >= 0) or the address left in eax (`ea` < 0).  */
+
+typedef struct jit_op {
+    block *b;
+    uint8_t mode;
+    uint16_t operand;
+    uint16_t next;      // address of the next instruction
+    uint32_t cycles;    // base cycles of the block up to this instruction included
+    uint32_t at;        // the same before this instruction, see j_now()
+    uint32_t count;     // instructions up to this one included
+    int ea;
+} jit_op;
+
+typedef void (*jit_emitter)(jit_op *o);
+
+static inline uint16_t jit_adc(uint8_t a, uint8_t m, uint8_t s) {
+    return ALU_ADC(a, m, s);
+}
+
+static inline uint16_t jit_sbc(uint8_t a, uint8_t m, uint8_t s) {
+    return ALU_SBC(a, m, s);
+}
+
+static inline uint8_t jit_bus_read(cpu *c, uint16_t addr, uint64_t cycles) {
+    // cycles is j_now(), the time since run_blocks() brought c->clock up to date
+    return bus_read_io(&c->bus, addr, c->clock + cycles);
+}
+
+static inline void jit_bus_write(cpu *c, uint16_t addr, uint8_t v, uint64_t cycles) {
+    // WR() when the page table has no pointer: a device, ROM or a page holding code
+    if (bus_write_slow(&c->bus, addr, v, c->clock + cycles))
+        blocks_write(c, addr);
+}
+
+static inline void j_now(jit_op *o, int dst) {
+    // The time of the access for jit_bus_read() and jit_bus_write(): J_CYC plus the block's cycles before it
+    x_rm(1, 0x8D, dst, J_CYC, -1, 0, o->at);
+}
+
+static inline bool j_device_read(jit_op *o) {
+    // A run time address that may be read from a device page
+    return jit_cpu->bus.read_devices != 0 &&
+        (o->mode == ABX || o->mode == ABY || o->mode == INX || o->mode == INY);
+}
+
+static inline uint8_t *j_page_test(uint8_t *const *table) {
+    // Jumps when the page of eax has a pointer in table, returns the jump to patch
+    x_mov32(R_DX, R_AX);
+    x_shift(32, 5, R_DX, 8);
+    x_movi64(R_DI, (uint64_t)table);
+    x_rm(1, 0x83, 7, R_DI, R_DX, 3, 0);
+    emit8(0);
+    return x_jcc(CC_NE);
+}
+
+static inline void j_load(jit_op *o, int dst, int ea) {
+    // RD() into dst, zero extended; dst is not eax when ea is in eax
+    if (ea >= 0) {
+        if (jit_cpu->bus.rd[ea >> 8] != NULL) {
+            x_load8(dst, J_RAM, -1, ea);
+            return;
+        }
+        x_movi32(R_SI, ea);
+        j_now(o, R_DX);
+        x_movi64(R_DI, (uint64_t)jit_cpu);
+        x_call(jit_bus_read);
+        x_movzx(dst, R_AX);
+        return;
+    }
+    if (!j_device_read(o)) {
+        x_load8(dst, J_RAM, R_AX, 0);
+        return;
+    }
+    uint8_t *ram = j_page_test(jit_cpu->bus.rd);
+    // The address stays in eax for a store that may follow
+    x_push(R_AX); x_push(R_AX);
+    x_mov32(R_SI, R_AX);
+    j_now(o, R_DX);
+    x_movi64(R_DI, (uint64_t)jit_cpu);
+    x_call(jit_bus_read);
+    x_movzx(dst, R_AX);
+    x_pop(R_AX); x_pop(R_AX);
+    uint8_t *done = x_jmp();
+    x_patch(ram, jit_ptr);
+    x_load8(dst, J_RAM, R_AX, 0);
+    x_patch(done, jit_ptr);
+}
+
+static inline void j_write(jit_op *o, int src, int ea, bool check) {
+    /*  WR(): a plain store when the page table has a pointer for the page,
+        jit_bus_write() otherwise. With `check`, leave before the next
+        instruction when that dropped the running block.  */
+    if (ea >= 0 && jit_cpu->bus.mem_wr[ea >> 8] == NULL) {
+        // Device or ROM page, no code can be dropped
+        x_movzx(R_DX, src);
+        x_movi32(R_SI, ea);
+        j_now(o, R_CX);
+        x_movi64(R_DI, (uint64_t)jit_cpu);
+        x_call(jit_bus_write);
+        return;
+    }
+    uint8_t *memory;
+    if (ea >= 0) {
+        x_movi64(R_DI, (uint64_t)&jit_cpu->bus.wr[ea >> 8]);
+        x_rm(1, 0x83, 7, R_DI, -1, 0, 0);
+        emit8(0);
+        memory = x_jcc(CC_NE);
+    }
+    else {
+        memory = j_page_test(jit_cpu->bus.wr);
+    }
+    x_movzx(R_DX, src);
+    if (ea >= 0)
+        x_movi32(R_SI, ea);
+    else
+        x_mov32(R_SI, R_AX);
+    j_now(o, R_CX);
+    x_movi64(R_DI, (uint64_t)jit_cpu);
+    x_call(jit_bus_write);
+    if (check) {
+        x_movi64(R_AX, (uint64_t)o->b);
+        x_rm(1, 0x83, 7, R_AX, -1, 0, offsetof(block, native));
+        emit8(0);
+        uint8_t *live = x_jcc(CC_NE);
+        j_exit(o->next, o->cycles, o->count);
+        x_patch(live, jit_ptr);
+    }
+    uint8_t *done = x_jmp();
+    x_patch(memory, jit_ptr);
+    if (ea >= 0)
+        x_store8(src, J_RAM, -1, ea);
+    else
+        x_store8(src, J_RAM, R_AX, 0);
+    x_patch(done, jit_ptr);
+}
+
+static inline void j_address(jit_op *o) {
+    // EA_<mode>, page crossing penalties included
+    switch (o->mode) {
+        case ZP_:
+        case AB_:
+            o->ea = o->operand;
+            return;
+        case ZPX:
+        case ZPY:
+            x_movzx(R_AX, o->mode == ZPX ? J_X : J_Y);
+            x_imm32(0, 0, R_AX, o->operand);
+            break;
+        case ABX:
+        case ABY:
+            // One cycle when the low byte carries into the high byte
+            x_movzx(R_AX, o->mode == ABX ? J_X : J_Y);
+            x_rm(0, 0x8D, R_CX, R_AX, -1, 0, o->operand & 0xFF);
+            x_shift(32, 5, R_CX, 8);
+            x_add64(J_CYC, R_CX);
+            x_imm32(0, 0, R_AX, o->operand);
+            x_rr(0, 0x0FB7, R_AX, R_AX);
+            break;
+        case INX:
+            x_movzx(R_CX, J_X);
+            x_imm8(0, R_CX, o->operand);
+            x_movzx(R_CX, R_CX);
+            x_load16(R_AX, J_RAM, R_CX, 0);
+            break;
+        case INY:
+            x_load16(R_AX, J_RAM, -1, o->operand);
+            x_movzx(R_CX, J_Y);
+            x_movzx(R_DX, R_AX);
+            x_add64(R_DX, R_CX);
+            x_shift(32, 5, R_DX, 8);
+            x_add64(J_CYC, R_DX);
+            x_add64(R_AX, R_CX);
+            x_rr(0, 0x0FB7, R_AX, R_AX);
+            break;
+    }
+    o->ea = -1;
+}
+
+static inline void j_operand(jit_op *o, int dst) {
+    // LD_<mode> into dst, zero extended
+    if (o->mode == IMM) {
+        x_movi32(dst, o->operand & 0xFF);
+    }
+    else if (o->mode == ACC) {
+        x_movzx(dst, J_A);
+    }
+    else {
+        j_address(o);
+        j_load(o, dst, o->ea);
+    }
+}
+
+static inline void j_result(jit_op *o, int r) {
+    // SET_NZ() and ST_<mode> of the read-modify-write operations
+    j_set_nz(r);
+    if (o->mode == ACC)
+        x_mov8(J_A, r);
+    else
+        j_write(o, r, o->ea, true);
+}
+
+static inline void j_push(jit_op *o, int r, bool check) {
+    x_movzx(R_AX, J_S);
+    x_imm32(0, 0, R_AX, 0x0100);
+    x_rr(0, 0xFE, 1, J_S);
+    j_write(o, r, -1, check);
+}
+
+static inline void j_pull(int r) {
+    x_rr(0, 0xFE, 0, J_S);
+    x_movzx(R_AX, J_S);
+    x_load8(r, J_RAM, R_AX, 0x0100);
+}
+
+static inline void j_load_reg(jit_op *o, int r) {
+    j_operand(o, R_CX);
+    x_mov8(r, R_CX);
+    j_set_nz(r);
+}
+
+static inline void j_logic(jit_op *o, int op) {
+    j_operand(o, R_CX);
+    x_op8(op, J_A, R_CX);
+    j_set_nz(J_A);
+}
+
+static inline void j_alu(jit_op *o, void *f) {
+    j_operand(o, R_SI);
+    j_get_sr(R_DX, R_CX);
+    x_movzx(R_DI, J_A);
+    x_call(f);
+    x_mov8(J_A, R_AX);
+    x_shift(32, 5, R_AX, 8);
+    j_put_sr(R_AX);
+}
+
+static inline void j_compare(jit_op *o, int r) {
+    j_operand(o, R_CX);
+    x_movzx(R_AX, r);
+    x_op8(0x28, R_AX, R_CX);
+    if (r == J_A) {
+        j_set_carry(CC_AE);         // m <= AC
+    }
+    else {
+        x_test8(R_AX, 0x80);        // sign of the difference, see OP_cpx
+        j_set_carry(CC_E);
+    }
+    j_set_nz(R_AX);
+}
+
+static inline void j_test(jit_op *o) {
+    // OP_bit: N and Z from AC & m, V from bit 6 of the same value
+    j_operand(o, R_CX);
+    x_op8(0x20, R_CX, J_A);
+    j_set_nz(R_CX);
+    x_imm8(4, R_CX, S_OVERFLOW);
+    x_imm8(4, J_P, (uint8_t)~S_OVERFLOW);
+    x_op8(0x08, J_P, R_CX);
+}
+
+static inline void j_shift(jit_op *o, int ext) {
+    j_operand(o, R_CX);
+    if (ext == 2 || ext == 3) {
+        // Old carry into CF for rcl / rcr
+        x_mov8(R_DX, J_P);
+        x_shift(8, 5, R_DX, 1);
+    }
+    x_shift(8, ext, R_CX, 1);
+    j_set_carry(CC_B);
+    j_result(o, R_CX);
+}
+
+static inline void j_step(jit_op *o, int r, int ext) {
+    // inc / dec, on memory when r < 0
+    if (r < 0) {
+        j_operand(o, R_CX);
+        x_rr(0, 0xFE, ext, R_CX);
+        j_result(o, R_CX);
+    }
+    else {
+        x_rr(0, 0xFE, ext, r);
+        j_set_nz(r);
+    }
+}
+
+static inline void j_store(jit_op *o, int r) {
+    j_address(o);
+    j_write(o, r, o->ea, true);
+}
+
+static inline void j_transfer(int to, int from) {
+    x_mov8(to, from);
+    if (to != J_S)
+        j_set_nz(to);
+}
+
+static inline void j_branch(jit_op *o, int flag, uint8_t mask, bool set) {
+    int8_t rel = o->operand;
+    uint16_t target = o->next + rel;
+    if (flag == J_Z) {
+        // Z is set when J_Z is zero
+        x_op8(0x84, J_Z, J_Z);
+        set = !set;
+    }
+    else {
+        x_test8(flag, mask);
+    }
+    uint8_t *taken = x_jcc(set ? CC_NE : CC_E);
+    j_exit(o->next, o->cycles, o->count);
+    x_patch(taken, jit_ptr);
+    j_exit(target, o->cycles + 1 + ((target >> 8) != (o->next >> 8)), o->count);
+}
+
+void j_adc(jit_op *o) { j_alu(o, jit_adc); }
+void j_and(jit_op *o) { j_logic(o, 0x20); }
+void j_asl(jit_op *o) { j_shift(o, 4); }
+void j_bcc(jit_op *o) { j_branch(o, J_P, S_CARRY, false); }
+void j_bcs(jit_op *o) { j_branch(o, J_P, S_CARRY, true); }
+void j_beq(jit_op *o) { j_branch(o, J_Z, 0, true); }
+void j_bit(jit_op *o) { j_test(o); }
+void j_bmi(jit_op *o) { j_branch(o, J_N, S_NEGATIVE, true); }
+void j_bne(jit_op *o) { j_branch(o, J_Z, 0, false); }
+void j_bpl(jit_op *o) { j_branch(o, J_N, S_NEGATIVE, false); }
+void j_bvc(jit_op *o) { j_branch(o, J_P, S_OVERFLOW, false); }
+void j_bvs(jit_op *o) { j_branch(o, J_P, S_OVERFLOW, true); }
+void j_clc(jit_op *o) { x_imm8(4, J_P, (uint8_t)~S_CARRY); }
+void j_cld(jit_op *o) { x_imm8(4, J_P, (uint8_t)~S_DECIMAL); }
+void j_cli(jit_op *o) { x_imm8(4, J_P, (uint8_t)~S_INT_DIS); }
+void j_clv(jit_op *o) { x_imm8(4, J_P, (uint8_t)~S_OVERFLOW); }
+void j_cmp(jit_op *o) { j_compare(o, J_A); }
+void j_cpx(jit_op *o) { j_compare(o, J_X); }
+void j_cpy(jit_op *o) { j_compare(o, J_Y); }
+void j_dec(jit_op *o) { j_step(o, -1, 1); }
+void j_dex(jit_op *o) { j_step(o, J_X, 1); }
+void j_dey(jit_op *o) { j_step(o, J_Y, 1); }
+void j_eor(jit_op *o) { j_logic(o, 0x30); }
+void j_inc(jit_op *o) { j_step(o, -1, 0); }
+void j_inx(jit_op *o) { j_step(o, J_X, 0); }
+void j_iny(jit_op *o) { j_step(o, J_Y, 0); }
+void j_lda(jit_op *o) { j_load_reg(o, J_A); }
+void j_ldx(jit_op *o) { j_load_reg(o, J_X); }
+void j_ldy(jit_op *o) { j_load_reg(o, J_Y); }
+void j_lsr(jit_op *o) { j_shift(o, 5); }
+void j_nop(jit_op *o) {}
+void j_ora(jit_op *o) { j_logic(o, 0x08); }
+void j_pha(jit_op *o) { j_push(o, J_A, true); }
+void j_rol(jit_op *o) { j_shift(o, 2); }
+void j_ror(jit_op *o) { j_shift(o, 3); }
+void j_sbc(jit_op *o) { j_alu(o, jit_sbc); }
+void j_sec(jit_op *o) { x_imm8(1, J_P, S_CARRY); }
+void j_sed(jit_op *o) { x_imm8(1, J_P, S_DECIMAL); }
+void j_sei(jit_op *o) { x_imm8(1, J_P, S_INT_DIS); }
+void j_sta(jit_op *o) { j_store(o, J_A); }
+void j_stx(jit_op *o) { j_store(o, J_X); }
+void j_sty(jit_op *o) { j_store(o, J_Y); }
+void j_tax(jit_op *o) { j_transfer(J_X, J_A); }
+void j_tay(jit_op *o) { j_transfer(J_Y, J_A); }
+void j_tsx(jit_op *o) { j_transfer(J_X, J_S); }
+void j_txa(jit_op *o) { j_transfer(J_A, J_X); }
+void j_txs(jit_op *o) { j_transfer(J_S, J_X); }
+void j_tya(jit_op *o) { j_transfer(J_A, J_Y); }
+
+static inline void j_php(jit_op *o) {
+    j_get_sr(R_CX, R_DX);
+    j_push(o, R_CX, true);
+}
+
+static inline void j_pla(jit_op *o) {
+    j_pull(J_A);
+    j_set_nz(J_A);
+}
+
+static inline void j_plp(jit_op *o) {
+    j_pull(R_CX);
+    j_put_sr(R_CX);
+}
+
+static inline void j_jmp(jit_op *o) {
+    if (o->mode == AB_) {
+        j_exit(o->operand, o->cycles, o->count);
+        return;
+    }
+    j_load(o, R_AX, (uint16_t)(o->operand + 1));
+    x_shift(32, 4, R_AX, 8);
+    // A device handler call for the low byte would clobber the high one
+    bool device = jit_cpu->bus.rd[o->operand >> 8] == NULL;
+    if (device) {
+        x_push(R_AX); x_push(R_AX);
+    }
+    j_load(o, R_CX, o->operand);
+    if (device) {
+        x_pop(R_AX); x_pop(R_AX);
+    }
+    x_or32(R_AX, R_CX);
+    j_exit_ax(o->cycles, o->count);
+}
+
+static inline void j_jsr(jit_op *o) {
+    // Both pushes complete before leaving, even if they overwrite the block
+    uint16_t ret = o->next - 1;
+    x_movi8(R_CX, ret >> 8);
+    j_push(o, R_CX, false);
+    x_movi8(R_CX, ret & 0xFF);
+    j_push(o, R_CX, false);
+    j_exit(o->operand, o->cycles, o->count);
+}
+
+static inline void j_rts(jit_op *o) {
+    x_imm8(0, J_S, 2);
+    x_movzx(R_CX, J_S);
+    x_load8(R_AX, J_RAM, R_CX, 0x0100);
+    x_shift(32, 4, R_AX, 8);
+    x_load8(R_DX, J_RAM, R_CX, 0x00FF);
+    x_or32(R_AX, R_DX);
+    x_imm32(0, 0, R_AX, 1);
+    x_rr(0, 0x0FB7, R_AX, R_AX);
+    j_exit_ax(o->cycles, o->count);
+}
+
+static inline void j_rti(jit_op *o) {
+    x_rr(0, 0xFE, 0, J_S);
+    x_movzx(R_CX, J_S);
+    x_load8(R_AX, J_RAM, R_CX, 0x0100);
+    x_imm8(4, R_AX, 0xCF);
+    j_put_sr(R_AX);
+    x_load8(R_AX, J_RAM, R_CX, 0x0102);
+    x_shift(32, 4, R_AX, 8);
+    x_load8(R_DX, J_RAM, R_CX, 0x0101);
+    x_or32(R_AX, R_DX);
+    x_imm8(0, J_S, 2);
+    j_exit_ax(o->cycles, o->count);
+}
+
+static inline void j_nul(jit_op *o) {
+    // Undocumented opcodes: one byte, zero cycles, and the block ends
+    j_exit(o->next, o->cycles, o->count);
+}
+
+// BRK ends the emulation and is left to the interpreter
+#define j_brk NULL
+
+#define J_ENTRY(code, op, mode, bytes, cyc) [code] = j_##op,
+
+static const jit_emitter jit_emitters[256] = {
+    [0 ... 0xFF] = j_nul,
+    OPCODES(J_ENTRY)
+};
+
+static inline void jit_stubs(cpu *c) {
+    jit *j = c->jit;
+    jit_ptr = j->code;
+
+    // uint64_t enter(jit_state *st, void *native)
+    j->enter = (jit_entry)jit_ptr;
+    x_push(R_BX); x_push(R_BP); x_push(R_12); x_push(R_13); x_push(R_14); x_push(R_15);
+    x_push(R_DI);
+    x_load8(J_A, R_DI, -1, offsetof(jit_state, ac));
+    x_load8(J_X, R_DI, -1, offsetof(jit_state, xr));
+    x_load8(J_Y, R_DI, -1, offsetof(jit_state, yr));
+    x_load8(J_S, R_DI, -1, offsetof(jit_state, sp));
+    x_load8(R_AX, R_DI, -1, offsetof(jit_state, sr));
+    j_put_sr(R_AX);
+    x_movi64(J_RAM, (uint64_t)c->ram);
+    x_rr(0, 0x31, J_CYC, J_CYC);
+    x_rr(0, 0x31, J_CNT, J_CNT);
+    x_rr(0, 0xFF, 4, R_SI);
+
+    // Next block: chained when translated, while the budget lasts and nothing is pending
+    j->dispatch = jit_ptr;
+    x_rm(1, 0x8B, R_AX, R_SP, -1, 0, 0);
+    x_rm(1, 0x3B, J_CYC, R_AX, -1, 0, offsetof(jit_state, budget));
+    uint8_t *out1 = x_jcc(CC_AE);
+    x_movi64(R_AX, (uint64_t)&c->pending);
+    x_rm(0, 0x83, 7, R_AX, -1, 0, 0);
+    emit8(0);
+    uint8_t *out2 = x_jcc(CC_NE);
+    #if SAMPLING
+    // The pc half of c->where, run_blocks() set the other to SAMPLE_NATIVE; rax points at c->pending
+    emit8(0x66);
+    x_rm(0, 0x89, R_SI, R_AX, -1, 0, offsetof(cpu, where) - offsetof(cpu, pending));
+    #endif
+    x_movi64(R_AX, (uint64_t)c->blocks->at);
+    x_rm(1, 0x8B, R_AX, R_AX, R_SI, 3, 0);
+    x_rr(1, 0x85, R_AX, R_AX);
+    uint8_t *out3 = x_jcc(CC_E);
+    x_rm(1, 0x8B, R_AX, R_AX, -1, 0, offsetof(block, native));
+    x_rr(1, 0x85, R_AX, R_AX);
+    uint8_t *out4 = x_jcc(CC_E);
+    x_rr(0, 0xFF, 4, R_AX);
+
+    x_patch(out1, jit_ptr);
+    x_patch(out2, jit_ptr);
+    x_patch(out3, jit_ptr);
+    x_patch(out4, jit_ptr);
+    x_pop(R_DI);
+    x_store8(J_A, R_DI, -1, offsetof(jit_state, ac));
+    x_store8(J_X, R_DI, -1, offsetof(jit_state, xr));
+    x_store8(J_Y, R_DI, -1, offsetof(jit_state, yr));
+    x_store8(J_S, R_DI, -1, offsetof(jit_state, sp));
+    j_get_sr(R_AX, R_CX);
+    x_store8(R_AX, R_DI, -1, offsetof(jit_state, sr));
+    emit8(0x66);
+    x_rm(0, 0x89, R_SI, R_DI, -1, 0, offsetof(jit_state, pc));
+    x_rm(1, 0x89, J_CNT, R_DI, -1, 0, offsetof(jit_state, count));
+    x_rr(1, 0x89, J_CYC, R_AX);
+    x_pop(R_15); x_pop(R_14); x_pop(R_13); x_pop(R_12); x_pop(R_BP); x_pop(R_BX);
+    emit8(0xC3);
+
+    j->blocks = jit_ptr;
+    j->ptr = jit_ptr;
+}
+
+static inline void jit_reset(cpu *c) {
+    // Code buffer full: forget every translation, the blocks stay decoded
+    for (int i = 0; i < BLOCK_COUNT; i++) {
+        c->blocks->pool[i].native = NULL;
+        c->blocks->pool[i].hits = 0;
+    }
+    c->jit->ptr = c->jit->blocks;
+}
+
+static inline bool jit_create(cpu *c) {
+    // The code buffer is reserved here, its pages are only touched when used.
+    // Without one the cpu still runs, interpreted.
+    c->jit = calloc(1, sizeof(jit));
+    if (c->jit == NULL)
+        return false;
+    c->jit->code = mmap(NULL, JIT_CODE_SIZE, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (c->jit->code == MAP_FAILED) {
+        free(c->jit);
+        c->jit = NULL;
+        return false;
+    }
+    jit_stubs(c);
+    return true;
+}
+
+static inline void jit_destroy(cpu *c) {
+    if (c->jit == NULL)
+        return;
+    munmap(c->jit->code, JIT_CODE_SIZE);
+    free(c->jit);
+    c->jit = NULL;
+}
+
+static inline bool jit_compile(cpu *c, block *b) {
+    // Translates b, returns false when its first instruction is not supported
+    if (c->jit == NULL || jit_emitters[b->uops[0].opcode] == NULL)
+        return false;
+    if (c->jit->ptr + JIT_BLOCK_MAX > c->jit->code + JIT_CODE_SIZE)
+        jit_reset(c);
+
+    jit_cpu = c;
+    jit_ptr = c->jit->ptr;
+    jit_dispatch = c->jit->dispatch;
+    uint8_t *native = jit_ptr;
+    jit_op o = {b, 0, 0, b->start, 0, 0, 0, -1};
+    for (int i = 0; i < b->count; i++) {
+        uop *u = &b->uops[i];
+        jit_emitter emit = jit_emitters[u->opcode];
+        if (emit == NULL)
+            break;
+        instruction in = instructions[u->opcode];
+        o.mode = in.mode;
+        o.operand = u->operand;
+        o.next += in.bytes ? in.bytes : 1;
+        o.at = o.cycles;
+        o.cycles += in.cycles;
+        o.count++;
+        emit(&o);
+        if (block_ends(u->opcode))
+            goto done;
+    }
+    // Ran out of uops or stopped before an unsupported one
+    j_exit(o.next, o.cycles, o.count);
+
+done:
+    c->jit->ptr = jit_ptr;
+    b->native = native;
+    return true;
+}
+
+#undef R_AX
+#undef R_CX
+#undef R_DX
+#undef R_BX
+#undef R_SP
+#undef R_BP
+#undef R_SI
+#undef R_DI
+#undef R_8
+#undef R_9
+#undef R_10
+#undef R_11
+#undef R_12
+#undef R_13
+#undef R_14
+#undef R_15
+#undef J_A
+#undef J_X
+#undef J_Y
+#undef J_S
+#undef J_P
+#undef J_N
+#undef J_Z
+#undef J_CYC
+#undef J_CNT
+#undef J_RAM
+#undef CC_B
+#undef CC_AE
+#undef CC_E
+#undef CC_NE
+#undef x_mov8
+#undef x_op8
+#undef x_movzx
+#undef x_mov32
+#undef x_or32
+#undef x_add64
+#undef x_load8
+#undef x_load16
+#undef x_store8
+#undef j_brk
+#undef J_ENTRY
+
+#endif
@@ -0,0 +1,333 @@
+#ifndef LOCKSTEP_H
+#define LOCKSTEP_H
+
+#include "dom6502.h"
+#include "opcodes.h"
+
+/*  Lockstep batch engine: the same program on up to 32 CPUs that differ only
+    in their inputs, stored as structure of arrays.
+
+    Every register is an array with one lane per CPU, and memory is
+    interleaved by address, mem[addr][lane], so that a zero page or absolute
+    operand is one contiguous vector for all lanes. An instruction is
+    decoded once for the lanes that share its pc, and its semantics (the
+    EA_, OP_, LD_ and ST_ macros of opcodes.h, as in every engine) run in a
+    loop over the lanes. When all lanes are together the loop has no
+    conditions and is vectorized; lockstep_step() is built for AVX2 and for
+    baseline x86-64, picked at load time, and with 32 lanes the choice of
+    lanes for each step uses AVX2 when the host has it.
+
+    Lanes split at branches. Each step runs the lanes with the lowest pc,
+    one by one when they are not all of them, so the ones that skipped
+    ahead wait for the others and the lanes join again at the first common
+    pc; loops that run more often in some lanes keep only those lanes
+    going. Lanes whose instruction bytes differ from the first lane at that
+    pc (self modifying code, inputs in code) are left for a later step.
+
+    There are no interrupts, no traces and no bus: every page is RAM. Results, cycles included, are
+    those of the scalar engines.  */
+
+#ifndef LOCKSTEP_LANES
+#define LOCKSTEP_LANES 32
+#endif
+#if LOCKSTEP_LANES < 1 || LOCKSTEP_LANES > 32
+#error "LOCKSTEP_LANES must be between 1 and 32"
+#endif
+#define LOCKSTEP_ALL ((uint32_t)(((uint64_t)1 << LOCKSTEP_LANES) - 1))
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#define LOCKSTEP_TARGETS __attribute__((target_clones("avx2", "default")))
+#define LOCKSTEP_AVX2 (LOCKSTEP_LANES == 32)    // lane selection in AVX2, see lockstep_low()
+#else
+#define LOCKSTEP_TARGETS
+#define LOCKSTEP_AVX2 0
+#endif
+
+typedef struct lockstep {
+    _Alignas(32) uint8_t ac[LOCKSTEP_LANES];
+    _Alignas(32) uint8_t xr[LOCKSTEP_LANES];
+    _Alignas(32) uint8_t yr[LOCKSTEP_LANES];
+    _Alignas(32) uint8_t sp[LOCKSTEP_LANES];
+    _Alignas(32) uint8_t sr[LOCKSTEP_LANES];
+    _Alignas(32) uint8_t fn[LOCKSTEP_LANES];    // lazy N and Z (LAZY_FLAGS only)
+    _Alignas(32) uint8_t fz[LOCKSTEP_LANES];
+    _Alignas(32) uint16_t pc[LOCKSTEP_LANES];
+    _Alignas(32) uint64_t cycles[LOCKSTEP_LANES];
+    _Alignas(32) uint64_t executed[LOCKSTEP_LANES];
+    uint32_t live;              // lanes still running
+    uint32_t halted;            // lanes stopped by BRK
+    uint64_t vector_steps;      // instructions run on all lanes at once
+    uint64_t lane_steps;        // instructions run lane by lane
+    _Alignas(32) uint8_t mem[65536][LOCKSTEP_LANES];
+} lockstep;
+
+#define AC ls->ac[l]
+#define XR ls->xr[l]
+#define YR ls->yr[l]
+#define SP ls->sp[l]
+#define SR ls->sr[l]
+#define PC ls->pc[l]
+#define RD(addr) ls->mem[addr][l]
+#define WR(addr, v) ls->mem[addr][l] = (v)
+#define RD_RAM(addr) RD(addr)
+#define WR_RAM(addr, v) WR(addr, v)
+#define OPB() ((uint8_t)operand)
+#define OPW() (operand)
+#define CYC ls->cycles[l]
+#define HALT() halt |= 1u << l
+#define FN ls->fn[l]
+#define FZ ls->fz[l]
+
+// ea, ld and st come pasted, see B_STEP in blocks.h
+#define L_LANE(op, ea, ld, st, bytes, cyc) { \
+        ea \
+        PC += bytes; \
+        CYC += cyc; \
+        OP_##op(ld, st) \
+    }
+
+#define L_CASE(code, op, mode, bytes, cyc) \
+    case code: \
+        if (mask == LOCKSTEP_ALL) { \
+            _Pragma("GCC ivdep") \
+            for (int l = 0; l < LOCKSTEP_LANES; l++) \
+                L_LANE(op, EA_##mode, LD_##mode, ST_##mode, bytes, cyc) \
+        } \
+        else { \
+            for (uint32_t m = mask; m != 0; m &= m - 1) { \
+                int l = __builtin_ctz(m); \
+                L_LANE(op, EA_##mode, LD_##mode, ST_##mode, bytes, cyc) \
+            } \
+        } \
+        break;
+
+LOCKSTEP_TARGETS
+static inline uint32_t lockstep_step(lockstep *ls, uint32_t mask, uint8_t opcode, uint16_t operand) {
+    // Runs one instruction on the lanes in mask, returns the lanes it halted
+    uint32_t halt = 0;
+    switch (opcode) {
+        OPCODES(L_CASE)
+        default:
+            // Undocumented opcodes: one byte, no cycles, as nul()
+            for (uint32_t m = mask; m != 0; m &= m - 1) {
+                int l = __builtin_ctz(m);
+                PC += 1;
+            }
+    }
+    return halt;
+}
+
+static inline void lockstep_reset(lockstep *ls, uint16_t pc) {
+    // Power on registers in every lane, all of them starting at pc; memory is kept
+    for (int l = 0; l < LOCKSTEP_LANES; l++) {
+        AC = XR = YR = 0;
+        SP = 0xFF;
+        SR = 0x32;
+        PC = pc;
+        ls->cycles[l] = 0;
+        ls->executed[l] = 0;
+    }
+    ls->live = LOCKSTEP_ALL;
+    ls->halted = 0;
+    ls->vector_steps = ls->lane_steps = 0;
+}
+
+static inline lockstep *lockstep_create() {
+    // All lanes with zeroed memory and power on registers, NULL when out of memory
+    lockstep *ls = aligned_alloc(64, sizeof(lockstep));
+    if (ls == NULL)
+        return NULL;
+    memset(ls, 0, sizeof(lockstep));
+    lockstep_reset(ls, 0);
+    return ls;
+}
+
+static inline void lockstep_load(lockstep *ls, uint16_t addr, const void *data, size_t size) {
+    // Copies the same bytes into every lane, wrapping at $FFFF
+    const uint8_t *bytes = data;
+    for (size_t i = 0; i < size; i++)
+        memset(ls->mem[(uint16_t)(addr + i)], bytes[i], LOCKSTEP_LANES);
+}
+
+static inline void lockstep_poke(lockstep *ls, int lane, uint16_t addr, uint8_t v) {
+    ls->mem[addr][lane] = v;
+}
+
+static inline uint8_t lockstep_peek(lockstep *ls, int lane, uint16_t addr) {
+    return ls->mem[addr][lane];
+}
+
+/*  Lane selection, once per step: the lanes still within budget, the lowest
+    pc among them, and the lanes at that pc holding the same instruction.
+    With 32 lanes and AVX2 each is a handful of vector compares and a
+    movemask; the generic versions are branch free loops, since lanes
+    differ at random.  */
+
+static inline uint32_t lockstep_budget(lockstep *ls, uint32_t live, uint64_t max_cycles) {
+    uint32_t in = 0;
+    for (int l = 0; l < LOCKSTEP_LANES; l++)
+        in |= (uint32_t)(ls->cycles[l] < max_cycles) << l;
+    return live & in;
+}
+
+static inline uint16_t lockstep_low(lockstep *ls, uint32_t live) {
+    uint32_t low = 0xFFFF;
+    for (int l = 0; l < LOCKSTEP_LANES; l++)
+        low = (((live >> l) & 1) && ls->pc[l] < low) ? ls->pc[l] : low;
+    return low;
+}
+
+static inline uint32_t lockstep_match(lockstep *ls, uint16_t pc, const uint8_t code[3], uint8_t bytes) {
+    const uint8_t *i0 = ls->mem[pc], *i1 = ls->mem[(uint16_t)(pc + 1)], *i2 = ls->mem[(uint16_t)(pc + 2)];
+    bool any1 = bytes < 2, any2 = bytes < 3;
+    uint32_t mask = 0;
+    for (int l = 0; l < LOCKSTEP_LANES; l++) {
+        bool same = (ls->pc[l] == pc) & (i0[l] == code[0]) & ((i1[l] == code[1]) | any1) & ((i2[l] == code[2]) | any2);
+        mask |= (uint32_t)same << l;
+    }
+    return mask;
+}
+
+#if LOCKSTEP_AVX2
+__attribute__((target("avx2")))
+static inline uint32_t lockstep_budget_avx2(lockstep *ls, uint32_t live, uint64_t max_cycles) {
+    // Unsigned compares through the sign bit, four lanes per vector
+    const __m256i sign = _mm256_set1_epi64x(INT64_MIN);
+    __m256i max = _mm256_xor_si256(_mm256_set1_epi64x(max_cycles), sign);
+    uint32_t in = 0;
+    for (int q = 0; q < 8; q++) {
+        __m256i c = _mm256_xor_si256(_mm256_load_si256((const __m256i *)&ls->cycles[q * 4]), sign);
+        in |= (uint32_t)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(max, c))) << (q * 4);
+    }
+    return live & in;
+}
+
+__attribute__((target("avx2")))
+static inline __m256i lockstep_lanes16(uint32_t bits) {
+    // 16 bits to 16 words of all ones or zeros
+    const __m256i one = _mm256_setr_epi16(1, 2, 4, 8, 16, 32, 64, 128,
+        256, 512, 1024, 2048, 4096, 8192, 16384, (short)32768);
+    return _mm256_cmpeq_epi16(_mm256_and_si256(_mm256_set1_epi16((short)bits), one), one);
+}
+
+__attribute__((target("avx2")))
+static inline uint16_t lockstep_low_avx2(lockstep *ls, uint32_t live) {
+    // Lanes not live count as $FFFF, the minimum comes from phminposuw
+    __m256i p0 = _mm256_load_si256((const __m256i *)&ls->pc[0]);
+    __m256i p1 = _mm256_load_si256((const __m256i *)&ls->pc[16]);
+    p0 = _mm256_or_si256(p0, _mm256_andnot_si256(lockstep_lanes16(live), _mm256_set1_epi16(-1)));
+    p1 = _mm256_or_si256(p1, _mm256_andnot_si256(lockstep_lanes16(live >> 16), _mm256_set1_epi16(-1)));
+    __m256i m = _mm256_min_epu16(p0, p1);
+    __m128i h = _mm_min_epu16(_mm256_castsi256_si128(m), _mm256_extracti128_si256(m, 1));
+    return _mm_extract_epi16(_mm_minpos_epu16(h), 0);
+}
+
+__attribute__((target("avx2")))
+static inline uint32_t lockstep_match_avx2(lockstep *ls, uint16_t pc, const uint8_t code[3], uint8_t bytes) {
+    __m256i p = _mm256_set1_epi16(pc);
+    __m256i e0 = _mm256_cmpeq_epi16(_mm256_load_si256((const __m256i *)&ls->pc[0]), p);
+    __m256i e1 = _mm256_cmpeq_epi16(_mm256_load_si256((const __m256i *)&ls->pc[16]), p);
+    // packs interleaves the 128 bit halves, the permute puts the lanes back in order
+    __m256i at = _mm256_permute4x64_epi64(_mm256_packs_epi16(e0, e1), 0xD8);
+    __m256i same = _mm256_cmpeq_epi8(_mm256_load_si256((const __m256i *)ls->mem[pc]), _mm256_set1_epi8(code[0]));
+    if (bytes >= 2)
+        same = _mm256_and_si256(same, _mm256_cmpeq_epi8(_mm256_load_si256((const __m256i *)ls->mem[(uint16_t)(pc + 1)]), _mm256_set1_epi8(code[1])));
+    if (bytes >= 3)
+        same = _mm256_and_si256(same, _mm256_cmpeq_epi8(_mm256_load_si256((const __m256i *)ls->mem[(uint16_t)(pc + 2)]), _mm256_set1_epi8(code[2])));
+    return _mm256_movemask_epi8(_mm256_and_si256(at, same));
+}
+#endif
+
+static inline uint64_t lockstep_run(lockstep *ls, uint64_t max_cycles) {
+    /*  Runs every live lane until BRK or until it has spent max_cycles (the
+        instruction that crosses it completes). Lanes stopped by the budget
+        stay live, a later call with a larger one resumes them. Returns the
+        number of steps, each one an instruction run on one or more lanes.  */
+    #if LOCKSTEP_AVX2
+    bool avx2 = __builtin_cpu_supports("avx2");
+    #define L_SELECT(f, ...) (avx2 ? f##_avx2(__VA_ARGS__) : f(__VA_ARGS__))
+    #else
+    #define L_SELECT(f, ...) f(__VA_ARGS__)
+    #endif
+    uint64_t steps = 0, together = 0;
+    for (int l = 0; l < LOCKSTEP_LANES; l++)
+        PUT_SR(SR);
+
+    while (true) {
+        uint32_t live = ls->live;
+        if (max_cycles != UINT64_MAX)
+            live = L_SELECT(lockstep_budget, ls, live, max_cycles);
+        if (live == 0)
+            break;
+
+        // The first lane at the lowest pc leads, the others follow if they hold the same bytes
+        uint16_t pc = L_SELECT(lockstep_low, ls, live);
+        int lead = 0;
+        while (!((live >> lead) & 1) || ls->pc[lead] != pc)
+            lead++;
+        uint8_t code[3] = {ls->mem[pc][lead], ls->mem[(uint16_t)(pc + 1)][lead], ls->mem[(uint16_t)(pc + 2)][lead]};
+        uint8_t bytes = instructions[code[0]].bytes;
+        uint32_t mask = live & L_SELECT(lockstep_match, ls, pc, code, bytes);
+
+        uint16_t operand = (bytes == 3) ? (code[2] << 8) | code[1] : (bytes == 2) ? code[1] : 0;
+        uint32_t halt = lockstep_step(ls, mask, code[0], operand);
+        ls->live &= ~halt;
+        ls->halted |= halt;
+        if (mask == LOCKSTEP_ALL) {
+            together++;
+        }
+        else {
+            for (uint32_t m = mask; m != 0; m &= m - 1)
+                ls->executed[__builtin_ctz(m)]++;
+            ls->lane_steps++;
+        }
+        steps++;
+    }
+
+    for (int l = 0; l < LOCKSTEP_LANES; l++) {
+        ls->executed[l] += together;
+        SR = GET_SR();
+    }
+    ls->vector_steps += together;
+    return steps;
+    #undef L_SELECT
+}
+
+static inline void lockstep_lane(lockstep *ls, int l, cpu *c) {
+    // Copies one lane into a cpu, to compare it with a scalar run or to go on there
+    c->ac = AC; c->xr = XR; c->yr = YR; c->sp = SP; c->sr = SR;
+    c->pc = PC;
+    c->halted = (ls->halted >> l) & 1;
+    c->executed = ls->executed[l];
+    for (int a = 0; a < 65536; a++)
+        c->ram[a] = ls->mem[a][l];
+    code_changed(c);
+}
+
+static inline void lockstep_destroy(lockstep *ls) {
+    free(ls);
+}
+
+#undef AC
+#undef XR
+#undef YR
+#undef SP
+#undef SR
+#undef PC
+#undef RD
+#undef WR
+#undef RD_RAM
+#undef WR_RAM
+#undef OPB
+#undef OPW
+#undef CYC
+#undef HALT
+#undef FN
+#undef FZ
+#undef L_LANE
+#undef L_CASE
+#undef LOCKSTEP_TARGETS
+#undef LOCKSTEP_AVX2
+
+#endif
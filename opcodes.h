@@ -0,0 +1,539 @@
+#ifndef OPCODES_H
+#define OPCODES_H
+
+/*  Declarative description of the 151 documented opcodes and of their
+    semantics, shared by the execution engines.
+
+    OPCODES(X) expands X(opcode, operation, mode, bytes, cycles) once per
+    opcode. The operation bodies below do not touch CPU state directly: every
+    engine binds the following names before expanding them, so the same
+    semantics can run on globals or on registers held in locals.
+
+        AC, XR, YR, SP, SR, PC   registers (lvalues)
+        RD(addr), WR(addr, v)    memory access through the bus (bus.h)
+        RD_RAM(addr), WR_RAM(addr, v)
+                                 zero page and stack access, always RAM
+        OPB(), OPW()             operand byte / word of the current instruction
+        CYC                      cycle counter, for page crossing penalties
+        c                        the cpu, for its pending word (interrupts)
+        HALT()                   stop request (BRK)
+        FN, FZ                   lazy N and Z sources (LAZY_FLAGS only)
+
+    EA_<mode> computes the effective address `ea` (or fetches the immediate
+    operand) before PC is advanced, LD_<mode> and ST_<mode> read and write
+    the operand it designates.  */
+
+#define OPCODES(X) \
+    X(0x00, brk, IMP, 1, 7) \
+    X(0x01, ora, INX, 2, 6) \
+    X(0x05, ora, ZP_, 2, 3) \
+    X(0x06, asl, ZP_, 2, 5) \
+    X(0x08, php, IMP, 1, 3) \
+    X(0x09, ora, IMM, 2, 2) \
+    X(0x0A, asl, ACC, 1, 2) \
+    X(0x0D, ora, AB_, 3, 4) \
+    X(0x0E, asl, AB_, 3, 6) \
+    X(0x10, bpl, REL, 2, 2) \
+    X(0x11, ora, INY, 2, 5) \
+    X(0x15, ora, ZPX, 2, 4) \
+    X(0x16, asl, ZPX, 2, 6) \
+    X(0x18, clc, IMP, 1, 2) \
+    X(0x19, ora, ABY, 3, 4) \
+    X(0x1D, ora, ABX, 3, 4) \
+    X(0x1E, asl, ABX, 3, 7) \
+    X(0x20, jsr, AB_, 3, 6) \
+    X(0x21, and, INX, 2, 6) \
+    X(0x24, bit, ZP_, 2, 3) \
+    X(0x25, and, ZP_, 2, 3) \
+    X(0x26, rol, ZP_, 2, 5) \
+    X(0x28, plp, IMP, 1, 4) \
+    X(0x29, and, IMM, 2, 2) \
+    X(0x2A, rol, ACC, 1, 2) \
+    X(0x2C, bit, AB_, 3, 4) \
+    X(0x2D, and, AB_, 3, 4) \
+    X(0x2E, rol, AB_, 3, 6) \
+    X(0x30, bmi, REL, 2, 2) \
+    X(0x31, and, INY, 2, 5) \
+    X(0x35, and, ZPX, 2, 4) \
+    X(0x36, rol, ZPX, 2, 6) \
+    X(0x38, sec, IMP, 1, 2) \
+    X(0x39, and, ABY, 3, 4) \
+    X(0x3D, and, ABX, 3, 4) \
+    X(0x3E, rol, ABX, 3, 7) \
+    X(0x40, rti, IMP, 1, 6) \
+    X(0x41, eor, INX, 2, 6) \
+    X(0x45, eor, ZP_, 2, 3) \
+    X(0x46, lsr, ZP_, 2, 5) \
+    X(0x48, pha, IMP, 1, 3) \
+    X(0x49, eor, IMM, 2, 2) \
+    X(0x4A, lsr, ACC, 1, 2) \
+    X(0x4C, jmp, AB_, 3, 3) \
+    X(0x4D, eor, AB_, 3, 4) \
+    X(0x4E, lsr, AB_, 3, 6) \
+    X(0x50, bvc, REL, 2, 2) \
+    X(0x51, eor, INY, 2, 5) \
+    X(0x55, eor, ZPX, 2, 4) \
+    X(0x56, lsr, ZPX, 2, 6) \
+    X(0x58, cli, IMP, 1, 2) \
+    X(0x59, eor, ABY, 3, 4) \
+    X(0x5D, eor, ABX, 3, 4) \
+    X(0x5E, lsr, ABX, 3, 7) \
+    X(0x60, rts, IMP, 1, 6) \
+    X(0x61, adc, INX, 2, 6) \
+    X(0x65, adc, ZP_, 2, 3) \
+    X(0x66, ror, ZP_, 2, 5) \
+    X(0x68, pla, IMP, 1, 4) \
+    X(0x69, adc, IMM, 2, 2) \
+    X(0x6A, ror, ACC, 1, 2) \
+    X(0x6C, jmp, IN_, 3, 5) \
+    X(0x6D, adc, AB_, 3, 4) \
+    X(0x6E, ror, AB_, 3, 6) \
+    X(0x70, bvs, REL, 2, 2) \
+    X(0x71, adc, INY, 2, 5) \
+    X(0x75, adc, ZPX, 2, 4) \
+    X(0x76, ror, ZPX, 2, 6) \
+    X(0x78, sei, IMP, 1, 2) \
+    X(0x79, adc, ABY, 3, 4) \
+    X(0x7D, adc, ABX, 3, 4) \
+    X(0x7E, ror, ABX, 3, 7) \
+    X(0x81, sta, INX, 2, 6) \
+    X(0x84, sty, ZP_, 2, 3) \
+    X(0x85, sta, ZP_, 2, 3) \
+    X(0x86, stx, ZP_, 2, 3) \
+    X(0x88, dey, IMP, 1, 2) \
+    X(0x8A, txa, IMP, 1, 2) \
+    X(0x8C, sty, AB_, 3, 4) \
+    X(0x8D, sta, AB_, 3, 4) \
+    X(0x8E, stx, AB_, 3, 4) \
+    X(0x90, bcc, REL, 2, 2) \
+    X(0x91, sta, INY, 2, 6) \
+    X(0x94, sty, ZPX, 2, 4) \
+    X(0x95, sta, ZPX, 2, 4) \
+    X(0x96, stx, ZPY, 2, 4) \
+    X(0x98, tya, IMP, 1, 2) \
+    X(0x99, sta, ABY, 3, 5) \
+    X(0x9A, txs, IMP, 1, 2) \
+    X(0x9D, sta, ABX, 3, 5) \
+    X(0xA0, ldy, IMM, 2, 2) \
+    X(0xA1, lda, INX, 2, 6) \
+    X(0xA2, ldx, IMM, 2, 2) \
+    X(0xA4, ldy, ZP_, 2, 3) \
+    X(0xA5, lda, ZP_, 2, 3) \
+    X(0xA6, ldx, ZP_, 2, 3) \
+    X(0xA8, tay, IMP, 1, 2) \
+    X(0xA9, lda, IMM, 2, 2) \
+    X(0xAA, tax, IMP, 1, 2) \
+    X(0xAC, ldy, AB_, 3, 4) \
+    X(0xAD, lda, AB_, 3, 4) \
+    X(0xAE, ldx, AB_, 3, 4) \
+    X(0xB0, bcs, REL, 2, 2) \
+    X(0xB1, lda, INY, 2, 5) \
+    X(0xB4, ldy, ZPX, 2, 4) \
+    X(0xB5, lda, ZPX, 2, 4) \
+    X(0xB6, ldx, ZPY, 2, 4) \
+    X(0xB8, clv, IMP, 1, 2) \
+    X(0xB9, lda, ABY, 3, 4) \
+    X(0xBA, tsx, IMP, 1, 2) \
+    X(0xBC, ldy, ABX, 3, 4) \
+    X(0xBD, lda, ABX, 3, 4) \
+    X(0xBE, ldx, ABY, 3, 4) \
+    X(0xC0, cpy, IMM, 2, 2) \
+    X(0xC1, cmp, INX, 2, 6) \
+    X(0xC4, cpy, ZP_, 2, 3) \
+    X(0xC5, cmp, ZP_, 2, 3) \
+    X(0xC6, dec, ZP_, 2, 5) \
+    X(0xC8, iny, IMP, 1, 2) \
+    X(0xC9, cmp, IMM, 2, 2) \
+    X(0xCA, dex, IMP, 1, 2) \
+    X(0xCC, cpy, AB_, 3, 4) \
+    X(0xCD, cmp, AB_, 3, 4) \
+    X(0xCE, dec, AB_, 3, 6) \
+    X(0xD0, bne, REL, 2, 2) \
+    X(0xD1, cmp, INY, 2, 5) \
+    X(0xD5, cmp, ZPX, 2, 4) \
+    X(0xD6, dec, ZPX, 2, 6) \
+    X(0xD8, cld, IMP, 1, 2) \
+    X(0xD9, cmp, ABY, 3, 4) \
+    X(0xDD, cmp, ABX, 3, 4) \
+    X(0xDE, dec, ABX, 3, 7) \
+    X(0xE0, cpx, IMM, 2, 2) \
+    X(0xE1, sbc, INX, 2, 6) \
+    X(0xE4, cpx, ZP_, 2, 3) \
+    X(0xE5, sbc, ZP_, 2, 3) \
+    X(0xE6, inc, ZP_, 2, 5) \
+    X(0xE8, inx, IMP, 1, 2) \
+    X(0xE9, sbc, IMM, 2, 2) \
+    X(0xEA, nop, IMP, 1, 2) \
+    X(0xEC, cpx, AB_, 3, 4) \
+    X(0xED, sbc, AB_, 3, 4) \
+    X(0xEE, inc, AB_, 3, 6) \
+    X(0xF0, beq, REL, 2, 2) \
+    X(0xF1, sbc, INY, 2, 5) \
+    X(0xF5, sbc, ZPX, 2, 4) \
+    X(0xF6, inc, ZPX, 2, 6) \
+    X(0xF8, sed, IMP, 1, 2) \
+    X(0xF9, sbc, ABY, 3, 4) \
+    X(0xFD, sbc, ABX, 3, 4) \
+    X(0xFE, inc, ABX, 3, 7)
+
+#define EA_IMP
+#define EA_ACC
+
+/*  Immediate addressing:
+    the operand is contained in the second byte of the instruction.  */
+#define EA_IMM uint8_t imm = OPB();
+
+/*  Relative addressing:
+    the second byte of the instruction becomes the operand which is an "Offset"
+    added to the contents of the lower eight bits of the program counter when
+    the counter is set at the next instruction. See BRANCH().  */
+#define EA_REL int8_t rel = OPB();
+
+/*  Zero Page addressing:
+    allows shorter code by only fetching the second byte of the instruction
+    and assuming a zero high address byte.  */
+#define EA_ZP_ uint16_t ea = OPB();
+
+/*  Zero Page Indexed addressing, X / Y:
+    the effective address is calculated by adding the second byte to
+    the content of the index register. The content of second byte reference
+    a location in page zero.  */
+#define EA_ZPX uint16_t ea = OPB() + XR;
+#define EA_ZPY uint16_t ea = OPB() + YR;
+
+/*  Absolute addressing:
+    the second byte of the instruction specifies the eight low-order bits
+    of the effective address, while the third byte specifies the eight
+    high-order bits.  */
+#define EA_AB_ uint16_t ea = OPW();
+
+/*  Absolute Indexed addressing, X / Y:
+    the effective address is formed by adding the contents of the index
+    register to the address contained in the second and third bytes of the
+    instruction. One extra cycle when the page is crossed.  */
+#define EA_ABX uint16_t base = OPW(); uint16_t ea = base + XR; if ((ea >> 8) != (base >> 8)) CYC++;
+#define EA_ABY uint16_t base = OPW(); uint16_t ea = base + YR; if ((ea >> 8) != (base >> 8)) CYC++;
+
+/*  Absolute Indirect addressing (jmp only):
+    the second and third bytes of the instruction point to a memory location
+    whose contents is the low-order byte of the effective address. The next
+    memory location contains the high-order byte.  */
+#define EA_IN_ uint16_t ptr = OPW(); uint16_t ea = (RD(ptr + 1) << 8) | RD(ptr);
+
+/*  Zero Page Indexed Indirect addressing (Indirect X):
+    the second byte of the instruction is added to the contents of the X
+    register; the carry is discarded. The result of this addition points to
+    a memory location on page zero whose contents is the low-order eight bits
+    of the effective address. The next location in page zero contains the eight
+    high-order bits of the effective address.  */
+#define EA_INX uint8_t zp = OPB() + XR; uint16_t ea = (RD_RAM(zp + 1) << 8) | RD_RAM(zp);
+
+/*  Indirect Indexed addressing (Indirect Y):
+    the second byte of the instruction points to a memory location in page zero.
+    The contents of this memory location are added to the contents of Y, the
+    result being the low-order eight bits of the effective address.
+    The carry from this location is added to the contents of the next page zero
+    memory location, the result being the high order eight bits of the effective
+    address.  */
+#define EA_INY \
+    uint8_t zp = OPB(); \
+    uint16_t base = (RD_RAM(zp + 1) << 8) | RD_RAM(zp); \
+    uint16_t ea = base + YR; \
+    if ((ea >> 8) != (base >> 8)) CYC++;
+
+#define LD_ACC AC
+#define LD_IMM imm
+#define LD_ZP_ RD_RAM(ea)
+#define LD_ZPX RD_RAM(ea)
+#define LD_ZPY RD_RAM(ea)
+#define LD_AB_ RD(ea)
+#define LD_ABX RD(ea)
+#define LD_ABY RD(ea)
+#define LD_INX RD(ea)
+#define LD_INY RD(ea)
+
+#define ST_ACC(v) AC = (v)
+#define ST_ZP_(v) WR_RAM(ea, v)
+#define ST_ZPX(v) WR_RAM(ea, v)
+#define ST_ZPY(v) WR_RAM(ea, v)
+#define ST_AB_(v) WR(ea, v)
+#define ST_ABX(v) WR(ea, v)
+#define ST_ABY(v) WR(ea, v)
+#define ST_INX(v) WR(ea, v)
+#define ST_INY(v) WR(ea, v)
+
+// The effective address as the traces record it (DEBUG), 0 for the modes without one
+#define TRACE_EA_IMP 0
+#define TRACE_EA_ACC 0
+#define TRACE_EA_IMM 0
+#define TRACE_EA_REL 0
+#define TRACE_EA_ZP_ ea
+#define TRACE_EA_ZPX ea
+#define TRACE_EA_ZPY ea
+#define TRACE_EA_AB_ ea
+#define TRACE_EA_ABX ea
+#define TRACE_EA_ABY ea
+#define TRACE_EA_IN_ ea
+#define TRACE_EA_INX ea
+#define TRACE_EA_INY ea
+
+#define SET_FLAG(f, cond) SR = (SR & ~(f)) | ((cond) ? (f) : 0)
+
+/*  Lazy flags: N and Z are overwritten far more often than they are read, so
+    instead of updating SR the instructions only keep the values N and Z come
+    from: FN holds N in bit 7, FZ is zero when Z is set. The N and Z bits of SR
+    are stale and only GET_SR() builds the real status byte, for PHP, IRQ
+    pushes, traces and when an engine hands the registers back. PUT_SR() loads
+    a full status byte into both representations.  */
+#if LAZY_FLAGS
+#define SET_NZ(v) FN = FZ = (v)
+#define FLAG_N() (FN & S_NEGATIVE)
+#define FLAG_Z() (FZ == 0)
+#define GET_SR() ((SR & ~(S_NEGATIVE | S_ZERO)) | (FN & S_NEGATIVE) | (FZ ? 0 : S_ZERO))
+#define PUT_SR(v) { SR = (v); FN = SR; FZ = ~SR & S_ZERO; }
+#else
+#define SET_NZ(v) SR = (SR & ~(S_NEGATIVE | S_ZERO)) | ((v) & S_NEGATIVE) | ((v) ? 0 : S_ZERO)
+#define FLAG_N() (SR & S_NEGATIVE)
+#define FLAG_Z() (SR & S_ZERO)
+#define GET_SR() (SR)
+#define PUT_SR(v) { SR = (v); }
+#endif
+
+#define PUSH(v) { WR_RAM(0x0100 + SP, v); SP--; }
+
+/*  Interrupt entry, BRK without its padding byte: pc and status (B clear)
+    pushed, further IRQs masked, 7 cycles. TAKE_INTERRUPT starts the one
+    the pending word p (dom6502.h) asks for at an instruction boundary, if
+    any; the NMI edge is consumed, the IRQ level stays with its device.  */
+#define INTERRUPT(vector) { \
+        PUSH(PC >> 8); \
+        PUSH(PC & 0x00FF); \
+        PUSH(GET_SR() & ~0x10); \
+        SR |= S_INT_DIS; \
+        PC = (RD((vector) + 1) << 8) | RD(vector); \
+        CYC += 7; \
+    }
+
+#define TAKE_INTERRUPT(p) \
+    if ((p) & PEND_NMI) { \
+        atomic_fetch_and_explicit(&c->pending, ~PEND_NMI, memory_order_relaxed); \
+        INTERRUPT(0xFFFA) \
+    } \
+    else if (((p) & PEND_IRQ) && (SR & S_INT_DIS) == 0) \
+        INTERRUPT(0xFFFE)
+
+/*  Relative addressing: PC already points to the next instruction, `rel` is
+    the offset. One extra cycle when taken, two when crossing a page.  */
+#define BRANCH(cond) \
+    if (cond) { \
+        uint16_t target = PC + rel; \
+        CYC += 1 + ((target >> 8) != (PC >> 8)); \
+        PC = target; \
+    }
+
+static inline uint16_t alu_adc(uint8_t a, uint8_t m, uint8_t s) {
+    /*  Returns the new accumulator in the low byte and the new status in the
+        high byte. Decimal mode follows the undocumented NMOS behaviour:
+        http://www.6502.org/tutorials/decimal_mode.html  */
+    uint8_t carry = s & S_CARRY;
+    uint16_t binary = a + m + carry;
+
+    if (s & S_DECIMAL) {
+        s = (s & ~S_ZERO) | (((uint8_t)binary == 0) ? S_ZERO : 0);
+
+        uint8_t t = (a & 0x0F) + (m & 0x0F) + carry;
+        if (t >= 0x0A)
+            t = ((t + 0x06) & 0x0F) + 0x10;
+        uint16_t r = (a & 0xF0) + (m & 0xF0) + t;
+        if (r >= 0xA0)
+            r += 0x60;
+        s = (s & ~S_CARRY) | ((r >= 0x100) ? S_CARRY : 0);
+
+        // N and V are taken from the intermediate result, before the high nibble fix
+        uint8_t n = (a & 0xF0) + (m & 0xF0) + t;
+        s = (s & ~(S_NEGATIVE | S_OVERFLOW)) | ((n & 0x80) ? (S_NEGATIVE | S_OVERFLOW) : 0);
+
+        return ((uint16_t)s << 8) | (uint8_t)r;
+    }
+
+    uint8_t r = binary;
+    // positive + positive = negative OR negative + negative = positive
+    bool overflow = (~(a ^ m) & (a ^ r)) & 0x80;
+
+    s &= ~(S_NEGATIVE | S_OVERFLOW | S_ZERO | S_CARRY);
+    s |= (r & S_NEGATIVE) | (overflow ? S_OVERFLOW : 0) | (r ? 0 : S_ZERO) | ((binary > 0xFF) ? S_CARRY : 0);
+    return ((uint16_t)s << 8) | r;
+}
+
+static inline uint16_t alu_sbc(uint8_t a, uint8_t m, uint8_t s) {
+    // Same return convention as alu_adc; flags always come from the binary result
+    uint8_t borrow = !(s & S_CARRY);
+    int16_t binary = (int8_t)a - (int8_t)m - borrow;
+    uint8_t r = (uint8_t)binary;
+
+    s &= ~(S_NEGATIVE | S_OVERFLOW | S_ZERO | S_CARRY);
+    s |= ((r < 0x80) ? S_CARRY : 0) |
+         ((binary < -128 || binary > 127) ? S_OVERFLOW : 0) |
+         (r & S_NEGATIVE) |
+         (r ? 0 : S_ZERO);
+
+    if (s & S_DECIMAL) {
+        int8_t t = (a & 0x0F) - (m & 0x0F) - borrow;
+        if (t < 0)
+            t = ((t - 0x06) & 0x0F) - 0x10;
+        int16_t d = (a & 0xF0) - (m & 0xF0) + t;
+        if (d < 0)
+            d -= 0x60;
+        r = (uint8_t)d;
+    }
+
+    return ((uint16_t)s << 8) | r;
+}
+
+#if ALU_TABLES
+/*  Table driven ADC/SBC: the result and the N, V, Z, C flags of alu_adc() and
+    alu_sbc() for every accumulator, operand, carry and decimal flag, built at
+    startup. 512 KB per operation, indexed by D, C, A, operand.  */
+#define ALU_FLAGS (S_NEGATIVE | S_OVERFLOW | S_ZERO | S_CARRY)
+#define ALU_INDEX(a, m, s) ((((s) & S_DECIMAL) << 14) | (((s) & S_CARRY) << 16) | ((a) << 8) | (m))
+
+static uint16_t adc_table[1 << 18];
+static uint16_t sbc_table[1 << 18];
+
+__attribute__((constructor)) static void alu_init(void) {
+    for (uint32_t i = 0; i < (1 << 18); i++) {
+        uint8_t a = i >> 8, m = i, s = ((i >> 14) & S_DECIMAL) | ((i >> 16) & S_CARRY);
+        uint16_t r = alu_adc(a, m, s);
+        adc_table[i] = (r & 0xFF) | (r & (ALU_FLAGS << 8));
+        r = alu_sbc(a, m, s);
+        sbc_table[i] = (r & 0xFF) | (r & (ALU_FLAGS << 8));
+    }
+}
+
+// Same contract as alu_adc() / alu_sbc()
+static inline uint16_t alu_lookup(const uint16_t *table, uint8_t a, uint8_t m, uint8_t s) {
+    uint16_t r = table[ALU_INDEX(a, m, s)];
+    return ((uint16_t)(s & ~ALU_FLAGS) << 8) | r;
+}
+
+#define ALU_ADC(a, m, s) alu_lookup(adc_table, a, m, s)
+#define ALU_SBC(a, m, s) alu_lookup(sbc_table, a, m, s)
+#else
+#define ALU_ADC alu_adc
+#define ALU_SBC alu_sbc
+#endif
+
+// Add with Carry
+#define OP_adc(ld, st) { uint16_t r = ALU_ADC(AC, ld, SR); AC = r; PUT_SR(r >> 8); }
+// Bitwise AND
+#define OP_and(ld, st) { AC &= (ld); SET_NZ(AC); }
+// Arithmetic Shift Left
+#define OP_asl(ld, st) { uint8_t v = ld; SET_FLAG(S_CARRY, v >> 7); v <<= 1; st(v); SET_NZ(v); }
+// Branch if Carry Clear
+#define OP_bcc(ld, st) BRANCH((SR & S_CARRY) == 0)
+// Branch if Carry Set
+#define OP_bcs(ld, st) BRANCH(SR & S_CARRY)
+// Branch if Equal
+#define OP_beq(ld, st) BRANCH(FLAG_Z())
+// Bit Test
+#define OP_bit(ld, st) { uint8_t v = AC & (ld); SET_NZ(v); SET_FLAG(S_OVERFLOW, v & 0x40); }
+// Branch if Minus
+#define OP_bmi(ld, st) BRANCH(FLAG_N())
+// Branch if Not Equal
+#define OP_bne(ld, st) BRANCH(!FLAG_Z())
+// Branch if Plus
+#define OP_bpl(ld, st) BRANCH(!FLAG_N())
+// Break (ends the emulation)
+#define OP_brk(ld, st) HALT();
+// Branch if Overflow Clear
+#define OP_bvc(ld, st) BRANCH((SR & S_OVERFLOW) == 0)
+// Branch if Overflow Set
+#define OP_bvs(ld, st) BRANCH(SR & S_OVERFLOW)
+// Clear Carry
+#define OP_clc(ld, st) SR &= ~S_CARRY;
+// Clear Decimal Mode
+#define OP_cld(ld, st) SR &= ~S_DECIMAL;
+// Clear Interrupt Disable
+#define OP_cli(ld, st) SR &= ~S_INT_DIS;
+// Clear Overflow
+#define OP_clv(ld, st) SR &= ~S_OVERFLOW;
+// Compare A
+#define OP_cmp(ld, st) { uint8_t m = ld; uint8_t v = AC - m; SET_NZ(v); SET_FLAG(S_CARRY, m <= AC); }
+// Compare X (carry from the sign of the 8 bit difference, as CPY)
+#define OP_cpx(ld, st) { uint8_t v = XR - (ld); SET_NZ(v); SET_FLAG(S_CARRY, (v & 0x80) == 0); }
+// Compare Y
+#define OP_cpy(ld, st) { uint8_t v = YR - (ld); SET_NZ(v); SET_FLAG(S_CARRY, (v & 0x80) == 0); }
+// Decrement Memory
+#define OP_dec(ld, st) { uint8_t v = (ld) - 1; st(v); SET_NZ(v); }
+// Decrement X
+#define OP_dex(ld, st) { XR--; SET_NZ(XR); }
+// Decrement Y
+#define OP_dey(ld, st) { YR--; SET_NZ(YR); }
+// Bitwise Exclusive OR
+#define OP_eor(ld, st) { AC ^= (ld); SET_NZ(AC); }
+// Increment Memory
+#define OP_inc(ld, st) { uint8_t v = (ld) + 1; st(v); SET_NZ(v); }
+// Increment X
+#define OP_inx(ld, st) { XR++; SET_NZ(XR); }
+// Increment Y
+#define OP_iny(ld, st) { YR++; SET_NZ(YR); }
+// Jump
+#define OP_jmp(ld, st) PC = ea;
+// Jump to Subroutine
+#define OP_jsr(ld, st) { PUSH((PC - 1) >> 8); PUSH((PC - 1) & 0xFF); PC = ea; }
+// Load A
+#define OP_lda(ld, st) { AC = ld; SET_NZ(AC); }
+// Load X
+#define OP_ldx(ld, st) { XR = ld; SET_NZ(XR); }
+// Load Y
+#define OP_ldy(ld, st) { YR = ld; SET_NZ(YR); }
+// Logical Shift Right
+#define OP_lsr(ld, st) { uint8_t v = ld; SET_FLAG(S_CARRY, v & 1); v >>= 1; st(v); SET_NZ(v); }
+// No Operation
+#define OP_nop(ld, st)
+// Bitwise OR
+#define OP_ora(ld, st) { AC |= (ld); SET_NZ(AC); }
+// Push A
+#define OP_pha(ld, st) PUSH(AC)
+// Push Processor Status
+#define OP_php(ld, st) PUSH(GET_SR())
+// Pull A
+#define OP_pla(ld, st) { SP++; AC = RD_RAM(0x0100 + SP); SET_NZ(AC); }
+// Pull Processor Status
+#define OP_plp(ld, st) { SP++; PUT_SR(RD_RAM(0x0100 + SP)); }
+// Rotate Left
+#define OP_rol(ld, st) { uint8_t v = ld; uint8_t cin = SR & S_CARRY; SET_FLAG(S_CARRY, v >> 7); v = (v << 1) | cin; st(v); SET_NZ(v); }
+// Rotate Right
+#define OP_ror(ld, st) { uint8_t v = ld; uint8_t cin = SR & S_CARRY; SET_FLAG(S_CARRY, v & 1); v = (v >> 1) | (cin << 7); st(v); SET_NZ(v); }
+// Return from Interrupt (the status comes from the current stack slot)
+#define OP_rti(ld, st) { SP++; PUT_SR(RD_RAM(0x0100 + SP) & 0xCF); PC = (RD_RAM(0x0100 + SP + 2) << 8) | RD_RAM(0x0100 + SP + 1); SP += 2; }
+// Return from Subroutine
+#define OP_rts(ld, st) { SP += 2; PC = ((RD_RAM(0x0100 + SP) << 8) | RD_RAM(0x0100 + SP - 1)) + 1; }
+// Subtract with Carry
+#define OP_sbc(ld, st) { uint16_t r = ALU_SBC(AC, ld, SR); AC = r; PUT_SR(r >> 8); }
+// Set Carry
+#define OP_sec(ld, st) SR |= S_CARRY;
+// Set Decimal Mode
+#define OP_sed(ld, st) SR |= S_DECIMAL;
+// Set Interrupt Disable
+#define OP_sei(ld, st) SR |= S_INT_DIS;
+// Store A
+#define OP_sta(ld, st) st(AC);
+// Store X
+#define OP_stx(ld, st) st(XR);
+// Store Y
+#define OP_sty(ld, st) st(YR);
+// Transfer A to X
+#define OP_tax(ld, st) { XR = AC; SET_NZ(XR); }
+// Transfer A to Y
+#define OP_tay(ld, st) { YR = AC; SET_NZ(YR); }
+// Transfer Stack Pointer to X
+#define OP_tsx(ld, st) { XR = SP; SET_NZ(XR); }
+// Transfer X to A
+#define OP_txa(ld, st) { AC = XR; SET_NZ(AC); }
+// Transfer X to Stack Pointer
+#define OP_txs(ld, st) SP = XR;
+// Transfer Y to A
+#define OP_tya(ld, st) { AC = YR; SET_NZ(AC); }
+
+#endif
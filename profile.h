@@ -0,0 +1,286 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*  Exact profile of an emulated program: executions and cycles of every
+    address in flat arrays, and where the cycles went by subroutine.
+
+    profile_step() sees each instruction after it ran. JSR and the
+    interrupt sequence push a frame on a shadow call stack, RTS and RTI
+    pop it. A frame remembers the stack pointer the call left behind, so
+    a return only pops the frame it matches; frames whose return address
+    the program dropped (PLA PLA, or TXS) are popped when a return from
+    further out goes past them, and an RTS used as a computed jump (the
+    address pushed by hand) pops nothing.
+
+    Per routine, by entry address: calls, exclusive cycles (spent in the
+    routine itself) and inclusive cycles (including the routines it
+    called; for a recursive routine only the outermost call counts). The
+    stacks are kept as a call tree, one node per distinct path, with the
+    exclusive cycles of each; profile_folded() writes it in the folded
+    format of flamegraph.pl, one line per path.
+
+    Names come from a disassembly listing (profile_labels()), lines like
+
+        EAA0:	RESET	78      	SEI
+
+    where the second column is the label; routines without one are
+    shown by address.  */
+
+#ifndef PROFILE_DEPTH
+#define PROFILE_DEPTH 256       // frames on the shadow stack, deeper calls go to their caller
+#endif
+#ifndef PROFILE_NODES
+#define PROFILE_NODES (1 << 16) // distinct call paths, a power of two
+#endif
+#define PROFILE_NAME 40         // longest routine name, with the terminating 0
+
+typedef struct profile_frame {
+    uint16_t entry;             // address the routine was entered at
+    uint8_t sp;                 // stack pointer after the call pushed its return
+    uint32_t node;              // call path in the tree
+    uint64_t start;             // p->clock at the call
+} profile_frame;
+
+typedef struct profile_node {
+    uint32_t parent;
+    uint16_t entry;
+    bool used;
+    uint64_t cycles;            // exclusive cycles on this path
+} profile_node;
+
+typedef struct profile {
+    uint64_t executed[65536];   // by address of the instruction
+    uint64_t cycles[65536];
+    uint64_t calls[65536];      // by entry address of the routine
+    uint64_t exclusive[65536];
+    uint64_t inclusive[65536];  // of the calls that returned
+    uint16_t active[65536];     // frames of the routine on the stack
+    uint64_t clock;             // cycles profiled
+    uint64_t settled;           // clock when the top frame was last given its exclusive cycles
+    uint64_t lost;              // calls not followed: stack too deep or tree full
+    int depth;                  // frames above the root, frames[0]
+    profile_frame frames[PROFILE_DEPTH];
+    profile_node nodes[PROFILE_NODES];  // open addressing on parent and entry, 0 is the root
+    char *labels[65536];
+} profile;
+
+static inline profile *profile_create(uint16_t pc) {
+    // An empty profile, the program running at pc as its root
+    profile *p = calloc(1, sizeof(profile));
+    if (p == NULL)
+        return NULL;
+    p->frames[0] = (profile_frame){pc, 0xFF, 0, 0};
+    p->nodes[0] = (profile_node){0, pc, true, 0};
+    p->active[pc] = 1;
+    return p;
+}
+
+static inline uint32_t profile_node_of(profile *p, uint32_t parent, uint16_t entry) {
+    // The child of parent for entry, made on first use; parent when the tree is full
+    uint32_t key = parent * 0x9E3779B1u ^ entry * 0x85EBCA77u;
+    for (uint32_t probe = 0; probe < PROFILE_NODES; probe++) {
+        uint32_t i = (key + probe) & (PROFILE_NODES - 1);
+        profile_node *n = &p->nodes[i];
+        if (!n->used) {
+            *n = (profile_node){parent, entry, true, 0};
+            return i;
+        }
+        if (i != 0 && n->parent == parent && n->entry == entry)
+            return i;
+    }
+    p->lost++;
+    return parent;
+}
+
+static inline void profile_settle(profile *p) {
+    // The top frame gets the cycles since it last changed, so that profile_step() need not
+    profile_frame *f = &p->frames[p->depth];
+    p->exclusive[f->entry] += p->clock - p->settled;
+    p->nodes[f->node].cycles += p->clock - p->settled;
+    p->settled = p->clock;
+}
+
+__attribute__((noinline))
+static void profile_call(profile *p, uint16_t entry, uint8_t sp) {
+    // A JSR or an interrupt went to entry and left sp behind
+    profile_settle(p);
+    if (p->depth == PROFILE_DEPTH - 1) {
+        p->lost++;
+        return;
+    }
+    profile_frame *f = &p->frames[++p->depth];
+    *f = (profile_frame){entry, sp, profile_node_of(p, p->frames[p->depth - 1].node, entry), p->clock};
+    p->calls[entry]++;
+    p->active[entry]++;
+}
+
+static inline void profile_pop(profile *p) {
+    profile_frame *f = &p->frames[p->depth--];
+    if (--p->active[f->entry] == 0)
+        p->inclusive[f->entry] += p->clock - f->start;
+}
+
+__attribute__((noinline))
+static void profile_return(profile *p, uint8_t sp) {
+    // An RTS or RTI found its return address above sp
+    profile_settle(p);
+    while (p->depth > 0 && p->frames[p->depth].sp < sp)
+        profile_pop(p);
+    if (p->depth > 0 && p->frames[p->depth].sp == sp)
+        profile_pop(p);
+}
+
+static inline void profile_step(profile *p, uint16_t pc, uint8_t opcode, uint8_t cycles, uint16_t next, uint8_t sp) {
+    // The instruction at pc took cycles and left the cpu at next with sp
+    p->executed[pc]++;
+    p->cycles[pc] += cycles;
+    p->clock += cycles;
+    if (__builtin_expect((opcode & 0x9F) == 0, 0)) {    // brk, jsr, rti, rts
+        if (opcode == 0x20)
+            profile_call(p, next, sp);
+        else if (opcode == 0x60)
+            profile_return(p, sp - 2);
+        else if (opcode == 0x40)
+            profile_return(p, sp - 3);
+    }
+}
+
+static inline void profile_interrupt(profile *p, uint16_t vector, uint8_t cycles, uint8_t sp) {
+    // The interrupt sequence took cycles, counted as the handler's own
+    profile_call(p, vector, sp);
+    p->clock += cycles;
+}
+
+static inline bool listing_read(const char *path, char *labels[65536], bool called[65536]) {
+    /*  The label column of a disassembly listing into labels (strdup'd) and
+        the targets of its JSRs into called; either may be NULL. False when
+        the listing cannot be read.  */
+    FILE *f = fopen(path, "r");
+    if (f == NULL)
+        return false;
+    char line[256];
+    while (fgets(line, sizeof(line), f) != NULL) {
+        char *end;
+        unsigned long addr = strtoul(line, &end, 16);
+        if (end != line + 4 || strncmp(end, ":\t", 2) != 0)
+            continue;
+        char *label = end + 2;
+        size_t length = strcspn(label, "\t\r\n ");
+        if (labels != NULL && length > 0 && length < PROFILE_NAME) {
+            free(labels[addr]);
+            labels[addr] = strndup(label, length);
+        }
+        char *jsr = strstr(label, "\tJSR $");
+        if (called != NULL && jsr != NULL)
+            called[strtoul(jsr + 6, NULL, 16) & 0xFFFF] = true;
+    }
+    fclose(f);
+    return true;
+}
+
+static inline bool profile_labels(profile *p, const char *path) {
+    // Routine names from a disassembly listing, false when it cannot be read
+    return listing_read(path, p->labels, NULL);
+}
+
+static inline const char *profile_name(const profile *p, uint16_t addr, char name[PROFILE_NAME]) {
+    if (p->labels[addr] != NULL)
+        return p->labels[addr];
+    sprintf(name, "$%04X", addr);
+    return name;
+}
+
+static inline uint64_t profile_inclusive(const profile *p, uint16_t entry) {
+    // Inclusive cycles, the call still on the stack up to now
+    uint64_t cycles = p->inclusive[entry];
+    for (int i = 0; i <= p->depth; i++)
+        if (p->frames[i].entry == entry)
+            return cycles + p->clock - p->frames[i].start;
+    return cycles;
+}
+
+static const profile *profile_sorted;     // for the qsort() comparisons of profile_report()
+
+static inline int profile_by_inclusive(const void *a, const void *b) {
+    const profile *p = profile_sorted;
+    uint64_t x = profile_inclusive(p, *(const uint16_t *)a), y = profile_inclusive(p, *(const uint16_t *)b);
+    return x < y ? 1 : x > y ? -1 : 0;
+}
+
+static inline int profile_by_cycles(const void *a, const void *b) {
+    const profile *p = profile_sorted;
+    uint64_t x = p->cycles[*(const uint16_t *)a], y = p->cycles[*(const uint16_t *)b];
+    return x < y ? 1 : x > y ? -1 : 0;
+}
+
+static inline void profile_report(profile *p, FILE *f, int lines) {
+    // The `lines` routines with the most inclusive cycles, then the busiest addresses
+    profile_settle(p);
+    static uint16_t order[65536];
+    int n = 0;
+    for (uint32_t a = 0; a <= 0xFFFF; a++)
+        if (p->calls[a] > 0 || p->active[a] > 0)
+            order[n++] = a;
+    profile_sorted = p;
+    qsort(order, n, sizeof(order[0]), profile_by_inclusive);
+    double total = p->clock > 0 ? p->clock : 1;
+    fprintf(f, "%llu cycles profiled\n\n", (unsigned long long)p->clock);
+    fprintf(f, "addr  routine                 calls     inclusive          exclusive\n");
+    for (int i = 0; i < n && i < lines; i++) {
+        uint16_t a = order[i];
+        uint64_t in = profile_inclusive(p, a);
+        fprintf(
+            f, "%04X  %-20.20s %8llu %12llu %5.1f%% %12llu %5.1f%%\n", a,
+            p->labels[a] != NULL ? p->labels[a] : "", (unsigned long long)p->calls[a],
+            (unsigned long long)in, 100 * in / total,
+            (unsigned long long)p->exclusive[a], 100 * p->exclusive[a] / total
+        );
+    }
+    n = 0;
+    for (uint32_t a = 0; a <= 0xFFFF; a++)
+        if (p->executed[a] > 0)
+            order[n++] = a;
+    qsort(order, n, sizeof(order[0]), profile_by_cycles);
+    fprintf(f, "\naddr  label                   executed        cycles\n");
+    for (int i = 0; i < n && i < lines; i++) {
+        uint16_t a = order[i];
+        fprintf(
+            f, "%04X  %-20.20s %12llu %12llu %5.1f%%\n", a, p->labels[a] != NULL ? p->labels[a] : "",
+            (unsigned long long)p->executed[a], (unsigned long long)p->cycles[a], 100 * p->cycles[a] / total
+        );
+    }
+}
+
+static inline void profile_folded(profile *p, FILE *f) {
+    // One "outer;...;inner cycles" line per call path, for flamegraph.pl
+    profile_settle(p);
+    char name[PROFILE_NAME];
+    uint32_t path[PROFILE_DEPTH];
+    for (uint32_t i = 0; i < PROFILE_NODES; i++) {
+        if (!p->nodes[i].used || p->nodes[i].cycles == 0)
+            continue;
+        int n = 0;
+        for (uint32_t k = i; k != 0 && n < PROFILE_DEPTH - 1; k = p->nodes[k].parent)
+            path[n++] = k;
+        path[n++] = 0;
+        while (n-- > 0)
+            fprintf(f, "%s%c", profile_name(p, p->nodes[path[n]].entry, name), n > 0 ? ';' : ' ');
+        fprintf(f, "%llu\n", (unsigned long long)p->nodes[i].cycles);
+    }
+}
+
+static inline void profile_destroy(profile *p) {
+    if (p == NULL)
+        return;
+    for (uint32_t a = 0; a <= 0xFFFF; a++)
+        free(p->labels[a]);
+    free(p);
+}
+
+#endif
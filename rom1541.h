@@ -0,0 +1,22157 @@
+/*  Generated by rom2c from 1541rom.bin, do not edit.  */
+
+#define ROM_START 0xC000
+#define ROM_SIZE  0x4000
+
+static const uint8_t rom_image[ROM_SIZE] = {
+    0x97, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x78, 0xA9, 0xF7, 0x2D, 0x00, 0x1C, 0x48, 0xA5, 0x7F, 0xF0, 0x05, 0x68, 0x09, 0x00, 0xD0, 0x03,
+    0x68, 0x09, 0x08, 0x8D, 0x00, 0x1C, 0x58, 0x60, 0x78, 0xA9, 0x08, 0x0D, 0x00, 0x1C, 0x8D, 0x00,
+    0x1C, 0x58, 0x60, 0xA9, 0x00, 0x8D, 0x6C, 0x02, 0x8D, 0x6D, 0x02, 0x60, 0x78, 0x8A, 0x48, 0xA9,
+    0x50, 0x8D, 0x6C, 0x02, 0xA2, 0x00, 0xBD, 0xCA, 0xFE, 0x8D, 0x6D, 0x02, 0x0D, 0x00, 0x1C, 0x8D,
+    0x00, 0x1C, 0x68, 0xAA, 0x58, 0x60, 0xA9, 0x00, 0x8D, 0xF9, 0x02, 0xAD, 0x8E, 0x02, 0x85, 0x7F,
+    0x20, 0xBC, 0xE6, 0xA5, 0x84, 0x10, 0x09, 0x29, 0x0F, 0xC9, 0x0F, 0xF0, 0x03, 0x4C, 0xB4, 0xD7,
+    0x20, 0xB3, 0xC2, 0xB1, 0xA3, 0x8D, 0x75, 0x02, 0xA2, 0x0B, 0xBD, 0x89, 0xFE, 0xCD, 0x75, 0x02,
+    0xF0, 0x08, 0xCA, 0x10, 0xF5, 0xA9, 0x31, 0x4C, 0xC8, 0xC1, 0x8E, 0x2A, 0x02, 0xE0, 0x09, 0x90,
+    0x03, 0x20, 0xEE, 0xC1, 0xAE, 0x2A, 0x02, 0xBD, 0x95, 0xFE, 0x85, 0x6F, 0xBD, 0xA1, 0xFE, 0x85,
+    0x70, 0x6C, 0x6F, 0x00, 0xA9, 0x00, 0x8D, 0xF9, 0x02, 0xAD, 0x6C, 0x02, 0xD0, 0x2A, 0xA0, 0x00,
+    0x98, 0x84, 0x80, 0x84, 0x81, 0x84, 0xA3, 0x20, 0xC7, 0xE6, 0x20, 0x23, 0xC1, 0xA5, 0x7F, 0x8D,
+    0x8E, 0x02, 0xAA, 0xA9, 0x00, 0x95, 0xFF, 0x20, 0xBD, 0xC1, 0x4C, 0xDA, 0xD4, 0xA0, 0x28, 0xA9,
+    0x00, 0x99, 0x00, 0x02, 0x88, 0x10, 0xFA, 0x60, 0xA0, 0x00, 0x84, 0x80, 0x84, 0x81, 0x4C, 0x45,
+    0xE6, 0xA2, 0x00, 0x8E, 0x7A, 0x02, 0xA9, 0x3A, 0x20, 0x68, 0xC2, 0xF0, 0x05, 0x88, 0x88, 0x8C,
+    0x7A, 0x02, 0x4C, 0x68, 0xC3, 0xA0, 0x00, 0xA2, 0x00, 0xA9, 0x3A, 0x4C, 0x68, 0xC2, 0x20, 0xE5,
+    0xC1, 0xD0, 0x05, 0xA9, 0x34, 0x4C, 0xC8, 0xC1, 0x88, 0x88, 0x8C, 0x7A, 0x02, 0x8A, 0xD0, 0xF3,
+    0xA9, 0x3D, 0x20, 0x68, 0xC2, 0x8A, 0xF0, 0x02, 0xA9, 0x40, 0x09, 0x21, 0x8D, 0x8B, 0x02, 0xE8,
+    0x8E, 0x77, 0x02, 0x8E, 0x78, 0x02, 0xAD, 0x8A, 0x02, 0xF0, 0x0D, 0xA9, 0x80, 0x0D, 0x8B, 0x02,
+    0x8D, 0x8B, 0x02, 0xA9, 0x00, 0x8D, 0x8A, 0x02, 0x98, 0xF0, 0x29, 0x9D, 0x7A, 0x02, 0xAD, 0x77,
+    0x02, 0x8D, 0x79, 0x02, 0xA9, 0x8D, 0x20, 0x68, 0xC2, 0xE8, 0x8E, 0x78, 0x02, 0xCA, 0xAD, 0x8A,
+    0x02, 0xF0, 0x02, 0xA9, 0x08, 0xEC, 0x77, 0x02, 0xF0, 0x02, 0x09, 0x04, 0x09, 0x03, 0x4D, 0x8B,
+    0x02, 0x8D, 0x8B, 0x02, 0xAD, 0x8B, 0x02, 0xAE, 0x2A, 0x02, 0x3D, 0xA5, 0xFE, 0xD0, 0x01, 0x60,
+    0x8D, 0x6C, 0x02, 0xA9, 0x30, 0x4C, 0xC8, 0xC1, 0x8D, 0x75, 0x02, 0xCC, 0x74, 0x02, 0xB0, 0x2E,
+    0xB1, 0xA3, 0xC8, 0xCD, 0x75, 0x02, 0xF0, 0x28, 0xC9, 0x2A, 0xF0, 0x04, 0xC9, 0x3F, 0xD0, 0x03,
+    0xEE, 0x8A, 0x02, 0xC9, 0x2C, 0xD0, 0xE4, 0x98, 0x9D, 0x7B, 0x02, 0xAD, 0x8A, 0x02, 0x29, 0x7F,
+    0xF0, 0x07, 0xA9, 0x80, 0x95, 0xE7, 0x8D, 0x8A, 0x02, 0xE8, 0xE0, 0x04, 0x90, 0xCD, 0xA0, 0x00,
+    0xAD, 0x74, 0x02, 0x9D, 0x7B, 0x02, 0xAD, 0x8A, 0x02, 0x29, 0x7F, 0xF0, 0x04, 0xA9, 0x80, 0x95,
+    0xE7, 0x98, 0x60, 0xA4, 0xA3, 0xF0, 0x14, 0x88, 0xF0, 0x10, 0xB9, 0x00, 0x02, 0xC9, 0x0D, 0xF0,
+    0x0A, 0x88, 0xB9, 0x00, 0x02, 0xC9, 0x0D, 0xF0, 0x02, 0xC8, 0xC8, 0x8C, 0x74, 0x02, 0xC0, 0x2A,
+    0xA0, 0xFF, 0x90, 0x08, 0x8C, 0x2A, 0x02, 0xA9, 0x32, 0x4C, 0xC8, 0xC1, 0xA0, 0x00, 0x98, 0x85,
+    0xA3, 0x8D, 0x58, 0x02, 0x8D, 0x4A, 0x02, 0x8D, 0x96, 0x02, 0x85, 0xD3, 0x8D, 0x79, 0x02, 0x8D,
+    0x77, 0x02, 0x8D, 0x78, 0x02, 0x8D, 0x8A, 0x02, 0x8D, 0x6C, 0x02, 0xA2, 0x05, 0x9D, 0x79, 0x02,
+    0x95, 0xD7, 0x95, 0xDC, 0x95, 0xE1, 0x95, 0xE6, 0x9D, 0x7F, 0x02, 0x9D, 0x84, 0x02, 0xCA, 0xD0,
+    0xEC, 0x60, 0xAD, 0x78, 0x02, 0x8D, 0x77, 0x02, 0xA9, 0x01, 0x8D, 0x78, 0x02, 0x8D, 0x79, 0x02,
+    0xAC, 0x8E, 0x02, 0xA2, 0x00, 0x86, 0xD3, 0xBD, 0x7A, 0x02, 0x20, 0x3C, 0xC3, 0xA6, 0xD3, 0x9D,
+    0x7A, 0x02, 0x98, 0x95, 0xE2, 0xE8, 0xEC, 0x78, 0x02, 0x90, 0xEA, 0x60, 0xAA, 0xA0, 0x00, 0xA9,
+    0x3A, 0xDD, 0x01, 0x02, 0xF0, 0x0C, 0xDD, 0x00, 0x02, 0xD0, 0x16, 0xE8, 0x98, 0x29, 0x01, 0xA8,
+    0x8A, 0x60, 0xBD, 0x00, 0x02, 0xE8, 0xE8, 0xC9, 0x30, 0xF0, 0xF2, 0xC9, 0x31, 0xF0, 0xEE, 0xD0,
+    0xEB, 0x98, 0x09, 0x80, 0x29, 0x81, 0xD0, 0xE7, 0xA9, 0x00, 0x8D, 0x8B, 0x02, 0xAC, 0x7A, 0x02,
+    0xB1, 0xA3, 0x20, 0xBD, 0xC3, 0x10, 0x11, 0xC8, 0xCC, 0x74, 0x02, 0xB0, 0x06, 0xAC, 0x74, 0x02,
+    0x88, 0xD0, 0xED, 0xCE, 0x8B, 0x02, 0xA9, 0x00, 0x29, 0x01, 0x85, 0x7F, 0x4C, 0x00, 0xC1, 0xA5,
+    0x7F, 0x49, 0x01, 0x29, 0x01, 0x85, 0x7F, 0x60, 0xA0, 0x00, 0xAD, 0x77, 0x02, 0xCD, 0x78, 0x02,
+    0xF0, 0x16, 0xCE, 0x78, 0x02, 0xAC, 0x78, 0x02, 0xB9, 0x7A, 0x02, 0xA8, 0xB1, 0xA3, 0xA0, 0x04,
+    0xD9, 0xBB, 0xFE, 0xF0, 0x03, 0x88, 0xD0, 0xF8, 0x98, 0x8D, 0x96, 0x02, 0x60, 0xC9, 0x30, 0xF0,
+    0x06, 0xC9, 0x31, 0xF0, 0x02, 0x09, 0x80, 0x29, 0x81, 0x60, 0xA9, 0x00, 0x85, 0x6F, 0x8D, 0x8D,
+    0x02, 0x48, 0xAE, 0x78, 0x02, 0x68, 0x05, 0x6F, 0x48, 0xA9, 0x01, 0x85, 0x6F, 0xCA, 0x30, 0x0F,
+    0xB5, 0xE2, 0x10, 0x04, 0x06, 0x6F, 0x06, 0x6F, 0x4A, 0x90, 0xEA, 0x06, 0x6F, 0xD0, 0xE6, 0x68,
+    0xAA, 0xBD, 0x3F, 0xC4, 0x48, 0x29, 0x03, 0x8D, 0x8C, 0x02, 0x68, 0x0A, 0x10, 0x3E, 0xA5, 0xE2,
+    0x29, 0x01, 0x85, 0x7F, 0xAD, 0x8C, 0x02, 0xF0, 0x2B, 0x20, 0x3D, 0xC6, 0xF0, 0x12, 0x20, 0x8F,
+    0xC3, 0xA9, 0x00, 0x8D, 0x8C, 0x02, 0x20, 0x3D, 0xC6, 0xF0, 0x1E, 0xA9, 0x74, 0x20, 0xC8, 0xC1,
+    0x20, 0x8F, 0xC3, 0x20, 0x3D, 0xC6, 0x08, 0x20, 0x8F, 0xC3, 0x28, 0xF0, 0x0C, 0xA9, 0x00, 0x8D,
+    0x8C, 0x02, 0xF0, 0x05, 0x20, 0x3D, 0xC6, 0xD0, 0xE2, 0x4C, 0x00, 0xC1, 0x2A, 0x4C, 0x00, 0xC4,
+    0x00, 0x80, 0x41, 0x01, 0x01, 0x01, 0x01, 0x81, 0x81, 0x81, 0x81, 0x42, 0x42, 0x42, 0x42, 0x20,
+    0xCA, 0xC3, 0xA9, 0x00, 0x8D, 0x92, 0x02, 0x20, 0xAC, 0xC5, 0xD0, 0x19, 0xCE, 0x8C, 0x02, 0x10,
+    0x01, 0x60, 0xA9, 0x01, 0x8D, 0x8D, 0x02, 0x20, 0x8F, 0xC3, 0x20, 0x00, 0xC1, 0x4C, 0x52, 0xC4,
+    0x20, 0x17, 0xC6, 0xF0, 0x10, 0x20, 0xD8, 0xC4, 0xAD, 0x8F, 0x02, 0xF0, 0x01, 0x60, 0xAD, 0x53,
+    0x02, 0x30, 0xED, 0x10, 0xF0, 0xAD, 0x8F, 0x02, 0xF0, 0xD2, 0x60, 0x20, 0x04, 0xC6, 0xF0, 0x1A,
+    0xD0, 0x28, 0xA9, 0x01, 0x8D, 0x8D, 0x02, 0x20, 0x8F, 0xC3, 0x20, 0x00, 0xC1, 0xA9, 0x00, 0x8D,
+    0x92, 0x02, 0x20, 0xAC, 0xC5, 0xD0, 0x13, 0x8D, 0x8F, 0x02, 0xAD, 0x8F, 0x02, 0xD0, 0x28, 0xCE,
+    0x8C, 0x02, 0x10, 0xDE, 0x60, 0x20, 0x17, 0xC6, 0xF0, 0xF0, 0x20, 0xD8, 0xC4, 0xAE, 0x53, 0x02,
+    0x10, 0x07, 0xAD, 0x8F, 0x02, 0xF0, 0xEE, 0xD0, 0x0E, 0xAD, 0x96, 0x02, 0xF0, 0x09, 0xB5, 0xE7,
+    0x29, 0x07, 0xCD, 0x96, 0x02, 0xD0, 0xDE, 0x60, 0xA2, 0xFF, 0x8E, 0x53, 0x02, 0xE8, 0x8E, 0x8A,
+    0x02, 0x20, 0x89, 0xC5, 0xF0, 0x06, 0x60, 0x20, 0x94, 0xC5, 0xD0, 0xFA, 0xA5, 0x7F, 0x55, 0xE2,
+    0x4A, 0x90, 0x0B, 0x29, 0x40, 0xF0, 0xF0, 0xA9, 0x02, 0xCD, 0x8C, 0x02, 0xF0, 0xE9, 0xBD, 0x7A,
+    0x02, 0xAA, 0x20, 0xA6, 0xC6, 0xA0, 0x03, 0x4C, 0x1D, 0xC5, 0xBD, 0x00, 0x02, 0xD1, 0x94, 0xF0,
+    0x0A, 0xC9, 0x3F, 0xD0, 0xD2, 0xB1, 0x94, 0xC9, 0xA0, 0xF0, 0xCC, 0xE8, 0xC8, 0xEC, 0x76, 0x02,
+    0xB0, 0x09, 0xBD, 0x00, 0x02, 0xC9, 0x2A, 0xF0, 0x0C, 0xD0, 0xDF, 0xC0, 0x13, 0xB0, 0x06, 0xB1,
+    0x94, 0xC9, 0xA0, 0xD0, 0xB2, 0xAE, 0x79, 0x02, 0x8E, 0x53, 0x02, 0xB5, 0xE7, 0x29, 0x80, 0x8D,
+    0x8A, 0x02, 0xAD, 0x94, 0x02, 0x95, 0xDD, 0xA5, 0x81, 0x95, 0xD8, 0xA0, 0x00, 0xB1, 0x94, 0xC8,
+    0x48, 0x29, 0x40, 0x85, 0x6F, 0x68, 0x29, 0xDF, 0x30, 0x02, 0x09, 0x20, 0x29, 0x27, 0x05, 0x6F,
+    0x85, 0x6F, 0xA9, 0x80, 0x35, 0xE7, 0x05, 0x6F, 0x95, 0xE7, 0xB5, 0xE2, 0x29, 0x80, 0x05, 0x7F,
+    0x95, 0xE2, 0xB1, 0x94, 0x9D, 0x80, 0x02, 0xC8, 0xB1, 0x94, 0x9D, 0x85, 0x02, 0xAD, 0x58, 0x02,
+    0xD0, 0x07, 0xA0, 0x15, 0xB1, 0x94, 0x8D, 0x58, 0x02, 0xA9, 0xFF, 0x8D, 0x8F, 0x02, 0xAD, 0x78,
+    0x02, 0x8D, 0x79, 0x02, 0xCE, 0x79, 0x02, 0x10, 0x01, 0x60, 0xAE, 0x79, 0x02, 0xB5, 0xE7, 0x30,
+    0x05, 0xBD, 0x80, 0x02, 0xD0, 0xEE, 0xA9, 0x00, 0x8D, 0x8F, 0x02, 0x60, 0xA0, 0x00, 0x8C, 0x91,
+    0x02, 0x88, 0x8C, 0x53, 0x02, 0xAD, 0x85, 0xFE, 0x85, 0x80, 0xA9, 0x01, 0x85, 0x81, 0x8D, 0x93,
+    0x02, 0x20, 0x75, 0xD4, 0xAD, 0x93, 0x02, 0xD0, 0x01, 0x60, 0xA9, 0x07, 0x8D, 0x95, 0x02, 0xA9,
+    0x00, 0x20, 0xF6, 0xD4, 0x8D, 0x93, 0x02, 0x20, 0xE8, 0xD4, 0xCE, 0x95, 0x02, 0xA0, 0x00, 0xB1,
+    0x94, 0xD0, 0x18, 0xAD, 0x91, 0x02, 0xD0, 0x2F, 0x20, 0x3B, 0xDE, 0xA5, 0x81, 0x8D, 0x91, 0x02,
+    0xA5, 0x94, 0xAE, 0x92, 0x02, 0x8D, 0x92, 0x02, 0xF0, 0x1D, 0x60, 0xA2, 0x01, 0xEC, 0x92, 0x02,
+    0xD0, 0x2D, 0xF0, 0x13, 0xAD, 0x85, 0xFE, 0x85, 0x80, 0xAD, 0x90, 0x02, 0x85, 0x81, 0x20, 0x75,
+    0xD4, 0xAD, 0x94, 0x02, 0x20, 0xC8, 0xD4, 0xA9, 0xFF, 0x8D, 0x53, 0x02, 0xAD, 0x95, 0x02, 0x30,
+    0x08, 0xA9, 0x20, 0x20, 0xC6, 0xD1, 0x4C, 0xD7, 0xC5, 0x20, 0x4D, 0xD4, 0x4C, 0xC4, 0xC5, 0xA5,
+    0x94, 0x8D, 0x94, 0x02, 0x20, 0x3B, 0xDE, 0xA5, 0x81, 0x8D, 0x90, 0x02, 0x60, 0xA5, 0x68, 0xD0,
+    0x28, 0xA6, 0x7F, 0x56, 0x1C, 0x90, 0x22, 0xA9, 0xFF, 0x8D, 0x98, 0x02, 0x20, 0x0E, 0xD0, 0xA0,
+    0xFF, 0xC9, 0x02, 0xF0, 0x0A, 0xC9, 0x03, 0xF0, 0x06, 0xC9, 0x0F, 0xF0, 0x02, 0xA0, 0x00, 0xA6,
+    0x7F, 0x98, 0x95, 0xFF, 0xD0, 0x03, 0x20, 0x42, 0xD0, 0xA6, 0x7F, 0xB5, 0xFF, 0x60, 0x48, 0x20,
+    0xA6, 0xC6, 0x20, 0x88, 0xC6, 0x68, 0x38, 0xED, 0x4B, 0x02, 0xAA, 0xF0, 0x0A, 0x90, 0x08, 0xA9,
+    0xA0, 0x91, 0x94, 0xC8, 0xCA, 0xD0, 0xFA, 0x60, 0x98, 0x0A, 0xA8, 0xB9, 0x99, 0x00, 0x85, 0x94,
+    0xB9, 0x9A, 0x00, 0x85, 0x95, 0xA0, 0x00, 0xBD, 0x00, 0x02, 0x91, 0x94, 0xC8, 0xF0, 0x06, 0xE8,
+    0xEC, 0x76, 0x02, 0x90, 0xF2, 0x60, 0xA9, 0x00, 0x8D, 0x4B, 0x02, 0x8A, 0x48, 0xBD, 0x00, 0x02,
+    0xC9, 0x2C, 0xF0, 0x14, 0xC9, 0x3D, 0xF0, 0x10, 0xEE, 0x4B, 0x02, 0xE8, 0xA9, 0x0F, 0xCD, 0x4B,
+    0x02, 0x90, 0x05, 0xEC, 0x74, 0x02, 0x90, 0xE5, 0x8E, 0x76, 0x02, 0x68, 0xAA, 0x60, 0xA5, 0x83,
+    0x48, 0xA5, 0x82, 0x48, 0x20, 0xDE, 0xC6, 0x68, 0x85, 0x82, 0x68, 0x85, 0x83, 0x60, 0xA9, 0x11,
+    0x85, 0x83, 0x20, 0xEB, 0xD0, 0x20, 0xE8, 0xD4, 0xAD, 0x53, 0x02, 0x10, 0x0A, 0xAD, 0x8D, 0x02,
+    0xD0, 0x0A, 0x20, 0x06, 0xC8, 0x18, 0x60, 0xAD, 0x8D, 0x02, 0xF0, 0x1F, 0xCE, 0x8D, 0x02, 0xD0,
+    0x0D, 0xCE, 0x8D, 0x02, 0x20, 0x8F, 0xC3, 0x20, 0x06, 0xC8, 0x38, 0x4C, 0x8F, 0xC3, 0xA9, 0x00,
+    0x8D, 0x73, 0x02, 0x8D, 0x8D, 0x02, 0x20, 0xB7, 0xC7, 0x38, 0x60, 0xA2, 0x18, 0xA0, 0x1D, 0xB1,
+    0x94, 0x8D, 0x73, 0x02, 0xF0, 0x02, 0xA2, 0x16, 0x88, 0xB1, 0x94, 0x8D, 0x72, 0x02, 0xE0, 0x16,
+    0xF0, 0x0A, 0xC9, 0x0A, 0x90, 0x06, 0xCA, 0xC9, 0x64, 0x90, 0x01, 0xCA, 0x20, 0xAC, 0xC7, 0xB1,
+    0x94, 0x48, 0x0A, 0x10, 0x05, 0xA9, 0x3C, 0x9D, 0xB2, 0x02, 0x68, 0x29, 0x0F, 0xA8, 0xB9, 0xC5,
+    0xFE, 0x9D, 0xB1, 0x02, 0xCA, 0xB9, 0xC0, 0xFE, 0x9D, 0xB1, 0x02, 0xCA, 0xB9, 0xBB, 0xFE, 0x9D,
+    0xB1, 0x02, 0xCA, 0xCA, 0xB0, 0x05, 0xA9, 0x2A, 0x9D, 0xB2, 0x02, 0xA9, 0xA0, 0x9D, 0xB1, 0x02,
+    0xCA, 0xA0, 0x12, 0xB1, 0x94, 0x9D, 0xB1, 0x02, 0xCA, 0x88, 0xC0, 0x03, 0xB0, 0xF5, 0xA9, 0x22,
+    0x9D, 0xB1, 0x02, 0xE8, 0xE0, 0x20, 0xB0, 0x0B, 0xBD, 0xB1, 0x02, 0xC9, 0x22, 0xF0, 0x04, 0xC9,
+    0xA0, 0xD0, 0xF0, 0xA9, 0x22, 0x9D, 0xB1, 0x02, 0xE8, 0xE0, 0x20, 0xB0, 0x0A, 0xA9, 0x7F, 0x3D,
+    0xB1, 0x02, 0x9D, 0xB1, 0x02, 0x10, 0xF1, 0x20, 0xB5, 0xC4, 0x38, 0x60, 0xA0, 0x1B, 0xA9, 0x20,
+    0x99, 0xB0, 0x02, 0x88, 0xD0, 0xFA, 0x60, 0x20, 0x19, 0xF1, 0x20, 0xDF, 0xF0, 0x20, 0xAC, 0xC7,
+    0xA9, 0xFF, 0x85, 0x6F, 0xA6, 0x7F, 0x8E, 0x72, 0x02, 0xA9, 0x00, 0x8D, 0x73, 0x02, 0xA6, 0xF9,
+    0xBD, 0xE0, 0xFE, 0x85, 0x95, 0xAD, 0x88, 0xFE, 0x85, 0x94, 0xA0, 0x16, 0xB1, 0x94, 0xC9, 0xA0,
+    0xD0, 0x0B, 0xA9, 0x31, 0x2C, 0xB1, 0x94, 0xC9, 0xA0, 0xD0, 0x02, 0xA9, 0x20, 0x99, 0xB3, 0x02,
+    0x88, 0x10, 0xF2, 0xA9, 0x12, 0x8D, 0xB1, 0x02, 0xA9, 0x22, 0x8D, 0xB2, 0x02, 0x8D, 0xC3, 0x02,
+    0xA9, 0x20, 0x8D, 0xC4, 0x02, 0x60, 0x20, 0xAC, 0xC7, 0xA0, 0x0B, 0xB9, 0x17, 0xC8, 0x99, 0xB1,
+    0x02, 0x88, 0x10, 0xF7, 0x4C, 0x4D, 0xEF, 0x42, 0x4C, 0x4F, 0x43, 0x4B, 0x53, 0x20, 0x46, 0x52,
+    0x45, 0x45, 0x2E, 0x20, 0x98, 0xC3, 0x20, 0x20, 0xC3, 0x20, 0xCA, 0xC3, 0xA9, 0x00, 0x85, 0x86,
+    0x20, 0x9D, 0xC4, 0x30, 0x3D, 0x20, 0xB7, 0xDD, 0x90, 0x33, 0xA0, 0x00, 0xB1, 0x94, 0x29, 0x40,
+    0xD0, 0x2B, 0x20, 0xB6, 0xC8, 0xA0, 0x13, 0xB1, 0x94, 0xF0, 0x0A, 0x85, 0x80, 0xC8, 0xB1, 0x94,
+    0x85, 0x81, 0x20, 0x7D, 0xC8, 0xAE, 0x53, 0x02, 0xA9, 0x20, 0x35, 0xE7, 0xD0, 0x0D, 0xBD, 0x80,
+    0x02, 0x85, 0x80, 0xBD, 0x85, 0x02, 0x85, 0x81, 0x20, 0x7D, 0xC8, 0xE6, 0x86, 0x20, 0x8B, 0xC4,
+    0x10, 0xC3, 0xA5, 0x86, 0x85, 0x80, 0xA9, 0x01, 0xA0, 0x00, 0x4C, 0xA3, 0xC1, 0x20, 0x5F, 0xEF,
+    0x20, 0x75, 0xD4, 0x20, 0x19, 0xF1, 0xB5, 0xA7, 0xC9, 0xFF, 0xF0, 0x08, 0xAD, 0xF9, 0x02, 0x09,
+    0x40, 0x8D, 0xF9, 0x02, 0xA9, 0x00, 0x20, 0xC8, 0xD4, 0x20, 0x56, 0xD1, 0x85, 0x80, 0x20, 0x56,
+    0xD1, 0x85, 0x81, 0xA5, 0x80, 0xD0, 0x06, 0x20, 0xF4, 0xEE, 0x4C, 0x27, 0xD2, 0x20, 0x5F, 0xEF,
+    0x20, 0x4D, 0xD4, 0x4C, 0x94, 0xC8, 0xA0, 0x00, 0x98, 0x91, 0x94, 0x20, 0x5E, 0xDE, 0x4C, 0x99,
+    0xD5, 0xA9, 0x31, 0x4C, 0xC8, 0xC1, 0xA9, 0x4C, 0x8D, 0x00, 0x06, 0xA9, 0xC7, 0x8D, 0x01, 0x06,
+    0xA9, 0xFA, 0x8D, 0x02, 0x06, 0xA9, 0x03, 0x20, 0xD3, 0xD6, 0xA5, 0x7F, 0x09, 0xE0, 0x85, 0x03,
+    0xA5, 0x03, 0x30, 0xFC, 0xC9, 0x02, 0x90, 0x07, 0xA9, 0x03, 0xA2, 0x00, 0x4C, 0x0A, 0xE6, 0x60,
+    0xA9, 0xE0, 0x8D, 0x4F, 0x02, 0x20, 0xD1, 0xF0, 0x20, 0x19, 0xF1, 0xA9, 0xFF, 0x95, 0xA7, 0xA9,
+    0x0F, 0x8D, 0x56, 0x02, 0x20, 0xE5, 0xC1, 0xD0, 0x03, 0x4C, 0xC1, 0xC8, 0x20, 0xF8, 0xC1, 0x20,
+    0x20, 0xC3, 0xAD, 0x8B, 0x02, 0x29, 0x55, 0xD0, 0x0F, 0xAE, 0x7A, 0x02, 0xBD, 0x00, 0x02, 0xC9,
+    0x2A, 0xD0, 0x05, 0xA9, 0x30, 0x4C, 0xC8, 0xC1, 0xAD, 0x8B, 0x02, 0x29, 0xD9, 0xD0, 0xF4, 0x4C,
+    0x52, 0xC9, 0xA9, 0x00, 0x8D, 0x58, 0x02, 0x8D, 0x8C, 0x02, 0x8D, 0x80, 0x02, 0x8D, 0x81, 0x02,
+    0xA5, 0xE3, 0x29, 0x01, 0x85, 0x7F, 0x09, 0x01, 0x8D, 0x91, 0x02, 0xAD, 0x7B, 0x02, 0x8D, 0x7A,
+    0x02, 0x60, 0x20, 0x4F, 0xC4, 0xAD, 0x78, 0x02, 0xC9, 0x03, 0x90, 0x45, 0xA5, 0xE2, 0xC5, 0xE3,
+    0xD0, 0x3F, 0xA5, 0xDD, 0xC5, 0xDE, 0xD0, 0x39, 0xA5, 0xD8, 0xC5, 0xD9, 0xD0, 0x33, 0x20, 0xCC,
+    0xCA, 0xA9, 0x01, 0x8D, 0x79, 0x02, 0x20, 0xFA, 0xC9, 0x20, 0x25, 0xD1, 0xF0, 0x04, 0xC9, 0x02,
+    0xD0, 0x05, 0xA9, 0x64, 0x20, 0xC8, 0xC1, 0xA9, 0x12, 0x85, 0x83, 0xAD, 0x3C, 0x02, 0x8D, 0x3D,
+    0x02, 0xA9, 0xFF, 0x8D, 0x3C, 0x02, 0x20, 0x2A, 0xDA, 0xA2, 0x02, 0x20, 0xB9, 0xC9, 0x4C, 0x94,
+    0xC1, 0x20, 0xA7, 0xC9, 0x4C, 0x94, 0xC1, 0x20, 0xE7, 0xCA, 0xA5, 0xE2, 0x29, 0x01, 0x85, 0x7F,
+    0x20, 0x86, 0xD4, 0x20, 0xE4, 0xD6, 0xAE, 0x77, 0x02, 0x8E, 0x79, 0x02, 0x20, 0xFA, 0xC9, 0xA9,
+    0x11, 0x85, 0x83, 0x20, 0xEB, 0xD0, 0x20, 0x25, 0xD1, 0xD0, 0x03, 0x20, 0x53, 0xCA, 0xA9, 0x08,
+    0x85, 0xF8, 0x4C, 0xD8, 0xC9, 0x20, 0x9B, 0xCF, 0x20, 0x35, 0xCA, 0xA9, 0x80, 0x20, 0xA6, 0xDD,
+    0xF0, 0xF3, 0x20, 0x25, 0xD1, 0xF0, 0x03, 0x20, 0x9B, 0xCF, 0xAE, 0x79, 0x02, 0xE8, 0xEC, 0x78,
+    0x02, 0x90, 0xC6, 0xA9, 0x12, 0x85, 0x83, 0x4C, 0x02, 0xDB, 0xAE, 0x79, 0x02, 0xB5, 0xE2, 0x29,
+    0x01, 0x85, 0x7F, 0xAD, 0x85, 0xFE, 0x85, 0x80, 0xB5, 0xD8, 0x85, 0x81, 0x20, 0x75, 0xD4, 0xAE,
+    0x79, 0x02, 0xB5, 0xDD, 0x20, 0xC8, 0xD4, 0xAE, 0x79, 0x02, 0xB5, 0xE7, 0x29, 0x07, 0x8D, 0x4A,
+    0x02, 0xA9, 0x00, 0x8D, 0x58, 0x02, 0x20, 0xA0, 0xD9, 0xA0, 0x01, 0x20, 0x25, 0xD1, 0xF0, 0x01,
+    0xC8, 0x98, 0x4C, 0xC8, 0xD4, 0xA9, 0x11, 0x85, 0x83, 0x20, 0x9B, 0xD3, 0x85, 0x85, 0xA6, 0x82,
+    0xB5, 0xF2, 0x29, 0x08, 0x85, 0xF8, 0xD0, 0x0A, 0x20, 0x25, 0xD1, 0xF0, 0x05, 0xA9, 0x80, 0x20,
+    0x97, 0xDD, 0x60, 0x20, 0xD3, 0xD1, 0x20, 0xCB, 0xE1, 0xA5, 0xD6, 0x48, 0xA5, 0xD5, 0x48, 0xA9,
+    0x12, 0x85, 0x83, 0x20, 0x07, 0xD1, 0x20, 0xD3, 0xD1, 0x20, 0xCB, 0xE1, 0x20, 0x9C, 0xE2, 0xA5,
+    0xD6, 0x85, 0x87, 0xA5, 0xD5, 0x85, 0x86, 0xA9, 0x00, 0x85, 0x88, 0x85, 0xD4, 0x85, 0xD7, 0x68,
+    0x85, 0xD5, 0x68, 0x85, 0xD6, 0x4C, 0x3B, 0xE3, 0x20, 0x20, 0xC3, 0xA5, 0xE3, 0x29, 0x01, 0x85,
+    0xE3, 0xC5, 0xE2, 0xF0, 0x02, 0x09, 0x80, 0x85, 0xE2, 0x20, 0x4F, 0xC4, 0x20, 0xE7, 0xCA, 0xA5,
+    0xE3, 0x29, 0x01, 0x85, 0x7F, 0xA5, 0xD9, 0x85, 0x81, 0x20, 0x57, 0xDE, 0x20, 0x99, 0xD5, 0xA5,
+    0xDE, 0x18, 0x69, 0x03, 0x20, 0xC8, 0xD4, 0x20, 0x93, 0xDF, 0xA8, 0xAE, 0x7A, 0x02, 0xA9, 0x10,
+    0x20, 0x6E, 0xC6, 0x20, 0x5E, 0xDE, 0x20, 0x99, 0xD5, 0x4C, 0x94, 0xC1, 0xA5, 0xE8, 0x29, 0x07,
+    0x8D, 0x4A, 0x02, 0xAE, 0x78, 0x02, 0xCA, 0xEC, 0x77, 0x02, 0x90, 0x0A, 0xBD, 0x80, 0x02, 0xD0,
+    0xF5, 0xA9, 0x62, 0x4C, 0xC8, 0xC1, 0x60, 0x20, 0xCC, 0xCA, 0xBD, 0x80, 0x02, 0xF0, 0x05, 0xA9,
+    0x63, 0x4C, 0xC8, 0xC1, 0xCA, 0x10, 0xF3, 0x60, 0xAD, 0x01, 0x02, 0xC9, 0x2D, 0xD0, 0x4C, 0xAD,
+    0x03, 0x02, 0x85, 0x6F, 0xAD, 0x04, 0x02, 0x85, 0x70, 0xA0, 0x00, 0xAD, 0x02, 0x02, 0xC9, 0x52,
+    0xF0, 0x0E, 0x20, 0x58, 0xF2, 0xC9, 0x57, 0xF0, 0x37, 0xC9, 0x45, 0xD0, 0x2E, 0x6C, 0x6F, 0x00,
+    0xB1, 0x6F, 0x85, 0x85, 0xAD, 0x74, 0x02, 0xC9, 0x06, 0x90, 0x1A, 0xAE, 0x05, 0x02, 0xCA, 0xF0,
+    0x14, 0x8A, 0x18, 0x65, 0x6F, 0xE6, 0x6F, 0x8D, 0x49, 0x02, 0xA5, 0x6F, 0x85, 0xA5, 0xA5, 0x70,
+    0x85, 0xA6, 0x4C, 0x43, 0xD4, 0x20, 0xEB, 0xD0, 0x4C, 0x3A, 0xD4, 0xA9, 0x31, 0x4C, 0xC8, 0xC1,
+    0xB9, 0x06, 0x02, 0x91, 0x6F, 0xC8, 0xCC, 0x05, 0x02, 0x90, 0xF5, 0x60, 0xAC, 0x01, 0x02, 0xC0,
+    0x30, 0xD0, 0x09, 0xA9, 0xEA, 0x85, 0x6B, 0xA9, 0xFF, 0x85, 0x6C, 0x60, 0x20, 0x72, 0xCB, 0x4C,
+    0x94, 0xC1, 0x88, 0x98, 0x29, 0x0F, 0x0A, 0xA8, 0xB1, 0x6B, 0x85, 0x75, 0xC8, 0xB1, 0x6B, 0x85,
+    0x76, 0x6C, 0x75, 0x00, 0xAD, 0x8E, 0x02, 0x85, 0x7F, 0xA5, 0x83, 0x48, 0x20, 0x3D, 0xC6, 0x68,
+    0x85, 0x83, 0xAE, 0x74, 0x02, 0xCA, 0xD0, 0x0D, 0xA9, 0x01, 0x20, 0xE2, 0xD1, 0x4C, 0xF1, 0xCB,
+    0xA9, 0x70, 0x4C, 0xC8, 0xC1, 0xA0, 0x01, 0x20, 0x7C, 0xCC, 0xAE, 0x85, 0x02, 0xE0, 0x05, 0xB0,
+    0xEF, 0xA9, 0x00, 0x85, 0x6F, 0x85, 0x70, 0x38, 0x26, 0x6F, 0x26, 0x70, 0xCA, 0x10, 0xF9, 0xA5,
+    0x6F, 0x2D, 0x4F, 0x02, 0xD0, 0xDA, 0xA5, 0x70, 0x2D, 0x50, 0x02, 0xD0, 0xD3, 0xA5, 0x6F, 0x0D,
+    0x4F, 0x02, 0x8D, 0x4F, 0x02, 0xA5, 0x70, 0x0D, 0x50, 0x02, 0x8D, 0x50, 0x02, 0xA9, 0x00, 0x20,
+    0xE2, 0xD1, 0xA6, 0x82, 0xAD, 0x85, 0x02, 0x95, 0xA7, 0xAA, 0xA5, 0x7F, 0x95, 0x00, 0x9D, 0x5B,
+    0x02, 0xA6, 0x83, 0xBD, 0x2B, 0x02, 0x09, 0x40, 0x9D, 0x2B, 0x02, 0xA4, 0x82, 0xA9, 0xFF, 0x99,
+    0x44, 0x02, 0xA9, 0x89, 0x99, 0xF2, 0x00, 0xB9, 0xA7, 0x00, 0x99, 0x3E, 0x02, 0x0A, 0xAA, 0xA9,
+    0x01, 0x95, 0x99, 0xA9, 0x0E, 0x99, 0xEC, 0x00, 0x4C, 0x94, 0xC1, 0xA0, 0x00, 0xA2, 0x00, 0xA9,
+    0x2D, 0x20, 0x68, 0xC2, 0xD0, 0x0A, 0xA9, 0x31, 0x4C, 0xC8, 0xC1, 0xA9, 0x30, 0x4C, 0xC8, 0xC1,
+    0x8A, 0xD0, 0xF8, 0xA2, 0x05, 0xB9, 0x00, 0x02, 0xDD, 0x5D, 0xCC, 0xF0, 0x05, 0xCA, 0x10, 0xF8,
+    0x30, 0xE4, 0x8A, 0x09, 0x80, 0x8D, 0x2A, 0x02, 0x20, 0x6F, 0xCC, 0xAD, 0x2A, 0x02, 0x0A, 0xAA,
+    0xBD, 0x64, 0xCC, 0x85, 0x70, 0xBD, 0x63, 0xCC, 0x85, 0x6F, 0x6C, 0x6F, 0x00, 0x41, 0x46, 0x52,
+    0x57, 0x45, 0x50, 0x03, 0xCD, 0xF5, 0xCC, 0x56, 0xCD, 0x73, 0xCD, 0xA3, 0xCD, 0xBD, 0xCD, 0xA0,
+    0x00, 0xA2, 0x00, 0xA9, 0x3A, 0x20, 0x68, 0xC2, 0xD0, 0x02, 0xA0, 0x03, 0xB9, 0x00, 0x02, 0xC9,
+    0x20, 0xF0, 0x08, 0xC9, 0x1D, 0xF0, 0x04, 0xC9, 0x2C, 0xD0, 0x07, 0xC8, 0xCC, 0x74, 0x02, 0x90,
+    0xEB, 0x60, 0x20, 0xA1, 0xCC, 0xEE, 0x77, 0x02, 0xAC, 0x79, 0x02, 0xE0, 0x04, 0x90, 0xEC, 0xB0,
+    0x8A, 0xA9, 0x00, 0x85, 0x6F, 0x85, 0x70, 0x85, 0x72, 0xA2, 0xFF, 0xB9, 0x00, 0x02, 0xC9, 0x40,
+    0xB0, 0x18, 0xC9, 0x30, 0x90, 0x14, 0x29, 0x0F, 0x48, 0xA5, 0x70, 0x85, 0x71, 0xA5, 0x6F, 0x85,
+    0x70, 0x68, 0x85, 0x6F, 0xC8, 0xCC, 0x74, 0x02, 0x90, 0xE1, 0x8C, 0x79, 0x02, 0x18, 0xA9, 0x00,
+    0xE8, 0xE0, 0x03, 0xB0, 0x0F, 0xB4, 0x6F, 0x88, 0x30, 0xF6, 0x7D, 0xF2, 0xCC, 0x90, 0xF8, 0x18,
+    0xE6, 0x72, 0xD0, 0xF3, 0x48, 0xAE, 0x77, 0x02, 0xA5, 0x72, 0x9D, 0x80, 0x02, 0x68, 0x9D, 0x85,
+    0x02, 0x60, 0x01, 0x0A, 0x64, 0x20, 0xF5, 0xCD, 0x20, 0x5F, 0xEF, 0x4C, 0x94, 0xC1, 0xA9, 0x01,
+    0x8D, 0xF9, 0x02, 0x20, 0xF5, 0xCD, 0xA5, 0x81, 0x48, 0x20, 0xFA, 0xF1, 0xF0, 0x0B, 0x68, 0xC5,
+    0x81, 0xD0, 0x19, 0x20, 0x90, 0xEF, 0x4C, 0x94, 0xC1, 0x68, 0xA9, 0x00, 0x85, 0x81, 0xE6, 0x80,
+    0xA5, 0x80, 0xCD, 0xD7, 0xFE, 0xB0, 0x0A, 0x20, 0xFA, 0xF1, 0xF0, 0xEE, 0xA9, 0x65, 0x20, 0x45,
+    0xE6, 0xA9, 0x65, 0x20, 0xC8, 0xC1, 0x20, 0xF2, 0xCD, 0x4C, 0x60, 0xD4, 0x20, 0x2F, 0xD1, 0xA1,
+    0x99, 0x60, 0x20, 0x36, 0xCD, 0xA9, 0x00, 0x20, 0xC8, 0xD4, 0x20, 0x3C, 0xCD, 0x99, 0x44, 0x02,
+    0xA9, 0x89, 0x99, 0xF2, 0x00, 0x60, 0x20, 0x42, 0xCD, 0x20, 0xEC, 0xD3, 0x4C, 0x94, 0xC1, 0x20,
+    0x6F, 0xCC, 0x20, 0x42, 0xCD, 0xB9, 0x44, 0x02, 0x99, 0x3E, 0x02, 0xA9, 0xFF, 0x99, 0x44, 0x02,
+    0x4C, 0x94, 0xC1, 0x20, 0xF2, 0xCD, 0x20, 0xE8, 0xD4, 0xA8, 0x88, 0xC9, 0x02, 0xB0, 0x02, 0xA0,
+    0x01, 0xA9, 0x00, 0x20, 0xC8, 0xD4, 0x98, 0x20, 0xF1, 0xCF, 0x8A, 0x48, 0x20, 0x64, 0xD4, 0x68,
+    0xAA, 0x20, 0xEE, 0xD3, 0x4C, 0x94, 0xC1, 0x20, 0x6F, 0xCC, 0x20, 0xF2, 0xCD, 0x20, 0x64, 0xD4,
+    0x4C, 0x94, 0xC1, 0x20, 0x58, 0xF2, 0x20, 0x36, 0xCD, 0xA9, 0x00, 0x85, 0x6F, 0xA6, 0xF9, 0xBD,
+    0xE0, 0xFE, 0x85, 0x70, 0x20, 0xBA, 0xCD, 0x4C, 0x94, 0xC1, 0x6C, 0x6F, 0x00, 0x20, 0xD2, 0xCD,
+    0xA5, 0xF9, 0x0A, 0xAA, 0xAD, 0x86, 0x02, 0x95, 0x99, 0x20, 0x2F, 0xD1, 0x20, 0xEE, 0xD3, 0x4C,
+    0x94, 0xC1, 0xA6, 0xD3, 0xE6, 0xD3, 0xBD, 0x85, 0x02, 0xA8, 0x88, 0x88, 0xC0, 0x0C, 0x90, 0x05,
+    0xA9, 0x70, 0x4C, 0xC8, 0xC1, 0x85, 0x83, 0x20, 0xEB, 0xD0, 0xB0, 0xF4, 0x20, 0x93, 0xDF, 0x85,
+    0xF9, 0x60, 0x20, 0xD2, 0xCD, 0xA6, 0xD3, 0xBD, 0x85, 0x02, 0x29, 0x01, 0x85, 0x7F, 0xBD, 0x87,
+    0x02, 0x85, 0x81, 0xBD, 0x86, 0x02, 0x85, 0x80, 0x20, 0x5F, 0xD5, 0x4C, 0x00, 0xC1, 0x20, 0x2C,
+    0xCE, 0x20, 0x6E, 0xCE, 0xA5, 0x90, 0x85, 0xD7, 0x20, 0x71, 0xCE, 0xE6, 0xD7, 0xE6, 0xD7, 0xA5,
+    0x8B, 0x85, 0xD5, 0xA5, 0x90, 0x0A, 0x18, 0x69, 0x10, 0x85, 0xD6, 0x60, 0x20, 0xD9, 0xCE, 0x85,
+    0x92, 0xA6, 0x82, 0xB5, 0xB5, 0x85, 0x90, 0xB5, 0xBB, 0x85, 0x91, 0xD0, 0x04, 0xA5, 0x90, 0xF0,
+    0x0B, 0xA5, 0x90, 0x38, 0xE9, 0x01, 0x85, 0x90, 0xB0, 0x02, 0xC6, 0x91, 0xB5, 0xC7, 0x85, 0x6F,
+    0x46, 0x6F, 0x90, 0x03, 0x20, 0xED, 0xCE, 0x20, 0xE5, 0xCE, 0xA5, 0x6F, 0xD0, 0xF2, 0xA5, 0xD4,
+    0x18, 0x65, 0x8B, 0x85, 0x8B, 0x90, 0x06, 0xE6, 0x8C, 0xD0, 0x02, 0xE6, 0x8D, 0x60, 0xA9, 0xFE,
+    0x2C, 0xA9, 0x78, 0x85, 0x6F, 0xA2, 0x03, 0xB5, 0x8F, 0x48, 0xB5, 0x8A, 0x95, 0x8F, 0x68, 0x95,
+    0x8A, 0xCA, 0xD0, 0xF3, 0x20, 0xD9, 0xCE, 0xA2, 0x00, 0xB5, 0x90, 0x95, 0x8F, 0xE8, 0xE0, 0x04,
+    0x90, 0xF7, 0xA9, 0x00, 0x85, 0x92, 0x24, 0x6F, 0x30, 0x09, 0x06, 0x8F, 0x08, 0x46, 0x8F, 0x28,
+    0x20, 0xE6, 0xCE, 0x20, 0xED, 0xCE, 0x20, 0xE5, 0xCE, 0x24, 0x6F, 0x30, 0x03, 0x20, 0xE2, 0xCE,
+    0xA5, 0x8F, 0x18, 0x65, 0x90, 0x85, 0x90, 0x90, 0x06, 0xE6, 0x91, 0xD0, 0x02, 0xE6, 0x92, 0xA5,
+    0x92, 0x05, 0x91, 0xD0, 0xC2, 0xA5, 0x90, 0x38, 0xE5, 0x6F, 0x90, 0x0C, 0xE6, 0x8B, 0xD0, 0x06,
+    0xE6, 0x8C, 0xD0, 0x02, 0xE6, 0x8D, 0x85, 0x90, 0x60, 0xA9, 0x00, 0x85, 0x8B, 0x85, 0x8C, 0x85,
+    0x8D, 0x60, 0x20, 0xE5, 0xCE, 0x18, 0x26, 0x90, 0x26, 0x91, 0x26, 0x92, 0x60, 0x18, 0xA2, 0xFD,
+    0xB5, 0x8E, 0x75, 0x93, 0x95, 0x8E, 0xE8, 0xD0, 0xF7, 0x60, 0xA2, 0x00, 0x8A, 0x95, 0xFA, 0xE8,
+    0xE0, 0x04, 0xD0, 0xF8, 0xA9, 0x06, 0x95, 0xFA, 0x60, 0xA0, 0x04, 0xA6, 0x82, 0xB9, 0xFA, 0x00,
+    0x96, 0xFA, 0xC5, 0x82, 0xF0, 0x07, 0x88, 0x30, 0xE1, 0xAA, 0x4C, 0x0D, 0xCF, 0x60, 0x20, 0x09,
+    0xCF, 0x20, 0xB7, 0xDF, 0xD0, 0x46, 0x20, 0xD3, 0xD1, 0x20, 0x8E, 0xD2, 0x30, 0x48, 0x20, 0xC2,
+    0xDF, 0xA5, 0x80, 0x48, 0xA5, 0x81, 0x48, 0xA9, 0x01, 0x20, 0xF6, 0xD4, 0x85, 0x81, 0xA9, 0x00,
+    0x20, 0xF6, 0xD4, 0x85, 0x80, 0xF0, 0x1F, 0x20, 0x25, 0xD1, 0xF0, 0x0B, 0x20, 0xAB, 0xDD, 0xD0,
+    0x06, 0x20, 0x8C, 0xCF, 0x4C, 0x5D, 0xCF, 0x20, 0x8C, 0xCF, 0x20, 0x57, 0xDE, 0x68, 0x85, 0x81,
+    0x68, 0x85, 0x80, 0x4C, 0x6F, 0xCF, 0x68, 0x85, 0x81, 0x68, 0x85, 0x80, 0x20, 0x8C, 0xCF, 0x20,
+    0x93, 0xDF, 0xAA, 0x4C, 0x99, 0xD5, 0xA9, 0x70, 0x4C, 0xC8, 0xC1, 0x20, 0x09, 0xCF, 0x20, 0xB7,
+    0xDF, 0xD0, 0x08, 0x20, 0x8E, 0xD2, 0x30, 0xEE, 0x20, 0xC2, 0xDF, 0x60, 0xA6, 0x82, 0xB5, 0xA7,
+    0x49, 0x80, 0x95, 0xA7, 0xB5, 0xAE, 0x49, 0x80, 0x95, 0xAE, 0x60, 0xA2, 0x12, 0x86, 0x83, 0x20,
+    0x07, 0xD1, 0x20, 0x00, 0xC1, 0x20, 0x25, 0xD1, 0x90, 0x05, 0xA9, 0x20, 0x20, 0x9D, 0xDD, 0xA5,
+    0x83, 0xC9, 0x0F, 0xF0, 0x23, 0xD0, 0x08, 0xA5, 0x84, 0x29, 0x8F, 0xC9, 0x0F, 0xB0, 0x19, 0x20,
+    0x25, 0xD1, 0xB0, 0x05, 0xA5, 0x85, 0x4C, 0x9D, 0xD1, 0xD0, 0x03, 0x4C, 0xAB, 0xE0, 0xA5, 0x85,
+    0x20, 0xF1, 0xCF, 0xA4, 0x82, 0x4C, 0xEE, 0xD3, 0xA9, 0x04, 0x85, 0x82, 0x20, 0xE8, 0xD4, 0xC9,
+    0x2A, 0xF0, 0x05, 0xA5, 0x85, 0x20, 0xF1, 0xCF, 0xA5, 0xF8, 0xF0, 0x01, 0x60, 0xEE, 0x55, 0x02,
+    0x60, 0x48, 0x20, 0x93, 0xDF, 0x10, 0x06, 0x68, 0xA9, 0x61, 0x4C, 0xC8, 0xC1, 0x0A, 0xAA, 0x68,
+    0x81, 0x99, 0xF6, 0x99, 0x60, 0x20, 0xD1, 0xC1, 0x20, 0x42, 0xD0, 0x4C, 0x94, 0xC1, 0x20, 0x0F,
+    0xF1, 0xA8, 0xB6, 0xA7, 0xE0, 0xFF, 0xD0, 0x14, 0x48, 0x20, 0x8E, 0xD2, 0xAA, 0x10, 0x05, 0xA9,
+    0x70, 0x20, 0x48, 0xE6, 0x68, 0xA8, 0x8A, 0x09, 0x80, 0x99, 0xA7, 0x00, 0x8A, 0x29, 0x0F, 0x85,
+    0xF9, 0xA2, 0x00, 0x86, 0x81, 0xAE, 0x85, 0xFE, 0x86, 0x80, 0x20, 0xD3, 0xD6, 0xA9, 0xB0, 0x4C,
+    0x8C, 0xD5, 0x20, 0xD1, 0xF0, 0x20, 0x13, 0xD3, 0x20, 0x0E, 0xD0, 0xA6, 0x7F, 0xA9, 0x00, 0x9D,
+    0x51, 0x02, 0x8A, 0x0A, 0xAA, 0xA5, 0x16, 0x95, 0x12, 0xA5, 0x17, 0x95, 0x13, 0x20, 0x86, 0xD5,
+    0xA5, 0xF9, 0x0A, 0xAA, 0xA9, 0x02, 0x95, 0x99, 0xA1, 0x99, 0xA6, 0x7F, 0x9D, 0x01, 0x01, 0xA9,
+    0x00, 0x95, 0x1C, 0x95, 0xFF, 0x20, 0x3A, 0xEF, 0xA0, 0x04, 0xA9, 0x00, 0xAA, 0x18, 0x71, 0x6D,
+    0x90, 0x01, 0xE8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC0, 0x48, 0xF0, 0xF8, 0xC0, 0x90, 0xD0, 0xEE, 0x48,
+    0x8A, 0xA6, 0x7F, 0x9D, 0xFC, 0x02, 0x68, 0x9D, 0xFA, 0x02, 0x60, 0x20, 0xD0, 0xD6, 0x20, 0xC3,
+    0xD0, 0x20, 0x99, 0xD5, 0x20, 0x37, 0xD1, 0x85, 0x80, 0x20, 0x37, 0xD1, 0x85, 0x81, 0x60, 0x20,
+    0x9B, 0xD0, 0xA5, 0x80, 0xD0, 0x01, 0x60, 0x20, 0x1E, 0xCF, 0x20, 0xD0, 0xD6, 0x20, 0xC3, 0xD0,
+    0x4C, 0x1E, 0xCF, 0xA9, 0x80, 0xD0, 0x02, 0xA9, 0x90, 0x8D, 0x4D, 0x02, 0x20, 0x93, 0xDF, 0xAA,
+    0x20, 0x06, 0xD5, 0x8A, 0x48, 0x0A, 0xAA, 0xA9, 0x00, 0x95, 0x99, 0x20, 0x25, 0xD1, 0xC9, 0x04,
+    0xB0, 0x06, 0xF6, 0xB5, 0xD0, 0x02, 0xF6, 0xBB, 0x68, 0xAA, 0x60, 0xA5, 0x83, 0xC9, 0x13, 0x90,
+    0x02, 0x29, 0x0F, 0xC9, 0x0F, 0xD0, 0x02, 0xA9, 0x10, 0xAA, 0x38, 0xBD, 0x2B, 0x02, 0x30, 0x06,
+    0x29, 0x0F, 0x85, 0x82, 0xAA, 0x18, 0x60, 0xA5, 0x83, 0xC9, 0x13, 0x90, 0x02, 0x29, 0x0F, 0xAA,
+    0xBD, 0x2B, 0x02, 0xA8, 0x0A, 0x90, 0x0A, 0x30, 0x0A, 0x98, 0x29, 0x0F, 0x85, 0x82, 0xAA, 0x18,
+    0x60, 0x30, 0xF6, 0x38, 0x60, 0xA6, 0x82, 0xB5, 0xEC, 0x4A, 0x29, 0x07, 0xC9, 0x04, 0x60, 0x20,
+    0x93, 0xDF, 0x0A, 0xAA, 0xA4, 0x82, 0x60, 0x20, 0x2F, 0xD1, 0xB9, 0x44, 0x02, 0xF0, 0x12, 0xA1,
+    0x99, 0x48, 0xB5, 0x99, 0xD9, 0x44, 0x02, 0xD0, 0x04, 0xA9, 0xFF, 0x95, 0x99, 0x68, 0xF6, 0x99,
+    0x60, 0xA1, 0x99, 0xF6, 0x99, 0x60, 0x20, 0x37, 0xD1, 0xD0, 0x36, 0x85, 0x85, 0xB9, 0x44, 0x02,
+    0xF0, 0x08, 0xA9, 0x80, 0x99, 0xF2, 0x00, 0xA5, 0x85, 0x60, 0x20, 0x1E, 0xCF, 0xA9, 0x00, 0x20,
+    0xC8, 0xD4, 0x20, 0x37, 0xD1, 0xC9, 0x00, 0xF0, 0x19, 0x85, 0x80, 0x20, 0x37, 0xD1, 0x85, 0x81,
+    0x20, 0x1E, 0xCF, 0x20, 0xD3, 0xD1, 0x20, 0xD0, 0xD6, 0x20, 0xC3, 0xD0, 0x20, 0x1E, 0xCF, 0xA5,
+    0x85, 0x60, 0x20, 0x37, 0xD1, 0xA4, 0x82, 0x99, 0x44, 0x02, 0xA5, 0x85, 0x60, 0x20, 0xF1, 0xCF,
+    0xF0, 0x01, 0x60, 0x20, 0xD3, 0xD1, 0x20, 0x1E, 0xF1, 0xA9, 0x00, 0x20, 0xC8, 0xD4, 0xA5, 0x80,
+    0x20, 0xF1, 0xCF, 0xA5, 0x81, 0x20, 0xF1, 0xCF, 0x20, 0xC7, 0xD0, 0x20, 0x1E, 0xCF, 0x20, 0xD0,
+    0xD6, 0xA9, 0x02, 0x4C, 0xC8, 0xD4, 0x85, 0x6F, 0x20, 0xE8, 0xD4, 0x18, 0x65, 0x6F, 0x95, 0x99,
+    0x85, 0x94, 0x60, 0x20, 0x93, 0xDF, 0xAA, 0xBD, 0x5B, 0x02, 0x29, 0x01, 0x85, 0x7F, 0x60, 0x38,
+    0xB0, 0x01, 0x18, 0x08, 0x85, 0x6F, 0x20, 0x27, 0xD2, 0x20, 0x7F, 0xD3, 0x85, 0x82, 0xA6, 0x83,
+    0x28, 0x90, 0x02, 0x09, 0x80, 0x9D, 0x2B, 0x02, 0x29, 0x3F, 0xA8, 0xA9, 0xFF, 0x99, 0xA7, 0x00,
+    0x99, 0xAE, 0x00, 0x99, 0xCD, 0x00, 0xC6, 0x6F, 0x30, 0x1C, 0x20, 0x8E, 0xD2, 0x10, 0x08, 0x20,
+    0x5A, 0xD2, 0xA9, 0x70, 0x4C, 0xC8, 0xC1, 0x99, 0xA7, 0x00, 0xC6, 0x6F, 0x30, 0x08, 0x20, 0x8E,
+    0xD2, 0x30, 0xEC, 0x99, 0xAE, 0x00, 0x60, 0xA5, 0x83, 0xC9, 0x0F, 0xD0, 0x01, 0x60, 0xA6, 0x83,
+    0xBD, 0x2B, 0x02, 0xC9, 0xFF, 0xF0, 0x22, 0x29, 0x3F, 0x85, 0x82, 0xA9, 0xFF, 0x9D, 0x2B, 0x02,
+    0xA6, 0x82, 0xA9, 0x00, 0x95, 0xF2, 0x20, 0x5A, 0xD2, 0xA6, 0x82, 0xA9, 0x01, 0xCA, 0x30, 0x03,
+    0x0A, 0xD0, 0xFA, 0x0D, 0x56, 0x02, 0x8D, 0x56, 0x02, 0x60, 0xA6, 0x82, 0xB5, 0xA7, 0xC9, 0xFF,
+    0xF0, 0x09, 0x48, 0xA9, 0xFF, 0x95, 0xA7, 0x68, 0x20, 0xF3, 0xD2, 0xA6, 0x82, 0xB5, 0xAE, 0xC9,
+    0xFF, 0xF0, 0x09, 0x48, 0xA9, 0xFF, 0x95, 0xAE, 0x68, 0x20, 0xF3, 0xD2, 0xA6, 0x82, 0xB5, 0xCD,
+    0xC9, 0xFF, 0xF0, 0x09, 0x48, 0xA9, 0xFF, 0x95, 0xCD, 0x68, 0x20, 0xF3, 0xD2, 0x60, 0x98, 0x48,
+    0xA0, 0x01, 0x20, 0xBA, 0xD2, 0x10, 0x0C, 0x88, 0x20, 0xBA, 0xD2, 0x10, 0x06, 0x20, 0x39, 0xD3,
+    0xAA, 0x30, 0x13, 0xB5, 0x00, 0x30, 0xFC, 0xA5, 0x7F, 0x95, 0x00, 0x9D, 0x5B, 0x02, 0x8A, 0x0A,
+    0xA8, 0xA9, 0x02, 0x99, 0x99, 0x00, 0x68, 0xA8, 0x8A, 0x60, 0xA2, 0x07, 0xB9, 0x4F, 0x02, 0x3D,
+    0xE9, 0xEF, 0xF0, 0x04, 0xCA, 0x10, 0xF5, 0x60, 0xB9, 0x4F, 0x02, 0x5D, 0xE9, 0xEF, 0x99, 0x4F,
+    0x02, 0x8A, 0x88, 0x30, 0x03, 0x18, 0x69, 0x08, 0xAA, 0x60, 0xA6, 0x82, 0xB5, 0xA7, 0x30, 0x09,
+    0x8A, 0x18, 0x69, 0x07, 0xAA, 0xB5, 0xA7, 0x10, 0xF0, 0xC9, 0xFF, 0xF0, 0xEC, 0x48, 0xA9, 0xFF,
+    0x95, 0xA7, 0x68, 0x29, 0x0F, 0xA8, 0xC8, 0xA2, 0x10, 0x6E, 0x50, 0x02, 0x6E, 0x4F, 0x02, 0x88,
+    0xD0, 0x01, 0x18, 0xCA, 0x10, 0xF3, 0x60, 0xA9, 0x0E, 0x85, 0x83, 0x20, 0x27, 0xD2, 0xC6, 0x83,
+    0xD0, 0xF9, 0x60, 0xA9, 0x0E, 0x85, 0x83, 0xA6, 0x83, 0xBD, 0x2B, 0x02, 0xC9, 0xFF, 0xF0, 0x14,
+    0x29, 0x3F, 0x85, 0x82, 0x20, 0x93, 0xDF, 0xAA, 0xBD, 0x5B, 0x02, 0x29, 0x01, 0xC5, 0x7F, 0xD0,
+    0x03, 0x20, 0x27, 0xD2, 0xC6, 0x83, 0x10, 0xDF, 0x60, 0xA5, 0x6F, 0x48, 0xA0, 0x00, 0xB6, 0xFA,
+    0xB5, 0xA7, 0x10, 0x04, 0xC9, 0xFF, 0xD0, 0x16, 0x8A, 0x18, 0x69, 0x07, 0xAA, 0xB5, 0xA7, 0x10,
+    0x04, 0xC9, 0xFF, 0xD0, 0x09, 0xC8, 0xC0, 0x05, 0x90, 0xE4, 0xA2, 0xFF, 0xD0, 0x1C, 0x86, 0x6F,
+    0x29, 0x3F, 0xAA, 0xB5, 0x00, 0x30, 0xFC, 0xC9, 0x02, 0x90, 0x08, 0xA6, 0x6F, 0xE0, 0x07, 0x90,
+    0xD7, 0xB0, 0xE2, 0xA4, 0x6F, 0xA9, 0xFF, 0x99, 0xA7, 0x00, 0x68, 0x85, 0x6F, 0x8A, 0x60, 0xA0,
+    0x00, 0xA9, 0x01, 0x2C, 0x56, 0x02, 0xD0, 0x09, 0xC8, 0x0A, 0xD0, 0xF7, 0xA9, 0x70, 0x4C, 0xC8,
+    0xC1, 0x49, 0xFF, 0x2D, 0x56, 0x02, 0x8D, 0x56, 0x02, 0x98, 0x60, 0x20, 0xEB, 0xD0, 0x20, 0x00,
+    0xC1, 0x20, 0xAA, 0xD3, 0xA6, 0x82, 0xBD, 0x3E, 0x02, 0x60, 0xA6, 0x82, 0x20, 0x25, 0xD1, 0xD0,
+    0x03, 0x4C, 0x20, 0xE1, 0xA5, 0x83, 0xC9, 0x0F, 0xF0, 0x5A, 0xB5, 0xF2, 0x29, 0x08, 0xD0, 0x13,
+    0x20, 0x25, 0xD1, 0xC9, 0x07, 0xD0, 0x07, 0xA9, 0x89, 0x95, 0xF2, 0x4C, 0xDE, 0xD3, 0xA9, 0x00,
+    0x95, 0xF2, 0x60, 0xA5, 0x83, 0xF0, 0x32, 0x20, 0x25, 0xD1, 0xC9, 0x04, 0x90, 0x22, 0x20, 0x2F,
+    0xD1, 0xB5, 0x99, 0xD9, 0x44, 0x02, 0xD0, 0x04, 0xA9, 0x00, 0x95, 0x99, 0xF6, 0x99, 0xA1, 0x99,
+    0x99, 0x3E, 0x02, 0xB5, 0x99, 0xD9, 0x44, 0x02, 0xD0, 0x05, 0xA9, 0x81, 0x99, 0xF2, 0x00, 0x60,
+    0x20, 0x56, 0xD1, 0xA6, 0x82, 0x9D, 0x3E, 0x02, 0x60, 0xAD, 0x54, 0x02, 0xF0, 0xF2, 0x20, 0x67,
+    0xED, 0x4C, 0x03, 0xD4, 0x20, 0xE8, 0xD4, 0xC9, 0xD4, 0xD0, 0x18, 0xA5, 0x95, 0xC9, 0x02, 0xD0,
+    0x12, 0xA9, 0x0D, 0x85, 0x85, 0x20, 0x23, 0xC1, 0xA9, 0x00, 0x20, 0xC1, 0xE6, 0xC6, 0xA5, 0xA9,
+    0x80, 0xD0, 0x12, 0x20, 0x37, 0xD1, 0x85, 0x85, 0xD0, 0x09, 0xA9, 0xD4, 0x20, 0xC8, 0xD4, 0xA9,
+    0x02, 0x95, 0x9A, 0xA9, 0x88, 0x85, 0xF7, 0xA5, 0x85, 0x8D, 0x43, 0x02, 0x60, 0x20, 0x93, 0xDF,
+    0x0A, 0xAA, 0xA9, 0x00, 0x95, 0x99, 0xA1, 0x99, 0xF0, 0x05, 0xD6, 0x99, 0x4C, 0x56, 0xD1, 0x60,
+    0xA9, 0x80, 0xD0, 0x02, 0xA9, 0x90, 0x05, 0x7F, 0x8D, 0x4D, 0x02, 0xA5, 0xF9, 0x20, 0xD3, 0xD6,
+    0xA6, 0xF9, 0x4C, 0x93, 0xD5, 0xA9, 0x01, 0x8D, 0x4A, 0x02, 0xA9, 0x11, 0x85, 0x83, 0x20, 0x46,
+    0xDC, 0xA9, 0x02, 0x4C, 0xC8, 0xD4, 0xA9, 0x12, 0x85, 0x83, 0x4C, 0xDA, 0xDC, 0x20, 0x3B, 0xDE,
+    0xA9, 0x01, 0x85, 0x6F, 0xA5, 0x69, 0x48, 0xA9, 0x03, 0x85, 0x69, 0x20, 0x2D, 0xF1, 0x68, 0x85,
+    0x69, 0xA9, 0x00, 0x20, 0xC8, 0xD4, 0xA5, 0x80, 0x20, 0xF1, 0xCF, 0xA5, 0x81, 0x20, 0xF1, 0xCF,
+    0x20, 0xC7, 0xD0, 0x20, 0x99, 0xD5, 0xA9, 0x00, 0x20, 0xC8, 0xD4, 0x20, 0xF1, 0xCF, 0xD0, 0xFB,
+    0x20, 0xF1, 0xCF, 0xA9, 0xFF, 0x4C, 0xF1, 0xCF, 0x85, 0x6F, 0x20, 0x93, 0xDF, 0x0A, 0xAA, 0xB5,
+    0x9A, 0x85, 0x95, 0xA5, 0x6F, 0x95, 0x99, 0x85, 0x94, 0x60, 0xA9, 0x11, 0x85, 0x83, 0x20, 0x27,
+    0xD2, 0xA9, 0x12, 0x85, 0x83, 0x4C, 0x27, 0xD2, 0x20, 0x93, 0xDF, 0x0A, 0xAA, 0xB5, 0x9A, 0x85,
+    0x95, 0xB5, 0x99, 0x85, 0x94, 0x60, 0x85, 0x71, 0x20, 0x93, 0xDF, 0xAA, 0xBD, 0xE0, 0xFE, 0x85,
+    0x72, 0xA0, 0x00, 0xB1, 0x71, 0x60, 0xBD, 0x5B, 0x02, 0x29, 0x01, 0x0D, 0x4D, 0x02, 0x48, 0x86,
+    0xF9, 0x8A, 0x0A, 0xAA, 0xB5, 0x07, 0x8D, 0x4D, 0x02, 0xB5, 0x06, 0xF0, 0x2D, 0xCD, 0xD7, 0xFE,
+    0xB0, 0x28, 0xAA, 0x68, 0x48, 0x29, 0xF0, 0xC9, 0x90, 0xD0, 0x4F, 0x68, 0x48, 0x4A, 0xB0, 0x05,
+    0xAD, 0x01, 0x01, 0x90, 0x03, 0xAD, 0x02, 0x01, 0xF0, 0x05, 0xCD, 0xD5, 0xFE, 0xD0, 0x33, 0x8A,
+    0x20, 0x4B, 0xF2, 0xCD, 0x4D, 0x02, 0xF0, 0x02, 0xB0, 0x30, 0x20, 0x52, 0xD5, 0xA9, 0x66, 0x4C,
+    0x45, 0xE6, 0xA5, 0xF9, 0x0A, 0xAA, 0xB5, 0x06, 0x85, 0x80, 0xB5, 0x07, 0x85, 0x81, 0x60, 0xA5,
+    0x80, 0xF0, 0xEA, 0xCD, 0xD7, 0xFE, 0xB0, 0xE5, 0x20, 0x4B, 0xF2, 0xC5, 0x81, 0xF0, 0xDE, 0x90,
+    0xDC, 0x60, 0x20, 0x52, 0xD5, 0xA9, 0x73, 0x4C, 0x45, 0xE6, 0xA6, 0xF9, 0x68, 0x8D, 0x4D, 0x02,
+    0x95, 0x00, 0x9D, 0x5B, 0x02, 0x60, 0xA9, 0x80, 0xD0, 0x02, 0xA9, 0x90, 0x05, 0x7F, 0xA6, 0xF9,
+    0x8D, 0x4D, 0x02, 0xAD, 0x4D, 0x02, 0x20, 0x0E, 0xD5, 0x20, 0xA6, 0xD5, 0xB0, 0xFB, 0x48, 0xA9,
+    0x00, 0x8D, 0x98, 0x02, 0x68, 0x60, 0xB5, 0x00, 0x30, 0x1A, 0xC9, 0x02, 0x90, 0x14, 0xC9, 0x08,
+    0xF0, 0x08, 0xC9, 0x0B, 0xF0, 0x04, 0xC9, 0x0F, 0xD0, 0x0C, 0x2C, 0x98, 0x02, 0x30, 0x03, 0x4C,
+    0x3F, 0xD6, 0x18, 0x60, 0x38, 0x60, 0x98, 0x48, 0xA5, 0x7F, 0x48, 0xBD, 0x5B, 0x02, 0x29, 0x01,
+    0x85, 0x7F, 0xA8, 0xB9, 0xCA, 0xFE, 0x8D, 0x6D, 0x02, 0x20, 0xA6, 0xD6, 0xC9, 0x02, 0xB0, 0x03,
+    0x4C, 0x6D, 0xD6, 0xBD, 0x5B, 0x02, 0x29, 0xF0, 0x48, 0xC9, 0x90, 0xD0, 0x07, 0xA5, 0x7F, 0x09,
+    0xB8, 0x9D, 0x5B, 0x02, 0x24, 0x6A, 0x70, 0x39, 0xA9, 0x00, 0x8D, 0x99, 0x02, 0x8D, 0x9A, 0x02,
+    0xAC, 0x99, 0x02, 0xAD, 0x9A, 0x02, 0x38, 0xF9, 0xDB, 0xFE, 0x8D, 0x9A, 0x02, 0xB9, 0xDB, 0xFE,
+    0x20, 0x76, 0xD6, 0xEE, 0x99, 0x02, 0x20, 0xA6, 0xD6, 0xC9, 0x02, 0x90, 0x08, 0xAC, 0x99, 0x02,
+    0xB9, 0xDB, 0xFE, 0xD0, 0xDB, 0xAD, 0x9A, 0x02, 0x20, 0x76, 0xD6, 0xB5, 0x00, 0xC9, 0x02, 0x90,
+    0x2B, 0x24, 0x6A, 0x10, 0x0F, 0x68, 0xC9, 0x90, 0xD0, 0x05, 0x05, 0x7F, 0x9D, 0x5B, 0x02, 0xB5,
+    0x00, 0x20, 0x0A, 0xE6, 0x68, 0x2C, 0x98, 0x02, 0x30, 0x23, 0x48, 0xA9, 0xC0, 0x05, 0x7F, 0x95,
+    0x00, 0xB5, 0x00, 0x30, 0xFC, 0x20, 0xA6, 0xD6, 0xC9, 0x02, 0xB0, 0xD9, 0x68, 0xC9, 0x90, 0xD0,
+    0x0C, 0x05, 0x7F, 0x9D, 0x5B, 0x02, 0x20, 0xA6, 0xD6, 0xC9, 0x02, 0xB0, 0xD2, 0x68, 0x85, 0x7F,
+    0x68, 0xA8, 0xB5, 0x00, 0x18, 0x60, 0xC9, 0x00, 0xF0, 0x18, 0x30, 0x0C, 0xA0, 0x01, 0x20, 0x93,
+    0xD6, 0x38, 0xE9, 0x01, 0xD0, 0xF6, 0xF0, 0x0A, 0xA0, 0xFF, 0x20, 0x93, 0xD6, 0x18, 0x69, 0x01,
+    0xD0, 0xF6, 0x60, 0x48, 0x98, 0xA4, 0x7F, 0x99, 0xFE, 0x02, 0xD9, 0xFE, 0x02, 0xF0, 0xFB, 0xA9,
+    0x00, 0x99, 0xFE, 0x02, 0x68, 0x60, 0xA5, 0x6A, 0x29, 0x3F, 0xA8, 0xAD, 0x6D, 0x02, 0x4D, 0x00,
+    0x1C, 0x8D, 0x00, 0x1C, 0xBD, 0x5B, 0x02, 0x95, 0x00, 0xB5, 0x00, 0x30, 0xFC, 0xC9, 0x02, 0x90,
+    0x03, 0x88, 0xD0, 0xE7, 0x48, 0xAD, 0x6D, 0x02, 0x0D, 0x00, 0x1C, 0x8D, 0x00, 0x1C, 0x68, 0x60,
+    0x20, 0x93, 0xDF, 0x0A, 0xA8, 0xA5, 0x80, 0x99, 0x06, 0x00, 0xA5, 0x81, 0x99, 0x07, 0x00, 0xA5,
+    0x7F, 0x0A, 0xAA, 0x60, 0xA5, 0x83, 0x48, 0xA5, 0x82, 0x48, 0xA5, 0x81, 0x48, 0xA5, 0x80, 0x48,
+    0xA9, 0x11, 0x85, 0x83, 0x20, 0x3B, 0xDE, 0xAD, 0x4A, 0x02, 0x48, 0xA5, 0xE2, 0x29, 0x01, 0x85,
+    0x7F, 0xA6, 0xF9, 0x5D, 0x5B, 0x02, 0x4A, 0x90, 0x0C, 0xA2, 0x01, 0x8E, 0x92, 0x02, 0x20, 0xAC,
+    0xC5, 0xF0, 0x1D, 0xD0, 0x28, 0xAD, 0x91, 0x02, 0xF0, 0x0C, 0xC5, 0x81, 0xF0, 0x1F, 0x85, 0x81,
+    0x20, 0x60, 0xD4, 0x4C, 0x3D, 0xD7, 0xA9, 0x01, 0x8D, 0x92, 0x02, 0x20, 0x17, 0xC6, 0xD0, 0x0D,
+    0x20, 0x8D, 0xD4, 0xA5, 0x81, 0x8D, 0x91, 0x02, 0xA9, 0x02, 0x8D, 0x92, 0x02, 0xAD, 0x92, 0x02,
+    0x20, 0xC8, 0xD4, 0x68, 0x8D, 0x4A, 0x02, 0xC9, 0x04, 0xD0, 0x02, 0x09, 0x80, 0x20, 0xF1, 0xCF,
+    0x68, 0x8D, 0x80, 0x02, 0x20, 0xF1, 0xCF, 0x68, 0x8D, 0x85, 0x02, 0x20, 0xF1, 0xCF, 0x20, 0x93,
+    0xDF, 0xA8, 0xAD, 0x7A, 0x02, 0xAA, 0xA9, 0x10, 0x20, 0x6E, 0xC6, 0xA0, 0x10, 0xA9, 0x00, 0x91,
+    0x94, 0xC8, 0xC0, 0x1B, 0x90, 0xF9, 0xAD, 0x4A, 0x02, 0xC9, 0x04, 0xD0, 0x13, 0xA0, 0x10, 0xAD,
+    0x59, 0x02, 0x91, 0x94, 0xC8, 0xAD, 0x5A, 0x02, 0x91, 0x94, 0xC8, 0xAD, 0x58, 0x02, 0x91, 0x94,
+    0x20, 0x64, 0xD4, 0x68, 0x85, 0x82, 0xAA, 0x68, 0x85, 0x83, 0xAD, 0x91, 0x02, 0x85, 0xD8, 0x9D,
+    0x60, 0x02, 0xAD, 0x92, 0x02, 0x85, 0xDD, 0x9D, 0x66, 0x02, 0xAD, 0x4A, 0x02, 0x85, 0xE7, 0xA5,
+    0x7F, 0x85, 0xE2, 0x60, 0xA5, 0x83, 0x8D, 0x4C, 0x02, 0x20, 0xB3, 0xC2, 0x8E, 0x2A, 0x02, 0xAE,
+    0x00, 0x02, 0xAD, 0x4C, 0x02, 0xD0, 0x2C, 0xE0, 0x2A, 0xD0, 0x28, 0xA5, 0x7E, 0xF0, 0x4D, 0x85,
+    0x80, 0xAD, 0x6E, 0x02, 0x85, 0x7F, 0x85, 0xE2, 0xA9, 0x02, 0x85, 0xE7, 0xAD, 0x6F, 0x02, 0x85,
+    0x81, 0x20, 0x00, 0xC1, 0x20, 0x46, 0xDC, 0xA9, 0x04, 0x05, 0x7F, 0xA6, 0x82, 0x99, 0xEC, 0x00,
+    0x4C, 0x94, 0xC1, 0xE0, 0x24, 0xD0, 0x1E, 0xAD, 0x4C, 0x02, 0xD0, 0x03, 0x4C, 0x55, 0xDA, 0x20,
+    0xD1, 0xC1, 0xAD, 0x85, 0xFE, 0x85, 0x80, 0xA9, 0x00, 0x85, 0x81, 0x20, 0x46, 0xDC, 0xA5, 0x7F,
+    0x09, 0x02, 0x4C, 0xEB, 0xD7, 0xE0, 0x23, 0xD0, 0x12, 0x4C, 0x84, 0xCB, 0xA9, 0x02, 0x8D, 0x96,
+    0x02, 0xA9, 0x00, 0x85, 0x7F, 0x8D, 0x8E, 0x02, 0x20, 0x42, 0xD0, 0x20, 0xE5, 0xC1, 0xD0, 0x04,
+    0xA2, 0x00, 0xF0, 0x0C, 0x8A, 0xF0, 0x05, 0xA9, 0x30, 0x4C, 0xC8, 0xC1, 0x88, 0xF0, 0x01, 0x88,
+    0x8C, 0x7A, 0x02, 0xA9, 0x8D, 0x20, 0x68, 0xC2, 0xE8, 0x8E, 0x78, 0x02, 0x20, 0x12, 0xC3, 0x20,
+    0xCA, 0xC3, 0x20, 0x9D, 0xC4, 0xA2, 0x00, 0x8E, 0x58, 0x02, 0x8E, 0x97, 0x02, 0x8E, 0x4A, 0x02,
+    0xE8, 0xEC, 0x77, 0x02, 0xB0, 0x10, 0x20, 0x09, 0xDA, 0xE8, 0xEC, 0x77, 0x02, 0xB0, 0x07, 0xC0,
+    0x04, 0xF0, 0x3E, 0x20, 0x09, 0xDA, 0xAE, 0x4C, 0x02, 0x86, 0x83, 0xE0, 0x02, 0xB0, 0x12, 0x8E,
+    0x97, 0x02, 0xA9, 0x40, 0x8D, 0xF9, 0x02, 0xAD, 0x4A, 0x02, 0xD0, 0x1B, 0xA9, 0x02, 0x8D, 0x4A,
+    0x02, 0xAD, 0x4A, 0x02, 0xD0, 0x11, 0xA5, 0xE7, 0x29, 0x07, 0x8D, 0x4A, 0x02, 0xAD, 0x80, 0x02,
+    0xD0, 0x05, 0xA9, 0x01, 0x8D, 0x4A, 0x02, 0xAD, 0x97, 0x02, 0xC9, 0x01, 0xF0, 0x18, 0x4C, 0x40,
+    0xD9, 0xBC, 0x7A, 0x02, 0xB9, 0x00, 0x02, 0x8D, 0x58, 0x02, 0xAD, 0x80, 0x02, 0xD0, 0xB7, 0xA9,
+    0x01, 0x8D, 0x97, 0x02, 0xD0, 0xB0, 0xA5, 0xE7, 0x29, 0x80, 0xAA, 0xD0, 0x14, 0xA9, 0x20, 0x24,
+    0xE7, 0xF0, 0x06, 0x20, 0xB6, 0xC8, 0x4C, 0xE3, 0xD9, 0xAD, 0x80, 0x02, 0xD0, 0x03, 0x4C, 0xE3,
+    0xD9, 0xAD, 0x00, 0x02, 0xC9, 0x40, 0xF0, 0x0D, 0x8A, 0xD0, 0x05, 0xA9, 0x63, 0x4C, 0xC8, 0xC1,
+    0xA9, 0x33, 0x4C, 0xC8, 0xC1, 0xA5, 0xE7, 0x29, 0x07, 0xCD, 0x4A, 0x02, 0xD0, 0x67, 0xC9, 0x04,
+    0xF0, 0x63, 0x20, 0xDA, 0xDC, 0xA5, 0x82, 0x8D, 0x70, 0x02, 0xA9, 0x11, 0x85, 0x83, 0x20, 0xEB,
+    0xD0, 0xAD, 0x94, 0x02, 0x20, 0xC8, 0xD4, 0xA0, 0x00, 0xB1, 0x94, 0x09, 0x20, 0x91, 0x94, 0xA0,
+    0x1A, 0xA5, 0x80, 0x91, 0x94, 0xC8, 0xA5, 0x81, 0x91, 0x94, 0xAE, 0x70, 0x02, 0xA5, 0xD8, 0x9D,
+    0x60, 0x02, 0xA5, 0xDD, 0x9D, 0x66, 0x02, 0x20, 0x3B, 0xDE, 0x20, 0x64, 0xD4, 0x4C, 0xEF, 0xD9,
+    0xAD, 0x80, 0x02, 0xD0, 0x05, 0xA9, 0x62, 0x4C, 0xC8, 0xC1, 0xAD, 0x97, 0x02, 0xC9, 0x03, 0xF0,
+    0x0B, 0xA9, 0x20, 0x24, 0xE7, 0xF0, 0x05, 0xA9, 0x60, 0x4C, 0xC8, 0xC1, 0xA5, 0xE7, 0x29, 0x07,
+    0xCD, 0x4A, 0x02, 0xF0, 0x05, 0xA9, 0x64, 0x4C, 0xC8, 0xC1, 0xA0, 0x00, 0x8C, 0x79, 0x02, 0xAE,
+    0x97, 0x02, 0xE0, 0x02, 0xD0, 0x1A, 0xC9, 0x04, 0xF0, 0xEB, 0xB1, 0x94, 0x29, 0x4F, 0x91, 0x94,
+    0xA5, 0x83, 0x48, 0xA9, 0x11, 0x85, 0x83, 0x20, 0x3B, 0xDE, 0x20, 0x64, 0xD4, 0x68, 0x85, 0x83,
+    0x20, 0xA0, 0xD9, 0xAD, 0x97, 0x02, 0xC9, 0x02, 0xD0, 0x55, 0x20, 0x2A, 0xDA, 0x4C, 0x94, 0xC1,
+    0xA0, 0x13, 0xB1, 0x94, 0x8D, 0x59, 0x02, 0xC8, 0xB1, 0x94, 0x8D, 0x5A, 0x02, 0xC8, 0xB1, 0x94,
+    0xAE, 0x58, 0x02, 0x8D, 0x58, 0x02, 0x8A, 0xF0, 0x0A, 0xCD, 0x58, 0x02, 0xF0, 0x05, 0xA9, 0x50,
+    0x20, 0xC8, 0xC1, 0xAE, 0x79, 0x02, 0xBD, 0x80, 0x02, 0x85, 0x80, 0xBD, 0x85, 0x02, 0x85, 0x81,
+    0x20, 0x46, 0xDC, 0xA4, 0x82, 0xAE, 0x79, 0x02, 0xB5, 0xD8, 0x99, 0x60, 0x02, 0xB5, 0xDD, 0x99,
+    0x66, 0x02, 0x60, 0xA5, 0xE2, 0x29, 0x01, 0x85, 0x7F, 0x20, 0xDA, 0xDC, 0x20, 0xE4, 0xD6, 0xA5,
+    0x83, 0xC9, 0x02, 0xB0, 0x11, 0x20, 0x3E, 0xDE, 0xA5, 0x80, 0x85, 0x7E, 0xA5, 0x7F, 0x8D, 0x6E,
+    0x02, 0xA5, 0x81, 0x8D, 0x6F, 0x02, 0x4C, 0x99, 0xC1, 0xBC, 0x7A, 0x02, 0xB9, 0x00, 0x02, 0xA0,
+    0x04, 0x88, 0x30, 0x08, 0xD9, 0xB2, 0xFE, 0xD0, 0xF8, 0x8C, 0x97, 0x02, 0xA0, 0x05, 0x88, 0x30,
+    0x08, 0xD9, 0xB6, 0xFE, 0xD0, 0xF8, 0x8C, 0x4A, 0x02, 0x60, 0x20, 0x39, 0xCA, 0xA9, 0x80, 0x20,
+    0xA6, 0xDD, 0xF0, 0xF6, 0x20, 0x95, 0xDE, 0xA6, 0x81, 0xE8, 0x8A, 0xD0, 0x05, 0x20, 0xA3, 0xD1,
+    0xA9, 0x02, 0x20, 0xC8, 0xD4, 0xA6, 0x82, 0xA9, 0x01, 0x95, 0xF2, 0xA9, 0x80, 0x05, 0x82, 0xA6,
+    0x83, 0x9D, 0x2B, 0x02, 0x60, 0xA9, 0x0C, 0x8D, 0x2A, 0x02, 0xA9, 0x00, 0xAE, 0x74, 0x02, 0xCA,
+    0xF0, 0x0B, 0xCA, 0xD0, 0x21, 0xAD, 0x01, 0x02, 0x20, 0xBD, 0xC3, 0x30, 0x19, 0x85, 0xE2, 0xEE,
+    0x77, 0x02, 0xEE, 0x78, 0x02, 0xEE, 0x7A, 0x02, 0xA9, 0x80, 0x85, 0xE7, 0xA9, 0x2A, 0x8D, 0x00,
+    0x02, 0x8D, 0x01, 0x02, 0xD0, 0x18, 0x20, 0xE5, 0xC1, 0xD0, 0x05, 0x20, 0xDC, 0xC2, 0xA0, 0x03,
+    0x88, 0x88, 0x8C, 0x7A, 0x02, 0x20, 0x00, 0xC2, 0x20, 0x98, 0xC3, 0x20, 0x20, 0xC3, 0x20, 0xCA,
+    0xC3, 0x20, 0xB7, 0xC7, 0x20, 0x9D, 0xC4, 0x20, 0x9E, 0xEC, 0x20, 0x37, 0xD1, 0xA6, 0x82, 0x9D,
+    0x3E, 0x02, 0xA5, 0x7F, 0x8D, 0x8E, 0x02, 0x09, 0x04, 0x95, 0xEC, 0xA9, 0x00, 0x85, 0xA3, 0x60,
+    0xA9, 0x00, 0x8D, 0xF9, 0x02, 0xA5, 0x83, 0xD0, 0x0B, 0xA9, 0x00, 0x8D, 0x54, 0x02, 0x20, 0x27,
+    0xD2, 0x4C, 0xDA, 0xD4, 0xC9, 0x0F, 0xF0, 0x14, 0x20, 0x02, 0xDB, 0xA5, 0x83, 0xC9, 0x02, 0x90,
+    0xF0, 0xAD, 0x6C, 0x02, 0xD0, 0x03, 0x4C, 0x94, 0xC1, 0x4C, 0xAD, 0xC1, 0xA9, 0x0E, 0x85, 0x83,
+    0x20, 0x02, 0xDB, 0xC6, 0x83, 0x10, 0xF9, 0xAD, 0x6C, 0x02, 0xD0, 0x03, 0x4C, 0x94, 0xC1, 0x4C,
+    0xAD, 0xC1, 0xA6, 0x83, 0xBD, 0x2B, 0x02, 0xC9, 0xFF, 0xD0, 0x01, 0x60, 0x29, 0x0F, 0x85, 0x82,
+    0x20, 0x25, 0xD1, 0xC9, 0x07, 0xF0, 0x0F, 0xC9, 0x04, 0xF0, 0x11, 0x20, 0x07, 0xD1, 0xB0, 0x09,
+    0x20, 0x62, 0xDB, 0x20, 0xA5, 0xDB, 0x20, 0xF4, 0xEE, 0x4C, 0x27, 0xD2, 0x20, 0xF1, 0xDD, 0x20,
+    0x1E, 0xCF, 0x20, 0xCB, 0xE1, 0xA6, 0xD5, 0x86, 0x73, 0xE6, 0x73, 0xA9, 0x00, 0x85, 0x70, 0x85,
+    0x71, 0xA5, 0xD6, 0x38, 0xE9, 0x0E, 0x85, 0x72, 0x20, 0x51, 0xDF, 0xA6, 0x82, 0xA5, 0x70, 0x95,
+    0xB5, 0xA5, 0x71, 0x95, 0xBB, 0xA9, 0x40, 0x20, 0xA6, 0xDD, 0xF0, 0x03, 0x20, 0xA5, 0xDB, 0x4C,
+    0x27, 0xD2, 0xA6, 0x82, 0xB5, 0xB5, 0x15, 0xBB, 0xD0, 0x0C, 0x20, 0xE8, 0xD4, 0xC9, 0x02, 0xD0,
+    0x05, 0xA9, 0x0D, 0x20, 0xF1, 0xCF, 0x20, 0xE8, 0xD4, 0xC9, 0x02, 0xD0, 0x0F, 0x20, 0x1E, 0xCF,
+    0xA6, 0x82, 0xB5, 0xB5, 0xD0, 0x02, 0xD6, 0xBB, 0xD6, 0xB5, 0xA9, 0x00, 0x38, 0xE9, 0x01, 0x48,
+    0xA9, 0x00, 0x20, 0xC8, 0xD4, 0x20, 0xF1, 0xCF, 0x68, 0x20, 0xF1, 0xCF, 0x20, 0xC7, 0xD0, 0x20,
+    0x99, 0xD5, 0x4C, 0x1E, 0xCF, 0xA6, 0x82, 0x8E, 0x70, 0x02, 0xA5, 0x83, 0x48, 0xBD, 0x60, 0x02,
+    0x85, 0x81, 0xBD, 0x66, 0x02, 0x8D, 0x94, 0x02, 0xB5, 0xEC, 0x29, 0x01, 0x85, 0x7F, 0xAD, 0x85,
+    0xFE, 0x85, 0x80, 0x20, 0x93, 0xDF, 0x48, 0x85, 0xF9, 0x20, 0x60, 0xD4, 0xA0, 0x00, 0xBD, 0xE0,
+    0xFE, 0x85, 0x87, 0xAD, 0x94, 0x02, 0x85, 0x86, 0xB1, 0x86, 0x29, 0x20, 0xF0, 0x43, 0x20, 0x25,
+    0xD1, 0xC9, 0x04, 0xF0, 0x44, 0xB1, 0x86, 0x29, 0x8F, 0x91, 0x86, 0xC8, 0xB1, 0x86, 0x85, 0x80,
+    0x84, 0x71, 0xA0, 0x1B, 0xB1, 0x86, 0x48, 0x88, 0xB1, 0x86, 0xD0, 0x0A, 0x85, 0x80, 0x68, 0x85,
+    0x81, 0xA9, 0x67, 0x20, 0x45, 0xE6, 0x48, 0xA9, 0x00, 0x91, 0x86, 0xC8, 0x91, 0x86, 0x68, 0xA4,
+    0x71, 0x91, 0x86, 0xC8, 0xB1, 0x86, 0x85, 0x81, 0x68, 0x91, 0x86, 0x20, 0x7D, 0xC8, 0x4C, 0x29,
+    0xDC, 0xB1, 0x86, 0x29, 0x0F, 0x09, 0x80, 0x91, 0x86, 0xAE, 0x70, 0x02, 0xA0, 0x1C, 0xB5, 0xB5,
+    0x91, 0x86, 0xC8, 0xB5, 0xBB, 0x91, 0x86, 0x68, 0xAA, 0xA9, 0x90, 0x05, 0x7F, 0x20, 0x90, 0xD5,
+    0x68, 0x85, 0x83, 0x4C, 0x07, 0xD1, 0xA9, 0x01, 0x20, 0xE2, 0xD1, 0x20, 0xB6, 0xDC, 0xAD, 0x4A,
+    0x02, 0x48, 0x0A, 0x05, 0x7F, 0x95, 0xEC, 0x20, 0x9B, 0xD0, 0xA6, 0x82, 0xA5, 0x80, 0xD0, 0x05,
+    0xA5, 0x81, 0x9D, 0x44, 0x02, 0x68, 0xC9, 0x04, 0xD0, 0x3F, 0xA4, 0x83, 0xB9, 0x2B, 0x02, 0x09,
+    0x40, 0x99, 0x2B, 0x02, 0xAD, 0x58, 0x02, 0x95, 0xC7, 0x20, 0x8E, 0xD2, 0x10, 0x03, 0x4C, 0x0F,
+    0xD2, 0xA6, 0x82, 0x95, 0xCD, 0xAC, 0x59, 0x02, 0x84, 0x80, 0xAC, 0x5A, 0x02, 0x84, 0x81, 0x20,
+    0xD3, 0xD6, 0x20, 0x73, 0xDE, 0x20, 0x99, 0xD5, 0xA6, 0x82, 0xA9, 0x02, 0x95, 0xC1, 0xA9, 0x00,
+    0x20, 0xC8, 0xD4, 0x20, 0x53, 0xE1, 0x4C, 0x3E, 0xDE, 0x20, 0x56, 0xD1, 0xA6, 0x82, 0x9D, 0x3E,
+    0x02, 0xA9, 0x88, 0x95, 0xF2, 0x60, 0xA6, 0x82, 0xB5, 0xA7, 0x0A, 0xA8, 0xA9, 0x02, 0x99, 0x99,
+    0x00, 0xB5, 0xAE, 0x09, 0x80, 0x95, 0xAE, 0x0A, 0xA8, 0xA9, 0x02, 0x99, 0x99, 0x00, 0xA9, 0x00,
+    0x95, 0xB5, 0x95, 0xBB, 0xA9, 0x00, 0x9D, 0x44, 0x02, 0x60, 0x20, 0xA9, 0xF1, 0xA9, 0x01, 0x20,
+    0xDF, 0xD1, 0x20, 0xD0, 0xD6, 0x20, 0xB6, 0xDC, 0xA6, 0x82, 0xAD, 0x4A, 0x02, 0x48, 0x0A, 0x05,
+    0x7F, 0x95, 0xEC, 0x68, 0xC9, 0x04, 0xF0, 0x05, 0xA9, 0x01, 0x95, 0xF2, 0x60, 0xA4, 0x83, 0xB9,
+    0x2B, 0x02, 0x29, 0x3F, 0x09, 0x40, 0x99, 0x2B, 0x02, 0xAD, 0x58, 0x02, 0x95, 0xC7, 0x20, 0x8E,
+    0xD2, 0x10, 0x03, 0x4C, 0x0F, 0xD2, 0xA6, 0x82, 0x95, 0xCD, 0x20, 0xC1, 0xDE, 0x20, 0x1E, 0xF1,
+    0xA5, 0x80, 0x8D, 0x59, 0x02, 0xA5, 0x81, 0x8D, 0x5A, 0x02, 0xA6, 0x82, 0xB5, 0xCD, 0x20, 0xD3,
+    0xD6, 0xA9, 0x00, 0x20, 0xE9, 0xDE, 0xA9, 0x00, 0x20, 0x8D, 0xDD, 0xA9, 0x11, 0x20, 0x8D, 0xDD,
+    0xA9, 0x00, 0x20, 0x8D, 0xDD, 0xAD, 0x58, 0x02, 0x20, 0x8D, 0xDD, 0xA5, 0x80, 0x20, 0x8D, 0xDD,
+    0xA5, 0x81, 0x20, 0x8D, 0xDD, 0xA9, 0x10, 0x20, 0xE9, 0xDE, 0x20, 0x3E, 0xDE, 0xA5, 0x80, 0x20,
+    0x8D, 0xDD, 0xA5, 0x81, 0x20, 0x8D, 0xDD, 0x20, 0x6C, 0xDE, 0x20, 0x99, 0xD5, 0xA9, 0x02, 0x20,
+    0xC8, 0xD4, 0xA6, 0x82, 0x38, 0xA9, 0x00, 0xF5, 0xC7, 0x95, 0xC1, 0x20, 0xE2, 0xE2, 0x20, 0x19,
+    0xDE, 0x20, 0x5E, 0xDE, 0x20, 0x99, 0xD5, 0x20, 0xF4, 0xEE, 0x4C, 0x98, 0xDC, 0x48, 0xA6, 0x82,
+    0xB5, 0xCD, 0x4C, 0xFD, 0xCF, 0x90, 0x06, 0xA6, 0x82, 0x15, 0xEC, 0xD0, 0x06, 0xA6, 0x82, 0x49,
+    0xFF, 0x35, 0xEC, 0x95, 0xEC, 0x60, 0xA6, 0x82, 0x35, 0xEC, 0x60, 0x20, 0x93, 0xDF, 0xAA, 0xBD,
+    0x5B, 0x02, 0x29, 0xF0, 0xC9, 0x90, 0x60, 0xA2, 0x00, 0x86, 0x71, 0xBD, 0x2B, 0x02, 0xC9, 0xFF,
+    0xD0, 0x08, 0xA6, 0x71, 0xE8, 0xE0, 0x10, 0x90, 0xF0, 0x60, 0x86, 0x71, 0x29, 0x3F, 0xA8, 0xB9,
+    0xEC, 0x00, 0x29, 0x01, 0x85, 0x70, 0xAE, 0x53, 0x02, 0xB5, 0xE2, 0x29, 0x01, 0xC5, 0x70, 0xD0,
+    0xE1, 0xB9, 0x60, 0x02, 0xD5, 0xD8, 0xD0, 0xDA, 0xB9, 0x66, 0x02, 0xD5, 0xDD, 0xD0, 0xD3, 0x18,
+    0x60, 0x20, 0x9E, 0xDF, 0x50, 0x06, 0x20, 0x5E, 0xDE, 0x20, 0x99, 0xD5, 0x60, 0x20, 0x2B, 0xDE,
+    0xA5, 0x80, 0x91, 0x94, 0xC8, 0xA5, 0x81, 0x91, 0x94, 0x4C, 0x05, 0xE1, 0x20, 0x2B, 0xDE, 0xB1,
+    0x94, 0x85, 0x80, 0xC8, 0xB1, 0x94, 0x85, 0x81, 0x60, 0x20, 0x2B, 0xDE, 0xA9, 0x00, 0x91, 0x94,
+    0xC8, 0xA6, 0x82, 0xB5, 0xC1, 0xAA, 0xCA, 0x8A, 0x91, 0x94, 0x60, 0x20, 0x93, 0xDF, 0x0A, 0xAA,
+    0xB5, 0x9A, 0x85, 0x95, 0xA9, 0x00, 0x85, 0x94, 0xA0, 0x00, 0x60, 0x20, 0xEB, 0xD0, 0x20, 0x93,
+    0xDF, 0x85, 0xF9, 0x0A, 0xA8, 0xB9, 0x06, 0x00, 0x85, 0x80, 0xB9, 0x07, 0x00, 0x85, 0x81, 0x60,
+    0xA9, 0x90, 0x8D, 0x4D, 0x02, 0xD0, 0x28, 0xA9, 0x80, 0x8D, 0x4D, 0x02, 0xD0, 0x21, 0xA9, 0x90,
+    0x8D, 0x4D, 0x02, 0xD0, 0x26, 0xA9, 0x80, 0x8D, 0x4D, 0x02, 0xD0, 0x1F, 0xA9, 0x90, 0x8D, 0x4D,
+    0x02, 0xD0, 0x02, 0xA9, 0x80, 0x8D, 0x4D, 0x02, 0xA6, 0x82, 0xB5, 0xCD, 0xAA, 0x10, 0x13, 0x20,
+    0xD0, 0xD6, 0x20, 0x93, 0xDF, 0xAA, 0xA5, 0x7F, 0x9D, 0x5B, 0x02, 0x20, 0x15, 0xE1, 0x20, 0x93,
+    0xDF, 0xAA, 0x4C, 0x06, 0xD5, 0xA9, 0x00, 0x20, 0xC8, 0xD4, 0x20, 0x37, 0xD1, 0x85, 0x80, 0x20,
+    0x37, 0xD1, 0x85, 0x81, 0x60, 0x48, 0xA9, 0x00, 0x85, 0x6F, 0x85, 0x71, 0xB9, 0xE0, 0xFE, 0x85,
+    0x70, 0xBD, 0xE0, 0xFE, 0x85, 0x72, 0x68, 0xA8, 0x88, 0xB1, 0x6F, 0x91, 0x71, 0x88, 0x10, 0xF9,
+    0x60, 0xA8, 0xB9, 0xE0, 0xFE, 0x85, 0x70, 0xA9, 0x00, 0x85, 0x6F, 0xA8, 0x91, 0x6F, 0xC8, 0xD0,
+    0xFB, 0x60, 0xA9, 0x00, 0x20, 0xDC, 0xDE, 0xA0, 0x02, 0xB1, 0x94, 0x60, 0x85, 0x94, 0xA6, 0x82,
+    0xB5, 0xCD, 0xAA, 0xBD, 0xE0, 0xFE, 0x85, 0x95, 0x60, 0x48, 0x20, 0xDC, 0xDE, 0x48, 0x8A, 0x0A,
+    0xAA, 0x68, 0x95, 0x9A, 0x68, 0x95, 0x99, 0x60, 0x20, 0x66, 0xDF, 0x30, 0x0E, 0x50, 0x13, 0xA6,
+    0x82, 0xB5, 0xCD, 0x20, 0x1B, 0xDF, 0x20, 0x66, 0xDF, 0x10, 0x07, 0x20, 0xCB, 0xE1, 0x2C, 0xCE,
+    0xFE, 0x60, 0xA5, 0xD6, 0x20, 0xE9, 0xDE, 0x2C, 0xCD, 0xFE, 0x60, 0x85, 0xF9, 0xA9, 0x80, 0xD0,
+    0x04, 0x85, 0xF9, 0xA9, 0x90, 0x48, 0xB5, 0xEC, 0x29, 0x01, 0x85, 0x7F, 0x68, 0x05, 0x7F, 0x8D,
+    0x4D, 0x02, 0xB1, 0x94, 0x85, 0x80, 0xC8, 0xB1, 0x94, 0x85, 0x81, 0xA5, 0xF9, 0x20, 0xD3, 0xD6,
+    0xA6, 0xF9, 0x4C, 0x93, 0xD5, 0xA6, 0x82, 0xB5, 0xCD, 0x4C, 0xEB, 0xD4, 0xA9, 0x78, 0x20, 0x5C,
+    0xDF, 0xCA, 0x10, 0xF8, 0xA5, 0x72, 0x4A, 0x20, 0x5C, 0xDF, 0xA5, 0x73, 0x18, 0x65, 0x70, 0x85,
+    0x70, 0x90, 0x02, 0xE6, 0x71, 0x60, 0x20, 0xD2, 0xDE, 0xC5, 0xD5, 0xD0, 0x0E, 0xA4, 0xD6, 0xB1,
+    0x94, 0xF0, 0x04, 0x2C, 0xCD, 0xFE, 0x60, 0x2C, 0xCF, 0xFE, 0x60, 0xA5, 0xD5, 0xC9, 0x06, 0xB0,
+    0x0A, 0x0A, 0xA8, 0xA9, 0x04, 0x85, 0x94, 0xB1, 0x94, 0xD0, 0x04, 0x2C, 0xD0, 0xFE, 0x60, 0x2C,
+    0xCE, 0xFE, 0x60, 0xA6, 0x82, 0xB5, 0xA7, 0x10, 0x02, 0xB5, 0xAE, 0x29, 0xBF, 0x60, 0xA6, 0x82,
+    0x8E, 0x57, 0x02, 0xB5, 0xA7, 0x10, 0x09, 0x8A, 0x18, 0x69, 0x07, 0x8D, 0x57, 0x02, 0xB5, 0xAE,
+    0x85, 0x70, 0x29, 0x1F, 0x24, 0x70, 0x60, 0xA6, 0x82, 0xB5, 0xA7, 0x30, 0x02, 0xB5, 0xAE, 0xC9,
+    0xFF, 0x60, 0xA6, 0x82, 0x09, 0x80, 0xB4, 0xA7, 0x10, 0x03, 0x95, 0xA7, 0x60, 0x95, 0xAE, 0x60,
+    0xA9, 0x20, 0x20, 0x9D, 0xDD, 0xA9, 0x80, 0x20, 0xA6, 0xDD, 0xD0, 0x41, 0xA6, 0x82, 0xF6, 0xB5,
+    0xD0, 0x02, 0xF6, 0xBB, 0xA6, 0x82, 0xB5, 0xC1, 0xF0, 0x2E, 0x20, 0xE8, 0xD4, 0xA6, 0x82, 0xD5,
+    0xC1, 0x90, 0x03, 0x20, 0x3C, 0xE0, 0xA6, 0x82, 0xB5, 0xC1, 0x20, 0xC8, 0xD4, 0xA1, 0x99, 0x85,
+    0x85, 0xA9, 0x20, 0x20, 0x9D, 0xDD, 0x20, 0x04, 0xE3, 0x48, 0x90, 0x28, 0xA9, 0x00, 0x20, 0xF6,
+    0xD4, 0xD0, 0x21, 0x68, 0xC9, 0x02, 0xF0, 0x12, 0xA9, 0x80, 0x20, 0x97, 0xDD, 0x20, 0x2F, 0xD1,
+    0xB5, 0x99, 0x99, 0x44, 0x02, 0xA9, 0x0D, 0x85, 0x85, 0x60, 0x20, 0x35, 0xE0, 0xA6, 0x82, 0xA9,
+    0x00, 0x95, 0xC1, 0x60, 0x68, 0xA6, 0x82, 0x95, 0xC1, 0x4C, 0x6E, 0xE1, 0x20, 0xD3, 0xD1, 0x20,
+    0x95, 0xDE, 0x20, 0x9E, 0xDF, 0x50, 0x16, 0x20, 0x5E, 0xDE, 0x20, 0x1E, 0xCF, 0xA9, 0x02, 0x20,
+    0xC8, 0xD4, 0x20, 0xAB, 0xDD, 0xD0, 0x24, 0x20, 0x57, 0xDE, 0x4C, 0x99, 0xD5, 0x20, 0x1E, 0xCF,
+    0x20, 0xAB, 0xDD, 0xD0, 0x06, 0x20, 0x57, 0xDE, 0x20, 0x99, 0xD5, 0x20, 0x95, 0xDE, 0xA5, 0x80,
+    0xF0, 0x09, 0x20, 0x1E, 0xCF, 0x20, 0x57, 0xDE, 0x20, 0x1E, 0xCF, 0x60, 0x20, 0x05, 0xE1, 0x20,
+    0x93, 0xDF, 0x0A, 0xAA, 0xA5, 0x85, 0x81, 0x99, 0xB4, 0x99, 0xC8, 0xD0, 0x09, 0xA4, 0x82, 0xB9,
+    0xC1, 0x00, 0xF0, 0x0A, 0xA0, 0x02, 0x98, 0xA4, 0x82, 0xD9, 0xC1, 0x00, 0xD0, 0x05, 0xA9, 0x20,
+    0x4C, 0x97, 0xDD, 0xF6, 0x99, 0xD0, 0x03, 0x20, 0x3C, 0xE0, 0x60, 0xA9, 0xA0, 0x20, 0xA6, 0xDD,
+    0xD0, 0x27, 0xA5, 0x85, 0x20, 0x7C, 0xE0, 0xA5, 0xF8, 0xF0, 0x0D, 0x60, 0xA9, 0x20, 0x20, 0xA6,
+    0xDD, 0xF0, 0x05, 0xA9, 0x51, 0x8D, 0x6C, 0x02, 0x20, 0xF3, 0xE0, 0x20, 0x53, 0xE1, 0xAD, 0x6C,
+    0x02, 0xF0, 0x03, 0x4C, 0xC8, 0xC1, 0x4C, 0xBC, 0xE6, 0x29, 0x80, 0xD0, 0x05, 0xA5, 0xF8, 0xF0,
+    0xDB, 0x60, 0xA5, 0x85, 0x48, 0x20, 0x1C, 0xE3, 0x68, 0x85, 0x85, 0xA9, 0x80, 0x20, 0x9D, 0xDD,
+    0x4C, 0xB2, 0xE0, 0xA9, 0x20, 0x20, 0xA6, 0xDD, 0xD0, 0x0A, 0xA9, 0x00, 0x85, 0x85, 0x20, 0x7C,
+    0xE0, 0x4C, 0xF3, 0xE0, 0x60, 0xA9, 0x40, 0x20, 0x97, 0xDD, 0x20, 0x9E, 0xDF, 0x09, 0x40, 0xAE,
+    0x57, 0x02, 0x95, 0xA7, 0x60, 0x20, 0x9E, 0xDF, 0x29, 0xBF, 0xAE, 0x57, 0x02, 0x95, 0xA7, 0x60,
+    0xA9, 0x80, 0x20, 0xA6, 0xDD, 0xD0, 0x37, 0x20, 0x2F, 0xD1, 0xB5, 0x99, 0xD9, 0x44, 0x02, 0xF0,
+    0x22, 0xF6, 0x99, 0xD0, 0x06, 0x20, 0x3C, 0xE0, 0x20, 0x2F, 0xD1, 0xA1, 0x99, 0x99, 0x3E, 0x02,
+    0xA9, 0x89, 0x99, 0xF2, 0x00, 0xB5, 0x99, 0xD9, 0x44, 0x02, 0xF0, 0x01, 0x60, 0xA9, 0x81, 0x99,
+    0xF2, 0x00, 0x60, 0x20, 0xD0, 0xDF, 0x20, 0x2F, 0xD1, 0xA5, 0x85, 0x4C, 0x3D, 0xE1, 0xA6, 0x82,
+    0xA9, 0x0D, 0x9D, 0x3E, 0x02, 0xA9, 0x81, 0x95, 0xF2, 0xA9, 0x50, 0x20, 0xC8, 0xC1, 0xA6, 0x82,
+    0xB5, 0xC1, 0x85, 0x87, 0xC6, 0x87, 0xC9, 0x02, 0xD0, 0x04, 0xA9, 0xFF, 0x85, 0x87, 0xB5, 0xC7,
+    0x85, 0x88, 0x20, 0xE8, 0xD4, 0xA6, 0x82, 0xC5, 0x87, 0x90, 0x19, 0xF0, 0x17, 0x20, 0x1E, 0xCF,
+    0x20, 0xB2, 0xE1, 0x90, 0x08, 0xA6, 0x82, 0x9D, 0x44, 0x02, 0x4C, 0x1E, 0xCF, 0x20, 0x1E, 0xCF,
+    0xA9, 0xFF, 0x85, 0x87, 0x20, 0xB2, 0xE1, 0xB0, 0x03, 0x20, 0xE8, 0xD4, 0xA6, 0x82, 0x9D, 0x44,
+    0x02, 0x60, 0x20, 0x2B, 0xDE, 0xA4, 0x87, 0xB1, 0x94, 0xD0, 0x0D, 0x88, 0xC0, 0x02, 0x90, 0x04,
+    0xC6, 0x88, 0xD0, 0xF3, 0xC6, 0x88, 0x18, 0x60, 0x98, 0x38, 0x60, 0x20, 0xD2, 0xDE, 0x85, 0xD5,
+    0xA9, 0x04, 0x85, 0x94, 0xA0, 0x0A, 0xD0, 0x04, 0x88, 0x88, 0x30, 0x26, 0xB1, 0x94, 0xF0, 0xF8,
+    0x98, 0x4A, 0xC5, 0xD5, 0xF0, 0x09, 0x85, 0xD5, 0xA6, 0x82, 0xB5, 0xCD, 0x20, 0x1B, 0xDF, 0xA0,
+    0x00, 0x84, 0x94, 0xB1, 0x94, 0xD0, 0x0B, 0xC8, 0xB1, 0x94, 0xA8, 0x88, 0x84, 0xD6, 0x98, 0x4C,
+    0xE9, 0xDE, 0xA9, 0x67, 0x20, 0x45, 0xE6, 0x20, 0xB3, 0xC2, 0xAD, 0x01, 0x02, 0x85, 0x83, 0x20,
+    0xEB, 0xD0, 0x90, 0x05, 0xA9, 0x70, 0x20, 0xC8, 0xC1, 0xA9, 0xA0, 0x20, 0x9D, 0xDD, 0x20, 0x25,
+    0xD1, 0xF0, 0x05, 0xA9, 0x64, 0x20, 0xC8, 0xC1, 0xB5, 0xEC, 0x29, 0x01, 0x85, 0x7F, 0xAD, 0x02,
+    0x02, 0x95, 0xB5, 0xAD, 0x03, 0x02, 0x95, 0xBB, 0xA6, 0x82, 0xA9, 0x89, 0x95, 0xF2, 0xAD, 0x04,
+    0x02, 0xF0, 0x10, 0x38, 0xE9, 0x01, 0xF0, 0x0B, 0xD5, 0xC7, 0x90, 0x07, 0xA9, 0x51, 0x8D, 0x6C,
+    0x02, 0xA9, 0x00, 0x85, 0xD4, 0x20, 0x0E, 0xCE, 0x20, 0xF8, 0xDE, 0x50, 0x08, 0xA9, 0x80, 0x20,
+    0x97, 0xDD, 0x4C, 0x5E, 0xE1, 0x20, 0x75, 0xE2, 0xA9, 0x80, 0x20, 0xA6, 0xDD, 0xF0, 0x03, 0x4C,
+    0x5E, 0xE1, 0x4C, 0x94, 0xC1, 0x20, 0x9C, 0xE2, 0xA5, 0xD7, 0x20, 0xC8, 0xD4, 0xA6, 0x82, 0xB5,
+    0xC7, 0x38, 0xE5, 0xD4, 0xB0, 0x03, 0x4C, 0x02, 0xE2, 0x18, 0x65, 0xD7, 0x90, 0x03, 0x69, 0x01,
+    0x38, 0x20, 0x09, 0xE0, 0x4C, 0x38, 0xE1, 0xA9, 0x51, 0x20, 0xC8, 0xC1, 0xA5, 0x94, 0x85, 0x89,
+    0xA5, 0x95, 0x85, 0x8A, 0x20, 0xD0, 0xE2, 0xD0, 0x01, 0x60, 0x20, 0xF1, 0xDD, 0x20, 0x0C, 0xDE,
+    0xA5, 0x80, 0xF0, 0x0E, 0x20, 0xD3, 0xE2, 0xD0, 0x06, 0x20, 0x1E, 0xCF, 0x4C, 0xDA, 0xD2, 0x20,
+    0xDA, 0xD2, 0xA0, 0x00, 0xB1, 0x89, 0x85, 0x80, 0xC8, 0xB1, 0x89, 0x85, 0x81, 0x4C, 0xAF, 0xD0,
+    0x20, 0x3E, 0xDE, 0xA0, 0x00, 0xB1, 0x89, 0xC5, 0x80, 0xF0, 0x01, 0x60, 0xC8, 0xB1, 0x89, 0xC5,
+    0x81, 0x60, 0x20, 0x2B, 0xDE, 0xA0, 0x02, 0xA9, 0x00, 0x91, 0x94, 0xC8, 0xD0, 0xFB, 0x20, 0x04,
+    0xE3, 0x95, 0xC1, 0xA8, 0xA9, 0xFF, 0x91, 0x94, 0x20, 0x04, 0xE3, 0x90, 0xF4, 0xD0, 0x04, 0xA9,
+    0x00, 0x95, 0xC1, 0x60, 0xA6, 0x82, 0xB5, 0xC1, 0x38, 0xF0, 0x0D, 0x18, 0x75, 0xC7, 0x90, 0x0B,
+    0xD0, 0x06, 0xA9, 0x02, 0x2C, 0xCC, 0xFE, 0x60, 0x69, 0x01, 0x38, 0x60, 0x20, 0xD3, 0xD1, 0x20,
+    0xCB, 0xE1, 0x20, 0x9C, 0xE2, 0x20, 0x7B, 0xCF, 0xA5, 0xD6, 0x85, 0x87, 0xA5, 0xD5, 0x85, 0x86,
+    0xA9, 0x00, 0x85, 0x88, 0xA9, 0x00, 0x85, 0xD4, 0x20, 0x0E, 0xCE, 0x20, 0x4D, 0xEF, 0xA4, 0x82,
+    0xB6, 0xC7, 0xCA, 0x8A, 0x18, 0x65, 0xD7, 0x90, 0x0C, 0xE6, 0xD6, 0xE6, 0xD6, 0xD0, 0x06, 0xE6,
+    0xD5, 0xA9, 0x10, 0x85, 0xD6, 0xA5, 0x87, 0x18, 0x69, 0x02, 0x20, 0xE9, 0xDE, 0xA5, 0xD5, 0xC9,
+    0x06, 0x90, 0x05, 0xA9, 0x52, 0x20, 0xC8, 0xC1, 0xA5, 0xD6, 0x38, 0xE5, 0x87, 0xB0, 0x03, 0xE9,
+    0x0F, 0x18, 0x85, 0x72, 0xA5, 0xD5, 0xE5, 0x86, 0x85, 0x73, 0xA2, 0x00, 0x86, 0x70, 0x86, 0x71,
+    0xAA, 0x20, 0x51, 0xDF, 0xA5, 0x71, 0xD0, 0x07, 0xA6, 0x70, 0xCA, 0xD0, 0x02, 0xE6, 0x88, 0xCD,
+    0x73, 0x02, 0x90, 0x09, 0xD0, 0xCD, 0xAD, 0x72, 0x02, 0xC5, 0x70, 0x90, 0xC6, 0xA9, 0x01, 0x20,
+    0xF6, 0xD4, 0x18, 0x69, 0x01, 0xA6, 0x82, 0x95, 0xC1, 0x20, 0x1E, 0xF1, 0x20, 0xFD, 0xDD, 0xA5,
+    0x88, 0xD0, 0x15, 0x20, 0x5E, 0xDE, 0x20, 0x1E, 0xCF, 0x20, 0xD0, 0xD6, 0x20, 0x1E, 0xF1, 0x20,
+    0xFD, 0xDD, 0x20, 0xE2, 0xE2, 0x4C, 0xD4, 0xE3, 0x20, 0x1E, 0xCF, 0x20, 0xD0, 0xD6, 0x20, 0xE2,
+    0xE2, 0x20, 0x19, 0xDE, 0x20, 0x5E, 0xDE, 0x20, 0x0C, 0xDE, 0xA5, 0x80, 0x48, 0xA5, 0x81, 0x48,
+    0x20, 0x3E, 0xDE, 0xA5, 0x81, 0x48, 0xA5, 0x80, 0x48, 0x20, 0x45, 0xDF, 0xAA, 0xD0, 0x0A, 0x20,
+    0x4E, 0xE4, 0xA9, 0x10, 0x20, 0xE9, 0xDE, 0xE6, 0x86, 0x68, 0x20, 0x8D, 0xDD, 0x68, 0x20, 0x8D,
+    0xDD, 0x68, 0x85, 0x81, 0x68, 0x85, 0x80, 0xF0, 0x0F, 0xA5, 0x86, 0xC5, 0xD5, 0xD0, 0xA7, 0x20,
+    0x45, 0xDF, 0xC5, 0xD6, 0x90, 0xA0, 0xF0, 0xB0, 0x20, 0x45, 0xDF, 0x48, 0xA9, 0x00, 0x20, 0xDC,
+    0xDE, 0xA9, 0x00, 0xA8, 0x91, 0x94, 0xC8, 0x68, 0x38, 0xE9, 0x01, 0x91, 0x94, 0x20, 0x6C, 0xDE,
+    0x20, 0x99, 0xD5, 0x20, 0xF4, 0xEE, 0x20, 0x0E, 0xCE, 0x20, 0x1E, 0xCF, 0x20, 0xF8, 0xDE, 0x70,
+    0x03, 0x4C, 0x75, 0xE2, 0xA9, 0x80, 0x20, 0x97, 0xDD, 0xA9, 0x50, 0x20, 0xC8, 0xC1, 0x20, 0x1E,
+    0xF1, 0x20, 0x1E, 0xCF, 0x20, 0xF1, 0xDD, 0x20, 0x93, 0xDF, 0x48, 0x20, 0xC1, 0xDE, 0xA6, 0x82,
+    0xB5, 0xCD, 0xA8, 0x68, 0xAA, 0xA9, 0x10, 0x20, 0xA5, 0xDE, 0xA9, 0x00, 0x20, 0xDC, 0xDE, 0xA0,
+    0x02, 0xB1, 0x94, 0x48, 0xA9, 0x00, 0x20, 0xC8, 0xD4, 0x68, 0x18, 0x69, 0x01, 0x91, 0x94, 0x0A,
+    0x69, 0x04, 0x85, 0x89, 0xA8, 0x38, 0xE9, 0x02, 0x85, 0x8A, 0xA5, 0x80, 0x85, 0x87, 0x91, 0x94,
+    0xC8, 0xA5, 0x81, 0x85, 0x88, 0x91, 0x94, 0xA0, 0x00, 0x98, 0x91, 0x94, 0xC8, 0xA9, 0x11, 0x91,
+    0x94, 0xA9, 0x10, 0x20, 0xC8, 0xD4, 0x20, 0x50, 0xDE, 0x20, 0x99, 0xD5, 0xA6, 0x82, 0xB5, 0xCD,
+    0x48, 0x20, 0x9E, 0xDF, 0xA6, 0x82, 0x95, 0xCD, 0x68, 0xAE, 0x57, 0x02, 0x95, 0xA7, 0xA9, 0x00,
+    0x20, 0xC8, 0xD4, 0xA0, 0x00, 0xA5, 0x80, 0x91, 0x94, 0xC8, 0xA5, 0x81, 0x91, 0x94, 0x4C, 0xDE,
+    0xE4, 0x20, 0x93, 0xDF, 0xA6, 0x82, 0x20, 0x1B, 0xDF, 0xA9, 0x00, 0x20, 0xC8, 0xD4, 0xC6, 0x8A,
+    0xC6, 0x8A, 0xA4, 0x89, 0xA5, 0x87, 0x91, 0x94, 0xC8, 0xA5, 0x88, 0x91, 0x94, 0x20, 0x5E, 0xDE,
+    0x20, 0x99, 0xD5, 0xA4, 0x8A, 0xC0, 0x03, 0xB0, 0xD8, 0x4C, 0x1E, 0xCF, 0x00, 0xA0, 0x4F, 0xCB,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x27, 0xD2, 0x45, 0x41, 0x44, 0x89, 0x52, 0x83, 0x20, 0x54, 0x4F,
+    0x4F, 0x20, 0x4C, 0x41, 0x52, 0x47, 0xC5, 0x50, 0x8B, 0x06, 0x20, 0x50, 0x52, 0x45, 0x53, 0x45,
+    0x4E, 0xD4, 0x51, 0xCF, 0x56, 0x45, 0x52, 0x46, 0x4C, 0x4F, 0x57, 0x20, 0x49, 0x4E, 0x8B, 0x25,
+    0x28, 0x8A, 0x89, 0x26, 0x8A, 0x20, 0x50, 0x52, 0x4F, 0x54, 0x45, 0x43, 0x54, 0x20, 0x4F, 0xCE,
+    0x29, 0x88, 0x20, 0x49, 0x44, 0x85, 0x30, 0x31, 0x32, 0x33, 0x34, 0xD3, 0x59, 0x4E, 0x54, 0x41,
+    0x58, 0x89, 0x60, 0x8A, 0x03, 0x84, 0x63, 0x83, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0xD3, 0x64,
+    0x83, 0x20, 0x54, 0x59, 0x50, 0x45, 0x85, 0x65, 0xCE, 0x4F, 0x20, 0x42, 0x4C, 0x4F, 0x43, 0xCB,
+    0x66, 0x67, 0xC9, 0x4C, 0x4C, 0x45, 0x47, 0x41, 0x4C, 0x20, 0x54, 0x52, 0x41, 0x43, 0x4B, 0x20,
+    0x4F, 0x52, 0x20, 0x53, 0x45, 0x43, 0x54, 0x4F, 0xD2, 0x61, 0x83, 0x06, 0x84, 0x39, 0x62, 0x83,
+    0x06, 0x87, 0x01, 0x83, 0x53, 0x20, 0x53, 0x43, 0x52, 0x41, 0x54, 0x43, 0x48, 0x45, 0xC4, 0x70,
+    0xCE, 0x4F, 0x20, 0x43, 0x48, 0x41, 0x4E, 0x4E, 0x45, 0xCC, 0x71, 0xC4, 0x49, 0x52, 0x89, 0x72,
+    0x88, 0x20, 0x46, 0x55, 0x4C, 0xCC, 0x73, 0xC3, 0x42, 0x4D, 0x20, 0x44, 0x4F, 0x53, 0x20, 0x56,
+    0x32, 0x2E, 0x36, 0x20, 0x31, 0x35, 0x34, 0xB1, 0x74, 0xC4, 0x52, 0x49, 0x56, 0x45, 0x06, 0x20,
+    0x52, 0x45, 0x41, 0x44, 0xD9, 0x09, 0xC5, 0x52, 0x52, 0x4F, 0xD2, 0x0A, 0xD7, 0x52, 0x49, 0x54,
+    0xC5, 0x03, 0xC6, 0x49, 0x4C, 0xC5, 0x04, 0xCF, 0x50, 0x45, 0xCE, 0x05, 0xCD, 0x49, 0x53, 0x4D,
+    0x41, 0x54, 0x43, 0xC8, 0x06, 0xCE, 0x4F, 0xD4, 0x07, 0xC6, 0x4F, 0x55, 0x4E, 0xC4, 0x08, 0xC4,
+    0x49, 0x53, 0xCB, 0x0B, 0xD2, 0x45, 0x43, 0x4F, 0x52, 0xC4, 0x48, 0x86, 0xF9, 0x8A, 0x0A, 0xAA,
+    0xB5, 0x06, 0x85, 0x80, 0xB5, 0x07, 0x85, 0x81, 0x68, 0x29, 0x0F, 0xF0, 0x08, 0xC9, 0x0F, 0xD0,
+    0x06, 0xA9, 0x74, 0xD0, 0x08, 0xA9, 0x06, 0x09, 0x20, 0xAA, 0xCA, 0xCA, 0x8A, 0x48, 0xAD, 0x2A,
+    0x02, 0xC9, 0x00, 0xD0, 0x0F, 0xA9, 0xFF, 0x8D, 0x2A, 0x02, 0x68, 0x20, 0xC7, 0xE6, 0x20, 0x42,
+    0xD0, 0x4C, 0x48, 0xE6, 0x68, 0x20, 0xC7, 0xE6, 0x20, 0xBD, 0xC1, 0xA9, 0x00, 0x8D, 0xF9, 0x02,
+    0x20, 0x2C, 0xC1, 0x20, 0xDA, 0xD4, 0xA9, 0x00, 0x85, 0xA3, 0xA2, 0x45, 0x9A, 0xA5, 0x84, 0x29,
+    0x0F, 0x85, 0x83, 0xC9, 0x0F, 0xF0, 0x31, 0x78, 0xA5, 0x79, 0xD0, 0x1C, 0xA5, 0x7A, 0xD0, 0x10,
+    0xA6, 0x83, 0xBD, 0x2B, 0x02, 0xC9, 0xFF, 0xF0, 0x1F, 0x29, 0x0F, 0x85, 0x82, 0x4C, 0x8E, 0xE6,
+    0x20, 0xEB, 0xD0, 0x20, 0x4E, 0xEA, 0xD0, 0x06, 0x20, 0x07, 0xD1, 0x20, 0x4E, 0xEA, 0x20, 0x25,
+    0xD1, 0xC9, 0x04, 0xB0, 0x03, 0x20, 0x27, 0xD2, 0x4C, 0xE7, 0xEB, 0xAA, 0xA9, 0x00, 0xF8, 0xE0,
+    0x00, 0xF0, 0x07, 0x18, 0x69, 0x01, 0xCA, 0x4C, 0x9F, 0xE6, 0xD8, 0xAA, 0x4A, 0x4A, 0x4A, 0x4A,
+    0x20, 0xB4, 0xE6, 0x8A, 0x29, 0x0F, 0x09, 0x30, 0x91, 0xA5, 0xC8, 0x60, 0x20, 0x23, 0xC1, 0xA9,
+    0x00, 0xA0, 0x00, 0x84, 0x80, 0x84, 0x81, 0xA0, 0x00, 0xA2, 0xD5, 0x86, 0xA5, 0xA2, 0x02, 0x86,
+    0xA6, 0x20, 0xAB, 0xE6, 0xA9, 0x2C, 0x91, 0xA5, 0xC8, 0xAD, 0xD5, 0x02, 0x8D, 0x43, 0x02, 0x8A,
+    0x20, 0x06, 0xE7, 0xA9, 0x2C, 0x91, 0xA5, 0xC8, 0xA5, 0x80, 0x20, 0x9B, 0xE6, 0xA9, 0x2C, 0x91,
+    0xA5, 0xC8, 0xA5, 0x81, 0x20, 0x9B, 0xE6, 0x88, 0x98, 0x18, 0x69, 0xD5, 0x8D, 0x49, 0x02, 0xE6,
+    0xA5, 0xA9, 0x88, 0x85, 0xF7, 0x60, 0xAA, 0xA5, 0x86, 0x48, 0xA5, 0x87, 0x48, 0xA9, 0xFC, 0x85,
+    0x86, 0xA9, 0xE4, 0x85, 0x87, 0x8A, 0xA2, 0x00, 0xC1, 0x86, 0xF0, 0x21, 0x48, 0x20, 0x75, 0xE7,
+    0x90, 0x05, 0x20, 0x75, 0xE7, 0x90, 0xFB, 0xA5, 0x87, 0xC9, 0xE6, 0x90, 0x08, 0xD0, 0x0A, 0xA9,
+    0x0A, 0xC5, 0x86, 0x90, 0x04, 0x68, 0x4C, 0x18, 0xE7, 0x68, 0x4C, 0x4D, 0xE7, 0x20, 0x67, 0xE7,
+    0x90, 0xFB, 0x20, 0x54, 0xE7, 0x20, 0x67, 0xE7, 0x90, 0xF8, 0x20, 0x54, 0xE7, 0x68, 0x85, 0x87,
+    0x68, 0x85, 0x86, 0x60, 0xC9, 0x20, 0xB0, 0x0B, 0xAA, 0xA9, 0x20, 0x91, 0xA5, 0xC8, 0x8A, 0x20,
+    0x06, 0xE7, 0x60, 0x91, 0xA5, 0xC8, 0x60, 0xE6, 0x86, 0xD0, 0x02, 0xE6, 0x87, 0xA1, 0x86, 0x0A,
+    0xA1, 0x86, 0x29, 0x7F, 0x60, 0x20, 0x6D, 0xE7, 0xE6, 0x86, 0xD0, 0x02, 0xE6, 0x87, 0x60, 0x60,
+    0xAD, 0x00, 0x18, 0xAA, 0x29, 0x04, 0xF0, 0xF7, 0x8A, 0x29, 0x01, 0xF0, 0xF2, 0x58, 0xAD, 0x00,
+    0x18, 0x29, 0x05, 0xD0, 0xF9, 0xEE, 0x78, 0x02, 0xEE, 0x74, 0x02, 0xA9, 0x2A, 0x8D, 0x00, 0x02,
+    0x4C, 0xA8, 0xE7, 0xA9, 0x8D, 0x20, 0x68, 0xC2, 0x20, 0x58, 0xF2, 0xAD, 0x78, 0x02, 0x48, 0xA9,
+    0x01, 0x8D, 0x78, 0x02, 0xA9, 0xFF, 0x85, 0x86, 0x20, 0x4F, 0xC4, 0xAD, 0x80, 0x02, 0xD0, 0x05,
+    0xA9, 0x39, 0x20, 0xC8, 0xC1, 0x68, 0x8D, 0x78, 0x02, 0xAD, 0x80, 0x02, 0x85, 0x80, 0xAD, 0x85,
+    0x02, 0x85, 0x81, 0xA9, 0x03, 0x20, 0x77, 0xD4, 0xA9, 0x00, 0x85, 0x87, 0x20, 0x39, 0xE8, 0x85,
+    0x88, 0x20, 0x4B, 0xE8, 0x20, 0x39, 0xE8, 0x85, 0x89, 0x20, 0x4B, 0xE8, 0xA5, 0x86, 0xF0, 0x0A,
+    0xA5, 0x88, 0x48, 0xA5, 0x89, 0x48, 0xA9, 0x00, 0x85, 0x86, 0x20, 0x39, 0xE8, 0x85, 0x8A, 0x20,
+    0x4B, 0xE8, 0x20, 0x39, 0xE8, 0xA0, 0x00, 0x91, 0x88, 0x20, 0x4B, 0xE8, 0xA5, 0x88, 0x18, 0x69,
+    0x01, 0x85, 0x88, 0x90, 0x02, 0xE6, 0x89, 0xC6, 0x8A, 0xD0, 0xE7, 0x20, 0x35, 0xCA, 0xA5, 0x85,
+    0xC5, 0x87, 0xF0, 0x08, 0x20, 0x3E, 0xDE, 0xA9, 0x50, 0x20, 0x45, 0xE6, 0xA5, 0xF8, 0xD0, 0xA8,
+    0x68, 0x85, 0x89, 0x68, 0x85, 0x88, 0x6C, 0x88, 0x00, 0x20, 0x35, 0xCA, 0xA5, 0xF8, 0xD0, 0x08,
+    0x20, 0x3E, 0xDE, 0xA9, 0x51, 0x20, 0x45, 0xE6, 0xA5, 0x85, 0x60, 0x18, 0x65, 0x87, 0x69, 0x00,
+    0x85, 0x87, 0x60, 0xAD, 0x01, 0x18, 0xA9, 0x01, 0x85, 0x7C, 0x60, 0x78, 0xA9, 0x00, 0x85, 0x7C,
+    0x85, 0x79, 0x85, 0x7A, 0xA2, 0x45, 0x9A, 0xA9, 0x80, 0x85, 0xF8, 0x85, 0x7D, 0x20, 0xB7, 0xE9,
+    0x20, 0xA5, 0xE9, 0xAD, 0x00, 0x18, 0x09, 0x10, 0x8D, 0x00, 0x18, 0xAD, 0x00, 0x18, 0x10, 0x57,
+    0x29, 0x04, 0xD0, 0xF7, 0x20, 0xC9, 0xE9, 0xC9, 0x3F, 0xD0, 0x06, 0xA9, 0x00, 0x85, 0x79, 0xF0,
+    0x71, 0xC9, 0x5F, 0xD0, 0x06, 0xA9, 0x00, 0x85, 0x7A, 0xF0, 0x67, 0xC5, 0x78, 0xD0, 0x0A, 0xA9,
+    0x01, 0x85, 0x7A, 0xA9, 0x00, 0x85, 0x79, 0xF0, 0x29, 0xC5, 0x77, 0xD0, 0x0A, 0xA9, 0x01, 0x85,
+    0x79, 0xA9, 0x00, 0x85, 0x7A, 0xF0, 0x1B, 0xAA, 0x29, 0x60, 0xC9, 0x60, 0xD0, 0x3F, 0x8A, 0x85,
+    0x84, 0x29, 0x0F, 0x85, 0x83, 0xA5, 0x84, 0x29, 0xF0, 0xC9, 0xE0, 0xD0, 0x35, 0x58, 0x20, 0xC0,
+    0xDA, 0x78, 0x2C, 0x00, 0x18, 0x30, 0xAD, 0xA9, 0x00, 0x85, 0x7D, 0xAD, 0x00, 0x18, 0x29, 0xEF,
+    0x8D, 0x00, 0x18, 0xA5, 0x79, 0xF0, 0x06, 0x20, 0x2E, 0xEA, 0x4C, 0xE7, 0xEB, 0xA5, 0x7A, 0xF0,
+    0x09, 0x20, 0x9C, 0xE9, 0x20, 0xAE, 0xE9, 0x20, 0x09, 0xE9, 0x4C, 0x4E, 0xEA, 0xA9, 0x10, 0x8D,
+    0x00, 0x18, 0x2C, 0x00, 0x18, 0x10, 0xD0, 0x30, 0xF9, 0x78, 0x20, 0xEB, 0xD0, 0xB0, 0x06, 0xA6,
+    0x82, 0xB5, 0xF2, 0x30, 0x01, 0x60, 0x20, 0x59, 0xEA, 0x20, 0xC0, 0xE9, 0x29, 0x01, 0x08, 0x20,
+    0xB7, 0xE9, 0x28, 0xF0, 0x12, 0x20, 0x59, 0xEA, 0x20, 0xC0, 0xE9, 0x29, 0x01, 0xD0, 0xF6, 0xA6,
+    0x82, 0xB5, 0xF2, 0x29, 0x08, 0xD0, 0x14, 0x20, 0x59, 0xEA, 0x20, 0xC0, 0xE9, 0x29, 0x01, 0xD0,
+    0xF6, 0x20, 0x59, 0xEA, 0x20, 0xC0, 0xE9, 0x29, 0x01, 0xF0, 0xF6, 0x20, 0xAE, 0xE9, 0x20, 0x59,
+    0xEA, 0x20, 0xC0, 0xE9, 0x29, 0x01, 0xD0, 0xF3, 0xA9, 0x08, 0x85, 0x98, 0x20, 0xC0, 0xE9, 0x29,
+    0x01, 0xD0, 0x36, 0xA6, 0x82, 0xBD, 0x3E, 0x02, 0x6A, 0x9D, 0x3E, 0x02, 0xB0, 0x05, 0x20, 0xA5,
+    0xE9, 0xD0, 0x03, 0x20, 0x9C, 0xE9, 0x20, 0xB7, 0xE9, 0xA5, 0x23, 0xD0, 0x03, 0x20, 0xF3, 0xFE,
+    0x20, 0xFB, 0xFE, 0xC6, 0x98, 0xD0, 0xD5, 0x20, 0x59, 0xEA, 0x20, 0xC0, 0xE9, 0x29, 0x01, 0xF0,
+    0xF6, 0x58, 0x20, 0xAA, 0xD3, 0x78, 0x4C, 0x0F, 0xE9, 0x4C, 0x4E, 0xEA, 0xAD, 0x00, 0x18, 0x29,
+    0xFD, 0x8D, 0x00, 0x18, 0x60, 0xAD, 0x00, 0x18, 0x09, 0x02, 0x8D, 0x00, 0x18, 0x60, 0xAD, 0x00,
+    0x18, 0x09, 0x08, 0x8D, 0x00, 0x18, 0x60, 0xAD, 0x00, 0x18, 0x29, 0xF7, 0x8D, 0x00, 0x18, 0x60,
+    0xAD, 0x00, 0x18, 0xCD, 0x00, 0x18, 0xD0, 0xF8, 0x60, 0xA9, 0x08, 0x85, 0x98, 0x20, 0x59, 0xEA,
+    0x20, 0xC0, 0xE9, 0x29, 0x04, 0xD0, 0xF6, 0x20, 0x9C, 0xE9, 0xA9, 0x01, 0x8D, 0x05, 0x18, 0x20,
+    0x59, 0xEA, 0xAD, 0x0D, 0x18, 0x29, 0x40, 0xD0, 0x09, 0x20, 0xC0, 0xE9, 0x29, 0x04, 0xF0, 0xEF,
+    0xD0, 0x19, 0x20, 0xA5, 0xE9, 0xA2, 0x0A, 0xCA, 0xD0, 0xFD, 0x20, 0x9C, 0xE9, 0x20, 0x59, 0xEA,
+    0x20, 0xC0, 0xE9, 0x29, 0x04, 0xF0, 0xF6, 0xA9, 0x00, 0x85, 0xF8, 0xAD, 0x00, 0x18, 0x29, 0x04,
+    0xD0, 0xF9, 0xAD, 0x00, 0x18, 0x49, 0x01, 0x4A, 0x66, 0x85, 0x20, 0x59, 0xEA, 0x20, 0xC0, 0xE9,
+    0x29, 0x04, 0xF0, 0xF6, 0xC6, 0x98, 0xD0, 0xE3, 0x20, 0xA5, 0xE9, 0xA5, 0x85, 0x60, 0x78, 0x20,
+    0x07, 0xD1, 0xB0, 0x05, 0xB5, 0xF2, 0x6A, 0xB0, 0x0B, 0xA5, 0x84, 0x29, 0xF0, 0xC9, 0xF0, 0xF0,
+    0x03, 0x4C, 0x4E, 0xEA, 0x20, 0xC9, 0xE9, 0x58, 0x20, 0xB7, 0xCF, 0x4C, 0x2E, 0xEA, 0xA9, 0x00,
+    0x8D, 0x00, 0x18, 0x4C, 0xE7, 0xEB, 0x4C, 0x5B, 0xE8, 0xA5, 0x7D, 0xF0, 0x06, 0xAD, 0x00, 0x18,
+    0x10, 0x09, 0x60, 0xAD, 0x00, 0x18, 0x10, 0xFA, 0x4C, 0x5B, 0xE8, 0x4C, 0xD7, 0xE8, 0xA2, 0x00,
+    0x2C, 0xA6, 0x6F, 0x9A, 0xBA, 0xA9, 0x08, 0x0D, 0x00, 0x1C, 0x4C, 0xEA, 0xFE, 0x98, 0x18, 0x69,
+    0x01, 0xD0, 0xFC, 0x88, 0xD0, 0xF8, 0xAD, 0x00, 0x1C, 0x29, 0xF7, 0x8D, 0x00, 0x1C, 0x98, 0x18,
+    0x69, 0x01, 0xD0, 0xFC, 0x88, 0xD0, 0xF8, 0xCA, 0x10, 0xDB, 0xE0, 0xFC, 0xD0, 0xF0, 0xF0, 0xD4,
+    0x78, 0xD8, 0xA2, 0xFF, 0x8E, 0x03, 0x18, 0xE8, 0xA0, 0x00, 0xA2, 0x00, 0x8A, 0x95, 0x00, 0xE8,
+    0xD0, 0xFA, 0x8A, 0xD5, 0x00, 0xD0, 0xB7, 0xF6, 0x00, 0xC8, 0xD0, 0xFB, 0xD5, 0x00, 0xD0, 0xAE,
+    0x94, 0x00, 0xB5, 0x00, 0xD0, 0xA8, 0xE8, 0xD0, 0xE9, 0xE6, 0x6F, 0x86, 0x76, 0xA9, 0x00, 0x85,
+    0x75, 0xA8, 0xA2, 0x20, 0x18, 0xC6, 0x76, 0x71, 0x75, 0xC8, 0xD0, 0xFB, 0xCA, 0xD0, 0xF6, 0x69,
+    0x00, 0xAA, 0xC5, 0x76, 0xD0, 0x39, 0xE0, 0xC0, 0xD0, 0xDF, 0xA9, 0x01, 0x85, 0x76, 0xE6, 0x6F,
+    0xA2, 0x07, 0x98, 0x18, 0x65, 0x76, 0x91, 0x75, 0xC8, 0xD0, 0xF7, 0xE6, 0x76, 0xCA, 0xD0, 0xF2,
+    0xA2, 0x07, 0xC6, 0x76, 0x88, 0x98, 0x18, 0x65, 0x76, 0xD1, 0x75, 0xD0, 0x12, 0x49, 0xFF, 0x91,
+    0x75, 0x51, 0x75, 0x91, 0x75, 0xD0, 0x08, 0x98, 0xD0, 0xEA, 0xCA, 0xD0, 0xE5, 0xF0, 0x03, 0x4C,
+    0x71, 0xEA, 0xA2, 0x45, 0x9A, 0xAD, 0x00, 0x1C, 0x29, 0xF7, 0x8D, 0x00, 0x1C, 0xA9, 0x01, 0x8D,
+    0x0C, 0x18, 0xA9, 0x82, 0x8D, 0x0D, 0x18, 0x8D, 0x0E, 0x18, 0xAD, 0x00, 0x18, 0x29, 0x60, 0x0A,
+    0x2A, 0x2A, 0x2A, 0x09, 0x48, 0x85, 0x78, 0x49, 0x60, 0x85, 0x77, 0xA2, 0x00, 0xA0, 0x00, 0xA9,
+    0x00, 0x95, 0x99, 0xE8, 0xB9, 0xE0, 0xFE, 0x95, 0x99, 0xE8, 0xC8, 0xC0, 0x05, 0xD0, 0xF0, 0xA9,
+    0x00, 0x95, 0x99, 0xE8, 0xA9, 0x02, 0x95, 0x99, 0xE8, 0xA9, 0xD5, 0x95, 0x99, 0xE8, 0xA9, 0x02,
+    0x95, 0x99, 0xA9, 0xFF, 0xA2, 0x12, 0x9D, 0x2B, 0x02, 0xCA, 0x10, 0xFA, 0xA2, 0x05, 0x95, 0xA7,
+    0x95, 0xAE, 0x95, 0xCD, 0xCA, 0x10, 0xF7, 0xA9, 0x05, 0x85, 0xAB, 0xA9, 0x06, 0x85, 0xAC, 0xA9,
+    0xFF, 0x85, 0xAD, 0x85, 0xB4, 0xA9, 0x05, 0x8D, 0x3B, 0x02, 0xA9, 0x84, 0x8D, 0x3A, 0x02, 0xA9,
+    0x0F, 0x8D, 0x56, 0x02, 0xA9, 0x01, 0x85, 0xF6, 0xA9, 0x88, 0x85, 0xF7, 0xA9, 0xE0, 0x8D, 0x4F,
+    0x02, 0xA9, 0xFF, 0x8D, 0x50, 0x02, 0xA9, 0x01, 0x85, 0x1C, 0x85, 0x1D, 0x20, 0x63, 0xCB, 0x20,
+    0xFA, 0xCE, 0x20, 0x59, 0xF2, 0xA9, 0x22, 0x85, 0x65, 0xA9, 0xEB, 0x85, 0x66, 0xA9, 0x0A, 0x85,
+    0x69, 0xA9, 0x05, 0x85, 0x6A, 0xA9, 0x73, 0x20, 0xC1, 0xE6, 0xA9, 0x1A, 0x8D, 0x02, 0x18, 0xA9,
+    0x00, 0x8D, 0x00, 0x18, 0x20, 0x80, 0xE7, 0x58, 0xAD, 0x00, 0x18, 0x29, 0xE5, 0x8D, 0x00, 0x18,
+    0xAD, 0x55, 0x02, 0xF0, 0x0A, 0xA9, 0x00, 0x8D, 0x55, 0x02, 0x85, 0x67, 0x20, 0x46, 0xC1, 0x58,
+    0xA5, 0x7C, 0xF0, 0x03, 0x4C, 0x5B, 0xE8, 0x58, 0xA9, 0x0E, 0x85, 0x72, 0xA9, 0x00, 0x85, 0x6F,
+    0x85, 0x70, 0xA6, 0x72, 0xBD, 0x2B, 0x02, 0xC9, 0xFF, 0xF0, 0x10, 0x29, 0x3F, 0x85, 0x82, 0x20,
+    0x93, 0xDF, 0xAA, 0xBD, 0x5B, 0x02, 0x29, 0x01, 0xAA, 0xF6, 0x6F, 0xC6, 0x72, 0x10, 0xE3, 0xA0,
+    0x04, 0xB9, 0x00, 0x00, 0x10, 0x05, 0x29, 0x01, 0xAA, 0xF6, 0x6F, 0x88, 0x10, 0xF3, 0x78, 0xAD,
+    0x00, 0x1C, 0x29, 0xF7, 0x48, 0xA5, 0x7F, 0x85, 0x86, 0xA9, 0x00, 0x85, 0x7F, 0xA5, 0x6F, 0xF0,
+    0x0B, 0xA5, 0x1C, 0xF0, 0x03, 0x20, 0x13, 0xD3, 0x68, 0x09, 0x08, 0x48, 0xE6, 0x7F, 0xA5, 0x70,
+    0xF0, 0x0B, 0xA5, 0x1D, 0xF0, 0x03, 0x20, 0x13, 0xD3, 0x68, 0x09, 0x00, 0x48, 0xA5, 0x86, 0x85,
+    0x7F, 0x68, 0xAE, 0x6C, 0x02, 0xF0, 0x21, 0xAD, 0x00, 0x1C, 0xE0, 0x80, 0xD0, 0x03, 0x4C, 0x8B,
+    0xEC, 0xAE, 0x05, 0x18, 0x30, 0x12, 0xA2, 0xA0, 0x8E, 0x05, 0x18, 0xCE, 0x6C, 0x02, 0xD0, 0x08,
+    0x4D, 0x6D, 0x02, 0xA2, 0x10, 0x8E, 0x6C, 0x02, 0x8D, 0x00, 0x1C, 0x4C, 0xFF, 0xEB, 0xA9, 0x00,
+    0x85, 0x83, 0xA9, 0x01, 0x20, 0xE2, 0xD1, 0xA9, 0x00, 0x20, 0xC8, 0xD4, 0xA6, 0x82, 0xA9, 0x00,
+    0x9D, 0x44, 0x02, 0x20, 0x93, 0xDF, 0xAA, 0xA5, 0x7F, 0x9D, 0x5B, 0x02, 0xA9, 0x01, 0x20, 0xF1,
+    0xCF, 0xA9, 0x04, 0x20, 0xF1, 0xCF, 0xA9, 0x01, 0x20, 0xF1, 0xCF, 0x20, 0xF1, 0xCF, 0xAD, 0x72,
+    0x02, 0x20, 0xF1, 0xCF, 0xA9, 0x00, 0x20, 0xF1, 0xCF, 0x20, 0x59, 0xED, 0x20, 0x93, 0xDF, 0x0A,
+    0xAA, 0xD6, 0x99, 0xD6, 0x99, 0xA9, 0x00, 0x20, 0xF1, 0xCF, 0xA9, 0x01, 0x20, 0xF1, 0xCF, 0x20,
+    0xF1, 0xCF, 0x20, 0xCE, 0xC6, 0x90, 0x2C, 0xAD, 0x72, 0x02, 0x20, 0xF1, 0xCF, 0xAD, 0x73, 0x02,
+    0x20, 0xF1, 0xCF, 0x20, 0x59, 0xED, 0xA9, 0x00, 0x20, 0xF1, 0xCF, 0xD0, 0xDD, 0x20, 0x93, 0xDF,
+    0x0A, 0xAA, 0xA9, 0x00, 0x95, 0x99, 0xA9, 0x88, 0xA4, 0x82, 0x8D, 0x54, 0x02, 0x99, 0xF2, 0x00,
+    0xA5, 0x85, 0x60, 0xAD, 0x72, 0x02, 0x20, 0xF1, 0xCF, 0xAD, 0x73, 0x02, 0x20, 0xF1, 0xCF, 0x20,
+    0x59, 0xED, 0x20, 0x93, 0xDF, 0x0A, 0xAA, 0xD6, 0x99, 0xD6, 0x99, 0xA9, 0x00, 0x20, 0xF1, 0xCF,
+    0x20, 0xF1, 0xCF, 0x20, 0xF1, 0xCF, 0x20, 0x93, 0xDF, 0x0A, 0xA8, 0xB9, 0x99, 0x00, 0xA6, 0x82,
+    0x9D, 0x44, 0x02, 0xDE, 0x44, 0x02, 0x4C, 0x0D, 0xED, 0xA0, 0x00, 0xB9, 0xB1, 0x02, 0x20, 0xF1,
+    0xCF, 0xC8, 0xC0, 0x1B, 0xD0, 0xF5, 0x60, 0x20, 0x37, 0xD1, 0xF0, 0x01, 0x60, 0x85, 0x85, 0xA4,
+    0x82, 0xB9, 0x44, 0x02, 0xF0, 0x08, 0xA9, 0x80, 0x99, 0xF2, 0x00, 0xA5, 0x85, 0x60, 0x48, 0x20,
+    0xEA, 0xEC, 0x68, 0x60, 0x20, 0xD1, 0xC1, 0x20, 0x42, 0xD0, 0xA9, 0x40, 0x8D, 0xF9, 0x02, 0x20,
+    0xB7, 0xEE, 0xA9, 0x00, 0x8D, 0x92, 0x02, 0x20, 0xAC, 0xC5, 0xD0, 0x3D, 0xA9, 0x00, 0x85, 0x81,
+    0xAD, 0x85, 0xFE, 0x85, 0x80, 0x20, 0xE5, 0xED, 0xA9, 0x00, 0x8D, 0xF9, 0x02, 0x20, 0xFF, 0xEE,
+    0x4C, 0x94, 0xC1, 0xC8, 0xB1, 0x94, 0x48, 0xC8, 0xB1, 0x94, 0x48, 0xA0, 0x13, 0xB1, 0x94, 0xF0,
+    0x0A, 0x85, 0x80, 0xC8, 0xB1, 0x94, 0x85, 0x81, 0x20, 0xE5, 0xED, 0x68, 0x85, 0x81, 0x68, 0x85,
+    0x80, 0x20, 0xE5, 0xED, 0x20, 0x04, 0xC6, 0xF0, 0xC3, 0xA0, 0x00, 0xB1, 0x94, 0x30, 0xD4, 0x20,
+    0xB6, 0xC8, 0x4C, 0xD4, 0xED, 0x20, 0x5F, 0xD5, 0x20, 0x90, 0xEF, 0x20, 0x75, 0xD4, 0xA9, 0x00,
+    0x20, 0xC8, 0xD4, 0x20, 0x37, 0xD1, 0x85, 0x80, 0x20, 0x37, 0xD1, 0x85, 0x81, 0xA5, 0x80, 0xD0,
+    0x03, 0x4C, 0x27, 0xD2, 0x20, 0x90, 0xEF, 0x20, 0x4D, 0xD4, 0x4C, 0xEE, 0xED, 0x20, 0x12, 0xC3,
+    0xA5, 0xE2, 0x10, 0x05, 0xA9, 0x33, 0x4C, 0xC8, 0xC1, 0x29, 0x01, 0x85, 0x7F, 0x20, 0x00, 0xC1,
+    0xA5, 0x7F, 0x0A, 0xAA, 0xAC, 0x7B, 0x02, 0xCC, 0x74, 0x02, 0xF0, 0x1A, 0xB9, 0x00, 0x02, 0x95,
+    0x12, 0xB9, 0x01, 0x02, 0x95, 0x13, 0x20, 0x07, 0xD3, 0xA9, 0x01, 0x85, 0x80, 0x20, 0xC6, 0xC8,
+    0x20, 0x05, 0xF0, 0x4C, 0x56, 0xEE, 0x20, 0x42, 0xD0, 0xA6, 0x7F, 0xBD, 0x01, 0x01, 0xCD, 0xD5,
+    0xFE, 0xF0, 0x03, 0x4C, 0x72, 0xD5, 0x20, 0xB7, 0xEE, 0xA5, 0xF9, 0xA8, 0x0A, 0xAA, 0xAD, 0x88,
+    0xFE, 0x95, 0x99, 0xAE, 0x7A, 0x02, 0xA9, 0x1B, 0x20, 0x6E, 0xC6, 0xA0, 0x12, 0xA6, 0x7F, 0xAD,
+    0xD5, 0xFE, 0x9D, 0x01, 0x01, 0x8A, 0x0A, 0xAA, 0xB5, 0x12, 0x91, 0x94, 0xC8, 0xB5, 0x13, 0x91,
+    0x94, 0xC8, 0xC8, 0xA9, 0x32, 0x91, 0x94, 0xC8, 0xAD, 0xD5, 0xFE, 0x91, 0x94, 0xA0, 0x02, 0x91,
+    0x6D, 0xAD, 0x85, 0xFE, 0x85, 0x80, 0x20, 0x93, 0xEF, 0xA9, 0x01, 0x85, 0x81, 0x20, 0x93, 0xEF,
+    0x20, 0xFF, 0xEE, 0x20, 0x05, 0xF0, 0xA0, 0x01, 0xA9, 0xFF, 0x91, 0x6D, 0x20, 0x64, 0xD4, 0xC6,
+    0x81, 0x20, 0x60, 0xD4, 0x4C, 0x94, 0xC1, 0x20, 0xD1, 0xF0, 0xA0, 0x00, 0xA9, 0x12, 0x91, 0x6D,
+    0xC8, 0x98, 0x91, 0x6D, 0xC8, 0xC8, 0xC8, 0xA9, 0x00, 0x85, 0x6F, 0x85, 0x70, 0x85, 0x71, 0x98,
+    0x4A, 0x4A, 0x20, 0x4B, 0xF2, 0x91, 0x6D, 0xC8, 0xAA, 0x38, 0x26, 0x6F, 0x26, 0x70, 0x26, 0x71,
+    0xCA, 0xD0, 0xF6, 0xB5, 0x6F, 0x91, 0x6D, 0xC8, 0xE8, 0xE0, 0x03, 0x90, 0xF6, 0xC0, 0x90, 0x90,
+    0xD6, 0x4C, 0x75, 0xD0, 0x20, 0x93, 0xDF, 0xAA, 0xBD, 0x5B, 0x02, 0x29, 0x01, 0x85, 0x7F, 0xA4,
+    0x7F, 0xB9, 0x51, 0x02, 0xD0, 0x01, 0x60, 0xA9, 0x00, 0x99, 0x51, 0x02, 0x20, 0x3A, 0xEF, 0xA5,
+    0x7F, 0x0A, 0x48, 0x20, 0xA5, 0xF0, 0x68, 0x18, 0x69, 0x01, 0x20, 0xA5, 0xF0, 0xA5, 0x80, 0x48,
+    0xA9, 0x01, 0x85, 0x80, 0x0A, 0x0A, 0x85, 0x6D, 0x20, 0x20, 0xF2, 0xE6, 0x80, 0xA5, 0x80, 0xCD,
+    0xD7, 0xFE, 0x90, 0xF0, 0x68, 0x85, 0x80, 0x4C, 0x8A, 0xD5, 0x20, 0x0F, 0xF1, 0xAA, 0x20, 0xDF,
+    0xF0, 0xA6, 0xF9, 0xBD, 0xE0, 0xFE, 0x85, 0x6E, 0xA9, 0x00, 0x85, 0x6D, 0x60, 0xA6, 0x7F, 0xBD,
+    0xFA, 0x02, 0x8D, 0x72, 0x02, 0xBD, 0xFC, 0x02, 0x8D, 0x73, 0x02, 0x60, 0x20, 0xF1, 0xEF, 0x20,
+    0xCF, 0xEF, 0x38, 0xD0, 0x22, 0xB1, 0x6D, 0x1D, 0xE9, 0xEF, 0x91, 0x6D, 0x20, 0x88, 0xEF, 0xA4,
+    0x6F, 0x18, 0xB1, 0x6D, 0x69, 0x01, 0x91, 0x6D, 0xA5, 0x80, 0xCD, 0x85, 0xFE, 0xF0, 0x3B, 0xFE,
+    0xFA, 0x02, 0xD0, 0x03, 0xFE, 0xFC, 0x02, 0x60, 0xA6, 0x7F, 0xA9, 0x01, 0x9D, 0x51, 0x02, 0x60,
+    0x20, 0xF1, 0xEF, 0x20, 0xCF, 0xEF, 0xF0, 0x36, 0xB1, 0x6D, 0x5D, 0xE9, 0xEF, 0x91, 0x6D, 0x20,
+    0x88, 0xEF, 0xA4, 0x6F, 0xB1, 0x6D, 0x38, 0xE9, 0x01, 0x91, 0x6D, 0xA5, 0x80, 0xCD, 0x85, 0xFE,
+    0xF0, 0x0B, 0xBD, 0xFA, 0x02, 0xD0, 0x03, 0xDE, 0xFC, 0x02, 0xDE, 0xFA, 0x02, 0xBD, 0xFC, 0x02,
+    0xD0, 0x0C, 0xBD, 0xFA, 0x02, 0xC9, 0x03, 0xB0, 0x05, 0xA9, 0x72, 0x20, 0xC7, 0xE6, 0x60, 0x20,
+    0x11, 0xF0, 0x98, 0x85, 0x6F, 0xA5, 0x81, 0x4A, 0x4A, 0x4A, 0x38, 0x65, 0x6F, 0xA8, 0xA5, 0x81,
+    0x29, 0x07, 0xAA, 0xB1, 0x6D, 0x3D, 0xE9, 0xEF, 0x60, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40,
+    0x80, 0xA9, 0xFF, 0x2C, 0xF9, 0x02, 0xF0, 0x0C, 0x10, 0x0A, 0x70, 0x08, 0xA9, 0x00, 0x8D, 0xF9,
+    0x02, 0x4C, 0x8A, 0xD5, 0x60, 0x20, 0x3A, 0xEF, 0xA0, 0x00, 0x98, 0x91, 0x6D, 0xC8, 0xD0, 0xFB,
+    0x60, 0xA5, 0x6F, 0x48, 0xA5, 0x70, 0x48, 0xA6, 0x7F, 0xB5, 0xFF, 0xF0, 0x05, 0xA9, 0x74, 0x20,
+    0x48, 0xE6, 0x20, 0x0F, 0xF1, 0x85, 0x6F, 0x8A, 0x0A, 0x85, 0x70, 0xAA, 0xA5, 0x80, 0xDD, 0x9D,
+    0x02, 0xF0, 0x0B, 0xE8, 0x86, 0x70, 0xDD, 0x9D, 0x02, 0xF0, 0x03, 0x20, 0x5B, 0xF0, 0xA5, 0x70,
+    0xA6, 0x7F, 0x9D, 0x9B, 0x02, 0x0A, 0x0A, 0x18, 0x69, 0xA1, 0x85, 0x6D, 0xA9, 0x02, 0x69, 0x00,
+    0x85, 0x6E, 0xA0, 0x00, 0x68, 0x85, 0x70, 0x68, 0x85, 0x6F, 0x60, 0xA6, 0x6F, 0x20, 0xDF, 0xF0,
+    0xA5, 0x7F, 0xAA, 0x0A, 0x1D, 0x9B, 0x02, 0x49, 0x01, 0x29, 0x03, 0x85, 0x70, 0x20, 0xA5, 0xF0,
+    0xA5, 0xF9, 0x0A, 0xAA, 0xA5, 0x80, 0x0A, 0x0A, 0x95, 0x99, 0xA5, 0x70, 0x0A, 0x0A, 0xA8, 0xA1,
+    0x99, 0x99, 0xA1, 0x02, 0xA9, 0x00, 0x81, 0x99, 0xF6, 0x99, 0xC8, 0x98, 0x29, 0x03, 0xD0, 0xEF,
+    0xA6, 0x70, 0xA5, 0x80, 0x9D, 0x9D, 0x02, 0xAD, 0xF9, 0x02, 0xD0, 0x03, 0x4C, 0x8A, 0xD5, 0x09,
+    0x80, 0x8D, 0xF9, 0x02, 0x60, 0xA8, 0xB9, 0x9D, 0x02, 0xF0, 0x25, 0x48, 0xA9, 0x00, 0x99, 0x9D,
+    0x02, 0xA5, 0xF9, 0x0A, 0xAA, 0x68, 0x0A, 0x0A, 0x95, 0x99, 0x98, 0x0A, 0x0A, 0xA8, 0xB9, 0xA1,
+    0x02, 0x81, 0x99, 0xA9, 0x00, 0x99, 0xA1, 0x02, 0xF6, 0x99, 0xC8, 0x98, 0x29, 0x03, 0xD0, 0xEE,
+    0x60, 0xA5, 0x7F, 0x0A, 0xAA, 0xA9, 0x00, 0x9D, 0x9D, 0x02, 0xE8, 0x9D, 0x9D, 0x02, 0x60, 0xB5,
+    0xA7, 0xC9, 0xFF, 0xD0, 0x25, 0x8A, 0x48, 0x20, 0x8E, 0xD2, 0xAA, 0x10, 0x05, 0xA9, 0x70, 0x20,
+    0xC8, 0xC1, 0x86, 0xF9, 0x68, 0xA8, 0x8A, 0x09, 0x80, 0x99, 0xA7, 0x00, 0x0A, 0xAA, 0xAD, 0x85,
+    0xFE, 0x95, 0x06, 0xA9, 0x00, 0x95, 0x07, 0x4C, 0x86, 0xD5, 0x29, 0x0F, 0x85, 0xF9, 0x60, 0xA9,
+    0x06, 0xA6, 0x7F, 0xD0, 0x03, 0x18, 0x69, 0x07, 0x60, 0x20, 0x0F, 0xF1, 0xAA, 0x60, 0x20, 0x3E,
+    0xDE, 0xA9, 0x03, 0x85, 0x6F, 0xA9, 0x01, 0x0D, 0xF9, 0x02, 0x8D, 0xF9, 0x02, 0xA5, 0x6F, 0x48,
+    0x20, 0x11, 0xF0, 0x68, 0x85, 0x6F, 0xB1, 0x6D, 0xD0, 0x39, 0xA5, 0x80, 0xCD, 0x85, 0xFE, 0xF0,
+    0x19, 0x90, 0x1C, 0xE6, 0x80, 0xA5, 0x80, 0xCD, 0xD7, 0xFE, 0xD0, 0xE1, 0xAE, 0x85, 0xFE, 0xCA,
+    0x86, 0x80, 0xA9, 0x00, 0x85, 0x81, 0xC6, 0x6F, 0xD0, 0xD3, 0xA9, 0x72, 0x20, 0xC8, 0xC1, 0xC6,
+    0x80, 0xD0, 0xCA, 0xAE, 0x85, 0xFE, 0xE8, 0x86, 0x80, 0xA9, 0x00, 0x85, 0x81, 0xC6, 0x6F, 0xD0,
+    0xBC, 0xF0, 0xE7, 0xA5, 0x81, 0x18, 0x65, 0x69, 0x85, 0x81, 0xA5, 0x80, 0x20, 0x4B, 0xF2, 0x8D,
+    0x4E, 0x02, 0x8D, 0x4D, 0x02, 0xC5, 0x81, 0xB0, 0x0C, 0x38, 0xA5, 0x81, 0xED, 0x4E, 0x02, 0x85,
+    0x81, 0xF0, 0x02, 0xC6, 0x81, 0x20, 0xFA, 0xF1, 0xF0, 0x03, 0x4C, 0x90, 0xEF, 0xA9, 0x00, 0x85,
+    0x81, 0x20, 0xFA, 0xF1, 0xD0, 0xF4, 0x4C, 0xF5, 0xF1, 0xA9, 0x01, 0x0D, 0xF9, 0x02, 0x8D, 0xF9,
+    0x02, 0xA5, 0x86, 0x48, 0xA9, 0x01, 0x85, 0x86, 0xAD, 0x85, 0xFE, 0x38, 0xE5, 0x86, 0x85, 0x80,
+    0x90, 0x09, 0xF0, 0x07, 0x20, 0x11, 0xF0, 0xB1, 0x6D, 0xD0, 0x1B, 0xAD, 0x85, 0xFE, 0x18, 0x65,
+    0x86, 0x85, 0x80, 0xE6, 0x86, 0xCD, 0xD7, 0xFE, 0x90, 0x05, 0xA9, 0x67, 0x20, 0x45, 0xE6, 0x20,
+    0x11, 0xF0, 0xB1, 0x6D, 0xF0, 0xD2, 0x68, 0x85, 0x86, 0xA9, 0x00, 0x85, 0x81, 0x20, 0xFA, 0xF1,
+    0xF0, 0x03, 0x4C, 0x90, 0xEF, 0xA9, 0x71, 0x20, 0x45, 0xE6, 0x20, 0x11, 0xF0, 0x98, 0x48, 0x20,
+    0x20, 0xF2, 0xA5, 0x80, 0x20, 0x4B, 0xF2, 0x8D, 0x4E, 0x02, 0x68, 0x85, 0x6F, 0xA5, 0x81, 0xCD,
+    0x4E, 0x02, 0xB0, 0x09, 0x20, 0xD5, 0xEF, 0xD0, 0x06, 0xE6, 0x81, 0xD0, 0xF0, 0xA9, 0x00, 0x60,
+    0xA5, 0x6F, 0x48, 0xA9, 0x00, 0x85, 0x6F, 0xAC, 0x86, 0xFE, 0x88, 0xA2, 0x07, 0xB1, 0x6D, 0x3D,
+    0xE9, 0xEF, 0xF0, 0x02, 0xE6, 0x6F, 0xCA, 0x10, 0xF4, 0x88, 0xD0, 0xEF, 0xB1, 0x6D, 0xC5, 0x6F,
+    0xD0, 0x04, 0x68, 0x85, 0x6F, 0x60, 0xA9, 0x71, 0x20, 0x45, 0xE6, 0xAE, 0xD6, 0xFE, 0xDD, 0xD6,
+    0xFE, 0xCA, 0xB0, 0xFA, 0xBD, 0xD1, 0xFE, 0x60, 0x60, 0xA9, 0x6F, 0x8D, 0x02, 0x1C, 0x29, 0xF0,
+    0x8D, 0x00, 0x1C, 0xAD, 0x0C, 0x1C, 0x29, 0xFE, 0x09, 0x0E, 0x09, 0xE0, 0x8D, 0x0C, 0x1C, 0xA9,
+    0x41, 0x8D, 0x0B, 0x1C, 0xA9, 0x00, 0x8D, 0x06, 0x1C, 0xA9, 0x3A, 0x8D, 0x07, 0x1C, 0x8D, 0x05,
+    0x1C, 0xA9, 0x7F, 0x8D, 0x0E, 0x1C, 0xA9, 0xC0, 0x8D, 0x0D, 0x1C, 0x8D, 0x0E, 0x1C, 0xA9, 0xFF,
+    0x85, 0x3E, 0x85, 0x51, 0xA9, 0x08, 0x85, 0x39, 0xA9, 0x07, 0x85, 0x47, 0xA9, 0x05, 0x85, 0x62,
+    0xA9, 0xFA, 0x85, 0x63, 0xA9, 0xC8, 0x85, 0x64, 0xA9, 0x04, 0x85, 0x5E, 0xA9, 0x04, 0x85, 0x5F,
+    0xBA, 0x86, 0x49, 0xAD, 0x04, 0x1C, 0xAD, 0x0C, 0x1C, 0x09, 0x0E, 0x8D, 0x0C, 0x1C, 0xA0, 0x05,
+    0xB9, 0x00, 0x00, 0x10, 0x2E, 0xC9, 0xD0, 0xD0, 0x04, 0x98, 0x4C, 0x70, 0xF3, 0x29, 0x01, 0xF0,
+    0x07, 0x84, 0x3F, 0xA9, 0x0F, 0x4C, 0x69, 0xF9, 0xAA, 0x85, 0x3D, 0xC5, 0x3E, 0xF0, 0x0A, 0x20,
+    0x7E, 0xF9, 0xA5, 0x3D, 0x85, 0x3E, 0x4C, 0x9C, 0xF9, 0xA5, 0x20, 0x30, 0x03, 0x0A, 0x10, 0x09,
+    0x4C, 0x9C, 0xF9, 0x88, 0x10, 0xCA, 0x4C, 0x9C, 0xF9, 0xA9, 0x20, 0x85, 0x20, 0xA0, 0x05, 0x84,
+    0x3F, 0x20, 0x93, 0xF3, 0x30, 0x1A, 0xC6, 0x3F, 0x10, 0xF7, 0xA4, 0x41, 0x20, 0x95, 0xF3, 0xA5,
+    0x42, 0x85, 0x4A, 0x06, 0x4A, 0xA9, 0x60, 0x85, 0x20, 0xB1, 0x32, 0x85, 0x22, 0x4C, 0x9C, 0xF9,
+    0x29, 0x01, 0xC5, 0x3D, 0xD0, 0xE0, 0xA5, 0x22, 0xF0, 0x12, 0x38, 0xF1, 0x32, 0xF0, 0x0D, 0x49,
+    0xFF, 0x85, 0x42, 0xE6, 0x42, 0xA5, 0x3F, 0x85, 0x41, 0x4C, 0x06, 0xF3, 0xA2, 0x04, 0xB1, 0x32,
+    0x85, 0x40, 0xDD, 0xD6, 0xFE, 0xCA, 0xB0, 0xFA, 0xBD, 0xD1, 0xFE, 0x85, 0x43, 0x8A, 0x0A, 0x0A,
+    0x0A, 0x0A, 0x0A, 0x85, 0x44, 0xAD, 0x00, 0x1C, 0x29, 0x9F, 0x05, 0x44, 0x8D, 0x00, 0x1C, 0xA6,
+    0x3D, 0xA5, 0x45, 0xC9, 0x40, 0xF0, 0x15, 0xC9, 0x60, 0xF0, 0x03, 0x4C, 0xB1, 0xF3, 0xA5, 0x3F,
+    0x18, 0x69, 0x03, 0x85, 0x31, 0xA9, 0x00, 0x85, 0x30, 0x6C, 0x30, 0x00, 0xA9, 0x60, 0x85, 0x20,
+    0xAD, 0x00, 0x1C, 0x29, 0xFC, 0x8D, 0x00, 0x1C, 0xA9, 0xA4, 0x85, 0x4A, 0xA9, 0x01, 0x85, 0x22,
+    0x4C, 0x69, 0xF9, 0xA4, 0x3F, 0xB9, 0x00, 0x00, 0x48, 0x10, 0x10, 0x29, 0x78, 0x85, 0x45, 0x98,
+    0x0A, 0x69, 0x06, 0x85, 0x32, 0x98, 0x18, 0x69, 0x03, 0x85, 0x31, 0xA0, 0x00, 0x84, 0x30, 0x68,
+    0x60, 0xA2, 0x5A, 0x86, 0x4B, 0xA2, 0x00, 0xA9, 0x52, 0x85, 0x24, 0x20, 0x56, 0xF5, 0x50, 0xFE,
+    0xB8, 0xAD, 0x01, 0x1C, 0xC5, 0x24, 0xD0, 0x3F, 0x50, 0xFE, 0xB8, 0xAD, 0x01, 0x1C, 0x95, 0x25,
+    0xE8, 0xE0, 0x07, 0xD0, 0xF3, 0x20, 0x97, 0xF4, 0xA0, 0x04, 0xA9, 0x00, 0x59, 0x16, 0x00, 0x88,
+    0x10, 0xFA, 0xC9, 0x00, 0xD0, 0x38, 0xA6, 0x3E, 0xA5, 0x18, 0x95, 0x22, 0xA5, 0x45, 0xC9, 0x30,
+    0xF0, 0x1E, 0xA5, 0x3E, 0x0A, 0xA8, 0xB9, 0x12, 0x00, 0xC5, 0x16, 0xD0, 0x1E, 0xB9, 0x13, 0x00,
+    0xC5, 0x17, 0xD0, 0x17, 0x4C, 0x23, 0xF4, 0xC6, 0x4B, 0xD0, 0xB0, 0xA9, 0x02, 0x20, 0x69, 0xF9,
+    0xA5, 0x16, 0x85, 0x12, 0xA5, 0x17, 0x85, 0x13, 0xA9, 0x01, 0x2C, 0xA9, 0x0B, 0x2C, 0xA9, 0x09,
+    0x4C, 0x69, 0xF9, 0xA9, 0x7F, 0x85, 0x4C, 0xA5, 0x19, 0x18, 0x69, 0x02, 0xC5, 0x43, 0x90, 0x02,
+    0xE5, 0x43, 0x85, 0x4D, 0xA2, 0x05, 0x86, 0x3F, 0xA2, 0xFF, 0x20, 0x93, 0xF3, 0x10, 0x44, 0x85,
+    0x44, 0x29, 0x01, 0xC5, 0x3E, 0xD0, 0x3C, 0xA0, 0x00, 0xB1, 0x32, 0xC5, 0x40, 0xD0, 0x34, 0xA5,
+    0x45, 0xC9, 0x60, 0xF0, 0x0C, 0xA0, 0x01, 0x38, 0xB1, 0x32, 0xE5, 0x4D, 0x10, 0x03, 0x18, 0x65,
+    0x43, 0xC5, 0x4C, 0xB0, 0x1E, 0x48, 0xA5, 0x45, 0xF0, 0x14, 0x68, 0xC9, 0x09, 0x90, 0x14, 0xC9,
+    0x0C, 0xB0, 0x10, 0x85, 0x4C, 0xA5, 0x3F, 0xAA, 0x69, 0x03, 0x85, 0x31, 0xD0, 0x05, 0x68, 0xC9,
+    0x06, 0x90, 0xF0, 0xC6, 0x3F, 0x10, 0xB3, 0x8A, 0x10, 0x03, 0x4C, 0x9C, 0xF9, 0x86, 0x3F, 0x20,
+    0x93, 0xF3, 0xA5, 0x45, 0x4C, 0xCA, 0xF4, 0xA5, 0x30, 0x48, 0xA5, 0x31, 0x48, 0xA9, 0x24, 0x85,
+    0x30, 0xA9, 0x00, 0x85, 0x31, 0xA9, 0x00, 0x85, 0x34, 0x20, 0xE6, 0xF7, 0xA5, 0x55, 0x85, 0x18,
+    0xA5, 0x54, 0x85, 0x19, 0xA5, 0x53, 0x85, 0x1A, 0x20, 0xE6, 0xF7, 0xA5, 0x52, 0x85, 0x17, 0xA5,
+    0x53, 0x85, 0x16, 0x68, 0x85, 0x31, 0x68, 0x85, 0x30, 0x60, 0xC9, 0x00, 0xF0, 0x03, 0x4C, 0x6E,
+    0xF5, 0x20, 0x0A, 0xF5, 0x50, 0xFE, 0xB8, 0xAD, 0x01, 0x1C, 0x91, 0x30, 0xC8, 0xD0, 0xF5, 0xA0,
+    0xBA, 0x50, 0xFE, 0xB8, 0xAD, 0x01, 0x1C, 0x99, 0x00, 0x01, 0xC8, 0xD0, 0xF4, 0x20, 0xE0, 0xF8,
+    0xA5, 0x38, 0xC5, 0x47, 0xF0, 0x05, 0xA9, 0x04, 0x4C, 0x69, 0xF9, 0x20, 0xE9, 0xF5, 0xC5, 0x3A,
+    0xF0, 0x03, 0xA9, 0x05, 0x2C, 0xA9, 0x01, 0x4C, 0x69, 0xF9, 0x20, 0x10, 0xF5, 0x4C, 0x56, 0xF5,
+    0xA5, 0x3D, 0x0A, 0xAA, 0xB5, 0x12, 0x85, 0x16, 0xB5, 0x13, 0x85, 0x17, 0xA0, 0x00, 0xB1, 0x32,
+    0x85, 0x18, 0xC8, 0xB1, 0x32, 0x85, 0x19, 0xA9, 0x00, 0x45, 0x16, 0x45, 0x17, 0x45, 0x18, 0x45,
+    0x19, 0x85, 0x1A, 0x20, 0x34, 0xF9, 0xA2, 0x5A, 0x20, 0x56, 0xF5, 0xA0, 0x00, 0x50, 0xFE, 0xB8,
+    0xAD, 0x01, 0x1C, 0xD9, 0x24, 0x00, 0xD0, 0x06, 0xC8, 0xC0, 0x08, 0xD0, 0xF0, 0x60, 0xCA, 0xD0,
+    0xE7, 0xA9, 0x02, 0x4C, 0x69, 0xF9, 0xA9, 0xD0, 0x8D, 0x05, 0x18, 0xA9, 0x03, 0x2C, 0x05, 0x18,
+    0x10, 0xF1, 0x2C, 0x00, 0x1C, 0x30, 0xF6, 0xAD, 0x01, 0x1C, 0xB8, 0xA0, 0x00, 0x60, 0xC9, 0x10,
+    0xF0, 0x03, 0x4C, 0x91, 0xF6, 0x20, 0xE9, 0xF5, 0x85, 0x3A, 0xAD, 0x00, 0x1C, 0x29, 0x10, 0xD0,
+    0x05, 0xA9, 0x08, 0x4C, 0x69, 0xF9, 0x20, 0x8F, 0xF7, 0x20, 0x10, 0xF5, 0xA2, 0x08, 0x50, 0xFE,
+    0xB8, 0xCA, 0xD0, 0xFA, 0xA9, 0xFF, 0x8D, 0x03, 0x1C, 0xAD, 0x0C, 0x1C, 0x29, 0x1F, 0x09, 0xC0,
+    0x8D, 0x0C, 0x1C, 0xA9, 0xFF, 0xA2, 0x05, 0x8D, 0x01, 0x1C, 0xB8, 0x50, 0xFE, 0xB8, 0xCA, 0xD0,
+    0xFA, 0xA0, 0xBB, 0xB9, 0x00, 0x01, 0x50, 0xFE, 0xB8, 0x8D, 0x01, 0x1C, 0xC8, 0xD0, 0xF4, 0xB1,
+    0x30, 0x50, 0xFE, 0xB8, 0x8D, 0x01, 0x1C, 0xC8, 0xD0, 0xF5, 0x50, 0xFE, 0xAD, 0x0C, 0x1C, 0x09,
+    0xE0, 0x8D, 0x0C, 0x1C, 0xA9, 0x00, 0x8D, 0x03, 0x1C, 0x20, 0xF2, 0xF5, 0xA4, 0x3F, 0xB9, 0x00,
+    0x00, 0x49, 0x30, 0x99, 0x00, 0x00, 0x4C, 0xB1, 0xF3, 0xA9, 0x00, 0xA8, 0x51, 0x30, 0xC8, 0xD0,
+    0xFB, 0x60, 0xA9, 0x00, 0x85, 0x2E, 0x85, 0x30, 0x85, 0x4F, 0xA5, 0x31, 0x85, 0x4E, 0xA9, 0x01,
+    0x85, 0x31, 0x85, 0x2F, 0xA9, 0xBB, 0x85, 0x34, 0x85, 0x36, 0x20, 0xE6, 0xF7, 0xA5, 0x52, 0x85,
+    0x38, 0xA4, 0x36, 0xA5, 0x53, 0x91, 0x2E, 0xC8, 0xA5, 0x54, 0x91, 0x2E, 0xC8, 0xA5, 0x55, 0x91,
+    0x2E, 0xC8, 0x84, 0x36, 0x20, 0xE6, 0xF7, 0xA4, 0x36, 0xA5, 0x52, 0x91, 0x2E, 0xC8, 0xA5, 0x53,
+    0x91, 0x2E, 0xC8, 0xF0, 0x0E, 0xA5, 0x54, 0x91, 0x2E, 0xC8, 0xA5, 0x55, 0x91, 0x2E, 0xC8, 0x84,
+    0x36, 0xD0, 0xE1, 0xA5, 0x54, 0x91, 0x30, 0xC8, 0xA5, 0x55, 0x91, 0x30, 0xC8, 0x84, 0x36, 0x20,
+    0xE6, 0xF7, 0xA4, 0x36, 0xA5, 0x52, 0x91, 0x30, 0xC8, 0xA5, 0x53, 0x91, 0x30, 0xC8, 0xA5, 0x54,
+    0x91, 0x30, 0xC8, 0xA5, 0x55, 0x91, 0x30, 0xC8, 0x84, 0x36, 0xC0, 0xBB, 0x90, 0xE1, 0xA9, 0x45,
+    0x85, 0x2E, 0xA5, 0x31, 0x85, 0x2F, 0xA0, 0xBA, 0xB1, 0x30, 0x91, 0x2E, 0x88, 0xD0, 0xF9, 0xB1,
+    0x30, 0x91, 0x2E, 0xA2, 0xBB, 0xBD, 0x00, 0x01, 0x91, 0x30, 0xC8, 0xE8, 0xD0, 0xF7, 0x86, 0x50,
+    0x60, 0xC9, 0x20, 0xF0, 0x03, 0x4C, 0xCA, 0xF6, 0x20, 0xE9, 0xF5, 0x85, 0x3A, 0x20, 0x8F, 0xF7,
+    0x20, 0x0A, 0xF5, 0xA0, 0xBB, 0xB9, 0x00, 0x01, 0x50, 0xFE, 0xB8, 0x4D, 0x01, 0x1C, 0xD0, 0x15,
+    0xC8, 0xD0, 0xF2, 0xB1, 0x30, 0x50, 0xFE, 0xB8, 0x4D, 0x01, 0x1C, 0xD0, 0x08, 0xC8, 0xC0, 0xFD,
+    0xD0, 0xF1, 0x4C, 0x18, 0xF4, 0xA9, 0x07, 0x4C, 0x69, 0xF9, 0x20, 0x10, 0xF5, 0x4C, 0x18, 0xF4,
+    0xA9, 0x00, 0x85, 0x57, 0x85, 0x5A, 0xA4, 0x34, 0xA5, 0x52, 0x29, 0xF0, 0x4A, 0x4A, 0x4A, 0x4A,
+    0xAA, 0xBD, 0x7F, 0xF7, 0x0A, 0x0A, 0x0A, 0x85, 0x56, 0xA5, 0x52, 0x29, 0x0F, 0xAA, 0xBD, 0x7F,
+    0xF7, 0x6A, 0x66, 0x57, 0x6A, 0x66, 0x57, 0x29, 0x07, 0x05, 0x56, 0x91, 0x30, 0xC8, 0xA5, 0x53,
+    0x29, 0xF0, 0x4A, 0x4A, 0x4A, 0x4A, 0xAA, 0xBD, 0x7F, 0xF7, 0x0A, 0x05, 0x57, 0x85, 0x57, 0xA5,
+    0x53, 0x29, 0x0F, 0xAA, 0xBD, 0x7F, 0xF7, 0x2A, 0x2A, 0x2A, 0x2A, 0x85, 0x58, 0x2A, 0x29, 0x01,
+    0x05, 0x57, 0x91, 0x30, 0xC8, 0xA5, 0x54, 0x29, 0xF0, 0x4A, 0x4A, 0x4A, 0x4A, 0xAA, 0xBD, 0x7F,
+    0xF7, 0x18, 0x6A, 0x05, 0x58, 0x91, 0x30, 0xC8, 0x6A, 0x29, 0x80, 0x85, 0x59, 0xA5, 0x54, 0x29,
+    0x0F, 0xAA, 0xBD, 0x7F, 0xF7, 0x0A, 0x0A, 0x29, 0x7C, 0x05, 0x59, 0x85, 0x59, 0xA5, 0x55, 0x29,
+    0xF0, 0x4A, 0x4A, 0x4A, 0x4A, 0xAA, 0xBD, 0x7F, 0xF7, 0x6A, 0x66, 0x5A, 0x6A, 0x66, 0x5A, 0x6A,
+    0x66, 0x5A, 0x29, 0x03, 0x05, 0x59, 0x91, 0x30, 0xC8, 0xD0, 0x04, 0xA5, 0x2F, 0x85, 0x31, 0xA5,
+    0x55, 0x29, 0x0F, 0xAA, 0xBD, 0x7F, 0xF7, 0x05, 0x5A, 0x91, 0x30, 0xC8, 0x84, 0x34, 0x60, 0x0A,
+    0x0B, 0x12, 0x13, 0x0E, 0x0F, 0x16, 0x17, 0x09, 0x19, 0x1A, 0x1B, 0x0D, 0x1D, 0x1E, 0x15, 0xA9,
+    0x00, 0x85, 0x30, 0x85, 0x2E, 0x85, 0x36, 0xA9, 0xBB, 0x85, 0x34, 0x85, 0x50, 0xA5, 0x31, 0x85,
+    0x2F, 0xA9, 0x01, 0x85, 0x31, 0xA5, 0x47, 0x85, 0x52, 0xA4, 0x36, 0xB1, 0x2E, 0x85, 0x53, 0xC8,
+    0xB1, 0x2E, 0x85, 0x54, 0xC8, 0xB1, 0x2E, 0x85, 0x55, 0xC8, 0x84, 0x36, 0x20, 0xD0, 0xF6, 0xA4,
+    0x36, 0xB1, 0x2E, 0x85, 0x52, 0xC8, 0xF0, 0x11, 0xB1, 0x2E, 0x85, 0x53, 0xC8, 0xB1, 0x2E, 0x85,
+    0x54, 0xC8, 0xB1, 0x2E, 0x85, 0x55, 0xC8, 0xD0, 0xE1, 0xA5, 0x3A, 0x85, 0x53, 0xA9, 0x00, 0x85,
+    0x54, 0x85, 0x55, 0x4C, 0xD0, 0xF6, 0xA4, 0x34, 0xB1, 0x30, 0x29, 0xF8, 0x4A, 0x4A, 0x4A, 0x85,
+    0x56, 0xB1, 0x30, 0x29, 0x07, 0x0A, 0x0A, 0x85, 0x57, 0xC8, 0xD0, 0x06, 0xA5, 0x4E, 0x85, 0x31,
+    0xA4, 0x4F, 0xB1, 0x30, 0x29, 0xC0, 0x2A, 0x2A, 0x2A, 0x05, 0x57, 0x85, 0x57, 0xB1, 0x30, 0x29,
+    0x3E, 0x4A, 0x85, 0x58, 0xB1, 0x30, 0x29, 0x01, 0x0A, 0x0A, 0x0A, 0x0A, 0x85, 0x59, 0xC8, 0xB1,
+    0x30, 0x29, 0xF0, 0x4A, 0x4A, 0x4A, 0x4A, 0x05, 0x59, 0x85, 0x59, 0xB1, 0x30, 0x29, 0x0F, 0x0A,
+    0x85, 0x5A, 0xC8, 0xB1, 0x30, 0x29, 0x80, 0x18, 0x2A, 0x2A, 0x29, 0x01, 0x05, 0x5A, 0x85, 0x5A,
+    0xB1, 0x30, 0x29, 0x7C, 0x4A, 0x4A, 0x85, 0x5B, 0xB1, 0x30, 0x29, 0x03, 0x0A, 0x0A, 0x0A, 0x85,
+    0x5C, 0xC8, 0xD0, 0x06, 0xA5, 0x4E, 0x85, 0x31, 0xA4, 0x4F, 0xB1, 0x30, 0x29, 0xE0, 0x2A, 0x2A,
+    0x2A, 0x2A, 0x05, 0x5C, 0x85, 0x5C, 0xB1, 0x30, 0x29, 0x1F, 0x85, 0x5D, 0xC8, 0x84, 0x34, 0xA6,
+    0x56, 0xBD, 0xA0, 0xF8, 0xA6, 0x57, 0x1D, 0xC0, 0xF8, 0x85, 0x52, 0xA6, 0x58, 0xBD, 0xA0, 0xF8,
+    0xA6, 0x59, 0x1D, 0xC0, 0xF8, 0x85, 0x53, 0xA6, 0x5A, 0xBD, 0xA0, 0xF8, 0xA6, 0x5B, 0x1D, 0xC0,
+    0xF8, 0x85, 0x54, 0xA6, 0x5C, 0xBD, 0xA0, 0xF8, 0xA6, 0x5D, 0x1D, 0xC0, 0xF8, 0x85, 0x55, 0x60,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x10, 0xFF, 0xC0, 0x40, 0x50,
+    0xFF, 0xFF, 0x20, 0x30, 0xFF, 0xF0, 0x60, 0x70, 0xFF, 0x90, 0xA0, 0xB0, 0xFF, 0xD0, 0xE0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x01, 0xFF, 0x0C, 0x04, 0x05,
+    0xFF, 0xFF, 0x02, 0x03, 0xFF, 0x0F, 0x06, 0x07, 0xFF, 0x09, 0x0A, 0x0B, 0xFF, 0x0D, 0x0E, 0xFF,
+    0xA9, 0x00, 0x85, 0x34, 0x85, 0x2E, 0x85, 0x36, 0xA9, 0x01, 0x85, 0x4E, 0xA9, 0xBA, 0x85, 0x4F,
+    0xA5, 0x31, 0x85, 0x2F, 0x20, 0xE6, 0xF7, 0xA5, 0x52, 0x85, 0x38, 0xA4, 0x36, 0xA5, 0x53, 0x91,
+    0x2E, 0xC8, 0xA5, 0x54, 0x91, 0x2E, 0xC8, 0xA5, 0x55, 0x91, 0x2E, 0xC8, 0x84, 0x36, 0x20, 0xE6,
+    0xF7, 0xA4, 0x36, 0xA5, 0x52, 0x91, 0x2E, 0xC8, 0xF0, 0x11, 0xA5, 0x53, 0x91, 0x2E, 0xC8, 0xA5,
+    0x54, 0x91, 0x2E, 0xC8, 0xA5, 0x55, 0x91, 0x2E, 0xC8, 0xD0, 0xE1, 0xA5, 0x53, 0x85, 0x3A, 0xA5,
+    0x2F, 0x85, 0x31, 0x60, 0xA5, 0x31, 0x85, 0x2F, 0xA9, 0x00, 0x85, 0x31, 0xA9, 0x24, 0x85, 0x34,
+    0xA5, 0x39, 0x85, 0x52, 0xA5, 0x1A, 0x85, 0x53, 0xA5, 0x19, 0x85, 0x54, 0xA5, 0x18, 0x85, 0x55,
+    0x20, 0xD0, 0xF6, 0xA5, 0x17, 0x85, 0x52, 0xA5, 0x16, 0x85, 0x53, 0xA9, 0x00, 0x85, 0x54, 0x85,
+    0x55, 0x20, 0xD0, 0xF6, 0xA5, 0x2F, 0x85, 0x31, 0x60, 0xA4, 0x3F, 0x99, 0x00, 0x00, 0xA5, 0x50,
+    0xF0, 0x03, 0x20, 0xF2, 0xF5, 0x20, 0x8F, 0xF9, 0xA6, 0x49, 0x9A, 0x4C, 0xBE, 0xF2, 0xA9, 0xA0,
+    0x85, 0x20, 0xAD, 0x00, 0x1C, 0x09, 0x04, 0x8D, 0x00, 0x1C, 0xA9, 0x3C, 0x85, 0x48, 0x60, 0xA6,
+    0x3E, 0xA5, 0x20, 0x09, 0x10, 0x85, 0x20, 0xA9, 0xFF, 0x85, 0x48, 0x60, 0xAD, 0x07, 0x1C, 0x8D,
+    0x05, 0x1C, 0xAD, 0x00, 0x1C, 0x29, 0x10, 0xC5, 0x1E, 0x85, 0x1E, 0xF0, 0x04, 0xA9, 0x01, 0x85,
+    0x1C, 0xAD, 0xFE, 0x02, 0xF0, 0x15, 0xC9, 0x02, 0xD0, 0x07, 0xA9, 0x00, 0x8D, 0xFE, 0x02, 0xF0,
+    0x0A, 0x85, 0x4A, 0xA9, 0x02, 0x8D, 0xFE, 0x02, 0x4C, 0x2E, 0xFA, 0xA6, 0x3E, 0x30, 0x07, 0xA5,
+    0x20, 0xA8, 0xC9, 0x20, 0xD0, 0x03, 0x4C, 0xBE, 0xFA, 0xC6, 0x48, 0xD0, 0x1D, 0x98, 0x10, 0x04,
+    0x29, 0x7F, 0x85, 0x20, 0x29, 0x10, 0xF0, 0x12, 0xAD, 0x00, 0x1C, 0x29, 0xFB, 0x8D, 0x00, 0x1C,
+    0xA9, 0xFF, 0x85, 0x3E, 0xA9, 0x00, 0x85, 0x20, 0xF0, 0xDC, 0x98, 0x29, 0x40, 0xD0, 0x03, 0x4C,
+    0xBE, 0xFA, 0x6C, 0x62, 0x00, 0xA5, 0x4A, 0x10, 0x05, 0x49, 0xFF, 0x18, 0x69, 0x01, 0xC5, 0x64,
+    0xB0, 0x0A, 0xA9, 0x3B, 0x85, 0x62, 0xA9, 0xFA, 0x85, 0x63, 0xD0, 0x12, 0xE5, 0x5E, 0xE5, 0x5E,
+    0x85, 0x61, 0xA5, 0x5E, 0x85, 0x60, 0xA9, 0x7B, 0x85, 0x62, 0xA9, 0xFA, 0x85, 0x63, 0xA5, 0x4A,
+    0x10, 0x31, 0xE6, 0x4A, 0xAE, 0x00, 0x1C, 0xCA, 0x4C, 0x69, 0xFA, 0xA5, 0x4A, 0xD0, 0xEF, 0xA9,
+    0x4E, 0x85, 0x62, 0xA9, 0xFA, 0x85, 0x63, 0xA9, 0x05, 0x85, 0x60, 0x4C, 0xBE, 0xFA, 0xC6, 0x60,
+    0xD0, 0x6C, 0xA5, 0x20, 0x29, 0xBF, 0x85, 0x20, 0xA9, 0x05, 0x85, 0x62, 0xA9, 0xFA, 0x85, 0x63,
+    0x4C, 0xBE, 0xFA, 0xC6, 0x4A, 0xAE, 0x00, 0x1C, 0xE8, 0x8A, 0x29, 0x03, 0x85, 0x4B, 0xAD, 0x00,
+    0x1C, 0x29, 0xFC, 0x05, 0x4B, 0x8D, 0x00, 0x1C, 0x4C, 0xBE, 0xFA, 0x38, 0xAD, 0x07, 0x1C, 0xE5,
+    0x5F, 0x8D, 0x05, 0x1C, 0xC6, 0x60, 0xD0, 0x0C, 0xA5, 0x5E, 0x85, 0x60, 0xA9, 0x97, 0x85, 0x62,
+    0xA9, 0xFA, 0x85, 0x63, 0x4C, 0x2E, 0xFA, 0xC6, 0x61, 0xD0, 0xF9, 0xA9, 0xA5, 0x85, 0x62, 0xA9,
+    0xFA, 0x85, 0x63, 0xD0, 0xEF, 0xAD, 0x07, 0x1C, 0x18, 0x65, 0x5F, 0x8D, 0x05, 0x1C, 0xC6, 0x60,
+    0xD0, 0xE2, 0xA9, 0x4E, 0x85, 0x62, 0xA9, 0xFA, 0x85, 0x63, 0xA9, 0x05, 0x85, 0x60, 0xAD, 0x0C,
+    0x1C, 0x29, 0xFD, 0x8D, 0x0C, 0x1C, 0x60, 0xA5, 0x51, 0x10, 0x2A, 0xA6, 0x3D, 0xA9, 0x60, 0x95,
+    0x20, 0xA9, 0x01, 0x95, 0x22, 0x85, 0x51, 0xA9, 0xA4, 0x85, 0x4A, 0xAD, 0x00, 0x1C, 0x29, 0xFC,
+    0x8D, 0x00, 0x1C, 0xA9, 0x0A, 0x8D, 0x20, 0x06, 0xA9, 0xA0, 0x8D, 0x21, 0x06, 0xA9, 0x0F, 0x8D,
+    0x22, 0x06, 0x4C, 0x9C, 0xF9, 0xA0, 0x00, 0xD1, 0x32, 0xF0, 0x05, 0x91, 0x32, 0x4C, 0x9C, 0xF9,
+    0xAD, 0x00, 0x1C, 0x29, 0x10, 0xD0, 0x05, 0xA9, 0x08, 0x4C, 0xD3, 0xFD, 0x20, 0xA3, 0xFD, 0x20,
+    0xC3, 0xFD, 0xA9, 0x55, 0x8D, 0x01, 0x1C, 0x20, 0xC3, 0xFD, 0x20, 0x00, 0xFE, 0x20, 0x56, 0xF5,
+    0xA9, 0x40, 0x0D, 0x0B, 0x18, 0x8D, 0x0B, 0x18, 0xA9, 0x62, 0x8D, 0x06, 0x18, 0xA9, 0x00, 0x8D,
+    0x07, 0x18, 0x8D, 0x05, 0x18, 0xA0, 0x00, 0xA2, 0x00, 0x2C, 0x00, 0x1C, 0x30, 0xFB, 0x2C, 0x00,
+    0x1C, 0x10, 0xFB, 0xAD, 0x04, 0x18, 0x2C, 0x00, 0x1C, 0x10, 0x11, 0xAD, 0x0D, 0x18, 0x0A, 0x10,
+    0xF5, 0xE8, 0xD0, 0xEF, 0xC8, 0xD0, 0xEC, 0xA9, 0x02, 0x4C, 0xD3, 0xFD, 0x86, 0x71, 0x84, 0x72,
+    0xA2, 0x00, 0xA0, 0x00, 0xAD, 0x04, 0x18, 0x2C, 0x00, 0x1C, 0x30, 0x11, 0xAD, 0x0D, 0x18, 0x0A,
+    0x10, 0xF5, 0xE8, 0xD0, 0xEF, 0xC8, 0xD0, 0xEC, 0xA9, 0x02, 0x4C, 0xD3, 0xFD, 0x38, 0x8A, 0xE5,
+    0x71, 0xAA, 0x85, 0x70, 0x98, 0xE5, 0x72, 0xA8, 0x85, 0x71, 0x10, 0x0B, 0x49, 0xFF, 0xA8, 0x8A,
+    0x49, 0xFF, 0xAA, 0xE8, 0xD0, 0x01, 0xC8, 0x98, 0xD0, 0x04, 0xE0, 0x04, 0x90, 0x18, 0x06, 0x70,
+    0x26, 0x71, 0x18, 0xA5, 0x70, 0x6D, 0x21, 0x06, 0x8D, 0x21, 0x06, 0xA5, 0x71, 0x6D, 0x22, 0x06,
+    0x8D, 0x22, 0x06, 0x4C, 0x0C, 0xFB, 0xA2, 0x00, 0xA0, 0x00, 0xB8, 0xAD, 0x00, 0x1C, 0x10, 0x0E,
+    0x50, 0xF9, 0xB8, 0xE8, 0xD0, 0xF5, 0xC8, 0xD0, 0xF2, 0xA9, 0x03, 0x4C, 0xD3, 0xFD, 0x8A, 0x0A,
+    0x8D, 0x25, 0x06, 0x98, 0x2A, 0x8D, 0x24, 0x06, 0xA9, 0xBF, 0x2D, 0x0B, 0x18, 0x8D, 0x0B, 0x18,
+    0xA9, 0x66, 0x8D, 0x26, 0x06, 0xA6, 0x43, 0xA0, 0x00, 0x98, 0x18, 0x6D, 0x26, 0x06, 0x90, 0x01,
+    0xC8, 0xC8, 0xCA, 0xD0, 0xF5, 0x49, 0xFF, 0x38, 0x69, 0x00, 0x18, 0x6D, 0x25, 0x06, 0xB0, 0x03,
+    0xCE, 0x24, 0x06, 0xAA, 0x98, 0x49, 0xFF, 0x38, 0x69, 0x00, 0x18, 0x6D, 0x24, 0x06, 0x10, 0x05,
+    0xA9, 0x04, 0x4C, 0xD3, 0xFD, 0xA8, 0x8A, 0xA2, 0x00, 0x38, 0xE5, 0x43, 0xB0, 0x03, 0x88, 0x30,
+    0x03, 0xE8, 0xD0, 0xF5, 0x8E, 0x26, 0x06, 0xE0, 0x04, 0xB0, 0x05, 0xA9, 0x05, 0x4C, 0xD3, 0xFD,
+    0x18, 0x65, 0x43, 0x8D, 0x27, 0x06, 0xA9, 0x00, 0x8D, 0x28, 0x06, 0xA0, 0x00, 0xA6, 0x3D, 0xA5,
+    0x39, 0x99, 0x00, 0x03, 0xC8, 0xC8, 0xAD, 0x28, 0x06, 0x99, 0x00, 0x03, 0xC8, 0xA5, 0x51, 0x99,
+    0x00, 0x03, 0xC8, 0xB5, 0x13, 0x99, 0x00, 0x03, 0xC8, 0xB5, 0x12, 0x99, 0x00, 0x03, 0xC8, 0xA9,
+    0x0F, 0x99, 0x00, 0x03, 0xC8, 0x99, 0x00, 0x03, 0xC8, 0xA9, 0x00, 0x59, 0xFA, 0x02, 0x59, 0xFB,
+    0x02, 0x59, 0xFC, 0x02, 0x59, 0xFD, 0x02, 0x99, 0xF9, 0x02, 0xEE, 0x28, 0x06, 0xAD, 0x28, 0x06,
+    0xC5, 0x43, 0x90, 0xBB, 0x98, 0x48, 0xE8, 0x8A, 0x9D, 0x00, 0x05, 0xE8, 0xD0, 0xFA, 0xA9, 0x03,
+    0x85, 0x31, 0x20, 0x30, 0xFE, 0x68, 0xA8, 0x88, 0x20, 0xE5, 0xFD, 0x20, 0xF5, 0xFD, 0xA9, 0x05,
+    0x85, 0x31, 0x20, 0xE9, 0xF5, 0x85, 0x3A, 0x20, 0x8F, 0xF7, 0xA9, 0x00, 0x85, 0x32, 0x20, 0x0E,
+    0xFE, 0xA9, 0xFF, 0x8D, 0x01, 0x1C, 0xA2, 0x05, 0x50, 0xFE, 0xB8, 0xCA, 0xD0, 0xFA, 0xA2, 0x0A,
+    0xA4, 0x32, 0x50, 0xFE, 0xB8, 0xB9, 0x00, 0x03, 0x8D, 0x01, 0x1C, 0xC8, 0xCA, 0xD0, 0xF3, 0xA2,
+    0x08, 0x50, 0xFE, 0xB8, 0xA9, 0x55, 0x8D, 0x01, 0x1C, 0xCA, 0xD0, 0xF5, 0xA9, 0xFF, 0xA2, 0x05,
+    0x50, 0xFE, 0xB8, 0x8D, 0x01, 0x1C, 0xCA, 0xD0, 0xF7, 0xA2, 0xBB, 0x50, 0xFE, 0xB8, 0xBD, 0x00,
+    0x01, 0x8D, 0x01, 0x1C, 0xE8, 0xD0, 0xF4, 0xA0, 0x00, 0x50, 0xFE, 0xB8, 0xB1, 0x30, 0x8D, 0x01,
+    0x1C, 0xC8, 0xD0, 0xF5, 0xA9, 0x55, 0xAE, 0x26, 0x06, 0x50, 0xFE, 0xB8, 0x8D, 0x01, 0x1C, 0xCA,
+    0xD0, 0xF7, 0xA5, 0x32, 0x18, 0x69, 0x0A, 0x85, 0x32, 0xCE, 0x28, 0x06, 0xD0, 0x93, 0x50, 0xFE,
+    0xB8, 0x50, 0xFE, 0xB8, 0x20, 0x00, 0xFE, 0xA9, 0xC8, 0x8D, 0x23, 0x06, 0xA9, 0x00, 0x85, 0x30,
+    0xA9, 0x03, 0x85, 0x31, 0xA5, 0x43, 0x8D, 0x28, 0x06, 0x20, 0x56, 0xF5, 0xA2, 0x0A, 0xA0, 0x00,
+    0x50, 0xFE, 0xB8, 0xAD, 0x01, 0x1C, 0xD1, 0x30, 0xD0, 0x0E, 0xC8, 0xCA, 0xD0, 0xF2, 0x18, 0xA5,
+    0x30, 0x69, 0x0A, 0x85, 0x30, 0x4C, 0x62, 0xFD, 0xCE, 0x23, 0x06, 0xD0, 0xCF, 0xA9, 0x06, 0x4C,
+    0xD3, 0xFD, 0x20, 0x56, 0xF5, 0xA0, 0xBB, 0x50, 0xFE, 0xB8, 0xAD, 0x01, 0x1C, 0xD9, 0x00, 0x01,
+    0xD0, 0xE6, 0xC8, 0xD0, 0xF2, 0xA2, 0xFC, 0x50, 0xFE, 0xB8, 0xAD, 0x01, 0x1C, 0xD9, 0x00, 0x05,
+    0xD0, 0xD6, 0xC8, 0xCA, 0xD0, 0xF1, 0xCE, 0x28, 0x06, 0xD0, 0xAE, 0xE6, 0x51, 0xA5, 0x51, 0xC9,
+    0x24, 0xB0, 0x03, 0x4C, 0x9C, 0xF9, 0xA9, 0xFF, 0x85, 0x51, 0xA9, 0x00, 0x85, 0x50, 0xA9, 0x01,
+    0x4C, 0x69, 0xF9, 0xAD, 0x0C, 0x1C, 0x29, 0x1F, 0x09, 0xC0, 0x8D, 0x0C, 0x1C, 0xA9, 0xFF, 0x8D,
+    0x03, 0x1C, 0x8D, 0x01, 0x1C, 0xA2, 0x28, 0xA0, 0x00, 0x50, 0xFE, 0xB8, 0x88, 0xD0, 0xFA, 0xCA,
+    0xD0, 0xF7, 0x60, 0xAE, 0x21, 0x06, 0xAC, 0x22, 0x06, 0x50, 0xFE, 0xB8, 0xCA, 0xD0, 0xFA, 0x88,
+    0x10, 0xF7, 0x60, 0xCE, 0x20, 0x06, 0xF0, 0x03, 0x4C, 0x9C, 0xF9, 0xA0, 0xFF, 0x84, 0x51, 0xC8,
+    0x84, 0x50, 0x4C, 0x69, 0xF9, 0xB9, 0x00, 0x03, 0x99, 0x45, 0x03, 0x88, 0xD0, 0xF7, 0xAD, 0x00,
+    0x03, 0x8D, 0x45, 0x03, 0x60, 0xA0, 0x44, 0xB9, 0xBB, 0x01, 0x91, 0x30, 0x88, 0x10, 0xF8, 0x60,
+    0xAD, 0x0C, 0x1C, 0x09, 0xE0, 0x8D, 0x0C, 0x1C, 0xA9, 0x00, 0x8D, 0x03, 0x1C, 0x60, 0xAD, 0x0C,
+    0x1C, 0x29, 0x1F, 0x09, 0xC0, 0x8D, 0x0C, 0x1C, 0xA9, 0xFF, 0x8D, 0x03, 0x1C, 0xA9, 0x55, 0x8D,
+    0x01, 0x1C, 0xA2, 0x28, 0xA0, 0x00, 0x50, 0xFE, 0xB8, 0x88, 0xD0, 0xFA, 0xCA, 0xD0, 0xF7, 0x60,
+    0xA9, 0x00, 0x85, 0x30, 0x85, 0x2E, 0x85, 0x36, 0xA9, 0xBB, 0x85, 0x34, 0xA5, 0x31, 0x85, 0x2F,
+    0xA9, 0x01, 0x85, 0x31, 0xA4, 0x36, 0xB1, 0x2E, 0x85, 0x52, 0xC8, 0xB1, 0x2E, 0x85, 0x53, 0xC8,
+    0xB1, 0x2E, 0x85, 0x54, 0xC8, 0xB1, 0x2E, 0x85, 0x55, 0xC8, 0xF0, 0x08, 0x84, 0x36, 0x20, 0xD0,
+    0xF6, 0x4C, 0x44, 0xFE, 0x4C, 0xD0, 0xF6, 0x48, 0x8A, 0x48, 0x98, 0x48, 0xAD, 0x0D, 0x18, 0x29,
+    0x02, 0xF0, 0x03, 0x20, 0x53, 0xE8, 0xAD, 0x0D, 0x1C, 0x0A, 0x10, 0x03, 0x20, 0xB0, 0xF2, 0x68,
+    0xA8, 0x68, 0xAA, 0x68, 0x40, 0x12, 0x04, 0x04, 0x90, 0x56, 0x49, 0x44, 0x4D, 0x42, 0x55, 0x50,
+    0x26, 0x43, 0x52, 0x53, 0x4E, 0x84, 0x05, 0xC1, 0xF8, 0x1B, 0x5C, 0x07, 0xA3, 0xF0, 0x88, 0x23,
+    0x0D, 0xED, 0xD0, 0xC8, 0xCA, 0xCC, 0xCB, 0xE2, 0xE7, 0xC8, 0xCA, 0xC8, 0xEE, 0x51, 0xDD, 0x1C,
+    0x9E, 0x1C, 0x52, 0x57, 0x41, 0x4D, 0x44, 0x53, 0x50, 0x55, 0x4C, 0x44, 0x53, 0x50, 0x55, 0x52,
+    0x45, 0x45, 0x52, 0x53, 0x45, 0x4C, 0x51, 0x47, 0x52, 0x4C, 0x08, 0x00, 0x00, 0x3F, 0x7F, 0xBF,
+    0xFF, 0x11, 0x12, 0x13, 0x15, 0x41, 0x04, 0x24, 0x1F, 0x19, 0x12, 0x01, 0xFF, 0xFF, 0x01, 0x00,
+    0x03, 0x04, 0x05, 0x06, 0x07, 0x07, 0xFD, 0x6C, 0x65, 0x00, 0x8D, 0x00, 0x1C, 0x8D, 0x02, 0x1C,
+    0x4C, 0x7D, 0xEA, 0x8A, 0xA2, 0x05, 0xCA, 0xD0, 0xFD, 0xAA, 0x60, 0x20, 0xAE, 0xE9, 0x4C, 0x9C,
+    0xE9, 0xAD, 0x02, 0x02, 0xC9, 0x2D, 0xF0, 0x05, 0x38, 0xE9, 0x2B, 0xD0, 0xDA, 0x85, 0x23, 0x60,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xC6, 0xC8, 0x8F, 0xF9, 0x5F, 0xCD, 0x97, 0xCD, 0x00, 0x05,
+    0x03, 0x05, 0x06, 0x05, 0x09, 0x05, 0x0C, 0x05, 0x0F, 0x05, 0x01, 0xFF, 0xA0, 0xEA, 0x67, 0xFE,
+};
+
+static inline uint32_t rom_C100(cpu *c) {
+    uint32_t cycles = 0;
+    S(sei, IMP, 0x0000, 0xC101, 2)   // C100
+    S(lda, IMM, 0x00F7, 0xC103, 2)   // C101
+    S(and, AB_, 0x1C00, 0xC106, 4)   // C103
+    S(pha, IMP, 0x0000, 0xC107, 3)   // C106
+    S(lda, ZP_, 0x007F, 0xC109, 3)   // C107
+    S(beq, REL, 0x0005, 0xC10B, 2)   // C109
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_C10B(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xC10C, 4)   // C10B
+    S(ora, IMM, 0x0000, 0xC10E, 2)   // C10C
+    S(bne, REL, 0x0003, 0xC110, 2)   // C10E
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C110(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xC111, 4)   // C110
+    S(ora, IMM, 0x0008, 0xC113, 2)   // C111
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C113(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, AB_, 0x1C00, 0xC116, 4)   // C113
+    S(cli, IMP, 0x0000, 0xC117, 2)   // C116
+    S(rts, IMP, 0x0000, 0xC118, 6)   // C117
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C123(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xC125, 2)   // C123
+    S(sta, AB_, 0x026C, 0xC128, 4)   // C125
+    S(sta, AB_, 0x026D, 0xC12B, 4)   // C128
+    S(rts, IMP, 0x0000, 0xC12C, 6)   // C12B
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C12C(cpu *c) {
+    uint32_t cycles = 0;
+    S(sei, IMP, 0x0000, 0xC12D, 2)   // C12C
+    S(txa, IMP, 0x0000, 0xC12E, 2)   // C12D
+    S(pha, IMP, 0x0000, 0xC12F, 3)   // C12E
+    S(lda, IMM, 0x0050, 0xC131, 2)   // C12F
+    S(sta, AB_, 0x026C, 0xC134, 4)   // C131
+    S(ldx, IMM, 0x0000, 0xC136, 2)   // C134
+    S(lda, ABX, 0xFECA, 0xC139, 4)   // C136
+    S(sta, AB_, 0x026D, 0xC13C, 4)   // C139
+    S(ora, AB_, 0x1C00, 0xC13F, 4)   // C13C
+    S(sta, AB_, 0x1C00, 0xC142, 4)   // C13F
+    S(pla, IMP, 0x0000, 0xC143, 4)   // C142
+    S(tax, IMP, 0x0000, 0xC144, 2)   // C143
+    S(cli, IMP, 0x0000, 0xC145, 2)   // C144
+    S(rts, IMP, 0x0000, 0xC146, 6)   // C145
+    c->executed += 14;
+    return cycles;
+}
+
+static inline uint32_t rom_C146(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xC148, 2)   // C146
+    S(sta, AB_, 0x02F9, 0xC14B, 4)   // C148
+    S(lda, AB_, 0x028E, 0xC14E, 4)   // C14B
+    S(sta, ZP_, 0x007F, 0xC150, 3)   // C14E
+    S(jsr, AB_, 0xE6BC, 0xC153, 6)   // C150
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_C153(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0084, 0xC155, 3)   // C153
+    S(bpl, REL, 0x0009, 0xC157, 2)   // C155
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C157(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x000F, 0xC159, 2)   // C157
+    S(cmp, IMM, 0x000F, 0xC15B, 2)   // C159
+    S(beq, REL, 0x0003, 0xC15D, 2)   // C15B
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C15D(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xD7B4, 0xC160, 3)   // C15D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C160(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC2B3, 0xC163, 6)   // C160
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C163(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x00A3, 0xC165, 5)   // C163
+    S(sta, AB_, 0x0275, 0xC168, 4)   // C165
+    S(ldx, IMM, 0x000B, 0xC16A, 2)   // C168
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C16A(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABX, 0xFE89, 0xC16D, 4)   // C16A
+    S(cmp, AB_, 0x0275, 0xC170, 4)   // C16D
+    S(beq, REL, 0x0008, 0xC172, 2)   // C170
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C172(cpu *c) {
+    uint32_t cycles = 0;
+    S(dex, IMP, 0x0000, 0xC173, 2)   // C172
+    S(bpl, REL, 0x00F5, 0xC175, 2)   // C173
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C175(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0031, 0xC177, 2)   // C175
+    S(jmp, AB_, 0xC1C8, 0xC17A, 3)   // C177
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C17A(cpu *c) {
+    uint32_t cycles = 0;
+    S(stx, AB_, 0x022A, 0xC17D, 4)   // C17A
+    S(cpx, IMM, 0x0009, 0xC17F, 2)   // C17D
+    S(bcc, REL, 0x0003, 0xC181, 2)   // C17F
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C181(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC1EE, 0xC184, 6)   // C181
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C184(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, AB_, 0x022A, 0xC187, 4)   // C184
+    S(lda, ABX, 0xFE95, 0xC18A, 4)   // C187
+    S(sta, ZP_, 0x006F, 0xC18C, 3)   // C18A
+    S(lda, ABX, 0xFEA1, 0xC18F, 4)   // C18C
+    S(sta, ZP_, 0x0070, 0xC191, 3)   // C18F
+    S(jmp, IN_, 0x006F, 0xC194, 5)   // C191
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_C194(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xC196, 2)   // C194
+    S(sta, AB_, 0x02F9, 0xC199, 4)   // C196
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C199(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x026C, 0xC19C, 4)   // C199
+    S(bne, REL, 0x002A, 0xC19E, 2)   // C19C
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C19E(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0000, 0xC1A0, 2)   // C19E
+    S(tya, IMP, 0x0000, 0xC1A1, 2)   // C1A0
+    S(sty, ZP_, 0x0080, 0xC1A3, 3)   // C1A1
+    S(sty, ZP_, 0x0081, 0xC1A5, 3)   // C1A3
+    S(sty, ZP_, 0x00A3, 0xC1A7, 3)   // C1A5
+    S(jsr, AB_, 0xE6C7, 0xC1AA, 6)   // C1A7
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_C1AA(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC123, 0xC1AD, 6)   // C1AA
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C1AD(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x007F, 0xC1AF, 3)   // C1AD
+    S(sta, AB_, 0x028E, 0xC1B2, 4)   // C1AF
+    S(tax, IMP, 0x0000, 0xC1B3, 2)   // C1B2
+    S(lda, IMM, 0x0000, 0xC1B5, 2)   // C1B3
+    S(sta, ZPX, 0x00FF, 0xC1B7, 4)   // C1B5
+    S(jsr, AB_, 0xC1BD, 0xC1BA, 6)   // C1B7
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_C1BA(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xD4DA, 0xC1BD, 3)   // C1BA
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C1BD(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0028, 0xC1BF, 2)   // C1BD
+    S(lda, IMM, 0x0000, 0xC1C1, 2)   // C1BF
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C1C1(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ABY, 0x0200, 0xC1C4, 5)   // C1C1
+    S(dey, IMP, 0x0000, 0xC1C5, 2)   // C1C4
+    S(bpl, REL, 0x00FA, 0xC1C7, 2)   // C1C5
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C1C7(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xC1C8, 6)   // C1C7
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C1C8(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0000, 0xC1CA, 2)   // C1C8
+    S(sty, ZP_, 0x0080, 0xC1CC, 3)   // C1CA
+    S(sty, ZP_, 0x0081, 0xC1CE, 3)   // C1CC
+    S(jmp, AB_, 0xE645, 0xC1D1, 3)   // C1CE
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C1D1(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, IMM, 0x0000, 0xC1D3, 2)   // C1D1
+    S(stx, AB_, 0x027A, 0xC1D6, 4)   // C1D3
+    S(lda, IMM, 0x003A, 0xC1D8, 2)   // C1D6
+    S(jsr, AB_, 0xC268, 0xC1DB, 6)   // C1D8
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C1DB(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x0005, 0xC1DD, 2)   // C1DB
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C1DD(cpu *c) {
+    uint32_t cycles = 0;
+    S(dey, IMP, 0x0000, 0xC1DE, 2)   // C1DD
+    S(dey, IMP, 0x0000, 0xC1DF, 2)   // C1DE
+    S(sty, AB_, 0x027A, 0xC1E2, 4)   // C1DF
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C1E2(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xC368, 0xC1E5, 3)   // C1E2
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C1E5(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0000, 0xC1E7, 2)   // C1E5
+    S(ldx, IMM, 0x0000, 0xC1E9, 2)   // C1E7
+    S(lda, IMM, 0x003A, 0xC1EB, 2)   // C1E9
+    S(jmp, AB_, 0xC268, 0xC1EE, 3)   // C1EB
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C1EE(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC1E5, 0xC1F1, 6)   // C1EE
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C1F1(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x0005, 0xC1F3, 2)   // C1F1
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C1F3(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0034, 0xC1F5, 2)   // C1F3
+    S(jmp, AB_, 0xC1C8, 0xC1F8, 3)   // C1F5
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C1F8(cpu *c) {
+    uint32_t cycles = 0;
+    S(dey, IMP, 0x0000, 0xC1F9, 2)   // C1F8
+    S(dey, IMP, 0x0000, 0xC1FA, 2)   // C1F9
+    S(sty, AB_, 0x027A, 0xC1FD, 4)   // C1FA
+    S(txa, IMP, 0x0000, 0xC1FE, 2)   // C1FD
+    S(bne, REL, 0x00F3, 0xC200, 2)   // C1FE
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_C200(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x003D, 0xC202, 2)   // C200
+    S(jsr, AB_, 0xC268, 0xC205, 6)   // C202
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C205(cpu *c) {
+    uint32_t cycles = 0;
+    S(txa, IMP, 0x0000, 0xC206, 2)   // C205
+    S(beq, REL, 0x0002, 0xC208, 2)   // C206
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C208(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0040, 0xC20A, 2)   // C208
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C20A(cpu *c) {
+    uint32_t cycles = 0;
+    S(ora, IMM, 0x0021, 0xC20C, 2)   // C20A
+    S(sta, AB_, 0x028B, 0xC20F, 4)   // C20C
+    S(inx, IMP, 0x0000, 0xC210, 2)   // C20F
+    S(stx, AB_, 0x0277, 0xC213, 4)   // C210
+    S(stx, AB_, 0x0278, 0xC216, 4)   // C213
+    S(lda, AB_, 0x028A, 0xC219, 4)   // C216
+    S(beq, REL, 0x000D, 0xC21B, 2)   // C219
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_C21B(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0080, 0xC21D, 2)   // C21B
+    S(ora, AB_, 0x028B, 0xC220, 4)   // C21D
+    S(sta, AB_, 0x028B, 0xC223, 4)   // C220
+    S(lda, IMM, 0x0000, 0xC225, 2)   // C223
+    S(sta, AB_, 0x028A, 0xC228, 4)   // C225
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_C228(cpu *c) {
+    uint32_t cycles = 0;
+    S(tya, IMP, 0x0000, 0xC229, 2)   // C228
+    S(beq, REL, 0x0029, 0xC22B, 2)   // C229
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C22B(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ABX, 0x027A, 0xC22E, 5)   // C22B
+    S(lda, AB_, 0x0277, 0xC231, 4)   // C22E
+    S(sta, AB_, 0x0279, 0xC234, 4)   // C231
+    S(lda, IMM, 0x008D, 0xC236, 2)   // C234
+    S(jsr, AB_, 0xC268, 0xC239, 6)   // C236
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_C239(cpu *c) {
+    uint32_t cycles = 0;
+    S(inx, IMP, 0x0000, 0xC23A, 2)   // C239
+    S(stx, AB_, 0x0278, 0xC23D, 4)   // C23A
+    S(dex, IMP, 0x0000, 0xC23E, 2)   // C23D
+    S(lda, AB_, 0x028A, 0xC241, 4)   // C23E
+    S(beq, REL, 0x0002, 0xC243, 2)   // C241
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_C243(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0008, 0xC245, 2)   // C243
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C245(cpu *c) {
+    uint32_t cycles = 0;
+    S(cpx, AB_, 0x0277, 0xC248, 4)   // C245
+    S(beq, REL, 0x0002, 0xC24A, 2)   // C248
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C24A(cpu *c) {
+    uint32_t cycles = 0;
+    S(ora, IMM, 0x0004, 0xC24C, 2)   // C24A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C24C(cpu *c) {
+    uint32_t cycles = 0;
+    S(ora, IMM, 0x0003, 0xC24E, 2)   // C24C
+    S(eor, AB_, 0x028B, 0xC251, 4)   // C24E
+    S(sta, AB_, 0x028B, 0xC254, 4)   // C251
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C254(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x028B, 0xC257, 4)   // C254
+    S(ldx, AB_, 0x022A, 0xC25A, 4)   // C257
+    S(and, ABX, 0xFEA5, 0xC25D, 4)   // C25A
+    S(bne, REL, 0x0001, 0xC25F, 2)   // C25D
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C25F(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xC260, 6)   // C25F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C260(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, AB_, 0x026C, 0xC263, 4)   // C260
+    S(lda, IMM, 0x0030, 0xC265, 2)   // C263
+    S(jmp, AB_, 0xC1C8, 0xC268, 3)   // C265
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C268(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, AB_, 0x0275, 0xC26B, 4)   // C268
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C26B(cpu *c) {
+    uint32_t cycles = 0;
+    S(cpy, AB_, 0x0274, 0xC26E, 4)   // C26B
+    S(bcs, REL, 0x002E, 0xC270, 2)   // C26E
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C270(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x00A3, 0xC272, 5)   // C270
+    S(iny, IMP, 0x0000, 0xC273, 2)   // C272
+    S(cmp, AB_, 0x0275, 0xC276, 4)   // C273
+    S(beq, REL, 0x0028, 0xC278, 2)   // C276
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C278(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x002A, 0xC27A, 2)   // C278
+    S(beq, REL, 0x0004, 0xC27C, 2)   // C27A
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C27C(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x003F, 0xC27E, 2)   // C27C
+    S(bne, REL, 0x0003, 0xC280, 2)   // C27E
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C280(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, AB_, 0x028A, 0xC283, 6)   // C280
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C283(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x002C, 0xC285, 2)   // C283
+    S(bne, REL, 0x00E4, 0xC287, 2)   // C285
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C287(cpu *c) {
+    uint32_t cycles = 0;
+    S(tya, IMP, 0x0000, 0xC288, 2)   // C287
+    S(sta, ABX, 0x027B, 0xC28B, 5)   // C288
+    S(lda, AB_, 0x028A, 0xC28E, 4)   // C28B
+    S(and, IMM, 0x007F, 0xC290, 2)   // C28E
+    S(beq, REL, 0x0007, 0xC292, 2)   // C290
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_C292(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0080, 0xC294, 2)   // C292
+    S(sta, ZPX, 0x00E7, 0xC296, 4)   // C294
+    S(sta, AB_, 0x028A, 0xC299, 4)   // C296
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C299(cpu *c) {
+    uint32_t cycles = 0;
+    S(inx, IMP, 0x0000, 0xC29A, 2)   // C299
+    S(cpx, IMM, 0x0004, 0xC29C, 2)   // C29A
+    S(bcc, REL, 0x00CD, 0xC29E, 2)   // C29C
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C29E(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0000, 0xC2A0, 2)   // C29E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C2A0(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0274, 0xC2A3, 4)   // C2A0
+    S(sta, ABX, 0x027B, 0xC2A6, 5)   // C2A3
+    S(lda, AB_, 0x028A, 0xC2A9, 4)   // C2A6
+    S(and, IMM, 0x007F, 0xC2AB, 2)   // C2A9
+    S(beq, REL, 0x0004, 0xC2AD, 2)   // C2AB
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_C2AD(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0080, 0xC2AF, 2)   // C2AD
+    S(sta, ZPX, 0x00E7, 0xC2B1, 4)   // C2AF
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C2B1(cpu *c) {
+    uint32_t cycles = 0;
+    S(tya, IMP, 0x0000, 0xC2B2, 2)   // C2B1
+    S(rts, IMP, 0x0000, 0xC2B3, 6)   // C2B2
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C2B3(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, ZP_, 0x00A3, 0xC2B5, 3)   // C2B3
+    S(beq, REL, 0x0014, 0xC2B7, 2)   // C2B5
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C2B7(cpu *c) {
+    uint32_t cycles = 0;
+    S(dey, IMP, 0x0000, 0xC2B8, 2)   // C2B7
+    S(beq, REL, 0x0010, 0xC2BA, 2)   // C2B8
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C2BA(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABY, 0x0200, 0xC2BD, 4)   // C2BA
+    S(cmp, IMM, 0x000D, 0xC2BF, 2)   // C2BD
+    S(beq, REL, 0x000A, 0xC2C1, 2)   // C2BF
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C2C1(cpu *c) {
+    uint32_t cycles = 0;
+    S(dey, IMP, 0x0000, 0xC2C2, 2)   // C2C1
+    S(lda, ABY, 0x0200, 0xC2C5, 4)   // C2C2
+    S(cmp, IMM, 0x000D, 0xC2C7, 2)   // C2C5
+    S(beq, REL, 0x0002, 0xC2C9, 2)   // C2C7
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C2C9(cpu *c) {
+    uint32_t cycles = 0;
+    S(iny, IMP, 0x0000, 0xC2CA, 2)   // C2C9
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C2CA(cpu *c) {
+    uint32_t cycles = 0;
+    S(iny, IMP, 0x0000, 0xC2CB, 2)   // C2CA
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C2CB(cpu *c) {
+    uint32_t cycles = 0;
+    S(sty, AB_, 0x0274, 0xC2CE, 4)   // C2CB
+    S(cpy, IMM, 0x002A, 0xC2D0, 2)   // C2CE
+    S(ldy, IMM, 0x00FF, 0xC2D2, 2)   // C2D0
+    S(bcc, REL, 0x0008, 0xC2D4, 2)   // C2D2
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C2D4(cpu *c) {
+    uint32_t cycles = 0;
+    S(sty, AB_, 0x022A, 0xC2D7, 4)   // C2D4
+    S(lda, IMM, 0x0032, 0xC2D9, 2)   // C2D7
+    S(jmp, AB_, 0xC1C8, 0xC2DC, 3)   // C2D9
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C2DC(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0000, 0xC2DE, 2)   // C2DC
+    S(tya, IMP, 0x0000, 0xC2DF, 2)   // C2DE
+    S(sta, ZP_, 0x00A3, 0xC2E1, 3)   // C2DF
+    S(sta, AB_, 0x0258, 0xC2E4, 4)   // C2E1
+    S(sta, AB_, 0x024A, 0xC2E7, 4)   // C2E4
+    S(sta, AB_, 0x0296, 0xC2EA, 4)   // C2E7
+    S(sta, ZP_, 0x00D3, 0xC2EC, 3)   // C2EA
+    S(sta, AB_, 0x0279, 0xC2EF, 4)   // C2EC
+    S(sta, AB_, 0x0277, 0xC2F2, 4)   // C2EF
+    S(sta, AB_, 0x0278, 0xC2F5, 4)   // C2F2
+    S(sta, AB_, 0x028A, 0xC2F8, 4)   // C2F5
+    S(sta, AB_, 0x026C, 0xC2FB, 4)   // C2F8
+    S(ldx, IMM, 0x0005, 0xC2FD, 2)   // C2FB
+    c->executed += 13;
+    return cycles;
+}
+
+static inline uint32_t rom_C2FD(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ABX, 0x0279, 0xC300, 5)   // C2FD
+    S(sta, ZPX, 0x00D7, 0xC302, 4)   // C300
+    S(sta, ZPX, 0x00DC, 0xC304, 4)   // C302
+    S(sta, ZPX, 0x00E1, 0xC306, 4)   // C304
+    S(sta, ZPX, 0x00E6, 0xC308, 4)   // C306
+    S(sta, ABX, 0x027F, 0xC30B, 5)   // C308
+    S(sta, ABX, 0x0284, 0xC30E, 5)   // C30B
+    S(dex, IMP, 0x0000, 0xC30F, 2)   // C30E
+    S(bne, REL, 0x00EC, 0xC311, 2)   // C30F
+    c->executed += 9;
+    return cycles;
+}
+
+static inline uint32_t rom_C311(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xC312, 6)   // C311
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C312(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0278, 0xC315, 4)   // C312
+    S(sta, AB_, 0x0277, 0xC318, 4)   // C315
+    S(lda, IMM, 0x0001, 0xC31A, 2)   // C318
+    S(sta, AB_, 0x0278, 0xC31D, 4)   // C31A
+    S(sta, AB_, 0x0279, 0xC320, 4)   // C31D
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_C320(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, AB_, 0x028E, 0xC323, 4)   // C320
+    S(ldx, IMM, 0x0000, 0xC325, 2)   // C323
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C325(cpu *c) {
+    uint32_t cycles = 0;
+    S(stx, ZP_, 0x00D3, 0xC327, 3)   // C325
+    S(lda, ABX, 0x027A, 0xC32A, 4)   // C327
+    S(jsr, AB_, 0xC33C, 0xC32D, 6)   // C32A
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C32D(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x00D3, 0xC32F, 3)   // C32D
+    S(sta, ABX, 0x027A, 0xC332, 5)   // C32F
+    S(tya, IMP, 0x0000, 0xC333, 2)   // C332
+    S(sta, ZPX, 0x00E2, 0xC335, 4)   // C333
+    S(inx, IMP, 0x0000, 0xC336, 2)   // C335
+    S(cpx, AB_, 0x0278, 0xC339, 4)   // C336
+    S(bcc, REL, 0x00EA, 0xC33B, 2)   // C339
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_C33B(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xC33C, 6)   // C33B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C33C(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xC33D, 2)   // C33C
+    S(ldy, IMM, 0x0000, 0xC33F, 2)   // C33D
+    S(lda, IMM, 0x003A, 0xC341, 2)   // C33F
+    S(cmp, ABX, 0x0201, 0xC344, 4)   // C341
+    S(beq, REL, 0x000C, 0xC346, 2)   // C344
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_C346(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, ABX, 0x0200, 0xC349, 4)   // C346
+    S(bne, REL, 0x0016, 0xC34B, 2)   // C349
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C34B(cpu *c) {
+    uint32_t cycles = 0;
+    S(inx, IMP, 0x0000, 0xC34C, 2)   // C34B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C34C(cpu *c) {
+    uint32_t cycles = 0;
+    S(tya, IMP, 0x0000, 0xC34D, 2)   // C34C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C34D(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x0001, 0xC34F, 2)   // C34D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C34F(cpu *c) {
+    uint32_t cycles = 0;
+    S(tay, IMP, 0x0000, 0xC350, 2)   // C34F
+    S(txa, IMP, 0x0000, 0xC351, 2)   // C350
+    S(rts, IMP, 0x0000, 0xC352, 6)   // C351
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C352(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABX, 0x0200, 0xC355, 4)   // C352
+    S(inx, IMP, 0x0000, 0xC356, 2)   // C355
+    S(inx, IMP, 0x0000, 0xC357, 2)   // C356
+    S(cmp, IMM, 0x0030, 0xC359, 2)   // C357
+    S(beq, REL, 0x00F2, 0xC35B, 2)   // C359
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_C35B(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0031, 0xC35D, 2)   // C35B
+    S(beq, REL, 0x00EE, 0xC35F, 2)   // C35D
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C35F(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x00EB, 0xC361, 2)   // C35F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C361(cpu *c) {
+    uint32_t cycles = 0;
+    S(tya, IMP, 0x0000, 0xC362, 2)   // C361
+    S(ora, IMM, 0x0080, 0xC364, 2)   // C362
+    S(and, IMM, 0x0081, 0xC366, 2)   // C364
+    S(bne, REL, 0x00E7, 0xC368, 2)   // C366
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C368(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xC36A, 2)   // C368
+    S(sta, AB_, 0x028B, 0xC36D, 4)   // C36A
+    S(ldy, AB_, 0x027A, 0xC370, 4)   // C36D
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C370(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x00A3, 0xC372, 5)   // C370
+    S(jsr, AB_, 0xC3BD, 0xC375, 6)   // C372
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C375(cpu *c) {
+    uint32_t cycles = 0;
+    S(bpl, REL, 0x0011, 0xC377, 2)   // C375
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C377(cpu *c) {
+    uint32_t cycles = 0;
+    S(iny, IMP, 0x0000, 0xC378, 2)   // C377
+    S(cpy, AB_, 0x0274, 0xC37B, 4)   // C378
+    S(bcs, REL, 0x0006, 0xC37D, 2)   // C37B
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C37D(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, AB_, 0x0274, 0xC380, 4)   // C37D
+    S(dey, IMP, 0x0000, 0xC381, 2)   // C380
+    S(bne, REL, 0x00ED, 0xC383, 2)   // C381
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C383(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, AB_, 0x028B, 0xC386, 6)   // C383
+    S(lda, IMM, 0x0000, 0xC388, 2)   // C386
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C388(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x0001, 0xC38A, 2)   // C388
+    S(sta, ZP_, 0x007F, 0xC38C, 3)   // C38A
+    S(jmp, AB_, 0xC100, 0xC38F, 3)   // C38C
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C38F(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x007F, 0xC391, 3)   // C38F
+    S(eor, IMM, 0x0001, 0xC393, 2)   // C391
+    S(and, IMM, 0x0001, 0xC395, 2)   // C393
+    S(sta, ZP_, 0x007F, 0xC397, 3)   // C395
+    S(rts, IMP, 0x0000, 0xC398, 6)   // C397
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_C398(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0000, 0xC39A, 2)   // C398
+    S(lda, AB_, 0x0277, 0xC39D, 4)   // C39A
+    S(cmp, AB_, 0x0278, 0xC3A0, 4)   // C39D
+    S(beq, REL, 0x0016, 0xC3A2, 2)   // C3A0
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C3A2(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, AB_, 0x0278, 0xC3A5, 6)   // C3A2
+    S(ldy, AB_, 0x0278, 0xC3A8, 4)   // C3A5
+    S(lda, ABY, 0x027A, 0xC3AB, 4)   // C3A8
+    S(tay, IMP, 0x0000, 0xC3AC, 2)   // C3AB
+    S(lda, INY, 0x00A3, 0xC3AE, 5)   // C3AC
+    S(ldy, IMM, 0x0004, 0xC3B0, 2)   // C3AE
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_C3B0(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, ABY, 0xFEBB, 0xC3B3, 4)   // C3B0
+    S(beq, REL, 0x0003, 0xC3B5, 2)   // C3B3
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C3B5(cpu *c) {
+    uint32_t cycles = 0;
+    S(dey, IMP, 0x0000, 0xC3B6, 2)   // C3B5
+    S(bne, REL, 0x00F8, 0xC3B8, 2)   // C3B6
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C3B8(cpu *c) {
+    uint32_t cycles = 0;
+    S(tya, IMP, 0x0000, 0xC3B9, 2)   // C3B8
+    S(sta, AB_, 0x0296, 0xC3BC, 4)   // C3B9
+    S(rts, IMP, 0x0000, 0xC3BD, 6)   // C3BC
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C3BD(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0030, 0xC3BF, 2)   // C3BD
+    S(beq, REL, 0x0006, 0xC3C1, 2)   // C3BF
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C3C1(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0031, 0xC3C3, 2)   // C3C1
+    S(beq, REL, 0x0002, 0xC3C5, 2)   // C3C3
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C3C5(cpu *c) {
+    uint32_t cycles = 0;
+    S(ora, IMM, 0x0080, 0xC3C7, 2)   // C3C5
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C3C7(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x0081, 0xC3C9, 2)   // C3C7
+    S(rts, IMP, 0x0000, 0xC3CA, 6)   // C3C9
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C3CA(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xC3CC, 2)   // C3CA
+    S(sta, ZP_, 0x006F, 0xC3CE, 3)   // C3CC
+    S(sta, AB_, 0x028D, 0xC3D1, 4)   // C3CE
+    S(pha, IMP, 0x0000, 0xC3D2, 3)   // C3D1
+    S(ldx, AB_, 0x0278, 0xC3D5, 4)   // C3D2
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_C3D5(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xC3D6, 4)   // C3D5
+    S(ora, ZP_, 0x006F, 0xC3D8, 3)   // C3D6
+    S(pha, IMP, 0x0000, 0xC3D9, 3)   // C3D8
+    S(lda, IMM, 0x0001, 0xC3DB, 2)   // C3D9
+    S(sta, ZP_, 0x006F, 0xC3DD, 3)   // C3DB
+    S(dex, IMP, 0x0000, 0xC3DE, 2)   // C3DD
+    S(bmi, REL, 0x000F, 0xC3E0, 2)   // C3DE
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_C3E0(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZPX, 0x00E2, 0xC3E2, 4)   // C3E0
+    S(bpl, REL, 0x0004, 0xC3E4, 2)   // C3E2
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C3E4(cpu *c) {
+    uint32_t cycles = 0;
+    S(asl, ZP_, 0x006F, 0xC3E6, 5)   // C3E4
+    S(asl, ZP_, 0x006F, 0xC3E8, 5)   // C3E6
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C3E8(cpu *c) {
+    uint32_t cycles = 0;
+    S(lsr, ACC, 0x0000, 0xC3E9, 2)   // C3E8
+    S(bcc, REL, 0x00EA, 0xC3EB, 2)   // C3E9
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C3EB(cpu *c) {
+    uint32_t cycles = 0;
+    S(asl, ZP_, 0x006F, 0xC3ED, 5)   // C3EB
+    S(bne, REL, 0x00E6, 0xC3EF, 2)   // C3ED
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C3EF(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xC3F0, 4)   // C3EF
+    S(tax, IMP, 0x0000, 0xC3F1, 2)   // C3F0
+    S(lda, ABX, 0xC43F, 0xC3F4, 4)   // C3F1
+    S(pha, IMP, 0x0000, 0xC3F5, 3)   // C3F4
+    S(and, IMM, 0x0003, 0xC3F7, 2)   // C3F5
+    S(sta, AB_, 0x028C, 0xC3FA, 4)   // C3F7
+    S(pla, IMP, 0x0000, 0xC3FB, 4)   // C3FA
+    S(asl, ACC, 0x0000, 0xC3FC, 2)   // C3FB
+    S(bpl, REL, 0x003E, 0xC3FE, 2)   // C3FC
+    c->executed += 9;
+    return cycles;
+}
+
+static inline uint32_t rom_C3FE(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x00E2, 0xC400, 3)   // C3FE
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C400(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x0001, 0xC402, 2)   // C400
+    S(sta, ZP_, 0x007F, 0xC404, 3)   // C402
+    S(lda, AB_, 0x028C, 0xC407, 4)   // C404
+    S(beq, REL, 0x002B, 0xC409, 2)   // C407
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C409(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC63D, 0xC40C, 6)   // C409
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C40C(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x0012, 0xC40E, 2)   // C40C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C40E(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC38F, 0xC411, 6)   // C40E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C411(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xC413, 2)   // C411
+    S(sta, AB_, 0x028C, 0xC416, 4)   // C413
+    S(jsr, AB_, 0xC63D, 0xC419, 6)   // C416
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C419(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x001E, 0xC41B, 2)   // C419
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C41B(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0074, 0xC41D, 2)   // C41B
+    S(jsr, AB_, 0xC1C8, 0xC420, 6)   // C41D
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C420(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC38F, 0xC423, 6)   // C420
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C423(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC63D, 0xC426, 6)   // C423
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C426(cpu *c) {
+    uint32_t cycles = 0;
+    S(php, IMP, 0x0000, 0xC427, 3)   // C426
+    S(jsr, AB_, 0xC38F, 0xC42A, 6)   // C427
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C42A(cpu *c) {
+    uint32_t cycles = 0;
+    S(plp, IMP, 0x0000, 0xC42B, 4)   // C42A
+    S(beq, REL, 0x000C, 0xC42D, 2)   // C42B
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C42D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xC42F, 2)   // C42D
+    S(sta, AB_, 0x028C, 0xC432, 4)   // C42F
+    S(beq, REL, 0x0005, 0xC434, 2)   // C432
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C434(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC63D, 0xC437, 6)   // C434
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C437(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x00E2, 0xC439, 2)   // C437
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C439(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xC100, 0xC43C, 3)   // C439
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C43C(cpu *c) {
+    uint32_t cycles = 0;
+    S(rol, ACC, 0x0000, 0xC43D, 2)   // C43C
+    S(jmp, AB_, 0xC400, 0xC440, 3)   // C43D
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C44F(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC3CA, 0xC452, 6)   // C44F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C452(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xC454, 2)   // C452
+    S(sta, AB_, 0x0292, 0xC457, 4)   // C454
+    S(jsr, AB_, 0xC5AC, 0xC45A, 6)   // C457
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C45A(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x0019, 0xC45C, 2)   // C45A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C45C(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, AB_, 0x028C, 0xC45F, 6)   // C45C
+    S(bpl, REL, 0x0001, 0xC461, 2)   // C45F
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C461(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xC462, 6)   // C461
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C462(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0001, 0xC464, 2)   // C462
+    S(sta, AB_, 0x028D, 0xC467, 4)   // C464
+    S(jsr, AB_, 0xC38F, 0xC46A, 6)   // C467
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C46A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC100, 0xC46D, 6)   // C46A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C46D(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xC452, 0xC470, 3)   // C46D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C470(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC617, 0xC473, 6)   // C470
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C473(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x0010, 0xC475, 2)   // C473
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C475(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC4D8, 0xC478, 6)   // C475
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C478(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x028F, 0xC47B, 4)   // C478
+    S(beq, REL, 0x0001, 0xC47D, 2)   // C47B
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C47D(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xC47E, 6)   // C47D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C47E(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0253, 0xC481, 4)   // C47E
+    S(bmi, REL, 0x00ED, 0xC483, 2)   // C481
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C483(cpu *c) {
+    uint32_t cycles = 0;
+    S(bpl, REL, 0x00F0, 0xC485, 2)   // C483
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C485(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x028F, 0xC488, 4)   // C485
+    S(beq, REL, 0x00D2, 0xC48A, 2)   // C488
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C48A(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xC48B, 6)   // C48A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C492(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0001, 0xC494, 2)   // C492
+    S(sta, AB_, 0x028D, 0xC497, 4)   // C494
+    S(jsr, AB_, 0xC38F, 0xC49A, 6)   // C497
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C49A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC100, 0xC49D, 6)   // C49A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C49D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xC49F, 2)   // C49D
+    S(sta, AB_, 0x0292, 0xC4A2, 4)   // C49F
+    S(jsr, AB_, 0xC5AC, 0xC4A5, 6)   // C4A2
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C4A5(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x0013, 0xC4A7, 2)   // C4A5
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C4A7(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, AB_, 0x028F, 0xC4AA, 4)   // C4A7
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C4AA(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x028F, 0xC4AD, 4)   // C4AA
+    S(bne, REL, 0x0028, 0xC4AF, 2)   // C4AD
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C4AF(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, AB_, 0x028C, 0xC4B2, 6)   // C4AF
+    S(bpl, REL, 0x00DE, 0xC4B4, 2)   // C4B2
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C4B4(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xC4B5, 6)   // C4B4
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C4B5(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC617, 0xC4B8, 6)   // C4B5
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C4B8(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x00F0, 0xC4BA, 2)   // C4B8
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C4BA(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC4D8, 0xC4BD, 6)   // C4BA
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C4BD(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, AB_, 0x0253, 0xC4C0, 4)   // C4BD
+    S(bpl, REL, 0x0007, 0xC4C2, 2)   // C4C0
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C4C2(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x028F, 0xC4C5, 4)   // C4C2
+    S(beq, REL, 0x00EE, 0xC4C7, 2)   // C4C5
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C4C7(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x000E, 0xC4C9, 2)   // C4C7
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C4C9(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0296, 0xC4CC, 4)   // C4C9
+    S(beq, REL, 0x0009, 0xC4CE, 2)   // C4CC
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C4CE(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZPX, 0x00E7, 0xC4D0, 4)   // C4CE
+    S(and, IMM, 0x0007, 0xC4D2, 2)   // C4D0
+    S(cmp, AB_, 0x0296, 0xC4D5, 4)   // C4D2
+    S(bne, REL, 0x00DE, 0xC4D7, 2)   // C4D5
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C4D7(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xC4D8, 6)   // C4D7
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C4D8(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, IMM, 0x00FF, 0xC4DA, 2)   // C4D8
+    S(stx, AB_, 0x0253, 0xC4DD, 4)   // C4DA
+    S(inx, IMP, 0x0000, 0xC4DE, 2)   // C4DD
+    S(stx, AB_, 0x028A, 0xC4E1, 4)   // C4DE
+    S(jsr, AB_, 0xC589, 0xC4E4, 6)   // C4E1
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_C4E4(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x0006, 0xC4E6, 2)   // C4E4
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C4E6(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xC4E7, 6)   // C4E6
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C4E7(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC594, 0xC4EA, 6)   // C4E7
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C4EA(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x00FA, 0xC4EC, 2)   // C4EA
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C4EC(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x007F, 0xC4EE, 3)   // C4EC
+    S(eor, ZPX, 0x00E2, 0xC4F0, 4)   // C4EE
+    S(lsr, ACC, 0x0000, 0xC4F1, 2)   // C4F0
+    S(bcc, REL, 0x000B, 0xC4F3, 2)   // C4F1
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C4F3(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x0040, 0xC4F5, 2)   // C4F3
+    S(beq, REL, 0x00F0, 0xC4F7, 2)   // C4F5
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C4F7(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0002, 0xC4F9, 2)   // C4F7
+    S(cmp, AB_, 0x028C, 0xC4FC, 4)   // C4F9
+    S(beq, REL, 0x00E9, 0xC4FE, 2)   // C4FC
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C4FE(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABX, 0x027A, 0xC501, 4)   // C4FE
+    S(tax, IMP, 0x0000, 0xC502, 2)   // C501
+    S(jsr, AB_, 0xC6A6, 0xC505, 6)   // C502
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C505(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0003, 0xC507, 2)   // C505
+    S(jmp, AB_, 0xC51D, 0xC50A, 3)   // C507
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C50A(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABX, 0x0200, 0xC50D, 4)   // C50A
+    S(cmp, INY, 0x0094, 0xC50F, 5)   // C50D
+    S(beq, REL, 0x000A, 0xC511, 2)   // C50F
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C511(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x003F, 0xC513, 2)   // C511
+    S(bne, REL, 0x00D2, 0xC515, 2)   // C513
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C515(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x0094, 0xC517, 5)   // C515
+    S(cmp, IMM, 0x00A0, 0xC519, 2)   // C517
+    S(beq, REL, 0x00CC, 0xC51B, 2)   // C519
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C51B(cpu *c) {
+    uint32_t cycles = 0;
+    S(inx, IMP, 0x0000, 0xC51C, 2)   // C51B
+    S(iny, IMP, 0x0000, 0xC51D, 2)   // C51C
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C51D(cpu *c) {
+    uint32_t cycles = 0;
+    S(cpx, AB_, 0x0276, 0xC520, 4)   // C51D
+    S(bcs, REL, 0x0009, 0xC522, 2)   // C520
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C522(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABX, 0x0200, 0xC525, 4)   // C522
+    S(cmp, IMM, 0x002A, 0xC527, 2)   // C525
+    S(beq, REL, 0x000C, 0xC529, 2)   // C527
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C529(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x00DF, 0xC52B, 2)   // C529
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C52B(cpu *c) {
+    uint32_t cycles = 0;
+    S(cpy, IMM, 0x0013, 0xC52D, 2)   // C52B
+    S(bcs, REL, 0x0006, 0xC52F, 2)   // C52D
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C52F(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x0094, 0xC531, 5)   // C52F
+    S(cmp, IMM, 0x00A0, 0xC533, 2)   // C531
+    S(bne, REL, 0x00B2, 0xC535, 2)   // C533
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C535(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, AB_, 0x0279, 0xC538, 4)   // C535
+    S(stx, AB_, 0x0253, 0xC53B, 4)   // C538
+    S(lda, ZPX, 0x00E7, 0xC53D, 4)   // C53B
+    S(and, IMM, 0x0080, 0xC53F, 2)   // C53D
+    S(sta, AB_, 0x028A, 0xC542, 4)   // C53F
+    S(lda, AB_, 0x0294, 0xC545, 4)   // C542
+    S(sta, ZPX, 0x00DD, 0xC547, 4)   // C545
+    S(lda, ZP_, 0x0081, 0xC549, 3)   // C547
+    S(sta, ZPX, 0x00D8, 0xC54B, 4)   // C549
+    S(ldy, IMM, 0x0000, 0xC54D, 2)   // C54B
+    S(lda, INY, 0x0094, 0xC54F, 5)   // C54D
+    S(iny, IMP, 0x0000, 0xC550, 2)   // C54F
+    S(pha, IMP, 0x0000, 0xC551, 3)   // C550
+    S(and, IMM, 0x0040, 0xC553, 2)   // C551
+    S(sta, ZP_, 0x006F, 0xC555, 3)   // C553
+    S(pla, IMP, 0x0000, 0xC556, 4)   // C555
+    S(and, IMM, 0x00DF, 0xC558, 2)   // C556
+    S(bmi, REL, 0x0002, 0xC55A, 2)   // C558
+    c->executed += 18;
+    return cycles;
+}
+
+static inline uint32_t rom_C55A(cpu *c) {
+    uint32_t cycles = 0;
+    S(ora, IMM, 0x0020, 0xC55C, 2)   // C55A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C55C(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x0027, 0xC55E, 2)   // C55C
+    S(ora, ZP_, 0x006F, 0xC560, 3)   // C55E
+    S(sta, ZP_, 0x006F, 0xC562, 3)   // C560
+    S(lda, IMM, 0x0080, 0xC564, 2)   // C562
+    S(and, ZPX, 0x00E7, 0xC566, 4)   // C564
+    S(ora, ZP_, 0x006F, 0xC568, 3)   // C566
+    S(sta, ZPX, 0x00E7, 0xC56A, 4)   // C568
+    S(lda, ZPX, 0x00E2, 0xC56C, 4)   // C56A
+    S(and, IMM, 0x0080, 0xC56E, 2)   // C56C
+    S(ora, ZP_, 0x007F, 0xC570, 3)   // C56E
+    S(sta, ZPX, 0x00E2, 0xC572, 4)   // C570
+    S(lda, INY, 0x0094, 0xC574, 5)   // C572
+    S(sta, ABX, 0x0280, 0xC577, 5)   // C574
+    S(iny, IMP, 0x0000, 0xC578, 2)   // C577
+    S(lda, INY, 0x0094, 0xC57A, 5)   // C578
+    S(sta, ABX, 0x0285, 0xC57D, 5)   // C57A
+    S(lda, AB_, 0x0258, 0xC580, 4)   // C57D
+    S(bne, REL, 0x0007, 0xC582, 2)   // C580
+    c->executed += 18;
+    return cycles;
+}
+
+static inline uint32_t rom_C582(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0015, 0xC584, 2)   // C582
+    S(lda, INY, 0x0094, 0xC586, 5)   // C584
+    S(sta, AB_, 0x0258, 0xC589, 4)   // C586
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C589(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x00FF, 0xC58B, 2)   // C589
+    S(sta, AB_, 0x028F, 0xC58E, 4)   // C58B
+    S(lda, AB_, 0x0278, 0xC591, 4)   // C58E
+    S(sta, AB_, 0x0279, 0xC594, 4)   // C591
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C594(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, AB_, 0x0279, 0xC597, 6)   // C594
+    S(bpl, REL, 0x0001, 0xC599, 2)   // C597
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C599(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xC59A, 6)   // C599
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C59A(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, AB_, 0x0279, 0xC59D, 4)   // C59A
+    S(lda, ZPX, 0x00E7, 0xC59F, 4)   // C59D
+    S(bmi, REL, 0x0005, 0xC5A1, 2)   // C59F
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C5A1(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABX, 0x0280, 0xC5A4, 4)   // C5A1
+    S(bne, REL, 0x00EE, 0xC5A6, 2)   // C5A4
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C5A6(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xC5A8, 2)   // C5A6
+    S(sta, AB_, 0x028F, 0xC5AB, 4)   // C5A8
+    S(rts, IMP, 0x0000, 0xC5AC, 6)   // C5AB
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C5AC(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0000, 0xC5AE, 2)   // C5AC
+    S(sty, AB_, 0x0291, 0xC5B1, 4)   // C5AE
+    S(dey, IMP, 0x0000, 0xC5B2, 2)   // C5B1
+    S(sty, AB_, 0x0253, 0xC5B5, 4)   // C5B2
+    S(lda, AB_, 0xFE85, 0xC5B8, 4)   // C5B5
+    S(sta, ZP_, 0x0080, 0xC5BA, 3)   // C5B8
+    S(lda, IMM, 0x0001, 0xC5BC, 2)   // C5BA
+    S(sta, ZP_, 0x0081, 0xC5BE, 3)   // C5BC
+    S(sta, AB_, 0x0293, 0xC5C1, 4)   // C5BE
+    S(jsr, AB_, 0xD475, 0xC5C4, 6)   // C5C1
+    c->executed += 10;
+    return cycles;
+}
+
+static inline uint32_t rom_C5C4(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0293, 0xC5C7, 4)   // C5C4
+    S(bne, REL, 0x0001, 0xC5C9, 2)   // C5C7
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C5C9(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xC5CA, 6)   // C5C9
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C5CA(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0007, 0xC5CC, 2)   // C5CA
+    S(sta, AB_, 0x0295, 0xC5CF, 4)   // C5CC
+    S(lda, IMM, 0x0000, 0xC5D1, 2)   // C5CF
+    S(jsr, AB_, 0xD4F6, 0xC5D4, 6)   // C5D1
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C5D4(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, AB_, 0x0293, 0xC5D7, 4)   // C5D4
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C5D7(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD4E8, 0xC5DA, 6)   // C5D7
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C5DA(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, AB_, 0x0295, 0xC5DD, 6)   // C5DA
+    S(ldy, IMM, 0x0000, 0xC5DF, 2)   // C5DD
+    S(lda, INY, 0x0094, 0xC5E1, 5)   // C5DF
+    S(bne, REL, 0x0018, 0xC5E3, 2)   // C5E1
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C5E3(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0291, 0xC5E6, 4)   // C5E3
+    S(bne, REL, 0x002F, 0xC5E8, 2)   // C5E6
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C5E8(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE3B, 0xC5EB, 6)   // C5E8
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C5EB(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0081, 0xC5ED, 3)   // C5EB
+    S(sta, AB_, 0x0291, 0xC5F0, 4)   // C5ED
+    S(lda, ZP_, 0x0094, 0xC5F2, 3)   // C5F0
+    S(ldx, AB_, 0x0292, 0xC5F5, 4)   // C5F2
+    S(sta, AB_, 0x0292, 0xC5F8, 4)   // C5F5
+    S(beq, REL, 0x001D, 0xC5FA, 2)   // C5F8
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_C5FA(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xC5FB, 6)   // C5FA
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C5FB(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, IMM, 0x0001, 0xC5FD, 2)   // C5FB
+    S(cpx, AB_, 0x0292, 0xC600, 4)   // C5FD
+    S(bne, REL, 0x002D, 0xC602, 2)   // C600
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C602(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x0013, 0xC604, 2)   // C602
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C604(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0xFE85, 0xC607, 4)   // C604
+    S(sta, ZP_, 0x0080, 0xC609, 3)   // C607
+    S(lda, AB_, 0x0290, 0xC60C, 4)   // C609
+    S(sta, ZP_, 0x0081, 0xC60E, 3)   // C60C
+    S(jsr, AB_, 0xD475, 0xC611, 6)   // C60E
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_C611(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0294, 0xC614, 4)   // C611
+    S(jsr, AB_, 0xD4C8, 0xC617, 6)   // C614
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C617(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x00FF, 0xC619, 2)   // C617
+    S(sta, AB_, 0x0253, 0xC61C, 4)   // C619
+    S(lda, AB_, 0x0295, 0xC61F, 4)   // C61C
+    S(bmi, REL, 0x0008, 0xC621, 2)   // C61F
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C621(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0020, 0xC623, 2)   // C621
+    S(jsr, AB_, 0xD1C6, 0xC626, 6)   // C623
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C626(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xC5D7, 0xC629, 3)   // C626
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C629(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD44D, 0xC62C, 6)   // C629
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C62C(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xC5C4, 0xC62F, 3)   // C62C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C62F(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0094, 0xC631, 3)   // C62F
+    S(sta, AB_, 0x0294, 0xC634, 4)   // C631
+    S(jsr, AB_, 0xDE3B, 0xC637, 6)   // C634
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C637(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0081, 0xC639, 3)   // C637
+    S(sta, AB_, 0x0290, 0xC63C, 4)   // C639
+    S(rts, IMP, 0x0000, 0xC63D, 6)   // C63C
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C63D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0068, 0xC63F, 3)   // C63D
+    S(bne, REL, 0x0028, 0xC641, 2)   // C63F
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C641(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x007F, 0xC643, 3)   // C641
+    S(lsr, ZPX, 0x001C, 0xC645, 6)   // C643
+    S(bcc, REL, 0x0022, 0xC647, 2)   // C645
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C647(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x00FF, 0xC649, 2)   // C647
+    S(sta, AB_, 0x0298, 0xC64C, 4)   // C649
+    S(jsr, AB_, 0xD00E, 0xC64F, 6)   // C64C
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C64F(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x00FF, 0xC651, 2)   // C64F
+    S(cmp, IMM, 0x0002, 0xC653, 2)   // C651
+    S(beq, REL, 0x000A, 0xC655, 2)   // C653
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C655(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0003, 0xC657, 2)   // C655
+    S(beq, REL, 0x0006, 0xC659, 2)   // C657
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C659(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x000F, 0xC65B, 2)   // C659
+    S(beq, REL, 0x0002, 0xC65D, 2)   // C65B
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C65D(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0000, 0xC65F, 2)   // C65D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C65F(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x007F, 0xC661, 3)   // C65F
+    S(tya, IMP, 0x0000, 0xC662, 2)   // C661
+    S(sta, ZPX, 0x00FF, 0xC664, 4)   // C662
+    S(bne, REL, 0x0003, 0xC666, 2)   // C664
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C666(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD042, 0xC669, 6)   // C666
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C669(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x007F, 0xC66B, 3)   // C669
+    S(lda, ZPX, 0x00FF, 0xC66D, 4)   // C66B
+    S(rts, IMP, 0x0000, 0xC66E, 6)   // C66D
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C66E(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xC66F, 3)   // C66E
+    S(jsr, AB_, 0xC6A6, 0xC672, 6)   // C66F
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C672(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC688, 0xC675, 6)   // C672
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C675(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xC676, 4)   // C675
+    S(sec, IMP, 0x0000, 0xC677, 2)   // C676
+    S(sbc, AB_, 0x024B, 0xC67A, 4)   // C677
+    S(tax, IMP, 0x0000, 0xC67B, 2)   // C67A
+    S(beq, REL, 0x000A, 0xC67D, 2)   // C67B
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_C67D(cpu *c) {
+    uint32_t cycles = 0;
+    S(bcc, REL, 0x0008, 0xC67F, 2)   // C67D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C67F(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x00A0, 0xC681, 2)   // C67F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C681(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, INY, 0x0094, 0xC683, 6)   // C681
+    S(iny, IMP, 0x0000, 0xC684, 2)   // C683
+    S(dex, IMP, 0x0000, 0xC685, 2)   // C684
+    S(bne, REL, 0x00FA, 0xC687, 2)   // C685
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C687(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xC688, 6)   // C687
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C688(cpu *c) {
+    uint32_t cycles = 0;
+    S(tya, IMP, 0x0000, 0xC689, 2)   // C688
+    S(asl, ACC, 0x0000, 0xC68A, 2)   // C689
+    S(tay, IMP, 0x0000, 0xC68B, 2)   // C68A
+    S(lda, ABY, 0x0099, 0xC68E, 4)   // C68B
+    S(sta, ZP_, 0x0094, 0xC690, 3)   // C68E
+    S(lda, ABY, 0x009A, 0xC693, 4)   // C690
+    S(sta, ZP_, 0x0095, 0xC695, 3)   // C693
+    S(ldy, IMM, 0x0000, 0xC697, 2)   // C695
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_C697(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABX, 0x0200, 0xC69A, 4)   // C697
+    S(sta, INY, 0x0094, 0xC69C, 6)   // C69A
+    S(iny, IMP, 0x0000, 0xC69D, 2)   // C69C
+    S(beq, REL, 0x0006, 0xC69F, 2)   // C69D
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C69F(cpu *c) {
+    uint32_t cycles = 0;
+    S(inx, IMP, 0x0000, 0xC6A0, 2)   // C69F
+    S(cpx, AB_, 0x0276, 0xC6A3, 4)   // C6A0
+    S(bcc, REL, 0x00F2, 0xC6A5, 2)   // C6A3
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C6A5(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xC6A6, 6)   // C6A5
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C6A6(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xC6A8, 2)   // C6A6
+    S(sta, AB_, 0x024B, 0xC6AB, 4)   // C6A8
+    S(txa, IMP, 0x0000, 0xC6AC, 2)   // C6AB
+    S(pha, IMP, 0x0000, 0xC6AD, 3)   // C6AC
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C6AD(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABX, 0x0200, 0xC6B0, 4)   // C6AD
+    S(cmp, IMM, 0x002C, 0xC6B2, 2)   // C6B0
+    S(beq, REL, 0x0014, 0xC6B4, 2)   // C6B2
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C6B4(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x003D, 0xC6B6, 2)   // C6B4
+    S(beq, REL, 0x0010, 0xC6B8, 2)   // C6B6
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C6B8(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, AB_, 0x024B, 0xC6BB, 6)   // C6B8
+    S(inx, IMP, 0x0000, 0xC6BC, 2)   // C6BB
+    S(lda, IMM, 0x000F, 0xC6BE, 2)   // C6BC
+    S(cmp, AB_, 0x024B, 0xC6C1, 4)   // C6BE
+    S(bcc, REL, 0x0005, 0xC6C3, 2)   // C6C1
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_C6C3(cpu *c) {
+    uint32_t cycles = 0;
+    S(cpx, AB_, 0x0274, 0xC6C6, 4)   // C6C3
+    S(bcc, REL, 0x00E5, 0xC6C8, 2)   // C6C6
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C6C8(cpu *c) {
+    uint32_t cycles = 0;
+    S(stx, AB_, 0x0276, 0xC6CB, 4)   // C6C8
+    S(pla, IMP, 0x0000, 0xC6CC, 4)   // C6CB
+    S(tax, IMP, 0x0000, 0xC6CD, 2)   // C6CC
+    S(rts, IMP, 0x0000, 0xC6CE, 6)   // C6CD
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C6CE(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0083, 0xC6D0, 3)   // C6CE
+    S(pha, IMP, 0x0000, 0xC6D1, 3)   // C6D0
+    S(lda, ZP_, 0x0082, 0xC6D3, 3)   // C6D1
+    S(pha, IMP, 0x0000, 0xC6D4, 3)   // C6D3
+    S(jsr, AB_, 0xC6DE, 0xC6D7, 6)   // C6D4
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_C6D7(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xC6D8, 4)   // C6D7
+    S(sta, ZP_, 0x0082, 0xC6DA, 3)   // C6D8
+    S(pla, IMP, 0x0000, 0xC6DB, 4)   // C6DA
+    S(sta, ZP_, 0x0083, 0xC6DD, 3)   // C6DB
+    S(rts, IMP, 0x0000, 0xC6DE, 6)   // C6DD
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_C6DE(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0011, 0xC6E0, 2)   // C6DE
+    S(sta, ZP_, 0x0083, 0xC6E2, 3)   // C6E0
+    S(jsr, AB_, 0xD0EB, 0xC6E5, 6)   // C6E2
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C6E5(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD4E8, 0xC6E8, 6)   // C6E5
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C6E8(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0253, 0xC6EB, 4)   // C6E8
+    S(bpl, REL, 0x000A, 0xC6ED, 2)   // C6EB
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C6ED(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x028D, 0xC6F0, 4)   // C6ED
+    S(bne, REL, 0x000A, 0xC6F2, 2)   // C6F0
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C6F2(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC806, 0xC6F5, 6)   // C6F2
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C6F5(cpu *c) {
+    uint32_t cycles = 0;
+    S(clc, IMP, 0x0000, 0xC6F6, 2)   // C6F5
+    S(rts, IMP, 0x0000, 0xC6F7, 6)   // C6F6
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C6F7(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x028D, 0xC6FA, 4)   // C6F7
+    S(beq, REL, 0x001F, 0xC6FC, 2)   // C6FA
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C6FC(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, AB_, 0x028D, 0xC6FF, 6)   // C6FC
+    S(bne, REL, 0x000D, 0xC701, 2)   // C6FF
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C701(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, AB_, 0x028D, 0xC704, 6)   // C701
+    S(jsr, AB_, 0xC38F, 0xC707, 6)   // C704
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C707(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC806, 0xC70A, 6)   // C707
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C70A(cpu *c) {
+    uint32_t cycles = 0;
+    S(sec, IMP, 0x0000, 0xC70B, 2)   // C70A
+    S(jmp, AB_, 0xC38F, 0xC70E, 3)   // C70B
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C70E(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xC710, 2)   // C70E
+    S(sta, AB_, 0x0273, 0xC713, 4)   // C710
+    S(sta, AB_, 0x028D, 0xC716, 4)   // C713
+    S(jsr, AB_, 0xC7B7, 0xC719, 6)   // C716
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C719(cpu *c) {
+    uint32_t cycles = 0;
+    S(sec, IMP, 0x0000, 0xC71A, 2)   // C719
+    S(rts, IMP, 0x0000, 0xC71B, 6)   // C71A
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C71B(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, IMM, 0x0018, 0xC71D, 2)   // C71B
+    S(ldy, IMM, 0x001D, 0xC71F, 2)   // C71D
+    S(lda, INY, 0x0094, 0xC721, 5)   // C71F
+    S(sta, AB_, 0x0273, 0xC724, 4)   // C721
+    S(beq, REL, 0x0002, 0xC726, 2)   // C724
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_C726(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, IMM, 0x0016, 0xC728, 2)   // C726
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C728(cpu *c) {
+    uint32_t cycles = 0;
+    S(dey, IMP, 0x0000, 0xC729, 2)   // C728
+    S(lda, INY, 0x0094, 0xC72B, 5)   // C729
+    S(sta, AB_, 0x0272, 0xC72E, 4)   // C72B
+    S(cpx, IMM, 0x0016, 0xC730, 2)   // C72E
+    S(beq, REL, 0x000A, 0xC732, 2)   // C730
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_C732(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x000A, 0xC734, 2)   // C732
+    S(bcc, REL, 0x0006, 0xC736, 2)   // C734
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C736(cpu *c) {
+    uint32_t cycles = 0;
+    S(dex, IMP, 0x0000, 0xC737, 2)   // C736
+    S(cmp, IMM, 0x0064, 0xC739, 2)   // C737
+    S(bcc, REL, 0x0001, 0xC73B, 2)   // C739
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C73B(cpu *c) {
+    uint32_t cycles = 0;
+    S(dex, IMP, 0x0000, 0xC73C, 2)   // C73B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C73C(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC7AC, 0xC73F, 6)   // C73C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C73F(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x0094, 0xC741, 5)   // C73F
+    S(pha, IMP, 0x0000, 0xC742, 3)   // C741
+    S(asl, ACC, 0x0000, 0xC743, 2)   // C742
+    S(bpl, REL, 0x0005, 0xC745, 2)   // C743
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C745(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x003C, 0xC747, 2)   // C745
+    S(sta, ABX, 0x02B2, 0xC74A, 5)   // C747
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C74A(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xC74B, 4)   // C74A
+    S(and, IMM, 0x000F, 0xC74D, 2)   // C74B
+    S(tay, IMP, 0x0000, 0xC74E, 2)   // C74D
+    S(lda, ABY, 0xFEC5, 0xC751, 4)   // C74E
+    S(sta, ABX, 0x02B1, 0xC754, 5)   // C751
+    S(dex, IMP, 0x0000, 0xC755, 2)   // C754
+    S(lda, ABY, 0xFEC0, 0xC758, 4)   // C755
+    S(sta, ABX, 0x02B1, 0xC75B, 5)   // C758
+    S(dex, IMP, 0x0000, 0xC75C, 2)   // C75B
+    S(lda, ABY, 0xFEBB, 0xC75F, 4)   // C75C
+    S(sta, ABX, 0x02B1, 0xC762, 5)   // C75F
+    S(dex, IMP, 0x0000, 0xC763, 2)   // C762
+    S(dex, IMP, 0x0000, 0xC764, 2)   // C763
+    S(bcs, REL, 0x0005, 0xC766, 2)   // C764
+    c->executed += 14;
+    return cycles;
+}
+
+static inline uint32_t rom_C766(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x002A, 0xC768, 2)   // C766
+    S(sta, ABX, 0x02B2, 0xC76B, 5)   // C768
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C76B(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x00A0, 0xC76D, 2)   // C76B
+    S(sta, ABX, 0x02B1, 0xC770, 5)   // C76D
+    S(dex, IMP, 0x0000, 0xC771, 2)   // C770
+    S(ldy, IMM, 0x0012, 0xC773, 2)   // C771
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C773(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x0094, 0xC775, 5)   // C773
+    S(sta, ABX, 0x02B1, 0xC778, 5)   // C775
+    S(dex, IMP, 0x0000, 0xC779, 2)   // C778
+    S(dey, IMP, 0x0000, 0xC77A, 2)   // C779
+    S(cpy, IMM, 0x0003, 0xC77C, 2)   // C77A
+    S(bcs, REL, 0x00F5, 0xC77E, 2)   // C77C
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_C77E(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0022, 0xC780, 2)   // C77E
+    S(sta, ABX, 0x02B1, 0xC783, 5)   // C780
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C783(cpu *c) {
+    uint32_t cycles = 0;
+    S(inx, IMP, 0x0000, 0xC784, 2)   // C783
+    S(cpx, IMM, 0x0020, 0xC786, 2)   // C784
+    S(bcs, REL, 0x000B, 0xC788, 2)   // C786
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C788(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABX, 0x02B1, 0xC78B, 4)   // C788
+    S(cmp, IMM, 0x0022, 0xC78D, 2)   // C78B
+    S(beq, REL, 0x0004, 0xC78F, 2)   // C78D
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C78F(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x00A0, 0xC791, 2)   // C78F
+    S(bne, REL, 0x00F0, 0xC793, 2)   // C791
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C793(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0022, 0xC795, 2)   // C793
+    S(sta, ABX, 0x02B1, 0xC798, 5)   // C795
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C798(cpu *c) {
+    uint32_t cycles = 0;
+    S(inx, IMP, 0x0000, 0xC799, 2)   // C798
+    S(cpx, IMM, 0x0020, 0xC79B, 2)   // C799
+    S(bcs, REL, 0x000A, 0xC79D, 2)   // C79B
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C79D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x007F, 0xC79F, 2)   // C79D
+    S(and, ABX, 0x02B1, 0xC7A2, 4)   // C79F
+    S(sta, ABX, 0x02B1, 0xC7A5, 5)   // C7A2
+    S(bpl, REL, 0x00F1, 0xC7A7, 2)   // C7A5
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C7A7(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC4B5, 0xC7AA, 6)   // C7A7
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C7AA(cpu *c) {
+    uint32_t cycles = 0;
+    S(sec, IMP, 0x0000, 0xC7AB, 2)   // C7AA
+    S(rts, IMP, 0x0000, 0xC7AC, 6)   // C7AB
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C7AC(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x001B, 0xC7AE, 2)   // C7AC
+    S(lda, IMM, 0x0020, 0xC7B0, 2)   // C7AE
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C7B0(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ABY, 0x02B0, 0xC7B3, 5)   // C7B0
+    S(dey, IMP, 0x0000, 0xC7B4, 2)   // C7B3
+    S(bne, REL, 0x00FA, 0xC7B6, 2)   // C7B4
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C7B6(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xC7B7, 6)   // C7B6
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C7B7(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF119, 0xC7BA, 6)   // C7B7
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C7BA(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF0DF, 0xC7BD, 6)   // C7BA
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C7BD(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC7AC, 0xC7C0, 6)   // C7BD
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C7C0(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x00FF, 0xC7C2, 2)   // C7C0
+    S(sta, ZP_, 0x006F, 0xC7C4, 3)   // C7C2
+    S(ldx, ZP_, 0x007F, 0xC7C6, 3)   // C7C4
+    S(stx, AB_, 0x0272, 0xC7C9, 4)   // C7C6
+    S(lda, IMM, 0x0000, 0xC7CB, 2)   // C7C9
+    S(sta, AB_, 0x0273, 0xC7CE, 4)   // C7CB
+    S(ldx, ZP_, 0x00F9, 0xC7D0, 3)   // C7CE
+    S(lda, ABX, 0xFEE0, 0xC7D3, 4)   // C7D0
+    S(sta, ZP_, 0x0095, 0xC7D5, 3)   // C7D3
+    S(lda, AB_, 0xFE88, 0xC7D8, 4)   // C7D5
+    S(sta, ZP_, 0x0094, 0xC7DA, 3)   // C7D8
+    S(ldy, IMM, 0x0016, 0xC7DC, 2)   // C7DA
+    S(lda, INY, 0x0094, 0xC7DE, 5)   // C7DC
+    S(cmp, IMM, 0x00A0, 0xC7E0, 2)   // C7DE
+    S(bne, REL, 0x000B, 0xC7E2, 2)   // C7E0
+    c->executed += 15;
+    return cycles;
+}
+
+static inline uint32_t rom_C7E2(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0031, 0xC7E4, 2)   // C7E2
+    S(bit, AB_, 0x94B1, 0xC7E7, 4)   // C7E4
+    S(cmp, IMM, 0x00A0, 0xC7E9, 2)   // C7E7
+    S(bne, REL, 0x0002, 0xC7EB, 2)   // C7E9
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C7E5(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x0094, 0xC7E7, 5)   // C7E5
+    S(cmp, IMM, 0x00A0, 0xC7E9, 2)   // C7E7
+    S(bne, REL, 0x0002, 0xC7EB, 2)   // C7E9
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C7EB(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0020, 0xC7ED, 2)   // C7EB
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C7ED(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ABY, 0x02B3, 0xC7F0, 5)   // C7ED
+    S(dey, IMP, 0x0000, 0xC7F1, 2)   // C7F0
+    S(bpl, REL, 0x00F2, 0xC7F3, 2)   // C7F1
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C7F3(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0012, 0xC7F5, 2)   // C7F3
+    S(sta, AB_, 0x02B1, 0xC7F8, 4)   // C7F5
+    S(lda, IMM, 0x0022, 0xC7FA, 2)   // C7F8
+    S(sta, AB_, 0x02B2, 0xC7FD, 4)   // C7FA
+    S(sta, AB_, 0x02C3, 0xC800, 4)   // C7FD
+    S(lda, IMM, 0x0020, 0xC802, 2)   // C800
+    S(sta, AB_, 0x02C4, 0xC805, 4)   // C802
+    S(rts, IMP, 0x0000, 0xC806, 6)   // C805
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_C806(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC7AC, 0xC809, 6)   // C806
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C809(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x000B, 0xC80B, 2)   // C809
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C80B(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABY, 0xC817, 0xC80E, 4)   // C80B
+    S(sta, ABY, 0x02B1, 0xC811, 5)   // C80E
+    S(dey, IMP, 0x0000, 0xC812, 2)   // C811
+    S(bpl, REL, 0x00F7, 0xC814, 2)   // C812
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C814(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xEF4D, 0xC817, 3)   // C814
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C87D(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xEF5F, 0xC880, 6)   // C87D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C880(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD475, 0xC883, 6)   // C880
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C883(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF119, 0xC886, 6)   // C883
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C886(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZPX, 0x00A7, 0xC888, 4)   // C886
+    S(cmp, IMM, 0x00FF, 0xC88A, 2)   // C888
+    S(beq, REL, 0x0008, 0xC88C, 2)   // C88A
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C88C(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x02F9, 0xC88F, 4)   // C88C
+    S(ora, IMM, 0x0040, 0xC891, 2)   // C88F
+    S(sta, AB_, 0x02F9, 0xC894, 4)   // C891
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C894(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xC896, 2)   // C894
+    S(jsr, AB_, 0xD4C8, 0xC899, 6)   // C896
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C899(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD156, 0xC89C, 6)   // C899
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C89C(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0080, 0xC89E, 3)   // C89C
+    S(jsr, AB_, 0xD156, 0xC8A1, 6)   // C89E
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_C8A1(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0081, 0xC8A3, 3)   // C8A1
+    S(lda, ZP_, 0x0080, 0xC8A5, 3)   // C8A3
+    S(bne, REL, 0x0006, 0xC8A7, 2)   // C8A5
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_C8A7(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xEEF4, 0xC8AA, 6)   // C8A7
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C8AA(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xD227, 0xC8AD, 3)   // C8AA
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C8AD(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xEF5F, 0xC8B0, 6)   // C8AD
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C8B0(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD44D, 0xC8B3, 6)   // C8B0
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C8B3(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xC894, 0xC8B6, 3)   // C8B3
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_C8B6(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0000, 0xC8B8, 2)   // C8B6
+    S(tya, IMP, 0x0000, 0xC8B9, 2)   // C8B8
+    S(sta, INY, 0x0094, 0xC8BB, 6)   // C8B9
+    S(jsr, AB_, 0xDE5E, 0xC8BE, 6)   // C8BB
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_C8BE(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xD599, 0xC8C1, 3)   // C8BE
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CA35(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0011, 0xCA37, 2)   // CA35
+    S(sta, ZP_, 0x0083, 0xCA39, 3)   // CA37
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CA39(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD39B, 0xCA3C, 6)   // CA39
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CA3C(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0085, 0xCA3E, 3)   // CA3C
+    S(ldx, ZP_, 0x0082, 0xCA40, 3)   // CA3E
+    S(lda, ZPX, 0x00F2, 0xCA42, 4)   // CA40
+    S(and, IMM, 0x0008, 0xCA44, 2)   // CA42
+    S(sta, ZP_, 0x00F8, 0xCA46, 3)   // CA44
+    S(bne, REL, 0x000A, 0xCA48, 2)   // CA46
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_CA48(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD125, 0xCA4B, 6)   // CA48
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CA4B(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x0005, 0xCA4D, 2)   // CA4B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CA4D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0080, 0xCA4F, 2)   // CA4D
+    S(jsr, AB_, 0xDD97, 0xCA52, 6)   // CA4F
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CA52(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xCA53, 6)   // CA52
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CB63(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x00EA, 0xCB65, 2)   // CB63
+    S(sta, ZP_, 0x006B, 0xCB67, 3)   // CB65
+    S(lda, IMM, 0x00FF, 0xCB69, 2)   // CB67
+    S(sta, ZP_, 0x006C, 0xCB6B, 3)   // CB69
+    S(rts, IMP, 0x0000, 0xCB6C, 6)   // CB6B
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_CB84(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x028E, 0xCB87, 4)   // CB84
+    S(sta, ZP_, 0x007F, 0xCB89, 3)   // CB87
+    S(lda, ZP_, 0x0083, 0xCB8B, 3)   // CB89
+    S(pha, IMP, 0x0000, 0xCB8C, 3)   // CB8B
+    S(jsr, AB_, 0xC63D, 0xCB8F, 6)   // CB8C
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_CB8F(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xCB90, 4)   // CB8F
+    S(sta, ZP_, 0x0083, 0xCB92, 3)   // CB90
+    S(ldx, AB_, 0x0274, 0xCB95, 4)   // CB92
+    S(dex, IMP, 0x0000, 0xCB96, 2)   // CB95
+    S(bne, REL, 0x000D, 0xCB98, 2)   // CB96
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_CB98(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0001, 0xCB9A, 2)   // CB98
+    S(jsr, AB_, 0xD1E2, 0xCB9D, 6)   // CB9A
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CB9D(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xCBF1, 0xCBA0, 3)   // CB9D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CBA0(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0070, 0xCBA2, 2)   // CBA0
+    S(jmp, AB_, 0xC1C8, 0xCBA5, 3)   // CBA2
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CBA5(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0001, 0xCBA7, 2)   // CBA5
+    S(jsr, AB_, 0xCC7C, 0xCBAA, 6)   // CBA7
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CBAA(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, AB_, 0x0285, 0xCBAD, 4)   // CBAA
+    S(cpx, IMM, 0x0005, 0xCBAF, 2)   // CBAD
+    S(bcs, REL, 0x00EF, 0xCBB1, 2)   // CBAF
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_CBB1(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xCBB3, 2)   // CBB1
+    S(sta, ZP_, 0x006F, 0xCBB5, 3)   // CBB3
+    S(sta, ZP_, 0x0070, 0xCBB7, 3)   // CBB5
+    S(sec, IMP, 0x0000, 0xCBB8, 2)   // CBB7
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_CBB8(cpu *c) {
+    uint32_t cycles = 0;
+    S(rol, ZP_, 0x006F, 0xCBBA, 5)   // CBB8
+    S(rol, ZP_, 0x0070, 0xCBBC, 5)   // CBBA
+    S(dex, IMP, 0x0000, 0xCBBD, 2)   // CBBC
+    S(bpl, REL, 0x00F9, 0xCBBF, 2)   // CBBD
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_CBBF(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x006F, 0xCBC1, 3)   // CBBF
+    S(and, AB_, 0x024F, 0xCBC4, 4)   // CBC1
+    S(bne, REL, 0x00DA, 0xCBC6, 2)   // CBC4
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_CBC6(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0070, 0xCBC8, 3)   // CBC6
+    S(and, AB_, 0x0250, 0xCBCB, 4)   // CBC8
+    S(bne, REL, 0x00D3, 0xCBCD, 2)   // CBCB
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_CBCD(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x006F, 0xCBCF, 3)   // CBCD
+    S(ora, AB_, 0x024F, 0xCBD2, 4)   // CBCF
+    S(sta, AB_, 0x024F, 0xCBD5, 4)   // CBD2
+    S(lda, ZP_, 0x0070, 0xCBD7, 3)   // CBD5
+    S(ora, AB_, 0x0250, 0xCBDA, 4)   // CBD7
+    S(sta, AB_, 0x0250, 0xCBDD, 4)   // CBDA
+    S(lda, IMM, 0x0000, 0xCBDF, 2)   // CBDD
+    S(jsr, AB_, 0xD1E2, 0xCBE2, 6)   // CBDF
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_CBE2(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xCBE4, 3)   // CBE2
+    S(lda, AB_, 0x0285, 0xCBE7, 4)   // CBE4
+    S(sta, ZPX, 0x00A7, 0xCBE9, 4)   // CBE7
+    S(tax, IMP, 0x0000, 0xCBEA, 2)   // CBE9
+    S(lda, ZP_, 0x007F, 0xCBEC, 3)   // CBEA
+    S(sta, ZPX, 0x0000, 0xCBEE, 4)   // CBEC
+    S(sta, ABX, 0x025B, 0xCBF1, 5)   // CBEE
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_CBF1(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0083, 0xCBF3, 3)   // CBF1
+    S(lda, ABX, 0x022B, 0xCBF6, 4)   // CBF3
+    S(ora, IMM, 0x0040, 0xCBF8, 2)   // CBF6
+    S(sta, ABX, 0x022B, 0xCBFB, 5)   // CBF8
+    S(ldy, ZP_, 0x0082, 0xCBFD, 3)   // CBFB
+    S(lda, IMM, 0x00FF, 0xCBFF, 2)   // CBFD
+    S(sta, ABY, 0x0244, 0xCC02, 5)   // CBFF
+    S(lda, IMM, 0x0089, 0xCC04, 2)   // CC02
+    S(sta, ABY, 0x00F2, 0xCC07, 5)   // CC04
+    S(lda, ABY, 0x00A7, 0xCC0A, 4)   // CC07
+    S(sta, ABY, 0x023E, 0xCC0D, 5)   // CC0A
+    S(asl, ACC, 0x0000, 0xCC0E, 2)   // CC0D
+    S(tax, IMP, 0x0000, 0xCC0F, 2)   // CC0E
+    S(lda, IMM, 0x0001, 0xCC11, 2)   // CC0F
+    S(sta, ZPX, 0x0099, 0xCC13, 4)   // CC11
+    S(lda, IMM, 0x000E, 0xCC15, 2)   // CC13
+    S(sta, ABY, 0x00EC, 0xCC18, 5)   // CC15
+    S(jmp, AB_, 0xC194, 0xCC1B, 3)   // CC18
+    c->executed += 18;
+    return cycles;
+}
+
+static inline uint32_t rom_CC2B(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0030, 0xCC2D, 2)   // CC2B
+    S(jmp, AB_, 0xC1C8, 0xCC30, 3)   // CC2D
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CC7C(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABY, 0x0200, 0xCC7F, 4)   // CC7C
+    S(cmp, IMM, 0x0020, 0xCC81, 2)   // CC7F
+    S(beq, REL, 0x0008, 0xCC83, 2)   // CC81
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_CC83(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x001D, 0xCC85, 2)   // CC83
+    S(beq, REL, 0x0004, 0xCC87, 2)   // CC85
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CC87(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x002C, 0xCC89, 2)   // CC87
+    S(bne, REL, 0x0007, 0xCC8B, 2)   // CC89
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CC8B(cpu *c) {
+    uint32_t cycles = 0;
+    S(iny, IMP, 0x0000, 0xCC8C, 2)   // CC8B
+    S(cpy, AB_, 0x0274, 0xCC8F, 4)   // CC8C
+    S(bcc, REL, 0x00EB, 0xCC91, 2)   // CC8F
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_CC91(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xCC92, 6)   // CC91
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CC92(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCCA1, 0xCC95, 6)   // CC92
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CC95(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, AB_, 0x0277, 0xCC98, 6)   // CC95
+    S(ldy, AB_, 0x0279, 0xCC9B, 4)   // CC98
+    S(cpx, IMM, 0x0004, 0xCC9D, 2)   // CC9B
+    S(bcc, REL, 0x00EC, 0xCC9F, 2)   // CC9D
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_CC9F(cpu *c) {
+    uint32_t cycles = 0;
+    S(bcs, REL, 0x008A, 0xCCA1, 2)   // CC9F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CCA1(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xCCA3, 2)   // CCA1
+    S(sta, ZP_, 0x006F, 0xCCA5, 3)   // CCA3
+    S(sta, ZP_, 0x0070, 0xCCA7, 3)   // CCA5
+    S(sta, ZP_, 0x0072, 0xCCA9, 3)   // CCA7
+    S(ldx, IMM, 0x00FF, 0xCCAB, 2)   // CCA9
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_CCAB(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABY, 0x0200, 0xCCAE, 4)   // CCAB
+    S(cmp, IMM, 0x0040, 0xCCB0, 2)   // CCAE
+    S(bcs, REL, 0x0018, 0xCCB2, 2)   // CCB0
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_CCB2(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0030, 0xCCB4, 2)   // CCB2
+    S(bcc, REL, 0x0014, 0xCCB6, 2)   // CCB4
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CCB6(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x000F, 0xCCB8, 2)   // CCB6
+    S(pha, IMP, 0x0000, 0xCCB9, 3)   // CCB8
+    S(lda, ZP_, 0x0070, 0xCCBB, 3)   // CCB9
+    S(sta, ZP_, 0x0071, 0xCCBD, 3)   // CCBB
+    S(lda, ZP_, 0x006F, 0xCCBF, 3)   // CCBD
+    S(sta, ZP_, 0x0070, 0xCCC1, 3)   // CCBF
+    S(pla, IMP, 0x0000, 0xCCC2, 4)   // CCC1
+    S(sta, ZP_, 0x006F, 0xCCC4, 3)   // CCC2
+    S(iny, IMP, 0x0000, 0xCCC5, 2)   // CCC4
+    S(cpy, AB_, 0x0274, 0xCCC8, 4)   // CCC5
+    S(bcc, REL, 0x00E1, 0xCCCA, 2)   // CCC8
+    c->executed += 11;
+    return cycles;
+}
+
+static inline uint32_t rom_CCCA(cpu *c) {
+    uint32_t cycles = 0;
+    S(sty, AB_, 0x0279, 0xCCCD, 4)   // CCCA
+    S(clc, IMP, 0x0000, 0xCCCE, 2)   // CCCD
+    S(lda, IMM, 0x0000, 0xCCD0, 2)   // CCCE
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_CCD0(cpu *c) {
+    uint32_t cycles = 0;
+    S(inx, IMP, 0x0000, 0xCCD1, 2)   // CCD0
+    S(cpx, IMM, 0x0003, 0xCCD3, 2)   // CCD1
+    S(bcs, REL, 0x000F, 0xCCD5, 2)   // CCD3
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_CCD5(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, ZPX, 0x006F, 0xCCD7, 4)   // CCD5
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CCD7(cpu *c) {
+    uint32_t cycles = 0;
+    S(dey, IMP, 0x0000, 0xCCD8, 2)   // CCD7
+    S(bmi, REL, 0x00F6, 0xCCDA, 2)   // CCD8
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CCDA(cpu *c) {
+    uint32_t cycles = 0;
+    S(adc, ABX, 0xCCF2, 0xCCDD, 4)   // CCDA
+    S(bcc, REL, 0x00F8, 0xCCDF, 2)   // CCDD
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CCDF(cpu *c) {
+    uint32_t cycles = 0;
+    S(clc, IMP, 0x0000, 0xCCE0, 2)   // CCDF
+    S(inc, ZP_, 0x0072, 0xCCE2, 5)   // CCE0
+    S(bne, REL, 0x00F3, 0xCCE4, 2)   // CCE2
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_CCE4(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xCCE5, 3)   // CCE4
+    S(ldx, AB_, 0x0277, 0xCCE8, 4)   // CCE5
+    S(lda, ZP_, 0x0072, 0xCCEA, 3)   // CCE8
+    S(sta, ABX, 0x0280, 0xCCED, 5)   // CCEA
+    S(pla, IMP, 0x0000, 0xCCEE, 4)   // CCED
+    S(sta, ABX, 0x0285, 0xCCF1, 5)   // CCEE
+    S(rts, IMP, 0x0000, 0xCCF2, 6)   // CCF1
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_CE0E(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCE2C, 0xCE11, 6)   // CE0E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CE11(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCE6E, 0xCE14, 6)   // CE11
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CE14(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0090, 0xCE16, 3)   // CE14
+    S(sta, ZP_, 0x00D7, 0xCE18, 3)   // CE16
+    S(jsr, AB_, 0xCE71, 0xCE1B, 6)   // CE18
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_CE1B(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZP_, 0x00D7, 0xCE1D, 5)   // CE1B
+    S(inc, ZP_, 0x00D7, 0xCE1F, 5)   // CE1D
+    S(lda, ZP_, 0x008B, 0xCE21, 3)   // CE1F
+    S(sta, ZP_, 0x00D5, 0xCE23, 3)   // CE21
+    S(lda, ZP_, 0x0090, 0xCE25, 3)   // CE23
+    S(asl, ACC, 0x0000, 0xCE26, 2)   // CE25
+    S(clc, IMP, 0x0000, 0xCE27, 2)   // CE26
+    S(adc, IMM, 0x0010, 0xCE29, 2)   // CE27
+    S(sta, ZP_, 0x00D6, 0xCE2B, 3)   // CE29
+    S(rts, IMP, 0x0000, 0xCE2C, 6)   // CE2B
+    c->executed += 10;
+    return cycles;
+}
+
+static inline uint32_t rom_CE2C(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCED9, 0xCE2F, 6)   // CE2C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CE2F(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0092, 0xCE31, 3)   // CE2F
+    S(ldx, ZP_, 0x0082, 0xCE33, 3)   // CE31
+    S(lda, ZPX, 0x00B5, 0xCE35, 4)   // CE33
+    S(sta, ZP_, 0x0090, 0xCE37, 3)   // CE35
+    S(lda, ZPX, 0x00BB, 0xCE39, 4)   // CE37
+    S(sta, ZP_, 0x0091, 0xCE3B, 3)   // CE39
+    S(bne, REL, 0x0004, 0xCE3D, 2)   // CE3B
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_CE3D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0090, 0xCE3F, 3)   // CE3D
+    S(beq, REL, 0x000B, 0xCE41, 2)   // CE3F
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CE41(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0090, 0xCE43, 3)   // CE41
+    S(sec, IMP, 0x0000, 0xCE44, 2)   // CE43
+    S(sbc, IMM, 0x0001, 0xCE46, 2)   // CE44
+    S(sta, ZP_, 0x0090, 0xCE48, 3)   // CE46
+    S(bcs, REL, 0x0002, 0xCE4A, 2)   // CE48
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_CE4A(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, ZP_, 0x0091, 0xCE4C, 5)   // CE4A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CE4C(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZPX, 0x00C7, 0xCE4E, 4)   // CE4C
+    S(sta, ZP_, 0x006F, 0xCE50, 3)   // CE4E
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CE50(cpu *c) {
+    uint32_t cycles = 0;
+    S(lsr, ZP_, 0x006F, 0xCE52, 5)   // CE50
+    S(bcc, REL, 0x0003, 0xCE54, 2)   // CE52
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CE54(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCEED, 0xCE57, 6)   // CE54
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CE57(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCEE5, 0xCE5A, 6)   // CE57
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CE5A(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x006F, 0xCE5C, 3)   // CE5A
+    S(bne, REL, 0x00F2, 0xCE5E, 2)   // CE5C
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CE5E(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x00D4, 0xCE60, 3)   // CE5E
+    S(clc, IMP, 0x0000, 0xCE61, 2)   // CE60
+    S(adc, ZP_, 0x008B, 0xCE63, 3)   // CE61
+    S(sta, ZP_, 0x008B, 0xCE65, 3)   // CE63
+    S(bcc, REL, 0x0006, 0xCE67, 2)   // CE65
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_CE67(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZP_, 0x008C, 0xCE69, 5)   // CE67
+    S(bne, REL, 0x0002, 0xCE6B, 2)   // CE69
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CE6B(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZP_, 0x008D, 0xCE6D, 5)   // CE6B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CE6D(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xCE6E, 6)   // CE6D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CE6E(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x00FE, 0xCE70, 2)   // CE6E
+    S(bit, AB_, 0x78A9, 0xCE73, 4)   // CE70
+    S(sta, ZP_, 0x006F, 0xCE75, 3)   // CE73
+    S(ldx, IMM, 0x0003, 0xCE77, 2)   // CE75
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_CE71(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0078, 0xCE73, 2)   // CE71
+    S(sta, ZP_, 0x006F, 0xCE75, 3)   // CE73
+    S(ldx, IMM, 0x0003, 0xCE77, 2)   // CE75
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_CE77(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZPX, 0x008F, 0xCE79, 4)   // CE77
+    S(pha, IMP, 0x0000, 0xCE7A, 3)   // CE79
+    S(lda, ZPX, 0x008A, 0xCE7C, 4)   // CE7A
+    S(sta, ZPX, 0x008F, 0xCE7E, 4)   // CE7C
+    S(pla, IMP, 0x0000, 0xCE7F, 4)   // CE7E
+    S(sta, ZPX, 0x008A, 0xCE81, 4)   // CE7F
+    S(dex, IMP, 0x0000, 0xCE82, 2)   // CE81
+    S(bne, REL, 0x00F3, 0xCE84, 2)   // CE82
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_CE84(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCED9, 0xCE87, 6)   // CE84
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CE87(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, IMM, 0x0000, 0xCE89, 2)   // CE87
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CE89(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZPX, 0x0090, 0xCE8B, 4)   // CE89
+    S(sta, ZPX, 0x008F, 0xCE8D, 4)   // CE8B
+    S(inx, IMP, 0x0000, 0xCE8E, 2)   // CE8D
+    S(cpx, IMM, 0x0004, 0xCE90, 2)   // CE8E
+    S(bcc, REL, 0x00F7, 0xCE92, 2)   // CE90
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_CE92(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xCE94, 2)   // CE92
+    S(sta, ZP_, 0x0092, 0xCE96, 3)   // CE94
+    S(bit, ZP_, 0x006F, 0xCE98, 3)   // CE96
+    S(bmi, REL, 0x0009, 0xCE9A, 2)   // CE98
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_CE9A(cpu *c) {
+    uint32_t cycles = 0;
+    S(asl, ZP_, 0x008F, 0xCE9C, 5)   // CE9A
+    S(php, IMP, 0x0000, 0xCE9D, 3)   // CE9C
+    S(lsr, ZP_, 0x008F, 0xCE9F, 5)   // CE9D
+    S(plp, IMP, 0x0000, 0xCEA0, 4)   // CE9F
+    S(jsr, AB_, 0xCEE6, 0xCEA3, 6)   // CEA0
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_CEA3(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCEED, 0xCEA6, 6)   // CEA3
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CEA6(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCEE5, 0xCEA9, 6)   // CEA6
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CEA9(cpu *c) {
+    uint32_t cycles = 0;
+    S(bit, ZP_, 0x006F, 0xCEAB, 3)   // CEA9
+    S(bmi, REL, 0x0003, 0xCEAD, 2)   // CEAB
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CEAD(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCEE2, 0xCEB0, 6)   // CEAD
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CEB0(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x008F, 0xCEB2, 3)   // CEB0
+    S(clc, IMP, 0x0000, 0xCEB3, 2)   // CEB2
+    S(adc, ZP_, 0x0090, 0xCEB5, 3)   // CEB3
+    S(sta, ZP_, 0x0090, 0xCEB7, 3)   // CEB5
+    S(bcc, REL, 0x0006, 0xCEB9, 2)   // CEB7
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_CEB9(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZP_, 0x0091, 0xCEBB, 5)   // CEB9
+    S(bne, REL, 0x0002, 0xCEBD, 2)   // CEBB
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CEBD(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZP_, 0x0092, 0xCEBF, 5)   // CEBD
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CEBF(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0092, 0xCEC1, 3)   // CEBF
+    S(ora, ZP_, 0x0091, 0xCEC3, 3)   // CEC1
+    S(bne, REL, 0x00C2, 0xCEC5, 2)   // CEC3
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_CEC5(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0090, 0xCEC7, 3)   // CEC5
+    S(sec, IMP, 0x0000, 0xCEC8, 2)   // CEC7
+    S(sbc, ZP_, 0x006F, 0xCECA, 3)   // CEC8
+    S(bcc, REL, 0x000C, 0xCECC, 2)   // CECA
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_CECC(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZP_, 0x008B, 0xCECE, 5)   // CECC
+    S(bne, REL, 0x0006, 0xCED0, 2)   // CECE
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CED0(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZP_, 0x008C, 0xCED2, 5)   // CED0
+    S(bne, REL, 0x0002, 0xCED4, 2)   // CED2
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CED4(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZP_, 0x008D, 0xCED6, 5)   // CED4
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CED6(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0090, 0xCED8, 3)   // CED6
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CED8(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xCED9, 6)   // CED8
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CED9(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xCEDB, 2)   // CED9
+    S(sta, ZP_, 0x008B, 0xCEDD, 3)   // CEDB
+    S(sta, ZP_, 0x008C, 0xCEDF, 3)   // CEDD
+    S(sta, ZP_, 0x008D, 0xCEE1, 3)   // CEDF
+    S(rts, IMP, 0x0000, 0xCEE2, 6)   // CEE1
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_CEE2(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCEE5, 0xCEE5, 6)   // CEE2
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CEE5(cpu *c) {
+    uint32_t cycles = 0;
+    S(clc, IMP, 0x0000, 0xCEE6, 2)   // CEE5
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CEE6(cpu *c) {
+    uint32_t cycles = 0;
+    S(rol, ZP_, 0x0090, 0xCEE8, 5)   // CEE6
+    S(rol, ZP_, 0x0091, 0xCEEA, 5)   // CEE8
+    S(rol, ZP_, 0x0092, 0xCEEC, 5)   // CEEA
+    S(rts, IMP, 0x0000, 0xCEED, 6)   // CEEC
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_CEED(cpu *c) {
+    uint32_t cycles = 0;
+    S(clc, IMP, 0x0000, 0xCEEE, 2)   // CEED
+    S(ldx, IMM, 0x00FD, 0xCEF0, 2)   // CEEE
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CEF0(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZPX, 0x008E, 0xCEF2, 4)   // CEF0
+    S(adc, ZPX, 0x0093, 0xCEF4, 4)   // CEF2
+    S(sta, ZPX, 0x008E, 0xCEF6, 4)   // CEF4
+    S(inx, IMP, 0x0000, 0xCEF7, 2)   // CEF6
+    S(bne, REL, 0x00F7, 0xCEF9, 2)   // CEF7
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_CEF9(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xCEFA, 6)   // CEF9
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CEFA(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, IMM, 0x0000, 0xCEFC, 2)   // CEFA
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CEFC(cpu *c) {
+    uint32_t cycles = 0;
+    S(txa, IMP, 0x0000, 0xCEFD, 2)   // CEFC
+    S(sta, ZPX, 0x00FA, 0xCEFF, 4)   // CEFD
+    S(inx, IMP, 0x0000, 0xCF00, 2)   // CEFF
+    S(cpx, IMM, 0x0004, 0xCF02, 2)   // CF00
+    S(bne, REL, 0x00F8, 0xCF04, 2)   // CF02
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_CF04(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0006, 0xCF06, 2)   // CF04
+    S(sta, ZPX, 0x00FA, 0xCF08, 4)   // CF06
+    S(rts, IMP, 0x0000, 0xCF09, 6)   // CF08
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_CF09(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0004, 0xCF0B, 2)   // CF09
+    S(ldx, ZP_, 0x0082, 0xCF0D, 3)   // CF0B
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CF0D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABY, 0x00FA, 0xCF10, 4)   // CF0D
+    S(stx, ZPY, 0x00FA, 0xCF12, 4)   // CF10
+    S(cmp, ZP_, 0x0082, 0xCF14, 3)   // CF12
+    S(beq, REL, 0x0007, 0xCF16, 2)   // CF14
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_CF16(cpu *c) {
+    uint32_t cycles = 0;
+    S(dey, IMP, 0x0000, 0xCF17, 2)   // CF16
+    S(bmi, REL, 0x00E1, 0xCF19, 2)   // CF17
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CF19(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xCF1A, 2)   // CF19
+    S(jmp, AB_, 0xCF0D, 0xCF1D, 3)   // CF1A
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CF1D(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xCF1E, 6)   // CF1D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CF1E(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCF09, 0xCF21, 6)   // CF1E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CF21(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDFB7, 0xCF24, 6)   // CF21
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CF24(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x0046, 0xCF26, 2)   // CF24
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CF26(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD1D3, 0xCF29, 6)   // CF26
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CF29(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD28E, 0xCF2C, 6)   // CF29
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CF2C(cpu *c) {
+    uint32_t cycles = 0;
+    S(bmi, REL, 0x0048, 0xCF2E, 2)   // CF2C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CF2E(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDFC2, 0xCF31, 6)   // CF2E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CF31(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0080, 0xCF33, 3)   // CF31
+    S(pha, IMP, 0x0000, 0xCF34, 3)   // CF33
+    S(lda, ZP_, 0x0081, 0xCF36, 3)   // CF34
+    S(pha, IMP, 0x0000, 0xCF37, 3)   // CF36
+    S(lda, IMM, 0x0001, 0xCF39, 2)   // CF37
+    S(jsr, AB_, 0xD4F6, 0xCF3C, 6)   // CF39
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_CF3C(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0081, 0xCF3E, 3)   // CF3C
+    S(lda, IMM, 0x0000, 0xCF40, 2)   // CF3E
+    S(jsr, AB_, 0xD4F6, 0xCF43, 6)   // CF40
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_CF43(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0080, 0xCF45, 3)   // CF43
+    S(beq, REL, 0x001F, 0xCF47, 2)   // CF45
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CF47(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD125, 0xCF4A, 6)   // CF47
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CF4A(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x000B, 0xCF4C, 2)   // CF4A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CF4C(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDDAB, 0xCF4F, 6)   // CF4C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CF4F(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x0006, 0xCF51, 2)   // CF4F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CF51(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCF8C, 0xCF54, 6)   // CF51
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CF54(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xCF5D, 0xCF57, 3)   // CF54
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CF57(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCF8C, 0xCF5A, 6)   // CF57
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CF5A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE57, 0xCF5D, 6)   // CF5A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CF5D(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xCF5E, 4)   // CF5D
+    S(sta, ZP_, 0x0081, 0xCF60, 3)   // CF5E
+    S(pla, IMP, 0x0000, 0xCF61, 4)   // CF60
+    S(sta, ZP_, 0x0080, 0xCF63, 3)   // CF61
+    S(jmp, AB_, 0xCF6F, 0xCF66, 3)   // CF63
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_CF66(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xCF67, 4)   // CF66
+    S(sta, ZP_, 0x0081, 0xCF69, 3)   // CF67
+    S(pla, IMP, 0x0000, 0xCF6A, 4)   // CF69
+    S(sta, ZP_, 0x0080, 0xCF6C, 3)   // CF6A
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_CF6C(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCF8C, 0xCF6F, 6)   // CF6C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CF6F(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF93, 0xCF72, 6)   // CF6F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CF72(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xCF73, 2)   // CF72
+    S(jmp, AB_, 0xD599, 0xCF76, 3)   // CF73
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CF76(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0070, 0xCF78, 2)   // CF76
+    S(jmp, AB_, 0xC1C8, 0xCF7B, 3)   // CF78
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CF7B(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCF09, 0xCF7E, 6)   // CF7B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CF7E(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDFB7, 0xCF81, 6)   // CF7E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CF81(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x0008, 0xCF83, 2)   // CF81
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CF83(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD28E, 0xCF86, 6)   // CF83
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CF86(cpu *c) {
+    uint32_t cycles = 0;
+    S(bmi, REL, 0x00EE, 0xCF88, 2)   // CF86
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CF88(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDFC2, 0xCF8B, 6)   // CF88
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CF8B(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xCF8C, 6)   // CF8B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CF8C(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xCF8E, 3)   // CF8C
+    S(lda, ZPX, 0x00A7, 0xCF90, 4)   // CF8E
+    S(eor, IMM, 0x0080, 0xCF92, 2)   // CF90
+    S(sta, ZPX, 0x00A7, 0xCF94, 4)   // CF92
+    S(lda, ZPX, 0x00AE, 0xCF96, 4)   // CF94
+    S(eor, IMM, 0x0080, 0xCF98, 2)   // CF96
+    S(sta, ZPX, 0x00AE, 0xCF9A, 4)   // CF98
+    S(rts, IMP, 0x0000, 0xCF9B, 6)   // CF9A
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_CFB7(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0084, 0xCFB9, 3)   // CFB7
+    S(and, IMM, 0x008F, 0xCFBB, 2)   // CFB9
+    S(cmp, IMM, 0x000F, 0xCFBD, 2)   // CFBB
+    S(bcs, REL, 0x0019, 0xCFBF, 2)   // CFBD
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_CFBF(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD125, 0xCFC2, 6)   // CFBF
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CFC2(cpu *c) {
+    uint32_t cycles = 0;
+    S(bcs, REL, 0x0005, 0xCFC4, 2)   // CFC2
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CFC4(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0085, 0xCFC6, 3)   // CFC4
+    S(jmp, AB_, 0xD19D, 0xCFC9, 3)   // CFC6
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CFC9(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x0003, 0xCFCB, 2)   // CFC9
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CFCB(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xE0AB, 0xCFCE, 3)   // CFCB
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CFCE(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0085, 0xCFD0, 3)   // CFCE
+    S(jsr, AB_, 0xCFF1, 0xCFD3, 6)   // CFD0
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CFD3(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, ZP_, 0x0082, 0xCFD5, 3)   // CFD3
+    S(jmp, AB_, 0xD3EE, 0xCFD8, 3)   // CFD5
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CFD8(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0004, 0xCFDA, 2)   // CFD8
+    S(sta, ZP_, 0x0082, 0xCFDC, 3)   // CFDA
+    S(jsr, AB_, 0xD4E8, 0xCFDF, 6)   // CFDC
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_CFDF(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x002A, 0xCFE1, 2)   // CFDF
+    S(beq, REL, 0x0005, 0xCFE3, 2)   // CFE1
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CFE3(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0085, 0xCFE5, 3)   // CFE3
+    S(jsr, AB_, 0xCFF1, 0xCFE8, 6)   // CFE5
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CFE8(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x00F8, 0xCFEA, 3)   // CFE8
+    S(beq, REL, 0x0001, 0xCFEC, 2)   // CFEA
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CFEC(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xCFED, 6)   // CFEC
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CFED(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, AB_, 0x0255, 0xCFF0, 6)   // CFED
+    S(rts, IMP, 0x0000, 0xCFF1, 6)   // CFF0
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CFF1(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xCFF2, 3)   // CFF1
+    S(jsr, AB_, 0xDF93, 0xCFF5, 6)   // CFF2
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_CFF5(cpu *c) {
+    uint32_t cycles = 0;
+    S(bpl, REL, 0x0006, 0xCFF7, 2)   // CFF5
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_CFF7(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xCFF8, 4)   // CFF7
+    S(lda, IMM, 0x0061, 0xCFFA, 2)   // CFF8
+    S(jmp, AB_, 0xC1C8, 0xCFFD, 3)   // CFFA
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_CFFD(cpu *c) {
+    uint32_t cycles = 0;
+    S(asl, ACC, 0x0000, 0xCFFE, 2)   // CFFD
+    S(tax, IMP, 0x0000, 0xCFFF, 2)   // CFFE
+    S(pla, IMP, 0x0000, 0xD000, 4)   // CFFF
+    S(sta, INX, 0x0099, 0xD002, 6)   // D000
+    S(inc, ZPX, 0x0099, 0xD004, 6)   // D002
+    S(rts, IMP, 0x0000, 0xD005, 6)   // D004
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_D00E(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF10F, 0xD011, 6)   // D00E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D011(cpu *c) {
+    uint32_t cycles = 0;
+    S(tay, IMP, 0x0000, 0xD012, 2)   // D011
+    S(ldx, ZPY, 0x00A7, 0xD014, 4)   // D012
+    S(cpx, IMM, 0x00FF, 0xD016, 2)   // D014
+    S(bne, REL, 0x0014, 0xD018, 2)   // D016
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D018(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xD019, 3)   // D018
+    S(jsr, AB_, 0xD28E, 0xD01C, 6)   // D019
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D01C(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xD01D, 2)   // D01C
+    S(bpl, REL, 0x0005, 0xD01F, 2)   // D01D
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D01F(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0070, 0xD021, 2)   // D01F
+    S(jsr, AB_, 0xE648, 0xD024, 6)   // D021
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D024(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xD025, 4)   // D024
+    S(tay, IMP, 0x0000, 0xD026, 2)   // D025
+    S(txa, IMP, 0x0000, 0xD027, 2)   // D026
+    S(ora, IMM, 0x0080, 0xD029, 2)   // D027
+    S(sta, ABY, 0x00A7, 0xD02C, 5)   // D029
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_D02C(cpu *c) {
+    uint32_t cycles = 0;
+    S(txa, IMP, 0x0000, 0xD02D, 2)   // D02C
+    S(and, IMM, 0x000F, 0xD02F, 2)   // D02D
+    S(sta, ZP_, 0x00F9, 0xD031, 3)   // D02F
+    S(ldx, IMM, 0x0000, 0xD033, 2)   // D031
+    S(stx, ZP_, 0x0081, 0xD035, 3)   // D033
+    S(ldx, AB_, 0xFE85, 0xD038, 4)   // D035
+    S(stx, ZP_, 0x0080, 0xD03A, 3)   // D038
+    S(jsr, AB_, 0xD6D3, 0xD03D, 6)   // D03A
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_D03D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x00B0, 0xD03F, 2)   // D03D
+    S(jmp, AB_, 0xD58C, 0xD042, 3)   // D03F
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D042(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF0D1, 0xD045, 6)   // D042
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D045(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD313, 0xD048, 6)   // D045
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D048(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD00E, 0xD04B, 6)   // D048
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D04B(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x007F, 0xD04D, 3)   // D04B
+    S(lda, IMM, 0x0000, 0xD04F, 2)   // D04D
+    S(sta, ABX, 0x0251, 0xD052, 5)   // D04F
+    S(txa, IMP, 0x0000, 0xD053, 2)   // D052
+    S(asl, ACC, 0x0000, 0xD054, 2)   // D053
+    S(tax, IMP, 0x0000, 0xD055, 2)   // D054
+    S(lda, ZP_, 0x0016, 0xD057, 3)   // D055
+    S(sta, ZPX, 0x0012, 0xD059, 4)   // D057
+    S(lda, ZP_, 0x0017, 0xD05B, 3)   // D059
+    S(sta, ZPX, 0x0013, 0xD05D, 4)   // D05B
+    S(jsr, AB_, 0xD586, 0xD060, 6)   // D05D
+    c->executed += 11;
+    return cycles;
+}
+
+static inline uint32_t rom_D060(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x00F9, 0xD062, 3)   // D060
+    S(asl, ACC, 0x0000, 0xD063, 2)   // D062
+    S(tax, IMP, 0x0000, 0xD064, 2)   // D063
+    S(lda, IMM, 0x0002, 0xD066, 2)   // D064
+    S(sta, ZPX, 0x0099, 0xD068, 4)   // D066
+    S(lda, INX, 0x0099, 0xD06A, 6)   // D068
+    S(ldx, ZP_, 0x007F, 0xD06C, 3)   // D06A
+    S(sta, ABX, 0x0101, 0xD06F, 5)   // D06C
+    S(lda, IMM, 0x0000, 0xD071, 2)   // D06F
+    S(sta, ZPX, 0x001C, 0xD073, 4)   // D071
+    S(sta, ZPX, 0x00FF, 0xD075, 4)   // D073
+    S(jsr, AB_, 0xEF3A, 0xD078, 6)   // D075
+    c->executed += 12;
+    return cycles;
+}
+
+static inline uint32_t rom_D078(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0004, 0xD07A, 2)   // D078
+    S(lda, IMM, 0x0000, 0xD07C, 2)   // D07A
+    S(tax, IMP, 0x0000, 0xD07D, 2)   // D07C
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D07D(cpu *c) {
+    uint32_t cycles = 0;
+    S(clc, IMP, 0x0000, 0xD07E, 2)   // D07D
+    S(adc, INY, 0x006D, 0xD080, 5)   // D07E
+    S(bcc, REL, 0x0001, 0xD082, 2)   // D080
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D082(cpu *c) {
+    uint32_t cycles = 0;
+    S(inx, IMP, 0x0000, 0xD083, 2)   // D082
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D083(cpu *c) {
+    uint32_t cycles = 0;
+    S(iny, IMP, 0x0000, 0xD084, 2)   // D083
+    S(iny, IMP, 0x0000, 0xD085, 2)   // D084
+    S(iny, IMP, 0x0000, 0xD086, 2)   // D085
+    S(iny, IMP, 0x0000, 0xD087, 2)   // D086
+    S(cpy, IMM, 0x0048, 0xD089, 2)   // D087
+    S(beq, REL, 0x00F8, 0xD08B, 2)   // D089
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_D08B(cpu *c) {
+    uint32_t cycles = 0;
+    S(cpy, IMM, 0x0090, 0xD08D, 2)   // D08B
+    S(bne, REL, 0x00EE, 0xD08F, 2)   // D08D
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D08F(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xD090, 3)   // D08F
+    S(txa, IMP, 0x0000, 0xD091, 2)   // D090
+    S(ldx, ZP_, 0x007F, 0xD093, 3)   // D091
+    S(sta, ABX, 0x02FC, 0xD096, 5)   // D093
+    S(pla, IMP, 0x0000, 0xD097, 4)   // D096
+    S(sta, ABX, 0x02FA, 0xD09A, 5)   // D097
+    S(rts, IMP, 0x0000, 0xD09B, 6)   // D09A
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_D09B(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD6D0, 0xD09E, 6)   // D09B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D09E(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD0C3, 0xD0A1, 6)   // D09E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D0A1(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD599, 0xD0A4, 6)   // D0A1
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D0A4(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD137, 0xD0A7, 6)   // D0A4
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D0A7(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0080, 0xD0A9, 3)   // D0A7
+    S(jsr, AB_, 0xD137, 0xD0AC, 6)   // D0A9
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D0AC(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0081, 0xD0AE, 3)   // D0AC
+    S(rts, IMP, 0x0000, 0xD0AF, 6)   // D0AE
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D0AF(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD09B, 0xD0B2, 6)   // D0AF
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D0B2(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0080, 0xD0B4, 3)   // D0B2
+    S(bne, REL, 0x0001, 0xD0B6, 2)   // D0B4
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D0B6(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xD0B7, 6)   // D0B6
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D0B7(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCF1E, 0xD0BA, 6)   // D0B7
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D0BA(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD6D0, 0xD0BD, 6)   // D0BA
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D0BD(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD0C3, 0xD0C0, 6)   // D0BD
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D0C0(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xCF1E, 0xD0C3, 3)   // D0C0
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D0C3(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0080, 0xD0C5, 2)   // D0C3
+    S(bne, REL, 0x0002, 0xD0C7, 2)   // D0C5
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D0C7(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0090, 0xD0C9, 2)   // D0C7
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D0C9(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, AB_, 0x024D, 0xD0CC, 4)   // D0C9
+    S(jsr, AB_, 0xDF93, 0xD0CF, 6)   // D0CC
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D0CF(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xD0D0, 2)   // D0CF
+    S(jsr, AB_, 0xD506, 0xD0D3, 6)   // D0D0
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D0D3(cpu *c) {
+    uint32_t cycles = 0;
+    S(txa, IMP, 0x0000, 0xD0D4, 2)   // D0D3
+    S(pha, IMP, 0x0000, 0xD0D5, 3)   // D0D4
+    S(asl, ACC, 0x0000, 0xD0D6, 2)   // D0D5
+    S(tax, IMP, 0x0000, 0xD0D7, 2)   // D0D6
+    S(lda, IMM, 0x0000, 0xD0D9, 2)   // D0D7
+    S(sta, ZPX, 0x0099, 0xD0DB, 4)   // D0D9
+    S(jsr, AB_, 0xD125, 0xD0DE, 6)   // D0DB
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_D0DE(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0004, 0xD0E0, 2)   // D0DE
+    S(bcs, REL, 0x0006, 0xD0E2, 2)   // D0E0
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D0E2(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZPX, 0x00B5, 0xD0E4, 6)   // D0E2
+    S(bne, REL, 0x0002, 0xD0E6, 2)   // D0E4
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D0E6(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZPX, 0x00BB, 0xD0E8, 6)   // D0E6
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D0E8(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xD0E9, 4)   // D0E8
+    S(tax, IMP, 0x0000, 0xD0EA, 2)   // D0E9
+    S(rts, IMP, 0x0000, 0xD0EB, 6)   // D0EA
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D0EB(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0083, 0xD0ED, 3)   // D0EB
+    S(cmp, IMM, 0x0013, 0xD0EF, 2)   // D0ED
+    S(bcc, REL, 0x0002, 0xD0F1, 2)   // D0EF
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D0F1(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x000F, 0xD0F3, 2)   // D0F1
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D0F3(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x000F, 0xD0F5, 2)   // D0F3
+    S(bne, REL, 0x0002, 0xD0F7, 2)   // D0F5
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D0F7(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0010, 0xD0F9, 2)   // D0F7
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D0F9(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xD0FA, 2)   // D0F9
+    S(sec, IMP, 0x0000, 0xD0FB, 2)   // D0FA
+    S(lda, ABX, 0x022B, 0xD0FE, 4)   // D0FB
+    S(bmi, REL, 0x0006, 0xD100, 2)   // D0FE
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D100(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x000F, 0xD102, 2)   // D100
+    S(sta, ZP_, 0x0082, 0xD104, 3)   // D102
+    S(tax, IMP, 0x0000, 0xD105, 2)   // D104
+    S(clc, IMP, 0x0000, 0xD106, 2)   // D105
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D106(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xD107, 6)   // D106
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D107(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0083, 0xD109, 3)   // D107
+    S(cmp, IMM, 0x0013, 0xD10B, 2)   // D109
+    S(bcc, REL, 0x0002, 0xD10D, 2)   // D10B
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D10D(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x000F, 0xD10F, 2)   // D10D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D10F(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xD110, 2)   // D10F
+    S(lda, ABX, 0x022B, 0xD113, 4)   // D110
+    S(tay, IMP, 0x0000, 0xD114, 2)   // D113
+    S(asl, ACC, 0x0000, 0xD115, 2)   // D114
+    S(bcc, REL, 0x000A, 0xD117, 2)   // D115
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_D117(cpu *c) {
+    uint32_t cycles = 0;
+    S(bmi, REL, 0x000A, 0xD119, 2)   // D117
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D119(cpu *c) {
+    uint32_t cycles = 0;
+    S(tya, IMP, 0x0000, 0xD11A, 2)   // D119
+    S(and, IMM, 0x000F, 0xD11C, 2)   // D11A
+    S(sta, ZP_, 0x0082, 0xD11E, 3)   // D11C
+    S(tax, IMP, 0x0000, 0xD11F, 2)   // D11E
+    S(clc, IMP, 0x0000, 0xD120, 2)   // D11F
+    S(rts, IMP, 0x0000, 0xD121, 6)   // D120
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_D121(cpu *c) {
+    uint32_t cycles = 0;
+    S(bmi, REL, 0x00F6, 0xD123, 2)   // D121
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D123(cpu *c) {
+    uint32_t cycles = 0;
+    S(sec, IMP, 0x0000, 0xD124, 2)   // D123
+    S(rts, IMP, 0x0000, 0xD125, 6)   // D124
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D125(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xD127, 3)   // D125
+    S(lda, ZPX, 0x00EC, 0xD129, 4)   // D127
+    S(lsr, ACC, 0x0000, 0xD12A, 2)   // D129
+    S(and, IMM, 0x0007, 0xD12C, 2)   // D12A
+    S(cmp, IMM, 0x0004, 0xD12E, 2)   // D12C
+    S(rts, IMP, 0x0000, 0xD12F, 6)   // D12E
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_D12F(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF93, 0xD132, 6)   // D12F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D132(cpu *c) {
+    uint32_t cycles = 0;
+    S(asl, ACC, 0x0000, 0xD133, 2)   // D132
+    S(tax, IMP, 0x0000, 0xD134, 2)   // D133
+    S(ldy, ZP_, 0x0082, 0xD136, 3)   // D134
+    S(rts, IMP, 0x0000, 0xD137, 6)   // D136
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D137(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD12F, 0xD13A, 6)   // D137
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D13A(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABY, 0x0244, 0xD13D, 4)   // D13A
+    S(beq, REL, 0x0012, 0xD13F, 2)   // D13D
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D13F(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INX, 0x0099, 0xD141, 6)   // D13F
+    S(pha, IMP, 0x0000, 0xD142, 3)   // D141
+    S(lda, ZPX, 0x0099, 0xD144, 4)   // D142
+    S(cmp, ABY, 0x0244, 0xD147, 4)   // D144
+    S(bne, REL, 0x0004, 0xD149, 2)   // D147
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_D149(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x00FF, 0xD14B, 2)   // D149
+    S(sta, ZPX, 0x0099, 0xD14D, 4)   // D14B
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D14D(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xD14E, 4)   // D14D
+    S(inc, ZPX, 0x0099, 0xD150, 6)   // D14E
+    S(rts, IMP, 0x0000, 0xD151, 6)   // D150
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D151(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INX, 0x0099, 0xD153, 6)   // D151
+    S(inc, ZPX, 0x0099, 0xD155, 6)   // D153
+    S(rts, IMP, 0x0000, 0xD156, 6)   // D155
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D156(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD137, 0xD159, 6)   // D156
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D159(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x0036, 0xD15B, 2)   // D159
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D15B(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0085, 0xD15D, 3)   // D15B
+    S(lda, ABY, 0x0244, 0xD160, 4)   // D15D
+    S(beq, REL, 0x0008, 0xD162, 2)   // D160
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D162(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0080, 0xD164, 2)   // D162
+    S(sta, ABY, 0x00F2, 0xD167, 5)   // D164
+    S(lda, ZP_, 0x0085, 0xD169, 3)   // D167
+    S(rts, IMP, 0x0000, 0xD16A, 6)   // D169
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D16A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCF1E, 0xD16D, 6)   // D16A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D16D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xD16F, 2)   // D16D
+    S(jsr, AB_, 0xD4C8, 0xD172, 6)   // D16F
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D172(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD137, 0xD175, 6)   // D172
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D175(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0000, 0xD177, 2)   // D175
+    S(beq, REL, 0x0019, 0xD179, 2)   // D177
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D179(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0080, 0xD17B, 3)   // D179
+    S(jsr, AB_, 0xD137, 0xD17E, 6)   // D17B
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D17E(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0081, 0xD180, 3)   // D17E
+    S(jsr, AB_, 0xCF1E, 0xD183, 6)   // D180
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D183(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD1D3, 0xD186, 6)   // D183
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D186(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD6D0, 0xD189, 6)   // D186
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D189(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD0C3, 0xD18C, 6)   // D189
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D18C(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCF1E, 0xD18F, 6)   // D18C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D18F(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0085, 0xD191, 3)   // D18F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D191(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xD192, 6)   // D191
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D192(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD137, 0xD195, 6)   // D192
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D195(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, ZP_, 0x0082, 0xD197, 3)   // D195
+    S(sta, ABY, 0x0244, 0xD19A, 5)   // D197
+    S(lda, ZP_, 0x0085, 0xD19C, 3)   // D19A
+    S(rts, IMP, 0x0000, 0xD19D, 6)   // D19C
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D19D(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCFF1, 0xD1A0, 6)   // D19D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D1A0(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x0001, 0xD1A2, 2)   // D1A0
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D1A2(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xD1A3, 6)   // D1A2
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D1A3(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD1D3, 0xD1A6, 6)   // D1A3
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D1A6(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF11E, 0xD1A9, 6)   // D1A6
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D1A9(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xD1AB, 2)   // D1A9
+    S(jsr, AB_, 0xD4C8, 0xD1AE, 6)   // D1AB
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D1AE(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0080, 0xD1B0, 3)   // D1AE
+    S(jsr, AB_, 0xCFF1, 0xD1B3, 6)   // D1B0
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D1B3(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0081, 0xD1B5, 3)   // D1B3
+    S(jsr, AB_, 0xCFF1, 0xD1B8, 6)   // D1B5
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D1B8(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD0C7, 0xD1BB, 6)   // D1B8
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D1BB(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCF1E, 0xD1BE, 6)   // D1BB
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D1BE(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD6D0, 0xD1C1, 6)   // D1BE
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D1C1(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0002, 0xD1C3, 2)   // D1C1
+    S(jmp, AB_, 0xD4C8, 0xD1C6, 3)   // D1C3
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D1C6(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x006F, 0xD1C8, 3)   // D1C6
+    S(jsr, AB_, 0xD4E8, 0xD1CB, 6)   // D1C8
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D1CB(cpu *c) {
+    uint32_t cycles = 0;
+    S(clc, IMP, 0x0000, 0xD1CC, 2)   // D1CB
+    S(adc, ZP_, 0x006F, 0xD1CE, 3)   // D1CC
+    S(sta, ZPX, 0x0099, 0xD1D0, 4)   // D1CE
+    S(sta, ZP_, 0x0094, 0xD1D2, 3)   // D1D0
+    S(rts, IMP, 0x0000, 0xD1D3, 6)   // D1D2
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_D1D3(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF93, 0xD1D6, 6)   // D1D3
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D1D6(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xD1D7, 2)   // D1D6
+    S(lda, ABX, 0x025B, 0xD1DA, 4)   // D1D7
+    S(and, IMM, 0x0001, 0xD1DC, 2)   // D1DA
+    S(sta, ZP_, 0x007F, 0xD1DE, 3)   // D1DC
+    S(rts, IMP, 0x0000, 0xD1DF, 6)   // D1DE
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_D1DF(cpu *c) {
+    uint32_t cycles = 0;
+    S(sec, IMP, 0x0000, 0xD1E0, 2)   // D1DF
+    S(bcs, REL, 0x0001, 0xD1E2, 2)   // D1E0
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D1E2(cpu *c) {
+    uint32_t cycles = 0;
+    S(clc, IMP, 0x0000, 0xD1E3, 2)   // D1E2
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D1E3(cpu *c) {
+    uint32_t cycles = 0;
+    S(php, IMP, 0x0000, 0xD1E4, 3)   // D1E3
+    S(sta, ZP_, 0x006F, 0xD1E6, 3)   // D1E4
+    S(jsr, AB_, 0xD227, 0xD1E9, 6)   // D1E6
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D1E9(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD37F, 0xD1EC, 6)   // D1E9
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D1EC(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0082, 0xD1EE, 3)   // D1EC
+    S(ldx, ZP_, 0x0083, 0xD1F0, 3)   // D1EE
+    S(plp, IMP, 0x0000, 0xD1F1, 4)   // D1F0
+    S(bcc, REL, 0x0002, 0xD1F3, 2)   // D1F1
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D1F3(cpu *c) {
+    uint32_t cycles = 0;
+    S(ora, IMM, 0x0080, 0xD1F5, 2)   // D1F3
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D1F5(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ABX, 0x022B, 0xD1F8, 5)   // D1F5
+    S(and, IMM, 0x003F, 0xD1FA, 2)   // D1F8
+    S(tay, IMP, 0x0000, 0xD1FB, 2)   // D1FA
+    S(lda, IMM, 0x00FF, 0xD1FD, 2)   // D1FB
+    S(sta, ABY, 0x00A7, 0xD200, 5)   // D1FD
+    S(sta, ABY, 0x00AE, 0xD203, 5)   // D200
+    S(sta, ABY, 0x00CD, 0xD206, 5)   // D203
+    S(dec, ZP_, 0x006F, 0xD208, 5)   // D206
+    S(bmi, REL, 0x001C, 0xD20A, 2)   // D208
+    c->executed += 9;
+    return cycles;
+}
+
+static inline uint32_t rom_D20A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD28E, 0xD20D, 6)   // D20A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D20D(cpu *c) {
+    uint32_t cycles = 0;
+    S(bpl, REL, 0x0008, 0xD20F, 2)   // D20D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D20F(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD25A, 0xD212, 6)   // D20F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D212(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0070, 0xD214, 2)   // D212
+    S(jmp, AB_, 0xC1C8, 0xD217, 3)   // D214
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D217(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ABY, 0x00A7, 0xD21A, 5)   // D217
+    S(dec, ZP_, 0x006F, 0xD21C, 5)   // D21A
+    S(bmi, REL, 0x0008, 0xD21E, 2)   // D21C
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D21E(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD28E, 0xD221, 6)   // D21E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D221(cpu *c) {
+    uint32_t cycles = 0;
+    S(bmi, REL, 0x00EC, 0xD223, 2)   // D221
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D223(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ABY, 0x00AE, 0xD226, 5)   // D223
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D226(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xD227, 6)   // D226
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D227(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0083, 0xD229, 3)   // D227
+    S(cmp, IMM, 0x000F, 0xD22B, 2)   // D229
+    S(bne, REL, 0x0001, 0xD22D, 2)   // D22B
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D22D(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xD22E, 6)   // D22D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D22E(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0083, 0xD230, 3)   // D22E
+    S(lda, ABX, 0x022B, 0xD233, 4)   // D230
+    S(cmp, IMM, 0x00FF, 0xD235, 2)   // D233
+    S(beq, REL, 0x0022, 0xD237, 2)   // D235
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D237(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x003F, 0xD239, 2)   // D237
+    S(sta, ZP_, 0x0082, 0xD23B, 3)   // D239
+    S(lda, IMM, 0x00FF, 0xD23D, 2)   // D23B
+    S(sta, ABX, 0x022B, 0xD240, 5)   // D23D
+    S(ldx, ZP_, 0x0082, 0xD242, 3)   // D240
+    S(lda, IMM, 0x0000, 0xD244, 2)   // D242
+    S(sta, ZPX, 0x00F2, 0xD246, 4)   // D244
+    S(jsr, AB_, 0xD25A, 0xD249, 6)   // D246
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_D249(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xD24B, 3)   // D249
+    S(lda, IMM, 0x0001, 0xD24D, 2)   // D24B
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D24D(cpu *c) {
+    uint32_t cycles = 0;
+    S(dex, IMP, 0x0000, 0xD24E, 2)   // D24D
+    S(bmi, REL, 0x0003, 0xD250, 2)   // D24E
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D250(cpu *c) {
+    uint32_t cycles = 0;
+    S(asl, ACC, 0x0000, 0xD251, 2)   // D250
+    S(bne, REL, 0x00FA, 0xD253, 2)   // D251
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D253(cpu *c) {
+    uint32_t cycles = 0;
+    S(ora, AB_, 0x0256, 0xD256, 4)   // D253
+    S(sta, AB_, 0x0256, 0xD259, 4)   // D256
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D259(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xD25A, 6)   // D259
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D25A(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xD25C, 3)   // D25A
+    S(lda, ZPX, 0x00A7, 0xD25E, 4)   // D25C
+    S(cmp, IMM, 0x00FF, 0xD260, 2)   // D25E
+    S(beq, REL, 0x0009, 0xD262, 2)   // D260
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D262(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xD263, 3)   // D262
+    S(lda, IMM, 0x00FF, 0xD265, 2)   // D263
+    S(sta, ZPX, 0x00A7, 0xD267, 4)   // D265
+    S(pla, IMP, 0x0000, 0xD268, 4)   // D267
+    S(jsr, AB_, 0xD2F3, 0xD26B, 6)   // D268
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_D26B(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xD26D, 3)   // D26B
+    S(lda, ZPX, 0x00AE, 0xD26F, 4)   // D26D
+    S(cmp, IMM, 0x00FF, 0xD271, 2)   // D26F
+    S(beq, REL, 0x0009, 0xD273, 2)   // D271
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D273(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xD274, 3)   // D273
+    S(lda, IMM, 0x00FF, 0xD276, 2)   // D274
+    S(sta, ZPX, 0x00AE, 0xD278, 4)   // D276
+    S(pla, IMP, 0x0000, 0xD279, 4)   // D278
+    S(jsr, AB_, 0xD2F3, 0xD27C, 6)   // D279
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_D27C(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xD27E, 3)   // D27C
+    S(lda, ZPX, 0x00CD, 0xD280, 4)   // D27E
+    S(cmp, IMM, 0x00FF, 0xD282, 2)   // D280
+    S(beq, REL, 0x0009, 0xD284, 2)   // D282
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D284(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xD285, 3)   // D284
+    S(lda, IMM, 0x00FF, 0xD287, 2)   // D285
+    S(sta, ZPX, 0x00CD, 0xD289, 4)   // D287
+    S(pla, IMP, 0x0000, 0xD28A, 4)   // D289
+    S(jsr, AB_, 0xD2F3, 0xD28D, 6)   // D28A
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_D28D(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xD28E, 6)   // D28D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D28E(cpu *c) {
+    uint32_t cycles = 0;
+    S(tya, IMP, 0x0000, 0xD28F, 2)   // D28E
+    S(pha, IMP, 0x0000, 0xD290, 3)   // D28F
+    S(ldy, IMM, 0x0001, 0xD292, 2)   // D290
+    S(jsr, AB_, 0xD2BA, 0xD295, 6)   // D292
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D295(cpu *c) {
+    uint32_t cycles = 0;
+    S(bpl, REL, 0x000C, 0xD297, 2)   // D295
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D297(cpu *c) {
+    uint32_t cycles = 0;
+    S(dey, IMP, 0x0000, 0xD298, 2)   // D297
+    S(jsr, AB_, 0xD2BA, 0xD29B, 6)   // D298
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D29B(cpu *c) {
+    uint32_t cycles = 0;
+    S(bpl, REL, 0x0006, 0xD29D, 2)   // D29B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D29D(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD339, 0xD2A0, 6)   // D29D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D2A0(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xD2A1, 2)   // D2A0
+    S(bmi, REL, 0x0013, 0xD2A3, 2)   // D2A1
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D2A3(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZPX, 0x0000, 0xD2A5, 4)   // D2A3
+    S(bmi, REL, 0x00FC, 0xD2A7, 2)   // D2A5
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D2A7(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x007F, 0xD2A9, 3)   // D2A7
+    S(sta, ZPX, 0x0000, 0xD2AB, 4)   // D2A9
+    S(sta, ABX, 0x025B, 0xD2AE, 5)   // D2AB
+    S(txa, IMP, 0x0000, 0xD2AF, 2)   // D2AE
+    S(asl, ACC, 0x0000, 0xD2B0, 2)   // D2AF
+    S(tay, IMP, 0x0000, 0xD2B1, 2)   // D2B0
+    S(lda, IMM, 0x0002, 0xD2B3, 2)   // D2B1
+    S(sta, ABY, 0x0099, 0xD2B6, 5)   // D2B3
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_D2B6(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xD2B7, 4)   // D2B6
+    S(tay, IMP, 0x0000, 0xD2B8, 2)   // D2B7
+    S(txa, IMP, 0x0000, 0xD2B9, 2)   // D2B8
+    S(rts, IMP, 0x0000, 0xD2BA, 6)   // D2B9
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D2BA(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, IMM, 0x0007, 0xD2BC, 2)   // D2BA
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D2BC(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABY, 0x024F, 0xD2BF, 4)   // D2BC
+    S(and, ABX, 0xEFE9, 0xD2C2, 4)   // D2BF
+    S(beq, REL, 0x0004, 0xD2C4, 2)   // D2C2
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D2C4(cpu *c) {
+    uint32_t cycles = 0;
+    S(dex, IMP, 0x0000, 0xD2C5, 2)   // D2C4
+    S(bpl, REL, 0x00F5, 0xD2C7, 2)   // D2C5
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D2C7(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xD2C8, 6)   // D2C7
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D2C8(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABY, 0x024F, 0xD2CB, 4)   // D2C8
+    S(eor, ABX, 0xEFE9, 0xD2CE, 4)   // D2CB
+    S(sta, ABY, 0x024F, 0xD2D1, 5)   // D2CE
+    S(txa, IMP, 0x0000, 0xD2D2, 2)   // D2D1
+    S(dey, IMP, 0x0000, 0xD2D3, 2)   // D2D2
+    S(bmi, REL, 0x0003, 0xD2D5, 2)   // D2D3
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_D2D5(cpu *c) {
+    uint32_t cycles = 0;
+    S(clc, IMP, 0x0000, 0xD2D6, 2)   // D2D5
+    S(adc, IMM, 0x0008, 0xD2D8, 2)   // D2D6
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D2D8(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xD2D9, 2)   // D2D8
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D2D9(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xD2DA, 6)   // D2D9
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D2DA(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xD2DC, 3)   // D2DA
+    S(lda, ZPX, 0x00A7, 0xD2DE, 4)   // D2DC
+    S(bmi, REL, 0x0009, 0xD2E0, 2)   // D2DE
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D2E0(cpu *c) {
+    uint32_t cycles = 0;
+    S(txa, IMP, 0x0000, 0xD2E1, 2)   // D2E0
+    S(clc, IMP, 0x0000, 0xD2E2, 2)   // D2E1
+    S(adc, IMM, 0x0007, 0xD2E4, 2)   // D2E2
+    S(tax, IMP, 0x0000, 0xD2E5, 2)   // D2E4
+    S(lda, ZPX, 0x00A7, 0xD2E7, 4)   // D2E5
+    S(bpl, REL, 0x00F0, 0xD2E9, 2)   // D2E7
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_D2E9(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x00FF, 0xD2EB, 2)   // D2E9
+    S(beq, REL, 0x00EC, 0xD2ED, 2)   // D2EB
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D2ED(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xD2EE, 3)   // D2ED
+    S(lda, IMM, 0x00FF, 0xD2F0, 2)   // D2EE
+    S(sta, ZPX, 0x00A7, 0xD2F2, 4)   // D2F0
+    S(pla, IMP, 0x0000, 0xD2F3, 4)   // D2F2
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D2F3(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x000F, 0xD2F5, 2)   // D2F3
+    S(tay, IMP, 0x0000, 0xD2F6, 2)   // D2F5
+    S(iny, IMP, 0x0000, 0xD2F7, 2)   // D2F6
+    S(ldx, IMM, 0x0010, 0xD2F9, 2)   // D2F7
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D2F9(cpu *c) {
+    uint32_t cycles = 0;
+    S(ror, AB_, 0x0250, 0xD2FC, 6)   // D2F9
+    S(ror, AB_, 0x024F, 0xD2FF, 6)   // D2FC
+    S(dey, IMP, 0x0000, 0xD300, 2)   // D2FF
+    S(bne, REL, 0x0001, 0xD302, 2)   // D300
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D302(cpu *c) {
+    uint32_t cycles = 0;
+    S(clc, IMP, 0x0000, 0xD303, 2)   // D302
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D303(cpu *c) {
+    uint32_t cycles = 0;
+    S(dex, IMP, 0x0000, 0xD304, 2)   // D303
+    S(bpl, REL, 0x00F3, 0xD306, 2)   // D304
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D306(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xD307, 6)   // D306
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D313(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x000E, 0xD315, 2)   // D313
+    S(sta, ZP_, 0x0083, 0xD317, 3)   // D315
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D317(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0083, 0xD319, 3)   // D317
+    S(lda, ABX, 0x022B, 0xD31C, 4)   // D319
+    S(cmp, IMM, 0x00FF, 0xD31E, 2)   // D31C
+    S(beq, REL, 0x0014, 0xD320, 2)   // D31E
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D320(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x003F, 0xD322, 2)   // D320
+    S(sta, ZP_, 0x0082, 0xD324, 3)   // D322
+    S(jsr, AB_, 0xDF93, 0xD327, 6)   // D324
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D327(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xD328, 2)   // D327
+    S(lda, ABX, 0x025B, 0xD32B, 4)   // D328
+    S(and, IMM, 0x0001, 0xD32D, 2)   // D32B
+    S(cmp, ZP_, 0x007F, 0xD32F, 3)   // D32D
+    S(bne, REL, 0x0003, 0xD331, 2)   // D32F
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_D331(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD227, 0xD334, 6)   // D331
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D334(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, ZP_, 0x0083, 0xD336, 5)   // D334
+    S(bpl, REL, 0x00DF, 0xD338, 2)   // D336
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D338(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xD339, 6)   // D338
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D339(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x006F, 0xD33B, 3)   // D339
+    S(pha, IMP, 0x0000, 0xD33C, 3)   // D33B
+    S(ldy, IMM, 0x0000, 0xD33E, 2)   // D33C
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D33E(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZPY, 0x00FA, 0xD340, 4)   // D33E
+    S(lda, ZPX, 0x00A7, 0xD342, 4)   // D340
+    S(bpl, REL, 0x0004, 0xD344, 2)   // D342
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D344(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x00FF, 0xD346, 2)   // D344
+    S(bne, REL, 0x0016, 0xD348, 2)   // D346
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D348(cpu *c) {
+    uint32_t cycles = 0;
+    S(txa, IMP, 0x0000, 0xD349, 2)   // D348
+    S(clc, IMP, 0x0000, 0xD34A, 2)   // D349
+    S(adc, IMM, 0x0007, 0xD34C, 2)   // D34A
+    S(tax, IMP, 0x0000, 0xD34D, 2)   // D34C
+    S(lda, ZPX, 0x00A7, 0xD34F, 4)   // D34D
+    S(bpl, REL, 0x0004, 0xD351, 2)   // D34F
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_D351(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x00FF, 0xD353, 2)   // D351
+    S(bne, REL, 0x0009, 0xD355, 2)   // D353
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D355(cpu *c) {
+    uint32_t cycles = 0;
+    S(iny, IMP, 0x0000, 0xD356, 2)   // D355
+    S(cpy, IMM, 0x0005, 0xD358, 2)   // D356
+    S(bcc, REL, 0x00E4, 0xD35A, 2)   // D358
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D35A(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, IMM, 0x00FF, 0xD35C, 2)   // D35A
+    S(bne, REL, 0x001C, 0xD35E, 2)   // D35C
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D35E(cpu *c) {
+    uint32_t cycles = 0;
+    S(stx, ZP_, 0x006F, 0xD360, 3)   // D35E
+    S(and, IMM, 0x003F, 0xD362, 2)   // D360
+    S(tax, IMP, 0x0000, 0xD363, 2)   // D362
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D363(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZPX, 0x0000, 0xD365, 4)   // D363
+    S(bmi, REL, 0x00FC, 0xD367, 2)   // D365
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D367(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0002, 0xD369, 2)   // D367
+    S(bcc, REL, 0x0008, 0xD36B, 2)   // D369
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D36B(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x006F, 0xD36D, 3)   // D36B
+    S(cpx, IMM, 0x0007, 0xD36F, 2)   // D36D
+    S(bcc, REL, 0x00D7, 0xD371, 2)   // D36F
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D371(cpu *c) {
+    uint32_t cycles = 0;
+    S(bcs, REL, 0x00E2, 0xD373, 2)   // D371
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D373(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, ZP_, 0x006F, 0xD375, 3)   // D373
+    S(lda, IMM, 0x00FF, 0xD377, 2)   // D375
+    S(sta, ABY, 0x00A7, 0xD37A, 5)   // D377
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D37A(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xD37B, 4)   // D37A
+    S(sta, ZP_, 0x006F, 0xD37D, 3)   // D37B
+    S(txa, IMP, 0x0000, 0xD37E, 2)   // D37D
+    S(rts, IMP, 0x0000, 0xD37F, 6)   // D37E
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D37F(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0000, 0xD381, 2)   // D37F
+    S(lda, IMM, 0x0001, 0xD383, 2)   // D381
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D383(cpu *c) {
+    uint32_t cycles = 0;
+    S(bit, AB_, 0x0256, 0xD386, 4)   // D383
+    S(bne, REL, 0x0009, 0xD388, 2)   // D386
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D388(cpu *c) {
+    uint32_t cycles = 0;
+    S(iny, IMP, 0x0000, 0xD389, 2)   // D388
+    S(asl, ACC, 0x0000, 0xD38A, 2)   // D389
+    S(bne, REL, 0x00F7, 0xD38C, 2)   // D38A
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D38C(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0070, 0xD38E, 2)   // D38C
+    S(jmp, AB_, 0xC1C8, 0xD391, 3)   // D38E
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D391(cpu *c) {
+    uint32_t cycles = 0;
+    S(eor, IMM, 0x00FF, 0xD393, 2)   // D391
+    S(and, AB_, 0x0256, 0xD396, 4)   // D393
+    S(sta, AB_, 0x0256, 0xD399, 4)   // D396
+    S(tya, IMP, 0x0000, 0xD39A, 2)   // D399
+    S(rts, IMP, 0x0000, 0xD39B, 6)   // D39A
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_D39B(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD0EB, 0xD39E, 6)   // D39B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D39E(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC100, 0xD3A1, 6)   // D39E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D3A1(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD3AA, 0xD3A4, 6)   // D3A1
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D3A4(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xD3A6, 3)   // D3A4
+    S(lda, ABX, 0x023E, 0xD3A9, 4)   // D3A6
+    S(rts, IMP, 0x0000, 0xD3AA, 6)   // D3A9
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D3AA(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xD3AC, 3)   // D3AA
+    S(jsr, AB_, 0xD125, 0xD3AF, 6)   // D3AC
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D3AF(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x0003, 0xD3B1, 2)   // D3AF
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D3B1(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xE120, 0xD3B4, 3)   // D3B1
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D3B4(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0083, 0xD3B6, 3)   // D3B4
+    S(cmp, IMM, 0x000F, 0xD3B8, 2)   // D3B6
+    S(beq, REL, 0x005A, 0xD3BA, 2)   // D3B8
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D3BA(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZPX, 0x00F2, 0xD3BC, 4)   // D3BA
+    S(and, IMM, 0x0008, 0xD3BE, 2)   // D3BC
+    S(bne, REL, 0x0013, 0xD3C0, 2)   // D3BE
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D3C0(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD125, 0xD3C3, 6)   // D3C0
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D3C3(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0007, 0xD3C5, 2)   // D3C3
+    S(bne, REL, 0x0007, 0xD3C7, 2)   // D3C5
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D3C7(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0089, 0xD3C9, 2)   // D3C7
+    S(sta, ZPX, 0x00F2, 0xD3CB, 4)   // D3C9
+    S(jmp, AB_, 0xD3DE, 0xD3CE, 3)   // D3CB
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D3CE(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xD3D0, 2)   // D3CE
+    S(sta, ZPX, 0x00F2, 0xD3D2, 4)   // D3D0
+    S(rts, IMP, 0x0000, 0xD3D3, 6)   // D3D2
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D3D3(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0083, 0xD3D5, 3)   // D3D3
+    S(beq, REL, 0x0032, 0xD3D7, 2)   // D3D5
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D3D7(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD125, 0xD3DA, 6)   // D3D7
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D3DA(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0004, 0xD3DC, 2)   // D3DA
+    S(bcc, REL, 0x0022, 0xD3DE, 2)   // D3DC
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D3DE(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD12F, 0xD3E1, 6)   // D3DE
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D3E1(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZPX, 0x0099, 0xD3E3, 4)   // D3E1
+    S(cmp, ABY, 0x0244, 0xD3E6, 4)   // D3E3
+    S(bne, REL, 0x0004, 0xD3E8, 2)   // D3E6
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D3E8(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xD3EA, 2)   // D3E8
+    S(sta, ZPX, 0x0099, 0xD3EC, 4)   // D3EA
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D3EC(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZPX, 0x0099, 0xD3EE, 6)   // D3EC
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D3EE(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INX, 0x0099, 0xD3F0, 6)   // D3EE
+    S(sta, ABY, 0x023E, 0xD3F3, 5)   // D3F0
+    S(lda, ZPX, 0x0099, 0xD3F5, 4)   // D3F3
+    S(cmp, ABY, 0x0244, 0xD3F8, 4)   // D3F5
+    S(bne, REL, 0x0005, 0xD3FA, 2)   // D3F8
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_D3FA(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0081, 0xD3FC, 2)   // D3FA
+    S(sta, ABY, 0x00F2, 0xD3FF, 5)   // D3FC
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D3FF(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xD400, 6)   // D3FF
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D400(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD156, 0xD403, 6)   // D400
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D403(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xD405, 3)   // D403
+    S(sta, ABX, 0x023E, 0xD408, 5)   // D405
+    S(rts, IMP, 0x0000, 0xD409, 6)   // D408
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D409(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0254, 0xD40C, 4)   // D409
+    S(beq, REL, 0x00F2, 0xD40E, 2)   // D40C
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D40E(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xED67, 0xD411, 6)   // D40E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D411(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xD403, 0xD414, 3)   // D411
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D414(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD4E8, 0xD417, 6)   // D414
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D417(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x00D4, 0xD419, 2)   // D417
+    S(bne, REL, 0x0018, 0xD41B, 2)   // D419
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D41B(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0095, 0xD41D, 3)   // D41B
+    S(cmp, IMM, 0x0002, 0xD41F, 2)   // D41D
+    S(bne, REL, 0x0012, 0xD421, 2)   // D41F
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D421(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x000D, 0xD423, 2)   // D421
+    S(sta, ZP_, 0x0085, 0xD425, 3)   // D423
+    S(jsr, AB_, 0xC123, 0xD428, 6)   // D425
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D428(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xD42A, 2)   // D428
+    S(jsr, AB_, 0xE6C1, 0xD42D, 6)   // D42A
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D42D(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, ZP_, 0x00A5, 0xD42F, 5)   // D42D
+    S(lda, IMM, 0x0080, 0xD431, 2)   // D42F
+    S(bne, REL, 0x0012, 0xD433, 2)   // D431
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D433(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD137, 0xD436, 6)   // D433
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D436(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0085, 0xD438, 3)   // D436
+    S(bne, REL, 0x0009, 0xD43A, 2)   // D438
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D43A(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x00D4, 0xD43C, 2)   // D43A
+    S(jsr, AB_, 0xD4C8, 0xD43F, 6)   // D43C
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D43F(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0002, 0xD441, 2)   // D43F
+    S(sta, ZPX, 0x009A, 0xD443, 4)   // D441
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D443(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0088, 0xD445, 2)   // D443
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D445(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x00F7, 0xD447, 3)   // D445
+    S(lda, ZP_, 0x0085, 0xD449, 3)   // D447
+    S(sta, AB_, 0x0243, 0xD44C, 4)   // D449
+    S(rts, IMP, 0x0000, 0xD44D, 6)   // D44C
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D44D(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF93, 0xD450, 6)   // D44D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D450(cpu *c) {
+    uint32_t cycles = 0;
+    S(asl, ACC, 0x0000, 0xD451, 2)   // D450
+    S(tax, IMP, 0x0000, 0xD452, 2)   // D451
+    S(lda, IMM, 0x0000, 0xD454, 2)   // D452
+    S(sta, ZPX, 0x0099, 0xD456, 4)   // D454
+    S(lda, INX, 0x0099, 0xD458, 6)   // D456
+    S(beq, REL, 0x0005, 0xD45A, 2)   // D458
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_D45A(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, ZPX, 0x0099, 0xD45C, 6)   // D45A
+    S(jmp, AB_, 0xD156, 0xD45F, 3)   // D45C
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D45F(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xD460, 6)   // D45F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D460(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0080, 0xD462, 2)   // D460
+    S(bne, REL, 0x0002, 0xD464, 2)   // D462
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D464(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0090, 0xD466, 2)   // D464
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D466(cpu *c) {
+    uint32_t cycles = 0;
+    S(ora, ZP_, 0x007F, 0xD468, 3)   // D466
+    S(sta, AB_, 0x024D, 0xD46B, 4)   // D468
+    S(lda, ZP_, 0x00F9, 0xD46D, 3)   // D46B
+    S(jsr, AB_, 0xD6D3, 0xD470, 6)   // D46D
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D470(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x00F9, 0xD472, 3)   // D470
+    S(jmp, AB_, 0xD593, 0xD475, 3)   // D472
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D475(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0001, 0xD477, 2)   // D475
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D477(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, AB_, 0x024A, 0xD47A, 4)   // D477
+    S(lda, IMM, 0x0011, 0xD47C, 2)   // D47A
+    S(sta, ZP_, 0x0083, 0xD47E, 3)   // D47C
+    S(jsr, AB_, 0xDC46, 0xD481, 6)   // D47E
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D481(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0002, 0xD483, 2)   // D481
+    S(jmp, AB_, 0xD4C8, 0xD486, 3)   // D483
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D48D(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE3B, 0xD490, 6)   // D48D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D490(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0001, 0xD492, 2)   // D490
+    S(sta, ZP_, 0x006F, 0xD494, 3)   // D492
+    S(lda, ZP_, 0x0069, 0xD496, 3)   // D494
+    S(pha, IMP, 0x0000, 0xD497, 3)   // D496
+    S(lda, IMM, 0x0003, 0xD499, 2)   // D497
+    S(sta, ZP_, 0x0069, 0xD49B, 3)   // D499
+    S(jsr, AB_, 0xF12D, 0xD49E, 6)   // D49B
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_D49E(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xD49F, 4)   // D49E
+    S(sta, ZP_, 0x0069, 0xD4A1, 3)   // D49F
+    S(lda, IMM, 0x0000, 0xD4A3, 2)   // D4A1
+    S(jsr, AB_, 0xD4C8, 0xD4A6, 6)   // D4A3
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D4A6(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0080, 0xD4A8, 3)   // D4A6
+    S(jsr, AB_, 0xCFF1, 0xD4AB, 6)   // D4A8
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D4AB(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0081, 0xD4AD, 3)   // D4AB
+    S(jsr, AB_, 0xCFF1, 0xD4B0, 6)   // D4AD
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D4B0(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD0C7, 0xD4B3, 6)   // D4B0
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D4B3(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD599, 0xD4B6, 6)   // D4B3
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D4B6(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xD4B8, 2)   // D4B6
+    S(jsr, AB_, 0xD4C8, 0xD4BB, 6)   // D4B8
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D4BB(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCFF1, 0xD4BE, 6)   // D4BB
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D4BE(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x00FB, 0xD4C0, 2)   // D4BE
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D4C0(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCFF1, 0xD4C3, 6)   // D4C0
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D4C3(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x00FF, 0xD4C5, 2)   // D4C3
+    S(jmp, AB_, 0xCFF1, 0xD4C8, 3)   // D4C5
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D4C8(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x006F, 0xD4CA, 3)   // D4C8
+    S(jsr, AB_, 0xDF93, 0xD4CD, 6)   // D4CA
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D4CD(cpu *c) {
+    uint32_t cycles = 0;
+    S(asl, ACC, 0x0000, 0xD4CE, 2)   // D4CD
+    S(tax, IMP, 0x0000, 0xD4CF, 2)   // D4CE
+    S(lda, ZPX, 0x009A, 0xD4D1, 4)   // D4CF
+    S(sta, ZP_, 0x0095, 0xD4D3, 3)   // D4D1
+    S(lda, ZP_, 0x006F, 0xD4D5, 3)   // D4D3
+    S(sta, ZPX, 0x0099, 0xD4D7, 4)   // D4D5
+    S(sta, ZP_, 0x0094, 0xD4D9, 3)   // D4D7
+    S(rts, IMP, 0x0000, 0xD4DA, 6)   // D4D9
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_D4DA(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0011, 0xD4DC, 2)   // D4DA
+    S(sta, ZP_, 0x0083, 0xD4DE, 3)   // D4DC
+    S(jsr, AB_, 0xD227, 0xD4E1, 6)   // D4DE
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D4E1(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0012, 0xD4E3, 2)   // D4E1
+    S(sta, ZP_, 0x0083, 0xD4E5, 3)   // D4E3
+    S(jmp, AB_, 0xD227, 0xD4E8, 3)   // D4E5
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D4E8(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF93, 0xD4EB, 6)   // D4E8
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D4EB(cpu *c) {
+    uint32_t cycles = 0;
+    S(asl, ACC, 0x0000, 0xD4EC, 2)   // D4EB
+    S(tax, IMP, 0x0000, 0xD4ED, 2)   // D4EC
+    S(lda, ZPX, 0x009A, 0xD4EF, 4)   // D4ED
+    S(sta, ZP_, 0x0095, 0xD4F1, 3)   // D4EF
+    S(lda, ZPX, 0x0099, 0xD4F3, 4)   // D4F1
+    S(sta, ZP_, 0x0094, 0xD4F5, 3)   // D4F3
+    S(rts, IMP, 0x0000, 0xD4F6, 6)   // D4F5
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_D4F6(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0071, 0xD4F8, 3)   // D4F6
+    S(jsr, AB_, 0xDF93, 0xD4FB, 6)   // D4F8
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D4FB(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xD4FC, 2)   // D4FB
+    S(lda, ABX, 0xFEE0, 0xD4FF, 4)   // D4FC
+    S(sta, ZP_, 0x0072, 0xD501, 3)   // D4FF
+    S(ldy, IMM, 0x0000, 0xD503, 2)   // D501
+    S(lda, INY, 0x0071, 0xD505, 5)   // D503
+    S(rts, IMP, 0x0000, 0xD506, 6)   // D505
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_D506(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABX, 0x025B, 0xD509, 4)   // D506
+    S(and, IMM, 0x0001, 0xD50B, 2)   // D509
+    S(ora, AB_, 0x024D, 0xD50E, 4)   // D50B
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D50E(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xD50F, 3)   // D50E
+    S(stx, ZP_, 0x00F9, 0xD511, 3)   // D50F
+    S(txa, IMP, 0x0000, 0xD512, 2)   // D511
+    S(asl, ACC, 0x0000, 0xD513, 2)   // D512
+    S(tax, IMP, 0x0000, 0xD514, 2)   // D513
+    S(lda, ZPX, 0x0007, 0xD516, 4)   // D514
+    S(sta, AB_, 0x024D, 0xD519, 4)   // D516
+    S(lda, ZPX, 0x0006, 0xD51B, 4)   // D519
+    S(beq, REL, 0x002D, 0xD51D, 2)   // D51B
+    c->executed += 9;
+    return cycles;
+}
+
+static inline uint32_t rom_D51D(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, AB_, 0xFED7, 0xD520, 4)   // D51D
+    S(bcs, REL, 0x0028, 0xD522, 2)   // D520
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D522(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xD523, 2)   // D522
+    S(pla, IMP, 0x0000, 0xD524, 4)   // D523
+    S(pha, IMP, 0x0000, 0xD525, 3)   // D524
+    S(and, IMM, 0x00F0, 0xD527, 2)   // D525
+    S(cmp, IMM, 0x0090, 0xD529, 2)   // D527
+    S(bne, REL, 0x004F, 0xD52B, 2)   // D529
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_D52B(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xD52C, 4)   // D52B
+    S(pha, IMP, 0x0000, 0xD52D, 3)   // D52C
+    S(lsr, ACC, 0x0000, 0xD52E, 2)   // D52D
+    S(bcs, REL, 0x0005, 0xD530, 2)   // D52E
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D530(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0101, 0xD533, 4)   // D530
+    S(bcc, REL, 0x0003, 0xD535, 2)   // D533
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D535(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0102, 0xD538, 4)   // D535
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D538(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x0005, 0xD53A, 2)   // D538
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D53A(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, AB_, 0xFED5, 0xD53D, 4)   // D53A
+    S(bne, REL, 0x0033, 0xD53F, 2)   // D53D
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D53F(cpu *c) {
+    uint32_t cycles = 0;
+    S(txa, IMP, 0x0000, 0xD540, 2)   // D53F
+    S(jsr, AB_, 0xF24B, 0xD543, 6)   // D540
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D543(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, AB_, 0x024D, 0xD546, 4)   // D543
+    S(beq, REL, 0x0002, 0xD548, 2)   // D546
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D548(cpu *c) {
+    uint32_t cycles = 0;
+    S(bcs, REL, 0x0030, 0xD54A, 2)   // D548
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D54A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD552, 0xD54D, 6)   // D54A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D54D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0066, 0xD54F, 2)   // D54D
+    S(jmp, AB_, 0xE645, 0xD552, 3)   // D54F
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D552(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x00F9, 0xD554, 3)   // D552
+    S(asl, ACC, 0x0000, 0xD555, 2)   // D554
+    S(tax, IMP, 0x0000, 0xD556, 2)   // D555
+    S(lda, ZPX, 0x0006, 0xD558, 4)   // D556
+    S(sta, ZP_, 0x0080, 0xD55A, 3)   // D558
+    S(lda, ZPX, 0x0007, 0xD55C, 4)   // D55A
+    S(sta, ZP_, 0x0081, 0xD55E, 3)   // D55C
+    S(rts, IMP, 0x0000, 0xD55F, 6)   // D55E
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_D572(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD552, 0xD575, 6)   // D572
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D575(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0073, 0xD577, 2)   // D575
+    S(jmp, AB_, 0xE645, 0xD57A, 3)   // D577
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D57A(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x00F9, 0xD57C, 3)   // D57A
+    S(pla, IMP, 0x0000, 0xD57D, 4)   // D57C
+    S(sta, AB_, 0x024D, 0xD580, 4)   // D57D
+    S(sta, ZPX, 0x0000, 0xD582, 4)   // D580
+    S(sta, ABX, 0x025B, 0xD585, 5)   // D582
+    S(rts, IMP, 0x0000, 0xD586, 6)   // D585
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_D586(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0080, 0xD588, 2)   // D586
+    S(bne, REL, 0x0002, 0xD58A, 2)   // D588
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D58A(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0090, 0xD58C, 2)   // D58A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D58C(cpu *c) {
+    uint32_t cycles = 0;
+    S(ora, ZP_, 0x007F, 0xD58E, 3)   // D58C
+    S(ldx, ZP_, 0x00F9, 0xD590, 3)   // D58E
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D590(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, AB_, 0x024D, 0xD593, 4)   // D590
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D593(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x024D, 0xD596, 4)   // D593
+    S(jsr, AB_, 0xD50E, 0xD599, 6)   // D596
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D599(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD5A6, 0xD59C, 6)   // D599
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D59C(cpu *c) {
+    uint32_t cycles = 0;
+    S(bcs, REL, 0x00FB, 0xD59E, 2)   // D59C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D59E(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xD59F, 3)   // D59E
+    S(lda, IMM, 0x0000, 0xD5A1, 2)   // D59F
+    S(sta, AB_, 0x0298, 0xD5A4, 4)   // D5A1
+    S(pla, IMP, 0x0000, 0xD5A5, 4)   // D5A4
+    S(rts, IMP, 0x0000, 0xD5A6, 6)   // D5A5
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_D5A6(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZPX, 0x0000, 0xD5A8, 4)   // D5A6
+    S(bmi, REL, 0x001A, 0xD5AA, 2)   // D5A8
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D5AA(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0002, 0xD5AC, 2)   // D5AA
+    S(bcc, REL, 0x0014, 0xD5AE, 2)   // D5AC
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D5AE(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0008, 0xD5B0, 2)   // D5AE
+    S(beq, REL, 0x0008, 0xD5B2, 2)   // D5B0
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D5B2(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x000B, 0xD5B4, 2)   // D5B2
+    S(beq, REL, 0x0004, 0xD5B6, 2)   // D5B4
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D5B6(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x000F, 0xD5B8, 2)   // D5B6
+    S(bne, REL, 0x000C, 0xD5BA, 2)   // D5B8
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D5BA(cpu *c) {
+    uint32_t cycles = 0;
+    S(bit, AB_, 0x0298, 0xD5BD, 4)   // D5BA
+    S(bmi, REL, 0x0003, 0xD5BF, 2)   // D5BD
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D5BF(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xD63F, 0xD5C2, 3)   // D5BF
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D5C2(cpu *c) {
+    uint32_t cycles = 0;
+    S(clc, IMP, 0x0000, 0xD5C3, 2)   // D5C2
+    S(rts, IMP, 0x0000, 0xD5C4, 6)   // D5C3
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D5C4(cpu *c) {
+    uint32_t cycles = 0;
+    S(sec, IMP, 0x0000, 0xD5C5, 2)   // D5C4
+    S(rts, IMP, 0x0000, 0xD5C6, 6)   // D5C5
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D5C6(cpu *c) {
+    uint32_t cycles = 0;
+    S(tya, IMP, 0x0000, 0xD5C7, 2)   // D5C6
+    S(pha, IMP, 0x0000, 0xD5C8, 3)   // D5C7
+    S(lda, ZP_, 0x007F, 0xD5CA, 3)   // D5C8
+    S(pha, IMP, 0x0000, 0xD5CB, 3)   // D5CA
+    S(lda, ABX, 0x025B, 0xD5CE, 4)   // D5CB
+    S(and, IMM, 0x0001, 0xD5D0, 2)   // D5CE
+    S(sta, ZP_, 0x007F, 0xD5D2, 3)   // D5D0
+    S(tay, IMP, 0x0000, 0xD5D3, 2)   // D5D2
+    S(lda, ABY, 0xFECA, 0xD5D6, 4)   // D5D3
+    S(sta, AB_, 0x026D, 0xD5D9, 4)   // D5D6
+    S(jsr, AB_, 0xD6A6, 0xD5DC, 6)   // D5D9
+    c->executed += 11;
+    return cycles;
+}
+
+static inline uint32_t rom_D5DC(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0002, 0xD5DE, 2)   // D5DC
+    S(bcs, REL, 0x0003, 0xD5E0, 2)   // D5DE
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D5E0(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xD66D, 0xD5E3, 3)   // D5E0
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D5E3(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABX, 0x025B, 0xD5E6, 4)   // D5E3
+    S(and, IMM, 0x00F0, 0xD5E8, 2)   // D5E6
+    S(pha, IMP, 0x0000, 0xD5E9, 3)   // D5E8
+    S(cmp, IMM, 0x0090, 0xD5EB, 2)   // D5E9
+    S(bne, REL, 0x0007, 0xD5ED, 2)   // D5EB
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_D5ED(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x007F, 0xD5EF, 3)   // D5ED
+    S(ora, IMM, 0x00B8, 0xD5F1, 2)   // D5EF
+    S(sta, ABX, 0x025B, 0xD5F4, 5)   // D5F1
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D5F4(cpu *c) {
+    uint32_t cycles = 0;
+    S(bit, ZP_, 0x006A, 0xD5F6, 3)   // D5F4
+    S(bvs, REL, 0x0039, 0xD5F8, 2)   // D5F6
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D5F8(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xD5FA, 2)   // D5F8
+    S(sta, AB_, 0x0299, 0xD5FD, 4)   // D5FA
+    S(sta, AB_, 0x029A, 0xD600, 4)   // D5FD
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D600(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, AB_, 0x0299, 0xD603, 4)   // D600
+    S(lda, AB_, 0x029A, 0xD606, 4)   // D603
+    S(sec, IMP, 0x0000, 0xD607, 2)   // D606
+    S(sbc, ABY, 0xFEDB, 0xD60A, 4)   // D607
+    S(sta, AB_, 0x029A, 0xD60D, 4)   // D60A
+    S(lda, ABY, 0xFEDB, 0xD610, 4)   // D60D
+    S(jsr, AB_, 0xD676, 0xD613, 6)   // D610
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_D613(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, AB_, 0x0299, 0xD616, 6)   // D613
+    S(jsr, AB_, 0xD6A6, 0xD619, 6)   // D616
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D619(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0002, 0xD61B, 2)   // D619
+    S(bcc, REL, 0x0008, 0xD61D, 2)   // D61B
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D61D(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, AB_, 0x0299, 0xD620, 4)   // D61D
+    S(lda, ABY, 0xFEDB, 0xD623, 4)   // D620
+    S(bne, REL, 0x00DB, 0xD625, 2)   // D623
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D625(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x029A, 0xD628, 4)   // D625
+    S(jsr, AB_, 0xD676, 0xD62B, 6)   // D628
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D62B(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZPX, 0x0000, 0xD62D, 4)   // D62B
+    S(cmp, IMM, 0x0002, 0xD62F, 2)   // D62D
+    S(bcc, REL, 0x002B, 0xD631, 2)   // D62F
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D631(cpu *c) {
+    uint32_t cycles = 0;
+    S(bit, ZP_, 0x006A, 0xD633, 3)   // D631
+    S(bpl, REL, 0x000F, 0xD635, 2)   // D633
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D635(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xD636, 4)   // D635
+    S(cmp, IMM, 0x0090, 0xD638, 2)   // D636
+    S(bne, REL, 0x0005, 0xD63A, 2)   // D638
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D63A(cpu *c) {
+    uint32_t cycles = 0;
+    S(ora, ZP_, 0x007F, 0xD63C, 3)   // D63A
+    S(sta, ABX, 0x025B, 0xD63F, 5)   // D63C
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D63F(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZPX, 0x0000, 0xD641, 4)   // D63F
+    S(jsr, AB_, 0xE60A, 0xD644, 6)   // D641
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D644(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xD645, 4)   // D644
+    S(bit, AB_, 0x0298, 0xD648, 4)   // D645
+    S(bmi, REL, 0x0023, 0xD64A, 2)   // D648
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D64A(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xD64B, 3)   // D64A
+    S(lda, IMM, 0x00C0, 0xD64D, 2)   // D64B
+    S(ora, ZP_, 0x007F, 0xD64F, 3)   // D64D
+    S(sta, ZPX, 0x0000, 0xD651, 4)   // D64F
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D651(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZPX, 0x0000, 0xD653, 4)   // D651
+    S(bmi, REL, 0x00FC, 0xD655, 2)   // D653
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D655(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD6A6, 0xD658, 6)   // D655
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D658(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0002, 0xD65A, 2)   // D658
+    S(bcs, REL, 0x00D9, 0xD65C, 2)   // D65A
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D65C(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xD65D, 4)   // D65C
+    S(cmp, IMM, 0x0090, 0xD65F, 2)   // D65D
+    S(bne, REL, 0x000C, 0xD661, 2)   // D65F
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D661(cpu *c) {
+    uint32_t cycles = 0;
+    S(ora, ZP_, 0x007F, 0xD663, 3)   // D661
+    S(sta, ABX, 0x025B, 0xD666, 5)   // D663
+    S(jsr, AB_, 0xD6A6, 0xD669, 6)   // D666
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D669(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0002, 0xD66B, 2)   // D669
+    S(bcs, REL, 0x00D2, 0xD66D, 2)   // D66B
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D66D(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xD66E, 4)   // D66D
+    S(sta, ZP_, 0x007F, 0xD670, 3)   // D66E
+    S(pla, IMP, 0x0000, 0xD671, 4)   // D670
+    S(tay, IMP, 0x0000, 0xD672, 2)   // D671
+    S(lda, ZPX, 0x0000, 0xD674, 4)   // D672
+    S(clc, IMP, 0x0000, 0xD675, 2)   // D674
+    S(rts, IMP, 0x0000, 0xD676, 6)   // D675
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_D676(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0000, 0xD678, 2)   // D676
+    S(beq, REL, 0x0018, 0xD67A, 2)   // D678
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D67A(cpu *c) {
+    uint32_t cycles = 0;
+    S(bmi, REL, 0x000C, 0xD67C, 2)   // D67A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D67C(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0001, 0xD67E, 2)   // D67C
+    S(jsr, AB_, 0xD693, 0xD681, 6)   // D67E
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D681(cpu *c) {
+    uint32_t cycles = 0;
+    S(sec, IMP, 0x0000, 0xD682, 2)   // D681
+    S(sbc, IMM, 0x0001, 0xD684, 2)   // D682
+    S(bne, REL, 0x00F6, 0xD686, 2)   // D684
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D686(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x000A, 0xD688, 2)   // D686
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D688(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x00FF, 0xD68A, 2)   // D688
+    S(jsr, AB_, 0xD693, 0xD68D, 6)   // D68A
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D68D(cpu *c) {
+    uint32_t cycles = 0;
+    S(clc, IMP, 0x0000, 0xD68E, 2)   // D68D
+    S(adc, IMM, 0x0001, 0xD690, 2)   // D68E
+    S(bne, REL, 0x00F6, 0xD692, 2)   // D690
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D692(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xD693, 6)   // D692
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D693(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xD694, 3)   // D693
+    S(tya, IMP, 0x0000, 0xD695, 2)   // D694
+    S(ldy, ZP_, 0x007F, 0xD697, 3)   // D695
+    S(sta, ABY, 0x02FE, 0xD69A, 5)   // D697
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D69A(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, ABY, 0x02FE, 0xD69D, 4)   // D69A
+    S(beq, REL, 0x00FB, 0xD69F, 2)   // D69D
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D69F(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xD6A1, 2)   // D69F
+    S(sta, ABY, 0x02FE, 0xD6A4, 5)   // D6A1
+    S(pla, IMP, 0x0000, 0xD6A5, 4)   // D6A4
+    S(rts, IMP, 0x0000, 0xD6A6, 6)   // D6A5
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D6A6(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x006A, 0xD6A8, 3)   // D6A6
+    S(and, IMM, 0x003F, 0xD6AA, 2)   // D6A8
+    S(tay, IMP, 0x0000, 0xD6AB, 2)   // D6AA
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D6AB(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x026D, 0xD6AE, 4)   // D6AB
+    S(eor, AB_, 0x1C00, 0xD6B1, 4)   // D6AE
+    S(sta, AB_, 0x1C00, 0xD6B4, 4)   // D6B1
+    S(lda, ABX, 0x025B, 0xD6B7, 4)   // D6B4
+    S(sta, ZPX, 0x0000, 0xD6B9, 4)   // D6B7
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_D6B9(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZPX, 0x0000, 0xD6BB, 4)   // D6B9
+    S(bmi, REL, 0x00FC, 0xD6BD, 2)   // D6BB
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D6BD(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0002, 0xD6BF, 2)   // D6BD
+    S(bcc, REL, 0x0003, 0xD6C1, 2)   // D6BF
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D6C1(cpu *c) {
+    uint32_t cycles = 0;
+    S(dey, IMP, 0x0000, 0xD6C2, 2)   // D6C1
+    S(bne, REL, 0x00E7, 0xD6C4, 2)   // D6C2
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D6C4(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xD6C5, 3)   // D6C4
+    S(lda, AB_, 0x026D, 0xD6C8, 4)   // D6C5
+    S(ora, AB_, 0x1C00, 0xD6CB, 4)   // D6C8
+    S(sta, AB_, 0x1C00, 0xD6CE, 4)   // D6CB
+    S(pla, IMP, 0x0000, 0xD6CF, 4)   // D6CE
+    S(rts, IMP, 0x0000, 0xD6D0, 6)   // D6CF
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_D6D0(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF93, 0xD6D3, 6)   // D6D0
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D6D3(cpu *c) {
+    uint32_t cycles = 0;
+    S(asl, ACC, 0x0000, 0xD6D4, 2)   // D6D3
+    S(tay, IMP, 0x0000, 0xD6D5, 2)   // D6D4
+    S(lda, ZP_, 0x0080, 0xD6D7, 3)   // D6D5
+    S(sta, ABY, 0x0006, 0xD6DA, 5)   // D6D7
+    S(lda, ZP_, 0x0081, 0xD6DC, 3)   // D6DA
+    S(sta, ABY, 0x0007, 0xD6DF, 5)   // D6DC
+    S(lda, ZP_, 0x007F, 0xD6E1, 3)   // D6DF
+    S(asl, ACC, 0x0000, 0xD6E2, 2)   // D6E1
+    S(tax, IMP, 0x0000, 0xD6E3, 2)   // D6E2
+    S(rts, IMP, 0x0000, 0xD6E4, 6)   // D6E3
+    c->executed += 10;
+    return cycles;
+}
+
+static inline uint32_t rom_D6E4(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0083, 0xD6E6, 3)   // D6E4
+    S(pha, IMP, 0x0000, 0xD6E7, 3)   // D6E6
+    S(lda, ZP_, 0x0082, 0xD6E9, 3)   // D6E7
+    S(pha, IMP, 0x0000, 0xD6EA, 3)   // D6E9
+    S(lda, ZP_, 0x0081, 0xD6EC, 3)   // D6EA
+    S(pha, IMP, 0x0000, 0xD6ED, 3)   // D6EC
+    S(lda, ZP_, 0x0080, 0xD6EF, 3)   // D6ED
+    S(pha, IMP, 0x0000, 0xD6F0, 3)   // D6EF
+    S(lda, IMM, 0x0011, 0xD6F2, 2)   // D6F0
+    S(sta, ZP_, 0x0083, 0xD6F4, 3)   // D6F2
+    S(jsr, AB_, 0xDE3B, 0xD6F7, 6)   // D6F4
+    c->executed += 11;
+    return cycles;
+}
+
+static inline uint32_t rom_D6F7(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x024A, 0xD6FA, 4)   // D6F7
+    S(pha, IMP, 0x0000, 0xD6FB, 3)   // D6FA
+    S(lda, ZP_, 0x00E2, 0xD6FD, 3)   // D6FB
+    S(and, IMM, 0x0001, 0xD6FF, 2)   // D6FD
+    S(sta, ZP_, 0x007F, 0xD701, 3)   // D6FF
+    S(ldx, ZP_, 0x00F9, 0xD703, 3)   // D701
+    S(eor, ABX, 0x025B, 0xD706, 4)   // D703
+    S(lsr, ACC, 0x0000, 0xD707, 2)   // D706
+    S(bcc, REL, 0x000C, 0xD709, 2)   // D707
+    c->executed += 9;
+    return cycles;
+}
+
+static inline uint32_t rom_D709(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, IMM, 0x0001, 0xD70B, 2)   // D709
+    S(stx, AB_, 0x0292, 0xD70E, 4)   // D70B
+    S(jsr, AB_, 0xC5AC, 0xD711, 6)   // D70E
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D711(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x001D, 0xD713, 2)   // D711
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D713(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x0028, 0xD715, 2)   // D713
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D715(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0291, 0xD718, 4)   // D715
+    S(beq, REL, 0x000C, 0xD71A, 2)   // D718
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D71A(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, ZP_, 0x0081, 0xD71C, 3)   // D71A
+    S(beq, REL, 0x001F, 0xD71E, 2)   // D71C
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D71E(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0081, 0xD720, 3)   // D71E
+    S(jsr, AB_, 0xD460, 0xD723, 6)   // D720
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D723(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xD73D, 0xD726, 3)   // D723
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D726(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0001, 0xD728, 2)   // D726
+    S(sta, AB_, 0x0292, 0xD72B, 4)   // D728
+    S(jsr, AB_, 0xC617, 0xD72E, 6)   // D72B
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D72E(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x000D, 0xD730, 2)   // D72E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D730(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD48D, 0xD733, 6)   // D730
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D733(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0081, 0xD735, 3)   // D733
+    S(sta, AB_, 0x0291, 0xD738, 4)   // D735
+    S(lda, IMM, 0x0002, 0xD73A, 2)   // D738
+    S(sta, AB_, 0x0292, 0xD73D, 4)   // D73A
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D73D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0292, 0xD740, 4)   // D73D
+    S(jsr, AB_, 0xD4C8, 0xD743, 6)   // D740
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D743(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xD744, 4)   // D743
+    S(sta, AB_, 0x024A, 0xD747, 4)   // D744
+    S(cmp, IMM, 0x0004, 0xD749, 2)   // D747
+    S(bne, REL, 0x0002, 0xD74B, 2)   // D749
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D74B(cpu *c) {
+    uint32_t cycles = 0;
+    S(ora, IMM, 0x0080, 0xD74D, 2)   // D74B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D74D(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCFF1, 0xD750, 6)   // D74D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D750(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xD751, 4)   // D750
+    S(sta, AB_, 0x0280, 0xD754, 4)   // D751
+    S(jsr, AB_, 0xCFF1, 0xD757, 6)   // D754
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D757(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xD758, 4)   // D757
+    S(sta, AB_, 0x0285, 0xD75B, 4)   // D758
+    S(jsr, AB_, 0xCFF1, 0xD75E, 6)   // D75B
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D75E(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF93, 0xD761, 6)   // D75E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D761(cpu *c) {
+    uint32_t cycles = 0;
+    S(tay, IMP, 0x0000, 0xD762, 2)   // D761
+    S(lda, AB_, 0x027A, 0xD765, 4)   // D762
+    S(tax, IMP, 0x0000, 0xD766, 2)   // D765
+    S(lda, IMM, 0x0010, 0xD768, 2)   // D766
+    S(jsr, AB_, 0xC66E, 0xD76B, 6)   // D768
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_D76B(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0010, 0xD76D, 2)   // D76B
+    S(lda, IMM, 0x0000, 0xD76F, 2)   // D76D
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D76F(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, INY, 0x0094, 0xD771, 6)   // D76F
+    S(iny, IMP, 0x0000, 0xD772, 2)   // D771
+    S(cpy, IMM, 0x001B, 0xD774, 2)   // D772
+    S(bcc, REL, 0x00F9, 0xD776, 2)   // D774
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D776(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x024A, 0xD779, 4)   // D776
+    S(cmp, IMM, 0x0004, 0xD77B, 2)   // D779
+    S(bne, REL, 0x0013, 0xD77D, 2)   // D77B
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D77D(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0010, 0xD77F, 2)   // D77D
+    S(lda, AB_, 0x0259, 0xD782, 4)   // D77F
+    S(sta, INY, 0x0094, 0xD784, 6)   // D782
+    S(iny, IMP, 0x0000, 0xD785, 2)   // D784
+    S(lda, AB_, 0x025A, 0xD788, 4)   // D785
+    S(sta, INY, 0x0094, 0xD78A, 6)   // D788
+    S(iny, IMP, 0x0000, 0xD78B, 2)   // D78A
+    S(lda, AB_, 0x0258, 0xD78E, 4)   // D78B
+    S(sta, INY, 0x0094, 0xD790, 6)   // D78E
+    c->executed += 9;
+    return cycles;
+}
+
+static inline uint32_t rom_D790(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD464, 0xD793, 6)   // D790
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D793(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xD794, 4)   // D793
+    S(sta, ZP_, 0x0082, 0xD796, 3)   // D794
+    S(tax, IMP, 0x0000, 0xD797, 2)   // D796
+    S(pla, IMP, 0x0000, 0xD798, 4)   // D797
+    S(sta, ZP_, 0x0083, 0xD79A, 3)   // D798
+    S(lda, AB_, 0x0291, 0xD79D, 4)   // D79A
+    S(sta, ZP_, 0x00D8, 0xD79F, 3)   // D79D
+    S(sta, ABX, 0x0260, 0xD7A2, 5)   // D79F
+    S(lda, AB_, 0x0292, 0xD7A5, 4)   // D7A2
+    S(sta, ZP_, 0x00DD, 0xD7A7, 3)   // D7A5
+    S(sta, ABX, 0x0266, 0xD7AA, 5)   // D7A7
+    S(lda, AB_, 0x024A, 0xD7AD, 4)   // D7AA
+    S(sta, ZP_, 0x00E7, 0xD7AF, 3)   // D7AD
+    S(lda, ZP_, 0x007F, 0xD7B1, 3)   // D7AF
+    S(sta, ZP_, 0x00E2, 0xD7B3, 3)   // D7B1
+    S(rts, IMP, 0x0000, 0xD7B4, 6)   // D7B3
+    c->executed += 16;
+    return cycles;
+}
+
+static inline uint32_t rom_D7B4(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0083, 0xD7B6, 3)   // D7B4
+    S(sta, AB_, 0x024C, 0xD7B9, 4)   // D7B6
+    S(jsr, AB_, 0xC2B3, 0xD7BC, 6)   // D7B9
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D7BC(cpu *c) {
+    uint32_t cycles = 0;
+    S(stx, AB_, 0x022A, 0xD7BF, 4)   // D7BC
+    S(ldx, AB_, 0x0200, 0xD7C2, 4)   // D7BF
+    S(lda, AB_, 0x024C, 0xD7C5, 4)   // D7C2
+    S(bne, REL, 0x002C, 0xD7C7, 2)   // D7C5
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D7C7(cpu *c) {
+    uint32_t cycles = 0;
+    S(cpx, IMM, 0x002A, 0xD7C9, 2)   // D7C7
+    S(bne, REL, 0x0028, 0xD7CB, 2)   // D7C9
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D7CB(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x007E, 0xD7CD, 3)   // D7CB
+    S(beq, REL, 0x004D, 0xD7CF, 2)   // D7CD
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D7CF(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0080, 0xD7D1, 3)   // D7CF
+    S(lda, AB_, 0x026E, 0xD7D4, 4)   // D7D1
+    S(sta, ZP_, 0x007F, 0xD7D6, 3)   // D7D4
+    S(sta, ZP_, 0x00E2, 0xD7D8, 3)   // D7D6
+    S(lda, IMM, 0x0002, 0xD7DA, 2)   // D7D8
+    S(sta, ZP_, 0x00E7, 0xD7DC, 3)   // D7DA
+    S(lda, AB_, 0x026F, 0xD7DF, 4)   // D7DC
+    S(sta, ZP_, 0x0081, 0xD7E1, 3)   // D7DF
+    S(jsr, AB_, 0xC100, 0xD7E4, 6)   // D7E1
+    c->executed += 9;
+    return cycles;
+}
+
+static inline uint32_t rom_D7E4(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDC46, 0xD7E7, 6)   // D7E4
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D7E7(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0004, 0xD7E9, 2)   // D7E7
+    S(ora, ZP_, 0x007F, 0xD7EB, 3)   // D7E9
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D7EB(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xD7ED, 3)   // D7EB
+    S(sta, ABY, 0x00EC, 0xD7F0, 5)   // D7ED
+    S(jmp, AB_, 0xC194, 0xD7F3, 3)   // D7F0
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D7F3(cpu *c) {
+    uint32_t cycles = 0;
+    S(cpx, IMM, 0x0024, 0xD7F5, 2)   // D7F3
+    S(bne, REL, 0x001E, 0xD7F7, 2)   // D7F5
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D7F7(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x024C, 0xD7FA, 4)   // D7F7
+    S(bne, REL, 0x0003, 0xD7FC, 2)   // D7FA
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D7FC(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xDA55, 0xD7FF, 3)   // D7FC
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D7FF(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC1D1, 0xD802, 6)   // D7FF
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D802(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0xFE85, 0xD805, 4)   // D802
+    S(sta, ZP_, 0x0080, 0xD807, 3)   // D805
+    S(lda, IMM, 0x0000, 0xD809, 2)   // D807
+    S(sta, ZP_, 0x0081, 0xD80B, 3)   // D809
+    S(jsr, AB_, 0xDC46, 0xD80E, 6)   // D80B
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_D80E(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x007F, 0xD810, 3)   // D80E
+    S(ora, IMM, 0x0002, 0xD812, 2)   // D810
+    S(jmp, AB_, 0xD7EB, 0xD815, 3)   // D812
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D815(cpu *c) {
+    uint32_t cycles = 0;
+    S(cpx, IMM, 0x0023, 0xD817, 2)   // D815
+    S(bne, REL, 0x0012, 0xD819, 2)   // D817
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D819(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xCB84, 0xD81C, 3)   // D819
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D81C(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0002, 0xD81E, 2)   // D81C
+    S(sta, AB_, 0x0296, 0xD821, 4)   // D81E
+    S(lda, IMM, 0x0000, 0xD823, 2)   // D821
+    S(sta, ZP_, 0x007F, 0xD825, 3)   // D823
+    S(sta, AB_, 0x028E, 0xD828, 4)   // D825
+    S(jsr, AB_, 0xD042, 0xD82B, 6)   // D828
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_D82B(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC1E5, 0xD82E, 6)   // D82B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D82E(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x0004, 0xD830, 2)   // D82E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D830(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, IMM, 0x0000, 0xD832, 2)   // D830
+    S(beq, REL, 0x000C, 0xD834, 2)   // D832
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D834(cpu *c) {
+    uint32_t cycles = 0;
+    S(txa, IMP, 0x0000, 0xD835, 2)   // D834
+    S(beq, REL, 0x0005, 0xD837, 2)   // D835
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D837(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0030, 0xD839, 2)   // D837
+    S(jmp, AB_, 0xC1C8, 0xD83C, 3)   // D839
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D83C(cpu *c) {
+    uint32_t cycles = 0;
+    S(dey, IMP, 0x0000, 0xD83D, 2)   // D83C
+    S(beq, REL, 0x0001, 0xD83F, 2)   // D83D
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D83F(cpu *c) {
+    uint32_t cycles = 0;
+    S(dey, IMP, 0x0000, 0xD840, 2)   // D83F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D840(cpu *c) {
+    uint32_t cycles = 0;
+    S(sty, AB_, 0x027A, 0xD843, 4)   // D840
+    S(lda, IMM, 0x008D, 0xD845, 2)   // D843
+    S(jsr, AB_, 0xC268, 0xD848, 6)   // D845
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D848(cpu *c) {
+    uint32_t cycles = 0;
+    S(inx, IMP, 0x0000, 0xD849, 2)   // D848
+    S(stx, AB_, 0x0278, 0xD84C, 4)   // D849
+    S(jsr, AB_, 0xC312, 0xD84F, 6)   // D84C
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D84F(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC3CA, 0xD852, 6)   // D84F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D852(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC49D, 0xD855, 6)   // D852
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D855(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, IMM, 0x0000, 0xD857, 2)   // D855
+    S(stx, AB_, 0x0258, 0xD85A, 4)   // D857
+    S(stx, AB_, 0x0297, 0xD85D, 4)   // D85A
+    S(stx, AB_, 0x024A, 0xD860, 4)   // D85D
+    S(inx, IMP, 0x0000, 0xD861, 2)   // D860
+    S(cpx, AB_, 0x0277, 0xD864, 4)   // D861
+    S(bcs, REL, 0x0010, 0xD866, 2)   // D864
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_D866(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDA09, 0xD869, 6)   // D866
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D869(cpu *c) {
+    uint32_t cycles = 0;
+    S(inx, IMP, 0x0000, 0xD86A, 2)   // D869
+    S(cpx, AB_, 0x0277, 0xD86D, 4)   // D86A
+    S(bcs, REL, 0x0007, 0xD86F, 2)   // D86D
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D86F(cpu *c) {
+    uint32_t cycles = 0;
+    S(cpy, IMM, 0x0004, 0xD871, 2)   // D86F
+    S(beq, REL, 0x003E, 0xD873, 2)   // D871
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D873(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDA09, 0xD876, 6)   // D873
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D876(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, AB_, 0x024C, 0xD879, 4)   // D876
+    S(stx, ZP_, 0x0083, 0xD87B, 3)   // D879
+    S(cpx, IMM, 0x0002, 0xD87D, 2)   // D87B
+    S(bcs, REL, 0x0012, 0xD87F, 2)   // D87D
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D87F(cpu *c) {
+    uint32_t cycles = 0;
+    S(stx, AB_, 0x0297, 0xD882, 4)   // D87F
+    S(lda, IMM, 0x0040, 0xD884, 2)   // D882
+    S(sta, AB_, 0x02F9, 0xD887, 4)   // D884
+    S(lda, AB_, 0x024A, 0xD88A, 4)   // D887
+    S(bne, REL, 0x001B, 0xD88C, 2)   // D88A
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_D88C(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0002, 0xD88E, 2)   // D88C
+    S(sta, AB_, 0x024A, 0xD891, 4)   // D88E
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D891(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x024A, 0xD894, 4)   // D891
+    S(bne, REL, 0x0011, 0xD896, 2)   // D894
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D896(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x00E7, 0xD898, 3)   // D896
+    S(and, IMM, 0x0007, 0xD89A, 2)   // D898
+    S(sta, AB_, 0x024A, 0xD89D, 4)   // D89A
+    S(lda, AB_, 0x0280, 0xD8A0, 4)   // D89D
+    S(bne, REL, 0x0005, 0xD8A2, 2)   // D8A0
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_D8A2(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0001, 0xD8A4, 2)   // D8A2
+    S(sta, AB_, 0x024A, 0xD8A7, 4)   // D8A4
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D8A7(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0297, 0xD8AA, 4)   // D8A7
+    S(cmp, IMM, 0x0001, 0xD8AC, 2)   // D8AA
+    S(beq, REL, 0x0018, 0xD8AE, 2)   // D8AC
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D8AE(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xD940, 0xD8B1, 3)   // D8AE
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D8B1(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, ABX, 0x027A, 0xD8B4, 4)   // D8B1
+    S(lda, ABY, 0x0200, 0xD8B7, 4)   // D8B4
+    S(sta, AB_, 0x0258, 0xD8BA, 4)   // D8B7
+    S(lda, AB_, 0x0280, 0xD8BD, 4)   // D8BA
+    S(bne, REL, 0x00B7, 0xD8BF, 2)   // D8BD
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_D8BF(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0001, 0xD8C1, 2)   // D8BF
+    S(sta, AB_, 0x0297, 0xD8C4, 4)   // D8C1
+    S(bne, REL, 0x00B0, 0xD8C6, 2)   // D8C4
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D8C6(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x00E7, 0xD8C8, 3)   // D8C6
+    S(and, IMM, 0x0080, 0xD8CA, 2)   // D8C8
+    S(tax, IMP, 0x0000, 0xD8CB, 2)   // D8CA
+    S(bne, REL, 0x0014, 0xD8CD, 2)   // D8CB
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D8CD(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0020, 0xD8CF, 2)   // D8CD
+    S(bit, ZP_, 0x00E7, 0xD8D1, 3)   // D8CF
+    S(beq, REL, 0x0006, 0xD8D3, 2)   // D8D1
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D8D3(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC8B6, 0xD8D6, 6)   // D8D3
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D8D6(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xD9E3, 0xD8D9, 3)   // D8D6
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D8D9(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0280, 0xD8DC, 4)   // D8D9
+    S(bne, REL, 0x0003, 0xD8DE, 2)   // D8DC
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D8DE(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xD9E3, 0xD8E1, 3)   // D8DE
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D8E1(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0200, 0xD8E4, 4)   // D8E1
+    S(cmp, IMM, 0x0040, 0xD8E6, 2)   // D8E4
+    S(beq, REL, 0x000D, 0xD8E8, 2)   // D8E6
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D8E8(cpu *c) {
+    uint32_t cycles = 0;
+    S(txa, IMP, 0x0000, 0xD8E9, 2)   // D8E8
+    S(bne, REL, 0x0005, 0xD8EB, 2)   // D8E9
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D8EB(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0063, 0xD8ED, 2)   // D8EB
+    S(jmp, AB_, 0xC1C8, 0xD8F0, 3)   // D8ED
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D8F0(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0033, 0xD8F2, 2)   // D8F0
+    S(jmp, AB_, 0xC1C8, 0xD8F5, 3)   // D8F2
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D8F5(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x00E7, 0xD8F7, 3)   // D8F5
+    S(and, IMM, 0x0007, 0xD8F9, 2)   // D8F7
+    S(cmp, AB_, 0x024A, 0xD8FC, 4)   // D8F9
+    S(bne, REL, 0x0067, 0xD8FE, 2)   // D8FC
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D8FE(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0004, 0xD900, 2)   // D8FE
+    S(beq, REL, 0x0063, 0xD902, 2)   // D900
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D902(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDCDA, 0xD905, 6)   // D902
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D905(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0082, 0xD907, 3)   // D905
+    S(sta, AB_, 0x0270, 0xD90A, 4)   // D907
+    S(lda, IMM, 0x0011, 0xD90C, 2)   // D90A
+    S(sta, ZP_, 0x0083, 0xD90E, 3)   // D90C
+    S(jsr, AB_, 0xD0EB, 0xD911, 6)   // D90E
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_D911(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0294, 0xD914, 4)   // D911
+    S(jsr, AB_, 0xD4C8, 0xD917, 6)   // D914
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D917(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0000, 0xD919, 2)   // D917
+    S(lda, INY, 0x0094, 0xD91B, 5)   // D919
+    S(ora, IMM, 0x0020, 0xD91D, 2)   // D91B
+    S(sta, INY, 0x0094, 0xD91F, 6)   // D91D
+    S(ldy, IMM, 0x001A, 0xD921, 2)   // D91F
+    S(lda, ZP_, 0x0080, 0xD923, 3)   // D921
+    S(sta, INY, 0x0094, 0xD925, 6)   // D923
+    S(iny, IMP, 0x0000, 0xD926, 2)   // D925
+    S(lda, ZP_, 0x0081, 0xD928, 3)   // D926
+    S(sta, INY, 0x0094, 0xD92A, 6)   // D928
+    S(ldx, AB_, 0x0270, 0xD92D, 4)   // D92A
+    S(lda, ZP_, 0x00D8, 0xD92F, 3)   // D92D
+    S(sta, ABX, 0x0260, 0xD932, 5)   // D92F
+    S(lda, ZP_, 0x00DD, 0xD934, 3)   // D932
+    S(sta, ABX, 0x0266, 0xD937, 5)   // D934
+    S(jsr, AB_, 0xDE3B, 0xD93A, 6)   // D937
+    c->executed += 16;
+    return cycles;
+}
+
+static inline uint32_t rom_D93A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD464, 0xD93D, 6)   // D93A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D93D(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xD9EF, 0xD940, 3)   // D93D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D940(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0280, 0xD943, 4)   // D940
+    S(bne, REL, 0x0005, 0xD945, 2)   // D943
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D945(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0062, 0xD947, 2)   // D945
+    S(jmp, AB_, 0xC1C8, 0xD94A, 3)   // D947
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D94A(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0297, 0xD94D, 4)   // D94A
+    S(cmp, IMM, 0x0003, 0xD94F, 2)   // D94D
+    S(beq, REL, 0x000B, 0xD951, 2)   // D94F
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D951(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0020, 0xD953, 2)   // D951
+    S(bit, ZP_, 0x00E7, 0xD955, 3)   // D953
+    S(beq, REL, 0x0005, 0xD957, 2)   // D955
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D957(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0060, 0xD959, 2)   // D957
+    S(jmp, AB_, 0xC1C8, 0xD95C, 3)   // D959
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D95C(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x00E7, 0xD95E, 3)   // D95C
+    S(and, IMM, 0x0007, 0xD960, 2)   // D95E
+    S(cmp, AB_, 0x024A, 0xD963, 4)   // D960
+    S(beq, REL, 0x0005, 0xD965, 2)   // D963
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D965(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0064, 0xD967, 2)   // D965
+    S(jmp, AB_, 0xC1C8, 0xD96A, 3)   // D967
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D96A(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0000, 0xD96C, 2)   // D96A
+    S(sty, AB_, 0x0279, 0xD96F, 4)   // D96C
+    S(ldx, AB_, 0x0297, 0xD972, 4)   // D96F
+    S(cpx, IMM, 0x0002, 0xD974, 2)   // D972
+    S(bne, REL, 0x001A, 0xD976, 2)   // D974
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_D976(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0004, 0xD978, 2)   // D976
+    S(beq, REL, 0x00EB, 0xD97A, 2)   // D978
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D97A(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x0094, 0xD97C, 5)   // D97A
+    S(and, IMM, 0x004F, 0xD97E, 2)   // D97C
+    S(sta, INY, 0x0094, 0xD980, 6)   // D97E
+    S(lda, ZP_, 0x0083, 0xD982, 3)   // D980
+    S(pha, IMP, 0x0000, 0xD983, 3)   // D982
+    S(lda, IMM, 0x0011, 0xD985, 2)   // D983
+    S(sta, ZP_, 0x0083, 0xD987, 3)   // D985
+    S(jsr, AB_, 0xDE3B, 0xD98A, 6)   // D987
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_D98A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD464, 0xD98D, 6)   // D98A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D98D(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xD98E, 4)   // D98D
+    S(sta, ZP_, 0x0083, 0xD990, 3)   // D98E
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D990(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD9A0, 0xD993, 6)   // D990
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D993(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0297, 0xD996, 4)   // D993
+    S(cmp, IMM, 0x0002, 0xD998, 2)   // D996
+    S(bne, REL, 0x0055, 0xD99A, 2)   // D998
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D99A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDA2A, 0xD99D, 6)   // D99A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D99D(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xC194, 0xD9A0, 3)   // D99D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D9A0(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0013, 0xD9A2, 2)   // D9A0
+    S(lda, INY, 0x0094, 0xD9A4, 5)   // D9A2
+    S(sta, AB_, 0x0259, 0xD9A7, 4)   // D9A4
+    S(iny, IMP, 0x0000, 0xD9A8, 2)   // D9A7
+    S(lda, INY, 0x0094, 0xD9AA, 5)   // D9A8
+    S(sta, AB_, 0x025A, 0xD9AD, 4)   // D9AA
+    S(iny, IMP, 0x0000, 0xD9AE, 2)   // D9AD
+    S(lda, INY, 0x0094, 0xD9B0, 5)   // D9AE
+    S(ldx, AB_, 0x0258, 0xD9B3, 4)   // D9B0
+    S(sta, AB_, 0x0258, 0xD9B6, 4)   // D9B3
+    S(txa, IMP, 0x0000, 0xD9B7, 2)   // D9B6
+    S(beq, REL, 0x000A, 0xD9B9, 2)   // D9B7
+    c->executed += 12;
+    return cycles;
+}
+
+static inline uint32_t rom_D9B9(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, AB_, 0x0258, 0xD9BC, 4)   // D9B9
+    S(beq, REL, 0x0005, 0xD9BE, 2)   // D9BC
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D9BE(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0050, 0xD9C0, 2)   // D9BE
+    S(jsr, AB_, 0xC1C8, 0xD9C3, 6)   // D9C0
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_D9C3(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, AB_, 0x0279, 0xD9C6, 4)   // D9C3
+    S(lda, ABX, 0x0280, 0xD9C9, 4)   // D9C6
+    S(sta, ZP_, 0x0080, 0xD9CB, 3)   // D9C9
+    S(lda, ABX, 0x0285, 0xD9CE, 4)   // D9CB
+    S(sta, ZP_, 0x0081, 0xD9D0, 3)   // D9CE
+    S(jsr, AB_, 0xDC46, 0xD9D3, 6)   // D9D0
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_D9D3(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, ZP_, 0x0082, 0xD9D5, 3)   // D9D3
+    S(ldx, AB_, 0x0279, 0xD9D8, 4)   // D9D5
+    S(lda, ZPX, 0x00D8, 0xD9DA, 4)   // D9D8
+    S(sta, ABY, 0x0260, 0xD9DD, 5)   // D9DA
+    S(lda, ZPX, 0x00DD, 0xD9DF, 4)   // D9DD
+    S(sta, ABY, 0x0266, 0xD9E2, 5)   // D9DF
+    S(rts, IMP, 0x0000, 0xD9E3, 6)   // D9E2
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_D9E3(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x00E2, 0xD9E5, 3)   // D9E3
+    S(and, IMM, 0x0001, 0xD9E7, 2)   // D9E5
+    S(sta, ZP_, 0x007F, 0xD9E9, 3)   // D9E7
+    S(jsr, AB_, 0xDCDA, 0xD9EC, 6)   // D9E9
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_D9EC(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD6E4, 0xD9EF, 6)   // D9EC
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D9EF(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0083, 0xD9F1, 3)   // D9EF
+    S(cmp, IMM, 0x0002, 0xD9F3, 2)   // D9F1
+    S(bcs, REL, 0x0011, 0xD9F5, 2)   // D9F3
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_D9F5(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE3E, 0xD9F8, 6)   // D9F5
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_D9F8(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0080, 0xD9FA, 3)   // D9F8
+    S(sta, ZP_, 0x007E, 0xD9FC, 3)   // D9FA
+    S(lda, ZP_, 0x007F, 0xD9FE, 3)   // D9FC
+    S(sta, AB_, 0x026E, 0xDA01, 4)   // D9FE
+    S(lda, ZP_, 0x0081, 0xDA03, 3)   // DA01
+    S(sta, AB_, 0x026F, 0xDA06, 4)   // DA03
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_DA06(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xC199, 0xDA09, 3)   // DA06
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DA09(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, ABX, 0x027A, 0xDA0C, 4)   // DA09
+    S(lda, ABY, 0x0200, 0xDA0F, 4)   // DA0C
+    S(ldy, IMM, 0x0004, 0xDA11, 2)   // DA0F
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DA11(cpu *c) {
+    uint32_t cycles = 0;
+    S(dey, IMP, 0x0000, 0xDA12, 2)   // DA11
+    S(bmi, REL, 0x0008, 0xDA14, 2)   // DA12
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DA14(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, ABY, 0xFEB2, 0xDA17, 4)   // DA14
+    S(bne, REL, 0x00F8, 0xDA19, 2)   // DA17
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DA19(cpu *c) {
+    uint32_t cycles = 0;
+    S(sty, AB_, 0x0297, 0xDA1C, 4)   // DA19
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DA1C(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0005, 0xDA1E, 2)   // DA1C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DA1E(cpu *c) {
+    uint32_t cycles = 0;
+    S(dey, IMP, 0x0000, 0xDA1F, 2)   // DA1E
+    S(bmi, REL, 0x0008, 0xDA21, 2)   // DA1F
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DA21(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, ABY, 0xFEB6, 0xDA24, 4)   // DA21
+    S(bne, REL, 0x00F8, 0xDA26, 2)   // DA24
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DA26(cpu *c) {
+    uint32_t cycles = 0;
+    S(sty, AB_, 0x024A, 0xDA29, 4)   // DA26
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DA29(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xDA2A, 6)   // DA29
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DA2A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCA39, 0xDA2D, 6)   // DA2A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DA2D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0080, 0xDA2F, 2)   // DA2D
+    S(jsr, AB_, 0xDDA6, 0xDA32, 6)   // DA2F
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DA32(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x00F6, 0xDA34, 2)   // DA32
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DA34(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE95, 0xDA37, 6)   // DA34
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DA37(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0081, 0xDA39, 3)   // DA37
+    S(inx, IMP, 0x0000, 0xDA3A, 2)   // DA39
+    S(txa, IMP, 0x0000, 0xDA3B, 2)   // DA3A
+    S(bne, REL, 0x0005, 0xDA3D, 2)   // DA3B
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_DA3D(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD1A3, 0xDA40, 6)   // DA3D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DA40(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0002, 0xDA42, 2)   // DA40
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DA42(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD4C8, 0xDA45, 6)   // DA42
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DA45(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xDA47, 3)   // DA45
+    S(lda, IMM, 0x0001, 0xDA49, 2)   // DA47
+    S(sta, ZPX, 0x00F2, 0xDA4B, 4)   // DA49
+    S(lda, IMM, 0x0080, 0xDA4D, 2)   // DA4B
+    S(ora, ZP_, 0x0082, 0xDA4F, 3)   // DA4D
+    S(ldx, ZP_, 0x0083, 0xDA51, 3)   // DA4F
+    S(sta, ABX, 0x022B, 0xDA54, 5)   // DA51
+    S(rts, IMP, 0x0000, 0xDA55, 6)   // DA54
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_DA55(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x000C, 0xDA57, 2)   // DA55
+    S(sta, AB_, 0x022A, 0xDA5A, 4)   // DA57
+    S(lda, IMM, 0x0000, 0xDA5C, 2)   // DA5A
+    S(ldx, AB_, 0x0274, 0xDA5F, 4)   // DA5C
+    S(dex, IMP, 0x0000, 0xDA60, 2)   // DA5F
+    S(beq, REL, 0x000B, 0xDA62, 2)   // DA60
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_DA62(cpu *c) {
+    uint32_t cycles = 0;
+    S(dex, IMP, 0x0000, 0xDA63, 2)   // DA62
+    S(bne, REL, 0x0021, 0xDA65, 2)   // DA63
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DA65(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0201, 0xDA68, 4)   // DA65
+    S(jsr, AB_, 0xC3BD, 0xDA6B, 6)   // DA68
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DA6B(cpu *c) {
+    uint32_t cycles = 0;
+    S(bmi, REL, 0x0019, 0xDA6D, 2)   // DA6B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DA6D(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x00E2, 0xDA6F, 3)   // DA6D
+    S(inc, AB_, 0x0277, 0xDA72, 6)   // DA6F
+    S(inc, AB_, 0x0278, 0xDA75, 6)   // DA72
+    S(inc, AB_, 0x027A, 0xDA78, 6)   // DA75
+    S(lda, IMM, 0x0080, 0xDA7A, 2)   // DA78
+    S(sta, ZP_, 0x00E7, 0xDA7C, 3)   // DA7A
+    S(lda, IMM, 0x002A, 0xDA7E, 2)   // DA7C
+    S(sta, AB_, 0x0200, 0xDA81, 4)   // DA7E
+    S(sta, AB_, 0x0201, 0xDA84, 4)   // DA81
+    S(bne, REL, 0x0018, 0xDA86, 2)   // DA84
+    c->executed += 10;
+    return cycles;
+}
+
+static inline uint32_t rom_DA86(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC1E5, 0xDA89, 6)   // DA86
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DA89(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x0005, 0xDA8B, 2)   // DA89
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DA8B(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC2DC, 0xDA8E, 6)   // DA8B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DA8E(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0003, 0xDA90, 2)   // DA8E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DA90(cpu *c) {
+    uint32_t cycles = 0;
+    S(dey, IMP, 0x0000, 0xDA91, 2)   // DA90
+    S(dey, IMP, 0x0000, 0xDA92, 2)   // DA91
+    S(sty, AB_, 0x027A, 0xDA95, 4)   // DA92
+    S(jsr, AB_, 0xC200, 0xDA98, 6)   // DA95
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_DA98(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC398, 0xDA9B, 6)   // DA98
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DA9B(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC320, 0xDA9E, 6)   // DA9B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DA9E(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC3CA, 0xDAA1, 6)   // DA9E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DAA1(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC7B7, 0xDAA4, 6)   // DAA1
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DAA4(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC49D, 0xDAA7, 6)   // DAA4
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DAA7(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xEC9E, 0xDAAA, 6)   // DAA7
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DAAA(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD137, 0xDAAD, 6)   // DAAA
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DAAD(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xDAAF, 3)   // DAAD
+    S(sta, ABX, 0x023E, 0xDAB2, 5)   // DAAF
+    S(lda, ZP_, 0x007F, 0xDAB4, 3)   // DAB2
+    S(sta, AB_, 0x028E, 0xDAB7, 4)   // DAB4
+    S(ora, IMM, 0x0004, 0xDAB9, 2)   // DAB7
+    S(sta, ZPX, 0x00EC, 0xDABB, 4)   // DAB9
+    S(lda, IMM, 0x0000, 0xDABD, 2)   // DABB
+    S(sta, ZP_, 0x00A3, 0xDABF, 3)   // DABD
+    S(rts, IMP, 0x0000, 0xDAC0, 6)   // DABF
+    c->executed += 9;
+    return cycles;
+}
+
+static inline uint32_t rom_DAC0(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xDAC2, 2)   // DAC0
+    S(sta, AB_, 0x02F9, 0xDAC5, 4)   // DAC2
+    S(lda, ZP_, 0x0083, 0xDAC7, 3)   // DAC5
+    S(bne, REL, 0x000B, 0xDAC9, 2)   // DAC7
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_DAC9(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xDACB, 2)   // DAC9
+    S(sta, AB_, 0x0254, 0xDACE, 4)   // DACB
+    S(jsr, AB_, 0xD227, 0xDAD1, 6)   // DACE
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DAD1(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xD4DA, 0xDAD4, 3)   // DAD1
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DAD4(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x000F, 0xDAD6, 2)   // DAD4
+    S(beq, REL, 0x0014, 0xDAD8, 2)   // DAD6
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DAD8(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDB02, 0xDADB, 6)   // DAD8
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DADB(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0083, 0xDADD, 3)   // DADB
+    S(cmp, IMM, 0x0002, 0xDADF, 2)   // DADD
+    S(bcc, REL, 0x00F0, 0xDAE1, 2)   // DADF
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DAE1(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x026C, 0xDAE4, 4)   // DAE1
+    S(bne, REL, 0x0003, 0xDAE6, 2)   // DAE4
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DAE6(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xC194, 0xDAE9, 3)   // DAE6
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DAE9(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xC1AD, 0xDAEC, 3)   // DAE9
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DAEC(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x000E, 0xDAEE, 2)   // DAEC
+    S(sta, ZP_, 0x0083, 0xDAF0, 3)   // DAEE
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DAF0(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDB02, 0xDAF3, 6)   // DAF0
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DAF3(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, ZP_, 0x0083, 0xDAF5, 5)   // DAF3
+    S(bpl, REL, 0x00F9, 0xDAF7, 2)   // DAF5
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DAF7(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x026C, 0xDAFA, 4)   // DAF7
+    S(bne, REL, 0x0003, 0xDAFC, 2)   // DAFA
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DAFC(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xC194, 0xDAFF, 3)   // DAFC
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DAFF(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xC1AD, 0xDB02, 3)   // DAFF
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DB02(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0083, 0xDB04, 3)   // DB02
+    S(lda, ABX, 0x022B, 0xDB07, 4)   // DB04
+    S(cmp, IMM, 0x00FF, 0xDB09, 2)   // DB07
+    S(bne, REL, 0x0001, 0xDB0B, 2)   // DB09
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_DB0B(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xDB0C, 6)   // DB0B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DB0C(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x000F, 0xDB0E, 2)   // DB0C
+    S(sta, ZP_, 0x0082, 0xDB10, 3)   // DB0E
+    S(jsr, AB_, 0xD125, 0xDB13, 6)   // DB10
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DB13(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0007, 0xDB15, 2)   // DB13
+    S(beq, REL, 0x000F, 0xDB17, 2)   // DB15
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DB17(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0004, 0xDB19, 2)   // DB17
+    S(beq, REL, 0x0011, 0xDB1B, 2)   // DB19
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DB1B(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD107, 0xDB1E, 6)   // DB1B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DB1E(cpu *c) {
+    uint32_t cycles = 0;
+    S(bcs, REL, 0x0009, 0xDB20, 2)   // DB1E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DB20(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDB62, 0xDB23, 6)   // DB20
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DB23(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDBA5, 0xDB26, 6)   // DB23
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DB26(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xEEF4, 0xDB29, 6)   // DB26
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DB29(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xD227, 0xDB2C, 3)   // DB29
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DB2C(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDDF1, 0xDB2F, 6)   // DB2C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DB2F(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCF1E, 0xDB32, 6)   // DB2F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DB32(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE1CB, 0xDB35, 6)   // DB32
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DB35(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x00D5, 0xDB37, 3)   // DB35
+    S(stx, ZP_, 0x0073, 0xDB39, 3)   // DB37
+    S(inc, ZP_, 0x0073, 0xDB3B, 5)   // DB39
+    S(lda, IMM, 0x0000, 0xDB3D, 2)   // DB3B
+    S(sta, ZP_, 0x0070, 0xDB3F, 3)   // DB3D
+    S(sta, ZP_, 0x0071, 0xDB41, 3)   // DB3F
+    S(lda, ZP_, 0x00D6, 0xDB43, 3)   // DB41
+    S(sec, IMP, 0x0000, 0xDB44, 2)   // DB43
+    S(sbc, IMM, 0x000E, 0xDB46, 2)   // DB44
+    S(sta, ZP_, 0x0072, 0xDB48, 3)   // DB46
+    S(jsr, AB_, 0xDF51, 0xDB4B, 6)   // DB48
+    c->executed += 11;
+    return cycles;
+}
+
+static inline uint32_t rom_DB4B(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xDB4D, 3)   // DB4B
+    S(lda, ZP_, 0x0070, 0xDB4F, 3)   // DB4D
+    S(sta, ZPX, 0x00B5, 0xDB51, 4)   // DB4F
+    S(lda, ZP_, 0x0071, 0xDB53, 3)   // DB51
+    S(sta, ZPX, 0x00BB, 0xDB55, 4)   // DB53
+    S(lda, IMM, 0x0040, 0xDB57, 2)   // DB55
+    S(jsr, AB_, 0xDDA6, 0xDB5A, 6)   // DB57
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_DB5A(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x0003, 0xDB5C, 2)   // DB5A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DB5C(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDBA5, 0xDB5F, 6)   // DB5C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DB5F(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xD227, 0xDB62, 3)   // DB5F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DB62(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xDB64, 3)   // DB62
+    S(lda, ZPX, 0x00B5, 0xDB66, 4)   // DB64
+    S(ora, ZPX, 0x00BB, 0xDB68, 4)   // DB66
+    S(bne, REL, 0x000C, 0xDB6A, 2)   // DB68
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_DB6A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD4E8, 0xDB6D, 6)   // DB6A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DB6D(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0002, 0xDB6F, 2)   // DB6D
+    S(bne, REL, 0x0005, 0xDB71, 2)   // DB6F
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DB71(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x000D, 0xDB73, 2)   // DB71
+    S(jsr, AB_, 0xCFF1, 0xDB76, 6)   // DB73
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DB76(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD4E8, 0xDB79, 6)   // DB76
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DB79(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0002, 0xDB7B, 2)   // DB79
+    S(bne, REL, 0x000F, 0xDB7D, 2)   // DB7B
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DB7D(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCF1E, 0xDB80, 6)   // DB7D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DB80(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xDB82, 3)   // DB80
+    S(lda, ZPX, 0x00B5, 0xDB84, 4)   // DB82
+    S(bne, REL, 0x0002, 0xDB86, 2)   // DB84
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DB86(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, ZPX, 0x00BB, 0xDB88, 6)   // DB86
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DB88(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, ZPX, 0x00B5, 0xDB8A, 6)   // DB88
+    S(lda, IMM, 0x0000, 0xDB8C, 2)   // DB8A
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DB8C(cpu *c) {
+    uint32_t cycles = 0;
+    S(sec, IMP, 0x0000, 0xDB8D, 2)   // DB8C
+    S(sbc, IMM, 0x0001, 0xDB8F, 2)   // DB8D
+    S(pha, IMP, 0x0000, 0xDB90, 3)   // DB8F
+    S(lda, IMM, 0x0000, 0xDB92, 2)   // DB90
+    S(jsr, AB_, 0xD4C8, 0xDB95, 6)   // DB92
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_DB95(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCFF1, 0xDB98, 6)   // DB95
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DB98(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xDB99, 4)   // DB98
+    S(jsr, AB_, 0xCFF1, 0xDB9C, 6)   // DB99
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DB9C(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD0C7, 0xDB9F, 6)   // DB9C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DB9F(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD599, 0xDBA2, 6)   // DB9F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DBA2(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xCF1E, 0xDBA5, 3)   // DBA2
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DBA5(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xDBA7, 3)   // DBA5
+    S(stx, AB_, 0x0270, 0xDBAA, 4)   // DBA7
+    S(lda, ZP_, 0x0083, 0xDBAC, 3)   // DBAA
+    S(pha, IMP, 0x0000, 0xDBAD, 3)   // DBAC
+    S(lda, ABX, 0x0260, 0xDBB0, 4)   // DBAD
+    S(sta, ZP_, 0x0081, 0xDBB2, 3)   // DBB0
+    S(lda, ABX, 0x0266, 0xDBB5, 4)   // DBB2
+    S(sta, AB_, 0x0294, 0xDBB8, 4)   // DBB5
+    S(lda, ZPX, 0x00EC, 0xDBBA, 4)   // DBB8
+    S(and, IMM, 0x0001, 0xDBBC, 2)   // DBBA
+    S(sta, ZP_, 0x007F, 0xDBBE, 3)   // DBBC
+    S(lda, AB_, 0xFE85, 0xDBC1, 4)   // DBBE
+    S(sta, ZP_, 0x0080, 0xDBC3, 3)   // DBC1
+    S(jsr, AB_, 0xDF93, 0xDBC6, 6)   // DBC3
+    c->executed += 14;
+    return cycles;
+}
+
+static inline uint32_t rom_DBC6(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xDBC7, 3)   // DBC6
+    S(sta, ZP_, 0x00F9, 0xDBC9, 3)   // DBC7
+    S(jsr, AB_, 0xD460, 0xDBCC, 6)   // DBC9
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DBCC(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0000, 0xDBCE, 2)   // DBCC
+    S(lda, ABX, 0xFEE0, 0xDBD1, 4)   // DBCE
+    S(sta, ZP_, 0x0087, 0xDBD3, 3)   // DBD1
+    S(lda, AB_, 0x0294, 0xDBD6, 4)   // DBD3
+    S(sta, ZP_, 0x0086, 0xDBD8, 3)   // DBD6
+    S(lda, INY, 0x0086, 0xDBDA, 5)   // DBD8
+    S(and, IMM, 0x0020, 0xDBDC, 2)   // DBDA
+    S(beq, REL, 0x0043, 0xDBDE, 2)   // DBDC
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_DBDE(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD125, 0xDBE1, 6)   // DBDE
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DBE1(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0004, 0xDBE3, 2)   // DBE1
+    S(beq, REL, 0x0044, 0xDBE5, 2)   // DBE3
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DBE5(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x0086, 0xDBE7, 5)   // DBE5
+    S(and, IMM, 0x008F, 0xDBE9, 2)   // DBE7
+    S(sta, INY, 0x0086, 0xDBEB, 6)   // DBE9
+    S(iny, IMP, 0x0000, 0xDBEC, 2)   // DBEB
+    S(lda, INY, 0x0086, 0xDBEE, 5)   // DBEC
+    S(sta, ZP_, 0x0080, 0xDBF0, 3)   // DBEE
+    S(sty, ZP_, 0x0071, 0xDBF2, 3)   // DBF0
+    S(ldy, IMM, 0x001B, 0xDBF4, 2)   // DBF2
+    S(lda, INY, 0x0086, 0xDBF6, 5)   // DBF4
+    S(pha, IMP, 0x0000, 0xDBF7, 3)   // DBF6
+    S(dey, IMP, 0x0000, 0xDBF8, 2)   // DBF7
+    S(lda, INY, 0x0086, 0xDBFA, 5)   // DBF8
+    S(bne, REL, 0x000A, 0xDBFC, 2)   // DBFA
+    c->executed += 13;
+    return cycles;
+}
+
+static inline uint32_t rom_DBFC(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0080, 0xDBFE, 3)   // DBFC
+    S(pla, IMP, 0x0000, 0xDBFF, 4)   // DBFE
+    S(sta, ZP_, 0x0081, 0xDC01, 3)   // DBFF
+    S(lda, IMM, 0x0067, 0xDC03, 2)   // DC01
+    S(jsr, AB_, 0xE645, 0xDC06, 6)   // DC03
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_DC06(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xDC07, 3)   // DC06
+    S(lda, IMM, 0x0000, 0xDC09, 2)   // DC07
+    S(sta, INY, 0x0086, 0xDC0B, 6)   // DC09
+    S(iny, IMP, 0x0000, 0xDC0C, 2)   // DC0B
+    S(sta, INY, 0x0086, 0xDC0E, 6)   // DC0C
+    S(pla, IMP, 0x0000, 0xDC0F, 4)   // DC0E
+    S(ldy, ZP_, 0x0071, 0xDC11, 3)   // DC0F
+    S(sta, INY, 0x0086, 0xDC13, 6)   // DC11
+    S(iny, IMP, 0x0000, 0xDC14, 2)   // DC13
+    S(lda, INY, 0x0086, 0xDC16, 5)   // DC14
+    S(sta, ZP_, 0x0081, 0xDC18, 3)   // DC16
+    S(pla, IMP, 0x0000, 0xDC19, 4)   // DC18
+    S(sta, INY, 0x0086, 0xDC1B, 6)   // DC19
+    S(jsr, AB_, 0xC87D, 0xDC1E, 6)   // DC1B
+    c->executed += 14;
+    return cycles;
+}
+
+static inline uint32_t rom_DC1E(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xDC29, 0xDC21, 3)   // DC1E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DC21(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x0086, 0xDC23, 5)   // DC21
+    S(and, IMM, 0x000F, 0xDC25, 2)   // DC23
+    S(ora, IMM, 0x0080, 0xDC27, 2)   // DC25
+    S(sta, INY, 0x0086, 0xDC29, 6)   // DC27
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_DC29(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, AB_, 0x0270, 0xDC2C, 4)   // DC29
+    S(ldy, IMM, 0x001C, 0xDC2E, 2)   // DC2C
+    S(lda, ZPX, 0x00B5, 0xDC30, 4)   // DC2E
+    S(sta, INY, 0x0086, 0xDC32, 6)   // DC30
+    S(iny, IMP, 0x0000, 0xDC33, 2)   // DC32
+    S(lda, ZPX, 0x00BB, 0xDC35, 4)   // DC33
+    S(sta, INY, 0x0086, 0xDC37, 6)   // DC35
+    S(pla, IMP, 0x0000, 0xDC38, 4)   // DC37
+    S(tax, IMP, 0x0000, 0xDC39, 2)   // DC38
+    S(lda, IMM, 0x0090, 0xDC3B, 2)   // DC39
+    S(ora, ZP_, 0x007F, 0xDC3D, 3)   // DC3B
+    S(jsr, AB_, 0xD590, 0xDC40, 6)   // DC3D
+    c->executed += 12;
+    return cycles;
+}
+
+static inline uint32_t rom_DC40(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xDC41, 4)   // DC40
+    S(sta, ZP_, 0x0083, 0xDC43, 3)   // DC41
+    S(jmp, AB_, 0xD107, 0xDC46, 3)   // DC43
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DC46(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0001, 0xDC48, 2)   // DC46
+    S(jsr, AB_, 0xD1E2, 0xDC4B, 6)   // DC48
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DC4B(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDCB6, 0xDC4E, 6)   // DC4B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DC4E(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x024A, 0xDC51, 4)   // DC4E
+    S(pha, IMP, 0x0000, 0xDC52, 3)   // DC51
+    S(asl, ACC, 0x0000, 0xDC53, 2)   // DC52
+    S(ora, ZP_, 0x007F, 0xDC55, 3)   // DC53
+    S(sta, ZPX, 0x00EC, 0xDC57, 4)   // DC55
+    S(jsr, AB_, 0xD09B, 0xDC5A, 6)   // DC57
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_DC5A(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xDC5C, 3)   // DC5A
+    S(lda, ZP_, 0x0080, 0xDC5E, 3)   // DC5C
+    S(bne, REL, 0x0005, 0xDC60, 2)   // DC5E
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DC60(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0081, 0xDC62, 3)   // DC60
+    S(sta, ABX, 0x0244, 0xDC65, 5)   // DC62
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DC65(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xDC66, 4)   // DC65
+    S(cmp, IMM, 0x0004, 0xDC68, 2)   // DC66
+    S(bne, REL, 0x003F, 0xDC6A, 2)   // DC68
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DC6A(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, ZP_, 0x0083, 0xDC6C, 3)   // DC6A
+    S(lda, ABY, 0x022B, 0xDC6F, 4)   // DC6C
+    S(ora, IMM, 0x0040, 0xDC71, 2)   // DC6F
+    S(sta, ABY, 0x022B, 0xDC74, 5)   // DC71
+    S(lda, AB_, 0x0258, 0xDC77, 4)   // DC74
+    S(sta, ZPX, 0x00C7, 0xDC79, 4)   // DC77
+    S(jsr, AB_, 0xD28E, 0xDC7C, 6)   // DC79
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_DC7C(cpu *c) {
+    uint32_t cycles = 0;
+    S(bpl, REL, 0x0003, 0xDC7E, 2)   // DC7C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DC7E(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xD20F, 0xDC81, 3)   // DC7E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DC81(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xDC83, 3)   // DC81
+    S(sta, ZPX, 0x00CD, 0xDC85, 4)   // DC83
+    S(ldy, AB_, 0x0259, 0xDC88, 4)   // DC85
+    S(sty, ZP_, 0x0080, 0xDC8A, 3)   // DC88
+    S(ldy, AB_, 0x025A, 0xDC8D, 4)   // DC8A
+    S(sty, ZP_, 0x0081, 0xDC8F, 3)   // DC8D
+    S(jsr, AB_, 0xD6D3, 0xDC92, 6)   // DC8F
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_DC92(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE73, 0xDC95, 6)   // DC92
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DC95(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD599, 0xDC98, 6)   // DC95
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DC98(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xDC9A, 3)   // DC98
+    S(lda, IMM, 0x0002, 0xDC9C, 2)   // DC9A
+    S(sta, ZPX, 0x00C1, 0xDC9E, 4)   // DC9C
+    S(lda, IMM, 0x0000, 0xDCA0, 2)   // DC9E
+    S(jsr, AB_, 0xD4C8, 0xDCA3, 6)   // DCA0
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_DCA3(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE153, 0xDCA6, 6)   // DCA3
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DCA6(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xDE3E, 0xDCA9, 3)   // DCA6
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DCA9(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD156, 0xDCAC, 6)   // DCA9
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DCAC(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xDCAE, 3)   // DCAC
+    S(sta, ABX, 0x023E, 0xDCB1, 5)   // DCAE
+    S(lda, IMM, 0x0088, 0xDCB3, 2)   // DCB1
+    S(sta, ZPX, 0x00F2, 0xDCB5, 4)   // DCB3
+    S(rts, IMP, 0x0000, 0xDCB6, 6)   // DCB5
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_DCB6(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xDCB8, 3)   // DCB6
+    S(lda, ZPX, 0x00A7, 0xDCBA, 4)   // DCB8
+    S(asl, ACC, 0x0000, 0xDCBB, 2)   // DCBA
+    S(tay, IMP, 0x0000, 0xDCBC, 2)   // DCBB
+    S(lda, IMM, 0x0002, 0xDCBE, 2)   // DCBC
+    S(sta, ABY, 0x0099, 0xDCC1, 5)   // DCBE
+    S(lda, ZPX, 0x00AE, 0xDCC3, 4)   // DCC1
+    S(ora, IMM, 0x0080, 0xDCC5, 2)   // DCC3
+    S(sta, ZPX, 0x00AE, 0xDCC7, 4)   // DCC5
+    S(asl, ACC, 0x0000, 0xDCC8, 2)   // DCC7
+    S(tay, IMP, 0x0000, 0xDCC9, 2)   // DCC8
+    S(lda, IMM, 0x0002, 0xDCCB, 2)   // DCC9
+    S(sta, ABY, 0x0099, 0xDCCE, 5)   // DCCB
+    S(lda, IMM, 0x0000, 0xDCD0, 2)   // DCCE
+    S(sta, ZPX, 0x00B5, 0xDCD2, 4)   // DCD0
+    S(sta, ZPX, 0x00BB, 0xDCD4, 4)   // DCD2
+    S(lda, IMM, 0x0000, 0xDCD6, 2)   // DCD4
+    S(sta, ABX, 0x0244, 0xDCD9, 5)   // DCD6
+    S(rts, IMP, 0x0000, 0xDCDA, 6)   // DCD9
+    c->executed += 19;
+    return cycles;
+}
+
+static inline uint32_t rom_DCDA(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF1A9, 0xDCDD, 6)   // DCDA
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DCDD(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0001, 0xDCDF, 2)   // DCDD
+    S(jsr, AB_, 0xD1DF, 0xDCE2, 6)   // DCDF
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DCE2(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD6D0, 0xDCE5, 6)   // DCE2
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DCE5(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDCB6, 0xDCE8, 6)   // DCE5
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DCE8(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xDCEA, 3)   // DCE8
+    S(lda, AB_, 0x024A, 0xDCED, 4)   // DCEA
+    S(pha, IMP, 0x0000, 0xDCEE, 3)   // DCED
+    S(asl, ACC, 0x0000, 0xDCEF, 2)   // DCEE
+    S(ora, ZP_, 0x007F, 0xDCF1, 3)   // DCEF
+    S(sta, ZPX, 0x00EC, 0xDCF3, 4)   // DCF1
+    S(pla, IMP, 0x0000, 0xDCF4, 4)   // DCF3
+    S(cmp, IMM, 0x0004, 0xDCF6, 2)   // DCF4
+    S(beq, REL, 0x0005, 0xDCF8, 2)   // DCF6
+    c->executed += 9;
+    return cycles;
+}
+
+static inline uint32_t rom_DCF8(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0001, 0xDCFA, 2)   // DCF8
+    S(sta, ZPX, 0x00F2, 0xDCFC, 4)   // DCFA
+    S(rts, IMP, 0x0000, 0xDCFD, 6)   // DCFC
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DCFD(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, ZP_, 0x0083, 0xDCFF, 3)   // DCFD
+    S(lda, ABY, 0x022B, 0xDD02, 4)   // DCFF
+    S(and, IMM, 0x003F, 0xDD04, 2)   // DD02
+    S(ora, IMM, 0x0040, 0xDD06, 2)   // DD04
+    S(sta, ABY, 0x022B, 0xDD09, 5)   // DD06
+    S(lda, AB_, 0x0258, 0xDD0C, 4)   // DD09
+    S(sta, ZPX, 0x00C7, 0xDD0E, 4)   // DD0C
+    S(jsr, AB_, 0xD28E, 0xDD11, 6)   // DD0E
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_DD11(cpu *c) {
+    uint32_t cycles = 0;
+    S(bpl, REL, 0x0003, 0xDD13, 2)   // DD11
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DD13(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xD20F, 0xDD16, 3)   // DD13
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DD16(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xDD18, 3)   // DD16
+    S(sta, ZPX, 0x00CD, 0xDD1A, 4)   // DD18
+    S(jsr, AB_, 0xDEC1, 0xDD1D, 6)   // DD1A
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DD1D(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF11E, 0xDD20, 6)   // DD1D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DD20(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0080, 0xDD22, 3)   // DD20
+    S(sta, AB_, 0x0259, 0xDD25, 4)   // DD22
+    S(lda, ZP_, 0x0081, 0xDD27, 3)   // DD25
+    S(sta, AB_, 0x025A, 0xDD2A, 4)   // DD27
+    S(ldx, ZP_, 0x0082, 0xDD2C, 3)   // DD2A
+    S(lda, ZPX, 0x00CD, 0xDD2E, 4)   // DD2C
+    S(jsr, AB_, 0xD6D3, 0xDD31, 6)   // DD2E
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_DD31(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xDD33, 2)   // DD31
+    S(jsr, AB_, 0xDEE9, 0xDD36, 6)   // DD33
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DD36(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xDD38, 2)   // DD36
+    S(jsr, AB_, 0xDD8D, 0xDD3B, 6)   // DD38
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DD3B(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0011, 0xDD3D, 2)   // DD3B
+    S(jsr, AB_, 0xDD8D, 0xDD40, 6)   // DD3D
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DD40(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xDD42, 2)   // DD40
+    S(jsr, AB_, 0xDD8D, 0xDD45, 6)   // DD42
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DD45(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0258, 0xDD48, 4)   // DD45
+    S(jsr, AB_, 0xDD8D, 0xDD4B, 6)   // DD48
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DD4B(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0080, 0xDD4D, 3)   // DD4B
+    S(jsr, AB_, 0xDD8D, 0xDD50, 6)   // DD4D
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DD50(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0081, 0xDD52, 3)   // DD50
+    S(jsr, AB_, 0xDD8D, 0xDD55, 6)   // DD52
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DD55(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0010, 0xDD57, 2)   // DD55
+    S(jsr, AB_, 0xDEE9, 0xDD5A, 6)   // DD57
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DD5A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE3E, 0xDD5D, 6)   // DD5A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DD5D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0080, 0xDD5F, 3)   // DD5D
+    S(jsr, AB_, 0xDD8D, 0xDD62, 6)   // DD5F
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DD62(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0081, 0xDD64, 3)   // DD62
+    S(jsr, AB_, 0xDD8D, 0xDD67, 6)   // DD64
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DD67(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE6C, 0xDD6A, 6)   // DD67
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DD6A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD599, 0xDD6D, 6)   // DD6A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DD6D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0002, 0xDD6F, 2)   // DD6D
+    S(jsr, AB_, 0xD4C8, 0xDD72, 6)   // DD6F
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DD72(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xDD74, 3)   // DD72
+    S(sec, IMP, 0x0000, 0xDD75, 2)   // DD74
+    S(lda, IMM, 0x0000, 0xDD77, 2)   // DD75
+    S(sbc, ZPX, 0x00C7, 0xDD79, 4)   // DD77
+    S(sta, ZPX, 0x00C1, 0xDD7B, 4)   // DD79
+    S(jsr, AB_, 0xE2E2, 0xDD7E, 6)   // DD7B
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_DD7E(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE19, 0xDD81, 6)   // DD7E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DD81(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE5E, 0xDD84, 6)   // DD81
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DD84(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD599, 0xDD87, 6)   // DD84
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DD87(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xEEF4, 0xDD8A, 6)   // DD87
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DD8A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xDC98, 0xDD8D, 3)   // DD8A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DD8D(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xDD8E, 3)   // DD8D
+    S(ldx, ZP_, 0x0082, 0xDD90, 3)   // DD8E
+    S(lda, ZPX, 0x00CD, 0xDD92, 4)   // DD90
+    S(jmp, AB_, 0xCFFD, 0xDD95, 3)   // DD92
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_DD97(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xDD99, 3)   // DD97
+    S(ora, ZPX, 0x00EC, 0xDD9B, 4)   // DD99
+    S(bne, REL, 0x0006, 0xDD9D, 2)   // DD9B
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DD9D(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xDD9F, 3)   // DD9D
+    S(eor, IMM, 0x00FF, 0xDDA1, 2)   // DD9F
+    S(and, ZPX, 0x00EC, 0xDDA3, 4)   // DDA1
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DDA3(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZPX, 0x00EC, 0xDDA5, 4)   // DDA3
+    S(rts, IMP, 0x0000, 0xDDA6, 6)   // DDA5
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DDA6(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xDDA8, 3)   // DDA6
+    S(and, ZPX, 0x00EC, 0xDDAA, 4)   // DDA8
+    S(rts, IMP, 0x0000, 0xDDAB, 6)   // DDAA
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DDAB(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF93, 0xDDAE, 6)   // DDAB
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DDAE(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xDDAF, 2)   // DDAE
+    S(lda, ABX, 0x025B, 0xDDB2, 4)   // DDAF
+    S(and, IMM, 0x00F0, 0xDDB4, 2)   // DDB2
+    S(cmp, IMM, 0x0090, 0xDDB6, 2)   // DDB4
+    S(rts, IMP, 0x0000, 0xDDB7, 6)   // DDB6
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_DDF1(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF9E, 0xDDF4, 6)   // DDF1
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DDF4(cpu *c) {
+    uint32_t cycles = 0;
+    S(bvc, REL, 0x0006, 0xDDF6, 2)   // DDF4
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DDF6(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE5E, 0xDDF9, 6)   // DDF6
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DDF9(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD599, 0xDDFC, 6)   // DDF9
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DDFC(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xDDFD, 6)   // DDFC
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DDFD(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE2B, 0xDE00, 6)   // DDFD
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DE00(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0080, 0xDE02, 3)   // DE00
+    S(sta, INY, 0x0094, 0xDE04, 6)   // DE02
+    S(iny, IMP, 0x0000, 0xDE05, 2)   // DE04
+    S(lda, ZP_, 0x0081, 0xDE07, 3)   // DE05
+    S(sta, INY, 0x0094, 0xDE09, 6)   // DE07
+    S(jmp, AB_, 0xE105, 0xDE0C, 3)   // DE09
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_DE0C(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE2B, 0xDE0F, 6)   // DE0C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DE0F(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x0094, 0xDE11, 5)   // DE0F
+    S(sta, ZP_, 0x0080, 0xDE13, 3)   // DE11
+    S(iny, IMP, 0x0000, 0xDE14, 2)   // DE13
+    S(lda, INY, 0x0094, 0xDE16, 5)   // DE14
+    S(sta, ZP_, 0x0081, 0xDE18, 3)   // DE16
+    S(rts, IMP, 0x0000, 0xDE19, 6)   // DE18
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_DE19(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE2B, 0xDE1C, 6)   // DE19
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DE1C(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xDE1E, 2)   // DE1C
+    S(sta, INY, 0x0094, 0xDE20, 6)   // DE1E
+    S(iny, IMP, 0x0000, 0xDE21, 2)   // DE20
+    S(ldx, ZP_, 0x0082, 0xDE23, 3)   // DE21
+    S(lda, ZPX, 0x00C1, 0xDE25, 4)   // DE23
+    S(tax, IMP, 0x0000, 0xDE26, 2)   // DE25
+    S(dex, IMP, 0x0000, 0xDE27, 2)   // DE26
+    S(txa, IMP, 0x0000, 0xDE28, 2)   // DE27
+    S(sta, INY, 0x0094, 0xDE2A, 6)   // DE28
+    S(rts, IMP, 0x0000, 0xDE2B, 6)   // DE2A
+    c->executed += 10;
+    return cycles;
+}
+
+static inline uint32_t rom_DE2B(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF93, 0xDE2E, 6)   // DE2B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DE2E(cpu *c) {
+    uint32_t cycles = 0;
+    S(asl, ACC, 0x0000, 0xDE2F, 2)   // DE2E
+    S(tax, IMP, 0x0000, 0xDE30, 2)   // DE2F
+    S(lda, ZPX, 0x009A, 0xDE32, 4)   // DE30
+    S(sta, ZP_, 0x0095, 0xDE34, 3)   // DE32
+    S(lda, IMM, 0x0000, 0xDE36, 2)   // DE34
+    S(sta, ZP_, 0x0094, 0xDE38, 3)   // DE36
+    S(ldy, IMM, 0x0000, 0xDE3A, 2)   // DE38
+    S(rts, IMP, 0x0000, 0xDE3B, 6)   // DE3A
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_DE3B(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD0EB, 0xDE3E, 6)   // DE3B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DE3E(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF93, 0xDE41, 6)   // DE3E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DE41(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x00F9, 0xDE43, 3)   // DE41
+    S(asl, ACC, 0x0000, 0xDE44, 2)   // DE43
+    S(tay, IMP, 0x0000, 0xDE45, 2)   // DE44
+    S(lda, ABY, 0x0006, 0xDE48, 4)   // DE45
+    S(sta, ZP_, 0x0080, 0xDE4A, 3)   // DE48
+    S(lda, ABY, 0x0007, 0xDE4D, 4)   // DE4A
+    S(sta, ZP_, 0x0081, 0xDE4F, 3)   // DE4D
+    S(rts, IMP, 0x0000, 0xDE50, 6)   // DE4F
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_DE50(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0090, 0xDE52, 2)   // DE50
+    S(sta, AB_, 0x024D, 0xDE55, 4)   // DE52
+    S(bne, REL, 0x0028, 0xDE57, 2)   // DE55
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DE57(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0080, 0xDE59, 2)   // DE57
+    S(sta, AB_, 0x024D, 0xDE5C, 4)   // DE59
+    S(bne, REL, 0x0021, 0xDE5E, 2)   // DE5C
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DE5E(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0090, 0xDE60, 2)   // DE5E
+    S(sta, AB_, 0x024D, 0xDE63, 4)   // DE60
+    S(bne, REL, 0x0026, 0xDE65, 2)   // DE63
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DE65(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0080, 0xDE67, 2)   // DE65
+    S(sta, AB_, 0x024D, 0xDE6A, 4)   // DE67
+    S(bne, REL, 0x001F, 0xDE6C, 2)   // DE6A
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DE6C(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0090, 0xDE6E, 2)   // DE6C
+    S(sta, AB_, 0x024D, 0xDE71, 4)   // DE6E
+    S(bne, REL, 0x0002, 0xDE73, 2)   // DE71
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DE73(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0080, 0xDE75, 2)   // DE73
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DE75(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, AB_, 0x024D, 0xDE78, 4)   // DE75
+    S(ldx, ZP_, 0x0082, 0xDE7A, 3)   // DE78
+    S(lda, ZPX, 0x00CD, 0xDE7C, 4)   // DE7A
+    S(tax, IMP, 0x0000, 0xDE7D, 2)   // DE7C
+    S(bpl, REL, 0x0013, 0xDE7F, 2)   // DE7D
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_DE7F(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD6D0, 0xDE82, 6)   // DE7F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DE82(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF93, 0xDE85, 6)   // DE82
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DE85(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xDE86, 2)   // DE85
+    S(lda, ZP_, 0x007F, 0xDE88, 3)   // DE86
+    S(sta, ABX, 0x025B, 0xDE8B, 5)   // DE88
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DE8B(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE115, 0xDE8E, 6)   // DE8B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DE8E(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF93, 0xDE91, 6)   // DE8E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DE91(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xDE92, 2)   // DE91
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DE92(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xD506, 0xDE95, 3)   // DE92
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DE95(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xDE97, 2)   // DE95
+    S(jsr, AB_, 0xD4C8, 0xDE9A, 6)   // DE97
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DE9A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD137, 0xDE9D, 6)   // DE9A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DE9D(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0080, 0xDE9F, 3)   // DE9D
+    S(jsr, AB_, 0xD137, 0xDEA2, 6)   // DE9F
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DEA2(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0081, 0xDEA4, 3)   // DEA2
+    S(rts, IMP, 0x0000, 0xDEA5, 6)   // DEA4
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DEA5(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xDEA6, 3)   // DEA5
+    S(lda, IMM, 0x0000, 0xDEA8, 2)   // DEA6
+    S(sta, ZP_, 0x006F, 0xDEAA, 3)   // DEA8
+    S(sta, ZP_, 0x0071, 0xDEAC, 3)   // DEAA
+    S(lda, ABY, 0xFEE0, 0xDEAF, 4)   // DEAC
+    S(sta, ZP_, 0x0070, 0xDEB1, 3)   // DEAF
+    S(lda, ABX, 0xFEE0, 0xDEB4, 4)   // DEB1
+    S(sta, ZP_, 0x0072, 0xDEB6, 3)   // DEB4
+    S(pla, IMP, 0x0000, 0xDEB7, 4)   // DEB6
+    S(tay, IMP, 0x0000, 0xDEB8, 2)   // DEB7
+    S(dey, IMP, 0x0000, 0xDEB9, 2)   // DEB8
+    c->executed += 11;
+    return cycles;
+}
+
+static inline uint32_t rom_DEB9(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x006F, 0xDEBB, 5)   // DEB9
+    S(sta, INY, 0x0071, 0xDEBD, 6)   // DEBB
+    S(dey, IMP, 0x0000, 0xDEBE, 2)   // DEBD
+    S(bpl, REL, 0x00F9, 0xDEC0, 2)   // DEBE
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_DEC0(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xDEC1, 6)   // DEC0
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DEC1(cpu *c) {
+    uint32_t cycles = 0;
+    S(tay, IMP, 0x0000, 0xDEC2, 2)   // DEC1
+    S(lda, ABY, 0xFEE0, 0xDEC5, 4)   // DEC2
+    S(sta, ZP_, 0x0070, 0xDEC7, 3)   // DEC5
+    S(lda, IMM, 0x0000, 0xDEC9, 2)   // DEC7
+    S(sta, ZP_, 0x006F, 0xDECB, 3)   // DEC9
+    S(tay, IMP, 0x0000, 0xDECC, 2)   // DECB
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_DECC(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, INY, 0x006F, 0xDECE, 6)   // DECC
+    S(iny, IMP, 0x0000, 0xDECF, 2)   // DECE
+    S(bne, REL, 0x00FB, 0xDED1, 2)   // DECF
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DED1(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xDED2, 6)   // DED1
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DED2(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xDED4, 2)   // DED2
+    S(jsr, AB_, 0xDEDC, 0xDED7, 6)   // DED4
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DED7(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0002, 0xDED9, 2)   // DED7
+    S(lda, INY, 0x0094, 0xDEDB, 5)   // DED9
+    S(rts, IMP, 0x0000, 0xDEDC, 6)   // DEDB
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DEDC(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0094, 0xDEDE, 3)   // DEDC
+    S(ldx, ZP_, 0x0082, 0xDEE0, 3)   // DEDE
+    S(lda, ZPX, 0x00CD, 0xDEE2, 4)   // DEE0
+    S(tax, IMP, 0x0000, 0xDEE3, 2)   // DEE2
+    S(lda, ABX, 0xFEE0, 0xDEE6, 4)   // DEE3
+    S(sta, ZP_, 0x0095, 0xDEE8, 3)   // DEE6
+    S(rts, IMP, 0x0000, 0xDEE9, 6)   // DEE8
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_DEE9(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xDEEA, 3)   // DEE9
+    S(jsr, AB_, 0xDEDC, 0xDEED, 6)   // DEEA
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DEED(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xDEEE, 3)   // DEED
+    S(txa, IMP, 0x0000, 0xDEEF, 2)   // DEEE
+    S(asl, ACC, 0x0000, 0xDEF0, 2)   // DEEF
+    S(tax, IMP, 0x0000, 0xDEF1, 2)   // DEF0
+    S(pla, IMP, 0x0000, 0xDEF2, 4)   // DEF1
+    S(sta, ZPX, 0x009A, 0xDEF4, 4)   // DEF2
+    S(pla, IMP, 0x0000, 0xDEF5, 4)   // DEF4
+    S(sta, ZPX, 0x0099, 0xDEF7, 4)   // DEF5
+    S(rts, IMP, 0x0000, 0xDEF8, 6)   // DEF7
+    c->executed += 9;
+    return cycles;
+}
+
+static inline uint32_t rom_DEF8(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF66, 0xDEFB, 6)   // DEF8
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DEFB(cpu *c) {
+    uint32_t cycles = 0;
+    S(bmi, REL, 0x000E, 0xDEFD, 2)   // DEFB
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DEFD(cpu *c) {
+    uint32_t cycles = 0;
+    S(bvc, REL, 0x0013, 0xDEFF, 2)   // DEFD
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DEFF(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xDF01, 3)   // DEFF
+    S(lda, ZPX, 0x00CD, 0xDF03, 4)   // DF01
+    S(jsr, AB_, 0xDF1B, 0xDF06, 6)   // DF03
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DF06(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF66, 0xDF09, 6)   // DF06
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DF09(cpu *c) {
+    uint32_t cycles = 0;
+    S(bpl, REL, 0x0007, 0xDF0B, 2)   // DF09
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DF0B(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE1CB, 0xDF0E, 6)   // DF0B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DF0E(cpu *c) {
+    uint32_t cycles = 0;
+    S(bit, AB_, 0xFECE, 0xDF11, 4)   // DF0E
+    S(rts, IMP, 0x0000, 0xDF12, 6)   // DF11
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DF12(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x00D6, 0xDF14, 3)   // DF12
+    S(jsr, AB_, 0xDEE9, 0xDF17, 6)   // DF14
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DF17(cpu *c) {
+    uint32_t cycles = 0;
+    S(bit, AB_, 0xFECD, 0xDF1A, 4)   // DF17
+    S(rts, IMP, 0x0000, 0xDF1B, 6)   // DF1A
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DF1B(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x00F9, 0xDF1D, 3)   // DF1B
+    S(lda, IMM, 0x0080, 0xDF1F, 2)   // DF1D
+    S(bne, REL, 0x0004, 0xDF21, 2)   // DF1F
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DF21(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x00F9, 0xDF23, 3)   // DF21
+    S(lda, IMM, 0x0090, 0xDF25, 2)   // DF23
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DF25(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xDF26, 3)   // DF25
+    S(lda, ZPX, 0x00EC, 0xDF28, 4)   // DF26
+    S(and, IMM, 0x0001, 0xDF2A, 2)   // DF28
+    S(sta, ZP_, 0x007F, 0xDF2C, 3)   // DF2A
+    S(pla, IMP, 0x0000, 0xDF2D, 4)   // DF2C
+    S(ora, ZP_, 0x007F, 0xDF2F, 3)   // DF2D
+    S(sta, AB_, 0x024D, 0xDF32, 4)   // DF2F
+    S(lda, INY, 0x0094, 0xDF34, 5)   // DF32
+    S(sta, ZP_, 0x0080, 0xDF36, 3)   // DF34
+    S(iny, IMP, 0x0000, 0xDF37, 2)   // DF36
+    S(lda, INY, 0x0094, 0xDF39, 5)   // DF37
+    S(sta, ZP_, 0x0081, 0xDF3B, 3)   // DF39
+    S(lda, ZP_, 0x00F9, 0xDF3D, 3)   // DF3B
+    S(jsr, AB_, 0xD6D3, 0xDF40, 6)   // DF3D
+    c->executed += 14;
+    return cycles;
+}
+
+static inline uint32_t rom_DF40(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x00F9, 0xDF42, 3)   // DF40
+    S(jmp, AB_, 0xD593, 0xDF45, 3)   // DF42
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DF45(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xDF47, 3)   // DF45
+    S(lda, ZPX, 0x00CD, 0xDF49, 4)   // DF47
+    S(jmp, AB_, 0xD4EB, 0xDF4C, 3)   // DF49
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DF4C(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0078, 0xDF4E, 2)   // DF4C
+    S(jsr, AB_, 0xDF5C, 0xDF51, 6)   // DF4E
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DF51(cpu *c) {
+    uint32_t cycles = 0;
+    S(dex, IMP, 0x0000, 0xDF52, 2)   // DF51
+    S(bpl, REL, 0x00F8, 0xDF54, 2)   // DF52
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DF54(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0072, 0xDF56, 3)   // DF54
+    S(lsr, ACC, 0x0000, 0xDF57, 2)   // DF56
+    S(jsr, AB_, 0xDF5C, 0xDF5A, 6)   // DF57
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DF5A(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0073, 0xDF5C, 3)   // DF5A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DF5C(cpu *c) {
+    uint32_t cycles = 0;
+    S(clc, IMP, 0x0000, 0xDF5D, 2)   // DF5C
+    S(adc, ZP_, 0x0070, 0xDF5F, 3)   // DF5D
+    S(sta, ZP_, 0x0070, 0xDF61, 3)   // DF5F
+    S(bcc, REL, 0x0002, 0xDF63, 2)   // DF61
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_DF63(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZP_, 0x0071, 0xDF65, 5)   // DF63
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DF65(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xDF66, 6)   // DF65
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DF66(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDED2, 0xDF69, 6)   // DF66
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DF69(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, ZP_, 0x00D5, 0xDF6B, 3)   // DF69
+    S(bne, REL, 0x000E, 0xDF6D, 2)   // DF6B
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DF6D(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, ZP_, 0x00D6, 0xDF6F, 3)   // DF6D
+    S(lda, INY, 0x0094, 0xDF71, 5)   // DF6F
+    S(beq, REL, 0x0004, 0xDF73, 2)   // DF71
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DF73(cpu *c) {
+    uint32_t cycles = 0;
+    S(bit, AB_, 0xFECD, 0xDF76, 4)   // DF73
+    S(rts, IMP, 0x0000, 0xDF77, 6)   // DF76
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DF77(cpu *c) {
+    uint32_t cycles = 0;
+    S(bit, AB_, 0xFECF, 0xDF7A, 4)   // DF77
+    S(rts, IMP, 0x0000, 0xDF7B, 6)   // DF7A
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DF7B(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x00D5, 0xDF7D, 3)   // DF7B
+    S(cmp, IMM, 0x0006, 0xDF7F, 2)   // DF7D
+    S(bcs, REL, 0x000A, 0xDF81, 2)   // DF7F
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DF81(cpu *c) {
+    uint32_t cycles = 0;
+    S(asl, ACC, 0x0000, 0xDF82, 2)   // DF81
+    S(tay, IMP, 0x0000, 0xDF83, 2)   // DF82
+    S(lda, IMM, 0x0004, 0xDF85, 2)   // DF83
+    S(sta, ZP_, 0x0094, 0xDF87, 3)   // DF85
+    S(lda, INY, 0x0094, 0xDF89, 5)   // DF87
+    S(bne, REL, 0x0004, 0xDF8B, 2)   // DF89
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_DF8B(cpu *c) {
+    uint32_t cycles = 0;
+    S(bit, AB_, 0xFED0, 0xDF8E, 4)   // DF8B
+    S(rts, IMP, 0x0000, 0xDF8F, 6)   // DF8E
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DF8F(cpu *c) {
+    uint32_t cycles = 0;
+    S(bit, AB_, 0xFECE, 0xDF92, 4)   // DF8F
+    S(rts, IMP, 0x0000, 0xDF93, 6)   // DF92
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DF93(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xDF95, 3)   // DF93
+    S(lda, ZPX, 0x00A7, 0xDF97, 4)   // DF95
+    S(bpl, REL, 0x0002, 0xDF99, 2)   // DF97
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DF99(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZPX, 0x00AE, 0xDF9B, 4)   // DF99
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DF9B(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x00BF, 0xDF9D, 2)   // DF9B
+    S(rts, IMP, 0x0000, 0xDF9E, 6)   // DF9D
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DF9E(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xDFA0, 3)   // DF9E
+    S(stx, AB_, 0x0257, 0xDFA3, 4)   // DFA0
+    S(lda, ZPX, 0x00A7, 0xDFA5, 4)   // DFA3
+    S(bpl, REL, 0x0009, 0xDFA7, 2)   // DFA5
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_DFA7(cpu *c) {
+    uint32_t cycles = 0;
+    S(txa, IMP, 0x0000, 0xDFA8, 2)   // DFA7
+    S(clc, IMP, 0x0000, 0xDFA9, 2)   // DFA8
+    S(adc, IMM, 0x0007, 0xDFAB, 2)   // DFA9
+    S(sta, AB_, 0x0257, 0xDFAE, 4)   // DFAB
+    S(lda, ZPX, 0x00AE, 0xDFB0, 4)   // DFAE
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_DFB0(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0070, 0xDFB2, 3)   // DFB0
+    S(and, IMM, 0x001F, 0xDFB4, 2)   // DFB2
+    S(bit, ZP_, 0x0070, 0xDFB6, 3)   // DFB4
+    S(rts, IMP, 0x0000, 0xDFB7, 6)   // DFB6
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_DFB7(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xDFB9, 3)   // DFB7
+    S(lda, ZPX, 0x00A7, 0xDFBB, 4)   // DFB9
+    S(bmi, REL, 0x0002, 0xDFBD, 2)   // DFBB
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DFBD(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZPX, 0x00AE, 0xDFBF, 4)   // DFBD
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DFBF(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x00FF, 0xDFC1, 2)   // DFBF
+    S(rts, IMP, 0x0000, 0xDFC2, 6)   // DFC1
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DFC2(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xDFC4, 3)   // DFC2
+    S(ora, IMM, 0x0080, 0xDFC6, 2)   // DFC4
+    S(ldy, ZPX, 0x00A7, 0xDFC8, 4)   // DFC6
+    S(bpl, REL, 0x0003, 0xDFCA, 2)   // DFC8
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_DFCA(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZPX, 0x00A7, 0xDFCC, 4)   // DFCA
+    S(rts, IMP, 0x0000, 0xDFCD, 6)   // DFCC
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DFCD(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZPX, 0x00AE, 0xDFCF, 4)   // DFCD
+    S(rts, IMP, 0x0000, 0xDFD0, 6)   // DFCF
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DFD0(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0020, 0xDFD2, 2)   // DFD0
+    S(jsr, AB_, 0xDD9D, 0xDFD5, 6)   // DFD2
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DFD5(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0080, 0xDFD7, 2)   // DFD5
+    S(jsr, AB_, 0xDDA6, 0xDFDA, 6)   // DFD7
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_DFDA(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x0041, 0xDFDC, 2)   // DFDA
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DFDC(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xDFDE, 3)   // DFDC
+    S(inc, ZPX, 0x00B5, 0xDFE0, 6)   // DFDE
+    S(bne, REL, 0x0002, 0xDFE2, 2)   // DFE0
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DFE2(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZPX, 0x00BB, 0xDFE4, 6)   // DFE2
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DFE4(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xDFE6, 3)   // DFE4
+    S(lda, ZPX, 0x00C1, 0xDFE8, 4)   // DFE6
+    S(beq, REL, 0x002E, 0xDFEA, 2)   // DFE8
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DFEA(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD4E8, 0xDFED, 6)   // DFEA
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DFED(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xDFEF, 3)   // DFED
+    S(cmp, ZPX, 0x00C1, 0xDFF1, 4)   // DFEF
+    S(bcc, REL, 0x0003, 0xDFF3, 2)   // DFF1
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DFF3(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE03C, 0xDFF6, 6)   // DFF3
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_DFF6(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xDFF8, 3)   // DFF6
+    S(lda, ZPX, 0x00C1, 0xDFFA, 4)   // DFF8
+    S(jsr, AB_, 0xD4C8, 0xDFFD, 6)   // DFFA
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_DFFD(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INX, 0x0099, 0xDFFF, 6)   // DFFD
+    S(sta, ZP_, 0x0085, 0xE001, 3)   // DFFF
+    S(lda, IMM, 0x0020, 0xE003, 2)   // E001
+    S(jsr, AB_, 0xDD9D, 0xE006, 6)   // E003
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_E006(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE304, 0xE009, 6)   // E006
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E009(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xE00A, 3)   // E009
+    S(bcc, REL, 0x0028, 0xE00C, 2)   // E00A
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E00C(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xE00E, 2)   // E00C
+    S(jsr, AB_, 0xD4F6, 0xE011, 6)   // E00E
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E011(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x0021, 0xE013, 2)   // E011
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E013(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xE014, 4)   // E013
+    S(cmp, IMM, 0x0002, 0xE016, 2)   // E014
+    S(beq, REL, 0x0012, 0xE018, 2)   // E016
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E018(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0080, 0xE01A, 2)   // E018
+    S(jsr, AB_, 0xDD97, 0xE01D, 6)   // E01A
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E01D(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD12F, 0xE020, 6)   // E01D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E020(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZPX, 0x0099, 0xE022, 4)   // E020
+    S(sta, ABY, 0x0244, 0xE025, 5)   // E022
+    S(lda, IMM, 0x000D, 0xE027, 2)   // E025
+    S(sta, ZP_, 0x0085, 0xE029, 3)   // E027
+    S(rts, IMP, 0x0000, 0xE02A, 6)   // E029
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_E02A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE035, 0xE02D, 6)   // E02A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E02D(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xE02F, 3)   // E02D
+    S(lda, IMM, 0x0000, 0xE031, 2)   // E02F
+    S(sta, ZPX, 0x00C1, 0xE033, 4)   // E031
+    S(rts, IMP, 0x0000, 0xE034, 6)   // E033
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_E034(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xE035, 4)   // E034
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E035(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xE037, 3)   // E035
+    S(sta, ZPX, 0x00C1, 0xE039, 4)   // E037
+    S(jmp, AB_, 0xE16E, 0xE03C, 3)   // E039
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E03C(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD1D3, 0xE03F, 6)   // E03C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E03F(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE95, 0xE042, 6)   // E03F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E042(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF9E, 0xE045, 6)   // E042
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E045(cpu *c) {
+    uint32_t cycles = 0;
+    S(bvc, REL, 0x0016, 0xE047, 2)   // E045
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E047(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE5E, 0xE04A, 6)   // E047
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E04A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCF1E, 0xE04D, 6)   // E04A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E04D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0002, 0xE04F, 2)   // E04D
+    S(jsr, AB_, 0xD4C8, 0xE052, 6)   // E04F
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E052(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDDAB, 0xE055, 6)   // E052
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E055(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x0024, 0xE057, 2)   // E055
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E057(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE57, 0xE05A, 6)   // E057
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E05A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xD599, 0xE05D, 3)   // E05A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E05D(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCF1E, 0xE060, 6)   // E05D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E060(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDDAB, 0xE063, 6)   // E060
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E063(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x0006, 0xE065, 2)   // E063
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E065(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE57, 0xE068, 6)   // E065
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E068(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD599, 0xE06B, 6)   // E068
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E06B(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE95, 0xE06E, 6)   // E06B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E06E(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0080, 0xE070, 3)   // E06E
+    S(beq, REL, 0x0009, 0xE072, 2)   // E070
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E072(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCF1E, 0xE075, 6)   // E072
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E075(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE57, 0xE078, 6)   // E075
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E078(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCF1E, 0xE07B, 6)   // E078
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E07B(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xE07C, 6)   // E07B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E07C(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE105, 0xE07F, 6)   // E07C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E07F(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF93, 0xE082, 6)   // E07F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E082(cpu *c) {
+    uint32_t cycles = 0;
+    S(asl, ACC, 0x0000, 0xE083, 2)   // E082
+    S(tax, IMP, 0x0000, 0xE084, 2)   // E083
+    S(lda, ZP_, 0x0085, 0xE086, 3)   // E084
+    S(sta, INX, 0x0099, 0xE088, 6)   // E086
+    S(ldy, ZPX, 0x0099, 0xE08A, 4)   // E088
+    S(iny, IMP, 0x0000, 0xE08B, 2)   // E08A
+    S(bne, REL, 0x0009, 0xE08D, 2)   // E08B
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_E08D(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, ZP_, 0x0082, 0xE08F, 3)   // E08D
+    S(lda, ABY, 0x00C1, 0xE092, 4)   // E08F
+    S(beq, REL, 0x000A, 0xE094, 2)   // E092
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E094(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0002, 0xE096, 2)   // E094
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E096(cpu *c) {
+    uint32_t cycles = 0;
+    S(tya, IMP, 0x0000, 0xE097, 2)   // E096
+    S(ldy, ZP_, 0x0082, 0xE099, 3)   // E097
+    S(cmp, ABY, 0x00C1, 0xE09C, 4)   // E099
+    S(bne, REL, 0x0005, 0xE09E, 2)   // E09C
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_E09E(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0020, 0xE0A0, 2)   // E09E
+    S(jmp, AB_, 0xDD97, 0xE0A3, 3)   // E0A0
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E0A3(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZPX, 0x0099, 0xE0A5, 6)   // E0A3
+    S(bne, REL, 0x0003, 0xE0A7, 2)   // E0A5
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E0A7(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE03C, 0xE0AA, 6)   // E0A7
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E0AA(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xE0AB, 6)   // E0AA
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E0AB(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x00A0, 0xE0AD, 2)   // E0AB
+    S(jsr, AB_, 0xDDA6, 0xE0B0, 6)   // E0AD
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E0B0(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x0027, 0xE0B2, 2)   // E0B0
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E0B2(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0085, 0xE0B4, 3)   // E0B2
+    S(jsr, AB_, 0xE07C, 0xE0B7, 6)   // E0B4
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E0B7(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x00F8, 0xE0B9, 3)   // E0B7
+    S(beq, REL, 0x000D, 0xE0BB, 2)   // E0B9
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E0BB(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xE0BC, 6)   // E0BB
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E0BC(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0020, 0xE0BE, 2)   // E0BC
+    S(jsr, AB_, 0xDDA6, 0xE0C1, 6)   // E0BE
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E0C1(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x0005, 0xE0C3, 2)   // E0C1
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E0C3(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0051, 0xE0C5, 2)   // E0C3
+    S(sta, AB_, 0x026C, 0xE0C8, 4)   // E0C5
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E0C8(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE0F3, 0xE0CB, 6)   // E0C8
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E0CB(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE153, 0xE0CE, 6)   // E0CB
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E0CE(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x026C, 0xE0D1, 4)   // E0CE
+    S(beq, REL, 0x0003, 0xE0D3, 2)   // E0D1
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E0D3(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xC1C8, 0xE0D6, 3)   // E0D3
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E0D6(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xE6BC, 0xE0D9, 3)   // E0D6
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E0D9(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x0080, 0xE0DB, 2)   // E0D9
+    S(bne, REL, 0x0005, 0xE0DD, 2)   // E0DB
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E0DD(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x00F8, 0xE0DF, 3)   // E0DD
+    S(beq, REL, 0x00DB, 0xE0E1, 2)   // E0DF
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E0E1(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xE0E2, 6)   // E0E1
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E0E2(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0085, 0xE0E4, 3)   // E0E2
+    S(pha, IMP, 0x0000, 0xE0E5, 3)   // E0E4
+    S(jsr, AB_, 0xE31C, 0xE0E8, 6)   // E0E5
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E0E8(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xE0E9, 4)   // E0E8
+    S(sta, ZP_, 0x0085, 0xE0EB, 3)   // E0E9
+    S(lda, IMM, 0x0080, 0xE0ED, 2)   // E0EB
+    S(jsr, AB_, 0xDD9D, 0xE0F0, 6)   // E0ED
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_E0F0(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xE0B2, 0xE0F3, 3)   // E0F0
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E0F3(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0020, 0xE0F5, 2)   // E0F3
+    S(jsr, AB_, 0xDDA6, 0xE0F8, 6)   // E0F5
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E0F8(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x000A, 0xE0FA, 2)   // E0F8
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E0FA(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xE0FC, 2)   // E0FA
+    S(sta, ZP_, 0x0085, 0xE0FE, 3)   // E0FC
+    S(jsr, AB_, 0xE07C, 0xE101, 6)   // E0FE
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E101(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xE0F3, 0xE104, 3)   // E101
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E104(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xE105, 6)   // E104
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E105(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0040, 0xE107, 2)   // E105
+    S(jsr, AB_, 0xDD97, 0xE10A, 6)   // E107
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E10A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF9E, 0xE10D, 6)   // E10A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E10D(cpu *c) {
+    uint32_t cycles = 0;
+    S(ora, IMM, 0x0040, 0xE10F, 2)   // E10D
+    S(ldx, AB_, 0x0257, 0xE112, 4)   // E10F
+    S(sta, ZPX, 0x00A7, 0xE114, 4)   // E112
+    S(rts, IMP, 0x0000, 0xE115, 6)   // E114
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_E115(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF9E, 0xE118, 6)   // E115
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E118(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x00BF, 0xE11A, 2)   // E118
+    S(ldx, AB_, 0x0257, 0xE11D, 4)   // E11A
+    S(sta, ZPX, 0x00A7, 0xE11F, 4)   // E11D
+    S(rts, IMP, 0x0000, 0xE120, 6)   // E11F
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_E120(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0080, 0xE122, 2)   // E120
+    S(jsr, AB_, 0xDDA6, 0xE125, 6)   // E122
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E125(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x0037, 0xE127, 2)   // E125
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E127(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD12F, 0xE12A, 6)   // E127
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E12A(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZPX, 0x0099, 0xE12C, 4)   // E12A
+    S(cmp, ABY, 0x0244, 0xE12F, 4)   // E12C
+    S(beq, REL, 0x0022, 0xE131, 2)   // E12F
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E131(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZPX, 0x0099, 0xE133, 6)   // E131
+    S(bne, REL, 0x0006, 0xE135, 2)   // E133
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E135(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE03C, 0xE138, 6)   // E135
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E138(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD12F, 0xE13B, 6)   // E138
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E13B(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INX, 0x0099, 0xE13D, 6)   // E13B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E13D(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ABY, 0x023E, 0xE140, 5)   // E13D
+    S(lda, IMM, 0x0089, 0xE142, 2)   // E140
+    S(sta, ABY, 0x00F2, 0xE145, 5)   // E142
+    S(lda, ZPX, 0x0099, 0xE147, 4)   // E145
+    S(cmp, ABY, 0x0244, 0xE14A, 4)   // E147
+    S(beq, REL, 0x0001, 0xE14C, 2)   // E14A
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_E14C(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xE14D, 6)   // E14C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E14D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0081, 0xE14F, 2)   // E14D
+    S(sta, ABY, 0x00F2, 0xE152, 5)   // E14F
+    S(rts, IMP, 0x0000, 0xE153, 6)   // E152
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E153(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDFD0, 0xE156, 6)   // E153
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E156(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD12F, 0xE159, 6)   // E156
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E159(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0085, 0xE15B, 3)   // E159
+    S(jmp, AB_, 0xE13D, 0xE15E, 3)   // E15B
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E15E(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xE160, 3)   // E15E
+    S(lda, IMM, 0x000D, 0xE162, 2)   // E160
+    S(sta, ABX, 0x023E, 0xE165, 5)   // E162
+    S(lda, IMM, 0x0081, 0xE167, 2)   // E165
+    S(sta, ZPX, 0x00F2, 0xE169, 4)   // E167
+    S(lda, IMM, 0x0050, 0xE16B, 2)   // E169
+    S(jsr, AB_, 0xC1C8, 0xE16E, 6)   // E16B
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_E16E(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xE170, 3)   // E16E
+    S(lda, ZPX, 0x00C1, 0xE172, 4)   // E170
+    S(sta, ZP_, 0x0087, 0xE174, 3)   // E172
+    S(dec, ZP_, 0x0087, 0xE176, 5)   // E174
+    S(cmp, IMM, 0x0002, 0xE178, 2)   // E176
+    S(bne, REL, 0x0004, 0xE17A, 2)   // E178
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_E17A(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x00FF, 0xE17C, 2)   // E17A
+    S(sta, ZP_, 0x0087, 0xE17E, 3)   // E17C
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E17E(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZPX, 0x00C7, 0xE180, 4)   // E17E
+    S(sta, ZP_, 0x0088, 0xE182, 3)   // E180
+    S(jsr, AB_, 0xD4E8, 0xE185, 6)   // E182
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E185(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xE187, 3)   // E185
+    S(cmp, ZP_, 0x0087, 0xE189, 3)   // E187
+    S(bcc, REL, 0x0019, 0xE18B, 2)   // E189
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E18B(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x0017, 0xE18D, 2)   // E18B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E18D(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCF1E, 0xE190, 6)   // E18D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E190(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE1B2, 0xE193, 6)   // E190
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E193(cpu *c) {
+    uint32_t cycles = 0;
+    S(bcc, REL, 0x0008, 0xE195, 2)   // E193
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E195(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xE197, 3)   // E195
+    S(sta, ABX, 0x0244, 0xE19A, 5)   // E197
+    S(jmp, AB_, 0xCF1E, 0xE19D, 3)   // E19A
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E19D(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCF1E, 0xE1A0, 6)   // E19D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E1A0(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x00FF, 0xE1A2, 2)   // E1A0
+    S(sta, ZP_, 0x0087, 0xE1A4, 3)   // E1A2
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E1A4(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE1B2, 0xE1A7, 6)   // E1A4
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E1A7(cpu *c) {
+    uint32_t cycles = 0;
+    S(bcs, REL, 0x0003, 0xE1A9, 2)   // E1A7
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E1A9(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD4E8, 0xE1AC, 6)   // E1A9
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E1AC(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xE1AE, 3)   // E1AC
+    S(sta, ABX, 0x0244, 0xE1B1, 5)   // E1AE
+    S(rts, IMP, 0x0000, 0xE1B2, 6)   // E1B1
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E1B2(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE2B, 0xE1B5, 6)   // E1B2
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E1B5(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, ZP_, 0x0087, 0xE1B7, 3)   // E1B5
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E1B7(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x0094, 0xE1B9, 5)   // E1B7
+    S(bne, REL, 0x000D, 0xE1BB, 2)   // E1B9
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E1BB(cpu *c) {
+    uint32_t cycles = 0;
+    S(dey, IMP, 0x0000, 0xE1BC, 2)   // E1BB
+    S(cpy, IMM, 0x0002, 0xE1BE, 2)   // E1BC
+    S(bcc, REL, 0x0004, 0xE1C0, 2)   // E1BE
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E1C0(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, ZP_, 0x0088, 0xE1C2, 5)   // E1C0
+    S(bne, REL, 0x00F3, 0xE1C4, 2)   // E1C2
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E1C4(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, ZP_, 0x0088, 0xE1C6, 5)   // E1C4
+    S(clc, IMP, 0x0000, 0xE1C7, 2)   // E1C6
+    S(rts, IMP, 0x0000, 0xE1C8, 6)   // E1C7
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E1C8(cpu *c) {
+    uint32_t cycles = 0;
+    S(tya, IMP, 0x0000, 0xE1C9, 2)   // E1C8
+    S(sec, IMP, 0x0000, 0xE1CA, 2)   // E1C9
+    S(rts, IMP, 0x0000, 0xE1CB, 6)   // E1CA
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E1CB(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDED2, 0xE1CE, 6)   // E1CB
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E1CE(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x00D5, 0xE1D0, 3)   // E1CE
+    S(lda, IMM, 0x0004, 0xE1D2, 2)   // E1D0
+    S(sta, ZP_, 0x0094, 0xE1D4, 3)   // E1D2
+    S(ldy, IMM, 0x000A, 0xE1D6, 2)   // E1D4
+    S(bne, REL, 0x0004, 0xE1D8, 2)   // E1D6
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_E1D8(cpu *c) {
+    uint32_t cycles = 0;
+    S(dey, IMP, 0x0000, 0xE1D9, 2)   // E1D8
+    S(dey, IMP, 0x0000, 0xE1DA, 2)   // E1D9
+    S(bmi, REL, 0x0026, 0xE1DC, 2)   // E1DA
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E1DC(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x0094, 0xE1DE, 5)   // E1DC
+    S(beq, REL, 0x00F8, 0xE1E0, 2)   // E1DE
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E1E0(cpu *c) {
+    uint32_t cycles = 0;
+    S(tya, IMP, 0x0000, 0xE1E1, 2)   // E1E0
+    S(lsr, ACC, 0x0000, 0xE1E2, 2)   // E1E1
+    S(cmp, ZP_, 0x00D5, 0xE1E4, 3)   // E1E2
+    S(beq, REL, 0x0009, 0xE1E6, 2)   // E1E4
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_E1E6(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x00D5, 0xE1E8, 3)   // E1E6
+    S(ldx, ZP_, 0x0082, 0xE1EA, 3)   // E1E8
+    S(lda, ZPX, 0x00CD, 0xE1EC, 4)   // E1EA
+    S(jsr, AB_, 0xDF1B, 0xE1EF, 6)   // E1EC
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_E1EF(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0000, 0xE1F1, 2)   // E1EF
+    S(sty, ZP_, 0x0094, 0xE1F3, 3)   // E1F1
+    S(lda, INY, 0x0094, 0xE1F5, 5)   // E1F3
+    S(bne, REL, 0x000B, 0xE1F7, 2)   // E1F5
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_E1F7(cpu *c) {
+    uint32_t cycles = 0;
+    S(iny, IMP, 0x0000, 0xE1F8, 2)   // E1F7
+    S(lda, INY, 0x0094, 0xE1FA, 5)   // E1F8
+    S(tay, IMP, 0x0000, 0xE1FB, 2)   // E1FA
+    S(dey, IMP, 0x0000, 0xE1FC, 2)   // E1FB
+    S(sty, ZP_, 0x00D6, 0xE1FE, 3)   // E1FC
+    S(tya, IMP, 0x0000, 0xE1FF, 2)   // E1FE
+    S(jmp, AB_, 0xDEE9, 0xE202, 3)   // E1FF
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_E202(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0067, 0xE204, 2)   // E202
+    S(jsr, AB_, 0xE645, 0xE207, 6)   // E204
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E207(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC2B3, 0xE20A, 6)   // E207
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E20A(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0201, 0xE20D, 4)   // E20A
+    S(sta, ZP_, 0x0083, 0xE20F, 3)   // E20D
+    S(jsr, AB_, 0xD0EB, 0xE212, 6)   // E20F
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E212(cpu *c) {
+    uint32_t cycles = 0;
+    S(bcc, REL, 0x0005, 0xE214, 2)   // E212
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E214(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0070, 0xE216, 2)   // E214
+    S(jsr, AB_, 0xC1C8, 0xE219, 6)   // E216
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E219(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x00A0, 0xE21B, 2)   // E219
+    S(jsr, AB_, 0xDD9D, 0xE21E, 6)   // E21B
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E21E(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD125, 0xE221, 6)   // E21E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E221(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x0005, 0xE223, 2)   // E221
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E223(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0064, 0xE225, 2)   // E223
+    S(jsr, AB_, 0xC1C8, 0xE228, 6)   // E225
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E228(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZPX, 0x00EC, 0xE22A, 4)   // E228
+    S(and, IMM, 0x0001, 0xE22C, 2)   // E22A
+    S(sta, ZP_, 0x007F, 0xE22E, 3)   // E22C
+    S(lda, AB_, 0x0202, 0xE231, 4)   // E22E
+    S(sta, ZPX, 0x00B5, 0xE233, 4)   // E231
+    S(lda, AB_, 0x0203, 0xE236, 4)   // E233
+    S(sta, ZPX, 0x00BB, 0xE238, 4)   // E236
+    S(ldx, ZP_, 0x0082, 0xE23A, 3)   // E238
+    S(lda, IMM, 0x0089, 0xE23C, 2)   // E23A
+    S(sta, ZPX, 0x00F2, 0xE23E, 4)   // E23C
+    S(lda, AB_, 0x0204, 0xE241, 4)   // E23E
+    S(beq, REL, 0x0010, 0xE243, 2)   // E241
+    c->executed += 12;
+    return cycles;
+}
+
+static inline uint32_t rom_E243(cpu *c) {
+    uint32_t cycles = 0;
+    S(sec, IMP, 0x0000, 0xE244, 2)   // E243
+    S(sbc, IMM, 0x0001, 0xE246, 2)   // E244
+    S(beq, REL, 0x000B, 0xE248, 2)   // E246
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E248(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, ZPX, 0x00C7, 0xE24A, 4)   // E248
+    S(bcc, REL, 0x0007, 0xE24C, 2)   // E24A
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E24C(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0051, 0xE24E, 2)   // E24C
+    S(sta, AB_, 0x026C, 0xE251, 4)   // E24E
+    S(lda, IMM, 0x0000, 0xE253, 2)   // E251
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E253(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x00D4, 0xE255, 3)   // E253
+    S(jsr, AB_, 0xCE0E, 0xE258, 6)   // E255
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E258(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDEF8, 0xE25B, 6)   // E258
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E25B(cpu *c) {
+    uint32_t cycles = 0;
+    S(bvc, REL, 0x0008, 0xE25D, 2)   // E25B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E25D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0080, 0xE25F, 2)   // E25D
+    S(jsr, AB_, 0xDD97, 0xE262, 6)   // E25F
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E262(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xE15E, 0xE265, 3)   // E262
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E265(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE275, 0xE268, 6)   // E265
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E268(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0080, 0xE26A, 2)   // E268
+    S(jsr, AB_, 0xDDA6, 0xE26D, 6)   // E26A
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E26D(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x0003, 0xE26F, 2)   // E26D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E26F(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xE15E, 0xE272, 3)   // E26F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E272(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xC194, 0xE275, 3)   // E272
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E275(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE29C, 0xE278, 6)   // E275
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E278(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x00D7, 0xE27A, 3)   // E278
+    S(jsr, AB_, 0xD4C8, 0xE27D, 6)   // E27A
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E27D(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xE27F, 3)   // E27D
+    S(lda, ZPX, 0x00C7, 0xE281, 4)   // E27F
+    S(sec, IMP, 0x0000, 0xE282, 2)   // E281
+    S(sbc, ZP_, 0x00D4, 0xE284, 3)   // E282
+    S(bcs, REL, 0x0003, 0xE286, 2)   // E284
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_E286(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xE202, 0xE289, 3)   // E286
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E289(cpu *c) {
+    uint32_t cycles = 0;
+    S(clc, IMP, 0x0000, 0xE28A, 2)   // E289
+    S(adc, ZP_, 0x00D7, 0xE28C, 3)   // E28A
+    S(bcc, REL, 0x0003, 0xE28E, 2)   // E28C
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E28E(cpu *c) {
+    uint32_t cycles = 0;
+    S(adc, IMM, 0x0001, 0xE290, 2)   // E28E
+    S(sec, IMP, 0x0000, 0xE291, 2)   // E290
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E291(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE009, 0xE294, 6)   // E291
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E294(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xE138, 0xE297, 3)   // E294
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E29C(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0094, 0xE29E, 3)   // E29C
+    S(sta, ZP_, 0x0089, 0xE2A0, 3)   // E29E
+    S(lda, ZP_, 0x0095, 0xE2A2, 3)   // E2A0
+    S(sta, ZP_, 0x008A, 0xE2A4, 3)   // E2A2
+    S(jsr, AB_, 0xE2D0, 0xE2A7, 6)   // E2A4
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_E2A7(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x0001, 0xE2A9, 2)   // E2A7
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E2A9(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xE2AA, 6)   // E2A9
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E2AA(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDDF1, 0xE2AD, 6)   // E2AA
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E2AD(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE0C, 0xE2B0, 6)   // E2AD
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E2B0(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0080, 0xE2B2, 3)   // E2B0
+    S(beq, REL, 0x000E, 0xE2B4, 2)   // E2B2
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E2B4(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE2D3, 0xE2B7, 6)   // E2B4
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E2B7(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x0006, 0xE2B9, 2)   // E2B7
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E2B9(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCF1E, 0xE2BC, 6)   // E2B9
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E2BC(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xD2DA, 0xE2BF, 3)   // E2BC
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E2BF(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD2DA, 0xE2C2, 6)   // E2BF
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E2C2(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0000, 0xE2C4, 2)   // E2C2
+    S(lda, INY, 0x0089, 0xE2C6, 5)   // E2C4
+    S(sta, ZP_, 0x0080, 0xE2C8, 3)   // E2C6
+    S(iny, IMP, 0x0000, 0xE2C9, 2)   // E2C8
+    S(lda, INY, 0x0089, 0xE2CB, 5)   // E2C9
+    S(sta, ZP_, 0x0081, 0xE2CD, 3)   // E2CB
+    S(jmp, AB_, 0xD0AF, 0xE2D0, 3)   // E2CD
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_E2D0(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE3E, 0xE2D3, 6)   // E2D0
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E2D3(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0000, 0xE2D5, 2)   // E2D3
+    S(lda, INY, 0x0089, 0xE2D7, 5)   // E2D5
+    S(cmp, ZP_, 0x0080, 0xE2D9, 3)   // E2D7
+    S(beq, REL, 0x0001, 0xE2DB, 2)   // E2D9
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_E2DB(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xE2DC, 6)   // E2DB
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E2DC(cpu *c) {
+    uint32_t cycles = 0;
+    S(iny, IMP, 0x0000, 0xE2DD, 2)   // E2DC
+    S(lda, INY, 0x0089, 0xE2DF, 5)   // E2DD
+    S(cmp, ZP_, 0x0081, 0xE2E1, 3)   // E2DF
+    S(rts, IMP, 0x0000, 0xE2E2, 6)   // E2E1
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_E2E2(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE2B, 0xE2E5, 6)   // E2E2
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E2E5(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0002, 0xE2E7, 2)   // E2E5
+    S(lda, IMM, 0x0000, 0xE2E9, 2)   // E2E7
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E2E9(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, INY, 0x0094, 0xE2EB, 6)   // E2E9
+    S(iny, IMP, 0x0000, 0xE2EC, 2)   // E2EB
+    S(bne, REL, 0x00FB, 0xE2EE, 2)   // E2EC
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E2EE(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE304, 0xE2F1, 6)   // E2EE
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E2F1(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZPX, 0x00C1, 0xE2F3, 4)   // E2F1
+    S(tay, IMP, 0x0000, 0xE2F4, 2)   // E2F3
+    S(lda, IMM, 0x00FF, 0xE2F6, 2)   // E2F4
+    S(sta, INY, 0x0094, 0xE2F8, 6)   // E2F6
+    S(jsr, AB_, 0xE304, 0xE2FB, 6)   // E2F8
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_E2FB(cpu *c) {
+    uint32_t cycles = 0;
+    S(bcc, REL, 0x00F4, 0xE2FD, 2)   // E2FB
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E2FD(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x0004, 0xE2FF, 2)   // E2FD
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E2FF(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xE301, 2)   // E2FF
+    S(sta, ZPX, 0x00C1, 0xE303, 4)   // E301
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E303(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xE304, 6)   // E303
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E304(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xE306, 3)   // E304
+    S(lda, ZPX, 0x00C1, 0xE308, 4)   // E306
+    S(sec, IMP, 0x0000, 0xE309, 2)   // E308
+    S(beq, REL, 0x000D, 0xE30B, 2)   // E309
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_E30B(cpu *c) {
+    uint32_t cycles = 0;
+    S(clc, IMP, 0x0000, 0xE30C, 2)   // E30B
+    S(adc, ZPX, 0x00C7, 0xE30E, 4)   // E30C
+    S(bcc, REL, 0x000B, 0xE310, 2)   // E30E
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E310(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x0006, 0xE312, 2)   // E310
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E312(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0002, 0xE314, 2)   // E312
+    S(bit, AB_, 0xFECC, 0xE317, 4)   // E314
+    S(rts, IMP, 0x0000, 0xE318, 6)   // E317
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E318(cpu *c) {
+    uint32_t cycles = 0;
+    S(adc, IMM, 0x0001, 0xE31A, 2)   // E318
+    S(sec, IMP, 0x0000, 0xE31B, 2)   // E31A
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E31B(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xE31C, 6)   // E31B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E31C(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD1D3, 0xE31F, 6)   // E31C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E31F(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE1CB, 0xE322, 6)   // E31F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E322(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE29C, 0xE325, 6)   // E322
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E325(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCF7B, 0xE328, 6)   // E325
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E328(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x00D6, 0xE32A, 3)   // E328
+    S(sta, ZP_, 0x0087, 0xE32C, 3)   // E32A
+    S(lda, ZP_, 0x00D5, 0xE32E, 3)   // E32C
+    S(sta, ZP_, 0x0086, 0xE330, 3)   // E32E
+    S(lda, IMM, 0x0000, 0xE332, 2)   // E330
+    S(sta, ZP_, 0x0088, 0xE334, 3)   // E332
+    S(lda, IMM, 0x0000, 0xE336, 2)   // E334
+    S(sta, ZP_, 0x00D4, 0xE338, 3)   // E336
+    S(jsr, AB_, 0xCE0E, 0xE33B, 6)   // E338
+    c->executed += 9;
+    return cycles;
+}
+
+static inline uint32_t rom_E33B(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xEF4D, 0xE33E, 6)   // E33B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E33E(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, ZP_, 0x0082, 0xE340, 3)   // E33E
+    S(ldx, ZPY, 0x00C7, 0xE342, 4)   // E340
+    S(dex, IMP, 0x0000, 0xE343, 2)   // E342
+    S(txa, IMP, 0x0000, 0xE344, 2)   // E343
+    S(clc, IMP, 0x0000, 0xE345, 2)   // E344
+    S(adc, ZP_, 0x00D7, 0xE347, 3)   // E345
+    S(bcc, REL, 0x000C, 0xE349, 2)   // E347
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_E349(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZP_, 0x00D6, 0xE34B, 5)   // E349
+    S(inc, ZP_, 0x00D6, 0xE34D, 5)   // E34B
+    S(bne, REL, 0x0006, 0xE34F, 2)   // E34D
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E34F(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZP_, 0x00D5, 0xE351, 5)   // E34F
+    S(lda, IMM, 0x0010, 0xE353, 2)   // E351
+    S(sta, ZP_, 0x00D6, 0xE355, 3)   // E353
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E355(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0087, 0xE357, 3)   // E355
+    S(clc, IMP, 0x0000, 0xE358, 2)   // E357
+    S(adc, IMM, 0x0002, 0xE35A, 2)   // E358
+    S(jsr, AB_, 0xDEE9, 0xE35D, 6)   // E35A
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_E35D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x00D5, 0xE35F, 3)   // E35D
+    S(cmp, IMM, 0x0006, 0xE361, 2)   // E35F
+    S(bcc, REL, 0x0005, 0xE363, 2)   // E361
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E363(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0052, 0xE365, 2)   // E363
+    S(jsr, AB_, 0xC1C8, 0xE368, 6)   // E365
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E368(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x00D6, 0xE36A, 3)   // E368
+    S(sec, IMP, 0x0000, 0xE36B, 2)   // E36A
+    S(sbc, ZP_, 0x0087, 0xE36D, 3)   // E36B
+    S(bcs, REL, 0x0003, 0xE36F, 2)   // E36D
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_E36F(cpu *c) {
+    uint32_t cycles = 0;
+    S(sbc, IMM, 0x000F, 0xE371, 2)   // E36F
+    S(clc, IMP, 0x0000, 0xE372, 2)   // E371
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E372(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0072, 0xE374, 3)   // E372
+    S(lda, ZP_, 0x00D5, 0xE376, 3)   // E374
+    S(sbc, ZP_, 0x0086, 0xE378, 3)   // E376
+    S(sta, ZP_, 0x0073, 0xE37A, 3)   // E378
+    S(ldx, IMM, 0x0000, 0xE37C, 2)   // E37A
+    S(stx, ZP_, 0x0070, 0xE37E, 3)   // E37C
+    S(stx, ZP_, 0x0071, 0xE380, 3)   // E37E
+    S(tax, IMP, 0x0000, 0xE381, 2)   // E380
+    S(jsr, AB_, 0xDF51, 0xE384, 6)   // E381
+    c->executed += 9;
+    return cycles;
+}
+
+static inline uint32_t rom_E384(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0071, 0xE386, 3)   // E384
+    S(bne, REL, 0x0007, 0xE388, 2)   // E386
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E388(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0070, 0xE38A, 3)   // E388
+    S(dex, IMP, 0x0000, 0xE38B, 2)   // E38A
+    S(bne, REL, 0x0002, 0xE38D, 2)   // E38B
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E38D(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZP_, 0x0088, 0xE38F, 5)   // E38D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E38F(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, AB_, 0x0273, 0xE392, 4)   // E38F
+    S(bcc, REL, 0x0009, 0xE394, 2)   // E392
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E394(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x00CD, 0xE396, 2)   // E394
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E396(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0272, 0xE399, 4)   // E396
+    S(cmp, ZP_, 0x0070, 0xE39B, 3)   // E399
+    S(bcc, REL, 0x00C6, 0xE39D, 2)   // E39B
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E39D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0001, 0xE39F, 2)   // E39D
+    S(jsr, AB_, 0xD4F6, 0xE3A2, 6)   // E39F
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E3A2(cpu *c) {
+    uint32_t cycles = 0;
+    S(clc, IMP, 0x0000, 0xE3A3, 2)   // E3A2
+    S(adc, IMM, 0x0001, 0xE3A5, 2)   // E3A3
+    S(ldx, ZP_, 0x0082, 0xE3A7, 3)   // E3A5
+    S(sta, ZPX, 0x00C1, 0xE3A9, 4)   // E3A7
+    S(jsr, AB_, 0xF11E, 0xE3AC, 6)   // E3A9
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_E3AC(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDDFD, 0xE3AF, 6)   // E3AC
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E3AF(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0088, 0xE3B1, 3)   // E3AF
+    S(bne, REL, 0x0015, 0xE3B3, 2)   // E3B1
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E3B3(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE5E, 0xE3B6, 6)   // E3B3
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E3B6(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCF1E, 0xE3B9, 6)   // E3B6
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E3B9(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD6D0, 0xE3BC, 6)   // E3B9
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E3BC(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF11E, 0xE3BF, 6)   // E3BC
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E3BF(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDDFD, 0xE3C2, 6)   // E3BF
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E3C2(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE2E2, 0xE3C5, 6)   // E3C2
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E3C5(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xE3D4, 0xE3C8, 3)   // E3C5
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E3C8(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCF1E, 0xE3CB, 6)   // E3C8
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E3CB(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD6D0, 0xE3CE, 6)   // E3CB
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E3CE(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE2E2, 0xE3D1, 6)   // E3CE
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E3D1(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE19, 0xE3D4, 6)   // E3D1
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E3D4(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE5E, 0xE3D7, 6)   // E3D4
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E3D7(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE0C, 0xE3DA, 6)   // E3D7
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E3DA(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0080, 0xE3DC, 3)   // E3DA
+    S(pha, IMP, 0x0000, 0xE3DD, 3)   // E3DC
+    S(lda, ZP_, 0x0081, 0xE3DF, 3)   // E3DD
+    S(pha, IMP, 0x0000, 0xE3E0, 3)   // E3DF
+    S(jsr, AB_, 0xDE3E, 0xE3E3, 6)   // E3E0
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_E3E3(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0081, 0xE3E5, 3)   // E3E3
+    S(pha, IMP, 0x0000, 0xE3E6, 3)   // E3E5
+    S(lda, ZP_, 0x0080, 0xE3E8, 3)   // E3E6
+    S(pha, IMP, 0x0000, 0xE3E9, 3)   // E3E8
+    S(jsr, AB_, 0xDF45, 0xE3EC, 6)   // E3E9
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_E3EC(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xE3ED, 2)   // E3EC
+    S(bne, REL, 0x000A, 0xE3EF, 2)   // E3ED
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E3EF(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE44E, 0xE3F2, 6)   // E3EF
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E3F2(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0010, 0xE3F4, 2)   // E3F2
+    S(jsr, AB_, 0xDEE9, 0xE3F7, 6)   // E3F4
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E3F7(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZP_, 0x0086, 0xE3F9, 5)   // E3F7
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E3F9(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xE3FA, 4)   // E3F9
+    S(jsr, AB_, 0xDD8D, 0xE3FD, 6)   // E3FA
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E3FD(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xE3FE, 4)   // E3FD
+    S(jsr, AB_, 0xDD8D, 0xE401, 6)   // E3FE
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E401(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xE402, 4)   // E401
+    S(sta, ZP_, 0x0081, 0xE404, 3)   // E402
+    S(pla, IMP, 0x0000, 0xE405, 4)   // E404
+    S(sta, ZP_, 0x0080, 0xE407, 3)   // E405
+    S(beq, REL, 0x000F, 0xE409, 2)   // E407
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_E409(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0086, 0xE40B, 3)   // E409
+    S(cmp, ZP_, 0x00D5, 0xE40D, 3)   // E40B
+    S(bne, REL, 0x00A7, 0xE40F, 2)   // E40D
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E40F(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF45, 0xE412, 6)   // E40F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E412(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, ZP_, 0x00D6, 0xE414, 3)   // E412
+    S(bcc, REL, 0x00A0, 0xE416, 2)   // E414
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E416(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x00B0, 0xE418, 2)   // E416
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E418(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF45, 0xE41B, 6)   // E418
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E41B(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xE41C, 3)   // E41B
+    S(lda, IMM, 0x0000, 0xE41E, 2)   // E41C
+    S(jsr, AB_, 0xDEDC, 0xE421, 6)   // E41E
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E421(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xE423, 2)   // E421
+    S(tay, IMP, 0x0000, 0xE424, 2)   // E423
+    S(sta, INY, 0x0094, 0xE426, 6)   // E424
+    S(iny, IMP, 0x0000, 0xE427, 2)   // E426
+    S(pla, IMP, 0x0000, 0xE428, 4)   // E427
+    S(sec, IMP, 0x0000, 0xE429, 2)   // E428
+    S(sbc, IMM, 0x0001, 0xE42B, 2)   // E429
+    S(sta, INY, 0x0094, 0xE42D, 6)   // E42B
+    S(jsr, AB_, 0xDE6C, 0xE430, 6)   // E42D
+    c->executed += 9;
+    return cycles;
+}
+
+static inline uint32_t rom_E430(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD599, 0xE433, 6)   // E430
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E433(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xEEF4, 0xE436, 6)   // E433
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E436(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCE0E, 0xE439, 6)   // E436
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E439(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCF1E, 0xE43C, 6)   // E439
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E43C(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDEF8, 0xE43F, 6)   // E43C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E43F(cpu *c) {
+    uint32_t cycles = 0;
+    S(bvs, REL, 0x0003, 0xE441, 2)   // E43F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E441(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xE275, 0xE444, 3)   // E441
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E444(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0080, 0xE446, 2)   // E444
+    S(jsr, AB_, 0xDD97, 0xE449, 6)   // E446
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E449(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0050, 0xE44B, 2)   // E449
+    S(jsr, AB_, 0xC1C8, 0xE44E, 6)   // E44B
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E44E(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF11E, 0xE451, 6)   // E44E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E451(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCF1E, 0xE454, 6)   // E451
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E454(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDDF1, 0xE457, 6)   // E454
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E457(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF93, 0xE45A, 6)   // E457
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E45A(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xE45B, 3)   // E45A
+    S(jsr, AB_, 0xDEC1, 0xE45E, 6)   // E45B
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E45E(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xE460, 3)   // E45E
+    S(lda, ZPX, 0x00CD, 0xE462, 4)   // E460
+    S(tay, IMP, 0x0000, 0xE463, 2)   // E462
+    S(pla, IMP, 0x0000, 0xE464, 4)   // E463
+    S(tax, IMP, 0x0000, 0xE465, 2)   // E464
+    S(lda, IMM, 0x0010, 0xE467, 2)   // E465
+    S(jsr, AB_, 0xDEA5, 0xE46A, 6)   // E467
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_E46A(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xE46C, 2)   // E46A
+    S(jsr, AB_, 0xDEDC, 0xE46F, 6)   // E46C
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E46F(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0002, 0xE471, 2)   // E46F
+    S(lda, INY, 0x0094, 0xE473, 5)   // E471
+    S(pha, IMP, 0x0000, 0xE474, 3)   // E473
+    S(lda, IMM, 0x0000, 0xE476, 2)   // E474
+    S(jsr, AB_, 0xD4C8, 0xE479, 6)   // E476
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_E479(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xE47A, 4)   // E479
+    S(clc, IMP, 0x0000, 0xE47B, 2)   // E47A
+    S(adc, IMM, 0x0001, 0xE47D, 2)   // E47B
+    S(sta, INY, 0x0094, 0xE47F, 6)   // E47D
+    S(asl, ACC, 0x0000, 0xE480, 2)   // E47F
+    S(adc, IMM, 0x0004, 0xE482, 2)   // E480
+    S(sta, ZP_, 0x0089, 0xE484, 3)   // E482
+    S(tay, IMP, 0x0000, 0xE485, 2)   // E484
+    S(sec, IMP, 0x0000, 0xE486, 2)   // E485
+    S(sbc, IMM, 0x0002, 0xE488, 2)   // E486
+    S(sta, ZP_, 0x008A, 0xE48A, 3)   // E488
+    S(lda, ZP_, 0x0080, 0xE48C, 3)   // E48A
+    S(sta, ZP_, 0x0087, 0xE48E, 3)   // E48C
+    S(sta, INY, 0x0094, 0xE490, 6)   // E48E
+    S(iny, IMP, 0x0000, 0xE491, 2)   // E490
+    S(lda, ZP_, 0x0081, 0xE493, 3)   // E491
+    S(sta, ZP_, 0x0088, 0xE495, 3)   // E493
+    S(sta, INY, 0x0094, 0xE497, 6)   // E495
+    S(ldy, IMM, 0x0000, 0xE499, 2)   // E497
+    S(tya, IMP, 0x0000, 0xE49A, 2)   // E499
+    S(sta, INY, 0x0094, 0xE49C, 6)   // E49A
+    S(iny, IMP, 0x0000, 0xE49D, 2)   // E49C
+    S(lda, IMM, 0x0011, 0xE49F, 2)   // E49D
+    S(sta, INY, 0x0094, 0xE4A1, 6)   // E49F
+    S(lda, IMM, 0x0010, 0xE4A3, 2)   // E4A1
+    S(jsr, AB_, 0xD4C8, 0xE4A6, 6)   // E4A3
+    c->executed += 26;
+    return cycles;
+}
+
+static inline uint32_t rom_E4A6(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE50, 0xE4A9, 6)   // E4A6
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E4A9(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD599, 0xE4AC, 6)   // E4A9
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E4AC(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xE4AE, 3)   // E4AC
+    S(lda, ZPX, 0x00CD, 0xE4B0, 4)   // E4AE
+    S(pha, IMP, 0x0000, 0xE4B1, 3)   // E4B0
+    S(jsr, AB_, 0xDF9E, 0xE4B4, 6)   // E4B1
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_E4B4(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xE4B6, 3)   // E4B4
+    S(sta, ZPX, 0x00CD, 0xE4B8, 4)   // E4B6
+    S(pla, IMP, 0x0000, 0xE4B9, 4)   // E4B8
+    S(ldx, AB_, 0x0257, 0xE4BC, 4)   // E4B9
+    S(sta, ZPX, 0x00A7, 0xE4BE, 4)   // E4BC
+    S(lda, IMM, 0x0000, 0xE4C0, 2)   // E4BE
+    S(jsr, AB_, 0xD4C8, 0xE4C3, 6)   // E4C0
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_E4C3(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0000, 0xE4C5, 2)   // E4C3
+    S(lda, ZP_, 0x0080, 0xE4C7, 3)   // E4C5
+    S(sta, INY, 0x0094, 0xE4C9, 6)   // E4C7
+    S(iny, IMP, 0x0000, 0xE4CA, 2)   // E4C9
+    S(lda, ZP_, 0x0081, 0xE4CC, 3)   // E4CA
+    S(sta, INY, 0x0094, 0xE4CE, 6)   // E4CC
+    S(jmp, AB_, 0xE4DE, 0xE4D1, 3)   // E4CE
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_E4D1(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF93, 0xE4D4, 6)   // E4D1
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E4D4(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xE4D6, 3)   // E4D4
+    S(jsr, AB_, 0xDF1B, 0xE4D9, 6)   // E4D6
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E4D9(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xE4DB, 2)   // E4D9
+    S(jsr, AB_, 0xD4C8, 0xE4DE, 6)   // E4DB
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E4DE(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, ZP_, 0x008A, 0xE4E0, 5)   // E4DE
+    S(dec, ZP_, 0x008A, 0xE4E2, 5)   // E4E0
+    S(ldy, ZP_, 0x0089, 0xE4E4, 3)   // E4E2
+    S(lda, ZP_, 0x0087, 0xE4E6, 3)   // E4E4
+    S(sta, INY, 0x0094, 0xE4E8, 6)   // E4E6
+    S(iny, IMP, 0x0000, 0xE4E9, 2)   // E4E8
+    S(lda, ZP_, 0x0088, 0xE4EB, 3)   // E4E9
+    S(sta, INY, 0x0094, 0xE4ED, 6)   // E4EB
+    S(jsr, AB_, 0xDE5E, 0xE4F0, 6)   // E4ED
+    c->executed += 9;
+    return cycles;
+}
+
+static inline uint32_t rom_E4F0(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD599, 0xE4F3, 6)   // E4F0
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E4F3(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, ZP_, 0x008A, 0xE4F5, 3)   // E4F3
+    S(cpy, IMM, 0x0003, 0xE4F7, 2)   // E4F5
+    S(bcs, REL, 0x00D8, 0xE4F9, 2)   // E4F7
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E4F9(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xCF1E, 0xE4FC, 3)   // E4F9
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E60A(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xE60B, 3)   // E60A
+    S(stx, ZP_, 0x00F9, 0xE60D, 3)   // E60B
+    S(txa, IMP, 0x0000, 0xE60E, 2)   // E60D
+    S(asl, ACC, 0x0000, 0xE60F, 2)   // E60E
+    S(tax, IMP, 0x0000, 0xE610, 2)   // E60F
+    S(lda, ZPX, 0x0006, 0xE612, 4)   // E610
+    S(sta, ZP_, 0x0080, 0xE614, 3)   // E612
+    S(lda, ZPX, 0x0007, 0xE616, 4)   // E614
+    S(sta, ZP_, 0x0081, 0xE618, 3)   // E616
+    S(pla, IMP, 0x0000, 0xE619, 4)   // E618
+    S(and, IMM, 0x000F, 0xE61B, 2)   // E619
+    S(beq, REL, 0x0008, 0xE61D, 2)   // E61B
+    c->executed += 12;
+    return cycles;
+}
+
+static inline uint32_t rom_E61D(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x000F, 0xE61F, 2)   // E61D
+    S(bne, REL, 0x0006, 0xE621, 2)   // E61F
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E621(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0074, 0xE623, 2)   // E621
+    S(bne, REL, 0x0008, 0xE625, 2)   // E623
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E625(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0006, 0xE627, 2)   // E625
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E627(cpu *c) {
+    uint32_t cycles = 0;
+    S(ora, IMM, 0x0020, 0xE629, 2)   // E627
+    S(tax, IMP, 0x0000, 0xE62A, 2)   // E629
+    S(dex, IMP, 0x0000, 0xE62B, 2)   // E62A
+    S(dex, IMP, 0x0000, 0xE62C, 2)   // E62B
+    S(txa, IMP, 0x0000, 0xE62D, 2)   // E62C
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_E62D(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xE62E, 3)   // E62D
+    S(lda, AB_, 0x022A, 0xE631, 4)   // E62E
+    S(cmp, IMM, 0x0000, 0xE633, 2)   // E631
+    S(bne, REL, 0x000F, 0xE635, 2)   // E633
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_E635(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x00FF, 0xE637, 2)   // E635
+    S(sta, AB_, 0x022A, 0xE63A, 4)   // E637
+    S(pla, IMP, 0x0000, 0xE63B, 4)   // E63A
+    S(jsr, AB_, 0xE6C7, 0xE63E, 6)   // E63B
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_E63E(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD042, 0xE641, 6)   // E63E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E641(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xE648, 0xE644, 3)   // E641
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E644(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xE645, 4)   // E644
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E645(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE6C7, 0xE648, 6)   // E645
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E648(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC1BD, 0xE64B, 6)   // E648
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E64B(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xE64D, 2)   // E64B
+    S(sta, AB_, 0x02F9, 0xE650, 4)   // E64D
+    S(jsr, AB_, 0xC12C, 0xE653, 6)   // E650
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E653(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD4DA, 0xE656, 6)   // E653
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E656(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xE658, 2)   // E656
+    S(sta, ZP_, 0x00A3, 0xE65A, 3)   // E658
+    S(ldx, IMM, 0x0045, 0xE65C, 2)   // E65A
+    S(txs, IMP, 0x0000, 0xE65D, 2)   // E65C
+    S(lda, ZP_, 0x0084, 0xE65F, 3)   // E65D
+    S(and, IMM, 0x000F, 0xE661, 2)   // E65F
+    S(sta, ZP_, 0x0083, 0xE663, 3)   // E661
+    S(cmp, IMM, 0x000F, 0xE665, 2)   // E663
+    S(beq, REL, 0x0031, 0xE667, 2)   // E665
+    c->executed += 9;
+    return cycles;
+}
+
+static inline uint32_t rom_E667(cpu *c) {
+    uint32_t cycles = 0;
+    S(sei, IMP, 0x0000, 0xE668, 2)   // E667
+    S(lda, ZP_, 0x0079, 0xE66A, 3)   // E668
+    S(bne, REL, 0x001C, 0xE66C, 2)   // E66A
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E66C(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x007A, 0xE66E, 3)   // E66C
+    S(bne, REL, 0x0010, 0xE670, 2)   // E66E
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E670(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0083, 0xE672, 3)   // E670
+    S(lda, ABX, 0x022B, 0xE675, 4)   // E672
+    S(cmp, IMM, 0x00FF, 0xE677, 2)   // E675
+    S(beq, REL, 0x001F, 0xE679, 2)   // E677
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_E679(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x000F, 0xE67B, 2)   // E679
+    S(sta, ZP_, 0x0082, 0xE67D, 3)   // E67B
+    S(jmp, AB_, 0xE68E, 0xE680, 3)   // E67D
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E680(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD0EB, 0xE683, 6)   // E680
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E683(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xEA4E, 0xE686, 6)   // E683
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E686(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x0006, 0xE688, 2)   // E686
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E688(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD107, 0xE68B, 6)   // E688
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E68B(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xEA4E, 0xE68E, 6)   // E68B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E68E(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD125, 0xE691, 6)   // E68E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E691(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0004, 0xE693, 2)   // E691
+    S(bcs, REL, 0x0003, 0xE695, 2)   // E693
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E695(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD227, 0xE698, 6)   // E695
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E698(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xEBE7, 0xE69B, 3)   // E698
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E69B(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xE69C, 2)   // E69B
+    S(lda, IMM, 0x0000, 0xE69E, 2)   // E69C
+    S(sed, IMP, 0x0000, 0xE69F, 2)   // E69E
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E69F(cpu *c) {
+    uint32_t cycles = 0;
+    S(cpx, IMM, 0x0000, 0xE6A1, 2)   // E69F
+    S(beq, REL, 0x0007, 0xE6A3, 2)   // E6A1
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E6A3(cpu *c) {
+    uint32_t cycles = 0;
+    S(clc, IMP, 0x0000, 0xE6A4, 2)   // E6A3
+    S(adc, IMM, 0x0001, 0xE6A6, 2)   // E6A4
+    S(dex, IMP, 0x0000, 0xE6A7, 2)   // E6A6
+    S(jmp, AB_, 0xE69F, 0xE6AA, 3)   // E6A7
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_E6AA(cpu *c) {
+    uint32_t cycles = 0;
+    S(cld, IMP, 0x0000, 0xE6AB, 2)   // E6AA
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E6AB(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xE6AC, 2)   // E6AB
+    S(lsr, ACC, 0x0000, 0xE6AD, 2)   // E6AC
+    S(lsr, ACC, 0x0000, 0xE6AE, 2)   // E6AD
+    S(lsr, ACC, 0x0000, 0xE6AF, 2)   // E6AE
+    S(lsr, ACC, 0x0000, 0xE6B0, 2)   // E6AF
+    S(jsr, AB_, 0xE6B4, 0xE6B3, 6)   // E6B0
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_E6B3(cpu *c) {
+    uint32_t cycles = 0;
+    S(txa, IMP, 0x0000, 0xE6B4, 2)   // E6B3
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E6B4(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x000F, 0xE6B6, 2)   // E6B4
+    S(ora, IMM, 0x0030, 0xE6B8, 2)   // E6B6
+    S(sta, INY, 0x00A5, 0xE6BA, 6)   // E6B8
+    S(iny, IMP, 0x0000, 0xE6BB, 2)   // E6BA
+    S(rts, IMP, 0x0000, 0xE6BC, 6)   // E6BB
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_E6BC(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC123, 0xE6BF, 6)   // E6BC
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E6BF(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xE6C1, 2)   // E6BF
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E6C1(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0000, 0xE6C3, 2)   // E6C1
+    S(sty, ZP_, 0x0080, 0xE6C5, 3)   // E6C3
+    S(sty, ZP_, 0x0081, 0xE6C7, 3)   // E6C5
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E6C7(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0000, 0xE6C9, 2)   // E6C7
+    S(ldx, IMM, 0x00D5, 0xE6CB, 2)   // E6C9
+    S(stx, ZP_, 0x00A5, 0xE6CD, 3)   // E6CB
+    S(ldx, IMM, 0x0002, 0xE6CF, 2)   // E6CD
+    S(stx, ZP_, 0x00A6, 0xE6D1, 3)   // E6CF
+    S(jsr, AB_, 0xE6AB, 0xE6D4, 6)   // E6D1
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_E6D4(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x002C, 0xE6D6, 2)   // E6D4
+    S(sta, INY, 0x00A5, 0xE6D8, 6)   // E6D6
+    S(iny, IMP, 0x0000, 0xE6D9, 2)   // E6D8
+    S(lda, AB_, 0x02D5, 0xE6DC, 4)   // E6D9
+    S(sta, AB_, 0x0243, 0xE6DF, 4)   // E6DC
+    S(txa, IMP, 0x0000, 0xE6E0, 2)   // E6DF
+    S(jsr, AB_, 0xE706, 0xE6E3, 6)   // E6E0
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_E6E3(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x002C, 0xE6E5, 2)   // E6E3
+    S(sta, INY, 0x00A5, 0xE6E7, 6)   // E6E5
+    S(iny, IMP, 0x0000, 0xE6E8, 2)   // E6E7
+    S(lda, ZP_, 0x0080, 0xE6EA, 3)   // E6E8
+    S(jsr, AB_, 0xE69B, 0xE6ED, 6)   // E6EA
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_E6ED(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x002C, 0xE6EF, 2)   // E6ED
+    S(sta, INY, 0x00A5, 0xE6F1, 6)   // E6EF
+    S(iny, IMP, 0x0000, 0xE6F2, 2)   // E6F1
+    S(lda, ZP_, 0x0081, 0xE6F4, 3)   // E6F2
+    S(jsr, AB_, 0xE69B, 0xE6F7, 6)   // E6F4
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_E6F7(cpu *c) {
+    uint32_t cycles = 0;
+    S(dey, IMP, 0x0000, 0xE6F8, 2)   // E6F7
+    S(tya, IMP, 0x0000, 0xE6F9, 2)   // E6F8
+    S(clc, IMP, 0x0000, 0xE6FA, 2)   // E6F9
+    S(adc, IMM, 0x00D5, 0xE6FC, 2)   // E6FA
+    S(sta, AB_, 0x0249, 0xE6FF, 4)   // E6FC
+    S(inc, ZP_, 0x00A5, 0xE701, 5)   // E6FF
+    S(lda, IMM, 0x0088, 0xE703, 2)   // E701
+    S(sta, ZP_, 0x00F7, 0xE705, 3)   // E703
+    S(rts, IMP, 0x0000, 0xE706, 6)   // E705
+    c->executed += 9;
+    return cycles;
+}
+
+static inline uint32_t rom_E706(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xE707, 2)   // E706
+    S(lda, ZP_, 0x0086, 0xE709, 3)   // E707
+    S(pha, IMP, 0x0000, 0xE70A, 3)   // E709
+    S(lda, ZP_, 0x0087, 0xE70C, 3)   // E70A
+    S(pha, IMP, 0x0000, 0xE70D, 3)   // E70C
+    S(lda, IMM, 0x00FC, 0xE70F, 2)   // E70D
+    S(sta, ZP_, 0x0086, 0xE711, 3)   // E70F
+    S(lda, IMM, 0x00E4, 0xE713, 2)   // E711
+    S(sta, ZP_, 0x0087, 0xE715, 3)   // E713
+    S(txa, IMP, 0x0000, 0xE716, 2)   // E715
+    S(ldx, IMM, 0x0000, 0xE718, 2)   // E716
+    c->executed += 11;
+    return cycles;
+}
+
+static inline uint32_t rom_E718(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, INX, 0x0086, 0xE71A, 6)   // E718
+    S(beq, REL, 0x0021, 0xE71C, 2)   // E71A
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E71C(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xE71D, 3)   // E71C
+    S(jsr, AB_, 0xE775, 0xE720, 6)   // E71D
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E720(cpu *c) {
+    uint32_t cycles = 0;
+    S(bcc, REL, 0x0005, 0xE722, 2)   // E720
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E722(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE775, 0xE725, 6)   // E722
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E725(cpu *c) {
+    uint32_t cycles = 0;
+    S(bcc, REL, 0x00FB, 0xE727, 2)   // E725
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E727(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0087, 0xE729, 3)   // E727
+    S(cmp, IMM, 0x00E6, 0xE72B, 2)   // E729
+    S(bcc, REL, 0x0008, 0xE72D, 2)   // E72B
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E72D(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x000A, 0xE72F, 2)   // E72D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E72F(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x000A, 0xE731, 2)   // E72F
+    S(cmp, ZP_, 0x0086, 0xE733, 3)   // E731
+    S(bcc, REL, 0x0004, 0xE735, 2)   // E733
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E735(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xE736, 4)   // E735
+    S(jmp, AB_, 0xE718, 0xE739, 3)   // E736
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E739(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xE73A, 4)   // E739
+    S(jmp, AB_, 0xE74D, 0xE73D, 3)   // E73A
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E73D(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE767, 0xE740, 6)   // E73D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E740(cpu *c) {
+    uint32_t cycles = 0;
+    S(bcc, REL, 0x00FB, 0xE742, 2)   // E740
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E742(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE754, 0xE745, 6)   // E742
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E745(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE767, 0xE748, 6)   // E745
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E748(cpu *c) {
+    uint32_t cycles = 0;
+    S(bcc, REL, 0x00F8, 0xE74A, 2)   // E748
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E74A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE754, 0xE74D, 6)   // E74A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E74D(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xE74E, 4)   // E74D
+    S(sta, ZP_, 0x0087, 0xE750, 3)   // E74E
+    S(pla, IMP, 0x0000, 0xE751, 4)   // E750
+    S(sta, ZP_, 0x0086, 0xE753, 3)   // E751
+    S(rts, IMP, 0x0000, 0xE754, 6)   // E753
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_E754(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0020, 0xE756, 2)   // E754
+    S(bcs, REL, 0x000B, 0xE758, 2)   // E756
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E758(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xE759, 2)   // E758
+    S(lda, IMM, 0x0020, 0xE75B, 2)   // E759
+    S(sta, INY, 0x00A5, 0xE75D, 6)   // E75B
+    S(iny, IMP, 0x0000, 0xE75E, 2)   // E75D
+    S(txa, IMP, 0x0000, 0xE75F, 2)   // E75E
+    S(jsr, AB_, 0xE706, 0xE762, 6)   // E75F
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_E762(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xE763, 6)   // E762
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E763(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, INY, 0x00A5, 0xE765, 6)   // E763
+    S(iny, IMP, 0x0000, 0xE766, 2)   // E765
+    S(rts, IMP, 0x0000, 0xE767, 6)   // E766
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E767(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZP_, 0x0086, 0xE769, 5)   // E767
+    S(bne, REL, 0x0002, 0xE76B, 2)   // E769
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E76B(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZP_, 0x0087, 0xE76D, 5)   // E76B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E76D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INX, 0x0086, 0xE76F, 6)   // E76D
+    S(asl, ACC, 0x0000, 0xE770, 2)   // E76F
+    S(lda, INX, 0x0086, 0xE772, 6)   // E770
+    S(and, IMM, 0x007F, 0xE774, 2)   // E772
+    S(rts, IMP, 0x0000, 0xE775, 6)   // E774
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_E775(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE76D, 0xE778, 6)   // E775
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E778(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZP_, 0x0086, 0xE77A, 5)   // E778
+    S(bne, REL, 0x0002, 0xE77C, 2)   // E77A
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E77C(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZP_, 0x0087, 0xE77E, 5)   // E77C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E77E(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xE77F, 6)   // E77E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E77F(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xE780, 6)   // E77F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E780(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x1800, 0xE783, 4)   // E780
+    S(tax, IMP, 0x0000, 0xE784, 2)   // E783
+    S(and, IMM, 0x0004, 0xE786, 2)   // E784
+    S(beq, REL, 0x00F7, 0xE788, 2)   // E786
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_E788(cpu *c) {
+    uint32_t cycles = 0;
+    S(txa, IMP, 0x0000, 0xE789, 2)   // E788
+    S(and, IMM, 0x0001, 0xE78B, 2)   // E789
+    S(beq, REL, 0x00F2, 0xE78D, 2)   // E78B
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E78D(cpu *c) {
+    uint32_t cycles = 0;
+    S(cli, IMP, 0x0000, 0xE78E, 2)   // E78D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E78E(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x1800, 0xE791, 4)   // E78E
+    S(and, IMM, 0x0005, 0xE793, 2)   // E791
+    S(bne, REL, 0x00F9, 0xE795, 2)   // E793
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E795(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, AB_, 0x0278, 0xE798, 6)   // E795
+    S(inc, AB_, 0x0274, 0xE79B, 6)   // E798
+    S(lda, IMM, 0x002A, 0xE79D, 2)   // E79B
+    S(sta, AB_, 0x0200, 0xE7A0, 4)   // E79D
+    S(jmp, AB_, 0xE7A8, 0xE7A3, 3)   // E7A0
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_E7A8(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF258, 0xE7AB, 6)   // E7A8
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E7AB(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0278, 0xE7AE, 4)   // E7AB
+    S(pha, IMP, 0x0000, 0xE7AF, 3)   // E7AE
+    S(lda, IMM, 0x0001, 0xE7B1, 2)   // E7AF
+    S(sta, AB_, 0x0278, 0xE7B4, 4)   // E7B1
+    S(lda, IMM, 0x00FF, 0xE7B6, 2)   // E7B4
+    S(sta, ZP_, 0x0086, 0xE7B8, 3)   // E7B6
+    S(jsr, AB_, 0xC44F, 0xE7BB, 6)   // E7B8
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_E7BB(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0280, 0xE7BE, 4)   // E7BB
+    S(bne, REL, 0x0005, 0xE7C0, 2)   // E7BE
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E7C0(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0039, 0xE7C2, 2)   // E7C0
+    S(jsr, AB_, 0xC1C8, 0xE7C5, 6)   // E7C2
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E7C5(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xE7C6, 4)   // E7C5
+    S(sta, AB_, 0x0278, 0xE7C9, 4)   // E7C6
+    S(lda, AB_, 0x0280, 0xE7CC, 4)   // E7C9
+    S(sta, ZP_, 0x0080, 0xE7CE, 3)   // E7CC
+    S(lda, AB_, 0x0285, 0xE7D1, 4)   // E7CE
+    S(sta, ZP_, 0x0081, 0xE7D3, 3)   // E7D1
+    S(lda, IMM, 0x0003, 0xE7D5, 2)   // E7D3
+    S(jsr, AB_, 0xD477, 0xE7D8, 6)   // E7D5
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_E7D8(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xE7DA, 2)   // E7D8
+    S(sta, ZP_, 0x0087, 0xE7DC, 3)   // E7DA
+    S(jsr, AB_, 0xE839, 0xE7DF, 6)   // E7DC
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E7DF(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0088, 0xE7E1, 3)   // E7DF
+    S(jsr, AB_, 0xE84B, 0xE7E4, 6)   // E7E1
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E7E4(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE839, 0xE7E7, 6)   // E7E4
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E7E7(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0089, 0xE7E9, 3)   // E7E7
+    S(jsr, AB_, 0xE84B, 0xE7EC, 6)   // E7E9
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E7EC(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0086, 0xE7EE, 3)   // E7EC
+    S(beq, REL, 0x000A, 0xE7F0, 2)   // E7EE
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E7F0(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0088, 0xE7F2, 3)   // E7F0
+    S(pha, IMP, 0x0000, 0xE7F3, 3)   // E7F2
+    S(lda, ZP_, 0x0089, 0xE7F5, 3)   // E7F3
+    S(pha, IMP, 0x0000, 0xE7F6, 3)   // E7F5
+    S(lda, IMM, 0x0000, 0xE7F8, 2)   // E7F6
+    S(sta, ZP_, 0x0086, 0xE7FA, 3)   // E7F8
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_E7FA(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE839, 0xE7FD, 6)   // E7FA
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E7FD(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x008A, 0xE7FF, 3)   // E7FD
+    S(jsr, AB_, 0xE84B, 0xE802, 6)   // E7FF
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E802(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE839, 0xE805, 6)   // E802
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E805(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0000, 0xE807, 2)   // E805
+    S(sta, INY, 0x0088, 0xE809, 6)   // E807
+    S(jsr, AB_, 0xE84B, 0xE80C, 6)   // E809
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E80C(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0088, 0xE80E, 3)   // E80C
+    S(clc, IMP, 0x0000, 0xE80F, 2)   // E80E
+    S(adc, IMM, 0x0001, 0xE811, 2)   // E80F
+    S(sta, ZP_, 0x0088, 0xE813, 3)   // E811
+    S(bcc, REL, 0x0002, 0xE815, 2)   // E813
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_E815(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZP_, 0x0089, 0xE817, 5)   // E815
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E817(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, ZP_, 0x008A, 0xE819, 5)   // E817
+    S(bne, REL, 0x00E7, 0xE81B, 2)   // E819
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E81B(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCA35, 0xE81E, 6)   // E81B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E81E(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0085, 0xE820, 3)   // E81E
+    S(cmp, ZP_, 0x0087, 0xE822, 3)   // E820
+    S(beq, REL, 0x0008, 0xE824, 2)   // E822
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E824(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE3E, 0xE827, 6)   // E824
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E827(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0050, 0xE829, 2)   // E827
+    S(jsr, AB_, 0xE645, 0xE82C, 6)   // E829
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E82C(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x00F8, 0xE82E, 3)   // E82C
+    S(bne, REL, 0x00A8, 0xE830, 2)   // E82E
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E830(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xE831, 4)   // E830
+    S(sta, ZP_, 0x0089, 0xE833, 3)   // E831
+    S(pla, IMP, 0x0000, 0xE834, 4)   // E833
+    S(sta, ZP_, 0x0088, 0xE836, 3)   // E834
+    S(jmp, IN_, 0x0088, 0xE839, 5)   // E836
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_E839(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCA35, 0xE83C, 6)   // E839
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E83C(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x00F8, 0xE83E, 3)   // E83C
+    S(bne, REL, 0x0008, 0xE840, 2)   // E83E
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E840(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE3E, 0xE843, 6)   // E840
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E843(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0051, 0xE845, 2)   // E843
+    S(jsr, AB_, 0xE645, 0xE848, 6)   // E845
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E848(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0085, 0xE84A, 3)   // E848
+    S(rts, IMP, 0x0000, 0xE84B, 6)   // E84A
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E84B(cpu *c) {
+    uint32_t cycles = 0;
+    S(clc, IMP, 0x0000, 0xE84C, 2)   // E84B
+    S(adc, ZP_, 0x0087, 0xE84E, 3)   // E84C
+    S(adc, IMM, 0x0000, 0xE850, 2)   // E84E
+    S(sta, ZP_, 0x0087, 0xE852, 3)   // E850
+    S(rts, IMP, 0x0000, 0xE853, 6)   // E852
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_E853(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x1801, 0xE856, 4)   // E853
+    S(lda, IMM, 0x0001, 0xE858, 2)   // E856
+    S(sta, ZP_, 0x007C, 0xE85A, 3)   // E858
+    S(rts, IMP, 0x0000, 0xE85B, 6)   // E85A
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_E85B(cpu *c) {
+    uint32_t cycles = 0;
+    S(sei, IMP, 0x0000, 0xE85C, 2)   // E85B
+    S(lda, IMM, 0x0000, 0xE85E, 2)   // E85C
+    S(sta, ZP_, 0x007C, 0xE860, 3)   // E85E
+    S(sta, ZP_, 0x0079, 0xE862, 3)   // E860
+    S(sta, ZP_, 0x007A, 0xE864, 3)   // E862
+    S(ldx, IMM, 0x0045, 0xE866, 2)   // E864
+    S(txs, IMP, 0x0000, 0xE867, 2)   // E866
+    S(lda, IMM, 0x0080, 0xE869, 2)   // E867
+    S(sta, ZP_, 0x00F8, 0xE86B, 3)   // E869
+    S(sta, ZP_, 0x007D, 0xE86D, 3)   // E86B
+    S(jsr, AB_, 0xE9B7, 0xE870, 6)   // E86D
+    c->executed += 11;
+    return cycles;
+}
+
+static inline uint32_t rom_E870(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE9A5, 0xE873, 6)   // E870
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E873(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x1800, 0xE876, 4)   // E873
+    S(ora, IMM, 0x0010, 0xE878, 2)   // E876
+    S(sta, AB_, 0x1800, 0xE87B, 4)   // E878
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E87B(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x1800, 0xE87E, 4)   // E87B
+    S(bpl, REL, 0x0057, 0xE880, 2)   // E87E
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E880(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x0004, 0xE882, 2)   // E880
+    S(bne, REL, 0x00F7, 0xE884, 2)   // E882
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E884(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE9C9, 0xE887, 6)   // E884
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E887(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x003F, 0xE889, 2)   // E887
+    S(bne, REL, 0x0006, 0xE88B, 2)   // E889
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E88B(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xE88D, 2)   // E88B
+    S(sta, ZP_, 0x0079, 0xE88F, 3)   // E88D
+    S(beq, REL, 0x0071, 0xE891, 2)   // E88F
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E891(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x005F, 0xE893, 2)   // E891
+    S(bne, REL, 0x0006, 0xE895, 2)   // E893
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E895(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xE897, 2)   // E895
+    S(sta, ZP_, 0x007A, 0xE899, 3)   // E897
+    S(beq, REL, 0x0067, 0xE89B, 2)   // E899
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E89B(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, ZP_, 0x0078, 0xE89D, 3)   // E89B
+    S(bne, REL, 0x000A, 0xE89F, 2)   // E89D
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E89F(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0001, 0xE8A1, 2)   // E89F
+    S(sta, ZP_, 0x007A, 0xE8A3, 3)   // E8A1
+    S(lda, IMM, 0x0000, 0xE8A5, 2)   // E8A3
+    S(sta, ZP_, 0x0079, 0xE8A7, 3)   // E8A5
+    S(beq, REL, 0x0029, 0xE8A9, 2)   // E8A7
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_E8A9(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, ZP_, 0x0077, 0xE8AB, 3)   // E8A9
+    S(bne, REL, 0x000A, 0xE8AD, 2)   // E8AB
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E8AD(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0001, 0xE8AF, 2)   // E8AD
+    S(sta, ZP_, 0x0079, 0xE8B1, 3)   // E8AF
+    S(lda, IMM, 0x0000, 0xE8B3, 2)   // E8B1
+    S(sta, ZP_, 0x007A, 0xE8B5, 3)   // E8B3
+    S(beq, REL, 0x001B, 0xE8B7, 2)   // E8B5
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_E8B7(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xE8B8, 2)   // E8B7
+    S(and, IMM, 0x0060, 0xE8BA, 2)   // E8B8
+    S(cmp, IMM, 0x0060, 0xE8BC, 2)   // E8BA
+    S(bne, REL, 0x003F, 0xE8BE, 2)   // E8BC
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_E8BE(cpu *c) {
+    uint32_t cycles = 0;
+    S(txa, IMP, 0x0000, 0xE8BF, 2)   // E8BE
+    S(sta, ZP_, 0x0084, 0xE8C1, 3)   // E8BF
+    S(and, IMM, 0x000F, 0xE8C3, 2)   // E8C1
+    S(sta, ZP_, 0x0083, 0xE8C5, 3)   // E8C3
+    S(lda, ZP_, 0x0084, 0xE8C7, 3)   // E8C5
+    S(and, IMM, 0x00F0, 0xE8C9, 2)   // E8C7
+    S(cmp, IMM, 0x00E0, 0xE8CB, 2)   // E8C9
+    S(bne, REL, 0x0035, 0xE8CD, 2)   // E8CB
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_E8CD(cpu *c) {
+    uint32_t cycles = 0;
+    S(cli, IMP, 0x0000, 0xE8CE, 2)   // E8CD
+    S(jsr, AB_, 0xDAC0, 0xE8D1, 6)   // E8CE
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E8D1(cpu *c) {
+    uint32_t cycles = 0;
+    S(sei, IMP, 0x0000, 0xE8D2, 2)   // E8D1
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E8D2(cpu *c) {
+    uint32_t cycles = 0;
+    S(bit, AB_, 0x1800, 0xE8D5, 4)   // E8D2
+    S(bmi, REL, 0x00AD, 0xE8D7, 2)   // E8D5
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E8D7(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xE8D9, 2)   // E8D7
+    S(sta, ZP_, 0x007D, 0xE8DB, 3)   // E8D9
+    S(lda, AB_, 0x1800, 0xE8DE, 4)   // E8DB
+    S(and, IMM, 0x00EF, 0xE8E0, 2)   // E8DE
+    S(sta, AB_, 0x1800, 0xE8E3, 4)   // E8E0
+    S(lda, ZP_, 0x0079, 0xE8E5, 3)   // E8E3
+    S(beq, REL, 0x0006, 0xE8E7, 2)   // E8E5
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_E8E7(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xEA2E, 0xE8EA, 6)   // E8E7
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E8EA(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xEBE7, 0xE8ED, 3)   // E8EA
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E8ED(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x007A, 0xE8EF, 3)   // E8ED
+    S(beq, REL, 0x0009, 0xE8F1, 2)   // E8EF
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E8F1(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE99C, 0xE8F4, 6)   // E8F1
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E8F4(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE9AE, 0xE8F7, 6)   // E8F4
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E8F7(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE909, 0xE8FA, 6)   // E8F7
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E8FA(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xEA4E, 0xE8FD, 3)   // E8FA
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E8FD(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0010, 0xE8FF, 2)   // E8FD
+    S(sta, AB_, 0x1800, 0xE902, 4)   // E8FF
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E902(cpu *c) {
+    uint32_t cycles = 0;
+    S(bit, AB_, 0x1800, 0xE905, 4)   // E902
+    S(bpl, REL, 0x00D0, 0xE907, 2)   // E905
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E907(cpu *c) {
+    uint32_t cycles = 0;
+    S(bmi, REL, 0x00F9, 0xE909, 2)   // E907
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E909(cpu *c) {
+    uint32_t cycles = 0;
+    S(sei, IMP, 0x0000, 0xE90A, 2)   // E909
+    S(jsr, AB_, 0xD0EB, 0xE90D, 6)   // E90A
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E90D(cpu *c) {
+    uint32_t cycles = 0;
+    S(bcs, REL, 0x0006, 0xE90F, 2)   // E90D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E90F(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xE911, 3)   // E90F
+    S(lda, ZPX, 0x00F2, 0xE913, 4)   // E911
+    S(bmi, REL, 0x0001, 0xE915, 2)   // E913
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E915(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xE916, 6)   // E915
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E916(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xEA59, 0xE919, 6)   // E916
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E919(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE9C0, 0xE91C, 6)   // E919
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E91C(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x0001, 0xE91E, 2)   // E91C
+    S(php, IMP, 0x0000, 0xE91F, 3)   // E91E
+    S(jsr, AB_, 0xE9B7, 0xE922, 6)   // E91F
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E922(cpu *c) {
+    uint32_t cycles = 0;
+    S(plp, IMP, 0x0000, 0xE923, 4)   // E922
+    S(beq, REL, 0x0012, 0xE925, 2)   // E923
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E925(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xEA59, 0xE928, 6)   // E925
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E928(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE9C0, 0xE92B, 6)   // E928
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E92B(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x0001, 0xE92D, 2)   // E92B
+    S(bne, REL, 0x00F6, 0xE92F, 2)   // E92D
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E92F(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xE931, 3)   // E92F
+    S(lda, ZPX, 0x00F2, 0xE933, 4)   // E931
+    S(and, IMM, 0x0008, 0xE935, 2)   // E933
+    S(bne, REL, 0x0014, 0xE937, 2)   // E935
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_E937(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xEA59, 0xE93A, 6)   // E937
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E93A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE9C0, 0xE93D, 6)   // E93A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E93D(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x0001, 0xE93F, 2)   // E93D
+    S(bne, REL, 0x00F6, 0xE941, 2)   // E93F
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E941(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xEA59, 0xE944, 6)   // E941
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E944(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE9C0, 0xE947, 6)   // E944
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E947(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x0001, 0xE949, 2)   // E947
+    S(beq, REL, 0x00F6, 0xE94B, 2)   // E949
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E94B(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE9AE, 0xE94E, 6)   // E94B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E94E(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xEA59, 0xE951, 6)   // E94E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E951(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE9C0, 0xE954, 6)   // E951
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E954(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x0001, 0xE956, 2)   // E954
+    S(bne, REL, 0x00F3, 0xE958, 2)   // E956
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E958(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0008, 0xE95A, 2)   // E958
+    S(sta, ZP_, 0x0098, 0xE95C, 3)   // E95A
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E95C(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE9C0, 0xE95F, 6)   // E95C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E95F(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x0001, 0xE961, 2)   // E95F
+    S(bne, REL, 0x0036, 0xE963, 2)   // E961
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E963(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xE965, 3)   // E963
+    S(lda, ABX, 0x023E, 0xE968, 4)   // E965
+    S(ror, ACC, 0x0000, 0xE969, 2)   // E968
+    S(sta, ABX, 0x023E, 0xE96C, 5)   // E969
+    S(bcs, REL, 0x0005, 0xE96E, 2)   // E96C
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_E96E(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE9A5, 0xE971, 6)   // E96E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E971(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x0003, 0xE973, 2)   // E971
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E973(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE99C, 0xE976, 6)   // E973
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E976(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE9B7, 0xE979, 6)   // E976
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E979(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0023, 0xE97B, 3)   // E979
+    S(bne, REL, 0x0003, 0xE97D, 2)   // E97B
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E97D(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xFEF3, 0xE980, 6)   // E97D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E980(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xFEFB, 0xE983, 6)   // E980
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E983(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, ZP_, 0x0098, 0xE985, 5)   // E983
+    S(bne, REL, 0x00D5, 0xE987, 2)   // E985
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E987(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xEA59, 0xE98A, 6)   // E987
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E98A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE9C0, 0xE98D, 6)   // E98A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E98D(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x0001, 0xE98F, 2)   // E98D
+    S(beq, REL, 0x00F6, 0xE991, 2)   // E98F
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E991(cpu *c) {
+    uint32_t cycles = 0;
+    S(cli, IMP, 0x0000, 0xE992, 2)   // E991
+    S(jsr, AB_, 0xD3AA, 0xE995, 6)   // E992
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E995(cpu *c) {
+    uint32_t cycles = 0;
+    S(sei, IMP, 0x0000, 0xE996, 2)   // E995
+    S(jmp, AB_, 0xE90F, 0xE999, 3)   // E996
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E999(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xEA4E, 0xE99C, 3)   // E999
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E99C(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x1800, 0xE99F, 4)   // E99C
+    S(and, IMM, 0x00FD, 0xE9A1, 2)   // E99F
+    S(sta, AB_, 0x1800, 0xE9A4, 4)   // E9A1
+    S(rts, IMP, 0x0000, 0xE9A5, 6)   // E9A4
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_E9A5(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x1800, 0xE9A8, 4)   // E9A5
+    S(ora, IMM, 0x0002, 0xE9AA, 2)   // E9A8
+    S(sta, AB_, 0x1800, 0xE9AD, 4)   // E9AA
+    S(rts, IMP, 0x0000, 0xE9AE, 6)   // E9AD
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_E9AE(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x1800, 0xE9B1, 4)   // E9AE
+    S(ora, IMM, 0x0008, 0xE9B3, 2)   // E9B1
+    S(sta, AB_, 0x1800, 0xE9B6, 4)   // E9B3
+    S(rts, IMP, 0x0000, 0xE9B7, 6)   // E9B6
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_E9B7(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x1800, 0xE9BA, 4)   // E9B7
+    S(and, IMM, 0x00F7, 0xE9BC, 2)   // E9BA
+    S(sta, AB_, 0x1800, 0xE9BF, 4)   // E9BC
+    S(rts, IMP, 0x0000, 0xE9C0, 6)   // E9BF
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_E9C0(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x1800, 0xE9C3, 4)   // E9C0
+    S(cmp, AB_, 0x1800, 0xE9C6, 4)   // E9C3
+    S(bne, REL, 0x00F8, 0xE9C8, 2)   // E9C6
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E9C8(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xE9C9, 6)   // E9C8
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E9C9(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0008, 0xE9CB, 2)   // E9C9
+    S(sta, ZP_, 0x0098, 0xE9CD, 3)   // E9CB
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E9CD(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xEA59, 0xE9D0, 6)   // E9CD
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E9D0(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE9C0, 0xE9D3, 6)   // E9D0
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E9D3(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x0004, 0xE9D5, 2)   // E9D3
+    S(bne, REL, 0x00F6, 0xE9D7, 2)   // E9D5
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E9D7(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE99C, 0xE9DA, 6)   // E9D7
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E9DA(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0001, 0xE9DC, 2)   // E9DA
+    S(sta, AB_, 0x1805, 0xE9DF, 4)   // E9DC
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E9DF(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xEA59, 0xE9E2, 6)   // E9DF
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E9E2(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x180D, 0xE9E5, 4)   // E9E2
+    S(and, IMM, 0x0040, 0xE9E7, 2)   // E9E5
+    S(bne, REL, 0x0009, 0xE9E9, 2)   // E9E7
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_E9E9(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE9C0, 0xE9EC, 6)   // E9E9
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E9EC(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x0004, 0xE9EE, 2)   // E9EC
+    S(beq, REL, 0x00EF, 0xE9F0, 2)   // E9EE
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E9F0(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x0019, 0xE9F2, 2)   // E9F0
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E9F2(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE9A5, 0xE9F5, 6)   // E9F2
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E9F5(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, IMM, 0x000A, 0xE9F7, 2)   // E9F5
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E9F7(cpu *c) {
+    uint32_t cycles = 0;
+    S(dex, IMP, 0x0000, 0xE9F8, 2)   // E9F7
+    S(bne, REL, 0x00FD, 0xE9FA, 2)   // E9F8
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_E9FA(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE99C, 0xE9FD, 6)   // E9FA
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_E9FD(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xEA59, 0xEA00, 6)   // E9FD
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EA00(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE9C0, 0xEA03, 6)   // EA00
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EA03(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x0004, 0xEA05, 2)   // EA03
+    S(beq, REL, 0x00F6, 0xEA07, 2)   // EA05
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EA07(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xEA09, 2)   // EA07
+    S(sta, ZP_, 0x00F8, 0xEA0B, 3)   // EA09
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EA0B(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x1800, 0xEA0E, 4)   // EA0B
+    S(and, IMM, 0x0004, 0xEA10, 2)   // EA0E
+    S(bne, REL, 0x00F9, 0xEA12, 2)   // EA10
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_EA12(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x1800, 0xEA15, 4)   // EA12
+    S(eor, IMM, 0x0001, 0xEA17, 2)   // EA15
+    S(lsr, ACC, 0x0000, 0xEA18, 2)   // EA17
+    S(ror, ZP_, 0x0085, 0xEA1A, 5)   // EA18
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_EA1A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xEA59, 0xEA1D, 6)   // EA1A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EA1D(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE9C0, 0xEA20, 6)   // EA1D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EA20(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x0004, 0xEA22, 2)   // EA20
+    S(beq, REL, 0x00F6, 0xEA24, 2)   // EA22
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EA24(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, ZP_, 0x0098, 0xEA26, 5)   // EA24
+    S(bne, REL, 0x00E3, 0xEA28, 2)   // EA26
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EA28(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE9A5, 0xEA2B, 6)   // EA28
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EA2B(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0085, 0xEA2D, 3)   // EA2B
+    S(rts, IMP, 0x0000, 0xEA2E, 6)   // EA2D
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EA2E(cpu *c) {
+    uint32_t cycles = 0;
+    S(sei, IMP, 0x0000, 0xEA2F, 2)   // EA2E
+    S(jsr, AB_, 0xD107, 0xEA32, 6)   // EA2F
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EA32(cpu *c) {
+    uint32_t cycles = 0;
+    S(bcs, REL, 0x0005, 0xEA34, 2)   // EA32
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EA34(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZPX, 0x00F2, 0xEA36, 4)   // EA34
+    S(ror, ACC, 0x0000, 0xEA37, 2)   // EA36
+    S(bcs, REL, 0x000B, 0xEA39, 2)   // EA37
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_EA39(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0084, 0xEA3B, 3)   // EA39
+    S(and, IMM, 0x00F0, 0xEA3D, 2)   // EA3B
+    S(cmp, IMM, 0x00F0, 0xEA3F, 2)   // EA3D
+    S(beq, REL, 0x0003, 0xEA41, 2)   // EA3F
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_EA41(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xEA4E, 0xEA44, 3)   // EA41
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EA44(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE9C9, 0xEA47, 6)   // EA44
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EA47(cpu *c) {
+    uint32_t cycles = 0;
+    S(cli, IMP, 0x0000, 0xEA48, 2)   // EA47
+    S(jsr, AB_, 0xCFB7, 0xEA4B, 6)   // EA48
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EA4B(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xEA2E, 0xEA4E, 3)   // EA4B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EA4E(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xEA50, 2)   // EA4E
+    S(sta, AB_, 0x1800, 0xEA53, 4)   // EA50
+    S(jmp, AB_, 0xEBE7, 0xEA56, 3)   // EA53
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_EA59(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x007D, 0xEA5B, 3)   // EA59
+    S(beq, REL, 0x0006, 0xEA5D, 2)   // EA5B
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EA5D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x1800, 0xEA60, 4)   // EA5D
+    S(bpl, REL, 0x0009, 0xEA62, 2)   // EA60
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EA62(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xEA63, 6)   // EA62
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EA63(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x1800, 0xEA66, 4)   // EA63
+    S(bpl, REL, 0x00FA, 0xEA68, 2)   // EA66
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EA68(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xE85B, 0xEA6B, 3)   // EA68
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EA6B(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xE8D7, 0xEA6E, 3)   // EA6B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EA6E(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, IMM, 0x0000, 0xEA70, 2)   // EA6E
+    S(bit, AB_, 0x6FA6, 0xEA73, 4)   // EA70
+    S(txs, IMP, 0x0000, 0xEA74, 2)   // EA73
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_EA71(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x006F, 0xEA73, 3)   // EA71
+    S(txs, IMP, 0x0000, 0xEA74, 2)   // EA73
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EA74(cpu *c) {
+    uint32_t cycles = 0;
+    S(tsx, IMP, 0x0000, 0xEA75, 2)   // EA74
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EA75(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0008, 0xEA77, 2)   // EA75
+    S(ora, AB_, 0x1C00, 0xEA7A, 4)   // EA77
+    S(jmp, AB_, 0xFEEA, 0xEA7D, 3)   // EA7A
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_EA7D(cpu *c) {
+    uint32_t cycles = 0;
+    S(tya, IMP, 0x0000, 0xEA7E, 2)   // EA7D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EA7E(cpu *c) {
+    uint32_t cycles = 0;
+    S(clc, IMP, 0x0000, 0xEA7F, 2)   // EA7E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EA7F(cpu *c) {
+    uint32_t cycles = 0;
+    S(adc, IMM, 0x0001, 0xEA81, 2)   // EA7F
+    S(bne, REL, 0x00FC, 0xEA83, 2)   // EA81
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EA83(cpu *c) {
+    uint32_t cycles = 0;
+    S(dey, IMP, 0x0000, 0xEA84, 2)   // EA83
+    S(bne, REL, 0x00F8, 0xEA86, 2)   // EA84
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EA86(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x1C00, 0xEA89, 4)   // EA86
+    S(and, IMM, 0x00F7, 0xEA8B, 2)   // EA89
+    S(sta, AB_, 0x1C00, 0xEA8E, 4)   // EA8B
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_EA8E(cpu *c) {
+    uint32_t cycles = 0;
+    S(tya, IMP, 0x0000, 0xEA8F, 2)   // EA8E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EA8F(cpu *c) {
+    uint32_t cycles = 0;
+    S(clc, IMP, 0x0000, 0xEA90, 2)   // EA8F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EA90(cpu *c) {
+    uint32_t cycles = 0;
+    S(adc, IMM, 0x0001, 0xEA92, 2)   // EA90
+    S(bne, REL, 0x00FC, 0xEA94, 2)   // EA92
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EA94(cpu *c) {
+    uint32_t cycles = 0;
+    S(dey, IMP, 0x0000, 0xEA95, 2)   // EA94
+    S(bne, REL, 0x00F8, 0xEA97, 2)   // EA95
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EA97(cpu *c) {
+    uint32_t cycles = 0;
+    S(dex, IMP, 0x0000, 0xEA98, 2)   // EA97
+    S(bpl, REL, 0x00DB, 0xEA9A, 2)   // EA98
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EA9A(cpu *c) {
+    uint32_t cycles = 0;
+    S(cpx, IMM, 0x00FC, 0xEA9C, 2)   // EA9A
+    S(bne, REL, 0x00F0, 0xEA9E, 2)   // EA9C
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EA9E(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x00D4, 0xEAA0, 2)   // EA9E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EAA0(cpu *c) {
+    uint32_t cycles = 0;
+    S(sei, IMP, 0x0000, 0xEAA1, 2)   // EAA0
+    S(cld, IMP, 0x0000, 0xEAA2, 2)   // EAA1
+    S(ldx, IMM, 0x00FF, 0xEAA4, 2)   // EAA2
+    S(stx, AB_, 0x1803, 0xEAA7, 4)   // EAA4
+    S(inx, IMP, 0x0000, 0xEAA8, 2)   // EAA7
+    S(ldy, IMM, 0x0000, 0xEAAA, 2)   // EAA8
+    S(ldx, IMM, 0x0000, 0xEAAC, 2)   // EAAA
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_EAAC(cpu *c) {
+    uint32_t cycles = 0;
+    S(txa, IMP, 0x0000, 0xEAAD, 2)   // EAAC
+    S(sta, ZPX, 0x0000, 0xEAAF, 4)   // EAAD
+    S(inx, IMP, 0x0000, 0xEAB0, 2)   // EAAF
+    S(bne, REL, 0x00FA, 0xEAB2, 2)   // EAB0
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_EAB2(cpu *c) {
+    uint32_t cycles = 0;
+    S(txa, IMP, 0x0000, 0xEAB3, 2)   // EAB2
+    S(cmp, ZPX, 0x0000, 0xEAB5, 4)   // EAB3
+    S(bne, REL, 0x00B7, 0xEAB7, 2)   // EAB5
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_EAB7(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZPX, 0x0000, 0xEAB9, 6)   // EAB7
+    S(iny, IMP, 0x0000, 0xEABA, 2)   // EAB9
+    S(bne, REL, 0x00FB, 0xEABC, 2)   // EABA
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_EABC(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, ZPX, 0x0000, 0xEABE, 4)   // EABC
+    S(bne, REL, 0x00AE, 0xEAC0, 2)   // EABE
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EAC0(cpu *c) {
+    uint32_t cycles = 0;
+    S(sty, ZPX, 0x0000, 0xEAC2, 4)   // EAC0
+    S(lda, ZPX, 0x0000, 0xEAC4, 4)   // EAC2
+    S(bne, REL, 0x00A8, 0xEAC6, 2)   // EAC4
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_EAC6(cpu *c) {
+    uint32_t cycles = 0;
+    S(inx, IMP, 0x0000, 0xEAC7, 2)   // EAC6
+    S(bne, REL, 0x00E9, 0xEAC9, 2)   // EAC7
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EAC9(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZP_, 0x006F, 0xEACB, 5)   // EAC9
+    S(stx, ZP_, 0x0076, 0xEACD, 3)   // EACB
+    S(lda, IMM, 0x0000, 0xEACF, 2)   // EACD
+    S(sta, ZP_, 0x0075, 0xEAD1, 3)   // EACF
+    S(tay, IMP, 0x0000, 0xEAD2, 2)   // EAD1
+    S(ldx, IMM, 0x0020, 0xEAD4, 2)   // EAD2
+    S(clc, IMP, 0x0000, 0xEAD5, 2)   // EAD4
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_EAD5(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, ZP_, 0x0076, 0xEAD7, 5)   // EAD5
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EAD7(cpu *c) {
+    uint32_t cycles = 0;
+    S(adc, INY, 0x0075, 0xEAD9, 5)   // EAD7
+    S(iny, IMP, 0x0000, 0xEADA, 2)   // EAD9
+    S(bne, REL, 0x00FB, 0xEADC, 2)   // EADA
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_EADC(cpu *c) {
+    uint32_t cycles = 0;
+    S(dex, IMP, 0x0000, 0xEADD, 2)   // EADC
+    S(bne, REL, 0x00F6, 0xEADF, 2)   // EADD
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EADF(cpu *c) {
+    uint32_t cycles = 0;
+    S(adc, IMM, 0x0000, 0xEAE1, 2)   // EADF
+    S(tax, IMP, 0x0000, 0xEAE2, 2)   // EAE1
+    S(cmp, ZP_, 0x0076, 0xEAE4, 3)   // EAE2
+    S(bne, REL, 0x0039, 0xEAE6, 2)   // EAE4
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_EAE6(cpu *c) {
+    uint32_t cycles = 0;
+    S(cpx, IMM, 0x00C0, 0xEAE8, 2)   // EAE6
+    S(bne, REL, 0x00DF, 0xEAEA, 2)   // EAE8
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EAEA(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0001, 0xEAEC, 2)   // EAEA
+    S(sta, ZP_, 0x0076, 0xEAEE, 3)   // EAEC
+    S(inc, ZP_, 0x006F, 0xEAF0, 5)   // EAEE
+    S(ldx, IMM, 0x0007, 0xEAF2, 2)   // EAF0
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_EAF2(cpu *c) {
+    uint32_t cycles = 0;
+    S(tya, IMP, 0x0000, 0xEAF3, 2)   // EAF2
+    S(clc, IMP, 0x0000, 0xEAF4, 2)   // EAF3
+    S(adc, ZP_, 0x0076, 0xEAF6, 3)   // EAF4
+    S(sta, INY, 0x0075, 0xEAF8, 6)   // EAF6
+    S(iny, IMP, 0x0000, 0xEAF9, 2)   // EAF8
+    S(bne, REL, 0x00F7, 0xEAFB, 2)   // EAF9
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_EAFB(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZP_, 0x0076, 0xEAFD, 5)   // EAFB
+    S(dex, IMP, 0x0000, 0xEAFE, 2)   // EAFD
+    S(bne, REL, 0x00F2, 0xEB00, 2)   // EAFE
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_EB00(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, IMM, 0x0007, 0xEB02, 2)   // EB00
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EB02(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, ZP_, 0x0076, 0xEB04, 5)   // EB02
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EB04(cpu *c) {
+    uint32_t cycles = 0;
+    S(dey, IMP, 0x0000, 0xEB05, 2)   // EB04
+    S(tya, IMP, 0x0000, 0xEB06, 2)   // EB05
+    S(clc, IMP, 0x0000, 0xEB07, 2)   // EB06
+    S(adc, ZP_, 0x0076, 0xEB09, 3)   // EB07
+    S(cmp, INY, 0x0075, 0xEB0B, 5)   // EB09
+    S(bne, REL, 0x0012, 0xEB0D, 2)   // EB0B
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_EB0D(cpu *c) {
+    uint32_t cycles = 0;
+    S(eor, IMM, 0x00FF, 0xEB0F, 2)   // EB0D
+    S(sta, INY, 0x0075, 0xEB11, 6)   // EB0F
+    S(eor, INY, 0x0075, 0xEB13, 5)   // EB11
+    S(sta, INY, 0x0075, 0xEB15, 6)   // EB13
+    S(bne, REL, 0x0008, 0xEB17, 2)   // EB15
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_EB17(cpu *c) {
+    uint32_t cycles = 0;
+    S(tya, IMP, 0x0000, 0xEB18, 2)   // EB17
+    S(bne, REL, 0x00EA, 0xEB1A, 2)   // EB18
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EB1A(cpu *c) {
+    uint32_t cycles = 0;
+    S(dex, IMP, 0x0000, 0xEB1B, 2)   // EB1A
+    S(bne, REL, 0x00E5, 0xEB1D, 2)   // EB1B
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EB1D(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x0003, 0xEB1F, 2)   // EB1D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EB1F(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xEA71, 0xEB22, 3)   // EB1F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EB22(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, IMM, 0x0045, 0xEB24, 2)   // EB22
+    S(txs, IMP, 0x0000, 0xEB25, 2)   // EB24
+    S(lda, AB_, 0x1C00, 0xEB28, 4)   // EB25
+    S(and, IMM, 0x00F7, 0xEB2A, 2)   // EB28
+    S(sta, AB_, 0x1C00, 0xEB2D, 4)   // EB2A
+    S(lda, IMM, 0x0001, 0xEB2F, 2)   // EB2D
+    S(sta, AB_, 0x180C, 0xEB32, 4)   // EB2F
+    S(lda, IMM, 0x0082, 0xEB34, 2)   // EB32
+    S(sta, AB_, 0x180D, 0xEB37, 4)   // EB34
+    S(sta, AB_, 0x180E, 0xEB3A, 4)   // EB37
+    S(lda, AB_, 0x1800, 0xEB3D, 4)   // EB3A
+    S(and, IMM, 0x0060, 0xEB3F, 2)   // EB3D
+    S(asl, ACC, 0x0000, 0xEB40, 2)   // EB3F
+    S(rol, ACC, 0x0000, 0xEB41, 2)   // EB40
+    S(rol, ACC, 0x0000, 0xEB42, 2)   // EB41
+    S(rol, ACC, 0x0000, 0xEB43, 2)   // EB42
+    S(ora, IMM, 0x0048, 0xEB45, 2)   // EB43
+    S(sta, ZP_, 0x0078, 0xEB47, 3)   // EB45
+    S(eor, IMM, 0x0060, 0xEB49, 2)   // EB47
+    S(sta, ZP_, 0x0077, 0xEB4B, 3)   // EB49
+    S(ldx, IMM, 0x0000, 0xEB4D, 2)   // EB4B
+    S(ldy, IMM, 0x0000, 0xEB4F, 2)   // EB4D
+    c->executed += 22;
+    return cycles;
+}
+
+static inline uint32_t rom_EB4F(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xEB51, 2)   // EB4F
+    S(sta, ZPX, 0x0099, 0xEB53, 4)   // EB51
+    S(inx, IMP, 0x0000, 0xEB54, 2)   // EB53
+    S(lda, ABY, 0xFEE0, 0xEB57, 4)   // EB54
+    S(sta, ZPX, 0x0099, 0xEB59, 4)   // EB57
+    S(inx, IMP, 0x0000, 0xEB5A, 2)   // EB59
+    S(iny, IMP, 0x0000, 0xEB5B, 2)   // EB5A
+    S(cpy, IMM, 0x0005, 0xEB5D, 2)   // EB5B
+    S(bne, REL, 0x00F0, 0xEB5F, 2)   // EB5D
+    c->executed += 9;
+    return cycles;
+}
+
+static inline uint32_t rom_EB5F(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xEB61, 2)   // EB5F
+    S(sta, ZPX, 0x0099, 0xEB63, 4)   // EB61
+    S(inx, IMP, 0x0000, 0xEB64, 2)   // EB63
+    S(lda, IMM, 0x0002, 0xEB66, 2)   // EB64
+    S(sta, ZPX, 0x0099, 0xEB68, 4)   // EB66
+    S(inx, IMP, 0x0000, 0xEB69, 2)   // EB68
+    S(lda, IMM, 0x00D5, 0xEB6B, 2)   // EB69
+    S(sta, ZPX, 0x0099, 0xEB6D, 4)   // EB6B
+    S(inx, IMP, 0x0000, 0xEB6E, 2)   // EB6D
+    S(lda, IMM, 0x0002, 0xEB70, 2)   // EB6E
+    S(sta, ZPX, 0x0099, 0xEB72, 4)   // EB70
+    S(lda, IMM, 0x00FF, 0xEB74, 2)   // EB72
+    S(ldx, IMM, 0x0012, 0xEB76, 2)   // EB74
+    c->executed += 13;
+    return cycles;
+}
+
+static inline uint32_t rom_EB76(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ABX, 0x022B, 0xEB79, 5)   // EB76
+    S(dex, IMP, 0x0000, 0xEB7A, 2)   // EB79
+    S(bpl, REL, 0x00FA, 0xEB7C, 2)   // EB7A
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_EB7C(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, IMM, 0x0005, 0xEB7E, 2)   // EB7C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EB7E(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZPX, 0x00A7, 0xEB80, 4)   // EB7E
+    S(sta, ZPX, 0x00AE, 0xEB82, 4)   // EB80
+    S(sta, ZPX, 0x00CD, 0xEB84, 4)   // EB82
+    S(dex, IMP, 0x0000, 0xEB85, 2)   // EB84
+    S(bpl, REL, 0x00F7, 0xEB87, 2)   // EB85
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_EB87(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0005, 0xEB89, 2)   // EB87
+    S(sta, ZP_, 0x00AB, 0xEB8B, 3)   // EB89
+    S(lda, IMM, 0x0006, 0xEB8D, 2)   // EB8B
+    S(sta, ZP_, 0x00AC, 0xEB8F, 3)   // EB8D
+    S(lda, IMM, 0x00FF, 0xEB91, 2)   // EB8F
+    S(sta, ZP_, 0x00AD, 0xEB93, 3)   // EB91
+    S(sta, ZP_, 0x00B4, 0xEB95, 3)   // EB93
+    S(lda, IMM, 0x0005, 0xEB97, 2)   // EB95
+    S(sta, AB_, 0x023B, 0xEB9A, 4)   // EB97
+    S(lda, IMM, 0x0084, 0xEB9C, 2)   // EB9A
+    S(sta, AB_, 0x023A, 0xEB9F, 4)   // EB9C
+    S(lda, IMM, 0x000F, 0xEBA1, 2)   // EB9F
+    S(sta, AB_, 0x0256, 0xEBA4, 4)   // EBA1
+    S(lda, IMM, 0x0001, 0xEBA6, 2)   // EBA4
+    S(sta, ZP_, 0x00F6, 0xEBA8, 3)   // EBA6
+    S(lda, IMM, 0x0088, 0xEBAA, 2)   // EBA8
+    S(sta, ZP_, 0x00F7, 0xEBAC, 3)   // EBAA
+    S(lda, IMM, 0x00E0, 0xEBAE, 2)   // EBAC
+    S(sta, AB_, 0x024F, 0xEBB1, 4)   // EBAE
+    S(lda, IMM, 0x00FF, 0xEBB3, 2)   // EBB1
+    S(sta, AB_, 0x0250, 0xEBB6, 4)   // EBB3
+    S(lda, IMM, 0x0001, 0xEBB8, 2)   // EBB6
+    S(sta, ZP_, 0x001C, 0xEBBA, 3)   // EBB8
+    S(sta, ZP_, 0x001D, 0xEBBC, 3)   // EBBA
+    S(jsr, AB_, 0xCB63, 0xEBBF, 6)   // EBBC
+    c->executed += 25;
+    return cycles;
+}
+
+static inline uint32_t rom_EBBF(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCEFA, 0xEBC2, 6)   // EBBF
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EBC2(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF259, 0xEBC5, 6)   // EBC2
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EBC5(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0022, 0xEBC7, 2)   // EBC5
+    S(sta, ZP_, 0x0065, 0xEBC9, 3)   // EBC7
+    S(lda, IMM, 0x00EB, 0xEBCB, 2)   // EBC9
+    S(sta, ZP_, 0x0066, 0xEBCD, 3)   // EBCB
+    S(lda, IMM, 0x000A, 0xEBCF, 2)   // EBCD
+    S(sta, ZP_, 0x0069, 0xEBD1, 3)   // EBCF
+    S(lda, IMM, 0x0005, 0xEBD3, 2)   // EBD1
+    S(sta, ZP_, 0x006A, 0xEBD5, 3)   // EBD3
+    S(lda, IMM, 0x0073, 0xEBD7, 2)   // EBD5
+    S(jsr, AB_, 0xE6C1, 0xEBDA, 6)   // EBD7
+    c->executed += 10;
+    return cycles;
+}
+
+static inline uint32_t rom_EBDA(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x001A, 0xEBDC, 2)   // EBDA
+    S(sta, AB_, 0x1802, 0xEBDF, 4)   // EBDC
+    S(lda, IMM, 0x0000, 0xEBE1, 2)   // EBDF
+    S(sta, AB_, 0x1800, 0xEBE4, 4)   // EBE1
+    S(jsr, AB_, 0xE780, 0xEBE7, 6)   // EBE4
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_EBE7(cpu *c) {
+    uint32_t cycles = 0;
+    S(cli, IMP, 0x0000, 0xEBE8, 2)   // EBE7
+    S(lda, AB_, 0x1800, 0xEBEB, 4)   // EBE8
+    S(and, IMM, 0x00E5, 0xEBED, 2)   // EBEB
+    S(sta, AB_, 0x1800, 0xEBF0, 4)   // EBED
+    S(lda, AB_, 0x0255, 0xEBF3, 4)   // EBF0
+    S(beq, REL, 0x000A, 0xEBF5, 2)   // EBF3
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_EBF5(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xEBF7, 2)   // EBF5
+    S(sta, AB_, 0x0255, 0xEBFA, 4)   // EBF7
+    S(sta, ZP_, 0x0067, 0xEBFC, 3)   // EBFA
+    S(jsr, AB_, 0xC146, 0xEBFF, 6)   // EBFC
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_EBFF(cpu *c) {
+    uint32_t cycles = 0;
+    S(cli, IMP, 0x0000, 0xEC00, 2)   // EBFF
+    S(lda, ZP_, 0x007C, 0xEC02, 3)   // EC00
+    S(beq, REL, 0x0003, 0xEC04, 2)   // EC02
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_EC04(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xE85B, 0xEC07, 3)   // EC04
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EC07(cpu *c) {
+    uint32_t cycles = 0;
+    S(cli, IMP, 0x0000, 0xEC08, 2)   // EC07
+    S(lda, IMM, 0x000E, 0xEC0A, 2)   // EC08
+    S(sta, ZP_, 0x0072, 0xEC0C, 3)   // EC0A
+    S(lda, IMM, 0x0000, 0xEC0E, 2)   // EC0C
+    S(sta, ZP_, 0x006F, 0xEC10, 3)   // EC0E
+    S(sta, ZP_, 0x0070, 0xEC12, 3)   // EC10
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_EC12(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0072, 0xEC14, 3)   // EC12
+    S(lda, ABX, 0x022B, 0xEC17, 4)   // EC14
+    S(cmp, IMM, 0x00FF, 0xEC19, 2)   // EC17
+    S(beq, REL, 0x0010, 0xEC1B, 2)   // EC19
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_EC1B(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x003F, 0xEC1D, 2)   // EC1B
+    S(sta, ZP_, 0x0082, 0xEC1F, 3)   // EC1D
+    S(jsr, AB_, 0xDF93, 0xEC22, 6)   // EC1F
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_EC22(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xEC23, 2)   // EC22
+    S(lda, ABX, 0x025B, 0xEC26, 4)   // EC23
+    S(and, IMM, 0x0001, 0xEC28, 2)   // EC26
+    S(tax, IMP, 0x0000, 0xEC29, 2)   // EC28
+    S(inc, ZPX, 0x006F, 0xEC2B, 6)   // EC29
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_EC2B(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, ZP_, 0x0072, 0xEC2D, 5)   // EC2B
+    S(bpl, REL, 0x00E3, 0xEC2F, 2)   // EC2D
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EC2F(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0004, 0xEC31, 2)   // EC2F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EC31(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABY, 0x0000, 0xEC34, 4)   // EC31
+    S(bpl, REL, 0x0005, 0xEC36, 2)   // EC34
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EC36(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x0001, 0xEC38, 2)   // EC36
+    S(tax, IMP, 0x0000, 0xEC39, 2)   // EC38
+    S(inc, ZPX, 0x006F, 0xEC3B, 6)   // EC39
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_EC3B(cpu *c) {
+    uint32_t cycles = 0;
+    S(dey, IMP, 0x0000, 0xEC3C, 2)   // EC3B
+    S(bpl, REL, 0x00F3, 0xEC3E, 2)   // EC3C
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EC3E(cpu *c) {
+    uint32_t cycles = 0;
+    S(sei, IMP, 0x0000, 0xEC3F, 2)   // EC3E
+    S(lda, AB_, 0x1C00, 0xEC42, 4)   // EC3F
+    S(and, IMM, 0x00F7, 0xEC44, 2)   // EC42
+    S(pha, IMP, 0x0000, 0xEC45, 3)   // EC44
+    S(lda, ZP_, 0x007F, 0xEC47, 3)   // EC45
+    S(sta, ZP_, 0x0086, 0xEC49, 3)   // EC47
+    S(lda, IMM, 0x0000, 0xEC4B, 2)   // EC49
+    S(sta, ZP_, 0x007F, 0xEC4D, 3)   // EC4B
+    S(lda, ZP_, 0x006F, 0xEC4F, 3)   // EC4D
+    S(beq, REL, 0x000B, 0xEC51, 2)   // EC4F
+    c->executed += 10;
+    return cycles;
+}
+
+static inline uint32_t rom_EC51(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x001C, 0xEC53, 3)   // EC51
+    S(beq, REL, 0x0003, 0xEC55, 2)   // EC53
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EC55(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD313, 0xEC58, 6)   // EC55
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EC58(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xEC59, 4)   // EC58
+    S(ora, IMM, 0x0008, 0xEC5B, 2)   // EC59
+    S(pha, IMP, 0x0000, 0xEC5C, 3)   // EC5B
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_EC5C(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZP_, 0x007F, 0xEC5E, 5)   // EC5C
+    S(lda, ZP_, 0x0070, 0xEC60, 3)   // EC5E
+    S(beq, REL, 0x000B, 0xEC62, 2)   // EC60
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_EC62(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x001D, 0xEC64, 3)   // EC62
+    S(beq, REL, 0x0003, 0xEC66, 2)   // EC64
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EC66(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD313, 0xEC69, 6)   // EC66
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EC69(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xEC6A, 4)   // EC69
+    S(ora, IMM, 0x0000, 0xEC6C, 2)   // EC6A
+    S(pha, IMP, 0x0000, 0xEC6D, 3)   // EC6C
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_EC6D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0086, 0xEC6F, 3)   // EC6D
+    S(sta, ZP_, 0x007F, 0xEC71, 3)   // EC6F
+    S(pla, IMP, 0x0000, 0xEC72, 4)   // EC71
+    S(ldx, AB_, 0x026C, 0xEC75, 4)   // EC72
+    S(beq, REL, 0x0021, 0xEC77, 2)   // EC75
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_EC77(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x1C00, 0xEC7A, 4)   // EC77
+    S(cpx, IMM, 0x0080, 0xEC7C, 2)   // EC7A
+    S(bne, REL, 0x0003, 0xEC7E, 2)   // EC7C
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_EC7E(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xEC8B, 0xEC81, 3)   // EC7E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EC81(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, AB_, 0x1805, 0xEC84, 4)   // EC81
+    S(bmi, REL, 0x0012, 0xEC86, 2)   // EC84
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EC86(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, IMM, 0x00A0, 0xEC88, 2)   // EC86
+    S(stx, AB_, 0x1805, 0xEC8B, 4)   // EC88
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EC8B(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, AB_, 0x026C, 0xEC8E, 6)   // EC8B
+    S(bne, REL, 0x0008, 0xEC90, 2)   // EC8E
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EC90(cpu *c) {
+    uint32_t cycles = 0;
+    S(eor, AB_, 0x026D, 0xEC93, 4)   // EC90
+    S(ldx, IMM, 0x0010, 0xEC95, 2)   // EC93
+    S(stx, AB_, 0x026C, 0xEC98, 4)   // EC95
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_EC98(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, AB_, 0x1C00, 0xEC9B, 4)   // EC98
+    S(jmp, AB_, 0xEBFF, 0xEC9E, 3)   // EC9B
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EC9E(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xECA0, 2)   // EC9E
+    S(sta, ZP_, 0x0083, 0xECA2, 3)   // ECA0
+    S(lda, IMM, 0x0001, 0xECA4, 2)   // ECA2
+    S(jsr, AB_, 0xD1E2, 0xECA7, 6)   // ECA4
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_ECA7(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xECA9, 2)   // ECA7
+    S(jsr, AB_, 0xD4C8, 0xECAC, 6)   // ECA9
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_ECAC(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0082, 0xECAE, 3)   // ECAC
+    S(lda, IMM, 0x0000, 0xECB0, 2)   // ECAE
+    S(sta, ABX, 0x0244, 0xECB3, 5)   // ECB0
+    S(jsr, AB_, 0xDF93, 0xECB6, 6)   // ECB3
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_ECB6(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xECB7, 2)   // ECB6
+    S(lda, ZP_, 0x007F, 0xECB9, 3)   // ECB7
+    S(sta, ABX, 0x025B, 0xECBC, 5)   // ECB9
+    S(lda, IMM, 0x0001, 0xECBE, 2)   // ECBC
+    S(jsr, AB_, 0xCFF1, 0xECC1, 6)   // ECBE
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_ECC1(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0004, 0xECC3, 2)   // ECC1
+    S(jsr, AB_, 0xCFF1, 0xECC6, 6)   // ECC3
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_ECC6(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0001, 0xECC8, 2)   // ECC6
+    S(jsr, AB_, 0xCFF1, 0xECCB, 6)   // ECC8
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_ECCB(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCFF1, 0xECCE, 6)   // ECCB
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_ECCE(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0272, 0xECD1, 4)   // ECCE
+    S(jsr, AB_, 0xCFF1, 0xECD4, 6)   // ECD1
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_ECD4(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xECD6, 2)   // ECD4
+    S(jsr, AB_, 0xCFF1, 0xECD9, 6)   // ECD6
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_ECD9(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xED59, 0xECDC, 6)   // ECD9
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_ECDC(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF93, 0xECDF, 6)   // ECDC
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_ECDF(cpu *c) {
+    uint32_t cycles = 0;
+    S(asl, ACC, 0x0000, 0xECE0, 2)   // ECDF
+    S(tax, IMP, 0x0000, 0xECE1, 2)   // ECE0
+    S(dec, ZPX, 0x0099, 0xECE3, 6)   // ECE1
+    S(dec, ZPX, 0x0099, 0xECE5, 6)   // ECE3
+    S(lda, IMM, 0x0000, 0xECE7, 2)   // ECE5
+    S(jsr, AB_, 0xCFF1, 0xECEA, 6)   // ECE7
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_ECEA(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0001, 0xECEC, 2)   // ECEA
+    S(jsr, AB_, 0xCFF1, 0xECEF, 6)   // ECEC
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_ECEF(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCFF1, 0xECF2, 6)   // ECEF
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_ECF2(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xC6CE, 0xECF5, 6)   // ECF2
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_ECF5(cpu *c) {
+    uint32_t cycles = 0;
+    S(bcc, REL, 0x002C, 0xECF7, 2)   // ECF5
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_ECF7(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0272, 0xECFA, 4)   // ECF7
+    S(jsr, AB_, 0xCFF1, 0xECFD, 6)   // ECFA
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_ECFD(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0273, 0xED00, 4)   // ECFD
+    S(jsr, AB_, 0xCFF1, 0xED03, 6)   // ED00
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_ED03(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xED59, 0xED06, 6)   // ED03
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_ED06(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xED08, 2)   // ED06
+    S(jsr, AB_, 0xCFF1, 0xED0B, 6)   // ED08
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_ED0B(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x00DD, 0xED0D, 2)   // ED0B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_ED0D(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF93, 0xED10, 6)   // ED0D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_ED10(cpu *c) {
+    uint32_t cycles = 0;
+    S(asl, ACC, 0x0000, 0xED11, 2)   // ED10
+    S(tax, IMP, 0x0000, 0xED12, 2)   // ED11
+    S(lda, IMM, 0x0000, 0xED14, 2)   // ED12
+    S(sta, ZPX, 0x0099, 0xED16, 4)   // ED14
+    S(lda, IMM, 0x0088, 0xED18, 2)   // ED16
+    S(ldy, ZP_, 0x0082, 0xED1A, 3)   // ED18
+    S(sta, AB_, 0x0254, 0xED1D, 4)   // ED1A
+    S(sta, ABY, 0x00F2, 0xED20, 5)   // ED1D
+    S(lda, ZP_, 0x0085, 0xED22, 3)   // ED20
+    S(rts, IMP, 0x0000, 0xED23, 6)   // ED22
+    c->executed += 10;
+    return cycles;
+}
+
+static inline uint32_t rom_ED23(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0272, 0xED26, 4)   // ED23
+    S(jsr, AB_, 0xCFF1, 0xED29, 6)   // ED26
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_ED29(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0273, 0xED2C, 4)   // ED29
+    S(jsr, AB_, 0xCFF1, 0xED2F, 6)   // ED2C
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_ED2F(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xED59, 0xED32, 6)   // ED2F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_ED32(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF93, 0xED35, 6)   // ED32
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_ED35(cpu *c) {
+    uint32_t cycles = 0;
+    S(asl, ACC, 0x0000, 0xED36, 2)   // ED35
+    S(tax, IMP, 0x0000, 0xED37, 2)   // ED36
+    S(dec, ZPX, 0x0099, 0xED39, 6)   // ED37
+    S(dec, ZPX, 0x0099, 0xED3B, 6)   // ED39
+    S(lda, IMM, 0x0000, 0xED3D, 2)   // ED3B
+    S(jsr, AB_, 0xCFF1, 0xED40, 6)   // ED3D
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_ED40(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCFF1, 0xED43, 6)   // ED40
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_ED43(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xCFF1, 0xED46, 6)   // ED43
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_ED46(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF93, 0xED49, 6)   // ED46
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_ED49(cpu *c) {
+    uint32_t cycles = 0;
+    S(asl, ACC, 0x0000, 0xED4A, 2)   // ED49
+    S(tay, IMP, 0x0000, 0xED4B, 2)   // ED4A
+    S(lda, ABY, 0x0099, 0xED4E, 4)   // ED4B
+    S(ldx, ZP_, 0x0082, 0xED50, 3)   // ED4E
+    S(sta, ABX, 0x0244, 0xED53, 5)   // ED50
+    S(dec, ABX, 0x0244, 0xED56, 7)   // ED53
+    S(jmp, AB_, 0xED0D, 0xED59, 3)   // ED56
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_ED59(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0000, 0xED5B, 2)   // ED59
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_ED5B(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABY, 0x02B1, 0xED5E, 4)   // ED5B
+    S(jsr, AB_, 0xCFF1, 0xED61, 6)   // ED5E
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_ED61(cpu *c) {
+    uint32_t cycles = 0;
+    S(iny, IMP, 0x0000, 0xED62, 2)   // ED61
+    S(cpy, IMM, 0x001B, 0xED64, 2)   // ED62
+    S(bne, REL, 0x00F5, 0xED66, 2)   // ED64
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_ED66(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xED67, 6)   // ED66
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_ED67(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xD137, 0xED6A, 6)   // ED67
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_ED6A(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x0001, 0xED6C, 2)   // ED6A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_ED6C(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xED6D, 6)   // ED6C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_ED6D(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0085, 0xED6F, 3)   // ED6D
+    S(ldy, ZP_, 0x0082, 0xED71, 3)   // ED6F
+    S(lda, ABY, 0x0244, 0xED74, 4)   // ED71
+    S(beq, REL, 0x0008, 0xED76, 2)   // ED74
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_ED76(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0080, 0xED78, 2)   // ED76
+    S(sta, ABY, 0x00F2, 0xED7B, 5)   // ED78
+    S(lda, ZP_, 0x0085, 0xED7D, 3)   // ED7B
+    S(rts, IMP, 0x0000, 0xED7E, 6)   // ED7D
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_ED7E(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xED7F, 3)   // ED7E
+    S(jsr, AB_, 0xECEA, 0xED82, 6)   // ED7F
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_ED82(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xED83, 4)   // ED82
+    S(rts, IMP, 0x0000, 0xED84, 6)   // ED83
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EEF4(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDF93, 0xEEF7, 6)   // EEF4
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EEF7(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xEEF8, 2)   // EEF7
+    S(lda, ABX, 0x025B, 0xEEFB, 4)   // EEF8
+    S(and, IMM, 0x0001, 0xEEFD, 2)   // EEFB
+    S(sta, ZP_, 0x007F, 0xEEFF, 3)   // EEFD
+    S(ldy, ZP_, 0x007F, 0xEF01, 3)   // EEFF
+    S(lda, ABY, 0x0251, 0xEF04, 4)   // EF01
+    S(bne, REL, 0x0001, 0xEF06, 2)   // EF04
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_EF06(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xEF07, 6)   // EF06
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EF07(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xEF09, 2)   // EF07
+    S(sta, ABY, 0x0251, 0xEF0C, 5)   // EF09
+    S(jsr, AB_, 0xEF3A, 0xEF0F, 6)   // EF0C
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_EF0F(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x007F, 0xEF11, 3)   // EF0F
+    S(asl, ACC, 0x0000, 0xEF12, 2)   // EF11
+    S(pha, IMP, 0x0000, 0xEF13, 3)   // EF12
+    S(jsr, AB_, 0xF0A5, 0xEF16, 6)   // EF13
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_EF16(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xEF17, 4)   // EF16
+    S(clc, IMP, 0x0000, 0xEF18, 2)   // EF17
+    S(adc, IMM, 0x0001, 0xEF1A, 2)   // EF18
+    S(jsr, AB_, 0xF0A5, 0xEF1D, 6)   // EF1A
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_EF1D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0080, 0xEF1F, 3)   // EF1D
+    S(pha, IMP, 0x0000, 0xEF20, 3)   // EF1F
+    S(lda, IMM, 0x0001, 0xEF22, 2)   // EF20
+    S(sta, ZP_, 0x0080, 0xEF24, 3)   // EF22
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_EF24(cpu *c) {
+    uint32_t cycles = 0;
+    S(asl, ACC, 0x0000, 0xEF25, 2)   // EF24
+    S(asl, ACC, 0x0000, 0xEF26, 2)   // EF25
+    S(sta, ZP_, 0x006D, 0xEF28, 3)   // EF26
+    S(jsr, AB_, 0xF220, 0xEF2B, 6)   // EF28
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_EF2B(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZP_, 0x0080, 0xEF2D, 5)   // EF2B
+    S(lda, ZP_, 0x0080, 0xEF2F, 3)   // EF2D
+    S(cmp, AB_, 0xFED7, 0xEF32, 4)   // EF2F
+    S(bcc, REL, 0x00F0, 0xEF34, 2)   // EF32
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_EF34(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xEF35, 4)   // EF34
+    S(sta, ZP_, 0x0080, 0xEF37, 3)   // EF35
+    S(jmp, AB_, 0xD58A, 0xEF3A, 3)   // EF37
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_EF3A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF10F, 0xEF3D, 6)   // EF3A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EF3D(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xEF3E, 2)   // EF3D
+    S(jsr, AB_, 0xF0DF, 0xEF41, 6)   // EF3E
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EF41(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x00F9, 0xEF43, 3)   // EF41
+    S(lda, ABX, 0xFEE0, 0xEF46, 4)   // EF43
+    S(sta, ZP_, 0x006E, 0xEF48, 3)   // EF46
+    S(lda, IMM, 0x0000, 0xEF4A, 2)   // EF48
+    S(sta, ZP_, 0x006D, 0xEF4C, 3)   // EF4A
+    S(rts, IMP, 0x0000, 0xEF4D, 6)   // EF4C
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_EF4D(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x007F, 0xEF4F, 3)   // EF4D
+    S(lda, ABX, 0x02FA, 0xEF52, 4)   // EF4F
+    S(sta, AB_, 0x0272, 0xEF55, 4)   // EF52
+    S(lda, ABX, 0x02FC, 0xEF58, 4)   // EF55
+    S(sta, AB_, 0x0273, 0xEF5B, 4)   // EF58
+    S(rts, IMP, 0x0000, 0xEF5C, 6)   // EF5B
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_EF5F(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xEFCF, 0xEF62, 6)   // EF5F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EF62(cpu *c) {
+    uint32_t cycles = 0;
+    S(sec, IMP, 0x0000, 0xEF63, 2)   // EF62
+    S(bne, REL, 0x0022, 0xEF65, 2)   // EF63
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EF65(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x006D, 0xEF67, 5)   // EF65
+    S(ora, ABX, 0xEFE9, 0xEF6A, 4)   // EF67
+    S(sta, INY, 0x006D, 0xEF6C, 6)   // EF6A
+    S(jsr, AB_, 0xEF88, 0xEF6F, 6)   // EF6C
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_EF6F(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, ZP_, 0x006F, 0xEF71, 3)   // EF6F
+    S(clc, IMP, 0x0000, 0xEF72, 2)   // EF71
+    S(lda, INY, 0x006D, 0xEF74, 5)   // EF72
+    S(adc, IMM, 0x0001, 0xEF76, 2)   // EF74
+    S(sta, INY, 0x006D, 0xEF78, 6)   // EF76
+    S(lda, ZP_, 0x0080, 0xEF7A, 3)   // EF78
+    S(cmp, AB_, 0xFE85, 0xEF7D, 4)   // EF7A
+    S(beq, REL, 0x003B, 0xEF7F, 2)   // EF7D
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_EF7F(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ABX, 0x02FA, 0xEF82, 7)   // EF7F
+    S(bne, REL, 0x0003, 0xEF84, 2)   // EF82
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EF84(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ABX, 0x02FC, 0xEF87, 7)   // EF84
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EF87(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xEF88, 6)   // EF87
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EF88(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x007F, 0xEF8A, 3)   // EF88
+    S(lda, IMM, 0x0001, 0xEF8C, 2)   // EF8A
+    S(sta, ABX, 0x0251, 0xEF8F, 5)   // EF8C
+    S(rts, IMP, 0x0000, 0xEF90, 6)   // EF8F
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_EF90(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xEFF1, 0xEF93, 6)   // EF90
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EF93(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xEFCF, 0xEF96, 6)   // EF93
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EF96(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x0036, 0xEF98, 2)   // EF96
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EF98(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x006D, 0xEF9A, 5)   // EF98
+    S(eor, ABX, 0xEFE9, 0xEF9D, 4)   // EF9A
+    S(sta, INY, 0x006D, 0xEF9F, 6)   // EF9D
+    S(jsr, AB_, 0xEF88, 0xEFA2, 6)   // EF9F
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_EFA2(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, ZP_, 0x006F, 0xEFA4, 3)   // EFA2
+    S(lda, INY, 0x006D, 0xEFA6, 5)   // EFA4
+    S(sec, IMP, 0x0000, 0xEFA7, 2)   // EFA6
+    S(sbc, IMM, 0x0001, 0xEFA9, 2)   // EFA7
+    S(sta, INY, 0x006D, 0xEFAB, 6)   // EFA9
+    S(lda, ZP_, 0x0080, 0xEFAD, 3)   // EFAB
+    S(cmp, AB_, 0xFE85, 0xEFB0, 4)   // EFAD
+    S(beq, REL, 0x000B, 0xEFB2, 2)   // EFB0
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_EFB2(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABX, 0x02FA, 0xEFB5, 4)   // EFB2
+    S(bne, REL, 0x0003, 0xEFB7, 2)   // EFB5
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EFB7(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, ABX, 0x02FC, 0xEFBA, 7)   // EFB7
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EFBA(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, ABX, 0x02FA, 0xEFBD, 7)   // EFBA
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EFBD(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABX, 0x02FC, 0xEFC0, 4)   // EFBD
+    S(bne, REL, 0x000C, 0xEFC2, 2)   // EFC0
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EFC2(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABX, 0x02FA, 0xEFC5, 4)   // EFC2
+    S(cmp, IMM, 0x0003, 0xEFC7, 2)   // EFC5
+    S(bcs, REL, 0x0005, 0xEFC9, 2)   // EFC7
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_EFC9(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0072, 0xEFCB, 2)   // EFC9
+    S(jsr, AB_, 0xE6C7, 0xEFCE, 6)   // EFCB
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EFCE(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xEFCF, 6)   // EFCE
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EFCF(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF011, 0xEFD2, 6)   // EFCF
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EFD2(cpu *c) {
+    uint32_t cycles = 0;
+    S(tya, IMP, 0x0000, 0xEFD3, 2)   // EFD2
+    S(sta, ZP_, 0x006F, 0xEFD5, 3)   // EFD3
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_EFD5(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0081, 0xEFD7, 3)   // EFD5
+    S(lsr, ACC, 0x0000, 0xEFD8, 2)   // EFD7
+    S(lsr, ACC, 0x0000, 0xEFD9, 2)   // EFD8
+    S(lsr, ACC, 0x0000, 0xEFDA, 2)   // EFD9
+    S(sec, IMP, 0x0000, 0xEFDB, 2)   // EFDA
+    S(adc, ZP_, 0x006F, 0xEFDD, 3)   // EFDB
+    S(tay, IMP, 0x0000, 0xEFDE, 2)   // EFDD
+    S(lda, ZP_, 0x0081, 0xEFE0, 3)   // EFDE
+    S(and, IMM, 0x0007, 0xEFE2, 2)   // EFE0
+    S(tax, IMP, 0x0000, 0xEFE3, 2)   // EFE2
+    S(lda, INY, 0x006D, 0xEFE5, 5)   // EFE3
+    S(and, ABX, 0xEFE9, 0xEFE8, 4)   // EFE5
+    S(rts, IMP, 0x0000, 0xEFE9, 6)   // EFE8
+    c->executed += 13;
+    return cycles;
+}
+
+static inline uint32_t rom_EFF1(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x00FF, 0xEFF3, 2)   // EFF1
+    S(bit, AB_, 0x02F9, 0xEFF6, 4)   // EFF3
+    S(beq, REL, 0x000C, 0xEFF8, 2)   // EFF6
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_EFF8(cpu *c) {
+    uint32_t cycles = 0;
+    S(bpl, REL, 0x000A, 0xEFFA, 2)   // EFF8
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EFFA(cpu *c) {
+    uint32_t cycles = 0;
+    S(bvs, REL, 0x0008, 0xEFFC, 2)   // EFFA
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_EFFC(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xEFFE, 2)   // EFFC
+    S(sta, AB_, 0x02F9, 0xF001, 4)   // EFFE
+    S(jmp, AB_, 0xD58A, 0xF004, 3)   // F001
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F004(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xF005, 6)   // F004
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F011(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x006F, 0xF013, 3)   // F011
+    S(pha, IMP, 0x0000, 0xF014, 3)   // F013
+    S(lda, ZP_, 0x0070, 0xF016, 3)   // F014
+    S(pha, IMP, 0x0000, 0xF017, 3)   // F016
+    S(ldx, ZP_, 0x007F, 0xF019, 3)   // F017
+    S(lda, ZPX, 0x00FF, 0xF01B, 4)   // F019
+    S(beq, REL, 0x0005, 0xF01D, 2)   // F01B
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_F01D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0074, 0xF01F, 2)   // F01D
+    S(jsr, AB_, 0xE648, 0xF022, 6)   // F01F
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F022(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF10F, 0xF025, 6)   // F022
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F025(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x006F, 0xF027, 3)   // F025
+    S(txa, IMP, 0x0000, 0xF028, 2)   // F027
+    S(asl, ACC, 0x0000, 0xF029, 2)   // F028
+    S(sta, ZP_, 0x0070, 0xF02B, 3)   // F029
+    S(tax, IMP, 0x0000, 0xF02C, 2)   // F02B
+    S(lda, ZP_, 0x0080, 0xF02E, 3)   // F02C
+    S(cmp, ABX, 0x029D, 0xF031, 4)   // F02E
+    S(beq, REL, 0x000B, 0xF033, 2)   // F031
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_F033(cpu *c) {
+    uint32_t cycles = 0;
+    S(inx, IMP, 0x0000, 0xF034, 2)   // F033
+    S(stx, ZP_, 0x0070, 0xF036, 3)   // F034
+    S(cmp, ABX, 0x029D, 0xF039, 4)   // F036
+    S(beq, REL, 0x0003, 0xF03B, 2)   // F039
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_F03B(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF05B, 0xF03E, 6)   // F03B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F03E(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0070, 0xF040, 3)   // F03E
+    S(ldx, ZP_, 0x007F, 0xF042, 3)   // F040
+    S(sta, ABX, 0x029B, 0xF045, 5)   // F042
+    S(asl, ACC, 0x0000, 0xF046, 2)   // F045
+    S(asl, ACC, 0x0000, 0xF047, 2)   // F046
+    S(clc, IMP, 0x0000, 0xF048, 2)   // F047
+    S(adc, IMM, 0x00A1, 0xF04A, 2)   // F048
+    S(sta, ZP_, 0x006D, 0xF04C, 3)   // F04A
+    S(lda, IMM, 0x0002, 0xF04E, 2)   // F04C
+    S(adc, IMM, 0x0000, 0xF050, 2)   // F04E
+    S(sta, ZP_, 0x006E, 0xF052, 3)   // F050
+    S(ldy, IMM, 0x0000, 0xF054, 2)   // F052
+    S(pla, IMP, 0x0000, 0xF055, 4)   // F054
+    S(sta, ZP_, 0x0070, 0xF057, 3)   // F055
+    S(pla, IMP, 0x0000, 0xF058, 4)   // F057
+    S(sta, ZP_, 0x006F, 0xF05A, 3)   // F058
+    S(rts, IMP, 0x0000, 0xF05B, 6)   // F05A
+    c->executed += 17;
+    return cycles;
+}
+
+static inline uint32_t rom_F05B(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x006F, 0xF05D, 3)   // F05B
+    S(jsr, AB_, 0xF0DF, 0xF060, 6)   // F05D
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F060(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x007F, 0xF062, 3)   // F060
+    S(tax, IMP, 0x0000, 0xF063, 2)   // F062
+    S(asl, ACC, 0x0000, 0xF064, 2)   // F063
+    S(ora, ABX, 0x029B, 0xF067, 4)   // F064
+    S(eor, IMM, 0x0001, 0xF069, 2)   // F067
+    S(and, IMM, 0x0003, 0xF06B, 2)   // F069
+    S(sta, ZP_, 0x0070, 0xF06D, 3)   // F06B
+    S(jsr, AB_, 0xF0A5, 0xF070, 6)   // F06D
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_F070(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x00F9, 0xF072, 3)   // F070
+    S(asl, ACC, 0x0000, 0xF073, 2)   // F072
+    S(tax, IMP, 0x0000, 0xF074, 2)   // F073
+    S(lda, ZP_, 0x0080, 0xF076, 3)   // F074
+    S(asl, ACC, 0x0000, 0xF077, 2)   // F076
+    S(asl, ACC, 0x0000, 0xF078, 2)   // F077
+    S(sta, ZPX, 0x0099, 0xF07A, 4)   // F078
+    S(lda, ZP_, 0x0070, 0xF07C, 3)   // F07A
+    S(asl, ACC, 0x0000, 0xF07D, 2)   // F07C
+    S(asl, ACC, 0x0000, 0xF07E, 2)   // F07D
+    S(tay, IMP, 0x0000, 0xF07F, 2)   // F07E
+    c->executed += 11;
+    return cycles;
+}
+
+static inline uint32_t rom_F07F(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INX, 0x0099, 0xF081, 6)   // F07F
+    S(sta, ABY, 0x02A1, 0xF084, 5)   // F081
+    S(lda, IMM, 0x0000, 0xF086, 2)   // F084
+    S(sta, INX, 0x0099, 0xF088, 6)   // F086
+    S(inc, ZPX, 0x0099, 0xF08A, 6)   // F088
+    S(iny, IMP, 0x0000, 0xF08B, 2)   // F08A
+    S(tya, IMP, 0x0000, 0xF08C, 2)   // F08B
+    S(and, IMM, 0x0003, 0xF08E, 2)   // F08C
+    S(bne, REL, 0x00EF, 0xF090, 2)   // F08E
+    c->executed += 9;
+    return cycles;
+}
+
+static inline uint32_t rom_F090(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0070, 0xF092, 3)   // F090
+    S(lda, ZP_, 0x0080, 0xF094, 3)   // F092
+    S(sta, ABX, 0x029D, 0xF097, 5)   // F094
+    S(lda, AB_, 0x02F9, 0xF09A, 4)   // F097
+    S(bne, REL, 0x0003, 0xF09C, 2)   // F09A
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_F09C(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xD58A, 0xF09F, 3)   // F09C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F09F(cpu *c) {
+    uint32_t cycles = 0;
+    S(ora, IMM, 0x0080, 0xF0A1, 2)   // F09F
+    S(sta, AB_, 0x02F9, 0xF0A4, 4)   // F0A1
+    S(rts, IMP, 0x0000, 0xF0A5, 6)   // F0A4
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F0A5(cpu *c) {
+    uint32_t cycles = 0;
+    S(tay, IMP, 0x0000, 0xF0A6, 2)   // F0A5
+    S(lda, ABY, 0x029D, 0xF0A9, 4)   // F0A6
+    S(beq, REL, 0x0025, 0xF0AB, 2)   // F0A9
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F0AB(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xF0AC, 3)   // F0AB
+    S(lda, IMM, 0x0000, 0xF0AE, 2)   // F0AC
+    S(sta, ABY, 0x029D, 0xF0B1, 5)   // F0AE
+    S(lda, ZP_, 0x00F9, 0xF0B3, 3)   // F0B1
+    S(asl, ACC, 0x0000, 0xF0B4, 2)   // F0B3
+    S(tax, IMP, 0x0000, 0xF0B5, 2)   // F0B4
+    S(pla, IMP, 0x0000, 0xF0B6, 4)   // F0B5
+    S(asl, ACC, 0x0000, 0xF0B7, 2)   // F0B6
+    S(asl, ACC, 0x0000, 0xF0B8, 2)   // F0B7
+    S(sta, ZPX, 0x0099, 0xF0BA, 4)   // F0B8
+    S(tya, IMP, 0x0000, 0xF0BB, 2)   // F0BA
+    S(asl, ACC, 0x0000, 0xF0BC, 2)   // F0BB
+    S(asl, ACC, 0x0000, 0xF0BD, 2)   // F0BC
+    S(tay, IMP, 0x0000, 0xF0BE, 2)   // F0BD
+    c->executed += 14;
+    return cycles;
+}
+
+static inline uint32_t rom_F0BE(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABY, 0x02A1, 0xF0C1, 4)   // F0BE
+    S(sta, INX, 0x0099, 0xF0C3, 6)   // F0C1
+    S(lda, IMM, 0x0000, 0xF0C5, 2)   // F0C3
+    S(sta, ABY, 0x02A1, 0xF0C8, 5)   // F0C5
+    S(inc, ZPX, 0x0099, 0xF0CA, 6)   // F0C8
+    S(iny, IMP, 0x0000, 0xF0CB, 2)   // F0CA
+    S(tya, IMP, 0x0000, 0xF0CC, 2)   // F0CB
+    S(and, IMM, 0x0003, 0xF0CE, 2)   // F0CC
+    S(bne, REL, 0x00EE, 0xF0D0, 2)   // F0CE
+    c->executed += 9;
+    return cycles;
+}
+
+static inline uint32_t rom_F0D0(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xF0D1, 6)   // F0D0
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F0D1(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x007F, 0xF0D3, 3)   // F0D1
+    S(asl, ACC, 0x0000, 0xF0D4, 2)   // F0D3
+    S(tax, IMP, 0x0000, 0xF0D5, 2)   // F0D4
+    S(lda, IMM, 0x0000, 0xF0D7, 2)   // F0D5
+    S(sta, ABX, 0x029D, 0xF0DA, 5)   // F0D7
+    S(inx, IMP, 0x0000, 0xF0DB, 2)   // F0DA
+    S(sta, ABX, 0x029D, 0xF0DE, 5)   // F0DB
+    S(rts, IMP, 0x0000, 0xF0DF, 6)   // F0DE
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_F0DF(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZPX, 0x00A7, 0xF0E1, 4)   // F0DF
+    S(cmp, IMM, 0x00FF, 0xF0E3, 2)   // F0E1
+    S(bne, REL, 0x0025, 0xF0E5, 2)   // F0E3
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F0E5(cpu *c) {
+    uint32_t cycles = 0;
+    S(txa, IMP, 0x0000, 0xF0E6, 2)   // F0E5
+    S(pha, IMP, 0x0000, 0xF0E7, 3)   // F0E6
+    S(jsr, AB_, 0xD28E, 0xF0EA, 6)   // F0E7
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F0EA(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xF0EB, 2)   // F0EA
+    S(bpl, REL, 0x0005, 0xF0ED, 2)   // F0EB
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F0ED(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0070, 0xF0EF, 2)   // F0ED
+    S(jsr, AB_, 0xC1C8, 0xF0F2, 6)   // F0EF
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F0F2(cpu *c) {
+    uint32_t cycles = 0;
+    S(stx, ZP_, 0x00F9, 0xF0F4, 3)   // F0F2
+    S(pla, IMP, 0x0000, 0xF0F5, 4)   // F0F4
+    S(tay, IMP, 0x0000, 0xF0F6, 2)   // F0F5
+    S(txa, IMP, 0x0000, 0xF0F7, 2)   // F0F6
+    S(ora, IMM, 0x0080, 0xF0F9, 2)   // F0F7
+    S(sta, ABY, 0x00A7, 0xF0FC, 5)   // F0F9
+    S(asl, ACC, 0x0000, 0xF0FD, 2)   // F0FC
+    S(tax, IMP, 0x0000, 0xF0FE, 2)   // F0FD
+    S(lda, AB_, 0xFE85, 0xF101, 4)   // F0FE
+    S(sta, ZPX, 0x0006, 0xF103, 4)   // F101
+    S(lda, IMM, 0x0000, 0xF105, 2)   // F103
+    S(sta, ZPX, 0x0007, 0xF107, 4)   // F105
+    S(jmp, AB_, 0xD586, 0xF10A, 3)   // F107
+    c->executed += 13;
+    return cycles;
+}
+
+static inline uint32_t rom_F10A(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x000F, 0xF10C, 2)   // F10A
+    S(sta, ZP_, 0x00F9, 0xF10E, 3)   // F10C
+    S(rts, IMP, 0x0000, 0xF10F, 6)   // F10E
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F10F(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0006, 0xF111, 2)   // F10F
+    S(ldx, ZP_, 0x007F, 0xF113, 3)   // F111
+    S(bne, REL, 0x0003, 0xF115, 2)   // F113
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F115(cpu *c) {
+    uint32_t cycles = 0;
+    S(clc, IMP, 0x0000, 0xF116, 2)   // F115
+    S(adc, IMM, 0x0007, 0xF118, 2)   // F116
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F118(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xF119, 6)   // F118
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F119(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF10F, 0xF11C, 6)   // F119
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F11C(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xF11D, 2)   // F11C
+    S(rts, IMP, 0x0000, 0xF11E, 6)   // F11D
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F11E(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xDE3E, 0xF121, 6)   // F11E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F121(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0003, 0xF123, 2)   // F121
+    S(sta, ZP_, 0x006F, 0xF125, 3)   // F123
+    S(lda, IMM, 0x0001, 0xF127, 2)   // F125
+    S(ora, AB_, 0x02F9, 0xF12A, 4)   // F127
+    S(sta, AB_, 0x02F9, 0xF12D, 4)   // F12A
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_F12D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x006F, 0xF12F, 3)   // F12D
+    S(pha, IMP, 0x0000, 0xF130, 3)   // F12F
+    S(jsr, AB_, 0xF011, 0xF133, 6)   // F130
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F133(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xF134, 4)   // F133
+    S(sta, ZP_, 0x006F, 0xF136, 3)   // F134
+    S(lda, INY, 0x006D, 0xF138, 5)   // F136
+    S(bne, REL, 0x0039, 0xF13A, 2)   // F138
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_F13A(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0080, 0xF13C, 3)   // F13A
+    S(cmp, AB_, 0xFE85, 0xF13F, 4)   // F13C
+    S(beq, REL, 0x0019, 0xF141, 2)   // F13F
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F141(cpu *c) {
+    uint32_t cycles = 0;
+    S(bcc, REL, 0x001C, 0xF143, 2)   // F141
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F143(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZP_, 0x0080, 0xF145, 5)   // F143
+    S(lda, ZP_, 0x0080, 0xF147, 3)   // F145
+    S(cmp, AB_, 0xFED7, 0xF14A, 4)   // F147
+    S(bne, REL, 0x00E1, 0xF14C, 2)   // F14A
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_F14C(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, AB_, 0xFE85, 0xF14F, 4)   // F14C
+    S(dex, IMP, 0x0000, 0xF150, 2)   // F14F
+    S(stx, ZP_, 0x0080, 0xF152, 3)   // F150
+    S(lda, IMM, 0x0000, 0xF154, 2)   // F152
+    S(sta, ZP_, 0x0081, 0xF156, 3)   // F154
+    S(dec, ZP_, 0x006F, 0xF158, 5)   // F156
+    S(bne, REL, 0x00D3, 0xF15A, 2)   // F158
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_F15A(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0072, 0xF15C, 2)   // F15A
+    S(jsr, AB_, 0xC1C8, 0xF15F, 6)   // F15C
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F15F(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, ZP_, 0x0080, 0xF161, 5)   // F15F
+    S(bne, REL, 0x00CA, 0xF163, 2)   // F161
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F163(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, AB_, 0xFE85, 0xF166, 4)   // F163
+    S(inx, IMP, 0x0000, 0xF167, 2)   // F166
+    S(stx, ZP_, 0x0080, 0xF169, 3)   // F167
+    S(lda, IMM, 0x0000, 0xF16B, 2)   // F169
+    S(sta, ZP_, 0x0081, 0xF16D, 3)   // F16B
+    S(dec, ZP_, 0x006F, 0xF16F, 5)   // F16D
+    S(bne, REL, 0x00BC, 0xF171, 2)   // F16F
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_F171(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x00E7, 0xF173, 2)   // F171
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F173(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0081, 0xF175, 3)   // F173
+    S(clc, IMP, 0x0000, 0xF176, 2)   // F175
+    S(adc, ZP_, 0x0069, 0xF178, 3)   // F176
+    S(sta, ZP_, 0x0081, 0xF17A, 3)   // F178
+    S(lda, ZP_, 0x0080, 0xF17C, 3)   // F17A
+    S(jsr, AB_, 0xF24B, 0xF17F, 6)   // F17C
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_F17F(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, AB_, 0x024E, 0xF182, 4)   // F17F
+    S(sta, AB_, 0x024D, 0xF185, 4)   // F182
+    S(cmp, ZP_, 0x0081, 0xF187, 3)   // F185
+    S(bcs, REL, 0x000C, 0xF189, 2)   // F187
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_F189(cpu *c) {
+    uint32_t cycles = 0;
+    S(sec, IMP, 0x0000, 0xF18A, 2)   // F189
+    S(lda, ZP_, 0x0081, 0xF18C, 3)   // F18A
+    S(sbc, AB_, 0x024E, 0xF18F, 4)   // F18C
+    S(sta, ZP_, 0x0081, 0xF191, 3)   // F18F
+    S(beq, REL, 0x0002, 0xF193, 2)   // F191
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_F193(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, ZP_, 0x0081, 0xF195, 5)   // F193
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F195(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF1FA, 0xF198, 6)   // F195
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F198(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x0003, 0xF19A, 2)   // F198
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F19A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xEF90, 0xF19D, 3)   // F19A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F19D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xF19F, 2)   // F19D
+    S(sta, ZP_, 0x0081, 0xF1A1, 3)   // F19F
+    S(jsr, AB_, 0xF1FA, 0xF1A4, 6)   // F1A1
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F1A4(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x00F4, 0xF1A6, 2)   // F1A4
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F1A6(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xF1F5, 0xF1A9, 3)   // F1A6
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F1A9(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0001, 0xF1AB, 2)   // F1A9
+    S(ora, AB_, 0x02F9, 0xF1AE, 4)   // F1AB
+    S(sta, AB_, 0x02F9, 0xF1B1, 4)   // F1AE
+    S(lda, ZP_, 0x0086, 0xF1B3, 3)   // F1B1
+    S(pha, IMP, 0x0000, 0xF1B4, 3)   // F1B3
+    S(lda, IMM, 0x0001, 0xF1B6, 2)   // F1B4
+    S(sta, ZP_, 0x0086, 0xF1B8, 3)   // F1B6
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_F1B8(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0xFE85, 0xF1BB, 4)   // F1B8
+    S(sec, IMP, 0x0000, 0xF1BC, 2)   // F1BB
+    S(sbc, ZP_, 0x0086, 0xF1BE, 3)   // F1BC
+    S(sta, ZP_, 0x0080, 0xF1C0, 3)   // F1BE
+    S(bcc, REL, 0x0009, 0xF1C2, 2)   // F1C0
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_F1C2(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x0007, 0xF1C4, 2)   // F1C2
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F1C4(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF011, 0xF1C7, 6)   // F1C4
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F1C7(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x006D, 0xF1C9, 5)   // F1C7
+    S(bne, REL, 0x001B, 0xF1CB, 2)   // F1C9
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F1CB(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0xFE85, 0xF1CE, 4)   // F1CB
+    S(clc, IMP, 0x0000, 0xF1CF, 2)   // F1CE
+    S(adc, ZP_, 0x0086, 0xF1D1, 3)   // F1CF
+    S(sta, ZP_, 0x0080, 0xF1D3, 3)   // F1D1
+    S(inc, ZP_, 0x0086, 0xF1D5, 5)   // F1D3
+    S(cmp, AB_, 0xFED7, 0xF1D8, 4)   // F1D5
+    S(bcc, REL, 0x0005, 0xF1DA, 2)   // F1D8
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_F1DA(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0067, 0xF1DC, 2)   // F1DA
+    S(jsr, AB_, 0xE645, 0xF1DF, 6)   // F1DC
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F1DF(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF011, 0xF1E2, 6)   // F1DF
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F1E2(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x006D, 0xF1E4, 5)   // F1E2
+    S(beq, REL, 0x00D2, 0xF1E6, 2)   // F1E4
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F1E6(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xF1E7, 4)   // F1E6
+    S(sta, ZP_, 0x0086, 0xF1E9, 3)   // F1E7
+    S(lda, IMM, 0x0000, 0xF1EB, 2)   // F1E9
+    S(sta, ZP_, 0x0081, 0xF1ED, 3)   // F1EB
+    S(jsr, AB_, 0xF1FA, 0xF1F0, 6)   // F1ED
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_F1F0(cpu *c) {
+    uint32_t cycles = 0;
+    S(beq, REL, 0x0003, 0xF1F2, 2)   // F1F0
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F1F2(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xEF90, 0xF1F5, 3)   // F1F2
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F1F5(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0071, 0xF1F7, 2)   // F1F5
+    S(jsr, AB_, 0xE645, 0xF1FA, 6)   // F1F7
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F1FA(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF011, 0xF1FD, 6)   // F1FA
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F1FD(cpu *c) {
+    uint32_t cycles = 0;
+    S(tya, IMP, 0x0000, 0xF1FE, 2)   // F1FD
+    S(pha, IMP, 0x0000, 0xF1FF, 3)   // F1FE
+    S(jsr, AB_, 0xF220, 0xF202, 6)   // F1FF
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F202(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0080, 0xF204, 3)   // F202
+    S(jsr, AB_, 0xF24B, 0xF207, 6)   // F204
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F207(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, AB_, 0x024E, 0xF20A, 4)   // F207
+    S(pla, IMP, 0x0000, 0xF20B, 4)   // F20A
+    S(sta, ZP_, 0x006F, 0xF20D, 3)   // F20B
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F20D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0081, 0xF20F, 3)   // F20D
+    S(cmp, AB_, 0x024E, 0xF212, 4)   // F20F
+    S(bcs, REL, 0x0009, 0xF214, 2)   // F212
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F214(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xEFD5, 0xF217, 6)   // F214
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F217(cpu *c) {
+    uint32_t cycles = 0;
+    S(bne, REL, 0x0006, 0xF219, 2)   // F217
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F219(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZP_, 0x0081, 0xF21B, 5)   // F219
+    S(bne, REL, 0x00F0, 0xF21D, 2)   // F21B
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F21D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xF21F, 2)   // F21D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F21F(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xF220, 6)   // F21F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F220(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x006F, 0xF222, 3)   // F220
+    S(pha, IMP, 0x0000, 0xF223, 3)   // F222
+    S(lda, IMM, 0x0000, 0xF225, 2)   // F223
+    S(sta, ZP_, 0x006F, 0xF227, 3)   // F225
+    S(ldy, AB_, 0xFE86, 0xF22A, 4)   // F227
+    S(dey, IMP, 0x0000, 0xF22B, 2)   // F22A
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_F22B(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, IMM, 0x0007, 0xF22D, 2)   // F22B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F22D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x006D, 0xF22F, 5)   // F22D
+    S(and, ABX, 0xEFE9, 0xF232, 4)   // F22F
+    S(beq, REL, 0x0002, 0xF234, 2)   // F232
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F234(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZP_, 0x006F, 0xF236, 5)   // F234
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F236(cpu *c) {
+    uint32_t cycles = 0;
+    S(dex, IMP, 0x0000, 0xF237, 2)   // F236
+    S(bpl, REL, 0x00F4, 0xF239, 2)   // F237
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F239(cpu *c) {
+    uint32_t cycles = 0;
+    S(dey, IMP, 0x0000, 0xF23A, 2)   // F239
+    S(bne, REL, 0x00EF, 0xF23C, 2)   // F23A
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F23C(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x006D, 0xF23E, 5)   // F23C
+    S(cmp, ZP_, 0x006F, 0xF240, 3)   // F23E
+    S(bne, REL, 0x0004, 0xF242, 2)   // F240
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F242(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xF243, 4)   // F242
+    S(sta, ZP_, 0x006F, 0xF245, 3)   // F243
+    S(rts, IMP, 0x0000, 0xF246, 6)   // F245
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F246(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0071, 0xF248, 2)   // F246
+    S(jsr, AB_, 0xE645, 0xF24B, 6)   // F248
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F24B(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, AB_, 0xFED6, 0xF24E, 4)   // F24B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F24E(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, ABX, 0xFED6, 0xF251, 4)   // F24E
+    S(dex, IMP, 0x0000, 0xF252, 2)   // F251
+    S(bcs, REL, 0x00FA, 0xF254, 2)   // F252
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F254(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABX, 0xFED1, 0xF257, 4)   // F254
+    S(rts, IMP, 0x0000, 0xF258, 6)   // F257
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F258(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xF259, 6)   // F258
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F259(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x006F, 0xF25B, 2)   // F259
+    S(sta, AB_, 0x1C02, 0xF25E, 4)   // F25B
+    S(and, IMM, 0x00F0, 0xF260, 2)   // F25E
+    S(sta, AB_, 0x1C00, 0xF263, 4)   // F260
+    S(lda, AB_, 0x1C0C, 0xF266, 4)   // F263
+    S(and, IMM, 0x00FE, 0xF268, 2)   // F266
+    S(ora, IMM, 0x000E, 0xF26A, 2)   // F268
+    S(ora, IMM, 0x00E0, 0xF26C, 2)   // F26A
+    S(sta, AB_, 0x1C0C, 0xF26F, 4)   // F26C
+    S(lda, IMM, 0x0041, 0xF271, 2)   // F26F
+    S(sta, AB_, 0x1C0B, 0xF274, 4)   // F271
+    S(lda, IMM, 0x0000, 0xF276, 2)   // F274
+    S(sta, AB_, 0x1C06, 0xF279, 4)   // F276
+    S(lda, IMM, 0x003A, 0xF27B, 2)   // F279
+    S(sta, AB_, 0x1C07, 0xF27E, 4)   // F27B
+    S(sta, AB_, 0x1C05, 0xF281, 4)   // F27E
+    S(lda, IMM, 0x007F, 0xF283, 2)   // F281
+    S(sta, AB_, 0x1C0E, 0xF286, 4)   // F283
+    S(lda, IMM, 0x00C0, 0xF288, 2)   // F286
+    S(sta, AB_, 0x1C0D, 0xF28B, 4)   // F288
+    S(sta, AB_, 0x1C0E, 0xF28E, 4)   // F28B
+    S(lda, IMM, 0x00FF, 0xF290, 2)   // F28E
+    S(sta, ZP_, 0x003E, 0xF292, 3)   // F290
+    S(sta, ZP_, 0x0051, 0xF294, 3)   // F292
+    S(lda, IMM, 0x0008, 0xF296, 2)   // F294
+    S(sta, ZP_, 0x0039, 0xF298, 3)   // F296
+    S(lda, IMM, 0x0007, 0xF29A, 2)   // F298
+    S(sta, ZP_, 0x0047, 0xF29C, 3)   // F29A
+    S(lda, IMM, 0x0005, 0xF29E, 2)   // F29C
+    S(sta, ZP_, 0x0062, 0xF2A0, 3)   // F29E
+    S(lda, IMM, 0x00FA, 0xF2A2, 2)   // F2A0
+    S(sta, ZP_, 0x0063, 0xF2A4, 3)   // F2A2
+    S(lda, IMM, 0x00C8, 0xF2A6, 2)   // F2A4
+    S(sta, ZP_, 0x0064, 0xF2A8, 3)   // F2A6
+    S(lda, IMM, 0x0004, 0xF2AA, 2)   // F2A8
+    S(sta, ZP_, 0x005E, 0xF2AC, 3)   // F2AA
+    S(lda, IMM, 0x0004, 0xF2AE, 2)   // F2AC
+    S(sta, ZP_, 0x005F, 0xF2B0, 3)   // F2AE
+    c->executed += 38;
+    return cycles;
+}
+
+static inline uint32_t rom_F2B0(cpu *c) {
+    uint32_t cycles = 0;
+    S(tsx, IMP, 0x0000, 0xF2B1, 2)   // F2B0
+    S(stx, ZP_, 0x0049, 0xF2B3, 3)   // F2B1
+    S(lda, AB_, 0x1C04, 0xF2B6, 4)   // F2B3
+    S(lda, AB_, 0x1C0C, 0xF2B9, 4)   // F2B6
+    S(ora, IMM, 0x000E, 0xF2BB, 2)   // F2B9
+    S(sta, AB_, 0x1C0C, 0xF2BE, 4)   // F2BB
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_F2BE(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0005, 0xF2C0, 2)   // F2BE
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F2C0(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABY, 0x0000, 0xF2C3, 4)   // F2C0
+    S(bpl, REL, 0x002E, 0xF2C5, 2)   // F2C3
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F2C5(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x00D0, 0xF2C7, 2)   // F2C5
+    S(bne, REL, 0x0004, 0xF2C9, 2)   // F2C7
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F2C9(cpu *c) {
+    uint32_t cycles = 0;
+    S(tya, IMP, 0x0000, 0xF2CA, 2)   // F2C9
+    S(jmp, AB_, 0xF370, 0xF2CD, 3)   // F2CA
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F2CD(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x0001, 0xF2CF, 2)   // F2CD
+    S(beq, REL, 0x0007, 0xF2D1, 2)   // F2CF
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F2D1(cpu *c) {
+    uint32_t cycles = 0;
+    S(sty, ZP_, 0x003F, 0xF2D3, 3)   // F2D1
+    S(lda, IMM, 0x000F, 0xF2D5, 2)   // F2D3
+    S(jmp, AB_, 0xF969, 0xF2D8, 3)   // F2D5
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F2D8(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xF2D9, 2)   // F2D8
+    S(sta, ZP_, 0x003D, 0xF2DB, 3)   // F2D9
+    S(cmp, ZP_, 0x003E, 0xF2DD, 3)   // F2DB
+    S(beq, REL, 0x000A, 0xF2DF, 2)   // F2DD
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_F2DF(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF97E, 0xF2E2, 6)   // F2DF
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F2E2(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x003D, 0xF2E4, 3)   // F2E2
+    S(sta, ZP_, 0x003E, 0xF2E6, 3)   // F2E4
+    S(jmp, AB_, 0xF99C, 0xF2E9, 3)   // F2E6
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F2E9(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0020, 0xF2EB, 3)   // F2E9
+    S(bmi, REL, 0x0003, 0xF2ED, 2)   // F2EB
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F2ED(cpu *c) {
+    uint32_t cycles = 0;
+    S(asl, ACC, 0x0000, 0xF2EE, 2)   // F2ED
+    S(bpl, REL, 0x0009, 0xF2F0, 2)   // F2EE
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F2F0(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xF99C, 0xF2F3, 3)   // F2F0
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F2F3(cpu *c) {
+    uint32_t cycles = 0;
+    S(dey, IMP, 0x0000, 0xF2F4, 2)   // F2F3
+    S(bpl, REL, 0x00CA, 0xF2F6, 2)   // F2F4
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F2F6(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xF99C, 0xF2F9, 3)   // F2F6
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F2F9(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0020, 0xF2FB, 2)   // F2F9
+    S(sta, ZP_, 0x0020, 0xF2FD, 3)   // F2FB
+    S(ldy, IMM, 0x0005, 0xF2FF, 2)   // F2FD
+    S(sty, ZP_, 0x003F, 0xF301, 3)   // F2FF
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_F301(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF393, 0xF304, 6)   // F301
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F304(cpu *c) {
+    uint32_t cycles = 0;
+    S(bmi, REL, 0x001A, 0xF306, 2)   // F304
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F306(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, ZP_, 0x003F, 0xF308, 5)   // F306
+    S(bpl, REL, 0x00F7, 0xF30A, 2)   // F308
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F30A(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, ZP_, 0x0041, 0xF30C, 3)   // F30A
+    S(jsr, AB_, 0xF395, 0xF30F, 6)   // F30C
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F30F(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0042, 0xF311, 3)   // F30F
+    S(sta, ZP_, 0x004A, 0xF313, 3)   // F311
+    S(asl, ZP_, 0x004A, 0xF315, 5)   // F313
+    S(lda, IMM, 0x0060, 0xF317, 2)   // F315
+    S(sta, ZP_, 0x0020, 0xF319, 3)   // F317
+    S(lda, INY, 0x0032, 0xF31B, 5)   // F319
+    S(sta, ZP_, 0x0022, 0xF31D, 3)   // F31B
+    S(jmp, AB_, 0xF99C, 0xF320, 3)   // F31D
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_F320(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x0001, 0xF322, 2)   // F320
+    S(cmp, ZP_, 0x003D, 0xF324, 3)   // F322
+    S(bne, REL, 0x00E0, 0xF326, 2)   // F324
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F326(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0022, 0xF328, 3)   // F326
+    S(beq, REL, 0x0012, 0xF32A, 2)   // F328
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F32A(cpu *c) {
+    uint32_t cycles = 0;
+    S(sec, IMP, 0x0000, 0xF32B, 2)   // F32A
+    S(sbc, INY, 0x0032, 0xF32D, 5)   // F32B
+    S(beq, REL, 0x000D, 0xF32F, 2)   // F32D
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F32F(cpu *c) {
+    uint32_t cycles = 0;
+    S(eor, IMM, 0x00FF, 0xF331, 2)   // F32F
+    S(sta, ZP_, 0x0042, 0xF333, 3)   // F331
+    S(inc, ZP_, 0x0042, 0xF335, 5)   // F333
+    S(lda, ZP_, 0x003F, 0xF337, 3)   // F335
+    S(sta, ZP_, 0x0041, 0xF339, 3)   // F337
+    S(jmp, AB_, 0xF306, 0xF33C, 3)   // F339
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_F33C(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, IMM, 0x0004, 0xF33E, 2)   // F33C
+    S(lda, INY, 0x0032, 0xF340, 5)   // F33E
+    S(sta, ZP_, 0x0040, 0xF342, 3)   // F340
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F342(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, ABX, 0xFED6, 0xF345, 4)   // F342
+    S(dex, IMP, 0x0000, 0xF346, 2)   // F345
+    S(bcs, REL, 0x00FA, 0xF348, 2)   // F346
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F348(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABX, 0xFED1, 0xF34B, 4)   // F348
+    S(sta, ZP_, 0x0043, 0xF34D, 3)   // F34B
+    S(txa, IMP, 0x0000, 0xF34E, 2)   // F34D
+    S(asl, ACC, 0x0000, 0xF34F, 2)   // F34E
+    S(asl, ACC, 0x0000, 0xF350, 2)   // F34F
+    S(asl, ACC, 0x0000, 0xF351, 2)   // F350
+    S(asl, ACC, 0x0000, 0xF352, 2)   // F351
+    S(asl, ACC, 0x0000, 0xF353, 2)   // F352
+    S(sta, ZP_, 0x0044, 0xF355, 3)   // F353
+    S(lda, AB_, 0x1C00, 0xF358, 4)   // F355
+    S(and, IMM, 0x009F, 0xF35A, 2)   // F358
+    S(ora, ZP_, 0x0044, 0xF35C, 3)   // F35A
+    S(sta, AB_, 0x1C00, 0xF35F, 4)   // F35C
+    S(ldx, ZP_, 0x003D, 0xF361, 3)   // F35F
+    S(lda, ZP_, 0x0045, 0xF363, 3)   // F361
+    S(cmp, IMM, 0x0040, 0xF365, 2)   // F363
+    S(beq, REL, 0x0015, 0xF367, 2)   // F365
+    c->executed += 17;
+    return cycles;
+}
+
+static inline uint32_t rom_F367(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0060, 0xF369, 2)   // F367
+    S(beq, REL, 0x0003, 0xF36B, 2)   // F369
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F36B(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xF3B1, 0xF36E, 3)   // F36B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F36E(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x003F, 0xF370, 3)   // F36E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F370(cpu *c) {
+    uint32_t cycles = 0;
+    S(clc, IMP, 0x0000, 0xF371, 2)   // F370
+    S(adc, IMM, 0x0003, 0xF373, 2)   // F371
+    S(sta, ZP_, 0x0031, 0xF375, 3)   // F373
+    S(lda, IMM, 0x0000, 0xF377, 2)   // F375
+    S(sta, ZP_, 0x0030, 0xF379, 3)   // F377
+    S(jmp, IN_, 0x0030, 0xF37C, 5)   // F379
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_F37C(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0060, 0xF37E, 2)   // F37C
+    S(sta, ZP_, 0x0020, 0xF380, 3)   // F37E
+    S(lda, AB_, 0x1C00, 0xF383, 4)   // F380
+    S(and, IMM, 0x00FC, 0xF385, 2)   // F383
+    S(sta, AB_, 0x1C00, 0xF388, 4)   // F385
+    S(lda, IMM, 0x00A4, 0xF38A, 2)   // F388
+    S(sta, ZP_, 0x004A, 0xF38C, 3)   // F38A
+    S(lda, IMM, 0x0001, 0xF38E, 2)   // F38C
+    S(sta, ZP_, 0x0022, 0xF390, 3)   // F38E
+    S(jmp, AB_, 0xF969, 0xF393, 3)   // F390
+    c->executed += 10;
+    return cycles;
+}
+
+static inline uint32_t rom_F393(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, ZP_, 0x003F, 0xF395, 3)   // F393
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F395(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABY, 0x0000, 0xF398, 4)   // F395
+    S(pha, IMP, 0x0000, 0xF399, 3)   // F398
+    S(bpl, REL, 0x0010, 0xF39B, 2)   // F399
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F39B(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x0078, 0xF39D, 2)   // F39B
+    S(sta, ZP_, 0x0045, 0xF39F, 3)   // F39D
+    S(tya, IMP, 0x0000, 0xF3A0, 2)   // F39F
+    S(asl, ACC, 0x0000, 0xF3A1, 2)   // F3A0
+    S(adc, IMM, 0x0006, 0xF3A3, 2)   // F3A1
+    S(sta, ZP_, 0x0032, 0xF3A5, 3)   // F3A3
+    S(tya, IMP, 0x0000, 0xF3A6, 2)   // F3A5
+    S(clc, IMP, 0x0000, 0xF3A7, 2)   // F3A6
+    S(adc, IMM, 0x0003, 0xF3A9, 2)   // F3A7
+    S(sta, ZP_, 0x0031, 0xF3AB, 3)   // F3A9
+    c->executed += 10;
+    return cycles;
+}
+
+static inline uint32_t rom_F3AB(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0000, 0xF3AD, 2)   // F3AB
+    S(sty, ZP_, 0x0030, 0xF3AF, 3)   // F3AD
+    S(pla, IMP, 0x0000, 0xF3B0, 4)   // F3AF
+    S(rts, IMP, 0x0000, 0xF3B1, 6)   // F3B0
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_F3B1(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, IMM, 0x005A, 0xF3B3, 2)   // F3B1
+    S(stx, ZP_, 0x004B, 0xF3B5, 3)   // F3B3
+    S(ldx, IMM, 0x0000, 0xF3B7, 2)   // F3B5
+    S(lda, IMM, 0x0052, 0xF3B9, 2)   // F3B7
+    S(sta, ZP_, 0x0024, 0xF3BB, 3)   // F3B9
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_F3BB(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF556, 0xF3BE, 6)   // F3BB
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F3BE(cpu *c) {
+    uint32_t cycles = 0;
+    S(bvc, REL, 0x00FE, 0xF3C0, 2)   // F3BE
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F3C0(cpu *c) {
+    uint32_t cycles = 0;
+    S(clv, IMP, 0x0000, 0xF3C1, 2)   // F3C0
+    S(lda, AB_, 0x1C01, 0xF3C4, 4)   // F3C1
+    S(cmp, ZP_, 0x0024, 0xF3C6, 3)   // F3C4
+    S(bne, REL, 0x003F, 0xF3C8, 2)   // F3C6
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_F3C8(cpu *c) {
+    uint32_t cycles = 0;
+    S(bvc, REL, 0x00FE, 0xF3CA, 2)   // F3C8
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F3CA(cpu *c) {
+    uint32_t cycles = 0;
+    S(clv, IMP, 0x0000, 0xF3CB, 2)   // F3CA
+    S(lda, AB_, 0x1C01, 0xF3CE, 4)   // F3CB
+    S(sta, ZPX, 0x0025, 0xF3D0, 4)   // F3CE
+    S(inx, IMP, 0x0000, 0xF3D1, 2)   // F3D0
+    S(cpx, IMM, 0x0007, 0xF3D3, 2)   // F3D1
+    S(bne, REL, 0x00F3, 0xF3D5, 2)   // F3D3
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_F3D5(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF497, 0xF3D8, 6)   // F3D5
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F3D8(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0004, 0xF3DA, 2)   // F3D8
+    S(lda, IMM, 0x0000, 0xF3DC, 2)   // F3DA
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F3DC(cpu *c) {
+    uint32_t cycles = 0;
+    S(eor, ABY, 0x0016, 0xF3DF, 4)   // F3DC
+    S(dey, IMP, 0x0000, 0xF3E0, 2)   // F3DF
+    S(bpl, REL, 0x00FA, 0xF3E2, 2)   // F3E0
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F3E2(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0000, 0xF3E4, 2)   // F3E2
+    S(bne, REL, 0x0038, 0xF3E6, 2)   // F3E4
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F3E6(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x003E, 0xF3E8, 3)   // F3E6
+    S(lda, ZP_, 0x0018, 0xF3EA, 3)   // F3E8
+    S(sta, ZPX, 0x0022, 0xF3EC, 4)   // F3EA
+    S(lda, ZP_, 0x0045, 0xF3EE, 3)   // F3EC
+    S(cmp, IMM, 0x0030, 0xF3F0, 2)   // F3EE
+    S(beq, REL, 0x001E, 0xF3F2, 2)   // F3F0
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_F3F2(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x003E, 0xF3F4, 3)   // F3F2
+    S(asl, ACC, 0x0000, 0xF3F5, 2)   // F3F4
+    S(tay, IMP, 0x0000, 0xF3F6, 2)   // F3F5
+    S(lda, ABY, 0x0012, 0xF3F9, 4)   // F3F6
+    S(cmp, ZP_, 0x0016, 0xF3FB, 3)   // F3F9
+    S(bne, REL, 0x001E, 0xF3FD, 2)   // F3FB
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_F3FD(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABY, 0x0013, 0xF400, 4)   // F3FD
+    S(cmp, ZP_, 0x0017, 0xF402, 3)   // F400
+    S(bne, REL, 0x0017, 0xF404, 2)   // F402
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F404(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xF423, 0xF407, 3)   // F404
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F407(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, ZP_, 0x004B, 0xF409, 5)   // F407
+    S(bne, REL, 0x00B0, 0xF40B, 2)   // F409
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F40B(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0002, 0xF40D, 2)   // F40B
+    S(jsr, AB_, 0xF969, 0xF410, 6)   // F40D
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F410(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0016, 0xF412, 3)   // F410
+    S(sta, ZP_, 0x0012, 0xF414, 3)   // F412
+    S(lda, ZP_, 0x0017, 0xF416, 3)   // F414
+    S(sta, ZP_, 0x0013, 0xF418, 3)   // F416
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_F418(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0001, 0xF41A, 2)   // F418
+    S(bit, AB_, 0x0BA9, 0xF41D, 4)   // F41A
+    S(bit, AB_, 0x09A9, 0xF420, 4)   // F41D
+    S(jmp, AB_, 0xF969, 0xF423, 3)   // F420
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_F41B(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x000B, 0xF41D, 2)   // F41B
+    S(bit, AB_, 0x09A9, 0xF420, 4)   // F41D
+    S(jmp, AB_, 0xF969, 0xF423, 3)   // F420
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F41E(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0009, 0xF420, 2)   // F41E
+    S(jmp, AB_, 0xF969, 0xF423, 3)   // F420
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F423(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x007F, 0xF425, 2)   // F423
+    S(sta, ZP_, 0x004C, 0xF427, 3)   // F425
+    S(lda, ZP_, 0x0019, 0xF429, 3)   // F427
+    S(clc, IMP, 0x0000, 0xF42A, 2)   // F429
+    S(adc, IMM, 0x0002, 0xF42C, 2)   // F42A
+    S(cmp, ZP_, 0x0043, 0xF42E, 3)   // F42C
+    S(bcc, REL, 0x0002, 0xF430, 2)   // F42E
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_F430(cpu *c) {
+    uint32_t cycles = 0;
+    S(sbc, ZP_, 0x0043, 0xF432, 3)   // F430
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F432(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x004D, 0xF434, 3)   // F432
+    S(ldx, IMM, 0x0005, 0xF436, 2)   // F434
+    S(stx, ZP_, 0x003F, 0xF438, 3)   // F436
+    S(ldx, IMM, 0x00FF, 0xF43A, 2)   // F438
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_F43A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF393, 0xF43D, 6)   // F43A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F43D(cpu *c) {
+    uint32_t cycles = 0;
+    S(bpl, REL, 0x0044, 0xF43F, 2)   // F43D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F43F(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0044, 0xF441, 3)   // F43F
+    S(and, IMM, 0x0001, 0xF443, 2)   // F441
+    S(cmp, ZP_, 0x003E, 0xF445, 3)   // F443
+    S(bne, REL, 0x003C, 0xF447, 2)   // F445
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_F447(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0000, 0xF449, 2)   // F447
+    S(lda, INY, 0x0032, 0xF44B, 5)   // F449
+    S(cmp, ZP_, 0x0040, 0xF44D, 3)   // F44B
+    S(bne, REL, 0x0034, 0xF44F, 2)   // F44D
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_F44F(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0045, 0xF451, 3)   // F44F
+    S(cmp, IMM, 0x0060, 0xF453, 2)   // F451
+    S(beq, REL, 0x000C, 0xF455, 2)   // F453
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F455(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0001, 0xF457, 2)   // F455
+    S(sec, IMP, 0x0000, 0xF458, 2)   // F457
+    S(lda, INY, 0x0032, 0xF45A, 5)   // F458
+    S(sbc, ZP_, 0x004D, 0xF45C, 3)   // F45A
+    S(bpl, REL, 0x0003, 0xF45E, 2)   // F45C
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_F45E(cpu *c) {
+    uint32_t cycles = 0;
+    S(clc, IMP, 0x0000, 0xF45F, 2)   // F45E
+    S(adc, ZP_, 0x0043, 0xF461, 3)   // F45F
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F461(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, ZP_, 0x004C, 0xF463, 3)   // F461
+    S(bcs, REL, 0x001E, 0xF465, 2)   // F463
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F465(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xF466, 3)   // F465
+    S(lda, ZP_, 0x0045, 0xF468, 3)   // F466
+    S(beq, REL, 0x0014, 0xF46A, 2)   // F468
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F46A(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xF46B, 4)   // F46A
+    S(cmp, IMM, 0x0009, 0xF46D, 2)   // F46B
+    S(bcc, REL, 0x0014, 0xF46F, 2)   // F46D
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F46F(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x000C, 0xF471, 2)   // F46F
+    S(bcs, REL, 0x0010, 0xF473, 2)   // F471
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F473(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x004C, 0xF475, 3)   // F473
+    S(lda, ZP_, 0x003F, 0xF477, 3)   // F475
+    S(tax, IMP, 0x0000, 0xF478, 2)   // F477
+    S(adc, IMM, 0x0003, 0xF47A, 2)   // F478
+    S(sta, ZP_, 0x0031, 0xF47C, 3)   // F47A
+    S(bne, REL, 0x0005, 0xF47E, 2)   // F47C
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_F47E(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xF47F, 4)   // F47E
+    S(cmp, IMM, 0x0006, 0xF481, 2)   // F47F
+    S(bcc, REL, 0x00F0, 0xF483, 2)   // F481
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F483(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, ZP_, 0x003F, 0xF485, 5)   // F483
+    S(bpl, REL, 0x00B3, 0xF487, 2)   // F485
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F487(cpu *c) {
+    uint32_t cycles = 0;
+    S(txa, IMP, 0x0000, 0xF488, 2)   // F487
+    S(bpl, REL, 0x0003, 0xF48A, 2)   // F488
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F48A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xF99C, 0xF48D, 3)   // F48A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F48D(cpu *c) {
+    uint32_t cycles = 0;
+    S(stx, ZP_, 0x003F, 0xF48F, 3)   // F48D
+    S(jsr, AB_, 0xF393, 0xF492, 6)   // F48F
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F492(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0045, 0xF494, 3)   // F492
+    S(jmp, AB_, 0xF4CA, 0xF497, 3)   // F494
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F497(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0030, 0xF499, 3)   // F497
+    S(pha, IMP, 0x0000, 0xF49A, 3)   // F499
+    S(lda, ZP_, 0x0031, 0xF49C, 3)   // F49A
+    S(pha, IMP, 0x0000, 0xF49D, 3)   // F49C
+    S(lda, IMM, 0x0024, 0xF49F, 2)   // F49D
+    S(sta, ZP_, 0x0030, 0xF4A1, 3)   // F49F
+    S(lda, IMM, 0x0000, 0xF4A3, 2)   // F4A1
+    S(sta, ZP_, 0x0031, 0xF4A5, 3)   // F4A3
+    S(lda, IMM, 0x0000, 0xF4A7, 2)   // F4A5
+    S(sta, ZP_, 0x0034, 0xF4A9, 3)   // F4A7
+    S(jsr, AB_, 0xF7E6, 0xF4AC, 6)   // F4A9
+    c->executed += 11;
+    return cycles;
+}
+
+static inline uint32_t rom_F4AC(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0055, 0xF4AE, 3)   // F4AC
+    S(sta, ZP_, 0x0018, 0xF4B0, 3)   // F4AE
+    S(lda, ZP_, 0x0054, 0xF4B2, 3)   // F4B0
+    S(sta, ZP_, 0x0019, 0xF4B4, 3)   // F4B2
+    S(lda, ZP_, 0x0053, 0xF4B6, 3)   // F4B4
+    S(sta, ZP_, 0x001A, 0xF4B8, 3)   // F4B6
+    S(jsr, AB_, 0xF7E6, 0xF4BB, 6)   // F4B8
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_F4BB(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0052, 0xF4BD, 3)   // F4BB
+    S(sta, ZP_, 0x0017, 0xF4BF, 3)   // F4BD
+    S(lda, ZP_, 0x0053, 0xF4C1, 3)   // F4BF
+    S(sta, ZP_, 0x0016, 0xF4C3, 3)   // F4C1
+    S(pla, IMP, 0x0000, 0xF4C4, 4)   // F4C3
+    S(sta, ZP_, 0x0031, 0xF4C6, 3)   // F4C4
+    S(pla, IMP, 0x0000, 0xF4C7, 4)   // F4C6
+    S(sta, ZP_, 0x0030, 0xF4C9, 3)   // F4C7
+    S(rts, IMP, 0x0000, 0xF4CA, 6)   // F4C9
+    c->executed += 9;
+    return cycles;
+}
+
+static inline uint32_t rom_F4CA(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0000, 0xF4CC, 2)   // F4CA
+    S(beq, REL, 0x0003, 0xF4CE, 2)   // F4CC
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F4CE(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xF56E, 0xF4D1, 3)   // F4CE
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F4D1(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF50A, 0xF4D4, 6)   // F4D1
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F4D4(cpu *c) {
+    uint32_t cycles = 0;
+    S(bvc, REL, 0x00FE, 0xF4D6, 2)   // F4D4
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F4D6(cpu *c) {
+    uint32_t cycles = 0;
+    S(clv, IMP, 0x0000, 0xF4D7, 2)   // F4D6
+    S(lda, AB_, 0x1C01, 0xF4DA, 4)   // F4D7
+    S(sta, INY, 0x0030, 0xF4DC, 6)   // F4DA
+    S(iny, IMP, 0x0000, 0xF4DD, 2)   // F4DC
+    S(bne, REL, 0x00F5, 0xF4DF, 2)   // F4DD
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_F4DF(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x00BA, 0xF4E1, 2)   // F4DF
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F4E1(cpu *c) {
+    uint32_t cycles = 0;
+    S(bvc, REL, 0x00FE, 0xF4E3, 2)   // F4E1
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F4E3(cpu *c) {
+    uint32_t cycles = 0;
+    S(clv, IMP, 0x0000, 0xF4E4, 2)   // F4E3
+    S(lda, AB_, 0x1C01, 0xF4E7, 4)   // F4E4
+    S(sta, ABY, 0x0100, 0xF4EA, 5)   // F4E7
+    S(iny, IMP, 0x0000, 0xF4EB, 2)   // F4EA
+    S(bne, REL, 0x00F4, 0xF4ED, 2)   // F4EB
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_F4ED(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF8E0, 0xF4F0, 6)   // F4ED
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F4F0(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0038, 0xF4F2, 3)   // F4F0
+    S(cmp, ZP_, 0x0047, 0xF4F4, 3)   // F4F2
+    S(beq, REL, 0x0005, 0xF4F6, 2)   // F4F4
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F4F6(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0004, 0xF4F8, 2)   // F4F6
+    S(jmp, AB_, 0xF969, 0xF4FB, 3)   // F4F8
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F4FB(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF5E9, 0xF4FE, 6)   // F4FB
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F4FE(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, ZP_, 0x003A, 0xF500, 3)   // F4FE
+    S(beq, REL, 0x0003, 0xF502, 2)   // F500
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F502(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0005, 0xF504, 2)   // F502
+    S(bit, AB_, 0x01A9, 0xF507, 4)   // F504
+    S(jmp, AB_, 0xF969, 0xF50A, 3)   // F507
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F505(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0001, 0xF507, 2)   // F505
+    S(jmp, AB_, 0xF969, 0xF50A, 3)   // F507
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F50A(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF510, 0xF50D, 6)   // F50A
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F50D(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xF556, 0xF510, 3)   // F50D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F510(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x003D, 0xF512, 3)   // F510
+    S(asl, ACC, 0x0000, 0xF513, 2)   // F512
+    S(tax, IMP, 0x0000, 0xF514, 2)   // F513
+    S(lda, ZPX, 0x0012, 0xF516, 4)   // F514
+    S(sta, ZP_, 0x0016, 0xF518, 3)   // F516
+    S(lda, ZPX, 0x0013, 0xF51A, 4)   // F518
+    S(sta, ZP_, 0x0017, 0xF51C, 3)   // F51A
+    S(ldy, IMM, 0x0000, 0xF51E, 2)   // F51C
+    S(lda, INY, 0x0032, 0xF520, 5)   // F51E
+    S(sta, ZP_, 0x0018, 0xF522, 3)   // F520
+    S(iny, IMP, 0x0000, 0xF523, 2)   // F522
+    S(lda, INY, 0x0032, 0xF525, 5)   // F523
+    S(sta, ZP_, 0x0019, 0xF527, 3)   // F525
+    S(lda, IMM, 0x0000, 0xF529, 2)   // F527
+    S(eor, ZP_, 0x0016, 0xF52B, 3)   // F529
+    S(eor, ZP_, 0x0017, 0xF52D, 3)   // F52B
+    S(eor, ZP_, 0x0018, 0xF52F, 3)   // F52D
+    S(eor, ZP_, 0x0019, 0xF531, 3)   // F52F
+    S(sta, ZP_, 0x001A, 0xF533, 3)   // F531
+    S(jsr, AB_, 0xF934, 0xF536, 6)   // F533
+    c->executed += 20;
+    return cycles;
+}
+
+static inline uint32_t rom_F536(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, IMM, 0x005A, 0xF538, 2)   // F536
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F538(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF556, 0xF53B, 6)   // F538
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F53B(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x0000, 0xF53D, 2)   // F53B
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F53D(cpu *c) {
+    uint32_t cycles = 0;
+    S(bvc, REL, 0x00FE, 0xF53F, 2)   // F53D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F53F(cpu *c) {
+    uint32_t cycles = 0;
+    S(clv, IMP, 0x0000, 0xF540, 2)   // F53F
+    S(lda, AB_, 0x1C01, 0xF543, 4)   // F540
+    S(cmp, ABY, 0x0024, 0xF546, 4)   // F543
+    S(bne, REL, 0x0006, 0xF548, 2)   // F546
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_F548(cpu *c) {
+    uint32_t cycles = 0;
+    S(iny, IMP, 0x0000, 0xF549, 2)   // F548
+    S(cpy, IMM, 0x0008, 0xF54B, 2)   // F549
+    S(bne, REL, 0x00F0, 0xF54D, 2)   // F54B
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F54D(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xF54E, 6)   // F54D
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F54E(cpu *c) {
+    uint32_t cycles = 0;
+    S(dex, IMP, 0x0000, 0xF54F, 2)   // F54E
+    S(bne, REL, 0x00E7, 0xF551, 2)   // F54F
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F551(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0002, 0xF553, 2)   // F551
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F553(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xF969, 0xF556, 3)   // F553
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F556(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x00D0, 0xF558, 2)   // F556
+    S(sta, AB_, 0x1805, 0xF55B, 4)   // F558
+    S(lda, IMM, 0x0003, 0xF55D, 2)   // F55B
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F55D(cpu *c) {
+    uint32_t cycles = 0;
+    S(bit, AB_, 0x1805, 0xF560, 4)   // F55D
+    S(bpl, REL, 0x00F1, 0xF562, 2)   // F560
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F562(cpu *c) {
+    uint32_t cycles = 0;
+    S(bit, AB_, 0x1C00, 0xF565, 4)   // F562
+    S(bmi, REL, 0x00F6, 0xF567, 2)   // F565
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F567(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x1C01, 0xF56A, 4)   // F567
+    S(clv, IMP, 0x0000, 0xF56B, 2)   // F56A
+    S(ldy, IMM, 0x0000, 0xF56D, 2)   // F56B
+    S(rts, IMP, 0x0000, 0xF56E, 6)   // F56D
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_F56E(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0010, 0xF570, 2)   // F56E
+    S(beq, REL, 0x0003, 0xF572, 2)   // F570
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F572(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xF691, 0xF575, 3)   // F572
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F575(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF5E9, 0xF578, 6)   // F575
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F578(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x003A, 0xF57A, 3)   // F578
+    S(lda, AB_, 0x1C00, 0xF57D, 4)   // F57A
+    S(and, IMM, 0x0010, 0xF57F, 2)   // F57D
+    S(bne, REL, 0x0005, 0xF581, 2)   // F57F
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_F581(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0008, 0xF583, 2)   // F581
+    S(jmp, AB_, 0xF969, 0xF586, 3)   // F583
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F586(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF78F, 0xF589, 6)   // F586
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F589(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF510, 0xF58C, 6)   // F589
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F58C(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, IMM, 0x0008, 0xF58E, 2)   // F58C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F58E(cpu *c) {
+    uint32_t cycles = 0;
+    S(bvc, REL, 0x00FE, 0xF590, 2)   // F58E
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F590(cpu *c) {
+    uint32_t cycles = 0;
+    S(clv, IMP, 0x0000, 0xF591, 2)   // F590
+    S(dex, IMP, 0x0000, 0xF592, 2)   // F591
+    S(bne, REL, 0x00FA, 0xF594, 2)   // F592
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F594(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x00FF, 0xF596, 2)   // F594
+    S(sta, AB_, 0x1C03, 0xF599, 4)   // F596
+    S(lda, AB_, 0x1C0C, 0xF59C, 4)   // F599
+    S(and, IMM, 0x001F, 0xF59E, 2)   // F59C
+    S(ora, IMM, 0x00C0, 0xF5A0, 2)   // F59E
+    S(sta, AB_, 0x1C0C, 0xF5A3, 4)   // F5A0
+    S(lda, IMM, 0x00FF, 0xF5A5, 2)   // F5A3
+    S(ldx, IMM, 0x0005, 0xF5A7, 2)   // F5A5
+    S(sta, AB_, 0x1C01, 0xF5AA, 4)   // F5A7
+    S(clv, IMP, 0x0000, 0xF5AB, 2)   // F5AA
+    c->executed += 10;
+    return cycles;
+}
+
+static inline uint32_t rom_F5AB(cpu *c) {
+    uint32_t cycles = 0;
+    S(bvc, REL, 0x00FE, 0xF5AD, 2)   // F5AB
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F5AD(cpu *c) {
+    uint32_t cycles = 0;
+    S(clv, IMP, 0x0000, 0xF5AE, 2)   // F5AD
+    S(dex, IMP, 0x0000, 0xF5AF, 2)   // F5AE
+    S(bne, REL, 0x00FA, 0xF5B1, 2)   // F5AF
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F5B1(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x00BB, 0xF5B3, 2)   // F5B1
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F5B3(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABY, 0x0100, 0xF5B6, 4)   // F5B3
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F5B6(cpu *c) {
+    uint32_t cycles = 0;
+    S(bvc, REL, 0x00FE, 0xF5B8, 2)   // F5B6
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F5B8(cpu *c) {
+    uint32_t cycles = 0;
+    S(clv, IMP, 0x0000, 0xF5B9, 2)   // F5B8
+    S(sta, AB_, 0x1C01, 0xF5BC, 4)   // F5B9
+    S(iny, IMP, 0x0000, 0xF5BD, 2)   // F5BC
+    S(bne, REL, 0x00F4, 0xF5BF, 2)   // F5BD
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_F5BF(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x0030, 0xF5C1, 5)   // F5BF
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F5C1(cpu *c) {
+    uint32_t cycles = 0;
+    S(bvc, REL, 0x00FE, 0xF5C3, 2)   // F5C1
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F5C3(cpu *c) {
+    uint32_t cycles = 0;
+    S(clv, IMP, 0x0000, 0xF5C4, 2)   // F5C3
+    S(sta, AB_, 0x1C01, 0xF5C7, 4)   // F5C4
+    S(iny, IMP, 0x0000, 0xF5C8, 2)   // F5C7
+    S(bne, REL, 0x00F5, 0xF5CA, 2)   // F5C8
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_F5CA(cpu *c) {
+    uint32_t cycles = 0;
+    S(bvc, REL, 0x00FE, 0xF5CC, 2)   // F5CA
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F5CC(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x1C0C, 0xF5CF, 4)   // F5CC
+    S(ora, IMM, 0x00E0, 0xF5D1, 2)   // F5CF
+    S(sta, AB_, 0x1C0C, 0xF5D4, 4)   // F5D1
+    S(lda, IMM, 0x0000, 0xF5D6, 2)   // F5D4
+    S(sta, AB_, 0x1C03, 0xF5D9, 4)   // F5D6
+    S(jsr, AB_, 0xF5F2, 0xF5DC, 6)   // F5D9
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_F5DC(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, ZP_, 0x003F, 0xF5DE, 3)   // F5DC
+    S(lda, ABY, 0x0000, 0xF5E1, 4)   // F5DE
+    S(eor, IMM, 0x0030, 0xF5E3, 2)   // F5E1
+    S(sta, ABY, 0x0000, 0xF5E6, 5)   // F5E3
+    S(jmp, AB_, 0xF3B1, 0xF5E9, 3)   // F5E6
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_F5E9(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xF5EB, 2)   // F5E9
+    S(tay, IMP, 0x0000, 0xF5EC, 2)   // F5EB
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F5EC(cpu *c) {
+    uint32_t cycles = 0;
+    S(eor, INY, 0x0030, 0xF5EE, 5)   // F5EC
+    S(iny, IMP, 0x0000, 0xF5EF, 2)   // F5EE
+    S(bne, REL, 0x00FB, 0xF5F1, 2)   // F5EF
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F5F1(cpu *c) {
+    uint32_t cycles = 0;
+    S(rts, IMP, 0x0000, 0xF5F2, 6)   // F5F1
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F5F2(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xF5F4, 2)   // F5F2
+    S(sta, ZP_, 0x002E, 0xF5F6, 3)   // F5F4
+    S(sta, ZP_, 0x0030, 0xF5F8, 3)   // F5F6
+    S(sta, ZP_, 0x004F, 0xF5FA, 3)   // F5F8
+    S(lda, ZP_, 0x0031, 0xF5FC, 3)   // F5FA
+    S(sta, ZP_, 0x004E, 0xF5FE, 3)   // F5FC
+    S(lda, IMM, 0x0001, 0xF600, 2)   // F5FE
+    S(sta, ZP_, 0x0031, 0xF602, 3)   // F600
+    S(sta, ZP_, 0x002F, 0xF604, 3)   // F602
+    S(lda, IMM, 0x00BB, 0xF606, 2)   // F604
+    S(sta, ZP_, 0x0034, 0xF608, 3)   // F606
+    S(sta, ZP_, 0x0036, 0xF60A, 3)   // F608
+    S(jsr, AB_, 0xF7E6, 0xF60D, 6)   // F60A
+    c->executed += 13;
+    return cycles;
+}
+
+static inline uint32_t rom_F60D(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0052, 0xF60F, 3)   // F60D
+    S(sta, ZP_, 0x0038, 0xF611, 3)   // F60F
+    S(ldy, ZP_, 0x0036, 0xF613, 3)   // F611
+    S(lda, ZP_, 0x0053, 0xF615, 3)   // F613
+    S(sta, INY, 0x002E, 0xF617, 6)   // F615
+    S(iny, IMP, 0x0000, 0xF618, 2)   // F617
+    S(lda, ZP_, 0x0054, 0xF61A, 3)   // F618
+    S(sta, INY, 0x002E, 0xF61C, 6)   // F61A
+    S(iny, IMP, 0x0000, 0xF61D, 2)   // F61C
+    S(lda, ZP_, 0x0055, 0xF61F, 3)   // F61D
+    S(sta, INY, 0x002E, 0xF621, 6)   // F61F
+    S(iny, IMP, 0x0000, 0xF622, 2)   // F621
+    S(sty, ZP_, 0x0036, 0xF624, 3)   // F622
+    c->executed += 13;
+    return cycles;
+}
+
+static inline uint32_t rom_F624(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF7E6, 0xF627, 6)   // F624
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F627(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, ZP_, 0x0036, 0xF629, 3)   // F627
+    S(lda, ZP_, 0x0052, 0xF62B, 3)   // F629
+    S(sta, INY, 0x002E, 0xF62D, 6)   // F62B
+    S(iny, IMP, 0x0000, 0xF62E, 2)   // F62D
+    S(lda, ZP_, 0x0053, 0xF630, 3)   // F62E
+    S(sta, INY, 0x002E, 0xF632, 6)   // F630
+    S(iny, IMP, 0x0000, 0xF633, 2)   // F632
+    S(beq, REL, 0x000E, 0xF635, 2)   // F633
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_F635(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0054, 0xF637, 3)   // F635
+    S(sta, INY, 0x002E, 0xF639, 6)   // F637
+    S(iny, IMP, 0x0000, 0xF63A, 2)   // F639
+    S(lda, ZP_, 0x0055, 0xF63C, 3)   // F63A
+    S(sta, INY, 0x002E, 0xF63E, 6)   // F63C
+    S(iny, IMP, 0x0000, 0xF63F, 2)   // F63E
+    S(sty, ZP_, 0x0036, 0xF641, 3)   // F63F
+    S(bne, REL, 0x00E1, 0xF643, 2)   // F641
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_F643(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0054, 0xF645, 3)   // F643
+    S(sta, INY, 0x0030, 0xF647, 6)   // F645
+    S(iny, IMP, 0x0000, 0xF648, 2)   // F647
+    S(lda, ZP_, 0x0055, 0xF64A, 3)   // F648
+    S(sta, INY, 0x0030, 0xF64C, 6)   // F64A
+    S(iny, IMP, 0x0000, 0xF64D, 2)   // F64C
+    S(sty, ZP_, 0x0036, 0xF64F, 3)   // F64D
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_F64F(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF7E6, 0xF652, 6)   // F64F
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F652(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, ZP_, 0x0036, 0xF654, 3)   // F652
+    S(lda, ZP_, 0x0052, 0xF656, 3)   // F654
+    S(sta, INY, 0x0030, 0xF658, 6)   // F656
+    S(iny, IMP, 0x0000, 0xF659, 2)   // F658
+    S(lda, ZP_, 0x0053, 0xF65B, 3)   // F659
+    S(sta, INY, 0x0030, 0xF65D, 6)   // F65B
+    S(iny, IMP, 0x0000, 0xF65E, 2)   // F65D
+    S(lda, ZP_, 0x0054, 0xF660, 3)   // F65E
+    S(sta, INY, 0x0030, 0xF662, 6)   // F660
+    S(iny, IMP, 0x0000, 0xF663, 2)   // F662
+    S(lda, ZP_, 0x0055, 0xF665, 3)   // F663
+    S(sta, INY, 0x0030, 0xF667, 6)   // F665
+    S(iny, IMP, 0x0000, 0xF668, 2)   // F667
+    S(sty, ZP_, 0x0036, 0xF66A, 3)   // F668
+    S(cpy, IMM, 0x00BB, 0xF66C, 2)   // F66A
+    S(bcc, REL, 0x00E1, 0xF66E, 2)   // F66C
+    c->executed += 16;
+    return cycles;
+}
+
+static inline uint32_t rom_F66E(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0045, 0xF670, 2)   // F66E
+    S(sta, ZP_, 0x002E, 0xF672, 3)   // F670
+    S(lda, ZP_, 0x0031, 0xF674, 3)   // F672
+    S(sta, ZP_, 0x002F, 0xF676, 3)   // F674
+    S(ldy, IMM, 0x00BA, 0xF678, 2)   // F676
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_F678(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x0030, 0xF67A, 5)   // F678
+    S(sta, INY, 0x002E, 0xF67C, 6)   // F67A
+    S(dey, IMP, 0x0000, 0xF67D, 2)   // F67C
+    S(bne, REL, 0x00F9, 0xF67F, 2)   // F67D
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_F67F(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x0030, 0xF681, 5)   // F67F
+    S(sta, INY, 0x002E, 0xF683, 6)   // F681
+    S(ldx, IMM, 0x00BB, 0xF685, 2)   // F683
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F685(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABX, 0x0100, 0xF688, 4)   // F685
+    S(sta, INY, 0x0030, 0xF68A, 6)   // F688
+    S(iny, IMP, 0x0000, 0xF68B, 2)   // F68A
+    S(inx, IMP, 0x0000, 0xF68C, 2)   // F68B
+    S(bne, REL, 0x00F7, 0xF68E, 2)   // F68C
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_F68E(cpu *c) {
+    uint32_t cycles = 0;
+    S(stx, ZP_, 0x0050, 0xF690, 3)   // F68E
+    S(rts, IMP, 0x0000, 0xF691, 6)   // F690
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F691(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0020, 0xF693, 2)   // F691
+    S(beq, REL, 0x0003, 0xF695, 2)   // F693
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F695(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xF6CA, 0xF698, 3)   // F695
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F698(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF5E9, 0xF69B, 6)   // F698
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F69B(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x003A, 0xF69D, 3)   // F69B
+    S(jsr, AB_, 0xF78F, 0xF6A0, 6)   // F69D
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F6A0(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF50A, 0xF6A3, 6)   // F6A0
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F6A3(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, IMM, 0x00BB, 0xF6A5, 2)   // F6A3
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F6A5(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ABY, 0x0100, 0xF6A8, 4)   // F6A5
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F6A8(cpu *c) {
+    uint32_t cycles = 0;
+    S(bvc, REL, 0x00FE, 0xF6AA, 2)   // F6A8
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F6AA(cpu *c) {
+    uint32_t cycles = 0;
+    S(clv, IMP, 0x0000, 0xF6AB, 2)   // F6AA
+    S(eor, AB_, 0x1C01, 0xF6AE, 4)   // F6AB
+    S(bne, REL, 0x0015, 0xF6B0, 2)   // F6AE
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F6B0(cpu *c) {
+    uint32_t cycles = 0;
+    S(iny, IMP, 0x0000, 0xF6B1, 2)   // F6B0
+    S(bne, REL, 0x00F2, 0xF6B3, 2)   // F6B1
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F6B3(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x0030, 0xF6B5, 5)   // F6B3
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F6B5(cpu *c) {
+    uint32_t cycles = 0;
+    S(bvc, REL, 0x00FE, 0xF6B7, 2)   // F6B5
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F6B7(cpu *c) {
+    uint32_t cycles = 0;
+    S(clv, IMP, 0x0000, 0xF6B8, 2)   // F6B7
+    S(eor, AB_, 0x1C01, 0xF6BB, 4)   // F6B8
+    S(bne, REL, 0x0008, 0xF6BD, 2)   // F6BB
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F6BD(cpu *c) {
+    uint32_t cycles = 0;
+    S(iny, IMP, 0x0000, 0xF6BE, 2)   // F6BD
+    S(cpy, IMM, 0x00FD, 0xF6C0, 2)   // F6BE
+    S(bne, REL, 0x00F1, 0xF6C2, 2)   // F6C0
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F6C2(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xF418, 0xF6C5, 3)   // F6C2
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F6C5(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0007, 0xF6C7, 2)   // F6C5
+    S(jmp, AB_, 0xF969, 0xF6CA, 3)   // F6C7
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F6CA(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF510, 0xF6CD, 6)   // F6CA
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F6CD(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xF418, 0xF6D0, 3)   // F6CD
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F6D0(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xF6D2, 2)   // F6D0
+    S(sta, ZP_, 0x0057, 0xF6D4, 3)   // F6D2
+    S(sta, ZP_, 0x005A, 0xF6D6, 3)   // F6D4
+    S(ldy, ZP_, 0x0034, 0xF6D8, 3)   // F6D6
+    S(lda, ZP_, 0x0052, 0xF6DA, 3)   // F6D8
+    S(and, IMM, 0x00F0, 0xF6DC, 2)   // F6DA
+    S(lsr, ACC, 0x0000, 0xF6DD, 2)   // F6DC
+    S(lsr, ACC, 0x0000, 0xF6DE, 2)   // F6DD
+    S(lsr, ACC, 0x0000, 0xF6DF, 2)   // F6DE
+    S(lsr, ACC, 0x0000, 0xF6E0, 2)   // F6DF
+    S(tax, IMP, 0x0000, 0xF6E1, 2)   // F6E0
+    S(lda, ABX, 0xF77F, 0xF6E4, 4)   // F6E1
+    S(asl, ACC, 0x0000, 0xF6E5, 2)   // F6E4
+    S(asl, ACC, 0x0000, 0xF6E6, 2)   // F6E5
+    S(asl, ACC, 0x0000, 0xF6E7, 2)   // F6E6
+    S(sta, ZP_, 0x0056, 0xF6E9, 3)   // F6E7
+    S(lda, ZP_, 0x0052, 0xF6EB, 3)   // F6E9
+    S(and, IMM, 0x000F, 0xF6ED, 2)   // F6EB
+    S(tax, IMP, 0x0000, 0xF6EE, 2)   // F6ED
+    S(lda, ABX, 0xF77F, 0xF6F1, 4)   // F6EE
+    S(ror, ACC, 0x0000, 0xF6F2, 2)   // F6F1
+    S(ror, ZP_, 0x0057, 0xF6F4, 5)   // F6F2
+    S(ror, ACC, 0x0000, 0xF6F5, 2)   // F6F4
+    S(ror, ZP_, 0x0057, 0xF6F7, 5)   // F6F5
+    S(and, IMM, 0x0007, 0xF6F9, 2)   // F6F7
+    S(ora, ZP_, 0x0056, 0xF6FB, 3)   // F6F9
+    S(sta, INY, 0x0030, 0xF6FD, 6)   // F6FB
+    S(iny, IMP, 0x0000, 0xF6FE, 2)   // F6FD
+    S(lda, ZP_, 0x0053, 0xF700, 3)   // F6FE
+    S(and, IMM, 0x00F0, 0xF702, 2)   // F700
+    S(lsr, ACC, 0x0000, 0xF703, 2)   // F702
+    S(lsr, ACC, 0x0000, 0xF704, 2)   // F703
+    S(lsr, ACC, 0x0000, 0xF705, 2)   // F704
+    S(lsr, ACC, 0x0000, 0xF706, 2)   // F705
+    S(tax, IMP, 0x0000, 0xF707, 2)   // F706
+    S(lda, ABX, 0xF77F, 0xF70A, 4)   // F707
+    S(asl, ACC, 0x0000, 0xF70B, 2)   // F70A
+    S(ora, ZP_, 0x0057, 0xF70D, 3)   // F70B
+    S(sta, ZP_, 0x0057, 0xF70F, 3)   // F70D
+    S(lda, ZP_, 0x0053, 0xF711, 3)   // F70F
+    S(and, IMM, 0x000F, 0xF713, 2)   // F711
+    S(tax, IMP, 0x0000, 0xF714, 2)   // F713
+    S(lda, ABX, 0xF77F, 0xF717, 4)   // F714
+    S(rol, ACC, 0x0000, 0xF718, 2)   // F717
+    S(rol, ACC, 0x0000, 0xF719, 2)   // F718
+    S(rol, ACC, 0x0000, 0xF71A, 2)   // F719
+    S(rol, ACC, 0x0000, 0xF71B, 2)   // F71A
+    S(sta, ZP_, 0x0058, 0xF71D, 3)   // F71B
+    S(rol, ACC, 0x0000, 0xF71E, 2)   // F71D
+    S(and, IMM, 0x0001, 0xF720, 2)   // F71E
+    S(ora, ZP_, 0x0057, 0xF722, 3)   // F720
+    S(sta, INY, 0x0030, 0xF724, 6)   // F722
+    S(iny, IMP, 0x0000, 0xF725, 2)   // F724
+    S(lda, ZP_, 0x0054, 0xF727, 3)   // F725
+    S(and, IMM, 0x00F0, 0xF729, 2)   // F727
+    S(lsr, ACC, 0x0000, 0xF72A, 2)   // F729
+    S(lsr, ACC, 0x0000, 0xF72B, 2)   // F72A
+    S(lsr, ACC, 0x0000, 0xF72C, 2)   // F72B
+    S(lsr, ACC, 0x0000, 0xF72D, 2)   // F72C
+    S(tax, IMP, 0x0000, 0xF72E, 2)   // F72D
+    S(lda, ABX, 0xF77F, 0xF731, 4)   // F72E
+    S(clc, IMP, 0x0000, 0xF732, 2)   // F731
+    S(ror, ACC, 0x0000, 0xF733, 2)   // F732
+    S(ora, ZP_, 0x0058, 0xF735, 3)   // F733
+    S(sta, INY, 0x0030, 0xF737, 6)   // F735
+    S(iny, IMP, 0x0000, 0xF738, 2)   // F737
+    S(ror, ACC, 0x0000, 0xF739, 2)   // F738
+    S(and, IMM, 0x0080, 0xF73B, 2)   // F739
+    S(sta, ZP_, 0x0059, 0xF73D, 3)   // F73B
+    S(lda, ZP_, 0x0054, 0xF73F, 3)   // F73D
+    S(and, IMM, 0x000F, 0xF741, 2)   // F73F
+    S(tax, IMP, 0x0000, 0xF742, 2)   // F741
+    S(lda, ABX, 0xF77F, 0xF745, 4)   // F742
+    S(asl, ACC, 0x0000, 0xF746, 2)   // F745
+    S(asl, ACC, 0x0000, 0xF747, 2)   // F746
+    S(and, IMM, 0x007C, 0xF749, 2)   // F747
+    S(ora, ZP_, 0x0059, 0xF74B, 3)   // F749
+    S(sta, ZP_, 0x0059, 0xF74D, 3)   // F74B
+    S(lda, ZP_, 0x0055, 0xF74F, 3)   // F74D
+    S(and, IMM, 0x00F0, 0xF751, 2)   // F74F
+    S(lsr, ACC, 0x0000, 0xF752, 2)   // F751
+    S(lsr, ACC, 0x0000, 0xF753, 2)   // F752
+    S(lsr, ACC, 0x0000, 0xF754, 2)   // F753
+    S(lsr, ACC, 0x0000, 0xF755, 2)   // F754
+    S(tax, IMP, 0x0000, 0xF756, 2)   // F755
+    S(lda, ABX, 0xF77F, 0xF759, 4)   // F756
+    S(ror, ACC, 0x0000, 0xF75A, 2)   // F759
+    S(ror, ZP_, 0x005A, 0xF75C, 5)   // F75A
+    S(ror, ACC, 0x0000, 0xF75D, 2)   // F75C
+    S(ror, ZP_, 0x005A, 0xF75F, 5)   // F75D
+    S(ror, ACC, 0x0000, 0xF760, 2)   // F75F
+    S(ror, ZP_, 0x005A, 0xF762, 5)   // F760
+    S(and, IMM, 0x0003, 0xF764, 2)   // F762
+    S(ora, ZP_, 0x0059, 0xF766, 3)   // F764
+    S(sta, INY, 0x0030, 0xF768, 6)   // F766
+    S(iny, IMP, 0x0000, 0xF769, 2)   // F768
+    S(bne, REL, 0x0004, 0xF76B, 2)   // F769
+    c->executed += 97;
+    return cycles;
+}
+
+static inline uint32_t rom_F76B(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x002F, 0xF76D, 3)   // F76B
+    S(sta, ZP_, 0x0031, 0xF76F, 3)   // F76D
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F76F(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0055, 0xF771, 3)   // F76F
+    S(and, IMM, 0x000F, 0xF773, 2)   // F771
+    S(tax, IMP, 0x0000, 0xF774, 2)   // F773
+    S(lda, ABX, 0xF77F, 0xF777, 4)   // F774
+    S(ora, ZP_, 0x005A, 0xF779, 3)   // F777
+    S(sta, INY, 0x0030, 0xF77B, 6)   // F779
+    S(iny, IMP, 0x0000, 0xF77C, 2)   // F77B
+    S(sty, ZP_, 0x0034, 0xF77E, 3)   // F77C
+    S(rts, IMP, 0x0000, 0xF77F, 6)   // F77E
+    c->executed += 9;
+    return cycles;
+}
+
+static inline uint32_t rom_F78F(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xF791, 2)   // F78F
+    S(sta, ZP_, 0x0030, 0xF793, 3)   // F791
+    S(sta, ZP_, 0x002E, 0xF795, 3)   // F793
+    S(sta, ZP_, 0x0036, 0xF797, 3)   // F795
+    S(lda, IMM, 0x00BB, 0xF799, 2)   // F797
+    S(sta, ZP_, 0x0034, 0xF79B, 3)   // F799
+    S(sta, ZP_, 0x0050, 0xF79D, 3)   // F79B
+    S(lda, ZP_, 0x0031, 0xF79F, 3)   // F79D
+    S(sta, ZP_, 0x002F, 0xF7A1, 3)   // F79F
+    S(lda, IMM, 0x0001, 0xF7A3, 2)   // F7A1
+    S(sta, ZP_, 0x0031, 0xF7A5, 3)   // F7A3
+    S(lda, ZP_, 0x0047, 0xF7A7, 3)   // F7A5
+    S(sta, ZP_, 0x0052, 0xF7A9, 3)   // F7A7
+    S(ldy, ZP_, 0x0036, 0xF7AB, 3)   // F7A9
+    S(lda, INY, 0x002E, 0xF7AD, 5)   // F7AB
+    S(sta, ZP_, 0x0053, 0xF7AF, 3)   // F7AD
+    S(iny, IMP, 0x0000, 0xF7B0, 2)   // F7AF
+    S(lda, INY, 0x002E, 0xF7B2, 5)   // F7B0
+    S(sta, ZP_, 0x0054, 0xF7B4, 3)   // F7B2
+    S(iny, IMP, 0x0000, 0xF7B5, 2)   // F7B4
+    S(lda, INY, 0x002E, 0xF7B7, 5)   // F7B5
+    S(sta, ZP_, 0x0055, 0xF7B9, 3)   // F7B7
+    S(iny, IMP, 0x0000, 0xF7BA, 2)   // F7B9
+    c->executed += 23;
+    return cycles;
+}
+
+static inline uint32_t rom_F7BA(cpu *c) {
+    uint32_t cycles = 0;
+    S(sty, ZP_, 0x0036, 0xF7BC, 3)   // F7BA
+    S(jsr, AB_, 0xF6D0, 0xF7BF, 6)   // F7BC
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F7BF(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, ZP_, 0x0036, 0xF7C1, 3)   // F7BF
+    S(lda, INY, 0x002E, 0xF7C3, 5)   // F7C1
+    S(sta, ZP_, 0x0052, 0xF7C5, 3)   // F7C3
+    S(iny, IMP, 0x0000, 0xF7C6, 2)   // F7C5
+    S(beq, REL, 0x0011, 0xF7C8, 2)   // F7C6
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_F7C8(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x002E, 0xF7CA, 5)   // F7C8
+    S(sta, ZP_, 0x0053, 0xF7CC, 3)   // F7CA
+    S(iny, IMP, 0x0000, 0xF7CD, 2)   // F7CC
+    S(lda, INY, 0x002E, 0xF7CF, 5)   // F7CD
+    S(sta, ZP_, 0x0054, 0xF7D1, 3)   // F7CF
+    S(iny, IMP, 0x0000, 0xF7D2, 2)   // F7D1
+    S(lda, INY, 0x002E, 0xF7D4, 5)   // F7D2
+    S(sta, ZP_, 0x0055, 0xF7D6, 3)   // F7D4
+    S(iny, IMP, 0x0000, 0xF7D7, 2)   // F7D6
+    S(bne, REL, 0x00E1, 0xF7D9, 2)   // F7D7
+    c->executed += 10;
+    return cycles;
+}
+
+static inline uint32_t rom_F7D9(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x003A, 0xF7DB, 3)   // F7D9
+    S(sta, ZP_, 0x0053, 0xF7DD, 3)   // F7DB
+    S(lda, IMM, 0x0000, 0xF7DF, 2)   // F7DD
+    S(sta, ZP_, 0x0054, 0xF7E1, 3)   // F7DF
+    S(sta, ZP_, 0x0055, 0xF7E3, 3)   // F7E1
+    S(jmp, AB_, 0xF6D0, 0xF7E6, 3)   // F7E3
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_F7E6(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, ZP_, 0x0034, 0xF7E8, 3)   // F7E6
+    S(lda, INY, 0x0030, 0xF7EA, 5)   // F7E8
+    S(and, IMM, 0x00F8, 0xF7EC, 2)   // F7EA
+    S(lsr, ACC, 0x0000, 0xF7ED, 2)   // F7EC
+    S(lsr, ACC, 0x0000, 0xF7EE, 2)   // F7ED
+    S(lsr, ACC, 0x0000, 0xF7EF, 2)   // F7EE
+    S(sta, ZP_, 0x0056, 0xF7F1, 3)   // F7EF
+    S(lda, INY, 0x0030, 0xF7F3, 5)   // F7F1
+    S(and, IMM, 0x0007, 0xF7F5, 2)   // F7F3
+    S(asl, ACC, 0x0000, 0xF7F6, 2)   // F7F5
+    S(asl, ACC, 0x0000, 0xF7F7, 2)   // F7F6
+    S(sta, ZP_, 0x0057, 0xF7F9, 3)   // F7F7
+    S(iny, IMP, 0x0000, 0xF7FA, 2)   // F7F9
+    S(bne, REL, 0x0006, 0xF7FC, 2)   // F7FA
+    c->executed += 14;
+    return cycles;
+}
+
+static inline uint32_t rom_F7FC(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x004E, 0xF7FE, 3)   // F7FC
+    S(sta, ZP_, 0x0031, 0xF800, 3)   // F7FE
+    S(ldy, ZP_, 0x004F, 0xF802, 3)   // F800
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F802(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x0030, 0xF804, 5)   // F802
+    S(and, IMM, 0x00C0, 0xF806, 2)   // F804
+    S(rol, ACC, 0x0000, 0xF807, 2)   // F806
+    S(rol, ACC, 0x0000, 0xF808, 2)   // F807
+    S(rol, ACC, 0x0000, 0xF809, 2)   // F808
+    S(ora, ZP_, 0x0057, 0xF80B, 3)   // F809
+    S(sta, ZP_, 0x0057, 0xF80D, 3)   // F80B
+    S(lda, INY, 0x0030, 0xF80F, 5)   // F80D
+    S(and, IMM, 0x003E, 0xF811, 2)   // F80F
+    S(lsr, ACC, 0x0000, 0xF812, 2)   // F811
+    S(sta, ZP_, 0x0058, 0xF814, 3)   // F812
+    S(lda, INY, 0x0030, 0xF816, 5)   // F814
+    S(and, IMM, 0x0001, 0xF818, 2)   // F816
+    S(asl, ACC, 0x0000, 0xF819, 2)   // F818
+    S(asl, ACC, 0x0000, 0xF81A, 2)   // F819
+    S(asl, ACC, 0x0000, 0xF81B, 2)   // F81A
+    S(asl, ACC, 0x0000, 0xF81C, 2)   // F81B
+    S(sta, ZP_, 0x0059, 0xF81E, 3)   // F81C
+    S(iny, IMP, 0x0000, 0xF81F, 2)   // F81E
+    S(lda, INY, 0x0030, 0xF821, 5)   // F81F
+    S(and, IMM, 0x00F0, 0xF823, 2)   // F821
+    S(lsr, ACC, 0x0000, 0xF824, 2)   // F823
+    S(lsr, ACC, 0x0000, 0xF825, 2)   // F824
+    S(lsr, ACC, 0x0000, 0xF826, 2)   // F825
+    S(lsr, ACC, 0x0000, 0xF827, 2)   // F826
+    S(ora, ZP_, 0x0059, 0xF829, 3)   // F827
+    S(sta, ZP_, 0x0059, 0xF82B, 3)   // F829
+    S(lda, INY, 0x0030, 0xF82D, 5)   // F82B
+    S(and, IMM, 0x000F, 0xF82F, 2)   // F82D
+    S(asl, ACC, 0x0000, 0xF830, 2)   // F82F
+    S(sta, ZP_, 0x005A, 0xF832, 3)   // F830
+    S(iny, IMP, 0x0000, 0xF833, 2)   // F832
+    S(lda, INY, 0x0030, 0xF835, 5)   // F833
+    S(and, IMM, 0x0080, 0xF837, 2)   // F835
+    S(clc, IMP, 0x0000, 0xF838, 2)   // F837
+    S(rol, ACC, 0x0000, 0xF839, 2)   // F838
+    S(rol, ACC, 0x0000, 0xF83A, 2)   // F839
+    S(and, IMM, 0x0001, 0xF83C, 2)   // F83A
+    S(ora, ZP_, 0x005A, 0xF83E, 3)   // F83C
+    S(sta, ZP_, 0x005A, 0xF840, 3)   // F83E
+    S(lda, INY, 0x0030, 0xF842, 5)   // F840
+    S(and, IMM, 0x007C, 0xF844, 2)   // F842
+    S(lsr, ACC, 0x0000, 0xF845, 2)   // F844
+    S(lsr, ACC, 0x0000, 0xF846, 2)   // F845
+    S(sta, ZP_, 0x005B, 0xF848, 3)   // F846
+    S(lda, INY, 0x0030, 0xF84A, 5)   // F848
+    S(and, IMM, 0x0003, 0xF84C, 2)   // F84A
+    S(asl, ACC, 0x0000, 0xF84D, 2)   // F84C
+    S(asl, ACC, 0x0000, 0xF84E, 2)   // F84D
+    S(asl, ACC, 0x0000, 0xF84F, 2)   // F84E
+    S(sta, ZP_, 0x005C, 0xF851, 3)   // F84F
+    S(iny, IMP, 0x0000, 0xF852, 2)   // F851
+    S(bne, REL, 0x0006, 0xF854, 2)   // F852
+    c->executed += 53;
+    return cycles;
+}
+
+static inline uint32_t rom_F854(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x004E, 0xF856, 3)   // F854
+    S(sta, ZP_, 0x0031, 0xF858, 3)   // F856
+    S(ldy, ZP_, 0x004F, 0xF85A, 3)   // F858
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F85A(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, INY, 0x0030, 0xF85C, 5)   // F85A
+    S(and, IMM, 0x00E0, 0xF85E, 2)   // F85C
+    S(rol, ACC, 0x0000, 0xF85F, 2)   // F85E
+    S(rol, ACC, 0x0000, 0xF860, 2)   // F85F
+    S(rol, ACC, 0x0000, 0xF861, 2)   // F860
+    S(rol, ACC, 0x0000, 0xF862, 2)   // F861
+    S(ora, ZP_, 0x005C, 0xF864, 3)   // F862
+    S(sta, ZP_, 0x005C, 0xF866, 3)   // F864
+    S(lda, INY, 0x0030, 0xF868, 5)   // F866
+    S(and, IMM, 0x001F, 0xF86A, 2)   // F868
+    S(sta, ZP_, 0x005D, 0xF86C, 3)   // F86A
+    S(iny, IMP, 0x0000, 0xF86D, 2)   // F86C
+    S(sty, ZP_, 0x0034, 0xF86F, 3)   // F86D
+    S(ldx, ZP_, 0x0056, 0xF871, 3)   // F86F
+    S(lda, ABX, 0xF8A0, 0xF874, 4)   // F871
+    S(ldx, ZP_, 0x0057, 0xF876, 3)   // F874
+    S(ora, ABX, 0xF8C0, 0xF879, 4)   // F876
+    S(sta, ZP_, 0x0052, 0xF87B, 3)   // F879
+    S(ldx, ZP_, 0x0058, 0xF87D, 3)   // F87B
+    S(lda, ABX, 0xF8A0, 0xF880, 4)   // F87D
+    S(ldx, ZP_, 0x0059, 0xF882, 3)   // F880
+    S(ora, ABX, 0xF8C0, 0xF885, 4)   // F882
+    S(sta, ZP_, 0x0053, 0xF887, 3)   // F885
+    S(ldx, ZP_, 0x005A, 0xF889, 3)   // F887
+    S(lda, ABX, 0xF8A0, 0xF88C, 4)   // F889
+    S(ldx, ZP_, 0x005B, 0xF88E, 3)   // F88C
+    S(ora, ABX, 0xF8C0, 0xF891, 4)   // F88E
+    S(sta, ZP_, 0x0054, 0xF893, 3)   // F891
+    S(ldx, ZP_, 0x005C, 0xF895, 3)   // F893
+    S(lda, ABX, 0xF8A0, 0xF898, 4)   // F895
+    S(ldx, ZP_, 0x005D, 0xF89A, 3)   // F898
+    S(ora, ABX, 0xF8C0, 0xF89D, 4)   // F89A
+    S(sta, ZP_, 0x0055, 0xF89F, 3)   // F89D
+    S(rts, IMP, 0x0000, 0xF8A0, 6)   // F89F
+    c->executed += 34;
+    return cycles;
+}
+
+static inline uint32_t rom_F8E0(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xF8E2, 2)   // F8E0
+    S(sta, ZP_, 0x0034, 0xF8E4, 3)   // F8E2
+    S(sta, ZP_, 0x002E, 0xF8E6, 3)   // F8E4
+    S(sta, ZP_, 0x0036, 0xF8E8, 3)   // F8E6
+    S(lda, IMM, 0x0001, 0xF8EA, 2)   // F8E8
+    S(sta, ZP_, 0x004E, 0xF8EC, 3)   // F8EA
+    S(lda, IMM, 0x00BA, 0xF8EE, 2)   // F8EC
+    S(sta, ZP_, 0x004F, 0xF8F0, 3)   // F8EE
+    S(lda, ZP_, 0x0031, 0xF8F2, 3)   // F8F0
+    S(sta, ZP_, 0x002F, 0xF8F4, 3)   // F8F2
+    S(jsr, AB_, 0xF7E6, 0xF8F7, 6)   // F8F4
+    c->executed += 11;
+    return cycles;
+}
+
+static inline uint32_t rom_F8F7(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0052, 0xF8F9, 3)   // F8F7
+    S(sta, ZP_, 0x0038, 0xF8FB, 3)   // F8F9
+    S(ldy, ZP_, 0x0036, 0xF8FD, 3)   // F8FB
+    S(lda, ZP_, 0x0053, 0xF8FF, 3)   // F8FD
+    S(sta, INY, 0x002E, 0xF901, 6)   // F8FF
+    S(iny, IMP, 0x0000, 0xF902, 2)   // F901
+    S(lda, ZP_, 0x0054, 0xF904, 3)   // F902
+    S(sta, INY, 0x002E, 0xF906, 6)   // F904
+    S(iny, IMP, 0x0000, 0xF907, 2)   // F906
+    S(lda, ZP_, 0x0055, 0xF909, 3)   // F907
+    S(sta, INY, 0x002E, 0xF90B, 6)   // F909
+    S(iny, IMP, 0x0000, 0xF90C, 2)   // F90B
+    c->executed += 12;
+    return cycles;
+}
+
+static inline uint32_t rom_F90C(cpu *c) {
+    uint32_t cycles = 0;
+    S(sty, ZP_, 0x0036, 0xF90E, 3)   // F90C
+    S(jsr, AB_, 0xF7E6, 0xF911, 6)   // F90E
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F911(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, ZP_, 0x0036, 0xF913, 3)   // F911
+    S(lda, ZP_, 0x0052, 0xF915, 3)   // F913
+    S(sta, INY, 0x002E, 0xF917, 6)   // F915
+    S(iny, IMP, 0x0000, 0xF918, 2)   // F917
+    S(beq, REL, 0x0011, 0xF91A, 2)   // F918
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_F91A(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0053, 0xF91C, 3)   // F91A
+    S(sta, INY, 0x002E, 0xF91E, 6)   // F91C
+    S(iny, IMP, 0x0000, 0xF91F, 2)   // F91E
+    S(lda, ZP_, 0x0054, 0xF921, 3)   // F91F
+    S(sta, INY, 0x002E, 0xF923, 6)   // F921
+    S(iny, IMP, 0x0000, 0xF924, 2)   // F923
+    S(lda, ZP_, 0x0055, 0xF926, 3)   // F924
+    S(sta, INY, 0x002E, 0xF928, 6)   // F926
+    S(iny, IMP, 0x0000, 0xF929, 2)   // F928
+    S(bne, REL, 0x00E1, 0xF92B, 2)   // F929
+    c->executed += 10;
+    return cycles;
+}
+
+static inline uint32_t rom_F92B(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0053, 0xF92D, 3)   // F92B
+    S(sta, ZP_, 0x003A, 0xF92F, 3)   // F92D
+    S(lda, ZP_, 0x002F, 0xF931, 3)   // F92F
+    S(sta, ZP_, 0x0031, 0xF933, 3)   // F931
+    S(rts, IMP, 0x0000, 0xF934, 6)   // F933
+    c->executed += 5;
+    return cycles;
+}
+
+static inline uint32_t rom_F934(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0031, 0xF936, 3)   // F934
+    S(sta, ZP_, 0x002F, 0xF938, 3)   // F936
+    S(lda, IMM, 0x0000, 0xF93A, 2)   // F938
+    S(sta, ZP_, 0x0031, 0xF93C, 3)   // F93A
+    S(lda, IMM, 0x0024, 0xF93E, 2)   // F93C
+    S(sta, ZP_, 0x0034, 0xF940, 3)   // F93E
+    S(lda, ZP_, 0x0039, 0xF942, 3)   // F940
+    S(sta, ZP_, 0x0052, 0xF944, 3)   // F942
+    S(lda, ZP_, 0x001A, 0xF946, 3)   // F944
+    S(sta, ZP_, 0x0053, 0xF948, 3)   // F946
+    S(lda, ZP_, 0x0019, 0xF94A, 3)   // F948
+    S(sta, ZP_, 0x0054, 0xF94C, 3)   // F94A
+    S(lda, ZP_, 0x0018, 0xF94E, 3)   // F94C
+    S(sta, ZP_, 0x0055, 0xF950, 3)   // F94E
+    S(jsr, AB_, 0xF6D0, 0xF953, 6)   // F950
+    c->executed += 15;
+    return cycles;
+}
+
+static inline uint32_t rom_F953(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0017, 0xF955, 3)   // F953
+    S(sta, ZP_, 0x0052, 0xF957, 3)   // F955
+    S(lda, ZP_, 0x0016, 0xF959, 3)   // F957
+    S(sta, ZP_, 0x0053, 0xF95B, 3)   // F959
+    S(lda, IMM, 0x0000, 0xF95D, 2)   // F95B
+    S(sta, ZP_, 0x0054, 0xF95F, 3)   // F95D
+    S(sta, ZP_, 0x0055, 0xF961, 3)   // F95F
+    S(jsr, AB_, 0xF6D0, 0xF964, 6)   // F961
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_F964(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x002F, 0xF966, 3)   // F964
+    S(sta, ZP_, 0x0031, 0xF968, 3)   // F966
+    S(rts, IMP, 0x0000, 0xF969, 6)   // F968
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F969(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldy, ZP_, 0x003F, 0xF96B, 3)   // F969
+    S(sta, ABY, 0x0000, 0xF96E, 5)   // F96B
+    S(lda, ZP_, 0x0050, 0xF970, 3)   // F96E
+    S(beq, REL, 0x0003, 0xF972, 2)   // F970
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_F972(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF5F2, 0xF975, 6)   // F972
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F975(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF98F, 0xF978, 6)   // F975
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F978(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x0049, 0xF97A, 3)   // F978
+    S(txs, IMP, 0x0000, 0xF97B, 2)   // F97A
+    S(jmp, AB_, 0xF2BE, 0xF97E, 3)   // F97B
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F97E(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x00A0, 0xF980, 2)   // F97E
+    S(sta, ZP_, 0x0020, 0xF982, 3)   // F980
+    S(lda, AB_, 0x1C00, 0xF985, 4)   // F982
+    S(ora, IMM, 0x0004, 0xF987, 2)   // F985
+    S(sta, AB_, 0x1C00, 0xF98A, 4)   // F987
+    S(lda, IMM, 0x003C, 0xF98C, 2)   // F98A
+    S(sta, ZP_, 0x0048, 0xF98E, 3)   // F98C
+    S(rts, IMP, 0x0000, 0xF98F, 6)   // F98E
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_F98F(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x003E, 0xF991, 3)   // F98F
+    S(lda, ZP_, 0x0020, 0xF993, 3)   // F991
+    S(ora, IMM, 0x0010, 0xF995, 2)   // F993
+    S(sta, ZP_, 0x0020, 0xF997, 3)   // F995
+    S(lda, IMM, 0x00FF, 0xF999, 2)   // F997
+    S(sta, ZP_, 0x0048, 0xF99B, 3)   // F999
+    S(rts, IMP, 0x0000, 0xF99C, 6)   // F99B
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_F99C(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x1C07, 0xF99F, 4)   // F99C
+    S(sta, AB_, 0x1C05, 0xF9A2, 4)   // F99F
+    S(lda, AB_, 0x1C00, 0xF9A5, 4)   // F9A2
+    S(and, IMM, 0x0010, 0xF9A7, 2)   // F9A5
+    S(cmp, ZP_, 0x001E, 0xF9A9, 3)   // F9A7
+    S(sta, ZP_, 0x001E, 0xF9AB, 3)   // F9A9
+    S(beq, REL, 0x0004, 0xF9AD, 2)   // F9AB
+    c->executed += 7;
+    return cycles;
+}
+
+static inline uint32_t rom_F9AD(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0001, 0xF9AF, 2)   // F9AD
+    S(sta, ZP_, 0x001C, 0xF9B1, 3)   // F9AF
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F9B1(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x02FE, 0xF9B4, 4)   // F9B1
+    S(beq, REL, 0x0015, 0xF9B6, 2)   // F9B4
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F9B6(cpu *c) {
+    uint32_t cycles = 0;
+    S(cmp, IMM, 0x0002, 0xF9B8, 2)   // F9B6
+    S(bne, REL, 0x0007, 0xF9BA, 2)   // F9B8
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F9BA(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, IMM, 0x0000, 0xF9BC, 2)   // F9BA
+    S(sta, AB_, 0x02FE, 0xF9BF, 4)   // F9BC
+    S(beq, REL, 0x000A, 0xF9C1, 2)   // F9BF
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F9C1(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x004A, 0xF9C3, 3)   // F9C1
+    S(lda, IMM, 0x0002, 0xF9C5, 2)   // F9C3
+    S(sta, AB_, 0x02FE, 0xF9C8, 4)   // F9C5
+    S(jmp, AB_, 0xFA2E, 0xF9CB, 3)   // F9C8
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_F9CB(cpu *c) {
+    uint32_t cycles = 0;
+    S(ldx, ZP_, 0x003E, 0xF9CD, 3)   // F9CB
+    S(bmi, REL, 0x0007, 0xF9CF, 2)   // F9CD
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F9CF(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x0020, 0xF9D1, 3)   // F9CF
+    S(tay, IMP, 0x0000, 0xF9D2, 2)   // F9D1
+    S(cmp, IMM, 0x0020, 0xF9D4, 2)   // F9D2
+    S(bne, REL, 0x0003, 0xF9D6, 2)   // F9D4
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_F9D6(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xFABE, 0xF9D9, 3)   // F9D6
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_F9D9(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, ZP_, 0x0048, 0xF9DB, 5)   // F9D9
+    S(bne, REL, 0x001D, 0xF9DD, 2)   // F9DB
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F9DD(cpu *c) {
+    uint32_t cycles = 0;
+    S(tya, IMP, 0x0000, 0xF9DE, 2)   // F9DD
+    S(bpl, REL, 0x0004, 0xF9E0, 2)   // F9DE
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F9E0(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x007F, 0xF9E2, 2)   // F9E0
+    S(sta, ZP_, 0x0020, 0xF9E4, 3)   // F9E2
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F9E4(cpu *c) {
+    uint32_t cycles = 0;
+    S(and, IMM, 0x0010, 0xF9E6, 2)   // F9E4
+    S(beq, REL, 0x0012, 0xF9E8, 2)   // F9E6
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_F9E8(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x1C00, 0xF9EB, 4)   // F9E8
+    S(and, IMM, 0x00FB, 0xF9ED, 2)   // F9EB
+    S(sta, AB_, 0x1C00, 0xF9F0, 4)   // F9ED
+    S(lda, IMM, 0x00FF, 0xF9F2, 2)   // F9F0
+    S(sta, ZP_, 0x003E, 0xF9F4, 3)   // F9F2
+    S(lda, IMM, 0x0000, 0xF9F6, 2)   // F9F4
+    S(sta, ZP_, 0x0020, 0xF9F8, 3)   // F9F6
+    S(beq, REL, 0x00DC, 0xF9FA, 2)   // F9F8
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_F9FA(cpu *c) {
+    uint32_t cycles = 0;
+    S(tya, IMP, 0x0000, 0xF9FB, 2)   // F9FA
+    S(and, IMM, 0x0040, 0xF9FD, 2)   // F9FB
+    S(bne, REL, 0x0003, 0xF9FF, 2)   // F9FD
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_F9FF(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xFABE, 0xFA02, 3)   // F9FF
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_FA02(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, IN_, 0x0062, 0xFA05, 5)   // FA02
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_FA2E(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, ZP_, 0x004A, 0xFA30, 3)   // FA2E
+    S(bpl, REL, 0x0031, 0xFA32, 2)   // FA30
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_FA32(cpu *c) {
+    uint32_t cycles = 0;
+    S(inc, ZP_, 0x004A, 0xFA34, 5)   // FA32
+    S(ldx, AB_, 0x1C00, 0xFA37, 4)   // FA34
+    S(dex, IMP, 0x0000, 0xFA38, 2)   // FA37
+    S(jmp, AB_, 0xFA69, 0xFA3B, 3)   // FA38
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_FA63(cpu *c) {
+    uint32_t cycles = 0;
+    S(dec, ZP_, 0x004A, 0xFA65, 5)   // FA63
+    S(ldx, AB_, 0x1C00, 0xFA68, 4)   // FA65
+    S(inx, IMP, 0x0000, 0xFA69, 2)   // FA68
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_FA69(cpu *c) {
+    uint32_t cycles = 0;
+    S(txa, IMP, 0x0000, 0xFA6A, 2)   // FA69
+    S(and, IMM, 0x0003, 0xFA6C, 2)   // FA6A
+    S(sta, ZP_, 0x004B, 0xFA6E, 3)   // FA6C
+    S(lda, AB_, 0x1C00, 0xFA71, 4)   // FA6E
+    S(and, IMM, 0x00FC, 0xFA73, 2)   // FA71
+    S(ora, ZP_, 0x004B, 0xFA75, 3)   // FA73
+    S(sta, AB_, 0x1C00, 0xFA78, 4)   // FA75
+    S(jmp, AB_, 0xFABE, 0xFA7B, 3)   // FA78
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_FABE(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x1C0C, 0xFAC1, 4)   // FABE
+    S(and, IMM, 0x00FD, 0xFAC3, 2)   // FAC1
+    S(sta, AB_, 0x1C0C, 0xFAC6, 4)   // FAC3
+    S(rts, IMP, 0x0000, 0xFAC7, 6)   // FAC6
+    c->executed += 4;
+    return cycles;
+}
+
+static inline uint32_t rom_FE67(cpu *c) {
+    uint32_t cycles = 0;
+    S(pha, IMP, 0x0000, 0xFE68, 3)   // FE67
+    S(txa, IMP, 0x0000, 0xFE69, 2)   // FE68
+    S(pha, IMP, 0x0000, 0xFE6A, 3)   // FE69
+    S(tya, IMP, 0x0000, 0xFE6B, 2)   // FE6A
+    S(pha, IMP, 0x0000, 0xFE6C, 3)   // FE6B
+    S(lda, AB_, 0x180D, 0xFE6F, 4)   // FE6C
+    S(and, IMM, 0x0002, 0xFE71, 2)   // FE6F
+    S(beq, REL, 0x0003, 0xFE73, 2)   // FE71
+    c->executed += 8;
+    return cycles;
+}
+
+static inline uint32_t rom_FE73(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE853, 0xFE76, 6)   // FE73
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_FE76(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x1C0D, 0xFE79, 4)   // FE76
+    S(asl, ACC, 0x0000, 0xFE7A, 2)   // FE79
+    S(bpl, REL, 0x0003, 0xFE7C, 2)   // FE7A
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_FE7C(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xF2B0, 0xFE7F, 6)   // FE7C
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_FE7F(cpu *c) {
+    uint32_t cycles = 0;
+    S(pla, IMP, 0x0000, 0xFE80, 4)   // FE7F
+    S(tay, IMP, 0x0000, 0xFE81, 2)   // FE80
+    S(pla, IMP, 0x0000, 0xFE82, 4)   // FE81
+    S(tax, IMP, 0x0000, 0xFE83, 2)   // FE82
+    S(pla, IMP, 0x0000, 0xFE84, 4)   // FE83
+    S(rti, IMP, 0x0000, 0xFE85, 6)   // FE84
+    c->executed += 6;
+    return cycles;
+}
+
+static inline uint32_t rom_FEE7(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, IN_, 0x0065, 0xFEEA, 5)   // FEE7
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_FEEA(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, AB_, 0x1C00, 0xFEED, 4)   // FEEA
+    S(sta, AB_, 0x1C02, 0xFEF0, 4)   // FEED
+    S(jmp, AB_, 0xEA7D, 0xFEF3, 3)   // FEF0
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_FEF3(cpu *c) {
+    uint32_t cycles = 0;
+    S(txa, IMP, 0x0000, 0xFEF4, 2)   // FEF3
+    S(ldx, IMM, 0x0005, 0xFEF6, 2)   // FEF4
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_FEF6(cpu *c) {
+    uint32_t cycles = 0;
+    S(dex, IMP, 0x0000, 0xFEF7, 2)   // FEF6
+    S(bne, REL, 0x00FD, 0xFEF9, 2)   // FEF7
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_FEF9(cpu *c) {
+    uint32_t cycles = 0;
+    S(tax, IMP, 0x0000, 0xFEFA, 2)   // FEF9
+    S(rts, IMP, 0x0000, 0xFEFB, 6)   // FEFA
+    c->executed += 2;
+    return cycles;
+}
+
+static inline uint32_t rom_FEFB(cpu *c) {
+    uint32_t cycles = 0;
+    S(jsr, AB_, 0xE9AE, 0xFEFE, 6)   // FEFB
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_FEFE(cpu *c) {
+    uint32_t cycles = 0;
+    S(jmp, AB_, 0xE99C, 0xFF01, 3)   // FEFE
+    c->executed += 1;
+    return cycles;
+}
+
+static inline uint32_t rom_FF01(cpu *c) {
+    uint32_t cycles = 0;
+    S(lda, AB_, 0x0202, 0xFF04, 4)   // FF01
+    S(cmp, IMM, 0x002D, 0xFF06, 2)   // FF04
+    S(beq, REL, 0x0005, 0xFF08, 2)   // FF06
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_FF08(cpu *c) {
+    uint32_t cycles = 0;
+    S(sec, IMP, 0x0000, 0xFF09, 2)   // FF08
+    S(sbc, IMM, 0x002B, 0xFF0B, 2)   // FF09
+    S(bne, REL, 0x00DA, 0xFF0D, 2)   // FF0B
+    c->executed += 3;
+    return cycles;
+}
+
+static inline uint32_t rom_FF0D(cpu *c) {
+    uint32_t cycles = 0;
+    S(sta, ZP_, 0x0023, 0xFF0F, 3)   // FF0D
+    S(rts, IMP, 0x0000, 0xFF10, 6)   // FF0F
+    c->executed += 2;
+    return cycles;
+}
+
+static rom_block const rom_code[ROM_SIZE] = {
+    [0xC100 - ROM_START] = rom_C100,
+    [0xC10B - ROM_START] = rom_C10B,
+    [0xC110 - ROM_START] = rom_C110,
+    [0xC113 - ROM_START] = rom_C113,
+    [0xC123 - ROM_START] = rom_C123,
+    [0xC12C - ROM_START] = rom_C12C,
+    [0xC146 - ROM_START] = rom_C146,
+    [0xC153 - ROM_START] = rom_C153,
+    [0xC157 - ROM_START] = rom_C157,
+    [0xC15D - ROM_START] = rom_C15D,
+    [0xC160 - ROM_START] = rom_C160,
+    [0xC163 - ROM_START] = rom_C163,
+    [0xC16A - ROM_START] = rom_C16A,
+    [0xC172 - ROM_START] = rom_C172,
+    [0xC175 - ROM_START] = rom_C175,
+    [0xC17A - ROM_START] = rom_C17A,
+    [0xC181 - ROM_START] = rom_C181,
+    [0xC184 - ROM_START] = rom_C184,
+    [0xC194 - ROM_START] = rom_C194,
+    [0xC199 - ROM_START] = rom_C199,
+    [0xC19E - ROM_START] = rom_C19E,
+    [0xC1AA - ROM_START] = rom_C1AA,
+    [0xC1AD - ROM_START] = rom_C1AD,
+    [0xC1BA - ROM_START] = rom_C1BA,
+    [0xC1BD - ROM_START] = rom_C1BD,
+    [0xC1C1 - ROM_START] = rom_C1C1,
+    [0xC1C7 - ROM_START] = rom_C1C7,
+    [0xC1C8 - ROM_START] = rom_C1C8,
+    [0xC1D1 - ROM_START] = rom_C1D1,
+    [0xC1DB - ROM_START] = rom_C1DB,
+    [0xC1DD - ROM_START] = rom_C1DD,
+    [0xC1E2 - ROM_START] = rom_C1E2,
+    [0xC1E5 - ROM_START] = rom_C1E5,
+    [0xC1EE - ROM_START] = rom_C1EE,
+    [0xC1F1 - ROM_START] = rom_C1F1,
+    [0xC1F3 - ROM_START] = rom_C1F3,
+    [0xC1F8 - ROM_START] = rom_C1F8,
+    [0xC200 - ROM_START] = rom_C200,
+    [0xC205 - ROM_START] = rom_C205,
+    [0xC208 - ROM_START] = rom_C208,
+    [0xC20A - ROM_START] = rom_C20A,
+    [0xC21B - ROM_START] = rom_C21B,
+    [0xC228 - ROM_START] = rom_C228,
+    [0xC22B - ROM_START] = rom_C22B,
+    [0xC239 - ROM_START] = rom_C239,
+    [0xC243 - ROM_START] = rom_C243,
+    [0xC245 - ROM_START] = rom_C245,
+    [0xC24A - ROM_START] = rom_C24A,
+    [0xC24C - ROM_START] = rom_C24C,
+    [0xC254 - ROM_START] = rom_C254,
+    [0xC25F - ROM_START] = rom_C25F,
+    [0xC260 - ROM_START] = rom_C260,
+    [0xC268 - ROM_START] = rom_C268,
+    [0xC26B - ROM_START] = rom_C26B,
+    [0xC270 - ROM_START] = rom_C270,
+    [0xC278 - ROM_START] = rom_C278,
+    [0xC27C - ROM_START] = rom_C27C,
+    [0xC280 - ROM_START] = rom_C280,
+    [0xC283 - ROM_START] = rom_C283,
+    [0xC287 - ROM_START] = rom_C287,
+    [0xC292 - ROM_START] = rom_C292,
+    [0xC299 - ROM_START] = rom_C299,
+    [0xC29E - ROM_START] = rom_C29E,
+    [0xC2A0 - ROM_START] = rom_C2A0,
+    [0xC2AD - ROM_START] = rom_C2AD,
+    [0xC2B1 - ROM_START] = rom_C2B1,
+    [0xC2B3 - ROM_START] = rom_C2B3,
+    [0xC2B7 - ROM_START] = rom_C2B7,
+    [0xC2BA - ROM_START] = rom_C2BA,
+    [0xC2C1 - ROM_START] = rom_C2C1,
+    [0xC2C9 - ROM_START] = rom_C2C9,
+    [0xC2CA - ROM_START] = rom_C2CA,
+    [0xC2CB - ROM_START] = rom_C2CB,
+    [0xC2D4 - ROM_START] = rom_C2D4,
+    [0xC2DC - ROM_START] = rom_C2DC,
+    [0xC2FD - ROM_START] = rom_C2FD,
+    [0xC311 - ROM_START] = rom_C311,
+    [0xC312 - ROM_START] = rom_C312,
+    [0xC320 - ROM_START] = rom_C320,
+    [0xC325 - ROM_START] = rom_C325,
+    [0xC32D - ROM_START] = rom_C32D,
+    [0xC33B - ROM_START] = rom_C33B,
+    [0xC33C - ROM_START] = rom_C33C,
+    [0xC346 - ROM_START] = rom_C346,
+    [0xC34B - ROM_START] = rom_C34B,
+    [0xC34C - ROM_START] = rom_C34C,
+    [0xC34D - ROM_START] = rom_C34D,
+    [0xC34F - ROM_START] = rom_C34F,
+    [0xC352 - ROM_START] = rom_C352,
+    [0xC35B - ROM_START] = rom_C35B,
+    [0xC35F - ROM_START] = rom_C35F,
+    [0xC361 - ROM_START] = rom_C361,
+    [0xC368 - ROM_START] = rom_C368,
+    [0xC370 - ROM_START] = rom_C370,
+    [0xC375 - ROM_START] = rom_C375,
+    [0xC377 - ROM_START] = rom_C377,
+    [0xC37D - ROM_START] = rom_C37D,
+    [0xC383 - ROM_START] = rom_C383,
+    [0xC388 - ROM_START] = rom_C388,
+    [0xC38F - ROM_START] = rom_C38F,
+    [0xC398 - ROM_START] = rom_C398,
+    [0xC3A2 - ROM_START] = rom_C3A2,
+    [0xC3B0 - ROM_START] = rom_C3B0,
+    [0xC3B5 - ROM_START] = rom_C3B5,
+    [0xC3B8 - ROM_START] = rom_C3B8,
+    [0xC3BD - ROM_START] = rom_C3BD,
+    [0xC3C1 - ROM_START] = rom_C3C1,
+    [0xC3C5 - ROM_START] = rom_C3C5,
+    [0xC3C7 - ROM_START] = rom_C3C7,
+    [0xC3CA - ROM_START] = rom_C3CA,
+    [0xC3D5 - ROM_START] = rom_C3D5,
+    [0xC3E0 - ROM_START] = rom_C3E0,
+    [0xC3E4 - ROM_START] = rom_C3E4,
+    [0xC3E8 - ROM_START] = rom_C3E8,
+    [0xC3EB - ROM_START] = rom_C3EB,
+    [0xC3EF - ROM_START] = rom_C3EF,
+    [0xC3FE - ROM_START] = rom_C3FE,
+    [0xC400 - ROM_START] = rom_C400,
+    [0xC409 - ROM_START] = rom_C409,
+    [0xC40C - ROM_START] = rom_C40C,
+    [0xC40E - ROM_START] = rom_C40E,
+    [0xC411 - ROM_START] = rom_C411,
+    [0xC419 - ROM_START] = rom_C419,
+    [0xC41B - ROM_START] = rom_C41B,
+    [0xC420 - ROM_START] = rom_C420,
+    [0xC423 - ROM_START] = rom_C423,
+    [0xC426 - ROM_START] = rom_C426,
+    [0xC42A - ROM_START] = rom_C42A,
+    [0xC42D - ROM_START] = rom_C42D,
+    [0xC434 - ROM_START] = rom_C434,
+    [0xC437 - ROM_START] = rom_C437,
+    [0xC439 - ROM_START] = rom_C439,
+    [0xC43C - ROM_START] = rom_C43C,
+    [0xC44F - ROM_START] = rom_C44F,
+    [0xC452 - ROM_START] = rom_C452,
+    [0xC45A - ROM_START] = rom_C45A,
+    [0xC45C - ROM_START] = rom_C45C,
+    [0xC461 - ROM_START] = rom_C461,
+    [0xC462 - ROM_START] = rom_C462,
+    [0xC46A - ROM_START] = rom_C46A,
+    [0xC46D - ROM_START] = rom_C46D,
+    [0xC470 - ROM_START] = rom_C470,
+    [0xC473 - ROM_START] = rom_C473,
+    [0xC475 - ROM_START] = rom_C475,
+    [0xC478 - ROM_START] = rom_C478,
+    [0xC47D - ROM_START] = rom_C47D,
+    [0xC47E - ROM_START] = rom_C47E,
+    [0xC483 - ROM_START] = rom_C483,
+    [0xC485 - ROM_START] = rom_C485,
+    [0xC48A - ROM_START] = rom_C48A,
+    [0xC492 - ROM_START] = rom_C492,
+    [0xC49A - ROM_START] = rom_C49A,
+    [0xC49D - ROM_START] = rom_C49D,
+    [0xC4A5 - ROM_START] = rom_C4A5,
+    [0xC4A7 - ROM_START] = rom_C4A7,
+    [0xC4AA - ROM_START] = rom_C4AA,
+    [0xC4AF - ROM_START] = rom_C4AF,
+    [0xC4B4 - ROM_START] = rom_C4B4,
+    [0xC4B5 - ROM_START] = rom_C4B5,
+    [0xC4B8 - ROM_START] = rom_C4B8,
+    [0xC4BA - ROM_START] = rom_C4BA,
+    [0xC4BD - ROM_START] = rom_C4BD,
+    [0xC4C2 - ROM_START] = rom_C4C2,
+    [0xC4C7 - ROM_START] = rom_C4C7,
+    [0xC4C9 - ROM_START] = rom_C4C9,
+    [0xC4CE - ROM_START] = rom_C4CE,
+    [0xC4D7 - ROM_START] = rom_C4D7,
+    [0xC4D8 - ROM_START] = rom_C4D8,
+    [0xC4E4 - ROM_START] = rom_C4E4,
+    [0xC4E6 - ROM_START] = rom_C4E6,
+    [0xC4E7 - ROM_START] = rom_C4E7,
+    [0xC4EA - ROM_START] = rom_C4EA,
+    [0xC4EC - ROM_START] = rom_C4EC,
+    [0xC4F3 - ROM_START] = rom_C4F3,
+    [0xC4F7 - ROM_START] = rom_C4F7,
+    [0xC4FE - ROM_START] = rom_C4FE,
+    [0xC505 - ROM_START] = rom_C505,
+    [0xC50A - ROM_START] = rom_C50A,
+    [0xC511 - ROM_START] = rom_C511,
+    [0xC515 - ROM_START] = rom_C515,
+    [0xC51B - ROM_START] = rom_C51B,
+    [0xC51D - ROM_START] = rom_C51D,
+    [0xC522 - ROM_START] = rom_C522,
+    [0xC529 - ROM_START] = rom_C529,
+    [0xC52B - ROM_START] = rom_C52B,
+    [0xC52F - ROM_START] = rom_C52F,
+    [0xC535 - ROM_START] = rom_C535,
+    [0xC55A - ROM_START] = rom_C55A,
+    [0xC55C - ROM_START] = rom_C55C,
+    [0xC582 - ROM_START] = rom_C582,
+    [0xC589 - ROM_START] = rom_C589,
+    [0xC594 - ROM_START] = rom_C594,
+    [0xC599 - ROM_START] = rom_C599,
+    [0xC59A - ROM_START] = rom_C59A,
+    [0xC5A1 - ROM_START] = rom_C5A1,
+    [0xC5A6 - ROM_START] = rom_C5A6,
+    [0xC5AC - ROM_START] = rom_C5AC,
+    [0xC5C4 - ROM_START] = rom_C5C4,
+    [0xC5C9 - ROM_START] = rom_C5C9,
+    [0xC5CA - ROM_START] = rom_C5CA,
+    [0xC5D4 - ROM_START] = rom_C5D4,
+    [0xC5D7 - ROM_START] = rom_C5D7,
+    [0xC5DA - ROM_START] = rom_C5DA,
+    [0xC5E3 - ROM_START] = rom_C5E3,
+    [0xC5E8 - ROM_START] = rom_C5E8,
+    [0xC5EB - ROM_START] = rom_C5EB,
+    [0xC5FA - ROM_START] = rom_C5FA,
+    [0xC5FB - ROM_START] = rom_C5FB,
+    [0xC602 - ROM_START] = rom_C602,
+    [0xC604 - ROM_START] = rom_C604,
+    [0xC611 - ROM_START] = rom_C611,
+    [0xC617 - ROM_START] = rom_C617,
+    [0xC621 - ROM_START] = rom_C621,
+    [0xC626 - ROM_START] = rom_C626,
+    [0xC629 - ROM_START] = rom_C629,
+    [0xC62C - ROM_START] = rom_C62C,
+    [0xC62F - ROM_START] = rom_C62F,
+    [0xC637 - ROM_START] = rom_C637,
+    [0xC63D - ROM_START] = rom_C63D,
+    [0xC641 - ROM_START] = rom_C641,
+    [0xC647 - ROM_START] = rom_C647,
+    [0xC64F - ROM_START] = rom_C64F,
+    [0xC655 - ROM_START] = rom_C655,
+    [0xC659 - ROM_START] = rom_C659,
+    [0xC65D - ROM_START] = rom_C65D,
+    [0xC65F - ROM_START] = rom_C65F,
+    [0xC666 - ROM_START] = rom_C666,
+    [0xC669 - ROM_START] = rom_C669,
+    [0xC66E - ROM_START] = rom_C66E,
+    [0xC672 - ROM_START] = rom_C672,
+    [0xC675 - ROM_START] = rom_C675,
+    [0xC67D - ROM_START] = rom_C67D,
+    [0xC67F - ROM_START] = rom_C67F,
+    [0xC681 - ROM_START] = rom_C681,
+    [0xC687 - ROM_START] = rom_C687,
+    [0xC688 - ROM_START] = rom_C688,
+    [0xC697 - ROM_START] = rom_C697,
+    [0xC69F - ROM_START] = rom_C69F,
+    [0xC6A5 - ROM_START] = rom_C6A5,
+    [0xC6A6 - ROM_START] = rom_C6A6,
+    [0xC6AD - ROM_START] = rom_C6AD,
+    [0xC6B4 - ROM_START] = rom_C6B4,
+    [0xC6B8 - ROM_START] = rom_C6B8,
+    [0xC6C3 - ROM_START] = rom_C6C3,
+    [0xC6C8 - ROM_START] = rom_C6C8,
+    [0xC6CE - ROM_START] = rom_C6CE,
+    [0xC6D7 - ROM_START] = rom_C6D7,
+    [0xC6DE - ROM_START] = rom_C6DE,
+    [0xC6E5 - ROM_START] = rom_C6E5,
+    [0xC6E8 - ROM_START] = rom_C6E8,
+    [0xC6ED - ROM_START] = rom_C6ED,
+    [0xC6F2 - ROM_START] = rom_C6F2,
+    [0xC6F5 - ROM_START] = rom_C6F5,
+    [0xC6F7 - ROM_START] = rom_C6F7,
+    [0xC6FC - ROM_START] = rom_C6FC,
+    [0xC701 - ROM_START] = rom_C701,
+    [0xC707 - ROM_START] = rom_C707,
+    [0xC70A - ROM_START] = rom_C70A,
+    [0xC70E - ROM_START] = rom_C70E,
+    [0xC719 - ROM_START] = rom_C719,
+    [0xC71B - ROM_START] = rom_C71B,
+    [0xC726 - ROM_START] = rom_C726,
+    [0xC728 - ROM_START] = rom_C728,
+    [0xC732 - ROM_START] = rom_C732,
+    [0xC736 - ROM_START] = rom_C736,
+    [0xC73B - ROM_START] = rom_C73B,
+    [0xC73C - ROM_START] = rom_C73C,
+    [0xC73F - ROM_START] = rom_C73F,
+    [0xC745 - ROM_START] = rom_C745,
+    [0xC74A - ROM_START] = rom_C74A,
+    [0xC766 - ROM_START] = rom_C766,
+    [0xC76B - ROM_START] = rom_C76B,
+    [0xC773 - ROM_START] = rom_C773,
+    [0xC77E - ROM_START] = rom_C77E,
+    [0xC783 - ROM_START] = rom_C783,
+    [0xC788 - ROM_START] = rom_C788,
+    [0xC78F - ROM_START] = rom_C78F,
+    [0xC793 - ROM_START] = rom_C793,
+    [0xC798 - ROM_START] = rom_C798,
+    [0xC79D - ROM_START] = rom_C79D,
+    [0xC7A7 - ROM_START] = rom_C7A7,
+    [0xC7AA - ROM_START] = rom_C7AA,
+    [0xC7AC - ROM_START] = rom_C7AC,
+    [0xC7B0 - ROM_START] = rom_C7B0,
+    [0xC7B6 - ROM_START] = rom_C7B6,
+    [0xC7B7 - ROM_START] = rom_C7B7,
+    [0xC7BA - ROM_START] = rom_C7BA,
+    [0xC7BD - ROM_START] = rom_C7BD,
+    [0xC7C0 - ROM_START] = rom_C7C0,
+    [0xC7E2 - ROM_START] = rom_C7E2,
+    [0xC7E5 - ROM_START] = rom_C7E5,
+    [0xC7EB - ROM_START] = rom_C7EB,
+    [0xC7ED - ROM_START] = rom_C7ED,
+    [0xC7F3 - ROM_START] = rom_C7F3,
+    [0xC806 - ROM_START] = rom_C806,
+    [0xC809 - ROM_START] = rom_C809,
+    [0xC80B - ROM_START] = rom_C80B,
+    [0xC814 - ROM_START] = rom_C814,
+    [0xC87D - ROM_START] = rom_C87D,
+    [0xC880 - ROM_START] = rom_C880,
+    [0xC883 - ROM_START] = rom_C883,
+    [0xC886 - ROM_START] = rom_C886,
+    [0xC88C - ROM_START] = rom_C88C,
+    [0xC894 - ROM_START] = rom_C894,
+    [0xC899 - ROM_START] = rom_C899,
+    [0xC89C - ROM_START] = rom_C89C,
+    [0xC8A1 - ROM_START] = rom_C8A1,
+    [0xC8A7 - ROM_START] = rom_C8A7,
+    [0xC8AA - ROM_START] = rom_C8AA,
+    [0xC8AD - ROM_START] = rom_C8AD,
+    [0xC8B0 - ROM_START] = rom_C8B0,
+    [0xC8B3 - ROM_START] = rom_C8B3,
+    [0xC8B6 - ROM_START] = rom_C8B6,
+    [0xC8BE - ROM_START] = rom_C8BE,
+    [0xCA35 - ROM_START] = rom_CA35,
+    [0xCA39 - ROM_START] = rom_CA39,
+    [0xCA3C - ROM_START] = rom_CA3C,
+    [0xCA48 - ROM_START] = rom_CA48,
+    [0xCA4B - ROM_START] = rom_CA4B,
+    [0xCA4D - ROM_START] = rom_CA4D,
+    [0xCA52 - ROM_START] = rom_CA52,
+    [0xCB63 - ROM_START] = rom_CB63,
+    [0xCB84 - ROM_START] = rom_CB84,
+    [0xCB8F - ROM_START] = rom_CB8F,
+    [0xCB98 - ROM_START] = rom_CB98,
+    [0xCB9D - ROM_START] = rom_CB9D,
+    [0xCBA0 - ROM_START] = rom_CBA0,
+    [0xCBA5 - ROM_START] = rom_CBA5,
+    [0xCBAA - ROM_START] = rom_CBAA,
+    [0xCBB1 - ROM_START] = rom_CBB1,
+    [0xCBB8 - ROM_START] = rom_CBB8,
+    [0xCBBF - ROM_START] = rom_CBBF,
+    [0xCBC6 - ROM_START] = rom_CBC6,
+    [0xCBCD - ROM_START] = rom_CBCD,
+    [0xCBE2 - ROM_START] = rom_CBE2,
+    [0xCBF1 - ROM_START] = rom_CBF1,
+    [0xCC2B - ROM_START] = rom_CC2B,
+    [0xCC7C - ROM_START] = rom_CC7C,
+    [0xCC83 - ROM_START] = rom_CC83,
+    [0xCC87 - ROM_START] = rom_CC87,
+    [0xCC8B - ROM_START] = rom_CC8B,
+    [0xCC91 - ROM_START] = rom_CC91,
+    [0xCC92 - ROM_START] = rom_CC92,
+    [0xCC95 - ROM_START] = rom_CC95,
+    [0xCC9F - ROM_START] = rom_CC9F,
+    [0xCCA1 - ROM_START] = rom_CCA1,
+    [0xCCAB - ROM_START] = rom_CCAB,
+    [0xCCB2 - ROM_START] = rom_CCB2,
+    [0xCCB6 - ROM_START] = rom_CCB6,
+    [0xCCCA - ROM_START] = rom_CCCA,
+    [0xCCD0 - ROM_START] = rom_CCD0,
+    [0xCCD5 - ROM_START] = rom_CCD5,
+    [0xCCD7 - ROM_START] = rom_CCD7,
+    [0xCCDA - ROM_START] = rom_CCDA,
+    [0xCCDF - ROM_START] = rom_CCDF,
+    [0xCCE4 - ROM_START] = rom_CCE4,
+    [0xCE0E - ROM_START] = rom_CE0E,
+    [0xCE11 - ROM_START] = rom_CE11,
+    [0xCE14 - ROM_START] = rom_CE14,
+    [0xCE1B - ROM_START] = rom_CE1B,
+    [0xCE2C - ROM_START] = rom_CE2C,
+    [0xCE2F - ROM_START] = rom_CE2F,
+    [0xCE3D - ROM_START] = rom_CE3D,
+    [0xCE41 - ROM_START] = rom_CE41,
+    [0xCE4A - ROM_START] = rom_CE4A,
+    [0xCE4C - ROM_START] = rom_CE4C,
+    [0xCE50 - ROM_START] = rom_CE50,
+    [0xCE54 - ROM_START] = rom_CE54,
+    [0xCE57 - ROM_START] = rom_CE57,
+    [0xCE5A - ROM_START] = rom_CE5A,
+    [0xCE5E - ROM_START] = rom_CE5E,
+    [0xCE67 - ROM_START] = rom_CE67,
+    [0xCE6B - ROM_START] = rom_CE6B,
+    [0xCE6D - ROM_START] = rom_CE6D,
+    [0xCE6E - ROM_START] = rom_CE6E,
+    [0xCE71 - ROM_START] = rom_CE71,
+    [0xCE77 - ROM_START] = rom_CE77,
+    [0xCE84 - ROM_START] = rom_CE84,
+    [0xCE87 - ROM_START] = rom_CE87,
+    [0xCE89 - ROM_START] = rom_CE89,
+    [0xCE92 - ROM_START] = rom_CE92,
+    [0xCE9A - ROM_START] = rom_CE9A,
+    [0xCEA3 - ROM_START] = rom_CEA3,
+    [0xCEA6 - ROM_START] = rom_CEA6,
+    [0xCEA9 - ROM_START] = rom_CEA9,
+    [0xCEAD - ROM_START] = rom_CEAD,
+    [0xCEB0 - ROM_START] = rom_CEB0,
+    [0xCEB9 - ROM_START] = rom_CEB9,
+    [0xCEBD - ROM_START] = rom_CEBD,
+    [0xCEBF - ROM_START] = rom_CEBF,
+    [0xCEC5 - ROM_START] = rom_CEC5,
+    [0xCECC - ROM_START] = rom_CECC,
+    [0xCED0 - ROM_START] = rom_CED0,
+    [0xCED4 - ROM_START] = rom_CED4,
+    [0xCED6 - ROM_START] = rom_CED6,
+    [0xCED8 - ROM_START] = rom_CED8,
+    [0xCED9 - ROM_START] = rom_CED9,
+    [0xCEE2 - ROM_START] = rom_CEE2,
+    [0xCEE5 - ROM_START] = rom_CEE5,
+    [0xCEE6 - ROM_START] = rom_CEE6,
+    [0xCEED - ROM_START] = rom_CEED,
+    [0xCEF0 - ROM_START] = rom_CEF0,
+    [0xCEF9 - ROM_START] = rom_CEF9,
+    [0xCEFA - ROM_START] = rom_CEFA,
+    [0xCEFC - ROM_START] = rom_CEFC,
+    [0xCF04 - ROM_START] = rom_CF04,
+    [0xCF09 - ROM_START] = rom_CF09,
+    [0xCF0D - ROM_START] = rom_CF0D,
+    [0xCF16 - ROM_START] = rom_CF16,
+    [0xCF19 - ROM_START] = rom_CF19,
+    [0xCF1D - ROM_START] = rom_CF1D,
+    [0xCF1E - ROM_START] = rom_CF1E,
+    [0xCF21 - ROM_START] = rom_CF21,
+    [0xCF24 - ROM_START] = rom_CF24,
+    [0xCF26 - ROM_START] = rom_CF26,
+    [0xCF29 - ROM_START] = rom_CF29,
+    [0xCF2C - ROM_START] = rom_CF2C,
+    [0xCF2E - ROM_START] = rom_CF2E,
+    [0xCF31 - ROM_START] = rom_CF31,
+    [0xCF3C - ROM_START] = rom_CF3C,
+    [0xCF43 - ROM_START] = rom_CF43,
+    [0xCF47 - ROM_START] = rom_CF47,
+    [0xCF4A - ROM_START] = rom_CF4A,
+    [0xCF4C - ROM_START] = rom_CF4C,
+    [0xCF4F - ROM_START] = rom_CF4F,
+    [0xCF51 - ROM_START] = rom_CF51,
+    [0xCF54 - ROM_START] = rom_CF54,
+    [0xCF57 - ROM_START] = rom_CF57,
+    [0xCF5A - ROM_START] = rom_CF5A,
+    [0xCF5D - ROM_START] = rom_CF5D,
+    [0xCF66 - ROM_START] = rom_CF66,
+    [0xCF6C - ROM_START] = rom_CF6C,
+    [0xCF6F - ROM_START] = rom_CF6F,
+    [0xCF72 - ROM_START] = rom_CF72,
+    [0xCF76 - ROM_START] = rom_CF76,
+    [0xCF7B - ROM_START] = rom_CF7B,
+    [0xCF7E - ROM_START] = rom_CF7E,
+    [0xCF81 - ROM_START] = rom_CF81,
+    [0xCF83 - ROM_START] = rom_CF83,
+    [0xCF86 - ROM_START] = rom_CF86,
+    [0xCF88 - ROM_START] = rom_CF88,
+    [0xCF8B - ROM_START] = rom_CF8B,
+    [0xCF8C - ROM_START] = rom_CF8C,
+    [0xCFB7 - ROM_START] = rom_CFB7,
+    [0xCFBF - ROM_START] = rom_CFBF,
+    [0xCFC2 - ROM_START] = rom_CFC2,
+    [0xCFC4 - ROM_START] = rom_CFC4,
+    [0xCFC9 - ROM_START] = rom_CFC9,
+    [0xCFCB - ROM_START] = rom_CFCB,
+    [0xCFCE - ROM_START] = rom_CFCE,
+    [0xCFD3 - ROM_START] = rom_CFD3,
+    [0xCFD8 - ROM_START] = rom_CFD8,
+    [0xCFDF - ROM_START] = rom_CFDF,
+    [0xCFE3 - ROM_START] = rom_CFE3,
+    [0xCFE8 - ROM_START] = rom_CFE8,
+    [0xCFEC - ROM_START] = rom_CFEC,
+    [0xCFED - ROM_START] = rom_CFED,
+    [0xCFF1 - ROM_START] = rom_CFF1,
+    [0xCFF5 - ROM_START] = rom_CFF5,
+    [0xCFF7 - ROM_START] = rom_CFF7,
+    [0xCFFD - ROM_START] = rom_CFFD,
+    [0xD00E - ROM_START] = rom_D00E,
+    [0xD011 - ROM_START] = rom_D011,
+    [0xD018 - ROM_START] = rom_D018,
+    [0xD01C - ROM_START] = rom_D01C,
+    [0xD01F - ROM_START] = rom_D01F,
+    [0xD024 - ROM_START] = rom_D024,
+    [0xD02C - ROM_START] = rom_D02C,
+    [0xD03D - ROM_START] = rom_D03D,
+    [0xD042 - ROM_START] = rom_D042,
+    [0xD045 - ROM_START] = rom_D045,
+    [0xD048 - ROM_START] = rom_D048,
+    [0xD04B - ROM_START] = rom_D04B,
+    [0xD060 - ROM_START] = rom_D060,
+    [0xD078 - ROM_START] = rom_D078,
+    [0xD07D - ROM_START] = rom_D07D,
+    [0xD082 - ROM_START] = rom_D082,
+    [0xD083 - ROM_START] = rom_D083,
+    [0xD08B - ROM_START] = rom_D08B,
+    [0xD08F - ROM_START] = rom_D08F,
+    [0xD09B - ROM_START] = rom_D09B,
+    [0xD09E - ROM_START] = rom_D09E,
+    [0xD0A1 - ROM_START] = rom_D0A1,
+    [0xD0A4 - ROM_START] = rom_D0A4,
+    [0xD0A7 - ROM_START] = rom_D0A7,
+    [0xD0AC - ROM_START] = rom_D0AC,
+    [0xD0AF - ROM_START] = rom_D0AF,
+    [0xD0B2 - ROM_START] = rom_D0B2,
+    [0xD0B6 - ROM_START] = rom_D0B6,
+    [0xD0B7 - ROM_START] = rom_D0B7,
+    [0xD0BA - ROM_START] = rom_D0BA,
+    [0xD0BD - ROM_START] = rom_D0BD,
+    [0xD0C0 - ROM_START] = rom_D0C0,
+    [0xD0C3 - ROM_START] = rom_D0C3,
+    [0xD0C7 - ROM_START] = rom_D0C7,
+    [0xD0C9 - ROM_START] = rom_D0C9,
+    [0xD0CF - ROM_START] = rom_D0CF,
+    [0xD0D3 - ROM_START] = rom_D0D3,
+    [0xD0DE - ROM_START] = rom_D0DE,
+    [0xD0E2 - ROM_START] = rom_D0E2,
+    [0xD0E6 - ROM_START] = rom_D0E6,
+    [0xD0E8 - ROM_START] = rom_D0E8,
+    [0xD0EB - ROM_START] = rom_D0EB,
+    [0xD0F1 - ROM_START] = rom_D0F1,
+    [0xD0F3 - ROM_START] = rom_D0F3,
+    [0xD0F7 - ROM_START] = rom_D0F7,
+    [0xD0F9 - ROM_START] = rom_D0F9,
+    [0xD100 - ROM_START] = rom_D100,
+    [0xD106 - ROM_START] = rom_D106,
+    [0xD107 - ROM_START] = rom_D107,
+    [0xD10D - ROM_START] = rom_D10D,
+    [0xD10F - ROM_START] = rom_D10F,
+    [0xD117 - ROM_START] = rom_D117,
+    [0xD119 - ROM_START] = rom_D119,
+    [0xD121 - ROM_START] = rom_D121,
+    [0xD123 - ROM_START] = rom_D123,
+    [0xD125 - ROM_START] = rom_D125,
+    [0xD12F - ROM_START] = rom_D12F,
+    [0xD132 - ROM_START] = rom_D132,
+    [0xD137 - ROM_START] = rom_D137,
+    [0xD13A - ROM_START] = rom_D13A,
+    [0xD13F - ROM_START] = rom_D13F,
+    [0xD149 - ROM_START] = rom_D149,
+    [0xD14D - ROM_START] = rom_D14D,
+    [0xD151 - ROM_START] = rom_D151,
+    [0xD156 - ROM_START] = rom_D156,
+    [0xD159 - ROM_START] = rom_D159,
+    [0xD15B - ROM_START] = rom_D15B,
+    [0xD162 - ROM_START] = rom_D162,
+    [0xD16A - ROM_START] = rom_D16A,
+    [0xD16D - ROM_START] = rom_D16D,
+    [0xD172 - ROM_START] = rom_D172,
+    [0xD175 - ROM_START] = rom_D175,
+    [0xD179 - ROM_START] = rom_D179,
+    [0xD17E - ROM_START] = rom_D17E,
+    [0xD183 - ROM_START] = rom_D183,
+    [0xD186 - ROM_START] = rom_D186,
+    [0xD189 - ROM_START] = rom_D189,
+    [0xD18C - ROM_START] = rom_D18C,
+    [0xD18F - ROM_START] = rom_D18F,
+    [0xD191 - ROM_START] = rom_D191,
+    [0xD192 - ROM_START] = rom_D192,
+    [0xD195 - ROM_START] = rom_D195,
+    [0xD19D - ROM_START] = rom_D19D,
+    [0xD1A0 - ROM_START] = rom_D1A0,
+    [0xD1A2 - ROM_START] = rom_D1A2,
+    [0xD1A3 - ROM_START] = rom_D1A3,
+    [0xD1A6 - ROM_START] = rom_D1A6,
+    [0xD1A9 - ROM_START] = rom_D1A9,
+    [0xD1AE - ROM_START] = rom_D1AE,
+    [0xD1B3 - ROM_START] = rom_D1B3,
+    [0xD1B8 - ROM_START] = rom_D1B8,
+    [0xD1BB - ROM_START] = rom_D1BB,
+    [0xD1BE - ROM_START] = rom_D1BE,
+    [0xD1C1 - ROM_START] = rom_D1C1,
+    [0xD1C6 - ROM_START] = rom_D1C6,
+    [0xD1CB - ROM_START] = rom_D1CB,
+    [0xD1D3 - ROM_START] = rom_D1D3,
+    [0xD1D6 - ROM_START] = rom_D1D6,
+    [0xD1DF - ROM_START] = rom_D1DF,
+    [0xD1E2 - ROM_START] = rom_D1E2,
+    [0xD1E3 - ROM_START] = rom_D1E3,
+    [0xD1E9 - ROM_START] = rom_D1E9,
+    [0xD1EC - ROM_START] = rom_D1EC,
+    [0xD1F3 - ROM_START] = rom_D1F3,
+    [0xD1F5 - ROM_START] = rom_D1F5,
+    [0xD20A - ROM_START] = rom_D20A,
+    [0xD20D - ROM_START] = rom_D20D,
+    [0xD20F - ROM_START] = rom_D20F,
+    [0xD212 - ROM_START] = rom_D212,
+    [0xD217 - ROM_START] = rom_D217,
+    [0xD21E - ROM_START] = rom_D21E,
+    [0xD221 - ROM_START] = rom_D221,
+    [0xD223 - ROM_START] = rom_D223,
+    [0xD226 - ROM_START] = rom_D226,
+    [0xD227 - ROM_START] = rom_D227,
+    [0xD22D - ROM_START] = rom_D22D,
+    [0xD22E - ROM_START] = rom_D22E,
+    [0xD237 - ROM_START] = rom_D237,
+    [0xD249 - ROM_START] = rom_D249,
+    [0xD24D - ROM_START] = rom_D24D,
+    [0xD250 - ROM_START] = rom_D250,
+    [0xD253 - ROM_START] = rom_D253,
+    [0xD259 - ROM_START] = rom_D259,
+    [0xD25A - ROM_START] = rom_D25A,
+    [0xD262 - ROM_START] = rom_D262,
+    [0xD26B - ROM_START] = rom_D26B,
+    [0xD273 - ROM_START] = rom_D273,
+    [0xD27C - ROM_START] = rom_D27C,
+    [0xD284 - ROM_START] = rom_D284,
+    [0xD28D - ROM_START] = rom_D28D,
+    [0xD28E - ROM_START] = rom_D28E,
+    [0xD295 - ROM_START] = rom_D295,
+    [0xD297 - ROM_START] = rom_D297,
+    [0xD29B - ROM_START] = rom_D29B,
+    [0xD29D - ROM_START] = rom_D29D,
+    [0xD2A0 - ROM_START] = rom_D2A0,
+    #if !IDLE_SKIP
+    [0xD2A3 - ROM_START] = rom_D2A3,
+    #endif
+    [0xD2A7 - ROM_START] = rom_D2A7,
+    [0xD2B6 - ROM_START] = rom_D2B6,
+    [0xD2BA - ROM_START] = rom_D2BA,
+    [0xD2BC - ROM_START] = rom_D2BC,
+    [0xD2C4 - ROM_START] = rom_D2C4,
+    [0xD2C7 - ROM_START] = rom_D2C7,
+    [0xD2C8 - ROM_START] = rom_D2C8,
+    [0xD2D5 - ROM_START] = rom_D2D5,
+    [0xD2D8 - ROM_START] = rom_D2D8,
+    [0xD2D9 - ROM_START] = rom_D2D9,
+    [0xD2DA - ROM_START] = rom_D2DA,
+    [0xD2E0 - ROM_START] = rom_D2E0,
+    [0xD2E9 - ROM_START] = rom_D2E9,
+    [0xD2ED - ROM_START] = rom_D2ED,
+    [0xD2F3 - ROM_START] = rom_D2F3,
+    [0xD2F9 - ROM_START] = rom_D2F9,
+    [0xD302 - ROM_START] = rom_D302,
+    [0xD303 - ROM_START] = rom_D303,
+    [0xD306 - ROM_START] = rom_D306,
+    [0xD313 - ROM_START] = rom_D313,
+    [0xD317 - ROM_START] = rom_D317,
+    [0xD320 - ROM_START] = rom_D320,
+    [0xD327 - ROM_START] = rom_D327,
+    [0xD331 - ROM_START] = rom_D331,
+    [0xD334 - ROM_START] = rom_D334,
+    [0xD338 - ROM_START] = rom_D338,
+    [0xD339 - ROM_START] = rom_D339,
+    [0xD33E - ROM_START] = rom_D33E,
+    [0xD344 - ROM_START] = rom_D344,
+    [0xD348 - ROM_START] = rom_D348,
+    [0xD351 - ROM_START] = rom_D351,
+    [0xD355 - ROM_START] = rom_D355,
+    [0xD35A - ROM_START] = rom_D35A,
+    [0xD35E - ROM_START] = rom_D35E,
+    #if !IDLE_SKIP
+    [0xD363 - ROM_START] = rom_D363,
+    #endif
+    [0xD367 - ROM_START] = rom_D367,
+    [0xD36B - ROM_START] = rom_D36B,
+    [0xD371 - ROM_START] = rom_D371,
+    [0xD373 - ROM_START] = rom_D373,
+    [0xD37A - ROM_START] = rom_D37A,
+    [0xD37F - ROM_START] = rom_D37F,
+    [0xD383 - ROM_START] = rom_D383,
+    [0xD388 - ROM_START] = rom_D388,
+    [0xD38C - ROM_START] = rom_D38C,
+    [0xD391 - ROM_START] = rom_D391,
+    [0xD39B - ROM_START] = rom_D39B,
+    [0xD39E - ROM_START] = rom_D39E,
+    [0xD3A1 - ROM_START] = rom_D3A1,
+    [0xD3A4 - ROM_START] = rom_D3A4,
+    [0xD3AA - ROM_START] = rom_D3AA,
+    [0xD3AF - ROM_START] = rom_D3AF,
+    [0xD3B1 - ROM_START] = rom_D3B1,
+    [0xD3B4 - ROM_START] = rom_D3B4,
+    [0xD3BA - ROM_START] = rom_D3BA,
+    [0xD3C0 - ROM_START] = rom_D3C0,
+    [0xD3C3 - ROM_START] = rom_D3C3,
+    [0xD3C7 - ROM_START] = rom_D3C7,
+    [0xD3CE - ROM_START] = rom_D3CE,
+    [0xD3D3 - ROM_START] = rom_D3D3,
+    [0xD3D7 - ROM_START] = rom_D3D7,
+    [0xD3DA - ROM_START] = rom_D3DA,
+    [0xD3DE - ROM_START] = rom_D3DE,
+    [0xD3E1 - ROM_START] = rom_D3E1,
+    [0xD3E8 - ROM_START] = rom_D3E8,
+    [0xD3EC - ROM_START] = rom_D3EC,
+    [0xD3EE - ROM_START] = rom_D3EE,
+    [0xD3FA - ROM_START] = rom_D3FA,
+    [0xD3FF - ROM_START] = rom_D3FF,
+    [0xD400 - ROM_START] = rom_D400,
+    [0xD403 - ROM_START] = rom_D403,
+    [0xD409 - ROM_START] = rom_D409,
+    [0xD40E - ROM_START] = rom_D40E,
+    [0xD411 - ROM_START] = rom_D411,
+    [0xD414 - ROM_START] = rom_D414,
+    [0xD417 - ROM_START] = rom_D417,
+    [0xD41B - ROM_START] = rom_D41B,
+    [0xD421 - ROM_START] = rom_D421,
+    [0xD428 - ROM_START] = rom_D428,
+    [0xD42D - ROM_START] = rom_D42D,
+    [0xD433 - ROM_START] = rom_D433,
+    [0xD436 - ROM_START] = rom_D436,
+    [0xD43A - ROM_START] = rom_D43A,
+    [0xD43F - ROM_START] = rom_D43F,
+    [0xD443 - ROM_START] = rom_D443,
+    [0xD445 - ROM_START] = rom_D445,
+    [0xD44D - ROM_START] = rom_D44D,
+    [0xD450 - ROM_START] = rom_D450,
+    [0xD45A - ROM_START] = rom_D45A,
+    [0xD45F - ROM_START] = rom_D45F,
+    [0xD460 - ROM_START] = rom_D460,
+    [0xD464 - ROM_START] = rom_D464,
+    [0xD466 - ROM_START] = rom_D466,
+    [0xD470 - ROM_START] = rom_D470,
+    [0xD475 - ROM_START] = rom_D475,
+    [0xD477 - ROM_START] = rom_D477,
+    [0xD481 - ROM_START] = rom_D481,
+    [0xD48D - ROM_START] = rom_D48D,
+    [0xD490 - ROM_START] = rom_D490,
+    [0xD49E - ROM_START] = rom_D49E,
+    [0xD4A6 - ROM_START] = rom_D4A6,
+    [0xD4AB - ROM_START] = rom_D4AB,
+    [0xD4B0 - ROM_START] = rom_D4B0,
+    [0xD4B3 - ROM_START] = rom_D4B3,
+    [0xD4B6 - ROM_START] = rom_D4B6,
+    [0xD4BB - ROM_START] = rom_D4BB,
+    [0xD4BE - ROM_START] = rom_D4BE,
+    [0xD4C0 - ROM_START] = rom_D4C0,
+    [0xD4C3 - ROM_START] = rom_D4C3,
+    [0xD4C8 - ROM_START] = rom_D4C8,
+    [0xD4CD - ROM_START] = rom_D4CD,
+    [0xD4DA - ROM_START] = rom_D4DA,
+    [0xD4E1 - ROM_START] = rom_D4E1,
+    [0xD4E8 - ROM_START] = rom_D4E8,
+    [0xD4EB - ROM_START] = rom_D4EB,
+    [0xD4F6 - ROM_START] = rom_D4F6,
+    [0xD4FB - ROM_START] = rom_D4FB,
+    [0xD506 - ROM_START] = rom_D506,
+    [0xD50E - ROM_START] = rom_D50E,
+    [0xD51D - ROM_START] = rom_D51D,
+    [0xD522 - ROM_START] = rom_D522,
+    [0xD52B - ROM_START] = rom_D52B,
+    [0xD530 - ROM_START] = rom_D530,
+    [0xD535 - ROM_START] = rom_D535,
+    [0xD538 - ROM_START] = rom_D538,
+    [0xD53A - ROM_START] = rom_D53A,
+    [0xD53F - ROM_START] = rom_D53F,
+    [0xD543 - ROM_START] = rom_D543,
+    [0xD548 - ROM_START] = rom_D548,
+    [0xD54A - ROM_START] = rom_D54A,
+    [0xD54D - ROM_START] = rom_D54D,
+    [0xD552 - ROM_START] = rom_D552,
+    [0xD572 - ROM_START] = rom_D572,
+    [0xD575 - ROM_START] = rom_D575,
+    [0xD57A - ROM_START] = rom_D57A,
+    [0xD586 - ROM_START] = rom_D586,
+    [0xD58A - ROM_START] = rom_D58A,
+    [0xD58C - ROM_START] = rom_D58C,
+    [0xD590 - ROM_START] = rom_D590,
+    [0xD593 - ROM_START] = rom_D593,
+    [0xD599 - ROM_START] = rom_D599,
+    [0xD59C - ROM_START] = rom_D59C,
+    [0xD59E - ROM_START] = rom_D59E,
+    [0xD5A6 - ROM_START] = rom_D5A6,
+    [0xD5AA - ROM_START] = rom_D5AA,
+    [0xD5AE - ROM_START] = rom_D5AE,
+    [0xD5B2 - ROM_START] = rom_D5B2,
+    [0xD5B6 - ROM_START] = rom_D5B6,
+    [0xD5BA - ROM_START] = rom_D5BA,
+    [0xD5BF - ROM_START] = rom_D5BF,
+    [0xD5C2 - ROM_START] = rom_D5C2,
+    [0xD5C4 - ROM_START] = rom_D5C4,
+    [0xD5C6 - ROM_START] = rom_D5C6,
+    [0xD5DC - ROM_START] = rom_D5DC,
+    [0xD5E0 - ROM_START] = rom_D5E0,
+    [0xD5E3 - ROM_START] = rom_D5E3,
+    [0xD5ED - ROM_START] = rom_D5ED,
+    [0xD5F4 - ROM_START] = rom_D5F4,
+    [0xD5F8 - ROM_START] = rom_D5F8,
+    [0xD600 - ROM_START] = rom_D600,
+    [0xD613 - ROM_START] = rom_D613,
+    [0xD619 - ROM_START] = rom_D619,
+    [0xD61D - ROM_START] = rom_D61D,
+    [0xD625 - ROM_START] = rom_D625,
+    [0xD62B - ROM_START] = rom_D62B,
+    [0xD631 - ROM_START] = rom_D631,
+    [0xD635 - ROM_START] = rom_D635,
+    [0xD63A - ROM_START] = rom_D63A,
+    [0xD63F - ROM_START] = rom_D63F,
+    [0xD644 - ROM_START] = rom_D644,
+    [0xD64A - ROM_START] = rom_D64A,
+    #if !IDLE_SKIP
+    [0xD651 - ROM_START] = rom_D651,
+    #endif
+    [0xD655 - ROM_START] = rom_D655,
+    [0xD658 - ROM_START] = rom_D658,
+    [0xD65C - ROM_START] = rom_D65C,
+    [0xD661 - ROM_START] = rom_D661,
+    [0xD669 - ROM_START] = rom_D669,
+    [0xD66D - ROM_START] = rom_D66D,
+    [0xD676 - ROM_START] = rom_D676,
+    [0xD67A - ROM_START] = rom_D67A,
+    [0xD67C - ROM_START] = rom_D67C,
+    [0xD681 - ROM_START] = rom_D681,
+    [0xD686 - ROM_START] = rom_D686,
+    [0xD688 - ROM_START] = rom_D688,
+    [0xD68D - ROM_START] = rom_D68D,
+    [0xD692 - ROM_START] = rom_D692,
+    [0xD693 - ROM_START] = rom_D693,
+    #if !IDLE_SKIP
+    [0xD69A - ROM_START] = rom_D69A,
+    #endif
+    [0xD69F - ROM_START] = rom_D69F,
+    [0xD6A6 - ROM_START] = rom_D6A6,
+    [0xD6AB - ROM_START] = rom_D6AB,
+    #if !IDLE_SKIP
+    [0xD6B9 - ROM_START] = rom_D6B9,
+    #endif
+    [0xD6BD - ROM_START] = rom_D6BD,
+    [0xD6C1 - ROM_START] = rom_D6C1,
+    [0xD6C4 - ROM_START] = rom_D6C4,
+    [0xD6D0 - ROM_START] = rom_D6D0,
+    [0xD6D3 - ROM_START] = rom_D6D3,
+    [0xD6E4 - ROM_START] = rom_D6E4,
+    [0xD6F7 - ROM_START] = rom_D6F7,
+    [0xD709 - ROM_START] = rom_D709,
+    [0xD711 - ROM_START] = rom_D711,
+    [0xD713 - ROM_START] = rom_D713,
+    [0xD715 - ROM_START] = rom_D715,
+    [0xD71A - ROM_START] = rom_D71A,
+    [0xD71E - ROM_START] = rom_D71E,
+    [0xD723 - ROM_START] = rom_D723,
+    [0xD726 - ROM_START] = rom_D726,
+    [0xD72E - ROM_START] = rom_D72E,
+    [0xD730 - ROM_START] = rom_D730,
+    [0xD733 - ROM_START] = rom_D733,
+    [0xD73D - ROM_START] = rom_D73D,
+    [0xD743 - ROM_START] = rom_D743,
+    [0xD74B - ROM_START] = rom_D74B,
+    [0xD74D - ROM_START] = rom_D74D,
+    [0xD750 - ROM_START] = rom_D750,
+    [0xD757 - ROM_START] = rom_D757,
+    [0xD75E - ROM_START] = rom_D75E,
+    [0xD761 - ROM_START] = rom_D761,
+    [0xD76B - ROM_START] = rom_D76B,
+    [0xD76F - ROM_START] = rom_D76F,
+    [0xD776 - ROM_START] = rom_D776,
+    [0xD77D - ROM_START] = rom_D77D,
+    [0xD790 - ROM_START] = rom_D790,
+    [0xD793 - ROM_START] = rom_D793,
+    [0xD7B4 - ROM_START] = rom_D7B4,
+    [0xD7BC - ROM_START] = rom_D7BC,
+    [0xD7C7 - ROM_START] = rom_D7C7,
+    [0xD7CB - ROM_START] = rom_D7CB,
+    [0xD7CF - ROM_START] = rom_D7CF,
+    [0xD7E4 - ROM_START] = rom_D7E4,
+    [0xD7E7 - ROM_START] = rom_D7E7,
+    [0xD7EB - ROM_START] = rom_D7EB,
+    [0xD7F3 - ROM_START] = rom_D7F3,
+    [0xD7F7 - ROM_START] = rom_D7F7,
+    [0xD7FC - ROM_START] = rom_D7FC,
+    [0xD7FF - ROM_START] = rom_D7FF,
+    [0xD802 - ROM_START] = rom_D802,
+    [0xD80E - ROM_START] = rom_D80E,
+    [0xD815 - ROM_START] = rom_D815,
+    [0xD819 - ROM_START] = rom_D819,
+    [0xD81C - ROM_START] = rom_D81C,
+    [0xD82B - ROM_START] = rom_D82B,
+    [0xD82E - ROM_START] = rom_D82E,
+    [0xD830 - ROM_START] = rom_D830,
+    [0xD834 - ROM_START] = rom_D834,
+    [0xD837 - ROM_START] = rom_D837,
+    [0xD83C - ROM_START] = rom_D83C,
+    [0xD83F - ROM_START] = rom_D83F,
+    [0xD840 - ROM_START] = rom_D840,
+    [0xD848 - ROM_START] = rom_D848,
+    [0xD84F - ROM_START] = rom_D84F,
+    [0xD852 - ROM_START] = rom_D852,
+    [0xD855 - ROM_START] = rom_D855,
+    [0xD866 - ROM_START] = rom_D866,
+    [0xD869 - ROM_START] = rom_D869,
+    [0xD86F - ROM_START] = rom_D86F,
+    [0xD873 - ROM_START] = rom_D873,
+    [0xD876 - ROM_START] = rom_D876,
+    [0xD87F - ROM_START] = rom_D87F,
+    [0xD88C - ROM_START] = rom_D88C,
+    [0xD891 - ROM_START] = rom_D891,
+    [0xD896 - ROM_START] = rom_D896,
+    [0xD8A2 - ROM_START] = rom_D8A2,
+    [0xD8A7 - ROM_START] = rom_D8A7,
+    [0xD8AE - ROM_START] = rom_D8AE,
+    [0xD8B1 - ROM_START] = rom_D8B1,
+    [0xD8BF - ROM_START] = rom_D8BF,
+    [0xD8C6 - ROM_START] = rom_D8C6,
+    [0xD8CD - ROM_START] = rom_D8CD,
+    [0xD8D3 - ROM_START] = rom_D8D3,
+    [0xD8D6 - ROM_START] = rom_D8D6,
+    [0xD8D9 - ROM_START] = rom_D8D9,
+    [0xD8DE - ROM_START] = rom_D8DE,
+    [0xD8E1 - ROM_START] = rom_D8E1,
+    [0xD8E8 - ROM_START] = rom_D8E8,
+    [0xD8EB - ROM_START] = rom_D8EB,
+    [0xD8F0 - ROM_START] = rom_D8F0,
+    [0xD8F5 - ROM_START] = rom_D8F5,
+    [0xD8FE - ROM_START] = rom_D8FE,
+    [0xD902 - ROM_START] = rom_D902,
+    [0xD905 - ROM_START] = rom_D905,
+    [0xD911 - ROM_START] = rom_D911,
+    [0xD917 - ROM_START] = rom_D917,
+    [0xD93A - ROM_START] = rom_D93A,
+    [0xD93D - ROM_START] = rom_D93D,
+    [0xD940 - ROM_START] = rom_D940,
+    [0xD945 - ROM_START] = rom_D945,
+    [0xD94A - ROM_START] = rom_D94A,
+    [0xD951 - ROM_START] = rom_D951,
+    [0xD957 - ROM_START] = rom_D957,
+    [0xD95C - ROM_START] = rom_D95C,
+    [0xD965 - ROM_START] = rom_D965,
+    [0xD96A - ROM_START] = rom_D96A,
+    [0xD976 - ROM_START] = rom_D976,
+    [0xD97A - ROM_START] = rom_D97A,
+    [0xD98A - ROM_START] = rom_D98A,
+    [0xD98D - ROM_START] = rom_D98D,
+    [0xD990 - ROM_START] = rom_D990,
+    [0xD993 - ROM_START] = rom_D993,
+    [0xD99A - ROM_START] = rom_D99A,
+    [0xD99D - ROM_START] = rom_D99D,
+    [0xD9A0 - ROM_START] = rom_D9A0,
+    [0xD9B9 - ROM_START] = rom_D9B9,
+    [0xD9BE - ROM_START] = rom_D9BE,
+    [0xD9C3 - ROM_START] = rom_D9C3,
+    [0xD9D3 - ROM_START] = rom_D9D3,
+    [0xD9E3 - ROM_START] = rom_D9E3,
+    [0xD9EC - ROM_START] = rom_D9EC,
+    [0xD9EF - ROM_START] = rom_D9EF,
+    [0xD9F5 - ROM_START] = rom_D9F5,
+    [0xD9F8 - ROM_START] = rom_D9F8,
+    [0xDA06 - ROM_START] = rom_DA06,
+    [0xDA09 - ROM_START] = rom_DA09,
+    [0xDA11 - ROM_START] = rom_DA11,
+    [0xDA14 - ROM_START] = rom_DA14,
+    [0xDA19 - ROM_START] = rom_DA19,
+    [0xDA1C - ROM_START] = rom_DA1C,
+    [0xDA1E - ROM_START] = rom_DA1E,
+    [0xDA21 - ROM_START] = rom_DA21,
+    [0xDA26 - ROM_START] = rom_DA26,
+    [0xDA29 - ROM_START] = rom_DA29,
+    [0xDA2A - ROM_START] = rom_DA2A,
+    [0xDA2D - ROM_START] = rom_DA2D,
+    [0xDA32 - ROM_START] = rom_DA32,
+    [0xDA34 - ROM_START] = rom_DA34,
+    [0xDA37 - ROM_START] = rom_DA37,
+    [0xDA3D - ROM_START] = rom_DA3D,
+    [0xDA40 - ROM_START] = rom_DA40,
+    [0xDA42 - ROM_START] = rom_DA42,
+    [0xDA45 - ROM_START] = rom_DA45,
+    [0xDA55 - ROM_START] = rom_DA55,
+    [0xDA62 - ROM_START] = rom_DA62,
+    [0xDA65 - ROM_START] = rom_DA65,
+    [0xDA6B - ROM_START] = rom_DA6B,
+    [0xDA6D - ROM_START] = rom_DA6D,
+    [0xDA86 - ROM_START] = rom_DA86,
+    [0xDA89 - ROM_START] = rom_DA89,
+    [0xDA8B - ROM_START] = rom_DA8B,
+    [0xDA8E - ROM_START] = rom_DA8E,
+    [0xDA90 - ROM_START] = rom_DA90,
+    [0xDA98 - ROM_START] = rom_DA98,
+    [0xDA9B - ROM_START] = rom_DA9B,
+    [0xDA9E - ROM_START] = rom_DA9E,
+    [0xDAA1 - ROM_START] = rom_DAA1,
+    [0xDAA4 - ROM_START] = rom_DAA4,
+    [0xDAA7 - ROM_START] = rom_DAA7,
+    [0xDAAA - ROM_START] = rom_DAAA,
+    [0xDAAD - ROM_START] = rom_DAAD,
+    [0xDAC0 - ROM_START] = rom_DAC0,
+    [0xDAC9 - ROM_START] = rom_DAC9,
+    [0xDAD1 - ROM_START] = rom_DAD1,
+    [0xDAD4 - ROM_START] = rom_DAD4,
+    [0xDAD8 - ROM_START] = rom_DAD8,
+    [0xDADB - ROM_START] = rom_DADB,
+    [0xDAE1 - ROM_START] = rom_DAE1,
+    [0xDAE6 - ROM_START] = rom_DAE6,
+    [0xDAE9 - ROM_START] = rom_DAE9,
+    [0xDAEC - ROM_START] = rom_DAEC,
+    [0xDAF0 - ROM_START] = rom_DAF0,
+    [0xDAF3 - ROM_START] = rom_DAF3,
+    [0xDAF7 - ROM_START] = rom_DAF7,
+    [0xDAFC - ROM_START] = rom_DAFC,
+    [0xDAFF - ROM_START] = rom_DAFF,
+    [0xDB02 - ROM_START] = rom_DB02,
+    [0xDB0B - ROM_START] = rom_DB0B,
+    [0xDB0C - ROM_START] = rom_DB0C,
+    [0xDB13 - ROM_START] = rom_DB13,
+    [0xDB17 - ROM_START] = rom_DB17,
+    [0xDB1B - ROM_START] = rom_DB1B,
+    [0xDB1E - ROM_START] = rom_DB1E,
+    [0xDB20 - ROM_START] = rom_DB20,
+    [0xDB23 - ROM_START] = rom_DB23,
+    [0xDB26 - ROM_START] = rom_DB26,
+    [0xDB29 - ROM_START] = rom_DB29,
+    [0xDB2C - ROM_START] = rom_DB2C,
+    [0xDB2F - ROM_START] = rom_DB2F,
+    [0xDB32 - ROM_START] = rom_DB32,
+    [0xDB35 - ROM_START] = rom_DB35,
+    [0xDB4B - ROM_START] = rom_DB4B,
+    [0xDB5A - ROM_START] = rom_DB5A,
+    [0xDB5C - ROM_START] = rom_DB5C,
+    [0xDB5F - ROM_START] = rom_DB5F,
+    [0xDB62 - ROM_START] = rom_DB62,
+    [0xDB6A - ROM_START] = rom_DB6A,
+    [0xDB6D - ROM_START] = rom_DB6D,
+    [0xDB71 - ROM_START] = rom_DB71,
+    [0xDB76 - ROM_START] = rom_DB76,
+    [0xDB79 - ROM_START] = rom_DB79,
+    [0xDB7D - ROM_START] = rom_DB7D,
+    [0xDB80 - ROM_START] = rom_DB80,
+    [0xDB86 - ROM_START] = rom_DB86,
+    [0xDB88 - ROM_START] = rom_DB88,
+    [0xDB8C - ROM_START] = rom_DB8C,
+    [0xDB95 - ROM_START] = rom_DB95,
+    [0xDB98 - ROM_START] = rom_DB98,
+    [0xDB9C - ROM_START] = rom_DB9C,
+    [0xDB9F - ROM_START] = rom_DB9F,
+    [0xDBA2 - ROM_START] = rom_DBA2,
+    [0xDBA5 - ROM_START] = rom_DBA5,
+    [0xDBC6 - ROM_START] = rom_DBC6,
+    [0xDBCC - ROM_START] = rom_DBCC,
+    [0xDBDE - ROM_START] = rom_DBDE,
+    [0xDBE1 - ROM_START] = rom_DBE1,
+    [0xDBE5 - ROM_START] = rom_DBE5,
+    [0xDBFC - ROM_START] = rom_DBFC,
+    [0xDC06 - ROM_START] = rom_DC06,
+    [0xDC1E - ROM_START] = rom_DC1E,
+    [0xDC21 - ROM_START] = rom_DC21,
+    [0xDC29 - ROM_START] = rom_DC29,
+    [0xDC40 - ROM_START] = rom_DC40,
+    [0xDC46 - ROM_START] = rom_DC46,
+    [0xDC4B - ROM_START] = rom_DC4B,
+    [0xDC4E - ROM_START] = rom_DC4E,
+    [0xDC5A - ROM_START] = rom_DC5A,
+    [0xDC60 - ROM_START] = rom_DC60,
+    [0xDC65 - ROM_START] = rom_DC65,
+    [0xDC6A - ROM_START] = rom_DC6A,
+    [0xDC7C - ROM_START] = rom_DC7C,
+    [0xDC7E - ROM_START] = rom_DC7E,
+    [0xDC81 - ROM_START] = rom_DC81,
+    [0xDC92 - ROM_START] = rom_DC92,
+    [0xDC95 - ROM_START] = rom_DC95,
+    [0xDC98 - ROM_START] = rom_DC98,
+    [0xDCA3 - ROM_START] = rom_DCA3,
+    [0xDCA6 - ROM_START] = rom_DCA6,
+    [0xDCA9 - ROM_START] = rom_DCA9,
+    [0xDCAC - ROM_START] = rom_DCAC,
+    [0xDCB6 - ROM_START] = rom_DCB6,
+    [0xDCDA - ROM_START] = rom_DCDA,
+    [0xDCDD - ROM_START] = rom_DCDD,
+    [0xDCE2 - ROM_START] = rom_DCE2,
+    [0xDCE5 - ROM_START] = rom_DCE5,
+    [0xDCE8 - ROM_START] = rom_DCE8,
+    [0xDCF8 - ROM_START] = rom_DCF8,
+    [0xDCFD - ROM_START] = rom_DCFD,
+    [0xDD11 - ROM_START] = rom_DD11,
+    [0xDD13 - ROM_START] = rom_DD13,
+    [0xDD16 - ROM_START] = rom_DD16,
+    [0xDD1D - ROM_START] = rom_DD1D,
+    [0xDD20 - ROM_START] = rom_DD20,
+    [0xDD31 - ROM_START] = rom_DD31,
+    [0xDD36 - ROM_START] = rom_DD36,
+    [0xDD3B - ROM_START] = rom_DD3B,
+    [0xDD40 - ROM_START] = rom_DD40,
+    [0xDD45 - ROM_START] = rom_DD45,
+    [0xDD4B - ROM_START] = rom_DD4B,
+    [0xDD50 - ROM_START] = rom_DD50,
+    [0xDD55 - ROM_START] = rom_DD55,
+    [0xDD5A - ROM_START] = rom_DD5A,
+    [0xDD5D - ROM_START] = rom_DD5D,
+    [0xDD62 - ROM_START] = rom_DD62,
+    [0xDD67 - ROM_START] = rom_DD67,
+    [0xDD6A - ROM_START] = rom_DD6A,
+    [0xDD6D - ROM_START] = rom_DD6D,
+    [0xDD72 - ROM_START] = rom_DD72,
+    [0xDD7E - ROM_START] = rom_DD7E,
+    [0xDD81 - ROM_START] = rom_DD81,
+    [0xDD84 - ROM_START] = rom_DD84,
+    [0xDD87 - ROM_START] = rom_DD87,
+    [0xDD8A - ROM_START] = rom_DD8A,
+    [0xDD8D - ROM_START] = rom_DD8D,
+    [0xDD97 - ROM_START] = rom_DD97,
+    [0xDD9D - ROM_START] = rom_DD9D,
+    [0xDDA3 - ROM_START] = rom_DDA3,
+    [0xDDA6 - ROM_START] = rom_DDA6,
+    [0xDDAB - ROM_START] = rom_DDAB,
+    [0xDDAE - ROM_START] = rom_DDAE,
+    [0xDDF1 - ROM_START] = rom_DDF1,
+    [0xDDF4 - ROM_START] = rom_DDF4,
+    [0xDDF6 - ROM_START] = rom_DDF6,
+    [0xDDF9 - ROM_START] = rom_DDF9,
+    [0xDDFC - ROM_START] = rom_DDFC,
+    [0xDDFD - ROM_START] = rom_DDFD,
+    [0xDE00 - ROM_START] = rom_DE00,
+    [0xDE0C - ROM_START] = rom_DE0C,
+    [0xDE0F - ROM_START] = rom_DE0F,
+    [0xDE19 - ROM_START] = rom_DE19,
+    [0xDE1C - ROM_START] = rom_DE1C,
+    [0xDE2B - ROM_START] = rom_DE2B,
+    [0xDE2E - ROM_START] = rom_DE2E,
+    [0xDE3B - ROM_START] = rom_DE3B,
+    [0xDE3E - ROM_START] = rom_DE3E,
+    [0xDE41 - ROM_START] = rom_DE41,
+    [0xDE50 - ROM_START] = rom_DE50,
+    [0xDE57 - ROM_START] = rom_DE57,
+    [0xDE5E - ROM_START] = rom_DE5E,
+    [0xDE65 - ROM_START] = rom_DE65,
+    [0xDE6C - ROM_START] = rom_DE6C,
+    [0xDE73 - ROM_START] = rom_DE73,
+    [0xDE75 - ROM_START] = rom_DE75,
+    [0xDE7F - ROM_START] = rom_DE7F,
+    [0xDE82 - ROM_START] = rom_DE82,
+    [0xDE85 - ROM_START] = rom_DE85,
+    [0xDE8B - ROM_START] = rom_DE8B,
+    [0xDE8E - ROM_START] = rom_DE8E,
+    [0xDE91 - ROM_START] = rom_DE91,
+    [0xDE92 - ROM_START] = rom_DE92,
+    [0xDE95 - ROM_START] = rom_DE95,
+    [0xDE9A - ROM_START] = rom_DE9A,
+    [0xDE9D - ROM_START] = rom_DE9D,
+    [0xDEA2 - ROM_START] = rom_DEA2,
+    [0xDEA5 - ROM_START] = rom_DEA5,
+    [0xDEB9 - ROM_START] = rom_DEB9,
+    [0xDEC0 - ROM_START] = rom_DEC0,
+    [0xDEC1 - ROM_START] = rom_DEC1,
+    [0xDECC - ROM_START] = rom_DECC,
+    [0xDED1 - ROM_START] = rom_DED1,
+    [0xDED2 - ROM_START] = rom_DED2,
+    [0xDED7 - ROM_START] = rom_DED7,
+    [0xDEDC - ROM_START] = rom_DEDC,
+    [0xDEE9 - ROM_START] = rom_DEE9,
+    [0xDEED - ROM_START] = rom_DEED,
+    [0xDEF8 - ROM_START] = rom_DEF8,
+    [0xDEFB - ROM_START] = rom_DEFB,
+    [0xDEFD - ROM_START] = rom_DEFD,
+    [0xDEFF - ROM_START] = rom_DEFF,
+    [0xDF06 - ROM_START] = rom_DF06,
+    [0xDF09 - ROM_START] = rom_DF09,
+    [0xDF0B - ROM_START] = rom_DF0B,
+    [0xDF0E - ROM_START] = rom_DF0E,
+    [0xDF12 - ROM_START] = rom_DF12,
+    [0xDF17 - ROM_START] = rom_DF17,
+    [0xDF1B - ROM_START] = rom_DF1B,
+    [0xDF21 - ROM_START] = rom_DF21,
+    [0xDF25 - ROM_START] = rom_DF25,
+    [0xDF40 - ROM_START] = rom_DF40,
+    [0xDF45 - ROM_START] = rom_DF45,
+    [0xDF4C - ROM_START] = rom_DF4C,
+    [0xDF51 - ROM_START] = rom_DF51,
+    [0xDF54 - ROM_START] = rom_DF54,
+    [0xDF5A - ROM_START] = rom_DF5A,
+    [0xDF5C - ROM_START] = rom_DF5C,
+    [0xDF63 - ROM_START] = rom_DF63,
+    [0xDF65 - ROM_START] = rom_DF65,
+    [0xDF66 - ROM_START] = rom_DF66,
+    [0xDF69 - ROM_START] = rom_DF69,
+    [0xDF6D - ROM_START] = rom_DF6D,
+    [0xDF73 - ROM_START] = rom_DF73,
+    [0xDF77 - ROM_START] = rom_DF77,
+    [0xDF7B - ROM_START] = rom_DF7B,
+    [0xDF81 - ROM_START] = rom_DF81,
+    [0xDF8B - ROM_START] = rom_DF8B,
+    [0xDF8F - ROM_START] = rom_DF8F,
+    [0xDF93 - ROM_START] = rom_DF93,
+    [0xDF99 - ROM_START] = rom_DF99,
+    [0xDF9B - ROM_START] = rom_DF9B,
+    [0xDF9E - ROM_START] = rom_DF9E,
+    [0xDFA7 - ROM_START] = rom_DFA7,
+    [0xDFB0 - ROM_START] = rom_DFB0,
+    [0xDFB7 - ROM_START] = rom_DFB7,
+    [0xDFBD - ROM_START] = rom_DFBD,
+    [0xDFBF - ROM_START] = rom_DFBF,
+    [0xDFC2 - ROM_START] = rom_DFC2,
+    [0xDFCA - ROM_START] = rom_DFCA,
+    [0xDFCD - ROM_START] = rom_DFCD,
+    [0xDFD0 - ROM_START] = rom_DFD0,
+    [0xDFD5 - ROM_START] = rom_DFD5,
+    [0xDFDA - ROM_START] = rom_DFDA,
+    [0xDFDC - ROM_START] = rom_DFDC,
+    [0xDFE2 - ROM_START] = rom_DFE2,
+    [0xDFE4 - ROM_START] = rom_DFE4,
+    [0xDFEA - ROM_START] = rom_DFEA,
+    [0xDFED - ROM_START] = rom_DFED,
+    [0xDFF3 - ROM_START] = rom_DFF3,
+    [0xDFF6 - ROM_START] = rom_DFF6,
+    [0xDFFD - ROM_START] = rom_DFFD,
+    [0xE006 - ROM_START] = rom_E006,
+    [0xE009 - ROM_START] = rom_E009,
+    [0xE00C - ROM_START] = rom_E00C,
+    [0xE011 - ROM_START] = rom_E011,
+    [0xE013 - ROM_START] = rom_E013,
+    [0xE018 - ROM_START] = rom_E018,
+    [0xE01D - ROM_START] = rom_E01D,
+    [0xE020 - ROM_START] = rom_E020,
+    [0xE02A - ROM_START] = rom_E02A,
+    [0xE02D - ROM_START] = rom_E02D,
+    [0xE034 - ROM_START] = rom_E034,
+    [0xE035 - ROM_START] = rom_E035,
+    [0xE03C - ROM_START] = rom_E03C,
+    [0xE03F - ROM_START] = rom_E03F,
+    [0xE042 - ROM_START] = rom_E042,
+    [0xE045 - ROM_START] = rom_E045,
+    [0xE047 - ROM_START] = rom_E047,
+    [0xE04A - ROM_START] = rom_E04A,
+    [0xE04D - ROM_START] = rom_E04D,
+    [0xE052 - ROM_START] = rom_E052,
+    [0xE055 - ROM_START] = rom_E055,
+    [0xE057 - ROM_START] = rom_E057,
+    [0xE05A - ROM_START] = rom_E05A,
+    [0xE05D - ROM_START] = rom_E05D,
+    [0xE060 - ROM_START] = rom_E060,
+    [0xE063 - ROM_START] = rom_E063,
+    [0xE065 - ROM_START] = rom_E065,
+    [0xE068 - ROM_START] = rom_E068,
+    [0xE06B - ROM_START] = rom_E06B,
+    [0xE06E - ROM_START] = rom_E06E,
+    [0xE072 - ROM_START] = rom_E072,
+    [0xE075 - ROM_START] = rom_E075,
+    [0xE078 - ROM_START] = rom_E078,
+    [0xE07B - ROM_START] = rom_E07B,
+    [0xE07C - ROM_START] = rom_E07C,
+    [0xE07F - ROM_START] = rom_E07F,
+    [0xE082 - ROM_START] = rom_E082,
+    [0xE08D - ROM_START] = rom_E08D,
+    [0xE094 - ROM_START] = rom_E094,
+    [0xE096 - ROM_START] = rom_E096,
+    [0xE09E - ROM_START] = rom_E09E,
+    [0xE0A3 - ROM_START] = rom_E0A3,
+    [0xE0A7 - ROM_START] = rom_E0A7,
+    [0xE0AA - ROM_START] = rom_E0AA,
+    [0xE0AB - ROM_START] = rom_E0AB,
+    [0xE0B0 - ROM_START] = rom_E0B0,
+    [0xE0B2 - ROM_START] = rom_E0B2,
+    [0xE0B7 - ROM_START] = rom_E0B7,
+    [0xE0BB - ROM_START] = rom_E0BB,
+    [0xE0BC - ROM_START] = rom_E0BC,
+    [0xE0C1 - ROM_START] = rom_E0C1,
+    [0xE0C3 - ROM_START] = rom_E0C3,
+    [0xE0C8 - ROM_START] = rom_E0C8,
+    [0xE0CB - ROM_START] = rom_E0CB,
+    [0xE0CE - ROM_START] = rom_E0CE,
+    [0xE0D3 - ROM_START] = rom_E0D3,
+    [0xE0D6 - ROM_START] = rom_E0D6,
+    [0xE0D9 - ROM_START] = rom_E0D9,
+    [0xE0DD - ROM_START] = rom_E0DD,
+    [0xE0E1 - ROM_START] = rom_E0E1,
+    [0xE0E2 - ROM_START] = rom_E0E2,
+    [0xE0E8 - ROM_START] = rom_E0E8,
+    [0xE0F0 - ROM_START] = rom_E0F0,
+    [0xE0F3 - ROM_START] = rom_E0F3,
+    [0xE0F8 - ROM_START] = rom_E0F8,
+    [0xE0FA - ROM_START] = rom_E0FA,
+    [0xE101 - ROM_START] = rom_E101,
+    [0xE104 - ROM_START] = rom_E104,
+    [0xE105 - ROM_START] = rom_E105,
+    [0xE10A - ROM_START] = rom_E10A,
+    [0xE10D - ROM_START] = rom_E10D,
+    [0xE115 - ROM_START] = rom_E115,
+    [0xE118 - ROM_START] = rom_E118,
+    [0xE120 - ROM_START] = rom_E120,
+    [0xE125 - ROM_START] = rom_E125,
+    [0xE127 - ROM_START] = rom_E127,
+    [0xE12A - ROM_START] = rom_E12A,
+    [0xE131 - ROM_START] = rom_E131,
+    [0xE135 - ROM_START] = rom_E135,
+    [0xE138 - ROM_START] = rom_E138,
+    [0xE13B - ROM_START] = rom_E13B,
+    [0xE13D - ROM_START] = rom_E13D,
+    [0xE14C - ROM_START] = rom_E14C,
+    [0xE14D - ROM_START] = rom_E14D,
+    [0xE153 - ROM_START] = rom_E153,
+    [0xE156 - ROM_START] = rom_E156,
+    [0xE159 - ROM_START] = rom_E159,
+    [0xE15E - ROM_START] = rom_E15E,
+    [0xE16E - ROM_START] = rom_E16E,
+    [0xE17A - ROM_START] = rom_E17A,
+    [0xE17E - ROM_START] = rom_E17E,
+    [0xE185 - ROM_START] = rom_E185,
+    [0xE18B - ROM_START] = rom_E18B,
+    [0xE18D - ROM_START] = rom_E18D,
+    [0xE190 - ROM_START] = rom_E190,
+    [0xE193 - ROM_START] = rom_E193,
+    [0xE195 - ROM_START] = rom_E195,
+    [0xE19D - ROM_START] = rom_E19D,
+    [0xE1A0 - ROM_START] = rom_E1A0,
+    [0xE1A4 - ROM_START] = rom_E1A4,
+    [0xE1A7 - ROM_START] = rom_E1A7,
+    [0xE1A9 - ROM_START] = rom_E1A9,
+    [0xE1AC - ROM_START] = rom_E1AC,
+    [0xE1B2 - ROM_START] = rom_E1B2,
+    [0xE1B5 - ROM_START] = rom_E1B5,
+    [0xE1B7 - ROM_START] = rom_E1B7,
+    [0xE1BB - ROM_START] = rom_E1BB,
+    [0xE1C0 - ROM_START] = rom_E1C0,
+    [0xE1C4 - ROM_START] = rom_E1C4,
+    [0xE1C8 - ROM_START] = rom_E1C8,
+    [0xE1CB - ROM_START] = rom_E1CB,
+    [0xE1CE - ROM_START] = rom_E1CE,
+    [0xE1D8 - ROM_START] = rom_E1D8,
+    [0xE1DC - ROM_START] = rom_E1DC,
+    [0xE1E0 - ROM_START] = rom_E1E0,
+    [0xE1E6 - ROM_START] = rom_E1E6,
+    [0xE1EF - ROM_START] = rom_E1EF,
+    [0xE1F7 - ROM_START] = rom_E1F7,
+    [0xE202 - ROM_START] = rom_E202,
+    [0xE207 - ROM_START] = rom_E207,
+    [0xE20A - ROM_START] = rom_E20A,
+    [0xE212 - ROM_START] = rom_E212,
+    [0xE214 - ROM_START] = rom_E214,
+    [0xE219 - ROM_START] = rom_E219,
+    [0xE21E - ROM_START] = rom_E21E,
+    [0xE221 - ROM_START] = rom_E221,
+    [0xE223 - ROM_START] = rom_E223,
+    [0xE228 - ROM_START] = rom_E228,
+    [0xE243 - ROM_START] = rom_E243,
+    [0xE248 - ROM_START] = rom_E248,
+    [0xE24C - ROM_START] = rom_E24C,
+    [0xE253 - ROM_START] = rom_E253,
+    [0xE258 - ROM_START] = rom_E258,
+    [0xE25B - ROM_START] = rom_E25B,
+    [0xE25D - ROM_START] = rom_E25D,
+    [0xE262 - ROM_START] = rom_E262,
+    [0xE265 - ROM_START] = rom_E265,
+    [0xE268 - ROM_START] = rom_E268,
+    [0xE26D - ROM_START] = rom_E26D,
+    [0xE26F - ROM_START] = rom_E26F,
+    [0xE272 - ROM_START] = rom_E272,
+    [0xE275 - ROM_START] = rom_E275,
+    [0xE278 - ROM_START] = rom_E278,
+    [0xE27D - ROM_START] = rom_E27D,
+    [0xE286 - ROM_START] = rom_E286,
+    [0xE289 - ROM_START] = rom_E289,
+    [0xE28E - ROM_START] = rom_E28E,
+    [0xE291 - ROM_START] = rom_E291,
+    [0xE294 - ROM_START] = rom_E294,
+    [0xE29C - ROM_START] = rom_E29C,
+    [0xE2A7 - ROM_START] = rom_E2A7,
+    [0xE2A9 - ROM_START] = rom_E2A9,
+    [0xE2AA - ROM_START] = rom_E2AA,
+    [0xE2AD - ROM_START] = rom_E2AD,
+    [0xE2B0 - ROM_START] = rom_E2B0,
+    [0xE2B4 - ROM_START] = rom_E2B4,
+    [0xE2B7 - ROM_START] = rom_E2B7,
+    [0xE2B9 - ROM_START] = rom_E2B9,
+    [0xE2BC - ROM_START] = rom_E2BC,
+    [0xE2BF - ROM_START] = rom_E2BF,
+    [0xE2C2 - ROM_START] = rom_E2C2,
+    [0xE2D0 - ROM_START] = rom_E2D0,
+    [0xE2D3 - ROM_START] = rom_E2D3,
+    [0xE2DB - ROM_START] = rom_E2DB,
+    [0xE2DC - ROM_START] = rom_E2DC,
+    [0xE2E2 - ROM_START] = rom_E2E2,
+    [0xE2E5 - ROM_START] = rom_E2E5,
+    [0xE2E9 - ROM_START] = rom_E2E9,
+    [0xE2EE - ROM_START] = rom_E2EE,
+    [0xE2F1 - ROM_START] = rom_E2F1,
+    [0xE2FB - ROM_START] = rom_E2FB,
+    [0xE2FD - ROM_START] = rom_E2FD,
+    [0xE2FF - ROM_START] = rom_E2FF,
+    [0xE303 - ROM_START] = rom_E303,
+    [0xE304 - ROM_START] = rom_E304,
+    [0xE30B - ROM_START] = rom_E30B,
+    [0xE310 - ROM_START] = rom_E310,
+    [0xE312 - ROM_START] = rom_E312,
+    [0xE318 - ROM_START] = rom_E318,
+    [0xE31B - ROM_START] = rom_E31B,
+    [0xE31C - ROM_START] = rom_E31C,
+    [0xE31F - ROM_START] = rom_E31F,
+    [0xE322 - ROM_START] = rom_E322,
+    [0xE325 - ROM_START] = rom_E325,
+    [0xE328 - ROM_START] = rom_E328,
+    [0xE33B - ROM_START] = rom_E33B,
+    [0xE33E - ROM_START] = rom_E33E,
+    [0xE349 - ROM_START] = rom_E349,
+    [0xE34F - ROM_START] = rom_E34F,
+    [0xE355 - ROM_START] = rom_E355,
+    [0xE35D - ROM_START] = rom_E35D,
+    [0xE363 - ROM_START] = rom_E363,
+    [0xE368 - ROM_START] = rom_E368,
+    [0xE36F - ROM_START] = rom_E36F,
+    [0xE372 - ROM_START] = rom_E372,
+    [0xE384 - ROM_START] = rom_E384,
+    [0xE388 - ROM_START] = rom_E388,
+    [0xE38D - ROM_START] = rom_E38D,
+    [0xE38F - ROM_START] = rom_E38F,
+    [0xE394 - ROM_START] = rom_E394,
+    [0xE396 - ROM_START] = rom_E396,
+    [0xE39D - ROM_START] = rom_E39D,
+    [0xE3A2 - ROM_START] = rom_E3A2,
+    [0xE3AC - ROM_START] = rom_E3AC,
+    [0xE3AF - ROM_START] = rom_E3AF,
+    [0xE3B3 - ROM_START] = rom_E3B3,
+    [0xE3B6 - ROM_START] = rom_E3B6,
+    [0xE3B9 - ROM_START] = rom_E3B9,
+    [0xE3BC - ROM_START] = rom_E3BC,
+    [0xE3BF - ROM_START] = rom_E3BF,
+    [0xE3C2 - ROM_START] = rom_E3C2,
+    [0xE3C5 - ROM_START] = rom_E3C5,
+    [0xE3C8 - ROM_START] = rom_E3C8,
+    [0xE3CB - ROM_START] = rom_E3CB,
+    [0xE3CE - ROM_START] = rom_E3CE,
+    [0xE3D1 - ROM_START] = rom_E3D1,
+    [0xE3D4 - ROM_START] = rom_E3D4,
+    [0xE3D7 - ROM_START] = rom_E3D7,
+    [0xE3DA - ROM_START] = rom_E3DA,
+    [0xE3E3 - ROM_START] = rom_E3E3,
+    [0xE3EC - ROM_START] = rom_E3EC,
+    [0xE3EF - ROM_START] = rom_E3EF,
+    [0xE3F2 - ROM_START] = rom_E3F2,
+    [0xE3F7 - ROM_START] = rom_E3F7,
+    [0xE3F9 - ROM_START] = rom_E3F9,
+    [0xE3FD - ROM_START] = rom_E3FD,
+    [0xE401 - ROM_START] = rom_E401,
+    [0xE409 - ROM_START] = rom_E409,
+    [0xE40F - ROM_START] = rom_E40F,
+    [0xE412 - ROM_START] = rom_E412,
+    [0xE416 - ROM_START] = rom_E416,
+    [0xE418 - ROM_START] = rom_E418,
+    [0xE41B - ROM_START] = rom_E41B,
+    [0xE421 - ROM_START] = rom_E421,
+    [0xE430 - ROM_START] = rom_E430,
+    [0xE433 - ROM_START] = rom_E433,
+    [0xE436 - ROM_START] = rom_E436,
+    [0xE439 - ROM_START] = rom_E439,
+    [0xE43C - ROM_START] = rom_E43C,
+    [0xE43F - ROM_START] = rom_E43F,
+    [0xE441 - ROM_START] = rom_E441,
+    [0xE444 - ROM_START] = rom_E444,
+    [0xE449 - ROM_START] = rom_E449,
+    [0xE44E - ROM_START] = rom_E44E,
+    [0xE451 - ROM_START] = rom_E451,
+    [0xE454 - ROM_START] = rom_E454,
+    [0xE457 - ROM_START] = rom_E457,
+    [0xE45A - ROM_START] = rom_E45A,
+    [0xE45E - ROM_START] = rom_E45E,
+    [0xE46A - ROM_START] = rom_E46A,
+    [0xE46F - ROM_START] = rom_E46F,
+    [0xE479 - ROM_START] = rom_E479,
+    [0xE4A6 - ROM_START] = rom_E4A6,
+    [0xE4A9 - ROM_START] = rom_E4A9,
+    [0xE4AC - ROM_START] = rom_E4AC,
+    [0xE4B4 - ROM_START] = rom_E4B4,
+    [0xE4C3 - ROM_START] = rom_E4C3,
+    [0xE4D1 - ROM_START] = rom_E4D1,
+    [0xE4D4 - ROM_START] = rom_E4D4,
+    [0xE4D9 - ROM_START] = rom_E4D9,
+    [0xE4DE - ROM_START] = rom_E4DE,
+    [0xE4F0 - ROM_START] = rom_E4F0,
+    [0xE4F3 - ROM_START] = rom_E4F3,
+    [0xE4F9 - ROM_START] = rom_E4F9,
+    [0xE60A - ROM_START] = rom_E60A,
+    [0xE61D - ROM_START] = rom_E61D,
+    [0xE621 - ROM_START] = rom_E621,
+    [0xE625 - ROM_START] = rom_E625,
+    [0xE627 - ROM_START] = rom_E627,
+    [0xE62D - ROM_START] = rom_E62D,
+    [0xE635 - ROM_START] = rom_E635,
+    [0xE63E - ROM_START] = rom_E63E,
+    [0xE641 - ROM_START] = rom_E641,
+    [0xE644 - ROM_START] = rom_E644,
+    [0xE645 - ROM_START] = rom_E645,
+    [0xE648 - ROM_START] = rom_E648,
+    [0xE64B - ROM_START] = rom_E64B,
+    [0xE653 - ROM_START] = rom_E653,
+    [0xE656 - ROM_START] = rom_E656,
+    [0xE667 - ROM_START] = rom_E667,
+    [0xE66C - ROM_START] = rom_E66C,
+    [0xE670 - ROM_START] = rom_E670,
+    [0xE679 - ROM_START] = rom_E679,
+    [0xE680 - ROM_START] = rom_E680,
+    [0xE683 - ROM_START] = rom_E683,
+    [0xE686 - ROM_START] = rom_E686,
+    [0xE688 - ROM_START] = rom_E688,
+    [0xE68B - ROM_START] = rom_E68B,
+    [0xE68E - ROM_START] = rom_E68E,
+    [0xE691 - ROM_START] = rom_E691,
+    [0xE695 - ROM_START] = rom_E695,
+    [0xE698 - ROM_START] = rom_E698,
+    [0xE69B - ROM_START] = rom_E69B,
+    [0xE69F - ROM_START] = rom_E69F,
+    [0xE6A3 - ROM_START] = rom_E6A3,
+    [0xE6AA - ROM_START] = rom_E6AA,
+    [0xE6AB - ROM_START] = rom_E6AB,
+    [0xE6B3 - ROM_START] = rom_E6B3,
+    [0xE6B4 - ROM_START] = rom_E6B4,
+    [0xE6BC - ROM_START] = rom_E6BC,
+    [0xE6BF - ROM_START] = rom_E6BF,
+    [0xE6C1 - ROM_START] = rom_E6C1,
+    [0xE6C7 - ROM_START] = rom_E6C7,
+    [0xE6D4 - ROM_START] = rom_E6D4,
+    [0xE6E3 - ROM_START] = rom_E6E3,
+    [0xE6ED - ROM_START] = rom_E6ED,
+    [0xE6F7 - ROM_START] = rom_E6F7,
+    [0xE706 - ROM_START] = rom_E706,
+    [0xE718 - ROM_START] = rom_E718,
+    [0xE71C - ROM_START] = rom_E71C,
+    [0xE720 - ROM_START] = rom_E720,
+    [0xE722 - ROM_START] = rom_E722,
+    [0xE725 - ROM_START] = rom_E725,
+    [0xE727 - ROM_START] = rom_E727,
+    [0xE72D - ROM_START] = rom_E72D,
+    [0xE72F - ROM_START] = rom_E72F,
+    [0xE735 - ROM_START] = rom_E735,
+    [0xE739 - ROM_START] = rom_E739,
+    [0xE73D - ROM_START] = rom_E73D,
+    [0xE740 - ROM_START] = rom_E740,
+    [0xE742 - ROM_START] = rom_E742,
+    [0xE745 - ROM_START] = rom_E745,
+    [0xE748 - ROM_START] = rom_E748,
+    [0xE74A - ROM_START] = rom_E74A,
+    [0xE74D - ROM_START] = rom_E74D,
+    [0xE754 - ROM_START] = rom_E754,
+    [0xE758 - ROM_START] = rom_E758,
+    [0xE762 - ROM_START] = rom_E762,
+    [0xE763 - ROM_START] = rom_E763,
+    [0xE767 - ROM_START] = rom_E767,
+    [0xE76B - ROM_START] = rom_E76B,
+    [0xE76D - ROM_START] = rom_E76D,
+    [0xE775 - ROM_START] = rom_E775,
+    [0xE778 - ROM_START] = rom_E778,
+    [0xE77C - ROM_START] = rom_E77C,
+    [0xE77E - ROM_START] = rom_E77E,
+    [0xE77F - ROM_START] = rom_E77F,
+    [0xE780 - ROM_START] = rom_E780,
+    [0xE788 - ROM_START] = rom_E788,
+    [0xE78D - ROM_START] = rom_E78D,
+    #if !IDLE_SKIP
+    [0xE78E - ROM_START] = rom_E78E,
+    #endif
+    [0xE795 - ROM_START] = rom_E795,
+    [0xE7A8 - ROM_START] = rom_E7A8,
+    [0xE7AB - ROM_START] = rom_E7AB,
+    [0xE7BB - ROM_START] = rom_E7BB,
+    [0xE7C0 - ROM_START] = rom_E7C0,
+    [0xE7C5 - ROM_START] = rom_E7C5,
+    [0xE7D8 - ROM_START] = rom_E7D8,
+    [0xE7DF - ROM_START] = rom_E7DF,
+    [0xE7E4 - ROM_START] = rom_E7E4,
+    [0xE7E7 - ROM_START] = rom_E7E7,
+    [0xE7EC - ROM_START] = rom_E7EC,
+    [0xE7F0 - ROM_START] = rom_E7F0,
+    [0xE7FA - ROM_START] = rom_E7FA,
+    [0xE7FD - ROM_START] = rom_E7FD,
+    [0xE802 - ROM_START] = rom_E802,
+    [0xE805 - ROM_START] = rom_E805,
+    [0xE80C - ROM_START] = rom_E80C,
+    [0xE815 - ROM_START] = rom_E815,
+    [0xE817 - ROM_START] = rom_E817,
+    [0xE81B - ROM_START] = rom_E81B,
+    [0xE81E - ROM_START] = rom_E81E,
+    [0xE824 - ROM_START] = rom_E824,
+    [0xE827 - ROM_START] = rom_E827,
+    [0xE82C - ROM_START] = rom_E82C,
+    [0xE830 - ROM_START] = rom_E830,
+    [0xE839 - ROM_START] = rom_E839,
+    [0xE83C - ROM_START] = rom_E83C,
+    [0xE840 - ROM_START] = rom_E840,
+    [0xE843 - ROM_START] = rom_E843,
+    [0xE848 - ROM_START] = rom_E848,
+    [0xE84B - ROM_START] = rom_E84B,
+    [0xE853 - ROM_START] = rom_E853,
+    [0xE85B - ROM_START] = rom_E85B,
+    [0xE870 - ROM_START] = rom_E870,
+    [0xE873 - ROM_START] = rom_E873,
+    [0xE87B - ROM_START] = rom_E87B,
+    [0xE880 - ROM_START] = rom_E880,
+    [0xE884 - ROM_START] = rom_E884,
+    [0xE887 - ROM_START] = rom_E887,
+    [0xE88B - ROM_START] = rom_E88B,
+    [0xE891 - ROM_START] = rom_E891,
+    [0xE895 - ROM_START] = rom_E895,
+    [0xE89B - ROM_START] = rom_E89B,
+    [0xE89F - ROM_START] = rom_E89F,
+    [0xE8A9 - ROM_START] = rom_E8A9,
+    [0xE8AD - ROM_START] = rom_E8AD,
+    [0xE8B7 - ROM_START] = rom_E8B7,
+    [0xE8BE - ROM_START] = rom_E8BE,
+    [0xE8CD - ROM_START] = rom_E8CD,
+    [0xE8D1 - ROM_START] = rom_E8D1,
+    [0xE8D2 - ROM_START] = rom_E8D2,
+    [0xE8D7 - ROM_START] = rom_E8D7,
+    [0xE8E7 - ROM_START] = rom_E8E7,
+    [0xE8EA - ROM_START] = rom_E8EA,
+    [0xE8ED - ROM_START] = rom_E8ED,
+    [0xE8F1 - ROM_START] = rom_E8F1,
+    [0xE8F4 - ROM_START] = rom_E8F4,
+    [0xE8F7 - ROM_START] = rom_E8F7,
+    [0xE8FA - ROM_START] = rom_E8FA,
+    [0xE8FD - ROM_START] = rom_E8FD,
+    [0xE902 - ROM_START] = rom_E902,
+    [0xE907 - ROM_START] = rom_E907,
+    [0xE909 - ROM_START] = rom_E909,
+    [0xE90D - ROM_START] = rom_E90D,
+    [0xE90F - ROM_START] = rom_E90F,
+    [0xE915 - ROM_START] = rom_E915,
+    [0xE916 - ROM_START] = rom_E916,
+    [0xE919 - ROM_START] = rom_E919,
+    [0xE91C - ROM_START] = rom_E91C,
+    [0xE922 - ROM_START] = rom_E922,
+    [0xE925 - ROM_START] = rom_E925,
+    [0xE928 - ROM_START] = rom_E928,
+    [0xE92B - ROM_START] = rom_E92B,
+    [0xE92F - ROM_START] = rom_E92F,
+    [0xE937 - ROM_START] = rom_E937,
+    [0xE93A - ROM_START] = rom_E93A,
+    [0xE93D - ROM_START] = rom_E93D,
+    [0xE941 - ROM_START] = rom_E941,
+    [0xE944 - ROM_START] = rom_E944,
+    [0xE947 - ROM_START] = rom_E947,
+    [0xE94B - ROM_START] = rom_E94B,
+    [0xE94E - ROM_START] = rom_E94E,
+    [0xE951 - ROM_START] = rom_E951,
+    [0xE954 - ROM_START] = rom_E954,
+    [0xE958 - ROM_START] = rom_E958,
+    [0xE95C - ROM_START] = rom_E95C,
+    [0xE95F - ROM_START] = rom_E95F,
+    [0xE963 - ROM_START] = rom_E963,
+    [0xE96E - ROM_START] = rom_E96E,
+    [0xE971 - ROM_START] = rom_E971,
+    [0xE973 - ROM_START] = rom_E973,
+    [0xE976 - ROM_START] = rom_E976,
+    [0xE979 - ROM_START] = rom_E979,
+    [0xE97D - ROM_START] = rom_E97D,
+    [0xE980 - ROM_START] = rom_E980,
+    [0xE983 - ROM_START] = rom_E983,
+    [0xE987 - ROM_START] = rom_E987,
+    [0xE98A - ROM_START] = rom_E98A,
+    [0xE98D - ROM_START] = rom_E98D,
+    [0xE991 - ROM_START] = rom_E991,
+    [0xE995 - ROM_START] = rom_E995,
+    [0xE999 - ROM_START] = rom_E999,
+    [0xE99C - ROM_START] = rom_E99C,
+    [0xE9A5 - ROM_START] = rom_E9A5,
+    [0xE9AE - ROM_START] = rom_E9AE,
+    [0xE9B7 - ROM_START] = rom_E9B7,
+    #if !IDLE_SKIP
+    [0xE9C0 - ROM_START] = rom_E9C0,
+    #endif
+    [0xE9C8 - ROM_START] = rom_E9C8,
+    [0xE9C9 - ROM_START] = rom_E9C9,
+    [0xE9CD - ROM_START] = rom_E9CD,
+    [0xE9D0 - ROM_START] = rom_E9D0,
+    [0xE9D3 - ROM_START] = rom_E9D3,
+    [0xE9D7 - ROM_START] = rom_E9D7,
+    [0xE9DA - ROM_START] = rom_E9DA,
+    [0xE9DF - ROM_START] = rom_E9DF,
+    [0xE9E2 - ROM_START] = rom_E9E2,
+    [0xE9E9 - ROM_START] = rom_E9E9,
+    [0xE9EC - ROM_START] = rom_E9EC,
+    [0xE9F0 - ROM_START] = rom_E9F0,
+    [0xE9F2 - ROM_START] = rom_E9F2,
+    [0xE9F5 - ROM_START] = rom_E9F5,
+    [0xE9F7 - ROM_START] = rom_E9F7,
+    [0xE9FA - ROM_START] = rom_E9FA,
+    [0xE9FD - ROM_START] = rom_E9FD,
+    [0xEA00 - ROM_START] = rom_EA00,
+    [0xEA03 - ROM_START] = rom_EA03,
+    [0xEA07 - ROM_START] = rom_EA07,
+    #if !IDLE_SKIP
+    [0xEA0B - ROM_START] = rom_EA0B,
+    #endif
+    [0xEA12 - ROM_START] = rom_EA12,
+    [0xEA1A - ROM_START] = rom_EA1A,
+    [0xEA1D - ROM_START] = rom_EA1D,
+    [0xEA20 - ROM_START] = rom_EA20,
+    [0xEA24 - ROM_START] = rom_EA24,
+    [0xEA28 - ROM_START] = rom_EA28,
+    [0xEA2B - ROM_START] = rom_EA2B,
+    [0xEA2E - ROM_START] = rom_EA2E,
+    [0xEA32 - ROM_START] = rom_EA32,
+    [0xEA34 - ROM_START] = rom_EA34,
+    [0xEA39 - ROM_START] = rom_EA39,
+    [0xEA41 - ROM_START] = rom_EA41,
+    [0xEA44 - ROM_START] = rom_EA44,
+    [0xEA47 - ROM_START] = rom_EA47,
+    [0xEA4B - ROM_START] = rom_EA4B,
+    [0xEA4E - ROM_START] = rom_EA4E,
+    [0xEA59 - ROM_START] = rom_EA59,
+    [0xEA5D - ROM_START] = rom_EA5D,
+    [0xEA62 - ROM_START] = rom_EA62,
+    [0xEA63 - ROM_START] = rom_EA63,
+    [0xEA68 - ROM_START] = rom_EA68,
+    [0xEA6B - ROM_START] = rom_EA6B,
+    [0xEA6E - ROM_START] = rom_EA6E,
+    [0xEA71 - ROM_START] = rom_EA71,
+    [0xEA74 - ROM_START] = rom_EA74,
+    [0xEA75 - ROM_START] = rom_EA75,
+    [0xEA7D - ROM_START] = rom_EA7D,
+    [0xEA7E - ROM_START] = rom_EA7E,
+    [0xEA7F - ROM_START] = rom_EA7F,
+    [0xEA83 - ROM_START] = rom_EA83,
+    [0xEA86 - ROM_START] = rom_EA86,
+    [0xEA8E - ROM_START] = rom_EA8E,
+    [0xEA8F - ROM_START] = rom_EA8F,
+    [0xEA90 - ROM_START] = rom_EA90,
+    [0xEA94 - ROM_START] = rom_EA94,
+    [0xEA97 - ROM_START] = rom_EA97,
+    [0xEA9A - ROM_START] = rom_EA9A,
+    [0xEA9E - ROM_START] = rom_EA9E,
+    [0xEAA0 - ROM_START] = rom_EAA0,
+    [0xEAAC - ROM_START] = rom_EAAC,
+    [0xEAB2 - ROM_START] = rom_EAB2,
+    [0xEAB7 - ROM_START] = rom_EAB7,
+    [0xEABC - ROM_START] = rom_EABC,
+    [0xEAC0 - ROM_START] = rom_EAC0,
+    [0xEAC6 - ROM_START] = rom_EAC6,
+    [0xEAC9 - ROM_START] = rom_EAC9,
+    [0xEAD5 - ROM_START] = rom_EAD5,
+    [0xEAD7 - ROM_START] = rom_EAD7,
+    [0xEADC - ROM_START] = rom_EADC,
+    [0xEADF - ROM_START] = rom_EADF,
+    [0xEAE6 - ROM_START] = rom_EAE6,
+    [0xEAEA - ROM_START] = rom_EAEA,
+    [0xEAF2 - ROM_START] = rom_EAF2,
+    [0xEAFB - ROM_START] = rom_EAFB,
+    [0xEB00 - ROM_START] = rom_EB00,
+    [0xEB02 - ROM_START] = rom_EB02,
+    [0xEB04 - ROM_START] = rom_EB04,
+    [0xEB0D - ROM_START] = rom_EB0D,
+    [0xEB17 - ROM_START] = rom_EB17,
+    [0xEB1A - ROM_START] = rom_EB1A,
+    [0xEB1D - ROM_START] = rom_EB1D,
+    [0xEB1F - ROM_START] = rom_EB1F,
+    [0xEB22 - ROM_START] = rom_EB22,
+    [0xEB4F - ROM_START] = rom_EB4F,
+    [0xEB5F - ROM_START] = rom_EB5F,
+    [0xEB76 - ROM_START] = rom_EB76,
+    [0xEB7C - ROM_START] = rom_EB7C,
+    [0xEB7E - ROM_START] = rom_EB7E,
+    [0xEB87 - ROM_START] = rom_EB87,
+    [0xEBBF - ROM_START] = rom_EBBF,
+    [0xEBC2 - ROM_START] = rom_EBC2,
+    [0xEBC5 - ROM_START] = rom_EBC5,
+    [0xEBDA - ROM_START] = rom_EBDA,
+    [0xEBE7 - ROM_START] = rom_EBE7,
+    [0xEBF5 - ROM_START] = rom_EBF5,
+    [0xEBFF - ROM_START] = rom_EBFF,
+    [0xEC04 - ROM_START] = rom_EC04,
+    [0xEC07 - ROM_START] = rom_EC07,
+    [0xEC12 - ROM_START] = rom_EC12,
+    [0xEC1B - ROM_START] = rom_EC1B,
+    [0xEC22 - ROM_START] = rom_EC22,
+    [0xEC2B - ROM_START] = rom_EC2B,
+    [0xEC2F - ROM_START] = rom_EC2F,
+    [0xEC31 - ROM_START] = rom_EC31,
+    [0xEC36 - ROM_START] = rom_EC36,
+    [0xEC3B - ROM_START] = rom_EC3B,
+    [0xEC3E - ROM_START] = rom_EC3E,
+    [0xEC51 - ROM_START] = rom_EC51,
+    [0xEC55 - ROM_START] = rom_EC55,
+    [0xEC58 - ROM_START] = rom_EC58,
+    [0xEC5C - ROM_START] = rom_EC5C,
+    [0xEC62 - ROM_START] = rom_EC62,
+    [0xEC66 - ROM_START] = rom_EC66,
+    [0xEC69 - ROM_START] = rom_EC69,
+    [0xEC6D - ROM_START] = rom_EC6D,
+    [0xEC77 - ROM_START] = rom_EC77,
+    [0xEC7E - ROM_START] = rom_EC7E,
+    [0xEC81 - ROM_START] = rom_EC81,
+    [0xEC86 - ROM_START] = rom_EC86,
+    [0xEC8B - ROM_START] = rom_EC8B,
+    [0xEC90 - ROM_START] = rom_EC90,
+    [0xEC98 - ROM_START] = rom_EC98,
+    [0xEC9E - ROM_START] = rom_EC9E,
+    [0xECA7 - ROM_START] = rom_ECA7,
+    [0xECAC - ROM_START] = rom_ECAC,
+    [0xECB6 - ROM_START] = rom_ECB6,
+    [0xECC1 - ROM_START] = rom_ECC1,
+    [0xECC6 - ROM_START] = rom_ECC6,
+    [0xECCB - ROM_START] = rom_ECCB,
+    [0xECCE - ROM_START] = rom_ECCE,
+    [0xECD4 - ROM_START] = rom_ECD4,
+    [0xECD9 - ROM_START] = rom_ECD9,
+    [0xECDC - ROM_START] = rom_ECDC,
+    [0xECDF - ROM_START] = rom_ECDF,
+    [0xECEA - ROM_START] = rom_ECEA,
+    [0xECEF - ROM_START] = rom_ECEF,
+    [0xECF2 - ROM_START] = rom_ECF2,
+    [0xECF5 - ROM_START] = rom_ECF5,
+    [0xECF7 - ROM_START] = rom_ECF7,
+    [0xECFD - ROM_START] = rom_ECFD,
+    [0xED03 - ROM_START] = rom_ED03,
+    [0xED06 - ROM_START] = rom_ED06,
+    [0xED0B - ROM_START] = rom_ED0B,
+    [0xED0D - ROM_START] = rom_ED0D,
+    [0xED10 - ROM_START] = rom_ED10,
+    [0xED23 - ROM_START] = rom_ED23,
+    [0xED29 - ROM_START] = rom_ED29,
+    [0xED2F - ROM_START] = rom_ED2F,
+    [0xED32 - ROM_START] = rom_ED32,
+    [0xED35 - ROM_START] = rom_ED35,
+    [0xED40 - ROM_START] = rom_ED40,
+    [0xED43 - ROM_START] = rom_ED43,
+    [0xED46 - ROM_START] = rom_ED46,
+    [0xED49 - ROM_START] = rom_ED49,
+    [0xED59 - ROM_START] = rom_ED59,
+    [0xED5B - ROM_START] = rom_ED5B,
+    [0xED61 - ROM_START] = rom_ED61,
+    [0xED66 - ROM_START] = rom_ED66,
+    [0xED67 - ROM_START] = rom_ED67,
+    [0xED6A - ROM_START] = rom_ED6A,
+    [0xED6C - ROM_START] = rom_ED6C,
+    [0xED6D - ROM_START] = rom_ED6D,
+    [0xED76 - ROM_START] = rom_ED76,
+    [0xED7E - ROM_START] = rom_ED7E,
+    [0xED82 - ROM_START] = rom_ED82,
+    [0xEEF4 - ROM_START] = rom_EEF4,
+    [0xEEF7 - ROM_START] = rom_EEF7,
+    [0xEF06 - ROM_START] = rom_EF06,
+    [0xEF07 - ROM_START] = rom_EF07,
+    [0xEF0F - ROM_START] = rom_EF0F,
+    [0xEF16 - ROM_START] = rom_EF16,
+    [0xEF1D - ROM_START] = rom_EF1D,
+    [0xEF24 - ROM_START] = rom_EF24,
+    [0xEF2B - ROM_START] = rom_EF2B,
+    [0xEF34 - ROM_START] = rom_EF34,
+    [0xEF3A - ROM_START] = rom_EF3A,
+    [0xEF3D - ROM_START] = rom_EF3D,
+    [0xEF41 - ROM_START] = rom_EF41,
+    [0xEF4D - ROM_START] = rom_EF4D,
+    [0xEF5F - ROM_START] = rom_EF5F,
+    [0xEF62 - ROM_START] = rom_EF62,
+    [0xEF65 - ROM_START] = rom_EF65,
+    [0xEF6F - ROM_START] = rom_EF6F,
+    [0xEF7F - ROM_START] = rom_EF7F,
+    [0xEF84 - ROM_START] = rom_EF84,
+    [0xEF87 - ROM_START] = rom_EF87,
+    [0xEF88 - ROM_START] = rom_EF88,
+    [0xEF90 - ROM_START] = rom_EF90,
+    [0xEF93 - ROM_START] = rom_EF93,
+    [0xEF96 - ROM_START] = rom_EF96,
+    [0xEF98 - ROM_START] = rom_EF98,
+    [0xEFA2 - ROM_START] = rom_EFA2,
+    [0xEFB2 - ROM_START] = rom_EFB2,
+    [0xEFB7 - ROM_START] = rom_EFB7,
+    [0xEFBA - ROM_START] = rom_EFBA,
+    [0xEFBD - ROM_START] = rom_EFBD,
+    [0xEFC2 - ROM_START] = rom_EFC2,
+    [0xEFC9 - ROM_START] = rom_EFC9,
+    [0xEFCE - ROM_START] = rom_EFCE,
+    [0xEFCF - ROM_START] = rom_EFCF,
+    [0xEFD2 - ROM_START] = rom_EFD2,
+    [0xEFD5 - ROM_START] = rom_EFD5,
+    [0xEFF1 - ROM_START] = rom_EFF1,
+    [0xEFF8 - ROM_START] = rom_EFF8,
+    [0xEFFA - ROM_START] = rom_EFFA,
+    [0xEFFC - ROM_START] = rom_EFFC,
+    [0xF004 - ROM_START] = rom_F004,
+    [0xF011 - ROM_START] = rom_F011,
+    [0xF01D - ROM_START] = rom_F01D,
+    [0xF022 - ROM_START] = rom_F022,
+    [0xF025 - ROM_START] = rom_F025,
+    [0xF033 - ROM_START] = rom_F033,
+    [0xF03B - ROM_START] = rom_F03B,
+    [0xF03E - ROM_START] = rom_F03E,
+    [0xF05B - ROM_START] = rom_F05B,
+    [0xF060 - ROM_START] = rom_F060,
+    [0xF070 - ROM_START] = rom_F070,
+    [0xF07F - ROM_START] = rom_F07F,
+    [0xF090 - ROM_START] = rom_F090,
+    [0xF09C - ROM_START] = rom_F09C,
+    [0xF09F - ROM_START] = rom_F09F,
+    [0xF0A5 - ROM_START] = rom_F0A5,
+    [0xF0AB - ROM_START] = rom_F0AB,
+    [0xF0BE - ROM_START] = rom_F0BE,
+    [0xF0D0 - ROM_START] = rom_F0D0,
+    [0xF0D1 - ROM_START] = rom_F0D1,
+    [0xF0DF - ROM_START] = rom_F0DF,
+    [0xF0E5 - ROM_START] = rom_F0E5,
+    [0xF0EA - ROM_START] = rom_F0EA,
+    [0xF0ED - ROM_START] = rom_F0ED,
+    [0xF0F2 - ROM_START] = rom_F0F2,
+    [0xF10A - ROM_START] = rom_F10A,
+    [0xF10F - ROM_START] = rom_F10F,
+    [0xF115 - ROM_START] = rom_F115,
+    [0xF118 - ROM_START] = rom_F118,
+    [0xF119 - ROM_START] = rom_F119,
+    [0xF11C - ROM_START] = rom_F11C,
+    [0xF11E - ROM_START] = rom_F11E,
+    [0xF121 - ROM_START] = rom_F121,
+    [0xF12D - ROM_START] = rom_F12D,
+    [0xF133 - ROM_START] = rom_F133,
+    [0xF13A - ROM_START] = rom_F13A,
+    [0xF141 - ROM_START] = rom_F141,
+    [0xF143 - ROM_START] = rom_F143,
+    [0xF14C - ROM_START] = rom_F14C,
+    [0xF15A - ROM_START] = rom_F15A,
+    [0xF15F - ROM_START] = rom_F15F,
+    [0xF163 - ROM_START] = rom_F163,
+    [0xF171 - ROM_START] = rom_F171,
+    [0xF173 - ROM_START] = rom_F173,
+    [0xF17F - ROM_START] = rom_F17F,
+    [0xF189 - ROM_START] = rom_F189,
+    [0xF193 - ROM_START] = rom_F193,
+    [0xF195 - ROM_START] = rom_F195,
+    [0xF198 - ROM_START] = rom_F198,
+    [0xF19A - ROM_START] = rom_F19A,
+    [0xF19D - ROM_START] = rom_F19D,
+    [0xF1A4 - ROM_START] = rom_F1A4,
+    [0xF1A6 - ROM_START] = rom_F1A6,
+    [0xF1A9 - ROM_START] = rom_F1A9,
+    [0xF1B8 - ROM_START] = rom_F1B8,
+    [0xF1C2 - ROM_START] = rom_F1C2,
+    [0xF1C4 - ROM_START] = rom_F1C4,
+    [0xF1C7 - ROM_START] = rom_F1C7,
+    [0xF1CB - ROM_START] = rom_F1CB,
+    [0xF1DA - ROM_START] = rom_F1DA,
+    [0xF1DF - ROM_START] = rom_F1DF,
+    [0xF1E2 - ROM_START] = rom_F1E2,
+    [0xF1E6 - ROM_START] = rom_F1E6,
+    [0xF1F0 - ROM_START] = rom_F1F0,
+    [0xF1F2 - ROM_START] = rom_F1F2,
+    [0xF1F5 - ROM_START] = rom_F1F5,
+    [0xF1FA - ROM_START] = rom_F1FA,
+    [0xF1FD - ROM_START] = rom_F1FD,
+    [0xF202 - ROM_START] = rom_F202,
+    [0xF207 - ROM_START] = rom_F207,
+    [0xF20D - ROM_START] = rom_F20D,
+    [0xF214 - ROM_START] = rom_F214,
+    [0xF217 - ROM_START] = rom_F217,
+    [0xF219 - ROM_START] = rom_F219,
+    [0xF21D - ROM_START] = rom_F21D,
+    [0xF21F - ROM_START] = rom_F21F,
+    [0xF220 - ROM_START] = rom_F220,
+    [0xF22B - ROM_START] = rom_F22B,
+    [0xF22D - ROM_START] = rom_F22D,
+    [0xF234 - ROM_START] = rom_F234,
+    [0xF236 - ROM_START] = rom_F236,
+    [0xF239 - ROM_START] = rom_F239,
+    [0xF23C - ROM_START] = rom_F23C,
+    [0xF242 - ROM_START] = rom_F242,
+    [0xF246 - ROM_START] = rom_F246,
+    [0xF24B - ROM_START] = rom_F24B,
+    [0xF24E - ROM_START] = rom_F24E,
+    [0xF254 - ROM_START] = rom_F254,
+    [0xF258 - ROM_START] = rom_F258,
+    [0xF259 - ROM_START] = rom_F259,
+    [0xF2B0 - ROM_START] = rom_F2B0,
+    [0xF2BE - ROM_START] = rom_F2BE,
+    [0xF2C0 - ROM_START] = rom_F2C0,
+    [0xF2C5 - ROM_START] = rom_F2C5,
+    [0xF2C9 - ROM_START] = rom_F2C9,
+    [0xF2CD - ROM_START] = rom_F2CD,
+    [0xF2D1 - ROM_START] = rom_F2D1,
+    [0xF2D8 - ROM_START] = rom_F2D8,
+    [0xF2DF - ROM_START] = rom_F2DF,
+    [0xF2E2 - ROM_START] = rom_F2E2,
+    [0xF2E9 - ROM_START] = rom_F2E9,
+    [0xF2ED - ROM_START] = rom_F2ED,
+    [0xF2F0 - ROM_START] = rom_F2F0,
+    [0xF2F3 - ROM_START] = rom_F2F3,
+    [0xF2F6 - ROM_START] = rom_F2F6,
+    [0xF2F9 - ROM_START] = rom_F2F9,
+    [0xF301 - ROM_START] = rom_F301,
+    [0xF304 - ROM_START] = rom_F304,
+    [0xF306 - ROM_START] = rom_F306,
+    [0xF30A - ROM_START] = rom_F30A,
+    [0xF30F - ROM_START] = rom_F30F,
+    [0xF320 - ROM_START] = rom_F320,
+    [0xF326 - ROM_START] = rom_F326,
+    [0xF32A - ROM_START] = rom_F32A,
+    [0xF32F - ROM_START] = rom_F32F,
+    [0xF33C - ROM_START] = rom_F33C,
+    [0xF342 - ROM_START] = rom_F342,
+    [0xF348 - ROM_START] = rom_F348,
+    [0xF367 - ROM_START] = rom_F367,
+    [0xF36B - ROM_START] = rom_F36B,
+    [0xF36E - ROM_START] = rom_F36E,
+    [0xF370 - ROM_START] = rom_F370,
+    [0xF37C - ROM_START] = rom_F37C,
+    [0xF393 - ROM_START] = rom_F393,
+    [0xF395 - ROM_START] = rom_F395,
+    [0xF39B - ROM_START] = rom_F39B,
+    [0xF3AB - ROM_START] = rom_F3AB,
+    [0xF3B1 - ROM_START] = rom_F3B1,
+    [0xF3BB - ROM_START] = rom_F3BB,
+    #if !IDLE_SKIP
+    [0xF3BE - ROM_START] = rom_F3BE,
+    #endif
+    [0xF3C0 - ROM_START] = rom_F3C0,
+    #if !IDLE_SKIP
+    [0xF3C8 - ROM_START] = rom_F3C8,
+    #endif
+    [0xF3CA - ROM_START] = rom_F3CA,
+    [0xF3D5 - ROM_START] = rom_F3D5,
+    [0xF3D8 - ROM_START] = rom_F3D8,
+    [0xF3DC - ROM_START] = rom_F3DC,
+    [0xF3E2 - ROM_START] = rom_F3E2,
+    [0xF3E6 - ROM_START] = rom_F3E6,
+    [0xF3F2 - ROM_START] = rom_F3F2,
+    [0xF3FD - ROM_START] = rom_F3FD,
+    [0xF404 - ROM_START] = rom_F404,
+    [0xF407 - ROM_START] = rom_F407,
+    [0xF40B - ROM_START] = rom_F40B,
+    [0xF410 - ROM_START] = rom_F410,
+    [0xF418 - ROM_START] = rom_F418,
+    [0xF41B - ROM_START] = rom_F41B,
+    [0xF41E - ROM_START] = rom_F41E,
+    [0xF423 - ROM_START] = rom_F423,
+    [0xF430 - ROM_START] = rom_F430,
+    [0xF432 - ROM_START] = rom_F432,
+    [0xF43A - ROM_START] = rom_F43A,
+    [0xF43D - ROM_START] = rom_F43D,
+    [0xF43F - ROM_START] = rom_F43F,
+    [0xF447 - ROM_START] = rom_F447,
+    [0xF44F - ROM_START] = rom_F44F,
+    [0xF455 - ROM_START] = rom_F455,
+    [0xF45E - ROM_START] = rom_F45E,
+    [0xF461 - ROM_START] = rom_F461,
+    [0xF465 - ROM_START] = rom_F465,
+    [0xF46A - ROM_START] = rom_F46A,
+    [0xF46F - ROM_START] = rom_F46F,
+    [0xF473 - ROM_START] = rom_F473,
+    [0xF47E - ROM_START] = rom_F47E,
+    [0xF483 - ROM_START] = rom_F483,
+    [0xF487 - ROM_START] = rom_F487,
+    [0xF48A - ROM_START] = rom_F48A,
+    [0xF48D - ROM_START] = rom_F48D,
+    [0xF492 - ROM_START] = rom_F492,
+    [0xF497 - ROM_START] = rom_F497,
+    [0xF4AC - ROM_START] = rom_F4AC,
+    [0xF4BB - ROM_START] = rom_F4BB,
+    [0xF4CA - ROM_START] = rom_F4CA,
+    [0xF4CE - ROM_START] = rom_F4CE,
+    [0xF4D1 - ROM_START] = rom_F4D1,
+    #if !IDLE_SKIP
+    [0xF4D4 - ROM_START] = rom_F4D4,
+    #endif
+    [0xF4D6 - ROM_START] = rom_F4D6,
+    [0xF4DF - ROM_START] = rom_F4DF,
+    #if !IDLE_SKIP
+    [0xF4E1 - ROM_START] = rom_F4E1,
+    #endif
+    [0xF4E3 - ROM_START] = rom_F4E3,
+    [0xF4ED - ROM_START] = rom_F4ED,
+    [0xF4F0 - ROM_START] = rom_F4F0,
+    [0xF4F6 - ROM_START] = rom_F4F6,
+    [0xF4FB - ROM_START] = rom_F4FB,
+    [0xF4FE - ROM_START] = rom_F4FE,
+    [0xF502 - ROM_START] = rom_F502,
+    [0xF505 - ROM_START] = rom_F505,
+    [0xF50A - ROM_START] = rom_F50A,
+    [0xF50D - ROM_START] = rom_F50D,
+    [0xF510 - ROM_START] = rom_F510,
+    [0xF536 - ROM_START] = rom_F536,
+    [0xF538 - ROM_START] = rom_F538,
+    [0xF53B - ROM_START] = rom_F53B,
+    #if !IDLE_SKIP
+    [0xF53D - ROM_START] = rom_F53D,
+    #endif
+    [0xF53F - ROM_START] = rom_F53F,
+    [0xF548 - ROM_START] = rom_F548,
+    [0xF54D - ROM_START] = rom_F54D,
+    [0xF54E - ROM_START] = rom_F54E,
+    [0xF551 - ROM_START] = rom_F551,
+    [0xF553 - ROM_START] = rom_F553,
+    [0xF556 - ROM_START] = rom_F556,
+    [0xF55D - ROM_START] = rom_F55D,
+    [0xF562 - ROM_START] = rom_F562,
+    [0xF567 - ROM_START] = rom_F567,
+    [0xF56E - ROM_START] = rom_F56E,
+    [0xF572 - ROM_START] = rom_F572,
+    [0xF575 - ROM_START] = rom_F575,
+    [0xF578 - ROM_START] = rom_F578,
+    [0xF581 - ROM_START] = rom_F581,
+    [0xF586 - ROM_START] = rom_F586,
+    [0xF589 - ROM_START] = rom_F589,
+    [0xF58C - ROM_START] = rom_F58C,
+    #if !IDLE_SKIP
+    [0xF58E - ROM_START] = rom_F58E,
+    #endif
+    [0xF590 - ROM_START] = rom_F590,
+    [0xF594 - ROM_START] = rom_F594,
+    #if !IDLE_SKIP
+    [0xF5AB - ROM_START] = rom_F5AB,
+    #endif
+    [0xF5AD - ROM_START] = rom_F5AD,
+    [0xF5B1 - ROM_START] = rom_F5B1,
+    [0xF5B3 - ROM_START] = rom_F5B3,
+    #if !IDLE_SKIP
+    [0xF5B6 - ROM_START] = rom_F5B6,
+    #endif
+    [0xF5B8 - ROM_START] = rom_F5B8,
+    [0xF5BF - ROM_START] = rom_F5BF,
+    #if !IDLE_SKIP
+    [0xF5C1 - ROM_START] = rom_F5C1,
+    #endif
+    [0xF5C3 - ROM_START] = rom_F5C3,
+    #if !IDLE_SKIP
+    [0xF5CA - ROM_START] = rom_F5CA,
+    #endif
+    [0xF5CC - ROM_START] = rom_F5CC,
+    [0xF5DC - ROM_START] = rom_F5DC,
+    [0xF5E9 - ROM_START] = rom_F5E9,
+    [0xF5EC - ROM_START] = rom_F5EC,
+    [0xF5F1 - ROM_START] = rom_F5F1,
+    [0xF5F2 - ROM_START] = rom_F5F2,
+    [0xF60D - ROM_START] = rom_F60D,
+    [0xF624 - ROM_START] = rom_F624,
+    [0xF627 - ROM_START] = rom_F627,
+    [0xF635 - ROM_START] = rom_F635,
+    [0xF643 - ROM_START] = rom_F643,
+    [0xF64F - ROM_START] = rom_F64F,
+    [0xF652 - ROM_START] = rom_F652,
+    [0xF66E - ROM_START] = rom_F66E,
+    [0xF678 - ROM_START] = rom_F678,
+    [0xF67F - ROM_START] = rom_F67F,
+    [0xF685 - ROM_START] = rom_F685,
+    [0xF68E - ROM_START] = rom_F68E,
+    [0xF691 - ROM_START] = rom_F691,
+    [0xF695 - ROM_START] = rom_F695,
+    [0xF698 - ROM_START] = rom_F698,
+    [0xF69B - ROM_START] = rom_F69B,
+    [0xF6A0 - ROM_START] = rom_F6A0,
+    [0xF6A3 - ROM_START] = rom_F6A3,
+    [0xF6A5 - ROM_START] = rom_F6A5,
+    #if !IDLE_SKIP
+    [0xF6A8 - ROM_START] = rom_F6A8,
+    #endif
+    [0xF6AA - ROM_START] = rom_F6AA,
+    [0xF6B0 - ROM_START] = rom_F6B0,
+    [0xF6B3 - ROM_START] = rom_F6B3,
+    #if !IDLE_SKIP
+    [0xF6B5 - ROM_START] = rom_F6B5,
+    #endif
+    [0xF6B7 - ROM_START] = rom_F6B7,
+    [0xF6BD - ROM_START] = rom_F6BD,
+    [0xF6C2 - ROM_START] = rom_F6C2,
+    [0xF6C5 - ROM_START] = rom_F6C5,
+    [0xF6CA - ROM_START] = rom_F6CA,
+    [0xF6CD - ROM_START] = rom_F6CD,
+    [0xF6D0 - ROM_START] = rom_F6D0,
+    [0xF76B - ROM_START] = rom_F76B,
+    [0xF76F - ROM_START] = rom_F76F,
+    [0xF78F - ROM_START] = rom_F78F,
+    [0xF7BA - ROM_START] = rom_F7BA,
+    [0xF7BF - ROM_START] = rom_F7BF,
+    [0xF7C8 - ROM_START] = rom_F7C8,
+    [0xF7D9 - ROM_START] = rom_F7D9,
+    [0xF7E6 - ROM_START] = rom_F7E6,
+    [0xF7FC - ROM_START] = rom_F7FC,
+    [0xF802 - ROM_START] = rom_F802,
+    [0xF854 - ROM_START] = rom_F854,
+    [0xF85A - ROM_START] = rom_F85A,
+    [0xF8E0 - ROM_START] = rom_F8E0,
+    [0xF8F7 - ROM_START] = rom_F8F7,
+    [0xF90C - ROM_START] = rom_F90C,
+    [0xF911 - ROM_START] = rom_F911,
+    [0xF91A - ROM_START] = rom_F91A,
+    [0xF92B - ROM_START] = rom_F92B,
+    [0xF934 - ROM_START] = rom_F934,
+    [0xF953 - ROM_START] = rom_F953,
+    [0xF964 - ROM_START] = rom_F964,
+    [0xF969 - ROM_START] = rom_F969,
+    [0xF972 - ROM_START] = rom_F972,
+    [0xF975 - ROM_START] = rom_F975,
+    [0xF978 - ROM_START] = rom_F978,
+    [0xF97E - ROM_START] = rom_F97E,
+    [0xF98F - ROM_START] = rom_F98F,
+    [0xF99C - ROM_START] = rom_F99C,
+    [0xF9AD - ROM_START] = rom_F9AD,
+    [0xF9B1 - ROM_START] = rom_F9B1,
+    [0xF9B6 - ROM_START] = rom_F9B6,
+    [0xF9BA - ROM_START] = rom_F9BA,
+    [0xF9C1 - ROM_START] = rom_F9C1,
+    [0xF9CB - ROM_START] = rom_F9CB,
+    [0xF9CF - ROM_START] = rom_F9CF,
+    [0xF9D6 - ROM_START] = rom_F9D6,
+    [0xF9D9 - ROM_START] = rom_F9D9,
+    [0xF9DD - ROM_START] = rom_F9DD,
+    [0xF9E0 - ROM_START] = rom_F9E0,
+    [0xF9E4 - ROM_START] = rom_F9E4,
+    [0xF9E8 - ROM_START] = rom_F9E8,
+    [0xF9FA - ROM_START] = rom_F9FA,
+    [0xF9FF - ROM_START] = rom_F9FF,
+    [0xFA02 - ROM_START] = rom_FA02,
+    [0xFA2E - ROM_START] = rom_FA2E,
+    [0xFA32 - ROM_START] = rom_FA32,
+    [0xFA63 - ROM_START] = rom_FA63,
+    [0xFA69 - ROM_START] = rom_FA69,
+    [0xFABE - ROM_START] = rom_FABE,
+    [0xFE67 - ROM_START] = rom_FE67,
+    [0xFE73 - ROM_START] = rom_FE73,
+    [0xFE76 - ROM_START] = rom_FE76,
+    [0xFE7C - ROM_START] = rom_FE7C,
+    [0xFE7F - ROM_START] = rom_FE7F,
+    [0xFEE7 - ROM_START] = rom_FEE7,
+    [0xFEEA - ROM_START] = rom_FEEA,
+    [0xFEF3 - ROM_START] = rom_FEF3,
+    [0xFEF6 - ROM_START] = rom_FEF6,
+    [0xFEF9 - ROM_START] = rom_FEF9,
+    [0xFEFB - ROM_START] = rom_FEFB,
+    [0xFEFE - ROM_START] = rom_FEFE,
+    [0xFF01 - ROM_START] = rom_FF01,
+    [0xFF08 - ROM_START] = rom_FF08,
+    [0xFF0D - ROM_START] = rom_FF0D,
+};
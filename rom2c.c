@@ -0,0 +1,149 @@
+/*  Ahead-of-time translator: turns a ROM image into rom1541.h, one C
+    function per basic block, for STATIC_ROM builds (see aot.h).
+
+        gcc -O2 rom2c.c -o rom2c && ./rom2c 1541rom.bin C000 > rom1541.h
+
+    The code reachable from the NMI, RESET and IRQ vectors is walked through
+    branches, JMP and JSR. A block starts at every target found this way and
+    ends at a branch, JMP, JSR, RTS, RTI or at the start of the next block.
+    BRK and undocumented opcodes are never translated: a block stops in front
+    of them and the interpreter takes over.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#define DEBUG 0
+#include "dom6502.h"
+
+uint8_t ram[65536];
+bool seen[65536];       // an instruction starts here
+bool leader[65536];     // a block starts here
+uint16_t todo[65536];
+int todo_count = 0;
+
+bool translated(uint8_t opcode) {
+    return opcode != 0x00 && instructions[opcode].mode != _ND;
+}
+
+bool ends_block(uint8_t opcode) {
+    // Same rule as block_ends() in blocks.h
+    return instructions[opcode].mode == REL ||
+        opcode == 0x20 || opcode == 0x40 || opcode == 0x4C || opcode == 0x60 || opcode == 0x6C;
+}
+
+void target(uint32_t addr, uint32_t start) {
+    if (addr < start || addr > 0xFFFF)
+        return;
+    leader[addr] = true;
+    if (!seen[addr])
+        todo[todo_count++] = addr;
+}
+
+void walk(uint32_t start) {
+    while (todo_count > 0) {
+        uint32_t addr = todo[--todo_count];
+        while (addr <= 0xFFFF && !seen[addr] && translated(ram[addr])) {
+            uint8_t opcode = ram[addr];
+            instruction i = instructions[opcode];
+            uint32_t next = addr + i.bytes;
+            uint16_t operand = (ram[(uint16_t)(addr + 2)] << 8) | ram[(uint16_t)(addr + 1)];
+            seen[addr] = true;
+
+            if (i.mode == REL) {
+                target((uint16_t)(next + (int8_t)operand), start);
+                target(next, start);
+            }
+            else if (opcode == 0x20) {
+                target(operand, start);
+                target(next, start);
+            }
+            else if (opcode == 0x4C) {
+                target(operand, start);
+            }
+            if (ends_block(opcode))
+                break;
+            addr = next;
+        }
+    }
+}
+
+const char *mode_name(uint8_t mode) {
+    static const char *names[] = {
+        "_ND", "ACC", "IMP", "IMM", "ZP_", "ZPX", "ZPY", "AB_", "ABX", "ABY", "REL", "IN_", "INX", "INY"
+    };
+    return names[mode];
+}
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s rom.bin start_hex > rom1541.h\n", argv[0]);
+        return 1;
+    }
+    FILE *fptr = fopen(argv[1], "rb");
+    if (fptr == NULL) {
+        perror(argv[1]);
+        return 1;
+    }
+    uint32_t start = strtoul(argv[2], NULL, 16);
+    fseek(fptr, 0L, SEEK_END);
+    long size = ftell(fptr);
+    rewind(fptr);
+    if (start + size != 0x10000) {
+        fprintf(stderr, "the image must end at $FFFF\n");
+        return 1;
+    }
+    fread(ram + start, size, 1, fptr);
+    fclose(fptr);
+
+    const uint16_t vectors[] = {0xFFFA, 0xFFFC, 0xFFFE};   // NMI, RESET, IRQ
+    for (int v = 0; v < 3; v++)
+        target((ram[vectors[v] + 1] << 8) | ram[vectors[v]], start);
+    walk(start);
+
+    printf("/*  Generated by rom2c from %s, do not edit.  */\n\n", argv[1]);
+    printf("#define ROM_START 0x%04X\n#define ROM_SIZE  0x%04lX\n\n", start, size);
+
+    printf("static const uint8_t rom_image[ROM_SIZE] = {");
+    for (long i = 0; i < size; i++)
+        printf("%s0x%02X,", (i % 16) ? " " : "\n    ", ram[start + i]);
+    printf("\n};\n");
+
+    int blocks = 0, count = 0;
+    for (uint32_t addr = start; addr <= 0xFFFF; addr++) {
+        if (!leader[addr] || !translated(ram[addr]))
+            continue;
+        printf("\nstatic inline uint32_t rom_%04X(cpu *c) {\n    uint32_t cycles = 0;\n", addr);
+        uint32_t pc = addr;
+        int n = 0;
+        while (true) {
+            uint8_t opcode = ram[pc];
+            instruction i = instructions[opcode];
+            uint32_t next = pc + i.bytes;
+            uint16_t operand = (i.bytes == 3) ? (ram[(uint16_t)(pc + 2)] << 8) | ram[(uint16_t)(pc + 1)] :
+                               (i.bytes == 2) ? ram[(uint16_t)(pc + 1)] : 0;
+            printf("    S(%s, %s, 0x%04X, 0x%04X, %d)   // %04X\n",
+                i.name, mode_name(i.mode), operand, (uint16_t)next, i.cycles, pc);
+            n++;
+            if (ends_block(opcode) || next > 0xFFFF || leader[next] || !translated(ram[next]))
+                break;
+            pc = next;
+        }
+        printf("    c->executed += %d;\n    return cycles;\n}\n", n);
+        blocks++;
+        count += n;
+    }
+
+    printf("\nstatic rom_block const rom_code[ROM_SIZE] = {\n");
+    for (uint32_t addr = start; addr <= 0xFFFF; addr++) {
+        if (!leader[addr] || !translated(ram[addr]))
+            continue;
+        // Idle loops are left to the block engine, which can fast-forward them
+        if (idle_loop(ram, NULL, addr))
+            printf("    #if !IDLE_SKIP\n    [0x%04X - ROM_START] = rom_%04X,\n    #endif\n", addr, addr);
+        else
+            printf("    [0x%04X - ROM_START] = rom_%04X,\n", addr, addr);
+    }
+    printf("};\n");
+
+    fprintf(stderr, "%d blocks, %d instructions\n", blocks, count);
+    return 0;
+}
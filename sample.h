@@ -0,0 +1,256 @@
+#ifndef SAMPLE_H
+#define SAMPLE_H
+
+#include <signal.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include "dom6502.h"
+
+/*  Sampling profiler: where the emulated programs and the host code that
+    runs them spend their time, at a cost low enough for long runs.
+
+    Each thread that takes part gets a timer on its own CPU time
+    (timer_create() on CLOCK_THREAD_CPUTIME_ID, delivered to that thread
+    with SIGPROF). The signal handler copies one word, c->where of the
+    cpu the thread is running (see SAMPLE_AT() in dom6502.h), into the
+    thread's own buffer, with the opcode at pc when an interpreter
+    published it; nothing is shared, locked or allocated there. The kernel
+    checks these timers at its tick, which bounds the rate: a few hundred
+    samples per second.
+    sample_report() adds the buffers of all threads up, once sampling is
+    over: 6502 routines by samples, each pc counted in the routine whose
+    entry is the nearest below it, and host handlers by samples.
+
+    sample_start() turns it on for the process and the calling thread,
+    other threads join with sample_thread(), as the farm workers do. Needs
+    SAMPLING, and _GNU_SOURCE for SIGEV_THREAD_ID.  */
+
+#if !SAMPLING
+#error "sample.h needs SAMPLING"
+#endif
+#ifndef _GNU_SOURCE
+#error "sample.h needs _GNU_SOURCE"
+#endif
+
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid     // glibc before 2.35 has no name for it
+#endif
+
+#ifndef SAMPLE_BUFFER
+#define SAMPLE_BUFFER (1 << 20)     // samples a thread keeps, later ones are only counted
+#endif
+
+typedef struct sampler {
+    uint32_t *samples;
+    _Atomic size_t count;           // written by the signal handler only
+    uint64_t dropped;               // samples past SAMPLE_BUFFER
+    timer_t timer;
+    bool armed;
+    struct sampler *next;
+} sampler;
+
+static _Thread_local sampler *sample_self;     // the calling thread's buffer, NULL when it does not sample
+static sampler *sample_threads;                // every buffer so far, newest first
+static pthread_mutex_t sample_lock = PTHREAD_MUTEX_INITIALIZER;
+static _Atomic long sample_period;             // ns of thread CPU time between samples, 0 when off
+
+static inline void sample_signal(int sig, siginfo_t *info, void *context) {
+    sampler *s = sample_self;
+    if (s == NULL)
+        return;
+    size_t n = atomic_load_explicit(&s->count, memory_order_relaxed);
+    if (n == SAMPLE_BUFFER) {
+        s->dropped++;
+        return;
+    }
+    const cpu *c = sample_cpu;
+    uint32_t where = SAMPLE_OUTSIDE << 16;
+    if (c != NULL) {
+        where = atomic_load_explicit(&c->where, memory_order_relaxed);
+        if (where >> 16 == SAMPLE_CPU_PC)
+            where = c->pc;
+        else if (where >> 16 == SAMPLE_ROM)
+            where = SAMPLE_ROM << 16 | c->pc;
+        if (where >> 16 == SAMPLE_OPCODE)
+            where |= c->ram[where & 0xFFFF] << 16;
+    }
+    s->samples[n] = where;
+    atomic_store_explicit(&s->count, n + 1, memory_order_relaxed);
+}
+
+static inline bool sample_thread(void) {
+    // Samples the calling thread from now on, when sampling is on; false otherwise
+    long period = atomic_load(&sample_period);
+    if (period == 0 || sample_self != NULL)
+        return false;
+    sampler *s = calloc(1, sizeof(sampler));
+    if (s == NULL || (s->samples = malloc(SAMPLE_BUFFER * sizeof(uint32_t))) == NULL) {
+        free(s);
+        return false;
+    }
+    struct sigevent ev = {.sigev_notify = SIGEV_THREAD_ID, .sigev_signo = SIGPROF};
+    ev.sigev_notify_thread_id = syscall(SYS_gettid);
+    if (timer_create(CLOCK_THREAD_CPUTIME_ID, &ev, &s->timer) != 0) {
+        free(s->samples);
+        free(s);
+        return false;
+    }
+    pthread_mutex_lock(&sample_lock);
+    s->next = sample_threads;
+    sample_threads = s;
+    pthread_mutex_unlock(&sample_lock);
+    sample_self = s;
+    struct timespec every = {period / 1000000000, period % 1000000000};
+    timer_settime(s->timer, 0, &(struct itimerspec){every, every}, NULL);
+    s->armed = true;
+    return true;
+}
+
+static inline void sample_thread_end(void) {
+    // The calling thread stops sampling, what it took stays for sample_report()
+    sampler *s = sample_self;
+    if (s == NULL)
+        return;
+    if (s->armed)
+        timer_delete(s->timer);
+    s->armed = false;
+    sample_self = NULL;
+}
+
+static inline bool sample_start(int hz) {
+    // Turns sampling on at hz samples per second of CPU time, for this thread and those that call sample_thread()
+    if (hz <= 0)
+        return false;
+    struct sigaction sa = {.sa_sigaction = sample_signal, .sa_flags = SA_SIGINFO | SA_RESTART};
+    sigemptyset(&sa.sa_mask);
+    if (sigaction(SIGPROF, &sa, NULL) != 0)
+        return false;
+    atomic_store(&sample_period, 1000000000L / hz);
+    return sample_thread();
+}
+
+static inline void sample_stop(void) {
+    // No new threads start sampling, the calling one stops
+    atomic_store(&sample_period, 0);
+    sample_thread_end();
+}
+
+typedef struct sample_counts {
+    uint64_t pc[65536];
+    uint64_t handler[SAMPLE_HANDLERS];
+    uint64_t total;
+    uint64_t dropped;
+    int threads;
+} sample_counts;
+
+static inline void sample_reduce(sample_counts *t) {
+    // The buffers of every thread added up; the threads must have stopped sampling
+    memset(t, 0, sizeof(*t));
+    pthread_mutex_lock(&sample_lock);
+    for (sampler *s = sample_threads; s != NULL; s = s->next) {
+        size_t n = atomic_load(&s->count);
+        for (size_t i = 0; i < n; i++) {
+            uint32_t w = s->samples[i];
+            t->handler[w >> 16 < SAMPLE_HANDLERS ? w >> 16 : SAMPLE_OUTSIDE]++;
+            if (w >> 16 != SAMPLE_OUTSIDE)
+                t->pc[w & 0xFFFF]++;
+        }
+        t->total += n;
+        t->dropped += s->dropped;
+        t->threads++;
+    }
+    pthread_mutex_unlock(&sample_lock);
+}
+
+static inline const char *sample_handler(int h, char name[16]) {
+    static const char *const modes[14] = {
+        [_ND] = "", [ACC] = " a", [IMP] = "", [IMM] = " #", [ZP_] = " zp", [ZPX] = " zp,x",
+        [ZPY] = " zp,y", [AB_] = " abs", [ABX] = " abs,x", [ABY] = " abs,y", [REL] = " rel",
+        [IN_] = " (abs)", [INX] = " (zp,x)", [INY] = " (zp),y"
+    };
+    static const char *const others[] = {
+        "block interpreter", "translated code", "static ROM", "events", "outside the cpu"
+    };
+    if (h >= SAMPLE_BLOCK)
+        return others[h - SAMPLE_BLOCK];
+    sprintf(name, "%s%s", instructions[h].name, modes[instructions[h].mode]);
+    return name;
+}
+
+static const uint64_t *sample_sorted;     // for the qsort() comparisons of sample_report()
+
+static inline int sample_by_count(const void *a, const void *b) {
+    uint64_t x = sample_sorted[*(const uint32_t *)a], y = sample_sorted[*(const uint32_t *)b];
+    return x < y ? 1 : x > y ? -1 : 0;
+}
+
+static inline void sample_report(FILE *f, const cpu *c, const char *listing, int lines) {
+    /*  The `lines` busiest 6502 routines and host handlers. Routine entries
+        and names come from the labels and JSR targets of the listing, and
+        the interrupt vectors in the memory of c if not NULL; any address is
+        its own routine without a listing.  */
+    static sample_counts t;
+    static char *labels[65536];
+    static bool entry[65536];
+    static uint64_t routine[65536];
+    static uint32_t order[65536];
+    sample_reduce(&t);
+    bool have_listing = listing != NULL && listing_read(listing, labels, entry);
+    for (uint32_t a = 0; a <= 0xFFFF; a++)
+        entry[a] = entry[a] || labels[a] != NULL || !have_listing;
+    for (int v = 0xFFFA; c != NULL && v < 0x10000; v += 2)
+        entry[c->ram[v] | (c->ram[v + 1] << 8)] = true;
+
+    memset(routine, 0, sizeof(routine));
+    uint32_t at = 0;
+    for (uint32_t a = 0; a <= 0xFFFF; a++) {
+        if (entry[a])
+            at = a;
+        routine[at] += t.pc[a];
+    }
+    uint64_t in_cpu = t.total - t.handler[SAMPLE_OUTSIDE];
+    fprintf(
+        f, "%llu samples on %d threads, %llu outside the cpu, %llu dropped\n\n",
+        (unsigned long long)t.total, t.threads, (unsigned long long)t.handler[SAMPLE_OUTSIDE],
+        (unsigned long long)t.dropped
+    );
+
+    int n = 0;
+    for (uint32_t a = 0; a <= 0xFFFF; a++)
+        if (routine[a] > 0)
+            order[n++] = a;
+    sample_sorted = routine;
+    qsort(order, n, sizeof(order[0]), sample_by_count);
+    fprintf(f, "%s                   samples\n", have_listing ? "routine" : "pc     ");
+    for (int i = 0; i < n && i < lines; i++) {
+        uint32_t a = order[i];
+        fprintf(
+            f, "%04X  %-16.16s %10llu %5.1f%%\n", a, labels[a] != NULL ? labels[a] : "",
+            (unsigned long long)routine[a], 100.0 * routine[a] / (in_cpu > 0 ? in_cpu : 1)
+        );
+    }
+
+    n = 0;
+    for (uint32_t h = 0; h < SAMPLE_HANDLERS; h++)
+        if (t.handler[h] > 0)
+            order[n++] = h;
+    sample_sorted = t.handler;
+    qsort(order, n, sizeof(order[0]), sample_by_count);
+    char name[16];
+    fprintf(f, "\nhost handler             samples\n");
+    for (int i = 0; i < n && i < lines; i++) {
+        fprintf(
+            f, "%-20s %10llu %5.1f%%\n", sample_handler(order[i], name),
+            (unsigned long long)t.handler[order[i]], 100.0 * t.handler[order[i]] / (t.total > 0 ? t.total : 1)
+        );
+    }
+    for (uint32_t a = 0; a <= 0xFFFF; a++) {
+        free(labels[a]);
+        labels[a] = NULL;
+        entry[a] = false;
+    }
+}
+
+#endif
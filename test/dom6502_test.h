@@ -5,25 +5,32 @@
 #include <sched.h>
 #include "../dom6502.h"
 #include "../timing.h"
+#include "../farm.h"
+#include "../lockstep.h"
+#include "../via.h"
+#include "../events.h"
+#include "../trace.h"
 
 #define COLOR_RESET "\x1B[0m"
 #define COLOR_RED   "\x1B[31m"
 #define COLOR_GREEN "\x1B[32m"
 
 uint16_t start_program = 0xC000;
+cpu *cpu0;      // the CPU under test, created by main()
+bool warp = false;     // set by the test main(), run_6502() then skips pacing
 
 void write_ram(uint8_t bytes, uint16_t operand) {
     if (bytes == 3) {
-        ram[pc + 1] = operand & 0x00FF;
-        ram[pc + 2] = (operand & 0xFF00) >> 8;
+        cpu0->ram[cpu0->pc + 1] = operand & 0x00FF;
+        cpu0->ram[cpu0->pc + 2] = (operand & 0xFF00) >> 8;
     }
     else {
-        ram[pc + 1] = operand;
+        cpu0->ram[cpu0->pc + 1] = operand;
     }
 }
 
 void a_brk() {
-	ram[pc++] = 0x00;
+	cpu0->ram[cpu0->pc++] = 0x00;
 }
 
 void a_ora(uint16_t operand, uint8_t mode) {
@@ -66,9 +73,9 @@ void a_ora(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_asl(uint16_t operand, uint8_t mode) {
@@ -99,13 +106,13 @@ void a_asl(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_php() {
-	ram[pc++] = 0x08;
+	cpu0->ram[cpu0->pc++] = 0x08;
 }
 
 void a_bpl(uint16_t operand, uint8_t mode) {
@@ -120,13 +127,13 @@ void a_bpl(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_clc() {
-	ram[pc++] = 0x18;
+	cpu0->ram[cpu0->pc++] = 0x18;
 }
 
 void a_jsr(uint16_t operand, uint8_t mode) {
@@ -141,9 +148,9 @@ void a_jsr(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_and(uint16_t operand, uint8_t mode) {
@@ -186,9 +193,9 @@ void a_and(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_bit(uint16_t operand, uint8_t mode) {
@@ -207,9 +214,9 @@ void a_bit(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_rol(uint16_t operand, uint8_t mode) {
@@ -240,13 +247,13 @@ void a_rol(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_plp() {
-	ram[pc++] = 0x28;
+	cpu0->ram[cpu0->pc++] = 0x28;
 }
 
 void a_bmi(uint16_t operand, uint8_t mode) {
@@ -261,17 +268,17 @@ void a_bmi(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_sec() {
-	ram[pc++] = 0x38;
+	cpu0->ram[cpu0->pc++] = 0x38;
 }
 
 void a_rti() {
-	ram[pc++] = 0x40;
+	cpu0->ram[cpu0->pc++] = 0x40;
 }
 
 void a_eor(uint16_t operand, uint8_t mode) {
@@ -314,9 +321,9 @@ void a_eor(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_lsr(uint16_t operand, uint8_t mode) {
@@ -347,13 +354,13 @@ void a_lsr(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_pha() {
-	ram[pc++] = 0x48;
+	cpu0->ram[cpu0->pc++] = 0x48;
 }
 
 void a_jmp(uint16_t operand, uint8_t mode) {
@@ -372,9 +379,9 @@ void a_jmp(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_bvc(uint16_t operand, uint8_t mode) {
@@ -389,17 +396,17 @@ void a_bvc(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_cli() {
-	ram[pc++] = 0x58;
+	cpu0->ram[cpu0->pc++] = 0x58;
 }
 
 void a_rts() {
-	ram[pc++] = 0x60;
+	cpu0->ram[cpu0->pc++] = 0x60;
 }
 
 void a_adc(uint16_t operand, uint8_t mode) {
@@ -442,9 +449,9 @@ void a_adc(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_ror(uint16_t operand, uint8_t mode) {
@@ -475,13 +482,13 @@ void a_ror(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_pla() {
-	ram[pc++] = 0x68;
+	cpu0->ram[cpu0->pc++] = 0x68;
 }
 
 void a_bvs(uint16_t operand, uint8_t mode) {
@@ -496,13 +503,13 @@ void a_bvs(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_sei() {
-	ram[pc++] = 0x78;
+	cpu0->ram[cpu0->pc++] = 0x78;
 }
 
 void a_sta(uint16_t operand, uint8_t mode) {
@@ -541,9 +548,9 @@ void a_sta(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_sty(uint16_t operand, uint8_t mode) {
@@ -566,9 +573,9 @@ void a_sty(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_stx(uint16_t operand, uint8_t mode) {
@@ -591,32 +598,32 @@ void a_stx(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_dey() {
-	ram[pc++] = 0x88;
+	cpu0->ram[cpu0->pc++] = 0x88;
 }
 
 void a_txa() {
-	ram[pc++] = 0x8A;
+	cpu0->ram[cpu0->pc++] = 0x8A;
 }
 
 void a_bcc(uint16_t operand) {
 	uint8_t bytes = 2;
-	ram[pc] = 0x90;
+	cpu0->ram[cpu0->pc] = 0x90;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_tya() {
-	ram[pc++] = 0x98;
+	cpu0->ram[cpu0->pc++] = 0x98;
 }
 
 void a_txs() {
-	ram[pc++] = 0x9A;
+	cpu0->ram[cpu0->pc++] = 0x9A;
 }
 
 void a_ldy(uint16_t operand, uint8_t mode) {
@@ -647,9 +654,9 @@ void a_ldy(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_lda(uint16_t operand, uint8_t mode) {
@@ -692,9 +699,9 @@ void a_lda(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_ldx(uint16_t operand, uint8_t mode) {
@@ -725,17 +732,17 @@ void a_ldx(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_tay() {
-	ram[pc++] = 0xA8;
+	cpu0->ram[cpu0->pc++] = 0xA8;
 }
 
 void a_tax() {
-	ram[pc++] = 0xAA;
+	cpu0->ram[cpu0->pc++] = 0xAA;
 }
 
 void a_bcs(uint16_t operand, uint8_t mode) {
@@ -750,17 +757,17 @@ void a_bcs(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_clv() {
-	ram[pc++] = 0xB8;
+	cpu0->ram[cpu0->pc++] = 0xB8;
 }
 
 void a_tsx() {
-	ram[pc++] = 0xBA;
+	cpu0->ram[cpu0->pc++] = 0xBA;
 }
 
 void a_cpy(uint16_t operand, uint8_t mode) {
@@ -783,9 +790,9 @@ void a_cpy(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_cmp(uint16_t operand, uint8_t mode) {
@@ -828,9 +835,9 @@ void a_cmp(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_dec(uint16_t operand, uint8_t mode) {
@@ -857,17 +864,17 @@ void a_dec(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_iny() {
-	ram[pc++] = 0xC8;
+	cpu0->ram[cpu0->pc++] = 0xC8;
 }
 
 void a_dex() {
-	ram[pc++] = 0xCA;
+	cpu0->ram[cpu0->pc++] = 0xCA;
 }
 
 void a_bne(uint16_t operand, uint8_t mode) {
@@ -882,13 +889,13 @@ void a_bne(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_cld() {
-	ram[pc++] = 0xD8;
+	cpu0->ram[cpu0->pc++] = 0xD8;
 }
 
 void a_cpx(uint16_t operand, uint8_t mode) {
@@ -911,9 +918,9 @@ void a_cpx(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_sbc(uint16_t operand, uint8_t mode) {
@@ -956,9 +963,9 @@ void a_sbc(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_inc(uint16_t operand, uint8_t mode) {
@@ -985,17 +992,17 @@ void a_inc(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_inx() {
-	ram[pc++] = 0xE8;
+	cpu0->ram[cpu0->pc++] = 0xE8;
 }
 
 void a_nop() {
-	ram[pc++] = 0xEA;
+	cpu0->ram[cpu0->pc++] = 0xEA;
 }
 
 void a_beq(uint16_t operand, uint8_t mode) {
@@ -1010,25 +1017,25 @@ void a_beq(uint16_t operand, uint8_t mode) {
 			printf("%sERROR %s%s\n", COLOR_RED, __func__, COLOR_RESET);
 			return;
 	}
-	ram[pc] = opcode;
+	cpu0->ram[cpu0->pc] = opcode;
 	write_ram(bytes, operand);
-	pc += bytes;
+	cpu0->pc += bytes;
 }
 
 void a_sed() {
-	ram[pc++] = 0xF8;
+	cpu0->ram[cpu0->pc++] = 0xF8;
 }
 
 void reset_pc() {
-    pc = start_program;
+    cpu0->pc = start_program;
 }
 
 void reset_cpu() {
-	ac = 0;
-	xr = 0;
-	yr = 0;
-	sp = 0xFF;
-	sr = 0x32;
+	cpu0->ac = 0;
+	cpu0->xr = 0;
+	cpu0->yr = 0;
+	cpu0->sp = 0xFF;
+	cpu0->sr = 0x32;
 }
 
 void run_6502() {
@@ -1036,34 +1043,112 @@ void run_6502() {
 
 	#if DEBUG
 	printf("addr instr     disass        |AC XR YR SP SR|nvdizc|\n");
-	int cont = 0;
+	uint64_t first = cpu0->executed;
 	#endif
 	
-	uint8_t *b;
-    do {
-		suseconds_t a = get_microsec();
-		
-        b = ram + pc;
-        instruction i = instructions[*b];
-        void (*func)() = i.operation;
-        func(i.bytes, &i.cycles, i.mode);
-
-		microsleep((i.cycles / SPEED) - (get_microsec() - a));
-
-		/*suseconds_t timing_test = get_microsec() - a;
-		if (timing_test != i.cycles)
-			printf("WRONG TIMING: %ld (%d)\n", timing_test, i.cycles);*/
-
-		#if DEBUG
-		cont++;
-		#endif
-	} while (*b != 0);
+	cpu0->halted = false;
+	code_changed(cpu0);
+	if (warp) {
+		do {
+			cpu_run_cycles(cpu0, WARP_QUANTUM);
+		} while (!cpu0->halted);
+	}
+	else {
+		pacer p;
+		pace_start(&p);
+		do {
+			pace(&p, cpu_run_cycles(cpu0, PACE_QUANTUM));
+		} while (!cpu0->halted);
+	}
 
 	#if DEBUG
-	printf("%d instructions\n", cont);
+	printf("%d instructions\n", (int)(cpu0->executed - first));
 	#endif
 }
 
+// A device page for the bus tests: reads return the low address byte + $10
+typedef struct test_device {
+	int reads, writes;
+	uint16_t last_addr;
+	uint8_t last_value;
+} test_device;
+
+uint8_t test_device_read(void *ctx, uint16_t addr, uint64_t now) {
+	((test_device *)ctx)->reads++;
+	return (addr & 0xFF) + 0x10;
+}
+
+void test_device_write(void *ctx, uint16_t addr, uint8_t v, uint64_t now) {
+	test_device *d = ctx;
+	d->writes++;
+	d->last_addr = addr;
+	d->last_value = v;
+}
+
+typedef struct test_ticker {
+	cpu *c;					// NULL: only log the tag
+	event e;
+	uint64_t period;
+	int fired;
+	uint64_t late;			// most cycles c->clock was past `when`
+	char tag, *log;
+} test_ticker;
+
+void test_ticker_fire(void *ctx, uint64_t when) {
+	test_ticker *t = ctx;
+	if (t->c == NULL) {
+		t->log[strlen(t->log)] = t->tag;
+		return;
+	}
+	t->fired++;
+	if (t->c->clock - when > t->late)
+		t->late = t->c->clock - when;
+	events_schedule(&t->c->events, &t->e, when + t->period);
+}
+
+// Turns counting and hooks on when written to, and off at the hook's first write to $20
+typedef struct test_probe {
+	cpu *c;
+	int writes;				// seen by the hook
+	uint16_t last_addr;
+} test_probe;
+
+void test_probe_write(void *ctx, uint16_t addr, uint8_t v, uint64_t now) {
+	cpu_instrument(((test_probe *)ctx)->c, INSTR_COUNT | INSTR_HOOKS);
+}
+
+void test_probe_hook(void *ctx, uint16_t addr, uint8_t v, bool write) {
+	test_probe *p = ctx;
+	if (!write)
+		return;
+	p->writes++;
+	p->last_addr = addr;
+	if (addr == 0x20)
+		cpu_instrument(p->c, 0);
+}
+
+void test_via_irq(void *ctx, bool active) {
+	cpu_irq(ctx, active);
+}
+
+// Records the flags a farm job ran with in its `user`, then leaves counting on for the slot's next job
+void test_farm_done(cpu *c, farm_job *j) {
+	*(uint32_t *)j->user = atomic_load(&c->instr.flags);
+	cpu_instrument(c, INSTR_COUNT);
+}
+
+typedef struct test_runner {
+	cpu *c;
+	uint64_t cycles;		// what cpu_run_cycles() returned
+} test_runner;
+
+void *test_runner_thread(void *arg) {
+	// Runs for practically ever, unless stopped from another thread
+	test_runner *r = arg;
+	r->cycles = cpu_run_cycles(r->c, 1ull << 60);
+	return NULL;
+}
+
 void assert_reg_equals(uint8_t *reg, uint8_t value, char *test_name) {
     printf("%s ", test_name);
     if (*reg == value)
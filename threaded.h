@@ -0,0 +1,121 @@
+#ifndef THREADED_H
+#define THREADED_H
+
+#include "dom6502.h"
+#include "opcodes.h"
+
+/*  Threaded code interpreter core.
+
+    One function holds the whole CPU: the registers live in locals for the
+    duration of a call and every opcode body ends with its own indirect jump
+    to the next opcode (GCC/Clang computed goto), so there is no call, no
+    instruction struct copy and no shared dispatch branch.
+    Budget, IRQ and halt are folded into a single test per instruction;
+    everything else happens on the slow path.  */
+
+#define AC l_ac
+#define XR l_xr
+#define YR l_yr
+#define SP l_sp
+#define SR l_sr
+#define PC l_pc
+#define RD(addr) bus_read(&c->bus, addr, c->clock + cycles)
+#define WR(addr, v) bus_write(&c->bus, addr, v, c->clock + cycles)
+#define RD_RAM(addr) ram[addr]
+#define WR_RAM(addr, v) ram[addr] = (v)
+#define OPB() ram[PC + 1]
+#define OPW() ((ram[PC + 2] << 8) | ram[PC + 1])
+#define CYC cycles
+#define HALT() stop = true
+#define FN l_fn
+#define FZ l_fz
+
+#define T_DISPATCH() \
+    SAMPLE_AT(c, SAMPLE_OPCODE, PC); \
+    goto *dispatch[ram[PC]];
+
+#define T_NEXT() \
+    if (__builtin_expect(((cycles >= budget) | stop | PENDING(c)) != 0, 0)) goto slow; \
+    n++; \
+    T_DISPATCH()
+
+#define T_LABEL(code, op, mode, bytes, cyc) [code] = &&op_##code,
+
+#define T_BODY(code, op, mode, bytes, cyc) \
+    op_##code: { \
+        EA_##mode \
+        PC += bytes; \
+        OP_##op(LD_##mode, ST_##mode) \
+        cycles += cyc; \
+        T_NEXT() \
+    }
+
+static inline uint64_t run_threaded(cpu *c, uint64_t budget) {
+    // Same contract as run_table(): stops at BRK or once `budget` cycles are spent
+    static void *const dispatch[256] = {
+        [0 ... 0xFF] = &&op_nul,
+        OPCODES(T_LABEL)
+    };
+
+    uint8_t *const ram = c->ram;
+    uint8_t l_ac = c->ac, l_xr = c->xr, l_yr = c->yr, l_sp = c->sp, l_sr;
+    #if LAZY_FLAGS
+    uint8_t l_fn, l_fz;
+    #endif
+    uint16_t l_pc = c->pc;
+    uint64_t cycles = 0;
+    uint64_t n = 0;
+    bool stop = false;
+    PUT_SR(c->sr);
+
+    n++;
+    T_DISPATCH()
+
+    OPCODES(T_BODY)
+
+op_nul:
+    {
+        PC += 1;
+        T_NEXT()
+    }
+
+slow:
+    {
+        uint32_t pending = PENDING(c);
+        TAKE_INTERRUPT(pending)
+        if (!stop && cycles < budget && !(pending & PEND_EXIT)) {
+            n++;
+            T_DISPATCH()
+        }
+    }
+
+    c->halted = stop;
+    c->ac = l_ac; c->xr = l_xr; c->yr = l_yr; c->sp = l_sp; c->sr = GET_SR();
+    c->pc = l_pc;
+    c->executed += n;
+    c->clock += cycles;
+    return cycles;
+}
+
+#undef AC
+#undef XR
+#undef YR
+#undef SP
+#undef SR
+#undef PC
+#undef RD
+#undef WR
+#undef RD_RAM
+#undef WR_RAM
+#undef OPB
+#undef OPW
+#undef CYC
+#undef HALT
+#undef FN
+#undef FZ
+#undef T_DISPATCH
+#undef T_NEXT
+#undef T_LABEL
+#undef T_BODY
+
+#endif
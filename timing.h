@@ -1,18 +1,301 @@
 #ifndef TIMING_H
 #define TIMING_H
 
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
 #include <sys/time.h>
 #include <time.h>
 
-suseconds_t get_microsec() {
+#ifndef PACE_QUANTUM
+#define PACE_QUANTUM 1000       // emulated cycles run between two pacing points
+#endif
+#define PACE_SPIN_NS  50000     // the end of a wait is spun, the OS wakes up too late
+#define PACE_RESYNC_NS 100000000    // further behind than this, stop trying to catch up
+
+static inline suseconds_t get_microsec() {
     struct timeval ret;
     gettimeofday(&ret, NULL);
     return (suseconds_t)(ret.tv_sec * 1000000) + ret.tv_usec;
 }
 
-void microsleep(int duration) {
-    suseconds_t a = get_microsec();
-    while ((get_microsec() - a) < duration) {}
+static inline uint64_t monotonic_nanosec() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/*  TSC timebase: rdtsc costs a few ns, against a vDSO call (or a syscall)
+    for clock_gettime. timebase_init() checks that the TSC is invariant
+    (constant rate, running in every power state), then measures its
+    frequency against CLOCK_MONOTONIC. get_nanosec() then reads the TSC
+    and converts it with a 32.32 fixed point factor. The result stays in
+    the CLOCK_MONOTONIC time scale, so it can be passed to clock_nanosleep;
+    timebase_sync(), called about once a second by pace(), re-anchors it and
+    refines the factor over the whole time since calibration.
+    Any thread may call get_nanosec(): timebase_init() calibrates once for
+    the process (pthread_once), and timebase_sync() publishes the new
+    anchor and factor under a sequence counter, so a reader never mixes
+    the old anchor with the new factor.
+    Without an invariant TSC, or on other architectures, get_nanosec()
+    keeps calling clock_gettime.  */
+
+#ifndef TIMEBASE_TSC
+#define TIMEBASE_TSC 1
+#endif
+#define TIMEBASE_CALIBRATE_NS 20000000  // measuring interval
+#define TIMEBASE_TOLERANCE    1000      // two measurements must agree to 1 part in this
+#define TIMEBASE_SYNC_NS      1000000000
+
+#if TIMEBASE_TSC && defined(__x86_64__)
+#include <cpuid.h>
+#include <x86intrin.h>
+
+static struct {
+    bool tsc;           // the TSC is used, set once by timebase_calibrate()
+    _Atomic uint32_t seq;       // odd while timebase_sync() rewrites the three below
+    _Atomic uint64_t tsc0;      // TSC at mono0
+    _Atomic uint64_t mono0;     // CLOCK_MONOTONIC ns at tsc0
+    _Atomic uint64_t mult;      // ns per TSC tick, 32.32 fixed point
+    uint64_t tsc_first, mono_first;     // first calibration point
+} timebase;
+static pthread_once_t timebase_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t timebase_lock = PTHREAD_MUTEX_INITIALIZER;     // one timebase_sync() at a time
+
+static inline bool tsc_invariant() {
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) || eax < 0x80000007)
+        return false;
+    __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx);
+    return edx & (1 << 8);
+}
+
+static inline void tsc_sample(uint64_t *tsc, uint64_t *mono) {
+    // Pairs a TSC read with a CLOCK_MONOTONIC read, keeping the tightest of a few tries
+    uint64_t best = UINT64_MAX;
+    for (int i = 0; i < 5; i++) {
+        uint64_t t0 = __rdtsc();
+        uint64_t m = monotonic_nanosec();
+        uint64_t t1 = __rdtsc();
+        if (i == 0 || t1 - t0 < best) {
+            best = t1 - t0;
+            *tsc = t0 + (t1 - t0) / 2;
+            *mono = m;
+        }
+    }
+}
+
+static inline uint64_t tsc_measure(uint64_t *tsc, uint64_t *mono) {
+    // Returns the 32.32 ns per tick factor over one calibration interval
+    uint64_t t1, m1;
+    tsc_sample(tsc, mono);
+    struct timespec ts = {0, TIMEBASE_CALIBRATE_NS};
+    while (nanosleep(&ts, &ts) == -1 && errno == EINTR) {}
+    tsc_sample(&t1, &m1);
+    if (t1 <= *tsc)
+        return 0;
+    return ((unsigned __int128)(m1 - *mono) << 32) / (t1 - *tsc);
+}
+
+static inline void timebase_calibrate() {
+    timebase.tsc = false;
+    if (!tsc_invariant())
+        return;
+    uint64_t t, m, t0, m0;
+    uint64_t a = tsc_measure(&t, &m);
+    uint64_t b = tsc_measure(&t0, &m0);
+    if (a == 0 || b == 0 || (a > b ? a - b : b - a) > b / TIMEBASE_TOLERANCE)
+        return;
+    atomic_store_explicit(&timebase.tsc0, t0, memory_order_relaxed);
+    atomic_store_explicit(&timebase.mono0, m0, memory_order_relaxed);
+    atomic_store_explicit(&timebase.mult, b, memory_order_relaxed);
+    timebase.tsc_first = t;
+    timebase.mono_first = m;
+    timebase.tsc = true;
+}
+
+static inline void timebase_init() {
+    // Calibrates on the first call from any thread, the others wait for it
+    pthread_once(&timebase_once, timebase_calibrate);
+}
+
+static inline void timebase_sync() {
+    if (!timebase.tsc)
+        return;
+    uint64_t t, m;
+    tsc_sample(&t, &m);
+    uint64_t mult = ((unsigned __int128)(m - timebase.mono_first) << 32) / (t - timebase.tsc_first);
+    pthread_mutex_lock(&timebase_lock);
+    uint32_t seq = atomic_load_explicit(&timebase.seq, memory_order_relaxed);
+    atomic_store_explicit(&timebase.seq, seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&timebase.tsc0, t, memory_order_relaxed);
+    atomic_store_explicit(&timebase.mono0, m, memory_order_relaxed);
+    atomic_store_explicit(&timebase.mult, mult, memory_order_relaxed);
+    atomic_store_explicit(&timebase.seq, seq + 2, memory_order_release);
+    pthread_mutex_unlock(&timebase_lock);
+}
+
+static inline uint64_t get_nanosec() {
+    if (__builtin_expect(!timebase.tsc, 0))
+        return monotonic_nanosec();
+    uint32_t seq;
+    uint64_t tsc0, mono0, mult;
+    do {
+        seq = atomic_load_explicit(&timebase.seq, memory_order_acquire);
+        tsc0 = atomic_load_explicit(&timebase.tsc0, memory_order_relaxed);
+        mono0 = atomic_load_explicit(&timebase.mono0, memory_order_relaxed);
+        mult = atomic_load_explicit(&timebase.mult, memory_order_relaxed);
+        atomic_thread_fence(memory_order_acquire);
+    } while ((seq & 1) || atomic_load_explicit(&timebase.seq, memory_order_relaxed) != seq);
+    return mono0 + (uint64_t)(((unsigned __int128)(__rdtsc() - tsc0) * mult) >> 32);
+}
+#else
+static struct {
+    bool tsc;
+} timebase;
+
+void timebase_init() {}
+
+void timebase_sync() {}
+
+static inline uint64_t get_nanosec() {
+    return monotonic_nanosec();
+}
+#endif
+
+/*  Real-time pacing: the emulator runs a quantum of cycles at full speed,
+    then waits for the wall-clock time those cycles take on the real chip.
+    Deadlines are computed from the total cycle count since pace_start(), so
+    rounding and late wake-ups never accumulate; a late quantum is simply
+    made up by the following ones. The wait sleeps with clock_nanosleep and
+    only spins for the last PACE_SPIN_NS.
+
+    The emulated clock rate is clock_rate, in mHz so that rates like the
+    985248.4 Hz of a PAL C64 are exact; 0 runs unthrottled. Any thread may
+    change it with pace_set_clock(), pace() picks the new rate up at the
+    next quantum: the time of the cycles already run is fixed and only the
+    following ones use the new rate, so changes never shift the past.  */
+
+static _Atomic uint64_t clock_rate = (uint64_t)CLOCK_HZ * 1000;
+
+static inline void pace_set_clock(double hz) {
+    atomic_store_explicit(&clock_rate, hz > 0 ? (uint64_t)(hz * 1000 + 0.5) : 0, memory_order_relaxed);
+}
+
+static inline uint64_t cycles_to_ns(uint64_t cycles, uint64_t rate) {
+    return (unsigned __int128)cycles * 1000000000000ULL / rate;
+}
+
+typedef struct pacer {
+    uint64_t start;     // CLOCK_MONOTONIC ns of emulated cycle 0 at the current rate
+    uint64_t cycles;    // emulated cycles since start
+    uint64_t rate;      // clock_rate in use
+    int64_t lag;        // ns behind the deadline at the last pacing point, 0 when early
+    uint64_t lost;      // ns given up by resynchronisations
+    uint64_t sync;      // next timebase_sync()
+} pacer;
+
+static inline void pace_start(pacer *p) {
+    timebase_init();
+    p->start = get_nanosec();
+    p->cycles = 0;
+    p->rate = atomic_load_explicit(&clock_rate, memory_order_relaxed);
+    p->lag = 0;
+    p->lost = 0;
+    p->sync = p->start + TIMEBASE_SYNC_NS;
+}
+
+static inline void pace(pacer *p, uint64_t cycles) {
+    // Accounts `cycles` more emulated cycles and waits until they are due
+    uint64_t rate = atomic_load_explicit(&clock_rate, memory_order_relaxed);
+    uint64_t now = get_nanosec();
+    if (rate != p->rate) {
+        // The cycles run so far keep their time, the new rate starts from there
+        p->start = p->rate ? p->start + cycles_to_ns(p->cycles, p->rate) : now;
+        p->cycles = 0;
+        p->rate = rate;
+        p->lag = 0;
+    }
+    if (rate == 0)
+        return;
+    p->cycles += cycles;
+    uint64_t deadline = p->start + cycles_to_ns(p->cycles, rate);
+
+    if (now >= p->sync) {
+        timebase_sync();
+        p->sync = now + TIMEBASE_SYNC_NS;
+    }
+    if (now >= deadline) {
+        p->lag = now - deadline;
+        if (p->lag > PACE_RESYNC_NS) {
+            // Suspended or far too slow: start again from here
+            p->lost += p->lag;
+            p->start += p->lag;
+            p->lag = 0;
+        }
+        return;
+    }
+    p->lag = 0;
+
+    if (deadline - now > PACE_SPIN_NS) {
+        uint64_t wake = deadline - PACE_SPIN_NS;
+        struct timespec ts = {wake / 1000000000, wake % 1000000000};
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR) {}
+    }
+    while (get_nanosec() < deadline) {}
+}
+
+/*  Warp mode: no pacing at all, cpu_run_cycles() runs WARP_QUANTUM cycles per call
+    and a meter reports the throughput: emulated clock rate, instructions
+    per second and host time per instruction, for the whole run and, when an
+    interval is set, for every interval.  */
+
+#define WARP_QUANTUM 1000000    // cycles per cpu_run_cycles() call in warp mode
+
+typedef struct meter {
+    uint64_t interval;      // ns between periodic reports, 0 for none
+    uint64_t start, cycles, instructions;                   // at meter_start()
+    uint64_t last, last_cycles, last_instructions;          // at the last periodic report
+} meter;
+
+static inline void meter_print(const char *what, uint64_t ns, uint64_t cycles, uint64_t instructions) {
+    double seconds = ns / 1e9;
+    printf(
+        "%s: %llu cycles, %llu instructions in %.3f s: %.2f MHz, %.2f M instructions/s, %.2f ns/instruction\n",
+        what, (unsigned long long)cycles, (unsigned long long)instructions, seconds,
+        seconds > 0 ? cycles / seconds / 1e6 : 0.0,
+        seconds > 0 ? instructions / seconds / 1e6 : 0.0,
+        instructions ? (double)ns / instructions : 0.0
+    );
+}
+
+static inline void meter_start(meter *m, uint64_t interval, uint64_t cycles, uint64_t instructions) {
+    timebase_init();
+    m->interval = interval;
+    m->start = m->last = get_nanosec();
+    m->cycles = m->last_cycles = cycles;
+    m->instructions = m->last_instructions = instructions;
+}
+
+static inline void meter_tick(meter *m, uint64_t cycles, uint64_t instructions) {
+    // Called between quanta with the running totals, prints when an interval is over
+    if (m->interval == 0)
+        return;
+    uint64_t now = get_nanosec();
+    if (now - m->last < m->interval)
+        return;
+    meter_print("interval", now - m->last, cycles - m->last_cycles, instructions - m->last_instructions);
+    m->last = now;
+    m->last_cycles = cycles;
+    m->last_instructions = instructions;
+}
+
+static inline void meter_end(meter *m, uint64_t cycles, uint64_t instructions) {
+    meter_print("total", get_nanosec() - m->start, cycles - m->cycles, instructions - m->instructions);
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,153 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+/*  Binary instruction trace: one fixed-size record per instruction, written
+    to a file by a background thread so that the emulation thread never
+    formats text nor blocks on I/O.
+
+    The engine side (trace_put) copies the record into a single producer,
+    single consumer ring and publishes it with one release store. The
+    writer thread takes whatever has been published, up to the end of the
+    ring, and hands it to fwrite() in one piece through a large stdio
+    buffer. Only when the disk cannot keep up does the producer wait for
+    room; the waits are counted in `stalls`. A failed write is remembered
+    and what follows is dropped, so the emulation never waits on a full
+    disk; trace_close() reports it.
+
+    The file is a trace_header followed by the records, in the byte order
+    of the host. trace2txt.c prints it in the print_asm() text format.  */
+
+#define TRACE_MAGIC "D65T"
+#ifndef TRACE_RING
+#define TRACE_RING (1 << 18)    // records in the ring, a power of two
+#endif
+#define TRACE_BUFFER (4 << 20)  // stdio buffer of the trace file, in bytes
+
+typedef struct trace_header {
+    char magic[4];
+    uint32_t record_size;       // sizeof(trace_record)
+} trace_header;
+
+typedef struct __attribute__((packed)) trace_record {
+    uint64_t cycle;             // emulated time the engine gave the instruction's bus accesses
+    uint16_t pc;
+    uint16_t ea;                // effective address, 0 for the modes without one
+    uint8_t opcode;
+    uint8_t operand[2];         // the two bytes after the opcode, whether used or not
+    uint8_t ac, xr, yr, sp, sr; // after the instruction, as print_asm() shows them
+} trace_record;
+
+_Static_assert(sizeof(trace_record) == 20, "trace records are packed");
+
+typedef struct trace {
+    _Alignas(64) _Atomic uint64_t head;     // records published by the cpu
+    uint64_t tail_seen;                     // the producer's last look at tail
+    uint64_t stalls;                        // times the producer found the ring full
+    _Alignas(64) _Atomic uint64_t tail;     // records written out
+    _Atomic bool closing;
+    FILE *f;
+    char *buffer;
+    int error;                              // errno of the first failed write, 0 if none
+    pthread_t writer;
+    trace_record ring[TRACE_RING];
+} trace;
+
+static inline void *trace_writer(void *arg) {
+    trace *t = arg;
+    while (true) {
+        // closing is read first: once it is set, head no longer moves
+        bool closing = atomic_load_explicit(&t->closing, memory_order_acquire);
+        uint64_t head = atomic_load_explicit(&t->head, memory_order_acquire);
+        uint64_t tail = atomic_load_explicit(&t->tail, memory_order_relaxed);
+        if (head == tail) {
+            if (closing)
+                break;
+            nanosleep(&(struct timespec){0, 50000}, NULL);
+            continue;
+        }
+        uint64_t at = tail & (TRACE_RING - 1);
+        uint64_t n = head - tail;
+        if (n > TRACE_RING - at)
+            n = TRACE_RING - at;
+        if (t->error == 0 && fwrite(&t->ring[at], sizeof(trace_record), n, t->f) != n)
+            t->error = errno ? errno : EIO;
+        atomic_store_explicit(&t->tail, tail + n, memory_order_release);
+    }
+    return NULL;
+}
+
+static inline trace *trace_open(const char *path) {
+    // Creates the file and starts its writer, NULL on failure
+    trace *t = calloc(1, sizeof(trace));
+    if (t == NULL)
+        return NULL;
+    t->f = fopen(path, "wb");
+    t->buffer = malloc(TRACE_BUFFER);
+    if (t->f == NULL || t->buffer == NULL) {
+        if (t->f != NULL)
+            fclose(t->f);
+        free(t->buffer);
+        free(t);
+        return NULL;
+    }
+    setvbuf(t->f, t->buffer, _IOFBF, TRACE_BUFFER);
+    trace_header h = {.record_size = sizeof(trace_record)};
+    memcpy(h.magic, TRACE_MAGIC, 4);
+    if (fwrite(&h, sizeof(h), 1, t->f) != 1)
+        t->error = errno ? errno : EIO;
+    if (pthread_create(&t->writer, NULL, trace_writer, t) != 0) {
+        fclose(t->f);
+        free(t->buffer);
+        free(t);
+        return NULL;
+    }
+    return t;
+}
+
+static inline void trace_put(trace *t, const trace_record *r) {
+    // Only ever called from the thread running the cpu
+    uint64_t head = atomic_load_explicit(&t->head, memory_order_relaxed);
+    if (__builtin_expect(head - t->tail_seen == TRACE_RING, 0)) {
+        t->tail_seen = atomic_load_explicit(&t->tail, memory_order_acquire);
+        if (head - t->tail_seen == TRACE_RING) {
+            t->stalls++;
+            do {
+                sched_yield();
+                t->tail_seen = atomic_load_explicit(&t->tail, memory_order_acquire);
+            } while (head - t->tail_seen == TRACE_RING);
+        }
+    }
+    t->ring[head & (TRACE_RING - 1)] = *r;
+    atomic_store_explicit(&t->head, head + 1, memory_order_release);
+}
+
+static inline uint64_t trace_close(trace *t, int *error) {
+    /*  Writes out what is left and closes the file, returns the stalls.
+        error gets the errno of the first write or close that failed, the
+        trace is cut short there; 0 when all of it is in the file.  */
+    *error = 0;
+    if (t == NULL)
+        return 0;
+    atomic_store_explicit(&t->closing, true, memory_order_release);
+    pthread_join(t->writer, NULL);
+    if (fclose(t->f) != 0 && t->error == 0)
+        t->error = errno ? errno : EIO;
+    free(t->buffer);
+    uint64_t stalls = t->stalls;
+    *error = t->error;
+    free(t);
+    return stalls;
+}
+
+#endif
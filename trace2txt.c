@@ -0,0 +1,129 @@
+/*  Offline decoder for the binary traces of trace.h (dom6502 -T file):
+    prints every record in the print_asm() text format.
+
+        gcc -O2 trace2txt.c -o trace2txt -pthread && ./trace2txt trace.bin > trace.txt
+
+    With -c each line also gets the cycle stamp and the effective address
+    of the record. With -j n the records of each block read are formatted
+    by n threads at once, each into its own buffer, and written out in
+    order; the output is the same for any n.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "dom6502.h"
+
+#define BLOCK (1 << 16)         // records read at a time
+#define THREADS_MAX 64
+#define CYCLES_MAX 20           // "%12llu $%04X " with a cycle stamp of up to 12 digits
+
+typedef struct slice {
+    const trace_record *records;
+    size_t count;
+    bool cycles;
+    char *out;
+    size_t length;
+} slice;
+
+char *format_cycles(char *p, const trace_record *r) {
+    // Same as printf("%12llu $%04X ")
+    char digits[20];
+    int n = 0;
+    uint64_t v = r->cycle;
+    do {
+        digits[n++] = '0' + v % 10;
+        v /= 10;
+    } while (v != 0);
+    for (int i = n; i < 12; i++)
+        *p++ = ' ';
+    while (n > 0)
+        *p++ = digits[--n];
+    p[0] = ' ';
+    p[1] = '$';
+    asm_hex2(p + 2, r->ea >> 8);
+    asm_hex2(p + 4, r->ea);
+    p[6] = ' ';
+    return p + 7;
+}
+
+void *format_slice(void *arg) {
+    slice *s = arg;
+    char *p = s->out;
+    for (size_t k = 0; k < s->count; k++) {
+        if (s->cycles)
+            p = format_cycles(p, &s->records[k]);
+        p += asm_format(p, &s->records[k]);
+    }
+    s->length = p - s->out;
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+    bool cycles = false;
+    int threads = 1;
+    int opt;
+    while ((opt = getopt(argc, argv, "cj:")) != -1) {
+        if (opt == 'c') {
+            cycles = true;
+        }
+        else if (opt == 'j' && atoi(optarg) >= 1 && atoi(optarg) <= THREADS_MAX) {
+            threads = atoi(optarg);
+        }
+        else {
+            fprintf(stderr, "usage: %s [-c] [-j threads] trace\n", argv[0]);
+            return 1;
+        }
+    }
+    if (optind != argc - 1) {
+        fprintf(stderr, "usage: %s [-c] [-j threads] trace\n", argv[0]);
+        return 1;
+    }
+    FILE *f = fopen(argv[optind], "rb");
+    if (f == NULL) {
+        perror(argv[optind]);
+        return 1;
+    }
+    trace_header h;
+    if (fread(&h, sizeof(h), 1, f) != 1 || memcmp(h.magic, TRACE_MAGIC, 4) != 0 || h.record_size != sizeof(trace_record)) {
+        fprintf(stderr, "%s: not a trace of this build\n", argv[optind]);
+        return 1;
+    }
+
+    pthread_once(&asm_once, asm_init);
+    trace_record *records = malloc(BLOCK * sizeof(trace_record));
+    size_t per = (BLOCK + threads - 1) / threads;
+    slice slices[THREADS_MAX];
+    pthread_t workers[THREADS_MAX];
+    bool started[THREADS_MAX];
+    bool ok = records != NULL;
+    for (int i = 0; i < threads; i++) {
+        slices[i].cycles = cycles;
+        slices[i].out = malloc(per * (ASM_LINE_MAX + CYCLES_MAX));
+        ok = ok && slices[i].out != NULL;
+    }
+    if (!ok) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    size_t n;
+    while ((n = fread(records, sizeof(trace_record), BLOCK, f)) > 0) {
+        for (int i = 0; i < threads; i++) {
+            size_t from = i * per < n ? i * per : n;
+            slices[i].records = records + from;
+            slices[i].count = n - from < per ? n - from : per;
+            // Slice 0 is formatted here, as is any slice a thread could not be started for
+            started[i] = i > 0 && pthread_create(&workers[i], NULL, format_slice, &slices[i]) == 0;
+        }
+        for (int i = 0; i < threads; i++) {
+            if (started[i])
+                pthread_join(workers[i], NULL);
+            else
+                format_slice(&slices[i]);
+            // Big enough that stdio hands it to write() as it is
+            fwrite(slices[i].out, 1, slices[i].length, stdout);
+        }
+    }
+    fclose(f);
+    return 0;
+}
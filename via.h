@@ -0,0 +1,266 @@
+#ifndef VIA_H
+#define VIA_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "bus.h"
+#include "events.h"
+
+/*  MOS 6522 VIA, as the 1541 has two of: the serial bus at $1800 and the
+    disk controller at $1C00.
+
+    Nothing runs per cycle. The timers are kept as the cycle they were last
+    loaded at and the value they were loaded with; a counter is worked out
+    from the clock when a register is read, and an underflow sets its flag
+    when via_update() or a register access catches up past it. The VIA
+    keeps one event in the cpu's queue at via_next_event(), the next
+    underflow that can raise IRQ, and catches up when it fires: the
+    emulated program sees its interrupt on time at no cost in between.
+
+    Timing follows the data sheet: a timer loaded with N counts N, N-1 ... 0,
+    $FFFF, sets its flag on the way to $FFFF (N + 1 cycles after the load)
+    and timer 1 reloads from the latch one cycle later, so free-running
+    interrupts are latch + 2 cycles apart. Timer 1 reloads in one-shot mode
+    as well but only sets its flag once; timer 2 keeps counting down.
+
+    The ports read the output register for output bits and the pins (pa,
+    pb, set by the host) for input bits. CA1 and CB1 edges come in through
+    via_set_ca1() and via_set_cb1(). Not modelled: port latching, the
+    handshake on CA2/CB2, the shift register (it keeps the value written)
+    and timer 2 counting pulses on PB6.
+
+    The IRQ output is handed to `irq` whenever it changes: at a register
+    access, a CA1/CB1 edge or when the event fires.  */
+
+#define VIA_CA2 0x01
+#define VIA_CA1 0x02
+#define VIA_SR  0x04
+#define VIA_CB2 0x08
+#define VIA_CB1 0x10
+#define VIA_T2  0x20
+#define VIA_T1  0x40
+#define VIA_IRQ 0x80
+
+#define VIA_NEVER UINT64_MAX
+
+typedef struct via {
+    uint8_t ora, orb, ddra, ddrb;
+    uint8_t pa, pb;             // input pins, set by the host
+    uint8_t sr, acr, pcr, ifr, ier;
+    bool ca1, cb1;              // input levels
+    uint16_t t1_latch;
+    uint64_t t1_load;           // cycle timer 1 was last loaded
+    uint16_t t1_value;          // and the value it got
+    bool t1_armed;              // the next underflow sets the flag
+    uint8_t t2_latch;           // low byte only
+    uint64_t t2_load;
+    uint16_t t2_value;
+    bool t2_armed;
+    bool irq_out;
+    void (*irq)(void *ctx, bool active);
+    void *ctx;
+    events *q;                  // NULL to drive it with via_update() by hand
+    event timer;                // at via_next_event()
+} via;
+
+static inline void via_fire(void *ctx, uint64_t when);
+
+static inline void via_init(via *v, void (*irq)(void *ctx, bool active), void *ctx, events *q) {
+    // Power on state: all inputs, timers stopped and interrupts disabled
+    *v = (via){0};
+    v->pa = v->pb = 0xFF;
+    v->ca1 = v->cb1 = true;
+    v->t1_latch = v->t1_value = 0xFFFF;
+    v->t2_value = 0xFFFF;
+    v->irq = irq;
+    v->ctx = ctx;
+    v->q = q;
+    event_init(&v->timer, via_fire, v);
+}
+
+static inline void via_irq(via *v) {
+    // IRQ follows the enabled flags
+    bool active = (v->ifr & v->ier & 0x7F) != 0;
+    if (active != v->irq_out) {
+        v->irq_out = active;
+        if (v->irq != NULL)
+            v->irq(v->ctx, active);
+    }
+}
+
+static inline void via_catch_up(via *v, uint64_t now) {
+    // Sets the flags of the underflows due by now and moves timer 1 to its last reload
+    while (true) {
+        uint64_t under = v->t1_load + v->t1_value + 1;
+        if (now < under)
+            break;
+        if (v->t1_armed) {
+            v->ifr |= VIA_T1;
+            v->t1_armed = (v->acr & 0x40) != 0;
+        }
+        // Reloaded the cycle after each underflow, one latch + 2 cycles
+        // apart; the load after the last underflow may still be to come
+        uint64_t period = v->t1_latch + 2;
+        v->t1_load = under + 1 + (now - under) / period * period;
+        v->t1_value = v->t1_latch;
+    }
+    if (v->t2_armed && now >= v->t2_load + v->t2_value + 1) {
+        v->ifr |= VIA_T2;
+        v->t2_armed = false;
+    }
+}
+
+static inline uint16_t via_t1(via *v, uint64_t now) {
+    // $FFFF also in the cycle before a reload, where d wraps around
+    uint64_t d = now - v->t1_load;
+    return d <= v->t1_value ? v->t1_value - d : 0xFFFF;
+}
+
+static inline uint16_t via_t2(via *v, uint64_t now) {
+    return v->t2_value - (uint16_t)(now - v->t2_load);
+}
+
+static inline uint64_t via_next_event(const via *v) {
+    // Cycle of the next underflow that raises IRQ, VIA_NEVER when none can
+    uint64_t next = VIA_NEVER;
+    if (v->t1_armed && (v->ier & VIA_T1))
+        next = v->t1_load + v->t1_value + 1;
+    if (v->t2_armed && (v->ier & VIA_T2) && v->t2_load + v->t2_value + 1 < next)
+        next = v->t2_load + v->t2_value + 1;
+    return next;
+}
+
+static inline void via_done(via *v) {
+    // After every change: IRQ output and the event follow the registers
+    via_irq(v);
+    uint64_t next = via_next_event(v);
+    if (v->q != NULL && next != v->timer.when)
+        events_schedule(v->q, &v->timer, next);
+}
+
+static inline void via_update(via *v, uint64_t now) {
+    // Brings the flags and IRQ up to `now`
+    via_catch_up(v, now);
+    via_done(v);
+}
+
+static inline void via_fire(void *ctx, uint64_t when) {
+    via_update(ctx, when);
+}
+
+static inline uint8_t via_read(via *v, uint8_t reg, uint64_t now) {
+    via_catch_up(v, now);
+    uint8_t value;
+    switch (reg & 0x0F) {
+    case 0x0:
+        v->ifr &= ~(VIA_CB1 | VIA_CB2);
+        value = (v->orb & v->ddrb) | (v->pb & ~v->ddrb);
+        break;
+    case 0x1:
+        v->ifr &= ~(VIA_CA1 | VIA_CA2);
+        // fall through
+    case 0xF:
+        value = (v->ora & v->ddra) | (v->pa & ~v->ddra);
+        break;
+    case 0x2: value = v->ddrb; break;
+    case 0x3: value = v->ddra; break;
+    case 0x4:
+        v->ifr &= ~VIA_T1;
+        value = via_t1(v, now);
+        break;
+    case 0x5: value = via_t1(v, now) >> 8; break;
+    case 0x6: value = v->t1_latch; break;
+    case 0x7: value = v->t1_latch >> 8; break;
+    case 0x8:
+        v->ifr &= ~VIA_T2;
+        value = via_t2(v, now);
+        break;
+    case 0x9: value = via_t2(v, now) >> 8; break;
+    case 0xA: value = v->sr; break;
+    case 0xB: value = v->acr; break;
+    case 0xC: value = v->pcr; break;
+    case 0xD: value = v->ifr | ((v->ifr & v->ier & 0x7F) ? VIA_IRQ : 0); break;
+    default:  value = v->ier | 0x80; break;
+    }
+    via_done(v);
+    return value;
+}
+
+static inline void via_write(via *v, uint8_t reg, uint8_t value, uint64_t now) {
+    via_catch_up(v, now);
+    switch (reg & 0x0F) {
+    case 0x0:
+        v->ifr &= ~(VIA_CB1 | VIA_CB2);
+        v->orb = value;
+        break;
+    case 0x1:
+        v->ifr &= ~(VIA_CA1 | VIA_CA2);
+        // fall through
+    case 0xF: v->ora = value; break;
+    case 0x2: v->ddrb = value; break;
+    case 0x3: v->ddra = value; break;
+    case 0x4:
+    case 0x6: v->t1_latch = (v->t1_latch & 0xFF00) | value; break;
+    case 0x5:
+        // Loads the counter and starts it
+        v->t1_latch = (v->t1_latch & 0x00FF) | (value << 8);
+        v->ifr &= ~VIA_T1;
+        v->t1_load = now;
+        v->t1_value = v->t1_latch;
+        v->t1_armed = true;
+        break;
+    case 0x7:
+        v->t1_latch = (v->t1_latch & 0x00FF) | (value << 8);
+        v->ifr &= ~VIA_T1;
+        break;
+    case 0x8: v->t2_latch = value; break;
+    case 0x9:
+        v->ifr &= ~VIA_T2;
+        v->t2_load = now;
+        v->t2_value = v->t2_latch | (value << 8);
+        v->t2_armed = true;
+        break;
+    case 0xA: v->sr = value; break;
+    case 0xB:
+        v->acr = value;
+        v->t1_armed = v->t1_armed || (value & 0x40);
+        break;
+    case 0xC: v->pcr = value; break;
+    case 0xD: v->ifr &= ~value; break;
+    default:
+        if (value & 0x80)
+            v->ier |= value & 0x7F;
+        else
+            v->ier &= ~value;
+        break;
+    }
+    via_done(v);
+}
+
+static inline void via_edge(via *v, bool *line, bool level, bool positive, uint8_t flag, uint64_t now) {
+    // Sets `flag` when the line moves the way the PCR bit asks for
+    via_catch_up(v, now);
+    if (level != *line && level == positive)
+        v->ifr |= flag;
+    *line = level;
+    via_done(v);
+}
+
+static inline void via_set_ca1(via *v, bool level, uint64_t now) {
+    via_edge(v, &v->ca1, level, v->pcr & 0x01, VIA_CA1, now);
+}
+
+static inline void via_set_cb1(via *v, bool level, uint64_t now) {
+    via_edge(v, &v->cb1, level, v->pcr & 0x10, VIA_CB1, now);
+}
+
+// Bus handlers, the registers repeat every 16 bytes of the mapped pages
+static inline uint8_t via_bus_read(void *ctx, uint16_t addr, uint64_t now) {
+    return via_read(ctx, addr, now);
+}
+
+static inline void via_bus_write(void *ctx, uint16_t addr, uint8_t v, uint64_t now) {
+    via_write(ctx, addr, v, now);
+}
+
+#endif